@@ -0,0 +1,202 @@
+/* Console commands for the SD card
+
+   sdbench measures sequential and random throughput through the FAT
+   filesystem, so the numbers include the FATFS and VFS overheads seen by
+   the application.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "esp_log.h"
+#include "esp_console.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "argtable3/argtable3.h"
+#include "cmd_sdcard.h"
+
+#define MOUNT_POINT "/sdcard"
+#define BENCH_FILE MOUNT_POINT "/sdbench.bin"
+#define BENCH_MAX_BLOCK (64 * 1024)
+#define BENCH_RANDOM_OPS 64
+
+static const char *TAG = "cmd_sdcard";
+
+static const int default_blocks[] = { 512, 4096, 32768 };
+
+static struct {
+    struct arg_int *size;
+    struct arg_int *block;
+    struct arg_end *end;
+} sdbench_args;
+
+typedef struct {
+    int64_t seq_write_us;
+    int64_t seq_read_us;
+    int64_t rand_read_us;
+    int64_t rand_write_us;
+} bench_result_t;
+
+// Bytes per second as KB/s
+static uint32_t kb_per_s(size_t bytes, int64_t us) {
+    return us > 0 ? (uint32_t)((uint64_t)bytes * 1000000 / 1024 / us) : 0;
+}
+
+static uint32_t iops(int ops, int64_t us) {
+    return us > 0 ? (uint32_t)((uint64_t)ops * 1000000 / us) : 0;
+}
+
+static esp_err_t bench_sequential(uint8_t *buf, size_t block, size_t len, bool write_pass, int64_t *us) {
+    int fd = write_pass ? open(BENCH_FILE, O_WRONLY | O_CREAT | O_TRUNC, 0666) : open(BENCH_FILE, O_RDONLY);
+    if (fd < 0) {
+        return ESP_FAIL;
+    }
+
+    int64_t start = esp_timer_get_time();
+    for (size_t done = 0; done < len; done += block) {
+        ssize_t n = write_pass ? write(fd, buf, block) : read(fd, buf, block);
+        if (n != block) {
+            close(fd);
+            return ESP_FAIL;
+        }
+    }
+    if (write_pass) {
+        fsync(fd);
+    }
+    *us = esp_timer_get_time() - start;
+
+    close(fd);
+    return ESP_OK;
+}
+
+static esp_err_t bench_random(uint8_t *buf, size_t block, size_t len, bool write_pass, int64_t *us) {
+    int fd = open(BENCH_FILE, write_pass ? O_WRONLY : O_RDONLY);
+    if (fd < 0) {
+        return ESP_FAIL;
+    }
+
+    uint32_t blocks = len / block;
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < BENCH_RANDOM_OPS; i++) {
+        off_t offset = (off_t)(esp_random() % blocks) * block;
+        if (lseek(fd, offset, SEEK_SET) != offset) {
+            close(fd);
+            return ESP_FAIL;
+        }
+        ssize_t n = write_pass ? write(fd, buf, block) : read(fd, buf, block);
+        if (n != block) {
+            close(fd);
+            return ESP_FAIL;
+        }
+    }
+    if (write_pass) {
+        fsync(fd);
+    }
+    *us = esp_timer_get_time() - start;
+
+    close(fd);
+    return ESP_OK;
+}
+
+static esp_err_t bench_block(uint8_t *buf, size_t block, size_t len, bench_result_t *res) {
+    esp_err_t err = bench_sequential(buf, block, len, true, &res->seq_write_us);
+    if (err == ESP_OK) {
+        err = bench_sequential(buf, block, len, false, &res->seq_read_us);
+    }
+    if (err == ESP_OK) {
+        err = bench_random(buf, block, len, false, &res->rand_read_us);
+    }
+    if (err == ESP_OK) {
+        err = bench_random(buf, block, len, true, &res->rand_write_us);
+    }
+    return err;
+}
+
+static int sdbench(int argc, char **argv)
+{
+    int nerrors = arg_parse(argc, argv, (void **) &sdbench_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, sdbench_args.end, argv[0]);
+        return 1;
+    }
+
+    int kb = sdbench_args.size->count ? sdbench_args.size->ival[0] : 1024;
+    if (kb <= 0) {
+        printf("File size must be at least 1KB\n");
+        return 1;
+    }
+    size_t len = kb * 1024;
+    int nblocks = sdbench_args.block->count;
+    const int *blocks = nblocks ? sdbench_args.block->ival : default_blocks;
+    if (!nblocks) {
+        nblocks = sizeof(default_blocks) / sizeof(default_blocks[0]);
+    }
+
+    for (int i = 0; i < nblocks; i++) {
+        if (blocks[i] < 512 || blocks[i] > BENCH_MAX_BLOCK || (blocks[i] & 511) || blocks[i] > len) {
+            printf("Block size %d must be a multiple of 512, at most %d and the file size\n",
+                   blocks[i], BENCH_MAX_BLOCK);
+            return 1;
+        }
+    }
+
+    // DMA capable, so the SPI driver can transfer whole sectors without a copy
+    uint8_t *buf = heap_caps_malloc(BENCH_MAX_BLOCK, MALLOC_CAP_DMA);
+    if (!buf) {
+        ESP_LOGE(TAG, "No memory for the %d byte buffer", BENCH_MAX_BLOCK);
+        return 1;
+    }
+    esp_fill_random(buf, BENCH_MAX_BLOCK);
+
+    printf("%u KB file, %d random operations per block size\n", len / 1024, BENCH_RANDOM_OPS);
+    printf("%6s %10s %10s %16s %16s\n", "Block", "Write", "Read", "Random read", "Random write");
+    printf("%6s %10s %10s %16s %16s\n", "bytes", "KB/s", "KB/s", "IOPS (KB/s)", "IOPS (KB/s)");
+
+    int ret = 0;
+    for (int i = 0; i < nblocks; i++) {
+        size_t block = blocks[i];
+        size_t file_len = len - (len % block);
+        bench_result_t res;
+
+        if (bench_block(buf, block, file_len, &res) != ESP_OK) {
+            printf("%6u failed, is the SD card mounted?\n", block);
+            ret = 1;
+            break;
+        }
+
+        uint32_t rr = iops(BENCH_RANDOM_OPS, res.rand_read_us);
+        uint32_t rw = iops(BENCH_RANDOM_OPS, res.rand_write_us);
+        printf("%6u %10u %10u %7u (%6u) %7u (%6u)\n", block,
+               kb_per_s(file_len, res.seq_write_us), kb_per_s(file_len, res.seq_read_us),
+               rr, kb_per_s(BENCH_RANDOM_OPS * block, res.rand_read_us),
+               rw, kb_per_s(BENCH_RANDOM_OPS * block, res.rand_write_us));
+    }
+
+    unlink(BENCH_FILE);
+    free(buf);
+    return ret;
+}
+
+static void register_sdbench(void)
+{
+    sdbench_args.size = arg_int0("s", "size", "<KB>", "Size of the test file, default 1024KB");
+    sdbench_args.block = arg_intn("b", "block", "<bytes>", 0, 8, "Block size to test, default 512, 4096 and 32768");
+    sdbench_args.end = arg_end(2);
+
+    const esp_console_cmd_t cmd = {
+        .command = "sdbench",
+        .help = "Measure SD card sequential and random read and write speed. "
+                "Writes a scratch file to the card",
+        .hint = NULL,
+        .func = &sdbench,
+        .argtable = &sdbench_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
+
+void register_sdcard(void)
+{
+    register_sdbench();
+}
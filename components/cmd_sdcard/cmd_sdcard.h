@@ -0,0 +1,13 @@
+/* Console commands for the SD card */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Register SD card functions: "sdbench"
+void register_sdcard(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3946 @@
+// Generated by logo_to_rle.py, do not edit
+#define IMG_LOGO_W 320
+#define IMG_LOGO_H 170
+const unsigned char img_logo_rle[63042] = {
+0X83,0X08,0X81,0X02,0X08,0XC2,0X09,0X23,0X09,0X02,0X80,0X08,0XE2,0X20,0X09,0X02,
+0X01,0X22,0X09,0X03,0X08,0XA1,0X08,0XC2,0X09,0X23,0X09,0X03,0X09,0X02,0X11,0X83,
+0X11,0XC3,0X09,0XE4,0X13,0X2A,0X13,0X4A,0X12,0XA7,0X0A,0XC9,0X0B,0X4B,0X0A,0XE9,
+0X0A,0XA8,0X0A,0X47,0X0A,0X46,0X09,0XC5,0X09,0X02,0X09,0X83,0X0A,0X46,0X0B,0XEE,
+0X0C,0X70,0X0B,0X6B,0X0A,0X87,0X0B,0X0A,0X0A,0XA9,0X12,0XE9,0X12,0X87,0X09,0XC5,
+0X80,0X08,0XE2,0X02,0X08,0XC2,0X08,0X82,0X08,0X81,0X81,0X00,0X61,0X04,0X08,0XA2,
+0X08,0X81,0X08,0X82,0X00,0X82,0X00,0X61,0X82,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,
+0X81,0X05,0X08,0XC2,0X22,0X83,0X33,0XC5,0X22,0X63,0X09,0X02,0X08,0XE2,0X80,0X09,
+0X02,0X82,0X08,0XE2,0X83,0X08,0XA2,0X03,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X08,0XC2,
+0X81,0X08,0XE2,0X00,0X00,0XA2,0X92,0X00,0X61,0X07,0X08,0X81,0X08,0XC2,0X09,0X02,
+0X11,0X42,0X09,0X42,0X12,0X46,0X0A,0X06,0X08,0XA1,0X8A,0X00,0X61,0X05,0X08,0X61,
+0X08,0X81,0X09,0X02,0X11,0XE4,0X12,0X24,0X09,0X02,0X80,0X08,0X61,0X85,0X00,0X61,
+0X03,0X08,0X82,0X08,0XE2,0X09,0X23,0X09,0X22,0X82,0X09,0X02,0X03,0X08,0XE2,0X09,
+0X23,0X09,0X22,0X08,0XC2,0XD8,0X00,0X61,0X00,0X08,0XA1,0X80,0X12,0X04,0X05,0X09,
+0X63,0X09,0XA3,0X09,0X22,0X09,0X63,0X09,0X62,0X11,0XC3,0X80,0X11,0XE3,0X07,0X1A,
+0X23,0X22,0XE4,0X2C,0X49,0X24,0X29,0X24,0X09,0X23,0XE9,0X23,0XC9,0X23,0XC8,0X80,
+0X2C,0X8A,0X02,0X2B,0X86,0X32,0X84,0X41,0XE4,0X80,0X49,0XC5,0X14,0X29,0X43,0X11,
+0X22,0X11,0X42,0X11,0X82,0X1A,0X44,0X09,0X62,0X01,0X03,0X09,0X43,0X09,0XC4,0X1B,
+0X07,0X23,0XA8,0X23,0X66,0X23,0X45,0X23,0X66,0X23,0XC7,0X2B,0XA6,0X2B,0X65,0X33,
+0XE6,0X34,0X88,0X2C,0X28,0X23,0XE8,0X80,0X24,0X09,0X01,0X2B,0XC6,0X2B,0X65,0X80,
+0X2B,0X23,0X15,0X2B,0X24,0X22,0XC4,0X1A,0X63,0X23,0X05,0X1B,0X47,0X1A,0X64,0X22,
+0XA4,0X2B,0X25,0X23,0X25,0X1A,0XC6,0X12,0X85,0X12,0XE6,0X1B,0X07,0X1A,0XC5,0X1A,
+0XE6,0X1B,0X47,0X12,0X44,0X23,0X27,0X24,0X8B,0X23,0X67,0X1A,0XA5,0X23,0X47,0X83,
+0X08,0X81,0X06,0X08,0XC2,0X09,0X43,0X09,0X22,0X08,0XE2,0X09,0X02,0X08,0XE2,0X09,
+0X02,0X80,0X08,0XE2,0X1F,0X0A,0X68,0X0A,0X06,0X01,0X03,0X08,0XE2,0X09,0X02,0X09,
+0X43,0X09,0X63,0X12,0XC8,0X0B,0X6B,0X0A,0XC9,0X0B,0X6C,0X0B,0XCD,0X0B,0X8C,0X0A,
+0XA9,0X0A,0X67,0X12,0X46,0X09,0X43,0X09,0X22,0X09,0X63,0X12,0X05,0X0A,0XC9,0X0B,
+0X6C,0X14,0X4E,0X0B,0X8B,0X0C,0X0E,0X0B,0XAD,0X0A,0X27,0X09,0X84,0X09,0X02,0X08,
+0XE2,0X08,0XC2,0X08,0X82,0X83,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XA1,0X01,0X00,
+0X81,0X08,0X82,0X80,0X08,0X81,0X00,0X00,0X81,0X80,0X08,0X81,0X05,0X00,0X61,0X08,
+0X61,0X08,0XE2,0X22,0XA3,0X2B,0X23,0X11,0XA2,0X80,0X08,0XE2,0X83,0X09,0X02,0X01,
+0X08,0XC2,0X08,0XA1,0X83,0X08,0XA2,0X80,0X08,0XA1,0X01,0X08,0XC1,0X08,0XC2,0X80,
+0X09,0X02,0X00,0X00,0X82,0X8F,0X00,0X61,0X80,0X08,0X61,0X81,0X00,0X61,0X05,0X08,
+0XA1,0X09,0X02,0X09,0X63,0X09,0XE5,0X0A,0X26,0X08,0XC2,0X8A,0X00,0X61,0X06,0X00,
+0X81,0X00,0X61,0X08,0X81,0X09,0X02,0X11,0XA3,0X11,0X83,0X08,0XC1,0X88,0X00,0X61,
+0X01,0X00,0X82,0X08,0XC2,0X80,0X08,0XE2,0X06,0X09,0X02,0X09,0X43,0X09,0X83,0X09,
+0X22,0X09,0X02,0X09,0X22,0X08,0XC2,0XCB,0X00,0X61,0X00,0X08,0X61,0X86,0X00,0X61,
+0X07,0X08,0X61,0X00,0X61,0X00,0X81,0X11,0XA3,0X1A,0X43,0X09,0X62,0X11,0XA3,0X11,
+0XC3,0X80,0X09,0X42,0X02,0X09,0X62,0X11,0XE3,0X1A,0X84,0X80,0X22,0XE4,0X05,0X23,
+0X46,0X23,0X47,0X23,0X26,0X23,0X66,0X23,0XC8,0X23,0XE9,0X80,0X34,0XAB,0X0B,0X2B,
+0X67,0X3A,0X65,0X41,0XE4,0X49,0XA4,0X41,0XA4,0X21,0X43,0X11,0X42,0X09,0X42,0X09,
+0X62,0X11,0XA3,0X11,0XE3,0X08,0XE2,0X80,0X09,0X02,0X07,0X09,0X43,0X1A,0X85,0X23,
+0X87,0X23,0XA7,0X23,0XC8,0X24,0X09,0X23,0XC8,0X23,0X86,0X80,0X2B,0X86,0X1A,0X2C,
+0X07,0X2C,0X69,0X24,0X08,0X1C,0X2A,0X1C,0X2B,0X23,0XE9,0X2B,0XA6,0X33,0X43,0X33,
+0X84,0X2B,0XE6,0X2B,0XA6,0X23,0X05,0X1B,0X06,0X1B,0X05,0X1A,0XC5,0X1A,0X84,0X22,
+0XA4,0X2B,0X25,0X1A,0X43,0X12,0X24,0X1A,0XC6,0X1B,0X06,0X23,0X47,0X1B,0X47,0X1B,
+0X28,0X1A,0XC6,0X1A,0X85,0X81,0X1A,0XE6,0X00,0X1B,0X68,0X82,0X08,0X81,0X02,0X08,
+0XA2,0X09,0X02,0X09,0X23,0X80,0X08,0XE2,0X80,0X09,0X22,0X07,0X09,0X02,0X08,0XE2,
+0X09,0XC5,0X0A,0X27,0X01,0X44,0X09,0X02,0X08,0XE2,0X08,0XC2,0X80,0X09,0X02,0X17,
+0X09,0XE5,0X0B,0X0A,0X0B,0X2A,0X0B,0X4B,0X0B,0XAD,0X0B,0X8D,0X0B,0X0A,0X0A,0X67,
+0X11,0XE4,0X09,0X02,0X09,0X42,0X09,0X63,0X09,0X42,0X09,0X43,0X09,0XA4,0X09,0XE5,
+0X0A,0X26,0X0A,0XA8,0X0A,0X47,0X09,0X43,0X09,0X23,0X08,0XC2,0X00,0XA2,0X00,0X81,
+0X81,0X00,0X61,0X89,0X08,0X81,0X06,0X00,0X81,0X08,0X81,0X00,0X61,0X08,0X81,0X08,
+0XE2,0X22,0X62,0X1A,0X22,0X80,0X09,0X02,0X80,0X08,0XE2,0X00,0X09,0X02,0X80,0X08,
+0XE2,0X00,0X08,0XC1,0X83,0X08,0XA1,0X01,0X08,0XA2,0X00,0XA1,0X80,0X08,0XA1,0X03,
+0X08,0XC1,0X08,0XE1,0X08,0XE2,0X00,0XA2,0X96,0X00,0X61,0X04,0X08,0XA2,0X09,0X22,
+0X09,0X42,0X09,0XC4,0X08,0XE2,0X8A,0X00,0X61,0X00,0X00,0X81,0X80,0X00,0X61,0X04,
+0X08,0XA2,0X09,0X22,0X09,0X62,0X09,0X02,0X08,0X61,0X89,0X00,0X61,0X0A,0X08,0X61,
+0X08,0X82,0X08,0XA2,0X09,0X02,0X09,0X83,0X09,0X43,0X09,0X02,0X09,0X22,0X09,0X02,
+0X08,0XC2,0X08,0X82,0XD4,0X00,0X61,0X01,0X08,0XC2,0X09,0X42,0X80,0X09,0X22,0X11,
+0X09,0X43,0X09,0X62,0X11,0X83,0X12,0X04,0X12,0X24,0X22,0XC4,0X23,0X65,0X23,0X25,
+0X23,0X65,0X23,0XC8,0X23,0XE9,0X23,0XA7,0X2B,0XE8,0X34,0X6A,0X3C,0XEC,0X44,0XCC,
+0X4B,0XEA,0X4A,0X46,0X81,0X49,0XA4,0X03,0X29,0X63,0X11,0X63,0X11,0X82,0X09,0X42,
+0X80,0X11,0XC3,0X02,0X09,0X02,0X08,0XC2,0X09,0X02,0X80,0X09,0X43,0X0C,0X12,0X04,
+0X23,0X87,0X23,0XE8,0X24,0X09,0X23,0XC7,0X23,0X65,0X2B,0X65,0X23,0XC7,0X2B,0XE7,
+0X2B,0XA6,0X2C,0X07,0X2C,0X28,0X24,0X09,0X80,0X1C,0X2A,0X0F,0X23,0XA7,0X2B,0X23,
+0X33,0X64,0X2B,0XA5,0X2C,0X07,0X2C,0X08,0X23,0XE9,0X23,0X86,0X23,0X67,0X1B,0X06,
+0X1A,0X85,0X1A,0X64,0X22,0XE4,0X1A,0X63,0X12,0X24,0X1A,0XA5,0X80,0X1B,0X27,0X00,
+0X1A,0XE6,0X80,0X1B,0X28,0X03,0X1B,0X27,0X1B,0X47,0X1A,0XE7,0X1A,0XE6,0X81,0X08,
+0X81,0X02,0X08,0XA1,0X08,0XA2,0X09,0X23,0X83,0X09,0X02,0X04,0X08,0XC2,0X09,0XA4,
+0X09,0X84,0X01,0X03,0X09,0X03,0X80,0X08,0XE2,0X10,0X00,0XE2,0X08,0XE2,0X09,0X42,
+0X09,0X83,0X12,0X46,0X12,0X67,0X0A,0XE9,0X0B,0X2B,0X0B,0X0A,0X0A,0XE9,0X12,0X66,
+0X09,0X63,0X08,0XE2,0X09,0X42,0X09,0X22,0X09,0X42,0X09,0XA4,0X81,0X12,0X25,0X04,
+0X09,0XA4,0X09,0X63,0X08,0XE2,0X08,0XA2,0X00,0X82,0X83,0X00,0X61,0X01,0X08,0X81,
+0X00,0X81,0X82,0X08,0X81,0X81,0X08,0XA2,0X84,0X08,0X81,0X04,0X08,0XE2,0X11,0X82,
+0X11,0X22,0X08,0XE2,0X09,0X02,0X81,0X08,0XE2,0X80,0X08,0XC2,0X84,0X08,0XA1,0X80,
+0X08,0XA2,0X81,0X08,0XC2,0X01,0X08,0XA2,0X00,0X81,0X98,0X00,0X61,0X03,0X08,0XA2,
+0X09,0X02,0X09,0X63,0X08,0XE2,0X8D,0X00,0X61,0X04,0X08,0X81,0X08,0XC2,0X09,0X42,
+0X09,0X22,0X08,0X81,0X8C,0X00,0X61,0X03,0X00,0X81,0X08,0XA2,0X08,0XE2,0X09,0X02,
+0X80,0X09,0X43,0X02,0X09,0X02,0X08,0XC2,0X00,0X81,0X80,0X08,0X61,0XD0,0X00,0X61,
+0X00,0X08,0XA2,0X82,0X09,0X42,0X11,0X09,0X22,0X11,0XA3,0X1A,0X44,0X23,0X05,0X23,
+0X46,0X2B,0X86,0X23,0X45,0X23,0X04,0X23,0XA6,0X23,0XE9,0X23,0XC8,0X23,0XA8,0X3C,
+0X6A,0X55,0X4E,0X5D,0X4E,0X54,0XAC,0X53,0X28,0X49,0XC4,0X80,0X49,0X84,0X18,0X41,
+0XA4,0X19,0XA3,0X11,0X83,0X09,0X82,0X09,0X62,0X11,0XA3,0X09,0X83,0X08,0XE2,0X08,
+0XC2,0X09,0X03,0X09,0X23,0X09,0X22,0X11,0XE3,0X23,0X25,0X23,0XA6,0X23,0X86,0X23,
+0X24,0X2A,0XE3,0X2B,0X24,0X2B,0XC7,0X24,0X09,0X23,0XE8,0X2B,0XC6,0X2C,0X49,0X24,
+0X6A,0X80,0X24,0X2A,0X01,0X24,0X09,0X2B,0X45,0X80,0X2B,0X03,0X14,0X2B,0X44,0X2B,
+0XC6,0X2C,0X08,0X23,0XC8,0X23,0XE9,0X23,0XA8,0X1B,0X06,0X1A,0X85,0X1A,0X63,0X22,
+0XE4,0X22,0X63,0X1A,0X64,0X1B,0X07,0X1B,0X48,0X1B,0X27,0X13,0X28,0X1B,0X07,0X1A,
+0XE6,0X1A,0XE5,0X1A,0X84,0X1A,0X44,0X81,0X08,0X81,0X25,0X08,0XA1,0X08,0XA2,0X09,
+0X22,0X08,0XE2,0X09,0XA4,0X09,0XC5,0X09,0X03,0X00,0XE2,0X08,0XE2,0X09,0XA4,0X09,
+0X03,0X09,0X02,0X08,0XC2,0X08,0XE2,0X00,0XE2,0X01,0X03,0X00,0XC2,0X09,0X03,0X09,
+0XA3,0X12,0X25,0X12,0X66,0X0A,0XC8,0X0A,0XC9,0X12,0XC9,0X0A,0X46,0X11,0XC4,0X09,
+0X22,0X08,0XE2,0X11,0X83,0X11,0X62,0X11,0XA3,0X12,0X25,0X12,0X46,0X09,0XC4,0X09,
+0X63,0X08,0XE2,0X08,0XA2,0X08,0X81,0X87,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XA1,
+0X00,0X08,0XA2,0X80,0X08,0X81,0X01,0X08,0XA1,0X08,0XA2,0X81,0X08,0X81,0X06,0X00,
+0X81,0X08,0X81,0X08,0XA1,0X08,0XC2,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X81,0X08,0XC2,
+0X85,0X08,0XA1,0X00,0X08,0XC1,0X80,0X08,0XC2,0X02,0X08,0XE2,0X08,0XC2,0X08,0X81,
+0X9B,0X00,0X61,0X05,0X08,0XA1,0X09,0X02,0X08,0XE2,0X08,0X61,0X00,0X81,0X08,0X61,
+0X8B,0X00,0X61,0X05,0X08,0X81,0X08,0XE2,0X09,0X02,0X08,0X81,0X00,0X81,0X08,0X61,
+0X8D,0X00,0X61,0X01,0X08,0XA1,0X08,0XC2,0X80,0X09,0X22,0X02,0X09,0X02,0X08,0XE2,
+0X08,0XA1,0XD0,0X00,0X61,0X01,0X08,0XC2,0X09,0X22,0X80,0X09,0X42,0X25,0X09,0X63,
+0X09,0X42,0X11,0X62,0X1A,0X43,0X22,0XC4,0X23,0X25,0X23,0XA7,0X24,0X08,0X2B,0XC7,
+0X2B,0XE7,0X24,0X08,0X24,0X29,0X24,0X4A,0X34,0X8B,0X5D,0X6F,0X6D,0XB0,0X5D,0X0E,
+0X43,0XC9,0X42,0X05,0X41,0X43,0X39,0X43,0X39,0X63,0X3A,0X66,0X22,0X85,0X11,0XA2,
+0X11,0XA3,0X12,0X03,0X11,0XA3,0X09,0X43,0X01,0X02,0X09,0X02,0X08,0XE2,0X00,0XC2,
+0X08,0XE2,0X11,0XA3,0X23,0X26,0X23,0XA6,0X2B,0X86,0X80,0X2A,0XE3,0X0C,0X2B,0X65,
+0X23,0XE8,0X24,0X2A,0X24,0X09,0X23,0XE8,0X2C,0X08,0X2C,0X8A,0X24,0X4B,0X1C,0X0A,
+0X1C,0X2B,0X23,0XE9,0X2B,0X86,0X2B,0X45,0X80,0X2B,0X24,0X09,0X2B,0XA5,0X2B,0XC6,
+0X24,0X08,0X24,0X29,0X23,0X67,0X1B,0X26,0X1A,0XA5,0X22,0XA3,0X2B,0X44,0X23,0X05,
+0X80,0X1B,0X07,0X02,0X13,0X07,0X12,0XC6,0X1A,0XC6,0X80,0X1A,0XC5,0X01,0X1A,0XE6,
+0X1B,0X07,0X81,0X08,0X81,0X0A,0X08,0XA1,0X08,0XC2,0X00,0XE2,0X08,0XC2,0X09,0X43,
+0X09,0X84,0X01,0X03,0X08,0XC2,0X08,0XA2,0X09,0X03,0X01,0X03,0X80,0X08,0XE2,0X06,
+0X08,0XC2,0X01,0X03,0X08,0XE3,0X09,0X02,0X09,0X22,0X09,0XA3,0X12,0X24,0X80,0X12,
+0XE8,0X03,0X12,0X87,0X0B,0X09,0X09,0XE4,0X09,0X43,0X80,0X09,0X02,0X00,0X09,0X62,
+0X80,0X11,0XA3,0X06,0X09,0X23,0X08,0XE2,0X08,0XA1,0X08,0X81,0X00,0X61,0X00,0X81,
+0X08,0X61,0X87,0X00,0X61,0X80,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0X81,0X81,0X08,
+0XA2,0X83,0X08,0X81,0X81,0X08,0XA1,0X80,0X08,0XC2,0X01,0X08,0XA2,0X08,0XC2,0X84,
+0X08,0XA1,0X81,0X08,0XC2,0X02,0X08,0XE2,0X08,0XC2,0X00,0X81,0X99,0X00,0X61,0X00,
+0X08,0X61,0X82,0X00,0X61,0X80,0X00,0XA2,0X00,0X08,0X61,0X8D,0X00,0X61,0X02,0X00,
+0X81,0X08,0XA1,0X08,0XC2,0X80,0X08,0X81,0X90,0X00,0X61,0X01,0X08,0X81,0X08,0XC2,
+0X81,0X08,0XE2,0X01,0X08,0XC2,0X08,0X61,0XCD,0X00,0X61,0X01,0X08,0XC2,0X09,0X22,
+0X80,0X09,0X42,0X30,0X11,0XE4,0X11,0XE3,0X12,0X03,0X1A,0X63,0X23,0X05,0X23,0XA7,
+0X23,0XE8,0X2C,0X69,0X24,0X6A,0X24,0X49,0X2C,0X6A,0X24,0X6A,0X2C,0XAA,0X3D,0X0D,
+0X55,0X6F,0X65,0XB0,0X4D,0X0D,0X2B,0X67,0X22,0X64,0X39,0X63,0X31,0X23,0X29,0X23,
+0X21,0X84,0X32,0XE6,0X3C,0X4A,0X2B,0XC8,0X23,0X06,0X22,0XE5,0X1A,0X84,0X12,0X24,
+0X11,0XC3,0X11,0X62,0X11,0X22,0X09,0X22,0X09,0X23,0X11,0XA3,0X1B,0X26,0X23,0XC7,
+0X2B,0X85,0X22,0XE3,0X2A,0XE3,0X2B,0XA7,0X24,0X2A,0X24,0X4A,0X24,0X2A,0X24,0X09,
+0X23,0XC7,0X2C,0X08,0X24,0X8B,0X80,0X1C,0X8C,0X10,0X1C,0X2B,0X1C,0X2A,0X24,0X0A,
+0X24,0X09,0X24,0X08,0X23,0XE8,0X24,0X08,0X23,0XE7,0X23,0XC7,0X23,0XA7,0X23,0X87,
+0X1A,0XC5,0X22,0XC4,0X22,0XE4,0X23,0X05,0X1A,0XA5,0X12,0X65,0X80,0X12,0XC6,0X00,
+0X1B,0X07,0X80,0X1B,0X28,0X24,0X13,0X08,0X13,0X07,0X00,0XA1,0X08,0XA1,0X08,0X81,
+0X08,0XA1,0X08,0XA2,0X08,0XC2,0X08,0XC1,0X09,0X02,0X09,0X22,0X01,0X43,0X09,0X02,
+0X09,0X22,0X08,0XE2,0X08,0XC2,0X09,0X02,0X09,0X23,0X01,0X02,0X08,0XE2,0X00,0XE2,
+0X09,0X02,0X09,0X23,0X09,0X42,0X09,0XA3,0X12,0XA7,0X12,0XC8,0X0B,0X6B,0X13,0X09,
+0X09,0X63,0X09,0X02,0X08,0XE2,0X09,0X02,0X09,0X42,0X09,0X02,0X08,0X81,0X00,0X61,
+0X80,0X08,0X61,0X8C,0X00,0X61,0X01,0X08,0X82,0X08,0XA2,0X81,0X08,0X81,0X80,0X08,
+0XA1,0X82,0X08,0X81,0X07,0X08,0XA1,0X00,0X82,0X08,0X81,0X08,0XA1,0X08,0XA2,0X08,
+0XA1,0X08,0XC1,0X08,0XC2,0X83,0X08,0XA1,0X80,0X08,0XC2,0X02,0X08,0XC1,0X08,0XC2,
+0X08,0XA1,0X9C,0X00,0X61,0X80,0X08,0X61,0X80,0X00,0X61,0X80,0X08,0X61,0X8C,0X00,
+0X61,0X00,0X08,0X61,0X81,0X00,0X61,0X02,0X08,0X81,0X08,0X61,0X08,0X81,0X8F,0X00,
+0X61,0X80,0X08,0X61,0X02,0X00,0X61,0X08,0X81,0X08,0XC2,0X80,0X08,0XE2,0X01,0X08,
+0XC2,0X00,0X81,0XB1,0X00,0X61,0X00,0X08,0X61,0X94,0X00,0X61,0X00,0X08,0X61,0X80,
+0X00,0X61,0X0E,0X08,0X81,0X09,0X22,0X09,0X62,0X08,0XE2,0X09,0X02,0X11,0XA2,0X1A,
+0X43,0X22,0XA3,0X23,0X65,0X24,0X09,0X1C,0X8C,0X24,0XAB,0X24,0X6A,0X24,0X49,0X2C,
+0XAA,0X80,0X24,0X49,0X1E,0X44,0XEC,0X55,0X8F,0X55,0X4E,0X3C,0XAA,0X24,0X29,0X23,
+0X87,0X2A,0X24,0X29,0X22,0X29,0X03,0X19,0X43,0X09,0X83,0X19,0XE3,0X2B,0XA7,0X34,
+0XEA,0X34,0XEB,0X2C,0X69,0X2C,0X48,0X2C,0X28,0X2B,0XE7,0X2B,0XC6,0X2B,0XA6,0X23,
+0X26,0X1A,0X85,0X1A,0XA5,0X23,0X26,0X23,0XA7,0X2B,0X44,0X22,0XE3,0X2B,0X45,0X23,
+0XC8,0X24,0X09,0X80,0X24,0X2A,0X12,0X24,0X29,0X23,0XE9,0X23,0XC8,0X2C,0X6A,0X2C,
+0XED,0X1C,0X8D,0X1C,0X2B,0X1C,0X4C,0X1C,0X2B,0X1C,0X4C,0X1C,0X4B,0X24,0X4A,0X24,
+0X2A,0X24,0X4B,0X1C,0X6B,0X24,0X2A,0X24,0X09,0X23,0XE8,0X22,0XE4,0X80,0X1A,0X43,
+0X0D,0X22,0XC4,0X12,0X44,0X12,0X85,0X1A,0XE6,0X12,0XE6,0X13,0X08,0X1A,0XE7,0X1A,
+0XE6,0X12,0XC7,0X09,0X23,0X08,0XE2,0X08,0XA1,0X08,0XA2,0X08,0XC2,0X80,0X08,0XE2,
+0X80,0X09,0X02,0X00,0X09,0X22,0X80,0X09,0X02,0X82,0X08,0XE2,0X0B,0X01,0X22,0X08,
+0XE2,0X08,0XE3,0X08,0XE2,0X09,0X23,0X09,0X63,0X11,0XC3,0X12,0X86,0X0B,0X8C,0X13,
+0XAC,0X12,0X25,0X09,0X22,0X81,0X08,0XE2,0X00,0X08,0XC2,0X92,0X00,0X61,0X01,0X08,
+0XA2,0X00,0X81,0X85,0X08,0X81,0X00,0X00,0X81,0X81,0X08,0X81,0X01,0X08,0X82,0X08,
+0XC2,0X85,0X08,0XA1,0X00,0X08,0XC2,0X80,0X08,0XC1,0X03,0X08,0XC2,0X00,0XA1,0X00,
+0X61,0X08,0X61,0XB4,0X00,0X61,0X00,0X08,0X61,0X81,0X00,0X61,0X02,0X00,0X82,0X00,
+0X81,0X08,0X81,0X82,0X00,0X81,0X01,0X08,0X81,0X00,0X81,0X89,0X00,0X61,0X03,0X08,
+0X81,0X08,0XA2,0X08,0XA1,0X08,0X81,0X86,0X00,0X61,0X00,0X08,0X61,0X88,0X00,0X61,
+0X00,0X08,0X61,0X84,0X00,0X61,0X00,0X08,0X61,0X80,0X00,0X61,0X00,0X08,0X61,0X82,
+0X00,0X61,0X01,0X08,0X61,0X00,0X61,0X80,0X08,0X61,0X83,0X00,0X61,0X00,0X08,0X61,
+0X80,0X00,0X61,0X00,0X08,0X61,0X9C,0X00,0X61,0X0C,0X08,0XA2,0X09,0X02,0X09,0X42,
+0X11,0XC2,0X1A,0X43,0X22,0XE4,0X2B,0X65,0X2C,0X08,0X2C,0X49,0X24,0X8B,0X24,0X8C,
+0X24,0X8B,0X24,0X6A,0X80,0X24,0X08,0X0B,0X2C,0X49,0X3C,0XEC,0X4D,0X4E,0X45,0X2C,
+0X34,0X68,0X34,0X27,0X2C,0X08,0X33,0X68,0X31,0XA4,0X39,0X84,0X29,0X84,0X11,0X83,
+0X80,0X11,0X62,0X14,0X22,0XC3,0X34,0X27,0X3C,0XEA,0X45,0X2B,0X34,0XCA,0X2C,0X48,
+0X2C,0X28,0X2C,0X68,0X34,0XC9,0X34,0X27,0X2B,0XC6,0X2C,0X08,0X2C,0X28,0X2C,0X07,
+0X2B,0X85,0X2B,0X65,0X2B,0X86,0X23,0XE8,0X24,0X29,0X23,0XE9,0X24,0X2A,0X80,0X24,
+0X09,0X80,0X23,0XE8,0X03,0X24,0XAC,0X24,0XAD,0X1C,0XAD,0X1C,0X6C,0X80,0X1C,0X2B,
+0X15,0X1C,0X0A,0X24,0X2A,0X23,0XE9,0X1C,0X4B,0X1C,0XEF,0X1D,0X30,0X1C,0XEF,0X24,
+0X6A,0X2B,0XE7,0X23,0X46,0X11,0XE3,0X1A,0X23,0X22,0XE5,0X1A,0XA5,0X12,0X85,0X1A,
+0XC6,0X12,0X85,0X1A,0XA6,0X12,0XE7,0X12,0XE8,0X09,0X63,0X09,0X83,0X80,0X09,0X43,
+0X83,0X08,0XE2,0X00,0X09,0X02,0X80,0X08,0XE2,0X80,0X08,0XC2,0X00,0X00,0XE2,0X80,
+0X08,0XE2,0X09,0X01,0X03,0X09,0X02,0X09,0X03,0X08,0XE2,0X09,0X43,0X12,0X04,0X12,
+0X87,0X13,0XAC,0X0A,0X87,0X09,0X42,0X81,0X09,0X02,0X00,0X08,0XC2,0X93,0X00,0X61,
+0X03,0X08,0X82,0X08,0XA2,0X08,0XA1,0X08,0X81,0X80,0X08,0XA1,0X80,0X08,0XA2,0X82,
+0X08,0XA1,0X01,0X08,0X81,0X08,0XA2,0X83,0X08,0XA1,0X02,0X08,0XC1,0X08,0XA1,0X08,
+0XA2,0X80,0X08,0XC2,0X01,0X08,0XA2,0X00,0X81,0XBB,0X00,0X61,0X01,0X08,0X81,0X08,
+0XC1,0X80,0X09,0X02,0X05,0X09,0X22,0X09,0X02,0X09,0X22,0X09,0X02,0X08,0XE2,0X08,
+0XC2,0X80,0X00,0X81,0X9E,0X00,0X61,0X00,0X08,0X61,0X81,0X00,0X61,0X80,0X08,0X61,
+0X80,0X00,0X61,0X00,0X08,0X61,0X87,0X00,0X61,0X80,0X08,0X61,0XA2,0X00,0X61,0X09,
+0X08,0XA2,0X09,0X02,0X09,0X62,0X12,0X03,0X22,0XC4,0X2B,0X85,0X2B,0XE7,0X2C,0X69,
+0X24,0X8A,0X24,0X6A,0X80,0X24,0X6B,0X1C,0X24,0X4A,0X24,0X6A,0X24,0X2A,0X2C,0X8B,
+0X3D,0X0D,0X45,0X2D,0X3C,0XCA,0X34,0X47,0X3C,0X25,0X3B,0XE6,0X4B,0X88,0X3A,0X26,
+0X29,0X23,0X42,0X66,0X33,0X06,0X22,0XC5,0X1A,0X84,0X22,0XC4,0X2B,0X85,0X3C,0X25,
+0X3C,0X26,0X44,0XC9,0X3D,0X2B,0X34,0XCA,0X2C,0X48,0X2C,0X07,0X34,0X07,0X33,0XC5,
+0X2B,0XE7,0X81,0X2C,0X48,0X0C,0X2C,0X49,0X2C,0X8A,0X2C,0X6A,0X24,0X6A,0X24,0X4B,
+0X1C,0X4A,0X1C,0X2A,0X1C,0X0A,0X24,0X09,0X23,0XE8,0X23,0XA6,0X2B,0XE8,0X24,0X8B,
+0X80,0X1C,0X8D,0X12,0X1C,0X6C,0X1C,0X4B,0X1C,0X2B,0X1C,0X0A,0X23,0XE9,0X1C,0X0A,
+0X1C,0X8E,0X1C,0XCE,0X1C,0X8D,0X1C,0X2A,0X23,0XE8,0X2B,0XC7,0X22,0XC5,0X1A,0X23,
+0X1A,0X84,0X23,0X05,0X1A,0XC6,0X1A,0XE6,0X12,0X66,0X81,0X13,0X08,0X04,0X09,0X63,
+0X11,0XE4,0X09,0X63,0X09,0X83,0X09,0X42,0X80,0X08,0XE2,0X00,0X09,0X23,0X80,0X08,
+0XE2,0X82,0X08,0XC2,0X0C,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X00,0XE2,0X08,0XC2,0X09,
+0X23,0X08,0XC2,0X09,0X02,0X09,0XA3,0X12,0X25,0X12,0X65,0X09,0X83,0X09,0X42,0X81,
+0X09,0X02,0X01,0X00,0XC2,0X08,0X61,0X93,0X00,0X61,0X01,0X08,0XA2,0X08,0XC2,0X80,
+0X08,0XA2,0X00,0X08,0XC1,0X80,0X08,0XC2,0X81,0X08,0XA1,0X80,0X08,0X81,0X80,0X08,
+0XA2,0X84,0X08,0XA1,0X80,0X08,0XC2,0X00,0X08,0X82,0XB7,0X00,0X61,0X80,0X08,0X61,
+0X80,0X00,0X61,0X0E,0X00,0X81,0X08,0XC2,0X09,0X02,0X09,0X22,0X11,0XA3,0X11,0X82,
+0X09,0X42,0X09,0X22,0X09,0X02,0X09,0X22,0X09,0X42,0X09,0X02,0X08,0XE2,0X08,0XA2,
+0X00,0X81,0X82,0X08,0X82,0X01,0X00,0X82,0X08,0XA2,0X80,0X00,0X82,0X02,0X00,0X61,
+0X00,0X81,0X00,0X62,0X87,0X00,0X61,0X83,0X08,0X61,0X01,0X00,0X61,0X08,0X61,0X80,
+0X00,0X61,0X00,0X08,0X61,0X87,0X00,0X61,0X08,0X08,0X61,0X00,0X81,0X08,0X81,0X08,
+0X82,0X08,0XA2,0X08,0XA1,0X08,0XE2,0X09,0X02,0X09,0X23,0X80,0X09,0X02,0X05,0X09,
+0X03,0X08,0XE2,0X08,0XA1,0X08,0X81,0X00,0X61,0X00,0X41,0X9D,0X00,0X61,0X07,0X08,
+0XC2,0X11,0X42,0X1A,0X43,0X23,0X46,0X24,0X08,0X24,0X6A,0X24,0X4A,0X24,0X6A,0X80,
+0X24,0X4A,0X04,0X24,0X8B,0X24,0XAC,0X24,0X6B,0X24,0X6A,0X2C,0XAB,0X80,0X45,0X4E,
+0X15,0X34,0XEB,0X34,0X88,0X3C,0X26,0X3C,0X05,0X4C,0X08,0X63,0X89,0X4A,0X26,0X31,
+0X43,0X3A,0X86,0X3C,0X89,0X34,0X89,0X2C,0X28,0X34,0X47,0X34,0X67,0X34,0X87,0X3C,
+0X66,0X3C,0X87,0X3C,0XE9,0X3D,0X0A,0X34,0XCA,0X2C,0X48,0X2C,0X07,0X80,0X2B,0XC6,
+0X80,0X2B,0XE7,0X07,0X2C,0X28,0X2C,0X68,0X2C,0X69,0X2C,0X8A,0X24,0XAB,0X24,0X8B,
+0X1C,0X6B,0X24,0X4B,0X80,0X24,0X2A,0X04,0X23,0XE9,0X23,0XA7,0X23,0X66,0X24,0X29,
+0X1C,0X8C,0X80,0X1C,0X4C,0X00,0X1C,0X4B,0X81,0X1C,0X2B,0X02,0X1C,0X4C,0X1C,0X6D,
+0X1C,0X0B,0X81,0X23,0XC8,0X80,0X23,0X87,0X12,0X1A,0XC5,0X11,0XE3,0X1A,0XC5,0X1B,
+0X26,0X1A,0XE7,0X1A,0XC7,0X13,0X08,0X12,0XE7,0X12,0XC6,0X09,0X62,0X09,0X83,0X09,
+0X63,0X09,0X43,0X09,0X02,0X08,0XE2,0X08,0XC2,0X09,0X23,0X09,0X02,0X00,0XE2,0X80,
+0X08,0XA2,0X00,0X08,0XC2,0X81,0X08,0XE2,0X03,0X09,0X23,0X08,0XE2,0X08,0XC2,0X09,
+0X63,0X80,0X08,0XA2,0X04,0X09,0X23,0X09,0X63,0X09,0X62,0X09,0X42,0X09,0X43,0X80,
+0X09,0X22,0X01,0X09,0X02,0X00,0XA2,0X94,0X00,0X61,0X00,0X00,0X81,0X81,0X08,0XC2,
+0X80,0X08,0XC1,0X01,0X08,0XC2,0X08,0XA1,0X82,0X08,0X81,0X00,0X08,0XA2,0X84,0X08,
+0XA1,0X02,0X08,0XC2,0X08,0XA2,0X00,0X81,0XBA,0X00,0X61,0X02,0X08,0X61,0X08,0XE2,
+0X09,0X43,0X80,0X12,0X04,0X02,0X11,0X83,0X12,0X04,0X11,0XE3,0X81,0X09,0X22,0X01,
+0X09,0X42,0X09,0X22,0X80,0X09,0X02,0X80,0X08,0XC2,0X03,0X08,0X81,0X00,0X81,0X08,
+0X81,0X08,0XA1,0X81,0X08,0XA2,0X00,0X08,0X82,0X83,0X08,0X81,0X00,0X00,0X81,0X82,
+0X08,0X81,0X80,0X08,0X61,0X00,0X08,0X81,0X81,0X00,0X61,0X00,0X08,0X61,0X83,0X00,
+0X61,0X80,0X08,0X61,0X01,0X00,0X61,0X08,0X61,0X80,0X08,0X81,0X16,0X10,0XA1,0X18,
+0XC2,0X19,0X02,0X21,0XA4,0X22,0X65,0X2A,0XC6,0X22,0XA7,0X22,0XA6,0X1A,0XC6,0X1B,
+0X68,0X23,0X47,0X23,0X88,0X23,0XA9,0X1B,0XA9,0X2C,0X0B,0X2B,0XEB,0X1B,0X69,0X1A,
+0XC7,0X11,0XC4,0X11,0XA4,0X11,0X43,0X08,0XA2,0X08,0X61,0X80,0X00,0X61,0X00,0X08,
+0X61,0X95,0X00,0X61,0X21,0X08,0X61,0X00,0X82,0X09,0X22,0X1A,0X63,0X2B,0XC7,0X2C,
+0X69,0X24,0XAC,0X24,0XCD,0X1C,0XCD,0X1C,0XAC,0X24,0XAC,0X24,0X6B,0X1C,0X8B,0X1C,
+0X8C,0X24,0X6B,0X2C,0XAC,0X3D,0X0D,0X4D,0X4E,0X44,0XEC,0X34,0X89,0X34,0X48,0X34,
+0X06,0X44,0X07,0X54,0X0A,0X5B,0X48,0X52,0X66,0X31,0XA4,0X2A,0XC6,0X34,0XCA,0X34,
+0XEA,0X34,0XC9,0X34,0X88,0X34,0X47,0X3C,0X87,0X80,0X3C,0XA7,0X07,0X3C,0XC8,0X3C,
+0XC9,0X3C,0XE9,0X34,0X88,0X2C,0X27,0X2C,0X07,0X2B,0XA6,0X2B,0XC6,0X80,0X2B,0XE7,
+0X06,0X2C,0X07,0X2C,0X06,0X2C,0X28,0X2C,0XAA,0X24,0XCC,0X24,0XAC,0X1C,0X6B,0X81,
+0X24,0X2A,0X06,0X24,0X09,0X23,0XC8,0X23,0XA8,0X24,0X4B,0X1C,0XAD,0X1C,0X6C,0X1C,
+0X4B,0X80,0X1C,0X0A,0X00,0X1C,0X2B,0X80,0X1C,0X8D,0X01,0X1B,0XEA,0X23,0XA7,0X82,
+0X23,0XC8,0X0D,0X23,0X47,0X1A,0X85,0X12,0X03,0X1A,0XE5,0X1A,0XC6,0X1A,0X86,0X12,
+0X65,0X12,0X24,0X11,0XE3,0X09,0X63,0X09,0X23,0X09,0X22,0X09,0X43,0X09,0X03,0X80,
+0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,0XA2,0X01,0X08,
+0XC2,0X08,0XE2,0X82,0X08,0XC2,0X0C,0X09,0X43,0X08,0X82,0X08,0XA2,0X08,0XE2,0X09,
+0X22,0X09,0X02,0X09,0X22,0X09,0X43,0X09,0X63,0X09,0X22,0X08,0XC2,0X08,0XA2,0X08,
+0X82,0X94,0X00,0X61,0X00,0X08,0XA1,0X81,0X08,0XC2,0X80,0X08,0XC1,0X01,0X08,0XA1,
+0X08,0XA2,0X81,0X08,0X81,0X80,0X08,0XA1,0X00,0X08,0XC1,0X80,0X08,0XA1,0X04,0X08,
+0XC1,0X08,0XC2,0X08,0XA2,0X00,0X81,0X08,0X61,0XB8,0X00,0X61,0X09,0X08,0X81,0X09,
+0X02,0X09,0X43,0X09,0X42,0X11,0X83,0X11,0XE3,0X1A,0X44,0X12,0X24,0X11,0XA3,0X09,
+0X83,0X80,0X09,0X42,0X0B,0X09,0X63,0X11,0X83,0X09,0X42,0X08,0XE2,0X09,0X02,0X09,
+0X22,0X09,0X02,0X08,0XC2,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X10,0XA2,0X80,0X08,0XA2,
+0X03,0X08,0XC2,0X08,0XA2,0X10,0XC2,0X18,0XC2,0X80,0X10,0XC2,0X81,0X18,0XE2,0X03,
+0X20,0XE2,0X18,0XE2,0X20,0XE2,0X18,0XE3,0X83,0X20,0XE2,0X00,0X18,0XC2,0X80,0X18,
+0XA2,0X81,0X18,0XC2,0X10,0X18,0XE3,0X19,0X43,0X19,0XA4,0X21,0XA4,0X29,0XE4,0X31,
+0X63,0X31,0X83,0X42,0X04,0X42,0XA6,0X43,0X87,0X4C,0X0A,0X54,0X2B,0X5D,0X0E,0X55,
+0X4E,0X3D,0X0D,0X3C,0XCB,0X24,0X29,0X80,0X24,0X4A,0X02,0X2D,0X0E,0X3D,0X91,0X24,
+0XAD,0X81,0X24,0X8C,0X04,0X24,0X6C,0X1B,0X07,0X11,0X42,0X08,0XA1,0X00,0X41,0X96,
+0X00,0X61,0X0A,0X00,0X81,0X09,0X22,0X1A,0X64,0X2B,0XE7,0X2C,0XAA,0X2C,0XCB,0X24,
+0XCC,0X24,0XED,0X1C,0XCE,0X1C,0XEE,0X24,0XEE,0X80,0X24,0X8C,0X13,0X24,0XAC,0X24,
+0XCC,0X3D,0X2E,0X45,0X2C,0X3C,0XCB,0X34,0XAA,0X34,0X89,0X3C,0X48,0X44,0X28,0X5C,
+0XAA,0X64,0XAC,0X64,0X6B,0X53,0XE8,0X2A,0X64,0X22,0XA4,0X34,0XC9,0X35,0X0A,0X3C,
+0XE9,0X3C,0XC8,0X34,0X67,0X80,0X3C,0X46,0X13,0X3C,0X45,0X44,0X65,0X44,0X86,0X44,
+0XA6,0X3C,0XA7,0X34,0XA9,0X34,0X68,0X2B,0XE7,0X2C,0X28,0X2C,0X48,0X2C,0X28,0X2B,
+0XC6,0X2B,0XE6,0X2C,0X28,0X2C,0X8A,0X24,0XED,0X2D,0X2F,0X24,0XEE,0X24,0X8C,0X24,
+0X4A,0X80,0X24,0X2A,0X1F,0X24,0X09,0X1B,0XA8,0X23,0XE9,0X24,0XAC,0X1C,0X8D,0X1C,
+0X4B,0X1C,0X0B,0X1B,0XC9,0X1C,0X09,0X1C,0X4B,0X1C,0X8E,0X1C,0X6C,0X1B,0XE9,0X23,
+0XC8,0X23,0XA8,0X23,0XC8,0X23,0XA8,0X1B,0X47,0X1B,0X06,0X1A,0X64,0X12,0X23,0X1A,
+0XC5,0X1A,0X64,0X12,0X45,0X12,0X24,0X11,0XC3,0X08,0XC1,0X09,0X02,0X09,0X22,0X11,
+0XA4,0X12,0X66,0X08,0XE2,0X80,0X08,0XC1,0X00,0X08,0XC2,0X80,0X08,0XE2,0X82,0X08,
+0XA2,0X00,0X00,0XC2,0X80,0X08,0XC2,0X0E,0X08,0XE2,0X09,0X02,0X08,0X82,0X00,0XA2,
+0X08,0XC2,0X09,0X02,0X08,0XE2,0X09,0X22,0X12,0X05,0X12,0XC7,0X09,0X44,0X08,0XA2,
+0X08,0X82,0X00,0X82,0X08,0X62,0X80,0X00,0X81,0X92,0X00,0X61,0X00,0X00,0XA2,0X82,
+0X08,0XC2,0X00,0X08,0XC1,0X80,0X08,0XA1,0X04,0X00,0XA1,0X08,0X81,0X08,0XA2,0X08,
+0XA1,0X08,0XC1,0X80,0X08,0XA1,0X80,0X08,0XC2,0X00,0X08,0X61,0XB8,0X00,0X61,0X80,
+0X00,0X81,0X0B,0X08,0XC2,0X09,0X82,0X12,0X24,0X11,0XA3,0X09,0X42,0X11,0X83,0X11,
+0XC4,0X11,0XA4,0X09,0X42,0X11,0X83,0X09,0X43,0X09,0X22,0X80,0X09,0X63,0X03,0X09,
+0X22,0X08,0XE2,0X11,0X42,0X11,0X83,0X80,0X09,0X02,0X07,0X09,0X42,0X09,0X22,0X11,
+0X22,0X10,0XE2,0X18,0XE2,0X19,0X03,0X21,0X03,0X20,0XE2,0X80,0X18,0XE2,0X00,0X18,
+0XC2,0X80,0X18,0XA2,0X81,0X18,0XC2,0X00,0X18,0XE2,0X81,0X18,0XC2,0X80,0X18,0XE2,
+0X80,0X21,0X02,0X25,0X20,0XE2,0X29,0X03,0X29,0X23,0X21,0X03,0X18,0XA2,0X10,0XA2,
+0X10,0X82,0X08,0X82,0X08,0XA1,0X19,0XE4,0X54,0X09,0X4B,0XE8,0X3C,0X48,0X4D,0X2A,
+0X45,0X0A,0X44,0X89,0X54,0XAA,0X53,0XC9,0X5B,0X08,0X54,0XAB,0X55,0X4D,0X65,0XB0,
+0X5D,0X8F,0X45,0X2E,0X35,0X0E,0X25,0X0F,0X1D,0X10,0X1C,0XCE,0X1C,0XAD,0X24,0XEE,
+0X24,0XCD,0X24,0XEE,0X2D,0X2F,0X24,0XCE,0X23,0XE9,0X12,0X04,0X08,0XC2,0X08,0X61,
+0X93,0X00,0X61,0X04,0X08,0XA1,0X11,0X83,0X23,0X06,0X24,0X09,0X2C,0XAB,0X80,0X24,
+0XAB,0X04,0X24,0XAC,0X1C,0XAD,0X1C,0X8C,0X24,0X8C,0X1C,0X8C,0X80,0X24,0X8B,0X01,
+0X24,0XCC,0X35,0X0D,0X80,0X45,0X0C,0X19,0X44,0XCB,0X44,0XAA,0X44,0XA9,0X54,0XCB,
+0X55,0X4C,0X5D,0X2C,0X65,0X0B,0X65,0X2B,0X54,0XC8,0X2B,0X25,0X22,0X63,0X34,0X46,
+0X44,0XC7,0X44,0XC8,0X44,0XE9,0X3C,0XC9,0X3C,0X47,0X3C,0X26,0X3C,0X04,0X44,0X43,
+0X44,0X44,0X44,0X65,0X34,0XE9,0X3D,0X6C,0X34,0XE9,0X34,0X88,0X80,0X2C,0X69,0X13,
+0X2C,0X07,0X2B,0XA5,0X2C,0X69,0X2C,0XCC,0X2C,0XAB,0X24,0XCC,0X2D,0X4F,0X45,0X91,
+0X2D,0X2E,0X24,0XCC,0X24,0X6A,0X24,0X2A,0X24,0X09,0X23,0XE9,0X23,0XA8,0X24,0X09,
+0X1C,0X8D,0X1C,0X4B,0X1C,0X0A,0X1C,0X2B,0X80,0X1C,0X0A,0X0D,0X1C,0X2B,0X1C,0X8D,
+0X1C,0X6D,0X1B,0XE9,0X1B,0XA8,0X1B,0X47,0X1A,0XE5,0X1A,0XC5,0X12,0X64,0X1A,0XC5,
+0X1A,0X44,0X1A,0X84,0X1A,0XC5,0X12,0X45,0X80,0X12,0X04,0X06,0X09,0X02,0X08,0XE2,
+0X09,0X62,0X11,0X83,0X11,0XE5,0X11,0XE4,0X08,0XC2,0X80,0X08,0XA2,0X80,0X08,0XE2,
+0X81,0X08,0XA2,0X81,0X08,0XC2,0X0D,0X00,0XA2,0X08,0XC2,0X00,0XE2,0X08,0XA1,0X08,
+0XA2,0X00,0XA2,0X08,0XC2,0X09,0X02,0X09,0X63,0X0B,0X09,0X0A,0X26,0X08,0XC2,0X00,
+0XA2,0X00,0X82,0X80,0X00,0XA2,0X02,0X00,0X82,0X00,0X61,0X08,0X61,0X91,0X00,0X61,
+0X01,0X08,0X82,0X08,0XC2,0X81,0X08,0XE2,0X00,0X08,0XA1,0X80,0X08,0XA2,0X82,0X08,
+0XA1,0X05,0X08,0XC1,0X08,0XA2,0X08,0XC1,0X08,0XC2,0X08,0X81,0X08,0X61,0XB8,0X00,
+0X61,0X08,0X08,0X81,0X08,0XE2,0X09,0X22,0X09,0X62,0X11,0XA3,0X11,0XC3,0X09,0X63,
+0X09,0X62,0X09,0X83,0X80,0X09,0X63,0X01,0X11,0X83,0X09,0X62,0X80,0X09,0X22,0X80,
+0X09,0X43,0X05,0X09,0X02,0X11,0XA2,0X11,0X62,0X09,0X42,0X09,0X22,0X09,0X42,0X80,
+0X09,0X22,0X04,0X09,0X23,0X08,0XA2,0X08,0X61,0X08,0X81,0X08,0X61,0X81,0X08,0X82,
+0X06,0X00,0X81,0X08,0X81,0X08,0X61,0X08,0X81,0X00,0X81,0X08,0X81,0X08,0X61,0X84,
+0X08,0X81,0X02,0X10,0X82,0X10,0XA2,0X11,0X02,0X80,0X19,0X63,0X17,0X11,0X63,0X11,
+0XC4,0X22,0XE6,0X2B,0XE9,0X44,0XEB,0X55,0X4A,0X55,0X2A,0X55,0X8C,0X3D,0X2B,0X3C,
+0XEA,0X44,0XC9,0X55,0X4B,0X4C,0X49,0X52,0XE7,0X54,0X48,0X44,0X68,0X44,0X8A,0X55,
+0X4E,0X6D,0XB0,0X5D,0X8F,0X2C,0XED,0X24,0XAC,0X24,0XAB,0X2C,0X8A,0X80,0X24,0X29,
+0X09,0X2B,0XC7,0X24,0X6A,0X24,0XAB,0X2C,0X48,0X34,0X28,0X34,0X68,0X23,0X67,0X11,
+0X02,0X08,0XA1,0X08,0X81,0X82,0X00,0X61,0X00,0X08,0X61,0X89,0X00,0X61,0X07,0X00,
+0X81,0X08,0X82,0X11,0XA3,0X23,0X87,0X24,0X28,0X24,0X4A,0X1C,0XAC,0X24,0XED,0X80,
+0X1C,0XCD,0X16,0X1C,0XAC,0X24,0X4B,0X24,0X2A,0X24,0X29,0X1C,0X4B,0X24,0X8B,0X34,
+0XEC,0X4D,0X2C,0X55,0X4C,0X5D,0X2D,0X55,0X4D,0X55,0X2C,0X5D,0X6D,0X5D,0X8E,0X5D,
+0X0C,0X54,0XEB,0X5D,0X09,0X65,0X49,0X5D,0X08,0X34,0X27,0X1A,0X43,0X33,0X84,0X3C,
+0XA7,0X80,0X44,0XE9,0X03,0X3C,0XC9,0X3C,0XA7,0X3C,0X26,0X3B,0XE4,0X80,0X44,0X03,
+0X19,0X44,0X43,0X3C,0XA8,0X35,0X0A,0X44,0XC8,0X44,0XE8,0X34,0XCA,0X2C,0X89,0X33,
+0XC5,0X2B,0XA5,0X2C,0X69,0X24,0X6A,0X2C,0X29,0X24,0X6A,0X24,0XCC,0X2D,0X2E,0X35,
+0X70,0X35,0X4F,0X2D,0X2E,0X24,0XAC,0X24,0X2A,0X1B,0XE9,0X24,0X09,0X23,0XC8,0X24,
+0X4B,0X1C,0X4B,0X1B,0XEA,0X80,0X1C,0X2B,0X0A,0X24,0X0A,0X24,0X09,0X1C,0X2A,0X1C,
+0X4C,0X1C,0X6C,0X1C,0X4C,0X1B,0XE9,0X23,0X67,0X1B,0X06,0X1A,0X64,0X1A,0X85,0X80,
+0X12,0X03,0X0D,0X1A,0X85,0X12,0X24,0X09,0XA3,0X09,0X83,0X09,0X02,0X08,0XE2,0X09,
+0X02,0X09,0X22,0X09,0X02,0X11,0XA4,0X09,0X22,0X08,0XC1,0X08,0XC2,0X08,0XE2,0X81,
+0X08,0XC2,0X00,0X08,0XE2,0X81,0X08,0XC2,0X03,0X00,0XA2,0X08,0XE2,0X08,0XC2,0X08,
+0XA2,0X80,0X00,0XA2,0X0A,0X08,0XC2,0X09,0X22,0X09,0X83,0X12,0X46,0X09,0X43,0X08,
+0XA2,0X00,0XA2,0X08,0X82,0X00,0XA2,0X08,0XC3,0X00,0XA2,0X94,0X00,0X61,0X00,0X08,
+0XA2,0X81,0X08,0XE2,0X01,0X08,0XC2,0X08,0XA2,0X82,0X08,0XA1,0X04,0X08,0XC2,0X08,
+0XA1,0X08,0XA2,0X08,0XC2,0X08,0XA2,0XB9,0X00,0X61,0X0F,0X00,0XA2,0X09,0X02,0X11,
+0XA3,0X11,0XC4,0X09,0XA3,0X09,0X42,0X09,0X63,0X09,0XA3,0X09,0X63,0X09,0X62,0X09,
+0X42,0X09,0X22,0X11,0XA3,0X1A,0X65,0X11,0X83,0X09,0X22,0X80,0X09,0X02,0X05,0X11,
+0X82,0X11,0XA2,0X09,0X42,0X09,0X62,0X11,0X82,0X11,0X62,0X80,0X09,0X02,0X0B,0X09,
+0X22,0X08,0XC2,0X00,0X61,0X08,0X81,0X08,0XE2,0X11,0XA3,0X12,0X04,0X11,0XE4,0X11,
+0XA4,0X11,0X83,0X09,0X63,0X09,0X43,0X80,0X09,0X23,0X30,0X09,0X22,0X09,0X02,0X09,
+0X22,0X09,0X02,0X09,0X23,0X09,0X03,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X11,0X42,0X22,
+0XC5,0X2C,0X09,0X2C,0X6A,0X2C,0X8A,0X3D,0X0B,0X5D,0X6D,0X5D,0X8D,0X55,0X4B,0X44,
+0XE9,0X45,0X4B,0X45,0X0B,0X4D,0X0A,0X55,0X4B,0X4D,0X2A,0X44,0XA8,0X33,0X45,0X54,
+0XC9,0X5D,0X2A,0X44,0X66,0X33,0XC6,0X3C,0X47,0X55,0X0B,0X4D,0X4D,0X4D,0X4C,0X45,
+0X0C,0X3C,0XAA,0X3D,0X0C,0X34,0XEC,0X2B,0XE7,0X2B,0XC6,0X2B,0X65,0X3C,0X07,0X3C,
+0X49,0X2B,0XA6,0X34,0X47,0X33,0XC4,0X2A,0XE4,0X19,0XE4,0X08,0XE2,0X8B,0X00,0X61,
+0X05,0X08,0X61,0X00,0X61,0X08,0XA2,0X11,0XA4,0X1B,0XA8,0X24,0X6A,0X80,0X24,0X4A,
+0X00,0X24,0XAC,0X80,0X1C,0XCD,0X35,0X1C,0XAD,0X1C,0XAC,0X1C,0X6C,0X24,0X4B,0X24,
+0X4A,0X2C,0X6A,0X3C,0XCA,0X55,0X2B,0X55,0X09,0X5D,0X4C,0X65,0X8E,0X65,0X8F,0X65,
+0XAF,0X5D,0X8E,0X4C,0XEA,0X44,0X07,0X54,0XC9,0X5D,0X4B,0X5D,0X29,0X5D,0X08,0X3C,
+0XA8,0X22,0XE4,0X2B,0XA6,0X45,0X09,0X55,0X6C,0X4D,0X2B,0X44,0XC8,0X3C,0XA7,0X3C,
+0X87,0X3C,0X66,0X3C,0X04,0X3B,0XC3,0X3B,0XE3,0X3C,0X46,0X3C,0X88,0X44,0XA7,0X45,
+0X09,0X3D,0X4B,0X3D,0X0A,0X2C,0X07,0X2B,0XE6,0X2C,0X08,0X24,0X08,0X2B,0XE7,0X2C,
+0X28,0X2C,0X49,0X24,0X8B,0X25,0X0F,0X3D,0X90,0X35,0X4F,0X25,0X2E,0X24,0XCC,0X24,
+0X6B,0X24,0X2A,0X80,0X23,0XE9,0X12,0X1C,0X2B,0X1C,0X4B,0X1C,0X0A,0X24,0X2A,0X24,
+0X09,0X23,0XC8,0X24,0X09,0X24,0X0A,0X1C,0X2B,0X1C,0X6D,0X1C,0X8D,0X1C,0X0B,0X23,
+0X67,0X1A,0XC5,0X1A,0X24,0X12,0X24,0X12,0X45,0X1A,0X85,0X1A,0X84,0X80,0X11,0XC3,
+0X06,0X08,0XC2,0X08,0XE2,0X09,0X02,0X08,0XE2,0X09,0X02,0X08,0XE2,0X09,0X22,0X81,
+0X08,0XC2,0X01,0X08,0XA2,0X08,0XC2,0X80,0X08,0XE2,0X81,0X08,0XC2,0X0B,0X00,0XA2,
+0X08,0XE2,0X00,0XA2,0X08,0XA2,0X00,0XA2,0X08,0XA2,0X08,0XC1,0X09,0X02,0X09,0X83,
+0X11,0XE4,0X08,0XC2,0X08,0XA2,0X81,0X08,0X82,0X01,0X08,0XC2,0X00,0X82,0X95,0X00,
+0X61,0X00,0X00,0XA2,0X80,0X08,0XE2,0X80,0X08,0XC2,0X81,0X08,0XA1,0X05,0X08,0XC2,
+0X08,0XC1,0X08,0XC2,0X08,0XC1,0X08,0XC2,0X00,0X81,0XB8,0X00,0X61,0X0D,0X08,0XA2,
+0X09,0X23,0X09,0X02,0X09,0X22,0X09,0X83,0X11,0XC4,0X11,0X83,0X09,0X63,0X09,0X83,
+0X09,0X22,0X09,0X42,0X09,0X22,0X09,0X02,0X09,0X42,0X80,0X11,0XA3,0X03,0X09,0X83,
+0X09,0X42,0X09,0X02,0X19,0XE3,0X81,0X09,0X62,0X80,0X11,0X83,0X0A,0X09,0X63,0X09,
+0X42,0X09,0X02,0X08,0XE2,0X08,0XA1,0X08,0X81,0X08,0XA2,0X09,0X02,0X11,0X63,0X11,
+0XC4,0X12,0X04,0X81,0X12,0X24,0X01,0X11,0XC4,0X09,0X63,0X80,0X09,0X43,0X00,0X09,
+0X63,0X80,0X09,0X22,0X2D,0X09,0X43,0X09,0X42,0X11,0X63,0X1A,0X65,0X23,0X67,0X2C,
+0X08,0X2C,0X69,0X2C,0X8A,0X34,0X88,0X55,0X2A,0X75,0XCF,0X65,0XAF,0X5D,0XAE,0X45,
+0X6C,0X35,0X0B,0X45,0X0B,0X65,0XAE,0X55,0X4C,0X4D,0X4B,0X3C,0XC9,0X1A,0X03,0X2B,
+0X05,0X55,0X08,0X54,0XE8,0X4C,0XA8,0X3C,0X06,0X33,0XA5,0X2B,0XE7,0X3C,0X47,0X54,
+0XE9,0X55,0X29,0X55,0X4B,0X55,0X0A,0X44,0X89,0X3C,0X49,0X44,0X48,0X4D,0X4D,0X4D,
+0X6D,0X34,0X27,0X2B,0X85,0X34,0X67,0X3C,0XEC,0X33,0XE6,0X22,0XC5,0X11,0XA4,0X08,
+0X81,0X89,0X00,0X61,0X05,0X08,0X61,0X08,0XA2,0X19,0XE4,0X23,0X88,0X24,0X6B,0X24,
+0X4A,0X80,0X24,0X29,0X01,0X24,0X6B,0X1C,0X8C,0X80,0X1C,0XAC,0X80,0X1C,0X8D,0X26,
+0X24,0X8B,0X2C,0X6A,0X3C,0XEA,0X5D,0X4A,0X5D,0X09,0X5C,0XE9,0X65,0X6D,0X65,0XAF,
+0X6D,0XAF,0X5D,0X6D,0X44,0XAA,0X2B,0X45,0X33,0X64,0X5D,0X4A,0X65,0X6C,0X5D,0X29,
+0X5D,0X28,0X55,0X09,0X2B,0X45,0X2B,0X65,0X44,0XE9,0X4D,0X6C,0X4D,0X2B,0X44,0XC8,
+0X3C,0XA7,0X44,0XE9,0X44,0XC9,0X3C,0X26,0X3C,0X05,0X3C,0X25,0X3C,0XA8,0X34,0X88,
+0X3C,0X66,0X3C,0XC8,0X45,0X0A,0X45,0X6B,0X3D,0X2B,0X2C,0X68,0X2B,0XE6,0X81,0X2C,
+0X28,0X0D,0X2C,0X27,0X24,0X8B,0X2D,0X50,0X3D,0X90,0X2D,0X2F,0X24,0XED,0X24,0XCC,
+0X2C,0XCB,0X24,0X4A,0X1C,0X0A,0X23,0XC8,0X24,0X0A,0X1C,0X6C,0X1C,0X4B,0X80,0X24,
+0X09,0X01,0X23,0XC7,0X23,0XC8,0X80,0X24,0X09,0X08,0X1B,0XEA,0X1C,0X6C,0X1C,0X4B,
+0X23,0XC8,0X23,0X05,0X1A,0X84,0X1A,0XA5,0X12,0XC7,0X12,0X65,0X80,0X12,0X44,0X05,
+0X12,0X24,0X09,0X02,0X08,0XE2,0X09,0X02,0X09,0X22,0X09,0X02,0X80,0X08,0XE2,0X00,
+0X08,0XC2,0X81,0X08,0XA2,0X01,0X08,0XC2,0X08,0XE2,0X80,0X08,0XC2,0X06,0X08,0XE2,
+0X08,0XC2,0X00,0XA2,0X08,0XE2,0X00,0X82,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,0X02,
+0X08,0XE2,0X09,0X42,0X09,0X43,0X80,0X08,0XA2,0X03,0X08,0X82,0X08,0XA2,0X00,0XA3,
+0X00,0X82,0X96,0X00,0X61,0X01,0X00,0X81,0X08,0XC2,0X80,0X08,0XE2,0X04,0X08,0XC2,
+0X08,0XA1,0X08,0X81,0X08,0XC2,0X08,0XE2,0X80,0X08,0XC1,0X02,0X08,0XE2,0X00,0XA2,
+0X08,0X61,0XB4,0X00,0X61,0X00,0X08,0X61,0X80,0X00,0X61,0X0C,0X08,0XA1,0X08,0XE2,
+0X11,0XA3,0X12,0X25,0X11,0X82,0X11,0XA3,0X12,0X24,0X12,0X65,0X11,0X63,0X11,0XC3,
+0X09,0X62,0X09,0X02,0X09,0X22,0X80,0X09,0X02,0X07,0X09,0X22,0X09,0X63,0X11,0XA3,
+0X09,0X63,0X11,0X62,0X1A,0X02,0X11,0X62,0X11,0XC3,0X80,0X11,0XA3,0X05,0X12,0X24,
+0X11,0XE4,0X11,0XA3,0X11,0X63,0X09,0X22,0X08,0XC2,0X80,0X08,0X82,0X00,0X08,0XA2,
+0X80,0X08,0X81,0X39,0X08,0XA1,0X08,0XE2,0X11,0X43,0X11,0XC4,0X12,0X04,0X12,0X44,
+0X12,0X04,0X09,0X62,0X09,0X63,0X09,0X22,0X11,0X83,0X1A,0X23,0X22,0XC5,0X23,0X25,
+0X2C,0X08,0X2C,0XAA,0X2C,0X8A,0X34,0X89,0X45,0X0A,0X5D,0X2B,0X65,0X4A,0X5D,0X4B,
+0X55,0X6C,0X4D,0X6D,0X3D,0X2C,0X4D,0X4D,0X65,0XAE,0X75,0XCF,0X65,0X8E,0X4D,0X09,
+0X44,0X66,0X22,0X84,0X1A,0X03,0X44,0X66,0X5C,0XE6,0X5D,0X07,0X54,0XE7,0X44,0X45,
+0X33,0XA5,0X2B,0X24,0X33,0X64,0X3B,0XE5,0X44,0X26,0X44,0XA9,0X4D,0X0A,0X55,0X2B,
+0X65,0X8D,0X5D,0X6D,0X4D,0X4B,0X34,0X06,0X2B,0X65,0X34,0X47,0X45,0X4D,0X34,0X27,
+0X2C,0X08,0X23,0XC7,0X1A,0XE6,0X11,0X83,0X88,0X00,0X61,0X03,0X08,0X81,0X11,0X83,
+0X2B,0X87,0X24,0X09,0X80,0X24,0X4A,0X80,0X23,0XE8,0X02,0X24,0X6A,0X24,0X6B,0X1C,
+0XAC,0X80,0X1C,0XCD,0X06,0X1C,0XAD,0X34,0XCB,0X44,0XCA,0X55,0X2A,0X55,0X0A,0X4C,
+0XE9,0X54,0XEA,0X80,0X5D,0X6E,0X0C,0X4D,0X2C,0X44,0X8A,0X2B,0X65,0X2A,0XC3,0X3C,
+0X06,0X65,0X8C,0X5D,0X6C,0X5C,0XE9,0X5D,0X08,0X55,0X29,0X23,0X66,0X22,0XC4,0X3C,
+0X87,0X80,0X4D,0X2A,0X80,0X44,0XE8,0X26,0X55,0X2A,0X55,0X4C,0X3C,0XA9,0X34,0X47,
+0X3C,0X87,0X3C,0XC8,0X3C,0X67,0X3C,0X26,0X3C,0X45,0X44,0X86,0X4D,0X08,0X4D,0X8C,
+0X45,0X0A,0X3C,0X47,0X34,0X48,0X2C,0X48,0X2C,0X28,0X2C,0X07,0X24,0XAC,0X2D,0X4F,
+0X35,0X4F,0X2D,0X0D,0X2C,0XCC,0X24,0XED,0X25,0X0D,0X24,0XAB,0X24,0X29,0X23,0XC8,
+0X23,0XC9,0X1C,0X4B,0X1C,0X6C,0X24,0X09,0X23,0XC8,0X23,0X87,0X23,0XA8,0X1B,0XC9,
+0X23,0XE9,0X1B,0XC8,0X23,0X87,0X80,0X23,0XA7,0X0E,0X23,0X86,0X23,0X25,0X1A,0X85,
+0X12,0XC7,0X12,0X45,0X12,0X04,0X1A,0XA5,0X12,0X65,0X09,0X02,0X08,0XE1,0X09,0X02,
+0X08,0XE2,0X09,0X02,0X08,0XE2,0X08,0XE1,0X82,0X08,0XA2,0X82,0X08,0XC2,0X00,0X08,
+0XE2,0X80,0X08,0XA2,0X02,0X08,0XE2,0X00,0X81,0X00,0X82,0X80,0X00,0XA2,0X09,0X08,
+0XA2,0X08,0XC2,0X09,0X02,0X08,0XE2,0X08,0XA2,0X00,0XA2,0X00,0X82,0X00,0XC3,0X01,
+0XA6,0X08,0X82,0X97,0X00,0X61,0X03,0X08,0X82,0X09,0X03,0X09,0XC5,0X09,0X44,0X80,
+0X08,0XC2,0X05,0X08,0XE2,0X09,0X02,0X08,0XA1,0X08,0XC2,0X08,0XE2,0X08,0XC2,0XB5,
+0X00,0X61,0X0B,0X00,0X81,0X08,0X61,0X08,0XA2,0X09,0X22,0X09,0X42,0X11,0XC4,0X12,
+0X45,0X12,0X04,0X11,0XC3,0X12,0X24,0X12,0X65,0X11,0XC4,0X80,0X11,0XE3,0X03,0X11,
+0X83,0X11,0X62,0X09,0X62,0X09,0X42,0X80,0X09,0X22,0X0E,0X11,0X83,0X09,0X42,0X1A,
+0X03,0X11,0XA2,0X11,0XC3,0X11,0XE3,0X09,0X62,0X11,0XC3,0X11,0XE4,0X12,0X04,0X11,
+0XC3,0X09,0X83,0X09,0X42,0X09,0X02,0X08,0XC2,0X82,0X08,0XA2,0X1A,0X08,0XA1,0X00,
+0X82,0X08,0X82,0X08,0XC2,0X09,0X02,0X11,0X63,0X11,0XE3,0X1A,0X44,0X12,0X05,0X11,
+0XE3,0X23,0X46,0X2C,0X08,0X2C,0X8A,0X2C,0X89,0X2C,0X48,0X2C,0XAB,0X3D,0X0C,0X5D,
+0X6D,0X65,0XAE,0X6D,0XCF,0X75,0XD0,0X5D,0X8D,0X44,0XE9,0X3D,0X0B,0X3D,0X0C,0X6D,
+0XB0,0X75,0XB0,0X80,0X75,0XCF,0X05,0X5D,0X4B,0X44,0X45,0X23,0XA8,0X1B,0X69,0X2B,
+0X66,0X54,0XC7,0X81,0X5C,0XE6,0X15,0X54,0X84,0X3C,0X04,0X2B,0X44,0X22,0XC3,0X22,
+0XE3,0X2B,0X44,0X3B,0XC4,0X44,0XC8,0X5D,0X4B,0X5D,0X4C,0X5D,0X4B,0X44,0X88,0X2C,
+0X08,0X2B,0X04,0X3C,0X26,0X2B,0XA5,0X2C,0X28,0X34,0X49,0X2C,0X49,0X2B,0XA7,0X08,
+0XC1,0X00,0X41,0X85,0X00,0X61,0X03,0X08,0XC2,0X11,0X42,0X22,0XA4,0X2B,0XC7,0X80,
+0X23,0XC7,0X1D,0X2C,0X08,0X2B,0XC6,0X2B,0XA6,0X24,0X29,0X24,0X4A,0X24,0X8C,0X1C,
+0XCD,0X24,0XCC,0X2C,0XCB,0X44,0XC9,0X55,0X09,0X4D,0X0A,0X3C,0XA9,0X44,0XC9,0X4D,
+0X2B,0X55,0X4D,0X3D,0X2C,0X34,0XAA,0X2B,0XA5,0X2A,0XE3,0X33,0X84,0X4C,0XC8,0X65,
+0X8D,0X65,0X6C,0X54,0XE9,0X5C,0XE8,0X55,0X09,0X23,0X65,0X1A,0X03,0X34,0X06,0X81,
+0X4D,0X0A,0X13,0X5D,0X4A,0X5D,0X6C,0X5D,0X6D,0X45,0X0C,0X2C,0X68,0X34,0X06,0X34,
+0X46,0X3C,0X87,0X3C,0X46,0X3C,0X25,0X44,0X24,0X4C,0X86,0X55,0X09,0X55,0X4B,0X4D,
+0X4C,0X45,0X0B,0X2C,0X89,0X2C,0X48,0X2C,0X28,0X24,0X8A,0X80,0X24,0XCD,0X0B,0X2C,
+0XCC,0X2C,0XCB,0X24,0XCC,0X2D,0X2E,0X2C,0XEC,0X24,0X29,0X23,0XC8,0X23,0X87,0X1B,
+0XC9,0X1C,0X6D,0X1C,0X2B,0X1B,0XE9,0X81,0X1B,0XC9,0X80,0X24,0X09,0X0B,0X23,0X87,
+0X23,0X65,0X23,0X86,0X2B,0X86,0X23,0X25,0X1A,0X84,0X12,0XA6,0X12,0X66,0X12,0X86,
+0X12,0XE8,0X12,0XC6,0X09,0X02,0X82,0X08,0XE2,0X00,0X09,0X02,0X80,0X08,0XE2,0X01,
+0X08,0XC1,0X08,0XA1,0X80,0X08,0XC2,0X00,0X08,0XA1,0X80,0X08,0XA2,0X09,0X08,0XC2,
+0X00,0X82,0X08,0X82,0X08,0XC2,0X00,0X81,0X08,0X82,0X08,0XA2,0X00,0XA2,0X00,0X82,
+0X08,0XA1,0X81,0X08,0XA2,0X04,0X00,0XA2,0X08,0X81,0X00,0XE3,0X01,0XA7,0X00,0X81,
+0X98,0X00,0X61,0X0A,0X08,0XA2,0X01,0XA6,0X0A,0X27,0X00,0XE3,0X0A,0X49,0X0A,0X47,
+0X09,0X64,0X08,0XC2,0X08,0XE2,0X09,0X02,0X08,0XC2,0XB4,0X00,0X61,0X06,0X08,0X61,
+0X00,0X61,0X00,0XA2,0X09,0X23,0X09,0X62,0X11,0XE3,0X12,0X24,0X80,0X11,0XE3,0X80,
+0X12,0X04,0X05,0X09,0XA3,0X12,0X04,0X1A,0X44,0X12,0X24,0X11,0XE3,0X11,0XC3,0X80,
+0X11,0XE3,0X0A,0X11,0X62,0X09,0X42,0X09,0X83,0X09,0X62,0X22,0X63,0X09,0X22,0X09,
+0X63,0X11,0XC3,0X11,0XE4,0X12,0X24,0X11,0XC3,0X80,0X11,0XE3,0X04,0X09,0X82,0X09,
+0X42,0X09,0X02,0X08,0XE2,0X08,0X82,0X84,0X08,0XA2,0X80,0X08,0XA1,0X04,0X08,0XC2,
+0X09,0X02,0X11,0X83,0X1A,0XC5,0X23,0X46,0X80,0X2C,0X89,0X18,0X2C,0X8A,0X24,0XAB,
+0X2C,0XEC,0X34,0XEC,0X65,0XB0,0X75,0XD0,0X65,0X8D,0X4C,0XE9,0X4D,0X09,0X55,0X09,
+0X3C,0X87,0X34,0X69,0X5D,0X4E,0X86,0X13,0X7D,0XF1,0X6D,0XAE,0X6D,0XCF,0X5D,0X6C,
+0X3C,0X46,0X1B,0XA9,0X14,0X2E,0X14,0X0D,0X34,0XCB,0X5D,0X28,0X64,0XE5,0X80,0X5C,
+0XC4,0X15,0X5C,0XC5,0X4C,0X84,0X3C,0X66,0X33,0XC6,0X2B,0X23,0X22,0XC3,0X33,0X63,
+0X44,0X24,0X3C,0X06,0X3C,0X26,0X4C,0XC8,0X4D,0X2B,0X33,0XA6,0X23,0X04,0X2B,0XC6,
+0X34,0X89,0X3D,0X2C,0X34,0X89,0X2C,0X28,0X2C,0X4B,0X12,0X04,0X08,0XC2,0X82,0X00,
+0X61,0X10,0X08,0XE2,0X1A,0X03,0X1A,0XA4,0X22,0XE4,0X2B,0X65,0X23,0XE7,0X2B,0XC7,
+0X2B,0X85,0X33,0XA5,0X33,0XC5,0X2B,0XC6,0X2B,0XE7,0X2C,0X07,0X2C,0X29,0X2C,0X8A,
+0X2C,0XAA,0X44,0XC9,0X80,0X44,0XA9,0X49,0X3C,0X89,0X34,0X47,0X3C,0X88,0X45,0X2C,
+0X35,0X0C,0X34,0X89,0X2B,0XC6,0X2B,0X43,0X33,0X84,0X44,0X66,0X5D,0X6C,0X65,0XAE,
+0X5D,0X4C,0X54,0XE9,0X5D,0X08,0X55,0X08,0X2B,0X65,0X19,0X62,0X2B,0X45,0X44,0XE9,
+0X55,0X2B,0X5D,0X4B,0X5D,0X6C,0X65,0X6D,0X5D,0X8E,0X4D,0X4D,0X34,0XCA,0X2C,0X27,
+0X33,0XE5,0X34,0X46,0X3C,0X47,0X3C,0X26,0X3C,0X24,0X44,0X23,0X54,0XC6,0X55,0X6C,
+0X65,0XAF,0X4D,0X6D,0X34,0XEA,0X2C,0X8A,0X24,0X49,0X24,0XAB,0X24,0X6B,0X24,0XAC,
+0X24,0XED,0X24,0XCD,0X2D,0X0E,0X35,0X6F,0X2C,0XEC,0X2C,0X08,0X2B,0XA6,0X23,0X46,
+0X1B,0X46,0X1C,0X0A,0X1C,0X2B,0X1B,0XCA,0X23,0XE9,0X1B,0XC8,0X1B,0XC9,0X1B,0XEA,
+0X1C,0X6C,0X1C,0X2B,0X23,0X87,0X23,0XA7,0X23,0XA6,0X22,0XE4,0X1A,0X63,0X12,0X86,
+0X12,0XE8,0X0B,0X29,0X0B,0XAC,0X0B,0X8B,0X09,0X22,0X08,0XE2,0X80,0X08,0XC2,0X82,
+0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,0XA2,0X00,0X08,0XA1,0X80,0X08,0XA2,0X05,0X08,
+0XC2,0X08,0XA2,0X08,0X82,0X08,0XA2,0X08,0XC2,0X08,0X81,0X81,0X08,0XA2,0X80,0X08,
+0X82,0X81,0X08,0XA2,0X04,0X00,0X82,0X08,0X61,0X00,0XA3,0X01,0XA6,0X08,0X61,0X98,
+0X00,0X61,0X05,0X08,0X61,0X08,0XA2,0X01,0X44,0X0A,0X48,0X0B,0XAD,0X09,0XA5,0X81,
+0X08,0XC2,0X01,0X00,0XE2,0X08,0XC2,0XB6,0X00,0X61,0X06,0X08,0XA1,0X09,0X22,0X11,
+0X83,0X12,0X04,0X11,0XC4,0X11,0XE3,0X12,0X04,0X80,0X11,0XC3,0X80,0X11,0XA3,0X04,
+0X11,0XC3,0X12,0X04,0X11,0XC3,0X09,0X62,0X11,0X83,0X80,0X11,0XC3,0X01,0X09,0X83,
+0X11,0X63,0X80,0X19,0XE3,0X00,0X09,0X62,0X80,0X11,0XA3,0X05,0X12,0X04,0X1A,0X24,
+0X09,0X62,0X11,0X82,0X12,0X44,0X11,0X82,0X80,0X09,0X22,0X02,0X08,0XE2,0X08,0XC1,
+0X08,0X81,0X82,0X00,0XA2,0X23,0X08,0XA2,0X00,0X62,0X00,0X82,0X08,0XA2,0X09,0X22,
+0X1A,0X64,0X2B,0X65,0X34,0X68,0X2C,0X48,0X2C,0X89,0X2C,0X6A,0X2C,0X8A,0X2D,0X0D,
+0X55,0X8F,0X75,0XF1,0X75,0XF0,0X75,0XD0,0X55,0X4C,0X3C,0X26,0X3C,0X45,0X34,0X26,
+0X44,0XEC,0X75,0XF1,0X7E,0X12,0X7D,0XF1,0X75,0XCF,0X65,0X8E,0X4C,0XE8,0X33,0XE5,
+0X13,0XAA,0X0C,0X2E,0X14,0X6F,0X14,0X6E,0X34,0XCB,0X5C,0XE7,0X5C,0XE4,0X80,0X5C,
+0XC4,0X15,0X5C,0XE5,0X5C,0XE6,0X44,0XA7,0X2B,0XC6,0X22,0XE4,0X1A,0X02,0X33,0X22,
+0X3B,0X82,0X33,0X43,0X33,0XE5,0X44,0X66,0X4D,0X4B,0X45,0X2C,0X2B,0X87,0X2B,0X45,
+0X3C,0X46,0X3B,0XE4,0X1B,0X89,0X3D,0X91,0X3D,0X4F,0X23,0X88,0X11,0X43,0X80,0X08,
+0X61,0X05,0X11,0X22,0X1A,0XA4,0X23,0X45,0X23,0X04,0X22,0XE4,0X2B,0XE7,0X80,0X24,
+0X49,0X08,0X2B,0XE7,0X33,0XC5,0X34,0X06,0X2C,0XCB,0X2C,0XAB,0X2C,0X07,0X33,0XC5,
+0X34,0X46,0X34,0X68,0X80,0X44,0XA8,0X0A,0X3C,0X69,0X34,0X69,0X34,0X68,0X34,0X87,
+0X3C,0XA8,0X34,0X47,0X2B,0X44,0X2B,0X03,0X33,0X84,0X3C,0X25,0X55,0X09,0X80,0X65,
+0X8D,0X3C,0X4C,0XEA,0X4C,0X88,0X5C,0XE7,0X5D,0X29,0X33,0XA5,0X19,0X22,0X22,0X63,
+0X44,0X87,0X4C,0XE8,0X55,0X09,0X55,0X2B,0X5D,0X8C,0X55,0X6D,0X4D,0X4D,0X3D,0X0B,
+0X34,0XCA,0X2C,0X28,0X33,0XE5,0X3C,0X05,0X3C,0X25,0X3C,0X04,0X44,0X23,0X44,0X64,
+0X55,0X2A,0X5D,0X6C,0X55,0X4B,0X45,0X2B,0X35,0X2C,0X2C,0XEC,0X24,0X8B,0X24,0X4B,
+0X24,0X6B,0X24,0XCD,0X2D,0X2E,0X45,0X90,0X35,0X70,0X24,0XEC,0X34,0X68,0X2B,0XE7,
+0X23,0XA7,0X1B,0X26,0X23,0X87,0X1C,0X2B,0X1B,0XCA,0X23,0XA8,0X1B,0XC9,0X1C,0X0A,
+0X1C,0X4C,0X1C,0X6D,0X1C,0XAE,0X1C,0X4C,0X23,0XE9,0X24,0X4A,0X2C,0X29,0X23,0X24,
+0X1B,0X07,0X13,0XAB,0X0B,0X8C,0X0B,0XAC,0X0B,0XEE,0X09,0X22,0X80,0X09,0X02,0X83,
+0X08,0XE2,0X02,0X08,0XC2,0X08,0XA2,0X08,0XA1,0X80,0X08,0XA2,0X80,0X08,0XC2,0X80,
+0X08,0XA2,0X07,0X08,0X82,0X08,0XC2,0X00,0X61,0X08,0X82,0X08,0XA2,0X00,0XC2,0X08,
+0XA2,0X00,0X82,0X80,0X08,0X82,0X80,0X08,0XA2,0X03,0X00,0X82,0X00,0XA2,0X01,0XC6,
+0X00,0X62,0X97,0X00,0X61,0X05,0X08,0X61,0X00,0X61,0X08,0X81,0X00,0X82,0X09,0X85,
+0X09,0X44,0X80,0X08,0XC2,0X01,0X08,0XE2,0X08,0X81,0X80,0X08,0XC2,0XB5,0X00,0X61,
+0X0C,0X08,0XC1,0X11,0X22,0X09,0X42,0X09,0X62,0X09,0X82,0X12,0X44,0X1A,0XA5,0X11,
+0XC3,0X11,0X62,0X11,0X83,0X12,0X44,0X1A,0X24,0X11,0XE3,0X80,0X12,0X04,0X02,0X11,
+0XE3,0X11,0XA3,0X09,0X62,0X80,0X09,0X63,0X01,0X11,0X82,0X1A,0X43,0X80,0X09,0X42,
+0X07,0X11,0XA3,0X11,0XA2,0X11,0XC3,0X11,0XE3,0X11,0XC3,0X11,0XA2,0X12,0X03,0X11,
+0X82,0X80,0X09,0X42,0X01,0X09,0X22,0X08,0XE2,0X80,0X08,0XA1,0X80,0X00,0XA2,0X80,
+0X08,0X82,0X80,0X08,0XA2,0X12,0X08,0XC2,0X19,0XC2,0X22,0XE3,0X2B,0X85,0X2C,0X8A,
+0X2C,0X8B,0X2C,0XEC,0X2C,0XAA,0X2C,0XAB,0X45,0X2D,0X6D,0XAF,0X75,0XF1,0X6D,0XD1,
+0X65,0XAF,0X4D,0X6D,0X3D,0X4C,0X2C,0X89,0X34,0XCB,0X5D,0X90,0X80,0X7E,0X12,0X0D,
+0X6D,0XD0,0X65,0X8E,0X5D,0X6C,0X44,0X87,0X33,0X84,0X1B,0X47,0X13,0X49,0X1B,0X28,
+0X12,0XE8,0X23,0XA9,0X3C,0X06,0X54,0XC6,0X64,0XE5,0X5C,0XE4,0X80,0X5C,0XC4,0X04,
+0X5C,0XE6,0X4C,0XE8,0X34,0XA9,0X23,0X66,0X1A,0X63,0X80,0X22,0X63,0X1D,0X33,0X44,
+0X33,0XA4,0X3C,0X25,0X5D,0X2B,0X55,0X0C,0X33,0XE8,0X23,0X25,0X23,0X45,0X24,0XEE,
+0X45,0XB1,0X45,0X91,0X34,0X6A,0X22,0X84,0X08,0XE2,0X09,0X22,0X1A,0X64,0X22,0XA4,
+0X22,0XA3,0X22,0X83,0X2B,0X24,0X2C,0X28,0X2C,0X8A,0X2C,0X89,0X2C,0X48,0X2B,0XA5,
+0X34,0X27,0X2D,0X0C,0X2D,0X2D,0X34,0X88,0X3C,0X25,0X80,0X3C,0X66,0X19,0X34,0X46,
+0X34,0X67,0X44,0XA9,0X3C,0XCA,0X34,0XA9,0X34,0X06,0X33,0XA4,0X2B,0X03,0X22,0XE3,
+0X33,0X64,0X3C,0X05,0X44,0XA7,0X5D,0X4B,0X65,0X8D,0X55,0X4C,0X3C,0XA9,0X44,0X67,
+0X5C,0XE8,0X5D,0X4A,0X33,0XE6,0X11,0X02,0X19,0XC2,0X3B,0XA4,0X44,0X85,0X54,0XC8,
+0X5D,0X09,0X80,0X55,0X2B,0X00,0X45,0X0B,0X80,0X45,0X2C,0X0D,0X3C,0XEB,0X34,0X68,
+0X34,0X05,0X3C,0X05,0X3B,0XE5,0X3C,0X04,0X3C,0X25,0X3C,0XA7,0X3C,0XE9,0X44,0XE9,
+0X55,0X2A,0X5D,0X8D,0X4D,0X8E,0X34,0XEC,0X80,0X24,0X6B,0X0B,0X24,0XAC,0X2D,0X0E,
+0X45,0X70,0X35,0X70,0X24,0XCC,0X34,0XCA,0X34,0XAA,0X2C,0X48,0X2B,0XA6,0X23,0X45,
+0X24,0X09,0X1C,0X4B,0X81,0X1C,0X0A,0X0E,0X1C,0X2B,0X1C,0X4C,0X1C,0X6D,0X1C,0X2B,
+0X23,0XE8,0X24,0X09,0X2C,0X08,0X2B,0X24,0X1A,0XC4,0X13,0X4A,0X0B,0XCD,0X0B,0XED,
+0X0B,0XEE,0X09,0X43,0X09,0X02,0X82,0X08,0XE2,0X80,0X09,0X02,0X03,0X08,0XE2,0X08,
+0XC2,0X08,0XA1,0X08,0XA2,0X81,0X08,0XC2,0X80,0X08,0XA2,0X04,0X00,0XA2,0X08,0XE2,
+0X00,0X81,0X08,0X82,0X08,0XA2,0X80,0X00,0XC2,0X07,0X08,0XA2,0X00,0X82,0X00,0X81,
+0X08,0X81,0X00,0X82,0X00,0XA2,0X08,0X82,0X00,0XA2,0X9B,0X00,0X61,0X09,0X08,0X61,
+0X08,0XA2,0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X22,0X08,0XA2,0X08,0XC2,0X00,0XA2,
+0X00,0X41,0XB1,0X00,0X61,0X22,0X08,0X61,0X00,0X61,0X08,0XC2,0X11,0X63,0X12,0X04,
+0X11,0XE3,0X11,0X83,0X11,0XC3,0X1A,0X24,0X1A,0X85,0X1A,0X24,0X11,0X83,0X11,0XA3,
+0X12,0X64,0X1A,0X44,0X11,0XC3,0X12,0X04,0X12,0X03,0X12,0X24,0X1A,0X65,0X12,0X04,
+0X09,0X42,0X11,0X63,0X11,0XA2,0X1A,0X23,0X11,0X83,0X11,0XA2,0X11,0XC3,0X11,0XE3,
+0X1A,0X24,0X12,0X03,0X11,0XA3,0X12,0X24,0X1A,0X24,0X11,0XA3,0X80,0X09,0X42,0X80,
+0X09,0X22,0X1C,0X08,0XA1,0X08,0X81,0X08,0X82,0X08,0XA1,0X08,0XA2,0X00,0X82,0X00,
+0XA2,0X08,0XA2,0X11,0X83,0X22,0XC4,0X23,0X66,0X24,0X2A,0X2C,0XCC,0X2C,0XCB,0X2C,
+0XAB,0X2C,0X8A,0X34,0XEB,0X6D,0XAF,0X75,0XD0,0X75,0XD1,0X6D,0XD0,0X5D,0X8F,0X4D,
+0X2C,0X3D,0X4C,0X34,0XCB,0X3C,0XEC,0X65,0XB0,0X75,0XF1,0X75,0XD0,0X80,0X5D,0X6D,
+0X0C,0X55,0X4B,0X3C,0XA7,0X33,0X64,0X1A,0XC5,0X12,0X85,0X1A,0X65,0X1A,0X45,0X1B,
+0X07,0X23,0X26,0X33,0XE6,0X5D,0X09,0X65,0X28,0X5C,0XE5,0X80,0X5C,0XC4,0X06,0X5C,
+0XE6,0X3C,0XC9,0X34,0X89,0X2B,0XE7,0X2B,0X66,0X22,0XE4,0X2A,0XC3,0X80,0X22,0XA3,
+0X22,0X33,0X64,0X4C,0XE9,0X55,0X2D,0X3C,0XAB,0X2C,0X6A,0X25,0X0E,0X35,0X70,0X45,
+0X70,0X34,0X6B,0X2B,0X65,0X1A,0X43,0X11,0XC4,0X1A,0X23,0X1A,0X22,0X22,0X83,0X2A,
+0XE3,0X33,0X85,0X2C,0X68,0X24,0X6A,0X2C,0X49,0X2C,0X28,0X33,0XC5,0X34,0X26,0X34,
+0XEA,0X3C,0XEA,0X44,0XA7,0X44,0X45,0X3C,0X25,0X3C,0X05,0X34,0X05,0X34,0X48,0X3C,
+0XC9,0X3C,0XEA,0X34,0X68,0X2B,0X85,0X80,0X22,0X83,0X1D,0X33,0X63,0X3B,0XE4,0X3C,
+0X25,0X4C,0XE8,0X65,0X8E,0X6D,0XAE,0X55,0X2C,0X3C,0X88,0X44,0X66,0X5C,0XE8,0X5D,
+0X6B,0X2B,0XE6,0X10,0XE1,0X11,0X22,0X2B,0X23,0X44,0X86,0X55,0X2A,0X5D,0X6B,0X55,
+0X2B,0X55,0X0A,0X4D,0X09,0X4D,0X0A,0X55,0X2C,0X55,0X4D,0X45,0X0C,0X34,0X88,0X3C,
+0X05,0X3B,0XE5,0X3C,0X05,0X3C,0X45,0X80,0X3C,0X87,0X06,0X44,0XC8,0X5D,0X4B,0X6D,
+0XCF,0X6D,0XAF,0X45,0X4E,0X2C,0XED,0X24,0XEE,0X80,0X25,0X0E,0X1B,0X2D,0X2F,0X25,
+0X0E,0X2C,0XED,0X2D,0X0C,0X34,0XEB,0X34,0X68,0X33,0XE6,0X2B,0XC6,0X24,0X29,0X24,
+0X4A,0X1C,0X2A,0X1B,0XC9,0X23,0XC9,0X1B,0XE9,0X1C,0X0B,0X1C,0X2B,0X1C,0X4B,0X24,
+0X2A,0X23,0XE7,0X2B,0X65,0X22,0XE4,0X22,0XC4,0X13,0X08,0X0B,0X6C,0X0B,0XAD,0X0C,
+0X0E,0X09,0X22,0X09,0X23,0X85,0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,0XA1,0X02,0X08,
+0XA2,0X00,0XA2,0X08,0XC2,0X81,0X08,0XA2,0X0C,0X08,0XE2,0X08,0X81,0X00,0X82,0X08,
+0XA2,0X00,0XC2,0X00,0XE3,0X00,0XA2,0X08,0X82,0X00,0X81,0X00,0X82,0X00,0X61,0X00,
+0X82,0X08,0X82,0X9E,0X00,0X61,0X06,0X08,0XA1,0X08,0XE2,0X09,0X02,0X09,0X64,0X08,
+0XE2,0X00,0XC2,0X08,0X82,0XB3,0X00,0X61,0X17,0X08,0XE2,0X11,0XC3,0X12,0X04,0X11,
+0XE3,0X11,0XC3,0X11,0XE3,0X1A,0X03,0X12,0X03,0X11,0XC3,0X11,0XA3,0X11,0XE3,0X12,
+0X24,0X12,0X44,0X1A,0X65,0X1A,0X24,0X12,0X04,0X11,0XC3,0X11,0X82,0X11,0XA3,0X12,
+0X03,0X11,0XC3,0X11,0X83,0X11,0XE3,0X19,0XE2,0X81,0X11,0XE3,0X08,0X11,0XC3,0X1A,
+0X24,0X1A,0XA4,0X1A,0X84,0X1A,0X64,0X12,0X03,0X11,0XA2,0X09,0X62,0X11,0X62,0X80,
+0X09,0X22,0X01,0X08,0XC2,0X00,0XA1,0X80,0X08,0XA1,0X00,0X00,0X82,0X80,0X08,0XA2,
+0X1C,0X11,0X82,0X23,0X05,0X23,0XA7,0X24,0X29,0X24,0XED,0X24,0XAC,0X24,0X49,0X24,
+0X8B,0X2C,0X49,0X45,0X2C,0X75,0XCF,0X6D,0XAF,0X65,0XAE,0X5D,0X8F,0X55,0X8F,0X45,
+0X2D,0X34,0XEB,0X34,0XCB,0X4D,0X4D,0X5D,0X8F,0X65,0XAF,0X65,0X8E,0X5D,0X6D,0X65,
+0X6D,0X55,0X6D,0X3C,0XC9,0X2B,0X86,0X1B,0X48,0X12,0XE7,0X80,0X12,0X66,0X06,0X1A,
+0XC7,0X1B,0XA9,0X1B,0XEA,0X34,0X08,0X4C,0X88,0X5D,0X28,0X64,0XE5,0X80,0X5C,0XC4,
+0X30,0X54,0XE6,0X45,0X09,0X34,0XCA,0X2C,0X89,0X33,0XE6,0X33,0XC5,0X22,0XC3,0X1A,
+0X02,0X1A,0X42,0X33,0XC6,0X55,0X4E,0X45,0X0D,0X34,0X8A,0X24,0X09,0X2D,0X0D,0X2D,
+0X0E,0X35,0X2F,0X34,0XAC,0X2B,0X87,0X23,0X67,0X12,0X03,0X1A,0X03,0X22,0X83,0X33,
+0X64,0X34,0X27,0X2C,0X89,0X24,0X6A,0X2C,0X49,0X2C,0X28,0X2B,0XA5,0X3B,0XE4,0X44,
+0X86,0X44,0X65,0X44,0X44,0X44,0X03,0X3B,0XC3,0X33,0XC4,0X34,0X06,0X34,0X68,0X34,
+0X89,0X34,0X88,0X2B,0XE6,0X22,0XE4,0X22,0XA3,0X33,0X64,0X3C,0X04,0X3C,0X05,0X3C,
+0X67,0X55,0X2B,0X80,0X6D,0XAF,0X3D,0X55,0X2C,0X3C,0X67,0X44,0X66,0X5D,0X08,0X5D,
+0X4A,0X2B,0XC6,0X10,0XC2,0X08,0XC2,0X1A,0X02,0X3B,0XE5,0X55,0X2B,0X65,0X8D,0X5D,
+0X6C,0X5D,0X4C,0X55,0X2A,0X55,0X2B,0X55,0X4C,0X5D,0X8E,0X55,0X8E,0X3C,0XEB,0X34,
+0X26,0X3C,0X25,0X3C,0X46,0X3C,0X87,0X3C,0XA7,0X3C,0X66,0X4C,0XA7,0X5D,0X6C,0X6D,
+0XCF,0X65,0XAE,0X4D,0X4D,0X3D,0X2D,0X25,0X30,0X25,0X0F,0X24,0XED,0X24,0XEE,0X35,
+0X4F,0X3D,0X70,0X35,0X4E,0X2D,0X0C,0X34,0XA9,0X34,0X27,0X34,0X47,0X2C,0X68,0X24,
+0X29,0X1C,0X0A,0X1B,0XC9,0X23,0XE8,0X23,0XE9,0X1B,0XC9,0X1C,0X0A,0X1C,0X2A,0X24,
+0X2A,0X23,0XC7,0X2B,0X24,0X22,0XC3,0X22,0XE4,0X1B,0X06,0X0B,0X09,0X0B,0XAC,0X0B,
+0XEE,0X08,0XE2,0X83,0X09,0X02,0X82,0X08,0XE2,0X81,0X08,0XC2,0X06,0X08,0XA2,0X08,
+0XC2,0X08,0XA2,0X08,0X81,0X08,0XA2,0X08,0XC2,0X08,0X81,0X80,0X00,0X82,0X04,0X00,
+0XA2,0X08,0XE2,0X00,0XC2,0X00,0X62,0X00,0X82,0X81,0X08,0X82,0X9F,0X00,0X61,0X00,
+0X08,0X81,0X80,0X08,0XC2,0X03,0X09,0XC5,0X09,0X43,0X09,0X03,0X00,0X82,0XB3,0X00,
+0X61,0X04,0X08,0XE2,0X11,0XE4,0X12,0X04,0X11,0XE4,0X11,0XE3,0X80,0X12,0X03,0X80,
+0X1A,0X44,0X1D,0X12,0X44,0X1A,0X44,0X1A,0X04,0X11,0XE3,0X12,0X24,0X12,0X04,0X1A,
+0X44,0X12,0X03,0X12,0X04,0X11,0XA3,0X09,0X42,0X12,0X03,0X11,0XC3,0X1A,0X43,0X1A,
+0X03,0X12,0X03,0X1A,0X44,0X1A,0X64,0X11,0XE3,0X11,0XA3,0X1A,0X44,0X22,0XE5,0X1A,
+0XA4,0X1A,0X23,0X11,0XE3,0X11,0XA2,0X19,0XE3,0X11,0X62,0X09,0X22,0X09,0X02,0X80,
+0X08,0XA2,0X0E,0X08,0XA1,0X00,0X82,0X08,0X81,0X11,0X62,0X23,0X46,0X2C,0X29,0X24,
+0XAC,0X24,0XED,0X35,0X2E,0X2C,0XED,0X24,0XAC,0X24,0XEE,0X34,0XAB,0X5D,0X8E,0X6D,
+0XAE,0X80,0X5D,0X8D,0X0E,0X4D,0X4D,0X4D,0X4E,0X45,0X2D,0X34,0XCB,0X45,0X0C,0X55,
+0X2C,0X55,0X4C,0X5D,0X6D,0X55,0X6D,0X55,0X6E,0X65,0XB0,0X5D,0X8E,0X3C,0X89,0X23,
+0X88,0X13,0X49,0X80,0X13,0X07,0X6E,0X1A,0XC6,0X11,0XE3,0X12,0X04,0X1A,0X85,0X1A,
+0XA6,0X23,0X05,0X3C,0X47,0X5D,0X29,0X5D,0X06,0X5C,0XA4,0X5C,0XC4,0X5C,0XE5,0X4C,
+0XE8,0X3C,0XE9,0X34,0X67,0X34,0X27,0X33,0XA5,0X2B,0X45,0X22,0X83,0X22,0XE4,0X2C,
+0X6B,0X2C,0XCD,0X34,0X6A,0X2C,0X8B,0X23,0XC9,0X24,0X8C,0X24,0XAD,0X2C,0XAC,0X24,
+0XAC,0X2C,0X6A,0X23,0X06,0X22,0X83,0X2B,0X65,0X2C,0X28,0X2C,0X8A,0X2C,0XAA,0X2C,
+0X8A,0X2C,0X69,0X2C,0X27,0X34,0X06,0X3C,0X25,0X44,0X23,0X44,0X03,0X3B,0XE3,0X3C,
+0X04,0X3C,0X05,0X34,0X26,0X34,0X47,0X2C,0X89,0X2C,0X68,0X2B,0XE6,0X2B,0X24,0X23,
+0X03,0X33,0X64,0X3C,0X05,0X3B,0XE4,0X3C,0X05,0X44,0XA8,0X5D,0X6C,0X65,0XAE,0X5D,
+0X6E,0X4C,0XEB,0X3C,0X68,0X44,0X66,0X5D,0X08,0X5D,0X6A,0X2C,0X28,0X11,0X42,0X08,
+0XC2,0X11,0X22,0X22,0XC3,0X3C,0X88,0X55,0X2B,0X65,0X8D,0X6D,0XAE,0X65,0XAF,0X5D,
+0X6E,0X55,0X4D,0X5D,0X8F,0X5D,0X6F,0X45,0X2D,0X34,0X68,0X3C,0X26,0X34,0X67,0X34,
+0XC9,0X3C,0XC8,0X3C,0X87,0X44,0XA7,0X5D,0X2A,0X65,0X8D,0X55,0X4C,0X55,0X2A,0X34,
+0XAB,0X24,0XEE,0X1C,0XEE,0X24,0XED,0X24,0XEE,0X35,0X4F,0X3D,0X90,0X2D,0X4F,0X2C,
+0XEC,0X2C,0X68,0X33,0XE5,0X34,0X06,0X2C,0X27,0X24,0X08,0X1C,0X0A,0X1B,0XEA,0X23,
+0XC8,0X23,0XA8,0X1B,0XC8,0X80,0X23,0XE9,0X08,0X24,0X09,0X23,0XE8,0X2B,0XA6,0X23,
+0X04,0X22,0XC3,0X22,0XE4,0X13,0X49,0X0B,0XCD,0X0B,0XEE,0X80,0X08,0XE2,0X81,0X09,
+0X02,0X85,0X08,0XE2,0X01,0X08,0XA2,0X00,0XA1,0X82,0X08,0XA2,0X00,0X08,0XC2,0X80,
+0X08,0X82,0X04,0X00,0X81,0X00,0XA2,0X08,0XC2,0X00,0XC2,0X08,0X82,0X80,0X00,0X82,
+0XA2,0X00,0X61,0X80,0X08,0XC2,0X02,0X09,0XA4,0X09,0X43,0X09,0X03,0X84,0X00,0X61,
+0X00,0X08,0X82,0XAC,0X00,0X61,0X14,0X08,0X81,0X09,0X02,0X11,0XC3,0X1A,0X44,0X12,
+0X24,0X11,0XA3,0X12,0X04,0X1A,0X44,0X12,0X24,0X12,0X04,0X11,0XE3,0X12,0X23,0X12,
+0X03,0X11,0X62,0X09,0X83,0X09,0X62,0X11,0X82,0X11,0X83,0X11,0XE3,0X1A,0X44,0X11,
+0XC3,0X80,0X11,0XE3,0X05,0X22,0X63,0X1A,0X44,0X1A,0X84,0X12,0X85,0X22,0XA4,0X1A,
+0X84,0X80,0X11,0XC3,0X05,0X1A,0XA5,0X1A,0X64,0X12,0X03,0X11,0XC3,0X11,0X82,0X11,
+0X62,0X80,0X09,0X62,0X0A,0X09,0X43,0X08,0XA2,0X08,0XA1,0X08,0X81,0X00,0X61,0X09,
+0X02,0X2B,0X04,0X2B,0XA6,0X2C,0X28,0X24,0XAB,0X35,0X2E,0X80,0X3D,0X6F,0X07,0X35,
+0X4F,0X2D,0X0D,0X45,0X2C,0X55,0X4A,0X54,0XE7,0X4D,0X09,0X4D,0X2B,0X4D,0X4D,0X80,
+0X3C,0XEC,0X10,0X5D,0X8F,0X6D,0XD1,0X6D,0XB0,0X5D,0X6D,0X55,0X2B,0X55,0X6C,0X5D,
+0X8F,0X6D,0XD1,0X55,0X6E,0X2B,0XE7,0X23,0X67,0X1B,0X69,0X13,0X6A,0X13,0X08,0X12,
+0XC7,0X1A,0X86,0X11,0XE3,0X80,0X11,0XC3,0X05,0X12,0X44,0X1A,0XC5,0X2B,0X66,0X55,
+0X0A,0X65,0X28,0X5C,0XA4,0X80,0X5C,0XC4,0X13,0X3C,0XA8,0X34,0X88,0X3C,0XC9,0X34,
+0XEA,0X34,0X67,0X33,0X84,0X33,0XC4,0X34,0X8A,0X2C,0XCC,0X23,0XC8,0X2C,0X29,0X2C,
+0X28,0X24,0X4A,0X24,0X2A,0X24,0X09,0X23,0XE8,0X24,0X49,0X2C,0XAA,0X2C,0X07,0X2C,
+0X49,0X80,0X2C,0XEC,0X20,0X2C,0XCB,0X2C,0X48,0X2B,0XE6,0X34,0X06,0X3C,0X87,0X44,
+0XA7,0X44,0X03,0X3B,0XC3,0X33,0XA3,0X3C,0X06,0X3C,0XA9,0X34,0XEA,0X34,0XAA,0X2C,
+0XA9,0X2C,0X48,0X2B,0X85,0X2B,0X23,0X33,0X84,0X44,0X03,0X3C,0X05,0X3B,0XC4,0X3C,
+0X25,0X4C,0XC8,0X65,0X6C,0X65,0X8D,0X5D,0X6C,0X4C,0XEA,0X44,0X87,0X4C,0X87,0X5D,
+0X09,0X55,0X2A,0X2B,0XC7,0X11,0X63,0X80,0X08,0XA1,0X27,0X19,0X62,0X2B,0X45,0X44,
+0XCA,0X5D,0X8E,0X6D,0XD0,0X75,0XF1,0X65,0XD1,0X65,0XB0,0X65,0XD0,0X5D,0X90,0X45,
+0X4D,0X34,0XA9,0X34,0X67,0X34,0X47,0X3C,0X88,0X3C,0XA8,0X34,0XA8,0X3C,0XA7,0X4C,
+0XE8,0X55,0X6C,0X5D,0X6C,0X55,0X0A,0X3C,0X88,0X24,0X8C,0X24,0XCC,0X24,0XED,0X1C,
+0XCE,0X24,0XCD,0X25,0X0E,0X24,0XEE,0X24,0XAB,0X34,0X06,0X3B,0XA3,0X33,0XA5,0X2B,
+0XC6,0X23,0XA7,0X1B,0XC9,0X1B,0XEA,0X1B,0XCA,0X1B,0XE9,0X80,0X1B,0XEA,0X80,0X23,
+0XE9,0X08,0X23,0XC8,0X24,0X0A,0X24,0X6B,0X23,0XC7,0X2B,0X04,0X22,0XE5,0X13,0X49,
+0X0B,0XCD,0X09,0X22,0X83,0X08,0XE2,0X00,0X09,0X02,0X81,0X08,0XE2,0X04,0X09,0X02,
+0X08,0XE2,0X08,0XC2,0X08,0XA2,0X08,0XA1,0X80,0X08,0XA2,0X80,0X08,0XC2,0X00,0X08,
+0X81,0X80,0X00,0X82,0X05,0X08,0X82,0X00,0X82,0X00,0XA2,0X08,0X82,0X08,0XA1,0X08,
+0X81,0XA2,0X00,0X61,0X04,0X00,0X81,0X08,0XA1,0X09,0X02,0X08,0XE2,0X08,0XC2,0XB3,
+0X00,0X61,0X0E,0X08,0X81,0X09,0X22,0X12,0X24,0X1A,0X64,0X12,0X04,0X11,0XE4,0X11,
+0XC3,0X11,0XE3,0X12,0X03,0X12,0X45,0X11,0XE4,0X12,0X24,0X1A,0X64,0X19,0XE3,0X11,
+0X62,0X81,0X09,0X42,0X03,0X09,0X62,0X11,0XA3,0X1A,0X44,0X12,0X04,0X80,0X1A,0X23,
+0X0B,0X11,0XC3,0X12,0X24,0X1A,0XA5,0X1A,0X24,0X1A,0X64,0X1A,0X84,0X11,0XC3,0X1A,
+0X23,0X1A,0X64,0X1A,0X84,0X1A,0X44,0X11,0XE3,0X82,0X11,0X82,0X67,0X09,0X02,0X08,
+0X81,0X08,0XA2,0X08,0X82,0X1A,0XA4,0X2C,0X07,0X2C,0X49,0X24,0X8B,0X24,0XAB,0X2C,
+0XCC,0X25,0X0E,0X35,0X4E,0X45,0X4E,0X3D,0X6D,0X4D,0X09,0X4C,0XA5,0X54,0XC5,0X4C,
+0XC6,0X4D,0X0A,0X4D,0X4C,0X35,0X0C,0X3C,0X6A,0X65,0XB0,0X65,0XAF,0X5D,0X8D,0X5D,
+0X6C,0X4D,0X0A,0X44,0XEA,0X5D,0X6E,0X5D,0X8F,0X45,0X0D,0X23,0X46,0X1A,0X84,0X1B,
+0X47,0X13,0X48,0X13,0X08,0X13,0X49,0X13,0X08,0X12,0XA6,0X12,0X65,0X12,0X45,0X13,
+0X8A,0X13,0X09,0X12,0X65,0X2B,0XA7,0X4D,0X4B,0X55,0X07,0X5C,0XC4,0X5C,0XC5,0X3C,
+0X45,0X33,0XE5,0X3C,0X26,0X3C,0XC9,0X3C,0XC8,0X3B,0XE5,0X4C,0XE7,0X4C,0XE8,0X44,
+0XA7,0X2B,0X85,0X22,0XA3,0X2C,0X07,0X2C,0X29,0X2B,0XC8,0X2C,0X29,0X2C,0X6A,0X33,
+0XA6,0X2B,0X86,0X2C,0XCB,0X2C,0XEC,0X3D,0X4E,0X35,0X2E,0X24,0XAB,0X2C,0X27,0X33,
+0XC5,0X3C,0X26,0X3C,0XA8,0X3C,0X87,0X3B,0XC4,0X33,0X43,0X33,0XA4,0X3C,0X68,0X45,
+0X0C,0X3C,0XEB,0X34,0X69,0X2C,0X28,0X2B,0XA6,0X2B,0X44,0X33,0X83,0X3B,0XE3,0X3C,
+0X24,0X3B,0XC4,0X3C,0X04,0X3C,0X25,0X4C,0XA7,0X5D,0X4C,0X65,0X6D,0X65,0X8E,0X4C,
+0XEA,0X44,0X87,0X4C,0XA7,0X65,0X4A,0X55,0X09,0X22,0XA4,0X08,0XA1,0X80,0X08,0X81,
+0X04,0X08,0XA2,0X22,0X43,0X34,0X89,0X5D,0X6E,0X6D,0XD0,0X80,0X6D,0XF2,0X11,0X75,
+0XF2,0X6D,0XD1,0X5D,0XB0,0X45,0X2C,0X3C,0XA8,0X34,0X67,0X34,0X88,0X34,0X47,0X3C,
+0XA8,0X34,0XA8,0X3C,0X87,0X4C,0XC7,0X55,0X6C,0X65,0XAD,0X65,0X8C,0X44,0XEA,0X2C,
+0XAA,0X24,0XAB,0X80,0X24,0XAC,0X0C,0X24,0XAB,0X1C,0XAD,0X24,0XCD,0X24,0X8B,0X2C,
+0X07,0X33,0XA5,0X33,0XA4,0X2B,0XC6,0X23,0X86,0X23,0X87,0X1B,0XE9,0X1B,0XEA,0X1B,
+0XEB,0X80,0X1C,0X2B,0X0A,0X1B,0XCA,0X23,0XA7,0X23,0X87,0X1C,0X0A,0X1C,0X8D,0X1C,
+0XCD,0X24,0X6B,0X23,0XA7,0X22,0XE5,0X13,0X28,0X09,0X42,0X83,0X08,0XE2,0X02,0X09,
+0X02,0X09,0X22,0X09,0X02,0X81,0X08,0XE2,0X01,0X08,0XC2,0X08,0XA2,0X81,0X08,0XA1,
+0X01,0X08,0XE2,0X08,0XA2,0X80,0X08,0X81,0X02,0X08,0XA2,0X08,0X82,0X08,0X81,0X81,
+0X00,0X81,0XA4,0X00,0X61,0X00,0X08,0XA2,0X80,0X08,0XE2,0X01,0X08,0XC2,0X00,0X81,
+0XB1,0X00,0X61,0X02,0X08,0X61,0X08,0XC2,0X09,0X83,0X80,0X11,0XE3,0X01,0X1A,0X44,
+0X1B,0X27,0X80,0X1A,0X44,0X20,0X1A,0X85,0X1A,0XC6,0X1A,0X65,0X12,0X24,0X1A,0XA5,
+0X1A,0XC5,0X11,0XC3,0X11,0XA2,0X12,0X03,0X11,0XE3,0X11,0XA3,0X09,0X83,0X11,0XA3,
+0X11,0XE3,0X1A,0X43,0X1A,0X64,0X12,0X03,0X11,0XA3,0X1A,0X44,0X1A,0X64,0X1A,0X44,
+0X1A,0X64,0X1A,0XA5,0X1A,0X44,0X11,0XE3,0X11,0XC2,0X1A,0X64,0X1A,0X84,0X11,0XE3,
+0X11,0XC3,0X11,0XA2,0X1A,0X03,0X11,0X83,0X80,0X08,0X81,0X09,0X11,0X42,0X2B,0XC6,
+0X24,0X8B,0X24,0XCD,0X2D,0X0E,0X35,0X4F,0X2D,0X2E,0X24,0XCD,0X3D,0X0D,0X55,0X6E,
+0X80,0X55,0X4B,0X14,0X65,0X8D,0X6D,0XAE,0X5D,0X6C,0X44,0XA8,0X34,0X67,0X2C,0XCB,
+0X3D,0X0C,0X45,0X0B,0X3C,0X66,0X44,0X66,0X3C,0X88,0X3C,0XA9,0X4D,0X0B,0X55,0X6E,
+0X4D,0X6E,0X2C,0X6A,0X1A,0XC5,0X1A,0X44,0X1A,0X64,0X1A,0XE6,0X1B,0X69,0X80,0X13,
+0X29,0X1E,0X13,0X6A,0X13,0X08,0X12,0XC6,0X13,0X8B,0X0C,0X0D,0X13,0XED,0X13,0XCB,
+0X24,0X4A,0X4C,0XE9,0X5C,0XE6,0X5C,0XC5,0X44,0X25,0X23,0X04,0X22,0X83,0X22,0XA3,
+0X33,0XA5,0X33,0X63,0X55,0X09,0X65,0X4A,0X54,0XE8,0X44,0X65,0X2B,0X03,0X2B,0X04,
+0X2C,0X28,0X2C,0X49,0X34,0X89,0X35,0X2E,0X45,0X90,0X3C,0XCC,0X2B,0XA6,0X2C,0X29,
+0X80,0X2C,0XED,0X11,0X24,0XAB,0X2C,0X27,0X34,0X06,0X3C,0X67,0X34,0X67,0X33,0XC5,
+0X33,0X63,0X33,0X43,0X33,0XC5,0X3C,0X88,0X3C,0XEB,0X34,0X89,0X2B,0XC6,0X2B,0X65,
+0X33,0X64,0X33,0XA3,0X3B,0XC3,0X44,0X03,0X80,0X3B,0XE4,0X0C,0X3C,0X05,0X3C,0X04,
+0X4C,0X85,0X5D,0X29,0X65,0X6C,0X5D,0X4B,0X44,0XC9,0X44,0X46,0X54,0XC8,0X65,0X6B,
+0X4D,0X2A,0X22,0X84,0X08,0XA2,0X80,0X00,0X81,0X04,0X08,0X82,0X11,0X22,0X2B,0XE7,
+0X4D,0X2D,0X5D,0X8F,0X81,0X65,0XB0,0X03,0X6D,0XD1,0X55,0X8F,0X45,0X0A,0X3C,0XA8,
+0X80,0X34,0XC9,0X0B,0X34,0X47,0X3C,0X67,0X3C,0XA7,0X3C,0X67,0X3C,0X87,0X4D,0X09,
+0X5D,0X6C,0X5D,0X6B,0X45,0X0A,0X35,0X0B,0X24,0XCC,0X24,0XCD,0X81,0X24,0XAC,0X0D,
+0X1C,0XCD,0X24,0XAC,0X24,0X4A,0X2B,0XE7,0X2B,0X85,0X2B,0XA5,0X23,0X45,0X23,0X66,
+0X1B,0XA8,0X1B,0XEA,0X1B,0XAA,0X1B,0XCA,0X1B,0XEA,0X1B,0XA9,0X80,0X23,0X46,0X06,
+0X23,0XC9,0X1C,0X2A,0X1C,0X6C,0X1C,0XCE,0X1C,0XAD,0X24,0X09,0X1B,0X26,0X82,0X08,
+0XE2,0X02,0X08,0XC2,0X08,0XE2,0X09,0X02,0X80,0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,
+0XE2,0X80,0X08,0XC2,0X05,0X08,0XA1,0X08,0X81,0X08,0XA1,0X08,0XE2,0X08,0XA2,0X08,
+0X81,0X81,0X08,0XA2,0X80,0X08,0X81,0X00,0X00,0X82,0XA5,0X00,0X61,0X03,0X08,0X81,
+0X09,0X02,0X09,0X43,0X08,0XC2,0XA9,0X00,0X61,0X00,0X08,0X82,0X86,0X00,0X61,0X0A,
+0X08,0X62,0X08,0XE2,0X09,0XA3,0X11,0XE3,0X1A,0X23,0X1A,0X64,0X1A,0XA5,0X1A,0X65,
+0X1A,0X84,0X1A,0XA5,0X12,0X44,0X80,0X1A,0XA5,0X01,0X1A,0XC5,0X1A,0XE6,0X80,0X1A,
+0X84,0X0C,0X1A,0XC5,0X1A,0X85,0X12,0X24,0X11,0XC3,0X11,0XE4,0X12,0X03,0X1A,0X43,
+0X1A,0X84,0X1A,0XA5,0X1A,0X24,0X11,0XE3,0X1A,0X64,0X1A,0XE6,0X80,0X1A,0XA5,0X00,
+0X11,0XE3,0X80,0X11,0X82,0X24,0X11,0XE3,0X1A,0X44,0X1A,0X23,0X11,0XC3,0X11,0XA2,
+0X1A,0X23,0X11,0XE3,0X08,0XE2,0X08,0X81,0X1A,0X04,0X2C,0X49,0X24,0X8C,0X24,0XED,
+0X2D,0X2E,0X2D,0X2F,0X2D,0X4F,0X35,0X2E,0X4D,0X4E,0X55,0X6E,0X44,0XE9,0X55,0X4B,
+0X6D,0XCF,0X75,0XD0,0X6D,0XAE,0X55,0X2A,0X3C,0X46,0X2C,0X49,0X3D,0X0D,0X3C,0XEB,
+0X44,0XCA,0X4C,0XEA,0X4D,0X2C,0X55,0X6E,0X55,0X4D,0X4D,0X2C,0X34,0XAA,0X22,0XE4,
+0X80,0X11,0XC3,0X34,0X1A,0X24,0X1A,0X64,0X1A,0XC6,0X13,0X08,0X12,0XE8,0X12,0X86,
+0X12,0X45,0X12,0X04,0X12,0XA7,0X12,0XE8,0X13,0X4A,0X0B,0XCD,0X1B,0XEB,0X34,0X68,
+0X54,0XE8,0X5C,0XE6,0X44,0X66,0X23,0X25,0X22,0XE5,0X22,0XA4,0X22,0XE3,0X2B,0X03,
+0X3C,0X27,0X55,0X0A,0X4C,0XE9,0X3C,0X67,0X2B,0X85,0X2C,0X29,0X34,0X8B,0X2C,0X29,
+0X2B,0X65,0X34,0X27,0X35,0X0B,0X34,0XCA,0X34,0X26,0X2B,0X65,0X2C,0X6A,0X2C,0XAB,
+0X2C,0X29,0X3C,0X68,0X44,0XA8,0X3C,0X88,0X2C,0X06,0X2B,0X64,0X2B,0X44,0X33,0X63,
+0X33,0XC5,0X34,0X27,0X2C,0X49,0X2B,0XE7,0X2B,0X85,0X33,0XA5,0X3B,0XC4,0X82,0X3B,
+0XE3,0X0E,0X3B,0XE4,0X33,0XA5,0X3B,0XE4,0X4C,0X64,0X5C,0XE7,0X5D,0X4A,0X55,0X09,
+0X44,0X67,0X44,0X46,0X5C,0XE8,0X65,0X6A,0X4C,0XC8,0X1A,0X43,0X08,0X81,0X08,0X61,
+0X80,0X00,0X61,0X0E,0X08,0XA1,0X1A,0X64,0X2C,0X6A,0X3C,0XEC,0X4C,0XEB,0X4D,0X0B,
+0X55,0X4D,0X5D,0X8F,0X5D,0X6D,0X4D,0X2B,0X44,0XEA,0X3D,0X0B,0X34,0XEA,0X34,0X88,
+0X3C,0X86,0X80,0X3C,0X66,0X14,0X44,0X86,0X4C,0XC7,0X4C,0XE8,0X4D,0X09,0X4D,0X0A,
+0X3D,0X0B,0X2C,0XEC,0X24,0XCD,0X24,0XEE,0X24,0XED,0X24,0XEE,0X25,0X0E,0X1C,0XEE,
+0X1C,0XAC,0X24,0X4A,0X2C,0X08,0X2B,0X86,0X23,0X45,0X23,0X25,0X23,0X67,0X1B,0XEA,
+0X80,0X1B,0XCA,0X0C,0X1B,0XA9,0X1B,0X88,0X23,0XC7,0X23,0X86,0X23,0X46,0X23,0XC8,
+0X1C,0X2B,0X1C,0X6C,0X1C,0X8D,0X1C,0X6C,0X1C,0X0A,0X08,0XE2,0X08,0XE1,0X80,0X08,
+0XE2,0X04,0X08,0XC1,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XA1,0X80,0X08,0XC1,0X00,
+0X08,0XC2,0X80,0X08,0XE2,0X03,0X08,0XA2,0X08,0XA1,0X08,0X81,0X00,0XE2,0X83,0X08,
+0XA2,0X02,0X08,0X81,0X00,0X81,0X00,0X82,0XA5,0X00,0X61,0X04,0X08,0X81,0X09,0X22,
+0X09,0X83,0X08,0XE2,0X08,0X61,0XA8,0X00,0X61,0X00,0X08,0X82,0X86,0X00,0X61,0X05,
+0X08,0X61,0X08,0XE2,0X11,0X82,0X11,0XE3,0X1A,0X24,0X1A,0XA5,0X80,0X1A,0XE6,0X06,
+0X1A,0XC6,0X1A,0XA6,0X1A,0X85,0X1A,0X84,0X1A,0X64,0X1A,0XA5,0X1A,0XE5,0X81,0X1A,
+0XC5,0X04,0X1A,0X65,0X12,0X25,0X11,0XE3,0X11,0XC3,0X11,0XE3,0X80,0X1A,0X23,0X0A,
+0X1A,0XE5,0X1A,0XC5,0X1A,0X44,0X1A,0X03,0X1A,0X64,0X1A,0XC5,0X1A,0XE5,0X1A,0X64,
+0X11,0XC2,0X11,0XE3,0X1A,0X44,0X81,0X1A,0X03,0X39,0X11,0X82,0X11,0XA3,0X11,0XC3,
+0X08,0XE2,0X11,0X22,0X22,0XE6,0X23,0XA8,0X24,0XCD,0X25,0X0E,0X2D,0X2E,0X25,0X0E,
+0X2D,0X4F,0X3D,0X4F,0X55,0X6E,0X4D,0X6E,0X3C,0X88,0X44,0XA7,0X5D,0X6B,0X65,0X6B,
+0X5D,0X2A,0X4C,0XE8,0X3C,0X25,0X34,0X8A,0X45,0X4F,0X45,0X0C,0X55,0X6C,0X55,0X4C,
+0X4D,0X4D,0X55,0X4E,0X55,0X4D,0X45,0X0B,0X23,0X46,0X11,0XA2,0X09,0X62,0X11,0X62,
+0X11,0XC3,0X1A,0X24,0X12,0X04,0X1A,0X85,0X12,0XC6,0X12,0X86,0X12,0X05,0X11,0XC4,
+0X12,0X46,0X12,0X25,0X0A,0X05,0X13,0X09,0X12,0X86,0X23,0X26,0X3C,0X89,0X5D,0X6B,
+0X44,0XA8,0X23,0X25,0X1A,0XC5,0X23,0X05,0X22,0XE5,0X23,0X25,0X2B,0XA7,0X80,0X34,
+0X6A,0X80,0X2C,0X49,0X11,0X2C,0XAB,0X45,0X4F,0X3C,0XED,0X23,0X06,0X2B,0X44,0X44,
+0XA7,0X3C,0X86,0X33,0XE5,0X2B,0X66,0X2C,0X4A,0X2C,0X49,0X33,0XE8,0X44,0X6A,0X44,
+0XA9,0X34,0X89,0X34,0X27,0X33,0XC6,0X2B,0XC5,0X80,0X2B,0XC6,0X05,0X2B,0XE7,0X2B,
+0XC7,0X2B,0XA6,0X2B,0XE6,0X33,0XC5,0X3C,0X05,0X80,0X3C,0X24,0X0A,0X3C,0X04,0X34,
+0X46,0X33,0XC5,0X2B,0X44,0X43,0XE4,0X5C,0XA3,0X5C,0XE5,0X55,0X29,0X4C,0XE9,0X4C,
+0X67,0X54,0XC7,0X80,0X65,0X4A,0X02,0X3C,0X06,0X19,0X82,0X08,0X81,0X81,0X00,0X61,
+0X08,0X08,0X81,0X09,0X02,0X1A,0X85,0X2B,0X66,0X33,0XE5,0X3C,0X46,0X3C,0XC9,0X45,
+0X0B,0X4D,0X2B,0X80,0X4D,0X0B,0X03,0X4D,0X2C,0X3C,0XEA,0X34,0XA8,0X3C,0X87,0X81,
+0X3C,0X45,0X05,0X44,0X65,0X44,0XA6,0X44,0XA7,0X44,0XE9,0X45,0X2B,0X2C,0XEC,0X80,
+0X24,0XCD,0X1B,0X24,0XED,0X2D,0X4F,0X35,0X50,0X2D,0X4F,0X2D,0X2F,0X25,0X0E,0X24,
+0XAB,0X24,0X29,0X23,0X86,0X23,0X25,0X23,0X26,0X1B,0X68,0X1B,0XCA,0X1B,0XA9,0X1B,
+0X47,0X23,0XA7,0X2C,0X69,0X2B,0XC7,0X23,0X05,0X23,0XE8,0X1C,0X4C,0X1C,0X6D,0X14,
+0X6D,0X1C,0X4D,0X1B,0XEB,0X08,0XE1,0X08,0XC2,0X08,0XC1,0X80,0X08,0XC2,0X05,0X08,
+0XC1,0X08,0XE2,0X08,0XC2,0X08,0XC1,0X08,0XA1,0X08,0XC1,0X80,0X08,0XE2,0X04,0X09,
+0X02,0X08,0XC2,0X08,0XA1,0X08,0X81,0X08,0XC2,0X80,0X08,0XA2,0X81,0X08,0XA1,0X80,
+0X08,0X81,0X00,0X08,0X82,0XA5,0X00,0X61,0X03,0X08,0X81,0X08,0XE2,0X09,0X22,0X08,
+0XE2,0XB3,0X00,0X61,0X01,0X09,0X42,0X1A,0X43,0X80,0X23,0X26,0X06,0X1A,0XA4,0X1A,
+0XC5,0X1A,0XE6,0X1B,0X27,0X1B,0XAA,0X1B,0X28,0X1A,0X85,0X80,0X11,0XE3,0X01,0X12,
+0X03,0X1A,0X44,0X80,0X1A,0XA5,0X0E,0X12,0X24,0X11,0XE4,0X11,0XE3,0X12,0X03,0X1A,
+0X23,0X19,0XE2,0X11,0XA2,0X1A,0X44,0X1A,0XE6,0X1A,0XA5,0X1A,0X23,0X12,0X03,0X1A,
+0X84,0X1A,0XC5,0X22,0XC5,0X80,0X1A,0XA4,0X23,0X1A,0X84,0X1A,0X64,0X19,0XE3,0X11,
+0X82,0X09,0X82,0X11,0X62,0X11,0X42,0X08,0XA1,0X11,0X63,0X1A,0X85,0X24,0X4B,0X2D,
+0X2F,0X2D,0X4F,0X2D,0X2F,0X25,0X0E,0X2D,0X50,0X2D,0X2E,0X45,0X2D,0X4D,0X4E,0X3C,
+0XAA,0X33,0XE5,0X4C,0X86,0X5D,0X29,0X55,0X08,0X44,0X66,0X33,0XE6,0X45,0X2D,0X55,
+0X8F,0X55,0X2C,0X55,0X2B,0X5D,0X6C,0X5D,0X8E,0X5D,0X8F,0X55,0X8F,0X44,0XAA,0X1A,
+0X84,0X81,0X09,0X22,0X2B,0X11,0X83,0X12,0X03,0X11,0XA3,0X11,0XE4,0X12,0X45,0X12,
+0X86,0X12,0X66,0X12,0X05,0X09,0XA3,0X09,0X84,0X12,0X46,0X12,0XC7,0X12,0X25,0X12,
+0X46,0X23,0X67,0X5D,0X8F,0X4D,0X4D,0X33,0XE6,0X23,0X04,0X23,0X05,0X23,0X25,0X23,
+0X86,0X23,0XC8,0X24,0X09,0X34,0X6B,0X34,0XAC,0X2C,0X4A,0X2C,0X8A,0X3D,0X0E,0X45,
+0X90,0X2C,0X8D,0X1A,0XA5,0X22,0XA3,0X2B,0X04,0X23,0X26,0X24,0X2A,0X24,0X4A,0X2C,
+0X6A,0X3C,0X6A,0X3C,0X08,0X3C,0X28,0X34,0X68,0X34,0X67,0X33,0XE6,0X80,0X2B,0XC6,
+0X80,0X2B,0XA6,0X03,0X2B,0XC7,0X2C,0X27,0X2C,0X06,0X33,0XE5,0X81,0X3C,0X46,0X0E,
+0X34,0X88,0X2C,0X89,0X23,0X25,0X22,0XC3,0X44,0X25,0X5D,0X07,0X5D,0X08,0X4C,0XE9,
+0X4D,0X09,0X4C,0X67,0X5D,0X08,0X6D,0X8C,0X65,0X29,0X33,0X24,0X10,0XC2,0X80,0X00,
+0X81,0X81,0X00,0X61,0X05,0X08,0X61,0X08,0XE2,0X11,0XC3,0X2A,0XE3,0X33,0XA4,0X3C,
+0X25,0X80,0X3C,0X87,0X06,0X3C,0XA8,0X44,0XEA,0X4D,0X2B,0X4D,0X0B,0X44,0XE9,0X3C,
+0XA7,0X3C,0X45,0X80,0X3C,0X25,0X21,0X44,0X24,0X44,0X44,0X44,0X85,0X4D,0X09,0X4D,
+0X2C,0X35,0X0D,0X24,0XED,0X24,0XCC,0X24,0XAB,0X2D,0X0E,0X35,0X6F,0X3D,0X90,0X3D,
+0X70,0X3D,0X6F,0X35,0X4E,0X24,0XCC,0X2C,0X49,0X23,0X87,0X23,0X26,0X1B,0X06,0X1B,
+0X88,0X1B,0X89,0X1A,0XC5,0X23,0X25,0X2B,0XC6,0X2B,0X45,0X23,0X25,0X23,0XE9,0X1C,
+0X2B,0X1C,0X6D,0X14,0X6E,0X14,0X4D,0X1C,0X0B,0X08,0XE2,0X80,0X08,0XC1,0X0F,0X08,
+0XA1,0X08,0XC1,0X08,0XA1,0X08,0XC2,0X08,0XE2,0X08,0XE1,0X08,0XC2,0X08,0XE2,0X09,
+0X02,0X08,0XE2,0X09,0X43,0X09,0X02,0X08,0XA1,0X08,0X81,0X08,0XC2,0X08,0XA1,0X80,
+0X08,0XA2,0X03,0X08,0XA1,0X08,0X82,0X08,0X81,0X00,0X81,0XA7,0X00,0X61,0X03,0X08,
+0XC1,0X09,0X02,0X08,0XC1,0X00,0X81,0XA8,0X00,0X61,0X05,0X00,0X62,0X00,0X61,0X08,
+0X82,0X00,0X61,0X08,0X82,0X08,0X81,0X81,0X00,0X61,0X0D,0X08,0X81,0X11,0X62,0X22,
+0X63,0X2B,0X24,0X23,0X04,0X1A,0X63,0X1A,0X64,0X1B,0X06,0X12,0XE6,0X1B,0X28,0X1B,
+0X06,0X1A,0XE5,0X1A,0X84,0X11,0XE3,0X80,0X11,0XC2,0X80,0X12,0X03,0X08,0X11,0XA3,
+0X1A,0XA6,0X12,0X65,0X1A,0X24,0X22,0X83,0X11,0XC2,0X1A,0X23,0X1A,0X64,0X1A,0XE5,
+0X80,0X1A,0X84,0X09,0X1A,0X64,0X1A,0X03,0X1A,0X64,0X1A,0X44,0X1A,0XC5,0X22,0XE5,
+0X1A,0X24,0X1A,0X64,0X1A,0X23,0X11,0X62,0X80,0X09,0X42,0X3A,0X09,0X22,0X08,0X81,
+0X11,0X22,0X23,0X06,0X24,0XAB,0X35,0X70,0X3D,0X90,0X2D,0X2E,0X24,0XED,0X24,0XEE,
+0X24,0XED,0X3D,0X0C,0X55,0X6E,0X45,0X2D,0X2C,0X48,0X33,0XA5,0X33,0XA4,0X33,0X64,
+0X2B,0X24,0X2C,0X49,0X4D,0X6F,0X55,0X8F,0X5D,0XAF,0X55,0X4E,0X5D,0X8E,0X5D,0X8F,
+0X6D,0XD0,0X55,0X6E,0X2B,0X86,0X12,0X24,0X09,0X83,0X09,0X22,0X09,0X02,0X09,0X22,
+0X11,0XC3,0X12,0X04,0X11,0XA3,0X09,0X63,0X11,0XE4,0X12,0X86,0X12,0X26,0X11,0XC4,
+0X09,0XA4,0X09,0X64,0X09,0XC5,0X0A,0XA8,0X0B,0X2A,0X12,0XA7,0X34,0X4A,0X4D,0X2C,
+0X3C,0X88,0X34,0X07,0X2B,0X86,0X23,0X46,0X23,0X25,0X23,0XC7,0X23,0X87,0X23,0XE8,
+0X2C,0X6A,0X80,0X3D,0X0D,0X17,0X34,0XCC,0X2C,0XCD,0X2C,0XEE,0X2C,0XAC,0X24,0X2A,
+0X23,0XC8,0X1C,0X2A,0X24,0XCE,0X24,0X8C,0X24,0XAC,0X2D,0X0D,0X34,0X48,0X33,0XE6,
+0X2C,0X07,0X2C,0X06,0X2B,0X85,0X2B,0X65,0X2B,0XA6,0X2B,0XE7,0X2C,0X08,0X2C,0X49,
+0X34,0X27,0X33,0XA5,0X33,0XE5,0X80,0X3C,0X46,0X10,0X34,0X88,0X2C,0XEC,0X24,0X09,
+0X11,0XC3,0X22,0X23,0X4C,0XA7,0X65,0X6B,0X65,0X8B,0X55,0X0A,0X44,0XC9,0X4C,0X67,
+0X65,0X28,0X65,0X49,0X4C,0X66,0X21,0XE2,0X08,0X82,0X08,0X81,0X83,0X00,0X61,0X0E,
+0X08,0X61,0X08,0XE2,0X19,0XC2,0X2A,0XE3,0X33,0XA3,0X3C,0X04,0X3C,0X25,0X3C,0X66,
+0X44,0XC8,0X55,0X2B,0X55,0X6C,0X4D,0X2A,0X44,0X88,0X3C,0X66,0X3C,0X25,0X81,0X3C,
+0X45,0X03,0X44,0X86,0X4C,0XE9,0X55,0X4D,0X3D,0X2E,0X80,0X24,0XCD,0X12,0X24,0XCC,
+0X24,0XCD,0X2D,0X0E,0X3D,0X6F,0X45,0X90,0X4D,0XB1,0X55,0X90,0X3D,0X4F,0X24,0XAB,
+0X23,0XE8,0X23,0X47,0X1B,0X05,0X1B,0X07,0X1B,0X89,0X1B,0X27,0X1A,0X64,0X1A,0X83,
+0X22,0XC4,0X23,0X66,0X80,0X1B,0XC9,0X00,0X1C,0X2C,0X80,0X1C,0X4D,0X02,0X1C,0X0B,
+0X08,0XE2,0X08,0XC2,0X80,0X08,0XC1,0X81,0X08,0XA1,0X00,0X08,0XC1,0X81,0X08,0XC2,
+0X03,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X80,0X08,0X81,0X00,0X08,0XC2,0X80,
+0X08,0XA2,0X81,0X08,0XA1,0X01,0X00,0XA2,0X08,0X82,0XA7,0X00,0X61,0X00,0X08,0X81,
+0X80,0X08,0XA2,0XA9,0X00,0X61,0X03,0X08,0X82,0X00,0X82,0X00,0X61,0X00,0X62,0X82,
+0X00,0X61,0X80,0X08,0X81,0X02,0X09,0X02,0X11,0XA2,0X19,0XE2,0X80,0X1A,0X43,0X09,
+0X1A,0X85,0X1B,0X06,0X1B,0X89,0X1B,0X88,0X11,0XE3,0X12,0X03,0X1A,0XA5,0X22,0XC5,
+0X1A,0XA5,0X1A,0X44,0X80,0X11,0XE3,0X00,0X11,0XE4,0X80,0X12,0X24,0X1A,0X1A,0X03,
+0X22,0X63,0X1A,0X43,0X1A,0XC5,0X23,0X26,0X1A,0XC6,0X1B,0X06,0X1A,0XE6,0X1A,0XC5,
+0X1A,0X23,0X19,0XC2,0X1A,0X03,0X1A,0X84,0X1B,0X06,0X22,0XE5,0X1A,0X03,0X11,0XA2,
+0X11,0X62,0X09,0X42,0X09,0X22,0X09,0X02,0X08,0X81,0X08,0XC1,0X23,0X05,0X2C,0XCC,
+0X2D,0X0E,0X3D,0X70,0X80,0X35,0X70,0X0F,0X24,0XED,0X2C,0XAB,0X45,0X2D,0X55,0X8F,
+0X5D,0X8F,0X4D,0X6D,0X34,0XCB,0X34,0X89,0X2B,0XC7,0X2C,0X29,0X2C,0XAB,0X45,0X2D,
+0X55,0X8F,0X5D,0X8F,0X65,0XD0,0X6D,0XD0,0X80,0X6D,0XD1,0X03,0X44,0XAB,0X1A,0X03,
+0X09,0XA4,0X09,0X83,0X80,0X09,0X42,0X10,0X09,0X02,0X09,0X22,0X09,0X62,0X09,0XA3,
+0X11,0XA3,0X11,0XA4,0X12,0X04,0X12,0X66,0X12,0X87,0X12,0X05,0X0A,0X87,0X0B,0X4B,
+0X0B,0X8D,0X0B,0X6C,0X0A,0X06,0X1A,0X44,0X34,0X08,0X80,0X3C,0XA8,0X0E,0X2B,0XE6,
+0X23,0X86,0X23,0X25,0X23,0X87,0X24,0X09,0X23,0XE9,0X23,0X66,0X3C,0X49,0X3D,0X0E,
+0X34,0XAB,0X24,0X8B,0X24,0X8C,0X24,0X8B,0X25,0X0E,0X24,0XAC,0X80,0X1C,0X4B,0X04,
+0X24,0X6B,0X24,0X8B,0X1C,0XAD,0X2C,0X6A,0X33,0XE6,0X81,0X2B,0XE7,0X0F,0X2C,0X07,
+0X2C,0X69,0X2C,0XAA,0X2C,0X89,0X2C,0X48,0X33,0XE5,0X33,0XC5,0X34,0X26,0X34,0X05,
+0X34,0X27,0X2C,0XAA,0X2C,0XAB,0X1A,0XE5,0X08,0XC2,0X22,0X02,0X4C,0X86,0X80,0X65,
+0X6B,0X08,0X4C,0XEA,0X3C,0XA8,0X44,0XA7,0X54,0XE7,0X54,0XC7,0X2B,0X03,0X11,0X01,
+0X00,0X61,0X08,0X61,0X84,0X00,0X61,0X33,0X08,0X61,0X08,0XC2,0X19,0XC2,0X2B,0X02,
+0X3B,0X83,0X3B,0XE3,0X44,0X65,0X4C,0X87,0X54,0XEB,0X5D,0X4C,0X55,0X2B,0X4D,0X0A,
+0X45,0X0B,0X34,0XCA,0X34,0X68,0X34,0X46,0X3C,0X45,0X3C,0X25,0X4C,0XEA,0X55,0X8E,
+0X45,0X6E,0X24,0XED,0X24,0XAC,0X24,0XAB,0X24,0XAC,0X2C,0XEC,0X35,0X2E,0X45,0X8F,
+0X4D,0X90,0X5D,0XD1,0X4D,0X6F,0X2C,0XAB,0X23,0XC8,0X23,0X46,0X1A,0XE5,0X22,0XC4,
+0X1B,0X47,0X1B,0XAA,0X1B,0X28,0X1B,0X06,0X1B,0X47,0X23,0X66,0X23,0X87,0X1B,0X88,
+0X1B,0XEB,0X1C,0X4D,0X1C,0X2C,0X1B,0X89,0X08,0X81,0X08,0XA2,0X08,0XA1,0X08,0XC1,
+0X82,0X08,0XA1,0X02,0X08,0XC1,0X08,0XA1,0X08,0XA2,0X80,0X08,0XC2,0X01,0X00,0XC2,
+0X08,0XA2,0X80,0X08,0X81,0X81,0X08,0XA2,0X00,0X08,0XA1,0X80,0X08,0X81,0X01,0X08,
+0XA2,0X08,0X82,0XA7,0X00,0X61,0X02,0X08,0X61,0X00,0X61,0X00,0X81,0XA8,0X00,0X61,
+0X00,0X00,0X82,0X80,0X08,0X82,0X00,0X00,0X62,0X80,0X00,0X61,0X01,0X08,0X82,0X00,
+0X61,0X81,0X08,0X81,0X02,0X11,0X62,0X1A,0X84,0X22,0XE5,0X80,0X23,0X06,0X80,0X23,
+0X26,0X0E,0X1B,0X48,0X1C,0X2B,0X1A,0X85,0X1A,0XA5,0X1B,0X06,0X1A,0X84,0X22,0XC5,
+0X23,0X26,0X1A,0XE5,0X1A,0X44,0X12,0X24,0X12,0X04,0X12,0X03,0X1A,0X22,0X1A,0X43,
+0X80,0X1A,0XC5,0X36,0X23,0X26,0X22,0XC5,0X1A,0X03,0X1A,0XC5,0X1A,0XE5,0X1A,0XC5,
+0X1A,0X64,0X1A,0X43,0X1A,0X84,0X1A,0XA5,0X22,0XE5,0X1A,0XA4,0X1A,0X03,0X11,0X82,
+0X09,0X22,0X09,0X02,0X08,0XE2,0X08,0X81,0X11,0X02,0X2B,0XA6,0X2C,0XCC,0X2C,0XCB,
+0X24,0XCC,0X24,0XED,0X2D,0X2F,0X2D,0X4F,0X24,0X8B,0X2C,0X29,0X45,0X2C,0X5D,0X8E,
+0X4D,0X6E,0X34,0XCA,0X34,0XEB,0X2C,0X49,0X24,0XAB,0X2C,0XEC,0X3D,0X2D,0X55,0X6E,
+0X5D,0X6F,0X65,0XB0,0X6D,0XF1,0X75,0XF2,0X6D,0XD0,0X33,0XA7,0X09,0X22,0X09,0X23,
+0X09,0X63,0X09,0X22,0X09,0X43,0X09,0X42,0X09,0X22,0X09,0X83,0X09,0X63,0X09,0X43,
+0X09,0XA3,0X80,0X11,0XE4,0X21,0X0A,0X04,0X12,0X87,0X0A,0X06,0X0A,0X67,0X0A,0XEA,
+0X0B,0X2B,0X09,0XE5,0X09,0XC4,0X1B,0X07,0X2C,0X69,0X3C,0XA8,0X3C,0X05,0X34,0X06,
+0X33,0XE6,0X23,0XC7,0X23,0XE8,0X24,0X09,0X34,0X6A,0X33,0X45,0X2C,0XAB,0X2C,0X6A,
+0X24,0X6B,0X24,0XAC,0X24,0X8B,0X24,0X29,0X24,0XED,0X24,0XAD,0X1C,0X6C,0X1C,0X6B,
+0X1C,0X8D,0X1C,0XCE,0X3D,0X4F,0X34,0XAA,0X34,0X49,0X80,0X34,0X69,0X00,0X2C,0X69,
+0X80,0X2C,0XAA,0X02,0X2C,0X69,0X2C,0X07,0X34,0X06,0X80,0X34,0X26,0X12,0X33,0XE5,
+0X34,0X88,0X2C,0X89,0X23,0X66,0X11,0X43,0X08,0X61,0X19,0X62,0X3B,0XE5,0X55,0X09,
+0X55,0X2B,0X4C,0XE9,0X44,0XC7,0X44,0XA8,0X45,0X0B,0X34,0X48,0X1A,0X24,0X08,0XA1,
+0X00,0X61,0X08,0X81,0X85,0X00,0X61,0X07,0X08,0X81,0X08,0XE2,0X19,0XC2,0X2A,0XC2,
+0X3B,0XA3,0X3C,0X45,0X44,0XC8,0X5D,0X6D,0X80,0X65,0XAF,0X0F,0X65,0X8F,0X5D,0X90,
+0X45,0X2D,0X34,0XAA,0X34,0XA9,0X34,0X67,0X33,0XE5,0X3C,0XA8,0X4D,0X6D,0X55,0X8F,
+0X2C,0XED,0X1C,0X6B,0X1C,0XAD,0X1C,0XCD,0X2D,0X0E,0X45,0X90,0X80,0X55,0XB1,0X0D,
+0X5D,0XB1,0X4D,0X6F,0X2C,0X6A,0X23,0X66,0X23,0X87,0X23,0X25,0X1A,0X83,0X1A,0XC5,
+0X1B,0X68,0X13,0XAA,0X1B,0XAA,0X1B,0XA9,0X1B,0X47,0X1B,0X88,0X80,0X1B,0XCA,0X04,
+0X1B,0XA9,0X1B,0X47,0X1A,0XA5,0X00,0X61,0X00,0X81,0X80,0X08,0XA1,0X00,0X08,0XA2,
+0X82,0X08,0XA1,0X83,0X08,0XC2,0X82,0X08,0X81,0X81,0X08,0XA1,0X02,0X08,0X81,0X08,
+0XA2,0X00,0XA2,0XD3,0X00,0X61,0X00,0X08,0X82,0X80,0X00,0X62,0X80,0X00,0X61,0X81,
+0X08,0X82,0X00,0X00,0X81,0X82,0X08,0X81,0X02,0X09,0X22,0X1A,0X84,0X1A,0XC4,0X81,
+0X23,0X05,0X00,0X23,0X46,0X80,0X23,0X26,0X0D,0X1A,0XA4,0X22,0XE5,0X23,0X05,0X1A,
+0X63,0X1A,0X83,0X23,0X46,0X1B,0X26,0X1A,0X85,0X12,0X64,0X1A,0X44,0X11,0XC2,0X1A,
+0X23,0X11,0XC2,0X12,0X03,0X80,0X1A,0X64,0X04,0X1A,0X63,0X1A,0X64,0X1A,0X84,0X1A,
+0XA5,0X1A,0XE5,0X80,0X23,0X05,0X0C,0X1A,0X84,0X1A,0X23,0X1A,0X84,0X23,0X05,0X1A,
+0X64,0X11,0X82,0X09,0X22,0X08,0XE2,0X08,0XC2,0X08,0X81,0X19,0X82,0X34,0X27,0X2C,
+0XEC,0X80,0X2C,0XAA,0X0E,0X24,0XAC,0X24,0XCC,0X24,0XED,0X2C,0X49,0X34,0X27,0X3C,
+0XEA,0X4D,0X0B,0X45,0X0B,0X34,0X68,0X34,0X26,0X2C,0X49,0X2C,0XCC,0X2C,0XEC,0X3D,
+0X0C,0X4D,0X4D,0X81,0X65,0XB0,0X0D,0X6D,0XD1,0X55,0X4E,0X22,0X64,0X08,0XA1,0X08,
+0XA2,0X09,0X23,0X09,0X43,0X08,0XE2,0X09,0X02,0X09,0X42,0X09,0X62,0X09,0X63,0X09,
+0X42,0X09,0X63,0X80,0X11,0XE4,0X0A,0X09,0X83,0X09,0XC4,0X0A,0X46,0X0A,0X26,0X09,
+0XA5,0X0A,0X06,0X12,0X26,0X09,0X84,0X12,0X26,0X1B,0X69,0X34,0X48,0X80,0X3C,0X45,
+0X30,0X3C,0X25,0X2C,0X07,0X2C,0X29,0X23,0XE8,0X34,0X8A,0X2B,0XA7,0X34,0X6B,0X34,
+0X6A,0X2C,0X2A,0X24,0X2A,0X24,0XCC,0X24,0X6B,0X24,0XAB,0X24,0XCC,0X24,0XAD,0X1C,
+0X6B,0X1C,0X8D,0X1C,0XCE,0X2D,0X0E,0X3D,0X0D,0X3C,0X8A,0X3C,0X6A,0X34,0X49,0X2C,
+0X69,0X2C,0XAA,0X2C,0X69,0X2C,0X28,0X34,0X27,0X34,0X67,0X34,0X68,0X3C,0X25,0X34,
+0X26,0X3C,0XA7,0X33,0XE6,0X1A,0X03,0X08,0X82,0X00,0X61,0X10,0XC1,0X22,0XA3,0X44,
+0X87,0X4D,0X09,0X4C,0XC8,0X4C,0XA7,0X4C,0XE9,0X3D,0X2B,0X23,0XA7,0X11,0X42,0X08,
+0X81,0X08,0X61,0X87,0X00,0X61,0X18,0X08,0X81,0X08,0XC2,0X19,0X82,0X33,0X03,0X3B,
+0XE5,0X3C,0XC9,0X4D,0X6D,0X65,0X8F,0X65,0XB0,0X6D,0XD1,0X65,0XD1,0X55,0X6F,0X3D,
+0X0C,0X34,0XCA,0X34,0XA9,0X34,0X47,0X34,0X46,0X3C,0XEA,0X45,0X4E,0X2C,0XCC,0X24,
+0X8B,0X1C,0XAD,0X24,0XED,0X35,0X2E,0X45,0X90,0X80,0X55,0XB1,0X18,0X4D,0X91,0X3D,
+0X0D,0X23,0XE8,0X22,0XE5,0X22,0XC5,0X1A,0XC4,0X22,0XC4,0X1A,0XE5,0X1B,0X27,0X1B,
+0XCA,0X13,0XEB,0X1B,0XCA,0X1B,0XA9,0X1B,0XCA,0X1C,0X2B,0X1B,0XEA,0X1B,0X47,0X1A,
+0XC5,0X1A,0X84,0X00,0X61,0X08,0X82,0X00,0X82,0X08,0X81,0X08,0XA1,0X08,0XA2,0X81,
+0X08,0XA1,0X82,0X08,0XA2,0X01,0X08,0XC2,0X08,0XA2,0X82,0X08,0X81,0X02,0X08,0XA1,
+0X08,0X81,0X08,0XA1,0X80,0X08,0XC2,0XD3,0X00,0X61,0X00,0X08,0X82,0X82,0X00,0X61,
+0X80,0X08,0X82,0X02,0X00,0X62,0X08,0X82,0X00,0X61,0X80,0X08,0X81,0X06,0X00,0X81,
+0X08,0XC2,0X12,0X03,0X1A,0X84,0X1A,0XC5,0X22,0XA4,0X22,0XC4,0X80,0X23,0X46,0X0C,
+0X23,0X06,0X23,0X26,0X22,0XC5,0X22,0XE4,0X22,0X83,0X1A,0X63,0X23,0X05,0X1A,0XE5,
+0X12,0X65,0X1A,0X85,0X1A,0XA5,0X1A,0X23,0X1A,0X02,0X80,0X11,0XC2,0X06,0X1A,0X23,
+0X22,0XA4,0X22,0XC5,0X23,0X05,0X1A,0XE6,0X1A,0XE5,0X22,0XC4,0X80,0X1A,0X63,0X0E,
+0X22,0XC4,0X22,0X84,0X1A,0X23,0X22,0XC4,0X1A,0XC4,0X11,0XA2,0X09,0X22,0X09,0X02,
+0X08,0XA2,0X08,0XC1,0X22,0XE5,0X34,0X89,0X2C,0X68,0X2C,0X89,0X2C,0XA9,0X80,0X2C,
+0X69,0X16,0X24,0X29,0X2B,0XE7,0X3C,0X26,0X44,0XEA,0X55,0X6D,0X45,0X2C,0X34,0X48,
+0X2C,0X49,0X34,0XEC,0X2D,0X0C,0X34,0XEC,0X3D,0X0C,0X55,0X8E,0X65,0XAF,0X55,0X6F,
+0X4D,0X0D,0X44,0XCC,0X33,0XA8,0X11,0X42,0X00,0X61,0X00,0X81,0X00,0XC2,0X09,0X23,
+0X83,0X09,0X02,0X1C,0X09,0X22,0X09,0X43,0X09,0X83,0X11,0XC4,0X09,0X42,0X09,0X63,
+0X09,0X84,0X09,0X64,0X09,0X43,0X09,0X03,0X09,0X43,0X09,0X44,0X09,0X23,0X09,0X84,
+0X22,0XE5,0X3C,0X05,0X44,0X65,0X3C,0X46,0X34,0X26,0X2C,0X48,0X2C,0X6A,0X2C,0X8A,
+0X34,0XEC,0X34,0X4A,0X3C,0X8A,0X3C,0X8B,0X2B,0XE8,0X24,0X6A,0X24,0X8B,0X80,0X24,
+0X6A,0X80,0X24,0XCD,0X20,0X1C,0X8D,0X1C,0X8C,0X24,0XAC,0X2C,0XAD,0X34,0X8B,0X34,
+0X6A,0X34,0X29,0X2C,0X49,0X2C,0X6A,0X2C,0X48,0X34,0X27,0X34,0X68,0X2C,0X89,0X34,
+0XA9,0X33,0XE6,0X3C,0X26,0X3C,0X66,0X2B,0X24,0X11,0X22,0X08,0X61,0X00,0X61,0X08,
+0X82,0X19,0XC3,0X3C,0X06,0X4C,0XC8,0X4C,0XA6,0X4C,0X87,0X4C,0XCA,0X34,0XAA,0X1A,
+0X65,0X08,0XA2,0X00,0X61,0X08,0X61,0X88,0X00,0X61,0X1F,0X08,0X61,0X10,0XA1,0X11,
+0X62,0X22,0X43,0X23,0X46,0X2B,0XC8,0X3C,0X29,0X4C,0XCB,0X55,0X4E,0X55,0X8F,0X4D,
+0X6E,0X45,0X6D,0X3D,0X4D,0X34,0XCA,0X34,0X47,0X33,0XE5,0X34,0X68,0X35,0X0C,0X2C,
+0XEC,0X24,0X4B,0X1C,0X8C,0X1C,0XAD,0X24,0XEE,0X35,0X4F,0X45,0X90,0X4D,0XB1,0X35,
+0X2E,0X34,0X88,0X2B,0XA5,0X22,0XE4,0X23,0X05,0X23,0X25,0X80,0X23,0X66,0X0B,0X23,
+0X26,0X1B,0X88,0X1C,0X0B,0X1B,0XCA,0X1B,0XEA,0X1B,0XCA,0X1C,0X0B,0X1B,0XEA,0X1B,
+0X88,0X23,0X67,0X23,0X46,0X08,0X81,0X80,0X00,0X81,0X02,0X08,0X61,0X00,0X61,0X08,
+0X82,0X82,0X08,0XA1,0X80,0X08,0XA2,0X80,0X08,0XA1,0X01,0X08,0XA2,0X08,0X81,0X80,
+0X00,0X81,0X05,0X08,0X81,0X08,0XA1,0X08,0X81,0X08,0XA1,0X08,0XC2,0X00,0XA2,0XCF,
+0X00,0X61,0X02,0X00,0X62,0X00,0X82,0X00,0X62,0X80,0X00,0X61,0X02,0X00,0X62,0X08,
+0X82,0X00,0X82,0X80,0X08,0X82,0X80,0X00,0X82,0X02,0X08,0X82,0X00,0X82,0X08,0X82,
+0X80,0X08,0X81,0X10,0X08,0XA1,0X11,0XC3,0X1A,0XC5,0X1A,0XA4,0X1A,0X63,0X22,0X63,
+0X22,0XE5,0X23,0X86,0X23,0X46,0X23,0X87,0X23,0X66,0X23,0X46,0X23,0X26,0X1A,0X43,
+0X1A,0X84,0X1B,0X05,0X12,0X85,0X80,0X1A,0XA5,0X30,0X22,0XA4,0X1A,0X02,0X11,0XC2,
+0X1A,0X02,0X1A,0X43,0X22,0XA4,0X23,0X05,0X22,0XE5,0X23,0X06,0X23,0X46,0X22,0XC4,
+0X1A,0X63,0X1A,0X02,0X1A,0X43,0X1A,0X63,0X19,0XE2,0X1A,0X03,0X22,0X84,0X1A,0X23,
+0X09,0X62,0X09,0X22,0X08,0XC2,0X11,0XA3,0X34,0X8A,0X35,0X2C,0X34,0X47,0X2C,0XA9,
+0X2C,0X89,0X2C,0X28,0X2C,0X07,0X2B,0XC6,0X2C,0X07,0X3C,0X46,0X4C,0XE8,0X55,0X6B,
+0X4D,0X09,0X2C,0X27,0X2C,0XCC,0X3D,0X2E,0X3D,0X0C,0X3C,0XEC,0X45,0X2D,0X4D,0X6F,
+0X4D,0X4E,0X34,0X69,0X2B,0X46,0X1A,0X64,0X11,0X42,0X08,0X81,0X80,0X00,0X61,0X05,
+0X00,0X82,0X00,0XA2,0X09,0X02,0X09,0X22,0X08,0XE2,0X08,0XC2,0X80,0X08,0XE2,0X03,
+0X09,0X22,0X09,0X43,0X09,0X42,0X09,0X22,0X80,0X09,0X43,0X1F,0X09,0X63,0X09,0XA4,
+0X09,0X64,0X09,0XE5,0X0A,0X47,0X0A,0X27,0X09,0XA5,0X09,0XE4,0X2B,0X45,0X3C,0XC8,
+0X4D,0X0A,0X3C,0X66,0X3C,0X87,0X2C,0XAA,0X2C,0XAB,0X34,0X69,0X34,0X07,0X3C,0X6A,
+0X44,0XAB,0X33,0XE7,0X23,0X86,0X2C,0X28,0X34,0XCB,0X24,0X49,0X35,0X0E,0X3D,0X70,
+0X24,0XEE,0X24,0X8C,0X24,0X6B,0X24,0X4B,0X2C,0XAC,0X34,0X8A,0X80,0X2C,0X28,0X0A,
+0X2C,0X49,0X2C,0X28,0X34,0X47,0X34,0X68,0X34,0XA9,0X34,0X88,0X2B,0XC5,0X33,0XC4,
+0X33,0X84,0X22,0X22,0X08,0XC1,0X80,0X00,0X61,0X09,0X08,0X61,0X11,0X62,0X33,0X84,
+0X3C,0X87,0X44,0X88,0X4C,0XC9,0X44,0XEA,0X23,0XC8,0X11,0X63,0X08,0X61,0X86,0X00,
+0X61,0X00,0X08,0X61,0X82,0X00,0X61,0X80,0X08,0X61,0X1C,0X08,0XA1,0X09,0X02,0X11,
+0X63,0X1A,0X03,0X2B,0X25,0X34,0X07,0X34,0X89,0X3C,0XCA,0X3D,0X0B,0X3D,0X2C,0X34,
+0XCA,0X34,0X67,0X34,0X47,0X2C,0X69,0X2C,0XEC,0X35,0X2C,0X24,0XAC,0X24,0X6B,0X1C,
+0XAD,0X1C,0XCD,0X2D,0X2E,0X3D,0X4F,0X3D,0X6F,0X2C,0XCC,0X3C,0X45,0X33,0X83,0X23,
+0X04,0X23,0X25,0X23,0X86,0X80,0X23,0X46,0X03,0X23,0X05,0X23,0X46,0X1B,0XEA,0X1B,
+0XCA,0X80,0X1B,0XA9,0X80,0X1B,0XA8,0X0B,0X1B,0X67,0X23,0X67,0X23,0X26,0X00,0X61,
+0X08,0X81,0X00,0XA2,0X00,0XC3,0X00,0X82,0X00,0X81,0X08,0XA2,0X08,0XA1,0X08,0XA2,
+0X82,0X08,0XA1,0X00,0X08,0X81,0X80,0X08,0XA2,0X01,0X08,0X81,0X00,0X61,0X81,0X08,
+0X81,0X80,0X08,0XA2,0XCD,0X00,0X61,0X00,0X00,0X62,0X81,0X08,0X82,0X81,0X00,0X61,
+0X00,0X08,0X82,0X80,0X00,0X61,0X80,0X08,0X82,0X00,0X00,0X82,0X80,0X00,0XA2,0X02,
+0X00,0X81,0X00,0X82,0X08,0X82,0X80,0X08,0X81,0X09,0X08,0XA2,0X11,0X83,0X1A,0XC5,
+0X1A,0X84,0X22,0X83,0X22,0XC3,0X23,0X46,0X23,0X87,0X23,0XA7,0X23,0XA8,0X80,0X23,
+0XA7,0X09,0X23,0XC8,0X23,0XA8,0X1A,0X64,0X1A,0X84,0X1A,0X85,0X1A,0XE6,0X1A,0X84,
+0X22,0XC4,0X22,0X64,0X1A,0X63,0X80,0X1A,0X02,0X03,0X1A,0X23,0X1A,0X03,0X22,0X62,
+0X1A,0XA4,0X80,0X23,0X46,0X23,0X23,0X66,0X22,0XC4,0X23,0X25,0X23,0X05,0X1A,0X23,
+0X11,0XC2,0X19,0XE2,0X23,0X67,0X1B,0X06,0X09,0X62,0X08,0XC2,0X1A,0X24,0X2C,0XAB,
+0X34,0XCA,0X2C,0XA9,0X2C,0XCB,0X2C,0X49,0X2C,0X08,0X2C,0X28,0X2B,0X44,0X2B,0XA6,
+0X34,0XA9,0X3C,0X67,0X3C,0X46,0X34,0X06,0X2C,0X08,0X2D,0X0E,0X45,0X2E,0X44,0XEB,
+0X4D,0X0C,0X45,0X0C,0X34,0XAA,0X34,0X07,0X22,0XC3,0X19,0X82,0X10,0XE1,0X81,0X08,
+0X81,0X81,0X00,0X61,0X02,0X08,0XA2,0X08,0XE2,0X09,0X02,0X80,0X08,0XE2,0X01,0X08,
+0XC1,0X08,0XE2,0X82,0X09,0X02,0X80,0X09,0X43,0X00,0X09,0X84,0X80,0X09,0XE5,0X14,
+0X09,0X85,0X0A,0XEA,0X0B,0X4C,0X0A,0XEA,0X12,0XA7,0X23,0X25,0X4D,0X09,0X54,0XE8,
+0X44,0XC8,0X3C,0XA8,0X2C,0XAA,0X2C,0X8B,0X2C,0X28,0X3C,0X8A,0X44,0XAB,0X3C,0X48,
+0X33,0X85,0X2B,0X24,0X2B,0XA6,0X24,0X08,0X2C,0XED,0X80,0X35,0X4F,0X11,0X24,0XEE,
+0X1C,0X8C,0X1C,0X6C,0X24,0XAC,0X2C,0X8A,0X2C,0X49,0X24,0X29,0X2C,0X48,0X34,0X06,
+0X34,0X47,0X34,0X68,0X34,0X89,0X2C,0X69,0X2B,0XC5,0X2B,0X43,0X22,0X62,0X11,0X22,
+0X08,0X81,0X80,0X00,0X61,0X08,0X08,0X61,0X11,0X02,0X2A,0XE3,0X3C,0X26,0X44,0XCA,
+0X4D,0X2D,0X3C,0XCB,0X1A,0XE6,0X08,0XC2,0X90,0X00,0X61,0X0A,0X08,0X81,0X08,0XA2,
+0X11,0X22,0X19,0XC3,0X22,0XA4,0X2B,0X25,0X33,0XC6,0X34,0X68,0X34,0XA8,0X34,0XEA,
+0X34,0XEC,0X80,0X35,0X0D,0X0D,0X2C,0XEC,0X24,0XCC,0X24,0X6B,0X1C,0X6C,0X1C,0XCE,
+0X2D,0X2F,0X3D,0X4F,0X35,0X4F,0X2C,0XCC,0X3C,0X45,0X3B,0XA3,0X2B,0X04,0X22,0XE4,
+0X23,0X25,0X80,0X22,0XE5,0X02,0X1A,0XA4,0X22,0XE5,0X1B,0X88,0X80,0X1B,0XA9,0X07,
+0X1B,0X68,0X23,0X46,0X1B,0X47,0X1B,0X26,0X23,0X46,0X23,0X05,0X00,0XE3,0X00,0X82,
+0X80,0X00,0XC3,0X03,0X00,0X82,0X08,0X82,0X00,0X82,0X08,0XA2,0X80,0X08,0XC2,0X01,
+0X08,0XA2,0X08,0XA1,0X82,0X08,0XA2,0X00,0X08,0X81,0X80,0X00,0X61,0X02,0X08,0XA1,
+0X00,0XA1,0X08,0XA2,0XCD,0X00,0X61,0X80,0X00,0X81,0X80,0X08,0X82,0X03,0X00,0X61,
+0X08,0X82,0X00,0X62,0X00,0X82,0X81,0X08,0X82,0X00,0X00,0X82,0X83,0X00,0XA2,0X01,
+0X08,0XA2,0X08,0X82,0X81,0X08,0X81,0X08,0X09,0X22,0X23,0X05,0X22,0XE5,0X23,0X25,
+0X2B,0XC7,0X23,0X87,0X23,0XA7,0X23,0X66,0X23,0XA7,0X80,0X23,0X87,0X12,0X23,0X67,
+0X24,0X09,0X1A,0X64,0X1A,0X84,0X1A,0XA5,0X1A,0XE5,0X23,0X45,0X23,0X25,0X1B,0X68,
+0X23,0XA8,0X23,0X46,0X23,0X45,0X22,0XE4,0X22,0X42,0X22,0X43,0X1A,0X03,0X1B,0X05,
+0X23,0X67,0X1A,0X64,0X81,0X23,0X46,0X03,0X22,0XC4,0X1A,0X84,0X19,0XE2,0X12,0X24,
+0X80,0X12,0X45,0X01,0X09,0X22,0X1A,0XA5,0X80,0X2C,0XAA,0X18,0X2C,0XEC,0X2D,0X0E,
+0X24,0X8B,0X24,0X08,0X2B,0XC6,0X22,0XA3,0X23,0X04,0X34,0XEB,0X3D,0X2D,0X2C,0XA9,
+0X2C,0X49,0X2C,0XCC,0X3D,0X4E,0X4D,0X4D,0X55,0X6F,0X5D,0X8F,0X4D,0X2C,0X33,0XC6,
+0X2A,0XA2,0X11,0X82,0X08,0XC2,0X00,0X81,0X00,0X61,0X00,0X81,0X08,0X61,0X80,0X00,
+0X61,0X07,0X08,0X61,0X00,0X61,0X08,0X81,0X08,0XC2,0X09,0X22,0X11,0XA3,0X09,0XC5,
+0X09,0X84,0X80,0X09,0X02,0X05,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X22,
+0X09,0X63,0X80,0X09,0X03,0X01,0X09,0X85,0X02,0X89,0X80,0X0A,0XEA,0X22,0X1A,0X45,
+0X34,0X08,0X55,0X6D,0X5D,0X6C,0X44,0XA8,0X34,0X68,0X2C,0XCB,0X2C,0XCC,0X3C,0XA9,
+0X4D,0X0B,0X44,0XEB,0X33,0XC6,0X22,0XA3,0X23,0XC8,0X24,0X8B,0X1C,0X8C,0X24,0XCC,
+0X2C,0XED,0X25,0X0E,0X1C,0XCE,0X1C,0XAD,0X1C,0X2A,0X23,0XC7,0X2C,0X28,0X2C,0X48,
+0X33,0XC5,0X34,0X07,0X3C,0X88,0X34,0X88,0X34,0X89,0X2C,0X89,0X2C,0X07,0X2B,0X24,
+0X11,0XA2,0X08,0X82,0X82,0X00,0X61,0X07,0X08,0XC1,0X22,0X63,0X3C,0X05,0X3C,0XCA,
+0X45,0X4E,0X2C,0X8A,0X12,0X05,0X08,0X61,0X92,0X00,0X61,0X80,0X08,0X61,0X1B,0X08,
+0XC2,0X11,0X22,0X1A,0X23,0X2B,0X65,0X34,0X88,0X35,0X2C,0X45,0X6F,0X45,0X4E,0X3D,
+0X2D,0X2C,0XCC,0X24,0XAB,0X24,0X8A,0X24,0X6A,0X24,0XAC,0X25,0X0E,0X3D,0X6F,0X45,
+0X90,0X35,0X4E,0X34,0X88,0X3B,0XE4,0X33,0X63,0X23,0X25,0X22,0XE5,0X22,0XC4,0X23,
+0X05,0X1A,0XC4,0X1A,0XA4,0X23,0X06,0X80,0X1B,0XA9,0X05,0X23,0X26,0X23,0XA7,0X2C,
+0X6A,0X23,0XA7,0X23,0X25,0X23,0X45,0X80,0X00,0X81,0X83,0X00,0X61,0X02,0X00,0X82,
+0X00,0X81,0X08,0XA2,0X80,0X08,0X82,0X80,0X08,0XA2,0X03,0X08,0XA1,0X08,0XA2,0X08,
+0X81,0X00,0X61,0X80,0X08,0X81,0X01,0X08,0XA1,0X08,0X82,0XCF,0X00,0X61,0X00,0X00,
+0X82,0X81,0X08,0X82,0X00,0X00,0X82,0X80,0X00,0XA2,0X02,0X08,0X82,0X00,0X82,0X08,
+0XA2,0X82,0X00,0XA2,0X01,0X08,0XA2,0X08,0X82,0X80,0X00,0X81,0X03,0X08,0X81,0X08,
+0X82,0X09,0X22,0X22,0XE5,0X81,0X23,0X86,0X09,0X23,0X87,0X23,0XA7,0X23,0X45,0X23,
+0X25,0X23,0X46,0X23,0X66,0X23,0X46,0X23,0X66,0X1A,0X44,0X1A,0X64,0X80,0X1A,0X84,
+0X0C,0X22,0XA4,0X22,0X84,0X1B,0X06,0X1B,0X88,0X1B,0XC9,0X23,0XC9,0X23,0X67,0X2B,
+0X86,0X22,0XC4,0X1A,0XA4,0X23,0X05,0X23,0XC8,0X23,0X67,0X80,0X23,0X46,0X80,0X23,
+0X05,0X1E,0X1A,0X64,0X11,0XA3,0X1B,0XA9,0X1B,0X48,0X09,0X63,0X08,0X61,0X11,0X63,
+0X23,0X87,0X2C,0X69,0X2C,0XEC,0X2C,0XED,0X24,0X8B,0X23,0XE8,0X2B,0X45,0X22,0XC4,
+0X23,0X87,0X34,0XEC,0X4D,0X8E,0X35,0X0C,0X2C,0XAB,0X2C,0XED,0X3D,0X2D,0X55,0X4E,
+0X5D,0X90,0X5D,0XB0,0X45,0X2C,0X2B,0X45,0X11,0X42,0X08,0XA1,0X08,0X81,0X08,0X61,
+0X86,0X00,0X61,0X07,0X08,0XA1,0X08,0XC2,0X09,0X23,0X0A,0XEA,0X0B,0XEE,0X0A,0X88,
+0X09,0X02,0X08,0XC1,0X80,0X08,0XC2,0X80,0X09,0X02,0X03,0X08,0XE2,0X09,0X23,0X09,
+0X02,0X08,0XE2,0X80,0X08,0XC2,0X22,0X09,0X03,0X09,0X43,0X12,0X24,0X34,0X09,0X55,
+0X4D,0X4D,0X2C,0X3C,0XC8,0X3C,0X87,0X34,0XCA,0X3C,0XCA,0X3C,0X69,0X44,0XEC,0X44,
+0XCA,0X2B,0X04,0X1A,0X64,0X23,0XA8,0X2C,0X2A,0X34,0XEC,0X2C,0X6A,0X24,0X8B,0X1D,
+0X30,0X1C,0XCE,0X1C,0X6D,0X24,0X09,0X2C,0X29,0X34,0X06,0X34,0X26,0X34,0X68,0X44,
+0XA9,0X44,0XCA,0X3C,0XCA,0X2C,0X89,0X2B,0XA7,0X1A,0X23,0X08,0XE2,0X80,0X08,0X61,
+0X81,0X00,0X61,0X07,0X08,0X81,0X19,0XA2,0X33,0X84,0X3C,0XA9,0X35,0X2D,0X23,0XC9,
+0X09,0X43,0X08,0X61,0X94,0X00,0X61,0X80,0X08,0X61,0X16,0X08,0XC2,0X19,0XA2,0X23,
+0X46,0X2C,0X8A,0X3D,0X2E,0X45,0X6F,0X3D,0X4E,0X2C,0XEC,0X2C,0XCB,0X24,0X6B,0X2C,
+0X28,0X24,0X6A,0X24,0XED,0X35,0X4F,0X3D,0X90,0X35,0X70,0X2C,0XED,0X34,0X88,0X33,
+0XE6,0X23,0X45,0X23,0X05,0X1A,0XC4,0X1A,0XA4,0X80,0X23,0X05,0X09,0X23,0X25,0X1B,
+0XA8,0X1B,0X88,0X23,0X05,0X2C,0X27,0X2C,0XCA,0X2C,0X48,0X23,0X86,0X23,0X46,0X08,
+0X81,0X86,0X00,0X61,0X02,0X00,0X81,0X08,0X81,0X00,0XA1,0X80,0X08,0XA2,0X81,0X08,
+0X81,0X01,0X00,0X61,0X00,0X81,0X80,0X08,0X81,0X00,0X00,0X81,0XCB,0X00,0X61,0X01,
+0X00,0X81,0X00,0X62,0X80,0X08,0X82,0X00,0X00,0X82,0X80,0X08,0X82,0X02,0X00,0X62,
+0X08,0XA2,0X00,0XA2,0X84,0X08,0XA2,0X00,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,0X82,
+0X80,0X00,0X81,0X11,0X08,0X81,0X00,0XA2,0X08,0XA2,0X1A,0X03,0X23,0X45,0X2B,0X24,
+0X23,0X04,0X2B,0X24,0X23,0X66,0X23,0X45,0X23,0X25,0X23,0X66,0X23,0X26,0X23,0X05,
+0X23,0X67,0X23,0X26,0X22,0XC4,0X1A,0XA4,0X80,0X22,0XC4,0X1A,0X22,0XE4,0X1A,0XE5,
+0X1B,0X26,0X1B,0X67,0X1B,0X88,0X23,0XA7,0X23,0X46,0X23,0X05,0X22,0XA4,0X23,0X25,
+0X22,0XE5,0X23,0X25,0X23,0X05,0X23,0X45,0X1A,0XC5,0X1A,0XE6,0X23,0X06,0X1A,0X44,
+0X1A,0X45,0X12,0X04,0X08,0XE2,0X08,0X61,0X11,0X83,0X23,0XA7,0X2C,0X27,0X2C,0X28,
+0X2C,0X27,0X80,0X2B,0XA6,0X0F,0X2B,0X85,0X23,0X67,0X1C,0X0A,0X2C,0XCC,0X45,0X4E,
+0X34,0XEC,0X2C,0X8A,0X2D,0X0D,0X35,0X0C,0X4D,0X4E,0X55,0X4E,0X45,0X0D,0X2C,0X49,
+0X1A,0X03,0X08,0XC1,0X08,0XA1,0X80,0X08,0X81,0X86,0X00,0X61,0X07,0X08,0X81,0X08,
+0XA1,0X08,0XC1,0X08,0XE2,0X0A,0X28,0X0B,0X0B,0X09,0XA5,0X08,0XE1,0X81,0X08,0XC2,
+0X02,0X09,0X02,0X08,0XE2,0X08,0XC2,0X81,0X09,0X02,0X23,0X08,0XC2,0X08,0XA2,0X08,
+0XC2,0X09,0X02,0X12,0X05,0X23,0XCA,0X3C,0XCC,0X3C,0XEA,0X44,0XC7,0X3C,0XA8,0X34,
+0XC9,0X34,0XA9,0X3C,0X69,0X44,0XCA,0X3C,0X69,0X11,0X83,0X11,0X82,0X22,0XC4,0X2B,
+0XE7,0X2C,0X28,0X2B,0XE7,0X35,0X4F,0X35,0X50,0X1C,0X8E,0X1C,0X2B,0X24,0X08,0X2C,
+0X07,0X34,0X06,0X34,0X47,0X3C,0X89,0X3C,0XCB,0X34,0XAA,0X2C,0X08,0X1A,0X44,0X09,
+0X02,0X08,0X61,0X83,0X00,0X61,0X06,0X08,0X61,0X11,0X41,0X2B,0X24,0X34,0X89,0X2C,
+0XCC,0X1B,0X07,0X08,0XC2,0X94,0X00,0X61,0X01,0X08,0X61,0X00,0X61,0X80,0X08,0X61,
+0X04,0X08,0X81,0X11,0X22,0X1A,0XC6,0X2C,0X4A,0X2C,0XED,0X80,0X2D,0X0D,0X1B,0X2C,
+0XEC,0X24,0XAC,0X24,0X6A,0X24,0X08,0X24,0X8B,0X25,0X0E,0X25,0X2F,0X25,0X0E,0X24,
+0XED,0X2C,0XAB,0X2C,0X07,0X23,0X26,0X1B,0X47,0X23,0X46,0X1A,0X84,0X22,0XC4,0X23,
+0X46,0X23,0X66,0X23,0X67,0X23,0X87,0X22,0XE4,0X34,0X06,0X34,0XA8,0X34,0X68,0X23,
+0X66,0X23,0X05,0X00,0X62,0X00,0X61,0X80,0X08,0X61,0X84,0X00,0X61,0X01,0X08,0X61,
+0X08,0X81,0X81,0X08,0XA1,0X81,0X08,0X81,0X02,0X00,0X81,0X00,0X61,0X08,0X81,0XCC,
+0X00,0X61,0X81,0X08,0X82,0X02,0X00,0X81,0X08,0X82,0X00,0X82,0X83,0X08,0X82,0X87,
+0X08,0XA2,0X16,0X08,0X81,0X08,0XA2,0X08,0X82,0X00,0X82,0X08,0XA2,0X09,0X02,0X1A,
+0X44,0X22,0XA3,0X2B,0X04,0X23,0X86,0X2B,0X86,0X2B,0X45,0X23,0X25,0X23,0X46,0X23,
+0XA8,0X23,0X26,0X23,0X46,0X23,0X66,0X22,0XE5,0X1A,0XE5,0X23,0X05,0X23,0X45,0X23,
+0XA7,0X80,0X23,0X87,0X07,0X1B,0X87,0X23,0X88,0X23,0XA8,0X23,0X67,0X23,0X47,0X23,
+0X05,0X23,0X66,0X23,0X04,0X80,0X22,0X83,0X1F,0X22,0XA3,0X23,0X05,0X1B,0X06,0X11,
+0XE3,0X11,0X62,0X09,0X02,0X09,0X22,0X08,0XC2,0X00,0X61,0X11,0X43,0X23,0XA7,0X2B,
+0XA6,0X2B,0X65,0X2B,0XC6,0X2B,0X85,0X2B,0X44,0X2B,0X45,0X23,0XA8,0X1C,0X2A,0X2C,
+0XAB,0X2C,0XCB,0X24,0X8A,0X2C,0XCC,0X3D,0X2D,0X3D,0X0D,0X45,0X2D,0X45,0X0C,0X2B,
+0XC7,0X1A,0X64,0X10,0XE2,0X08,0XE2,0X08,0XA2,0X81,0X08,0X81,0X86,0X00,0X61,0X06,
+0X00,0X81,0X08,0XA1,0X08,0XC2,0X08,0XE2,0X09,0XE6,0X0A,0X05,0X08,0XE2,0X80,0X08,
+0XC2,0X82,0X08,0XE2,0X03,0X09,0X02,0X09,0X03,0X09,0X64,0X09,0X23,0X80,0X08,0XC2,
+0X05,0X08,0XE2,0X09,0X43,0X0A,0X46,0X12,0XA6,0X23,0X68,0X3C,0X48,0X80,0X3C,0X66,
+0X17,0X3C,0X87,0X3C,0X89,0X44,0XAA,0X4C,0XEA,0X23,0X26,0X08,0XC1,0X11,0X02,0X11,
+0X82,0X1A,0X03,0X22,0XE5,0X2C,0XAC,0X34,0XED,0X1C,0X8D,0X1C,0X6D,0X24,0X0A,0X2B,
+0XE6,0X33,0XE6,0X3C,0X47,0X44,0XAA,0X3C,0XCB,0X2C,0X49,0X23,0X05,0X11,0X22,0X08,
+0X81,0X83,0X00,0X61,0X80,0X08,0X61,0X05,0X11,0X01,0X2A,0XE4,0X2C,0X69,0X2C,0X8A,
+0X12,0X24,0X08,0X81,0X98,0X00,0X61,0X06,0X08,0X61,0X08,0XA2,0X09,0X43,0X1A,0XA6,
+0X23,0XE9,0X24,0X8B,0X2D,0X0D,0X80,0X35,0X2E,0X13,0X24,0XCC,0X24,0X49,0X24,0X4A,
+0X24,0XED,0X25,0X2F,0X24,0XEE,0X24,0XCC,0X2C,0XAB,0X23,0XC7,0X12,0X44,0X12,0X24,
+0X1A,0XA5,0X1A,0XA4,0X1A,0XC4,0X23,0X86,0X23,0XA7,0X23,0X66,0X23,0X87,0X23,0X05,
+0X2B,0X45,0X80,0X2C,0X07,0X01,0X1A,0XE5,0X1A,0XC5,0X80,0X00,0X61,0X84,0X08,0X81,
+0X81,0X00,0X61,0X80,0X08,0X81,0X82,0X08,0XA1,0X82,0X08,0X81,0XCB,0X00,0X61,0X81,
+0X08,0X82,0X00,0X00,0X61,0X81,0X08,0X82,0X03,0X08,0XA2,0X08,0X82,0X08,0XA2,0X08,
+0X82,0X80,0X08,0XA2,0X00,0X00,0XA2,0X81,0X08,0XA2,0X07,0X00,0XA2,0X08,0XA2,0X08,
+0XC2,0X08,0XA2,0X08,0X81,0X08,0XA2,0X00,0X82,0X00,0XA2,0X80,0X08,0XA2,0X11,0X09,
+0X02,0X11,0XA2,0X23,0X04,0X24,0X09,0X24,0X6A,0X2B,0X45,0X2B,0X24,0X22,0X83,0X22,
+0XE5,0X23,0X25,0X23,0X67,0X1B,0X26,0X23,0X06,0X23,0X26,0X23,0X46,0X23,0XA8,0X24,
+0X09,0X23,0XC8,0X80,0X23,0XA7,0X0F,0X23,0XC8,0X1B,0XC9,0X23,0XA8,0X1B,0X47,0X22,
+0XC4,0X2B,0X24,0X22,0XC3,0X22,0X83,0X22,0X82,0X22,0XA3,0X1A,0X43,0X1A,0X03,0X11,
+0X62,0X09,0X02,0X08,0XC2,0X08,0XA1,0X80,0X08,0X81,0X15,0X09,0X02,0X2B,0X24,0X33,
+0X84,0X23,0X25,0X24,0X2A,0X23,0XE8,0X23,0X25,0X22,0XE4,0X23,0X88,0X23,0XE8,0X34,
+0XEB,0X24,0X8A,0X24,0X6A,0X35,0X0D,0X4D,0X6E,0X55,0X6F,0X45,0X0C,0X2C,0X28,0X1A,
+0X23,0X10,0XE2,0X08,0XC2,0X09,0X22,0X81,0X08,0XA1,0X00,0X08,0X81,0X80,0X00,0X81,
+0X85,0X00,0X61,0X04,0X08,0X81,0X08,0XA2,0X08,0XE2,0X09,0X02,0X11,0X84,0X84,0X08,
+0XC2,0X81,0X09,0X02,0X01,0X09,0X23,0X09,0X03,0X80,0X09,0X02,0X06,0X01,0X02,0X09,
+0X22,0X09,0X63,0X09,0X83,0X09,0X63,0X19,0XC3,0X2B,0X24,0X80,0X44,0X24,0X04,0X3C,
+0X46,0X3C,0X89,0X45,0X0C,0X34,0X28,0X11,0X82,0X80,0X08,0XA2,0X0E,0X08,0X81,0X11,
+0X42,0X1A,0XA5,0X23,0X67,0X23,0XE9,0X1C,0X8D,0X1C,0X4C,0X2B,0X45,0X34,0X06,0X3C,
+0X68,0X44,0XEB,0X34,0X8A,0X23,0X26,0X11,0X82,0X08,0X81,0X84,0X00,0X61,0X80,0X08,
+0X61,0X05,0X08,0XC1,0X22,0X83,0X34,0X27,0X2C,0X08,0X11,0X83,0X08,0X61,0X98,0X00,
+0X61,0X1B,0X08,0X81,0X08,0XA2,0X08,0XE2,0X09,0X23,0X1A,0X44,0X23,0X86,0X34,0X69,
+0X3D,0X0D,0X35,0X2E,0X24,0XCC,0X24,0X6A,0X24,0X4A,0X24,0XCC,0X2D,0X2E,0X25,0X0E,
+0X24,0XED,0X2C,0XCB,0X23,0XE8,0X11,0XC4,0X09,0X02,0X11,0X83,0X19,0XE2,0X1A,0X64,
+0X23,0X46,0X23,0X87,0X23,0X66,0X23,0X46,0X23,0X67,0X80,0X1A,0XE6,0X03,0X1B,0X06,
+0X1B,0X27,0X1A,0XE5,0X00,0X61,0X86,0X08,0X81,0X00,0X00,0X81,0X81,0X00,0X61,0X80,
+0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0X81,0X01,0X00,0X61,0X08,0X81,0XCB,0X00,0X61,
+0X00,0X00,0X62,0X83,0X08,0X82,0X00,0X00,0X82,0X80,0X08,0XA2,0X82,0X00,0XA2,0X85,
+0X08,0XA2,0X03,0X08,0XC2,0X08,0X82,0X08,0X81,0X00,0XA1,0X80,0X00,0XA2,0X10,0X08,
+0XA2,0X08,0X82,0X08,0XA2,0X08,0XC2,0X1A,0X04,0X23,0X66,0X2C,0X08,0X23,0X45,0X2B,
+0XA6,0X22,0XE4,0X22,0XC4,0X22,0XE5,0X23,0X06,0X1A,0XA5,0X1B,0X06,0X1B,0X67,0X1B,
+0X88,0X80,0X1C,0X0A,0X02,0X23,0XC8,0X23,0XE8,0X23,0XA7,0X80,0X23,0XE8,0X0C,0X1B,
+0X26,0X23,0X46,0X22,0XC5,0X22,0X83,0X22,0X63,0X1A,0X22,0X22,0X63,0X22,0X43,0X19,
+0XE2,0X11,0XA2,0X09,0X22,0X08,0XC2,0X08,0X81,0X80,0X00,0X61,0X16,0X08,0X81,0X08,
+0XE2,0X1A,0X43,0X22,0XE3,0X23,0XC9,0X1C,0X6C,0X24,0X0A,0X23,0XA7,0X23,0X66,0X23,
+0XA8,0X23,0XC8,0X2C,0XCB,0X24,0X6A,0X24,0XAC,0X35,0X2E,0X55,0X6F,0X4D,0X6E,0X34,
+0X6A,0X1A,0X44,0X08,0XC1,0X08,0X81,0X08,0XE2,0X09,0X02,0X80,0X08,0XC2,0X07,0X08,
+0XE2,0X08,0XC2,0X08,0XC1,0X08,0XA1,0X00,0X61,0X00,0X81,0X00,0X82,0X00,0X81,0X80,
+0X08,0X81,0X81,0X00,0X61,0X01,0X08,0XA1,0X08,0XA2,0X80,0X08,0XE2,0X80,0X08,0XC1,
+0X81,0X08,0XC2,0X03,0X08,0XE2,0X00,0XE2,0X08,0XE2,0X08,0XC2,0X80,0X08,0XE2,0X0E,
+0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X22,0X09,0X23,0X09,0X43,0X08,0XC2,0X11,0X62,
+0X2B,0X24,0X3C,0X25,0X44,0X44,0X3C,0X45,0X34,0X67,0X34,0XCA,0X23,0X06,0X81,0X08,
+0XC2,0X0D,0X08,0X61,0X08,0X81,0X08,0XE2,0X1A,0X65,0X24,0X4B,0X1C,0XCE,0X23,0XC8,
+0X2B,0X65,0X34,0X48,0X34,0X8A,0X23,0X67,0X11,0X83,0X08,0XA2,0X08,0X61,0X86,0X00,
+0X61,0X05,0X08,0X81,0X1A,0X02,0X33,0XC5,0X23,0X45,0X09,0X02,0X08,0X61,0X98,0X00,
+0X61,0X12,0X08,0XA2,0X08,0XE2,0X08,0XA2,0X08,0X81,0X09,0X02,0X19,0XE3,0X2B,0X45,
+0X34,0X69,0X24,0XED,0X24,0XAC,0X24,0X29,0X24,0X2A,0X24,0XAC,0X2D,0X0E,0X2D,0X2E,
+0X1C,0XCE,0X24,0XAB,0X24,0X29,0X12,0X24,0X80,0X08,0XA2,0X0C,0X11,0X42,0X12,0X03,
+0X23,0X26,0X23,0X87,0X23,0X66,0X23,0X04,0X23,0X46,0X1B,0X88,0X1B,0X48,0X1B,0XA9,
+0X1B,0XEA,0X23,0XA8,0X00,0X61,0X88,0X08,0X81,0X80,0X00,0X61,0X80,0X08,0X81,0X80,
+0X08,0XA1,0X80,0X08,0X81,0XCC,0X00,0X61,0X07,0X00,0X82,0X00,0XA2,0X08,0XA2,0X08,
+0X82,0X00,0X62,0X00,0X82,0X00,0XA2,0X08,0XA2,0X80,0X00,0XA2,0X00,0X08,0XA2,0X80,
+0X00,0XA2,0X01,0X00,0X81,0X00,0XA2,0X81,0X08,0XA2,0X00,0X00,0XA2,0X80,0X08,0XA2,
+0X0B,0X08,0X81,0X08,0XA1,0X00,0X81,0X00,0XA2,0X08,0XA2,0X00,0XA1,0X08,0X82,0X00,
+0XA2,0X00,0X82,0X08,0XA2,0X1A,0X23,0X34,0X27,0X80,0X2B,0XA6,0X02,0X23,0XA7,0X1B,
+0XEA,0X1C,0X2A,0X80,0X1B,0X48,0X0D,0X1B,0X27,0X1B,0XEA,0X14,0X2C,0X13,0XED,0X14,
+0X2D,0X1B,0XC9,0X23,0XE9,0X23,0XA7,0X2B,0XC7,0X23,0X45,0X22,0XC4,0X22,0XE4,0X23,
+0XCA,0X1B,0X27,0X80,0X1A,0X02,0X00,0X11,0XC2,0X80,0X19,0XE2,0X02,0X11,0XA2,0X09,
+0X02,0X00,0X81,0X81,0X00,0X61,0X0D,0X08,0X81,0X08,0XC2,0X1A,0X23,0X23,0X87,0X1C,
+0X8D,0X1C,0XAD,0X1C,0X4B,0X1B,0XE9,0X1C,0X0A,0X1B,0XE9,0X1C,0X0A,0X24,0X6A,0X24,
+0X4A,0X2D,0X0D,0X80,0X3D,0X4E,0X02,0X2C,0XAA,0X1A,0X64,0X08,0XA1,0X80,0X08,0X81,
+0X04,0X11,0X63,0X11,0XA3,0X08,0XE2,0X09,0X03,0X09,0X23,0X80,0X08,0XE2,0X03,0X08,
+0X81,0X08,0X61,0X00,0X81,0X08,0XA2,0X82,0X08,0X81,0X01,0X00,0X81,0X00,0X61,0X80,
+0X00,0X81,0X06,0X08,0X81,0X08,0XA1,0X08,0XC2,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X09,
+0X02,0X80,0X08,0XE2,0X80,0X08,0XC1,0X14,0X08,0XE2,0X09,0X23,0X09,0XC5,0X09,0X03,
+0X08,0XE3,0X09,0X23,0X09,0X62,0X09,0X43,0X08,0XE2,0X08,0XC2,0X09,0X42,0X22,0XE4,
+0X3C,0X87,0X3C,0X45,0X44,0X24,0X3C,0X45,0X3C,0X67,0X1A,0X23,0X08,0XC2,0X08,0XE2,
+0X08,0XC2,0X80,0X00,0X61,0X09,0X08,0XA1,0X11,0XC3,0X23,0X25,0X2C,0X6A,0X2B,0XA7,
+0X23,0X65,0X1A,0XC5,0X11,0X63,0X08,0X81,0X08,0X61,0X87,0X00,0X61,0X04,0X08,0X61,
+0X11,0X42,0X2A,0XE3,0X1A,0X83,0X08,0XC2,0X98,0X00,0X61,0X03,0X00,0X82,0X08,0XC2,
+0X00,0XA2,0X08,0X81,0X80,0X08,0XA2,0X1B,0X08,0XC2,0X11,0XC2,0X2B,0XA5,0X2C,0X8A,
+0X24,0XAB,0X24,0X29,0X24,0X09,0X24,0X8C,0X2D,0X2E,0X35,0X2E,0X1C,0XCE,0X24,0XAC,
+0X24,0X8B,0X1B,0X06,0X08,0XE2,0X08,0X61,0X09,0X02,0X12,0X04,0X1B,0X27,0X23,0XA8,
+0X23,0X87,0X22,0XE4,0X23,0X05,0X1B,0XA9,0X13,0XCA,0X1C,0X0B,0X1C,0X2B,0X24,0X4A,
+0X8A,0X08,0X81,0X00,0X00,0X61,0X81,0X08,0X81,0X80,0X08,0XA1,0XCC,0X00,0X61,0X03,
+0X00,0X62,0X00,0X82,0X00,0XA2,0X08,0X82,0X80,0X00,0X82,0X86,0X08,0XA2,0X01,0X00,
+0X82,0X08,0XA2,0X81,0X00,0XA2,0X80,0X08,0XA2,0X02,0X08,0XA1,0X08,0X81,0X08,0XA1,
+0X80,0X08,0XA2,0X81,0X00,0XA2,0X14,0X08,0X82,0X08,0XA2,0X08,0X82,0X11,0X22,0X23,
+0X87,0X23,0X66,0X23,0X25,0X23,0X66,0X23,0X46,0X1B,0X48,0X13,0XAB,0X13,0XCB,0X13,
+0X8A,0X13,0XCC,0X14,0X4F,0X14,0XAF,0X14,0X2C,0X1B,0XC9,0X1B,0XA9,0X23,0X87,0X22,
+0XE4,0X80,0X22,0X82,0X09,0X22,0X83,0X1B,0X06,0X1A,0XA4,0X1A,0X42,0X1A,0X22,0X19,
+0XE2,0X1A,0X02,0X19,0XE2,0X11,0X82,0X08,0XE2,0X83,0X00,0X61,0X11,0X08,0XE2,0X1A,
+0X84,0X23,0X45,0X24,0X0A,0X1C,0X4B,0X1C,0X0A,0X1C,0X2B,0X1C,0X0C,0X1B,0XEA,0X1C,
+0X4B,0X24,0X6A,0X24,0X8C,0X2D,0X0E,0X45,0X6F,0X34,0XED,0X1A,0X85,0X10,0XA1,0X08,
+0XA1,0X80,0X08,0XA2,0X80,0X09,0X42,0X00,0X08,0XE2,0X80,0X09,0X02,0X02,0X08,0XE1,
+0X08,0XC2,0X00,0X81,0X83,0X00,0X61,0X80,0X00,0X81,0X80,0X00,0X61,0X00,0X08,0X81,
+0X82,0X00,0X61,0X04,0X08,0X81,0X08,0XA1,0X08,0XC1,0X08,0XC2,0X08,0XA2,0X81,0X08,
+0XC2,0X08,0X08,0XE2,0X01,0X02,0X09,0X64,0X09,0X23,0X09,0X03,0X09,0X02,0X09,0X64,
+0X0A,0XC8,0X09,0X43,0X80,0X08,0XC2,0X15,0X09,0X02,0X1A,0XC6,0X2C,0X49,0X3C,0X46,
+0X3C,0X24,0X44,0X24,0X33,0X63,0X11,0X62,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0X61,
+0X00,0X61,0X08,0X61,0X11,0X41,0X22,0XA3,0X2B,0XC7,0X22,0XA4,0X11,0X22,0X08,0X61,
+0X00,0X61,0X08,0X61,0X84,0X00,0X61,0X00,0X08,0X61,0X81,0X00,0X61,0X00,0X08,0XA1,
+0X80,0X11,0X62,0X00,0X08,0X82,0X98,0X00,0X61,0X00,0X00,0X81,0X80,0X08,0XA1,0X00,
+0X08,0XA2,0X82,0X08,0XA1,0X16,0X19,0XA2,0X2B,0X85,0X2C,0X07,0X2B,0X65,0X1A,0XE5,
+0X23,0XC9,0X24,0XED,0X35,0X4F,0X25,0X2E,0X24,0XED,0X24,0XAC,0X1B,0X88,0X09,0X03,
+0X08,0X61,0X00,0XA2,0X09,0X23,0X1A,0X85,0X1B,0XA9,0X1B,0XA8,0X23,0X04,0X22,0XE4,
+0X23,0X67,0X1C,0X0A,0X80,0X1C,0X0B,0X00,0X1B,0XEA,0X88,0X08,0X81,0X01,0X08,0XC2,
+0X08,0X82,0X80,0X08,0XA1,0X83,0X08,0X81,0XCB,0X00,0X61,0X01,0X00,0X82,0X08,0X82,
+0X82,0X00,0XA2,0X81,0X08,0XA2,0X00,0X08,0X82,0X81,0X08,0XA2,0X04,0X00,0XA2,0X00,
+0X82,0X00,0XA2,0X08,0XA2,0X00,0XA2,0X81,0X08,0XA2,0X00,0X00,0X81,0X80,0X08,0X82,
+0X80,0X08,0XA2,0X00,0X00,0XA2,0X83,0X08,0XA2,0X03,0X08,0XE2,0X1A,0XA5,0X23,0X66,
+0X2B,0XA6,0X80,0X23,0X66,0X06,0X1B,0X47,0X13,0XEB,0X14,0X2E,0X14,0X2D,0X14,0X0D,
+0X14,0X2D,0X1C,0X0C,0X80,0X1B,0XC9,0X07,0X1B,0XA9,0X1B,0XEA,0X23,0X05,0X2A,0XC2,
+0X22,0X62,0X1A,0X23,0X1A,0X63,0X22,0X83,0X80,0X1A,0X22,0X80,0X19,0XE2,0X02,0X11,
+0XC2,0X11,0X42,0X08,0XA1,0X82,0X00,0X61,0X10,0X08,0X81,0X08,0XA2,0X11,0X63,0X1A,
+0X63,0X23,0X86,0X1C,0X4B,0X1C,0X8D,0X14,0X6D,0X1C,0X0B,0X1B,0XEA,0X24,0X2A,0X24,
+0XAC,0X24,0XED,0X35,0X2E,0X35,0X0D,0X23,0X87,0X11,0X22,0X82,0X08,0XA2,0X80,0X09,
+0X42,0X00,0X08,0XE1,0X81,0X08,0XE2,0X00,0X08,0XC2,0X88,0X00,0X61,0X00,0X08,0X81,
+0X83,0X00,0X61,0X03,0X08,0X81,0X08,0XA1,0X08,0XA2,0X00,0XA1,0X80,0X09,0XE6,0X00,
+0X09,0X23,0X81,0X08,0XE2,0X01,0X09,0X02,0X08,0XE2,0X80,0X09,0X02,0X02,0X09,0XC5,
+0X0A,0X06,0X08,0XE2,0X81,0X08,0XC2,0X06,0X12,0X04,0X34,0X08,0X3C,0X25,0X3C,0X66,
+0X3B,0XE4,0X22,0X63,0X09,0X02,0X80,0X08,0XE2,0X00,0X08,0X81,0X80,0X08,0X61,0X06,
+0X00,0X61,0X11,0X62,0X2A,0XC3,0X23,0X05,0X11,0XA3,0X08,0X81,0X08,0X61,0X85,0X00,
+0X61,0X00,0X08,0X61,0X81,0X00,0X61,0X00,0X08,0X61,0X80,0X08,0X81,0X99,0X00,0X61,
+0X00,0X08,0XA2,0X80,0X08,0XC2,0X80,0X00,0X81,0X00,0X00,0X82,0X80,0X00,0X61,0X17,
+0X08,0XA2,0X19,0XE2,0X2B,0X44,0X2B,0X23,0X1A,0X03,0X1A,0X85,0X1C,0X2B,0X24,0XEE,
+0X2D,0X2F,0X2D,0X2E,0X24,0XED,0X1B,0XEA,0X09,0X83,0X08,0X61,0X00,0X61,0X08,0XA1,
+0X11,0X83,0X12,0XC7,0X1B,0X88,0X23,0X66,0X23,0X25,0X23,0X46,0X1B,0XA9,0X1B,0XCB,
+0X80,0X1C,0X0B,0X00,0X08,0XA2,0X85,0X08,0X81,0X06,0X08,0XA1,0X08,0XC2,0X09,0X02,
+0X08,0XA2,0X08,0XC2,0X08,0XC1,0X08,0XA2,0X82,0X08,0X81,0XCB,0X00,0X61,0X01,0X08,
+0X82,0X00,0X82,0X83,0X00,0XA2,0X03,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X08,0X82,0X80,
+0X08,0XA2,0X81,0X00,0XA2,0X00,0X08,0XA2,0X80,0X08,0X82,0X80,0X08,0XA2,0X02,0X00,
+0X61,0X00,0X82,0X08,0X82,0X80,0X08,0XA2,0X00,0X00,0XA2,0X80,0X08,0X82,0X80,0X08,
+0XA2,0X08,0X00,0XA2,0X08,0XA2,0X11,0X63,0X23,0X46,0X2B,0X86,0X23,0X65,0X23,0X66,
+0X1B,0X47,0X1B,0X89,0X80,0X14,0X4E,0X12,0X14,0X2D,0X1B,0XEB,0X23,0X87,0X2B,0XC7,
+0X1B,0XC9,0X1C,0X0B,0X1C,0X8E,0X1B,0X88,0X22,0XA3,0X22,0X42,0X19,0XE2,0X22,0X62,
+0X2A,0XC2,0X22,0X42,0X1A,0X02,0X11,0XC2,0X11,0X82,0X11,0X42,0X08,0XE2,0X83,0X00,
+0X61,0X14,0X08,0X81,0X08,0XA1,0X08,0XE2,0X1A,0X43,0X2B,0XA6,0X24,0X6B,0X1C,0XCE,
+0X1C,0X6D,0X1C,0X0B,0X1B,0X67,0X24,0X29,0X24,0XEE,0X25,0X0E,0X2C,0XAC,0X23,0XC8,
+0X11,0XA3,0X08,0XA2,0X08,0XC2,0X08,0XA2,0X08,0XC2,0X08,0XC1,0X80,0X09,0X22,0X04,
+0X09,0X02,0X09,0X22,0X09,0X02,0X08,0XC2,0X08,0XA1,0X88,0X00,0X61,0X00,0X08,0X81,
+0X81,0X00,0X61,0X00,0X08,0X81,0X80,0X00,0X61,0X0B,0X00,0X81,0X08,0X82,0X00,0XA2,
+0X09,0X24,0X09,0XE6,0X09,0X84,0X09,0X02,0X08,0XE2,0X08,0XC2,0X09,0X02,0X09,0X03,
+0X08,0XC2,0X80,0X08,0XE2,0X01,0X09,0X23,0X09,0X02,0X82,0X08,0XC2,0X05,0X11,0X83,
+0X23,0X05,0X3C,0XEB,0X3C,0XCA,0X2B,0X65,0X11,0X62,0X80,0X08,0XE2,0X08,0X08,0XA2,
+0X00,0X61,0X08,0X61,0X00,0X61,0X08,0X61,0X19,0X82,0X2B,0X44,0X22,0XE4,0X11,0X42,
+0XA7,0X00,0X61,0X04,0X08,0X81,0X08,0XC2,0X09,0X03,0X08,0XC2,0X08,0X81,0X83,0X00,
+0X61,0X18,0X10,0XA1,0X19,0XC2,0X22,0X82,0X19,0XC2,0X11,0X42,0X12,0X45,0X1C,0X4B,
+0X2D,0X0E,0X35,0X4F,0X2D,0X2E,0X1C,0X6C,0X12,0X25,0X08,0X81,0X00,0X81,0X00,0X61,
+0X08,0XC2,0X11,0X63,0X12,0X65,0X23,0X67,0X23,0X66,0X23,0X46,0X1B,0XA8,0X1B,0XCA,
+0X1B,0XEA,0X1C,0X0B,0X81,0X08,0XC2,0X00,0X08,0XA1,0X80,0X08,0X81,0X05,0X08,0XA1,
+0X08,0XA2,0X08,0XA1,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X81,0X08,0XE2,0X03,0X09,0X22,
+0X08,0XC2,0X00,0X81,0X08,0X81,0XCA,0X00,0X61,0X01,0X00,0X82,0X08,0X82,0X81,0X08,
+0XA2,0X81,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,0XC2,0X80,0X00,0XA2,0X01,0X08,0XA2,
+0X00,0XA2,0X84,0X08,0XA2,0X02,0X00,0XA2,0X00,0X62,0X08,0X82,0X81,0X08,0XA2,0X00,
+0X00,0XA2,0X81,0X08,0XA2,0X1C,0X00,0XC2,0X00,0XE3,0X00,0XA2,0X08,0XE2,0X23,0X25,
+0X2B,0X66,0X23,0X66,0X23,0X25,0X23,0X26,0X1B,0X27,0X14,0X2D,0X0C,0X2E,0X14,0X4D,
+0X1B,0XEA,0X23,0X87,0X2B,0XA7,0X23,0XA8,0X1C,0X4D,0X14,0XD0,0X14,0X4D,0X22,0XE5,
+0X22,0X42,0X1A,0X22,0X22,0X62,0X22,0XA2,0X22,0X42,0X11,0XC2,0X11,0X62,0X09,0X02,
+0X80,0X08,0X81,0X83,0X00,0X61,0X0F,0X08,0X81,0X08,0X82,0X08,0XA2,0X1A,0X84,0X2B,
+0XC6,0X24,0X6B,0X1C,0XAD,0X1C,0X0A,0X23,0XA8,0X23,0X25,0X24,0X2A,0X24,0XEE,0X2C,
+0XCC,0X23,0XA7,0X1A,0X03,0X08,0XE2,0X81,0X08,0XC2,0X80,0X08,0XE2,0X06,0X09,0X22,
+0X09,0X42,0X11,0X62,0X09,0X22,0X08,0XE2,0X08,0XA2,0X00,0X81,0X86,0X00,0X61,0X00,
+0X08,0X81,0X80,0X00,0X61,0X01,0X08,0X81,0X00,0X61,0X80,0X08,0X81,0X80,0X00,0X61,
+0X00,0X00,0X81,0X81,0X08,0X81,0X01,0X08,0XA2,0X08,0XE2,0X80,0X09,0X02,0X11,0X08,
+0XC1,0X08,0XE2,0X09,0X23,0X08,0XE3,0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X03,0X08,
+0XE2,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X11,0X43,0X23,0X47,0X3D,0X2D,0X3C,
+0XAA,0X1A,0X43,0X81,0X08,0XE2,0X00,0X08,0X81,0X81,0X00,0X61,0X04,0X08,0X81,0X22,
+0X83,0X2B,0X65,0X1A,0X63,0X08,0XC2,0XA6,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XE2,
+0X00,0X08,0X82,0X84,0X00,0X61,0X19,0X08,0X61,0X08,0XE2,0X11,0XA2,0X11,0X62,0X08,
+0XC2,0X11,0X02,0X1A,0XC6,0X24,0X6C,0X2D,0X0E,0X2D,0X2E,0X1C,0XAD,0X12,0XC7,0X08,
+0X82,0X08,0X81,0X08,0X61,0X08,0X81,0X08,0XA1,0X09,0X02,0X12,0X65,0X23,0X87,0X23,
+0X46,0X1B,0X67,0X1B,0XCA,0X1B,0XA9,0X1B,0X47,0X08,0XE1,0X82,0X08,0XE2,0X00,0X08,
+0XA1,0X83,0X08,0XA2,0X05,0X08,0XE2,0X09,0X02,0X09,0X22,0X11,0X42,0X11,0XC4,0X09,
+0X23,0X80,0X08,0X81,0XCA,0X00,0X61,0X01,0X00,0X82,0X00,0XA2,0X81,0X08,0XA2,0X80,
+0X00,0XA2,0X01,0X00,0X82,0X00,0X81,0X80,0X08,0XA1,0X81,0X08,0X82,0X80,0X08,0XA2,
+0X00,0X00,0XA2,0X82,0X08,0XA2,0X01,0X08,0X81,0X08,0X82,0X80,0X08,0XA2,0X82,0X00,
+0XA2,0X13,0X00,0X82,0X08,0X82,0X08,0XC2,0X01,0X03,0X00,0XA3,0X08,0XC2,0X1B,0X46,
+0X23,0X05,0X23,0X25,0X23,0X46,0X1B,0X88,0X1B,0XAA,0X14,0X2D,0X14,0X8E,0X1C,0X8E,
+0X1C,0X2C,0X1B,0XEA,0X23,0XEA,0X1B,0XEA,0X1C,0X4D,0X80,0X14,0XF0,0X08,0X1B,0XEA,
+0X22,0X83,0X22,0X62,0X22,0XA3,0X22,0X82,0X19,0XE2,0X09,0X22,0X08,0XC2,0X00,0X81,
+0X87,0X00,0X61,0X10,0X08,0X81,0X1A,0X03,0X2C,0X08,0X24,0XCD,0X24,0XAD,0X23,0XC8,
+0X23,0X25,0X2A,0XE3,0X24,0X09,0X24,0XAB,0X2B,0XE6,0X1A,0X43,0X10,0XE1,0X08,0XA2,
+0X08,0XC2,0X08,0XE2,0X09,0X02,0X80,0X09,0X22,0X05,0X09,0X42,0X11,0X83,0X09,0X22,
+0X08,0XE2,0X08,0XC2,0X08,0XA1,0X88,0X00,0X61,0X80,0X08,0X81,0X02,0X00,0X61,0X08,
+0X81,0X00,0X61,0X80,0X08,0X81,0X03,0X00,0X61,0X00,0X81,0X08,0X81,0X00,0X61,0X80,
+0X08,0X81,0X80,0X08,0XA2,0X07,0X09,0X02,0X09,0X23,0X08,0XC2,0X09,0X02,0X09,0X43,
+0X09,0X02,0X08,0XE2,0X09,0X02,0X80,0X09,0X23,0X00,0X08,0XC2,0X80,0X08,0XE2,0X06,
+0X00,0XC2,0X08,0XC2,0X11,0X42,0X2B,0X25,0X34,0XAA,0X2B,0XC7,0X11,0X22,0X81,0X08,
+0XE2,0X00,0X08,0X81,0X81,0X00,0X61,0X03,0X11,0X22,0X2B,0XA6,0X2B,0X65,0X11,0X42,
+0XA6,0X00,0X61,0X02,0X08,0XA2,0X00,0XC2,0X08,0X81,0X86,0X00,0X61,0X02,0X08,0XC2,
+0X11,0X22,0X09,0X02,0X80,0X08,0XC2,0X08,0X11,0X23,0X1B,0X07,0X24,0X8B,0X1C,0XCE,
+0X1C,0XAD,0X1B,0X48,0X08,0XC2,0X00,0X61,0X08,0X81,0X80,0X00,0X61,0X08,0X08,0X81,
+0X09,0X02,0X1A,0X44,0X1A,0XA4,0X1B,0X26,0X1B,0XA9,0X1B,0X89,0X1B,0X06,0X08,0XC2,
+0X80,0X09,0X02,0X80,0X09,0X22,0X06,0X08,0XE2,0X08,0XC1,0X08,0XA1,0X08,0XA2,0X00,
+0XA1,0X08,0XA2,0X08,0XE2,0X80,0X09,0X22,0X03,0X11,0X02,0X11,0X42,0X09,0X42,0X08,
+0XE2,0X80,0X08,0X81,0XC9,0X00,0X61,0X01,0X00,0X82,0X08,0XA2,0X82,0X00,0XA2,0X80,
+0X08,0XA2,0X04,0X08,0X82,0X08,0XA1,0X08,0XA2,0X08,0X82,0X00,0XA2,0X80,0X08,0XA2,
+0X80,0X00,0XA2,0X01,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,0X02,0X08,0X81,0X00,0X82,
+0X00,0XA2,0X82,0X08,0XA2,0X00,0X00,0XA2,0X80,0X08,0XA2,0X05,0X00,0XA2,0X09,0X45,
+0X09,0X03,0X08,0XA2,0X1A,0X86,0X23,0X87,0X80,0X23,0X05,0X09,0X1B,0XEA,0X14,0X4E,
+0X0C,0X2E,0X14,0XAF,0X14,0X6E,0X14,0X8E,0X14,0X8F,0X14,0X6E,0X1C,0X4C,0X14,0XAE,
+0X80,0X14,0XF0,0X05,0X14,0XCF,0X1C,0X0A,0X23,0X45,0X1A,0X03,0X11,0X82,0X08,0XC1,
+0X89,0X00,0X61,0X0E,0X08,0X61,0X08,0X81,0X19,0XE3,0X24,0X6A,0X2D,0X70,0X24,0XAD,
+0X23,0X87,0X23,0X04,0X2A,0XE3,0X2B,0X85,0X2C,0X27,0X2A,0XE3,0X11,0X62,0X08,0XA1,
+0X08,0XC2,0X80,0X08,0XE2,0X00,0X09,0X42,0X80,0X11,0X42,0X80,0X11,0X82,0X02,0X09,
+0X22,0X08,0XE2,0X08,0XA2,0X89,0X00,0X61,0X01,0X08,0X81,0X00,0X61,0X84,0X08,0X81,
+0X00,0X00,0X81,0X80,0X08,0X81,0X01,0X00,0X81,0X08,0X61,0X80,0X08,0X81,0X05,0X08,
+0XA2,0X00,0XE2,0X08,0XE2,0X08,0XC2,0X09,0X02,0X09,0X64,0X80,0X08,0XC2,0X0C,0X09,
+0X02,0X09,0X43,0X08,0XC2,0X00,0XA2,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XC3,0X11,
+0X62,0X2B,0X85,0X3C,0XE9,0X1A,0X64,0X08,0XC2,0X80,0X09,0X02,0X07,0X08,0XE2,0X00,
+0X81,0X00,0X61,0X08,0X61,0X08,0X82,0X1A,0X86,0X34,0X48,0X11,0XA3,0XA5,0X00,0X61,
+0X03,0X00,0X82,0X08,0XA2,0X08,0X81,0X08,0X61,0X84,0X00,0X61,0X0F,0X08,0X82,0X08,
+0XC2,0X08,0XE2,0X08,0XC2,0X08,0X81,0X08,0X82,0X08,0X81,0X08,0XA1,0X11,0X83,0X23,
+0X66,0X1C,0X6B,0X1C,0XAD,0X1B,0XA8,0X09,0X02,0X00,0X61,0X00,0X81,0X81,0X00,0X61,
+0X09,0X08,0X61,0X08,0XC1,0X11,0X83,0X1A,0XE6,0X1B,0X68,0X1B,0XA9,0X1B,0X67,0X11,
+0X83,0X12,0X04,0X09,0X02,0X80,0X09,0X42,0X04,0X09,0X02,0X08,0XA2,0X08,0XC2,0X08,
+0XA1,0X08,0XA2,0X80,0X08,0XE2,0X81,0X09,0X02,0X03,0X09,0X42,0X11,0XC3,0X1A,0XA6,
+0X08,0XA2,0X81,0X00,0X61,0X00,0X08,0X61,0XC5,0X00,0X61,0X01,0X00,0X81,0X08,0X82,
+0X80,0X08,0XA2,0X80,0X00,0XA2,0X86,0X08,0XA2,0X04,0X00,0XA2,0X08,0XA2,0X00,0XA2,
+0X08,0XA2,0X08,0X82,0X80,0X08,0XA2,0X00,0X08,0XA1,0X80,0X08,0XA2,0X00,0X00,0XA2,
+0X80,0X08,0X82,0X01,0X08,0XA2,0X00,0XE3,0X80,0X00,0XA2,0X09,0X08,0XA2,0X08,0XC2,
+0X01,0X04,0X01,0X24,0X08,0X82,0X12,0X24,0X23,0X05,0X22,0XE4,0X22,0XE5,0X1C,0X0B,
+0X80,0X0C,0X4F,0X01,0X14,0XB0,0X14,0X8E,0X81,0X14,0X6E,0X07,0X14,0X4E,0X14,0X6E,
+0X14,0X8F,0X14,0X6E,0X14,0X0C,0X13,0X8A,0X11,0XE4,0X08,0XC2,0X81,0X00,0X61,0X00,
+0X08,0X61,0X88,0X00,0X61,0X18,0X00,0X81,0X1A,0X03,0X2C,0X49,0X1C,0X8D,0X1C,0X8E,
+0X1B,0XC9,0X2B,0X24,0X2B,0X04,0X2B,0XC6,0X2B,0XA5,0X1A,0X02,0X08,0XE2,0X08,0XC2,
+0X08,0XE2,0X09,0X03,0X09,0X42,0X11,0X63,0X11,0X42,0X11,0X62,0X11,0XC2,0X11,0XE3,
+0X11,0X02,0X08,0XA2,0X08,0X81,0X08,0X61,0X89,0X00,0X61,0X81,0X08,0X81,0X00,0X00,
+0X81,0X82,0X08,0X81,0X80,0X08,0XA1,0X00,0X00,0X81,0X81,0X00,0X61,0X08,0X08,0X61,
+0X08,0XA2,0X08,0XC2,0X09,0X02,0X08,0XE2,0X09,0X64,0X09,0XE6,0X08,0XC2,0X08,0XE2,
+0X80,0X09,0X02,0X03,0X08,0XC2,0X08,0XA2,0X08,0XE2,0X08,0XC2,0X80,0X08,0XE2,0X00,
+0X1A,0X03,0X80,0X34,0X47,0X01,0X11,0X43,0X08,0XE2,0X80,0X09,0X02,0X01,0X08,0XE2,
+0X00,0X61,0X80,0X08,0X61,0X02,0X11,0X23,0X22,0XE6,0X11,0X83,0XA5,0X00,0X61,0X02,
+0X08,0X81,0X08,0XA2,0X08,0X61,0X83,0X00,0X61,0X01,0X00,0X81,0X08,0XA2,0X80,0X09,
+0X02,0X0E,0X09,0X22,0X08,0XC2,0X08,0X61,0X00,0X81,0X08,0X81,0X00,0X81,0X08,0XA2,
+0X1A,0X03,0X24,0X08,0X24,0XAC,0X23,0XC8,0X09,0X22,0X08,0X81,0X00,0X61,0X00,0X81,
+0X81,0X00,0X61,0X07,0X00,0X81,0X08,0XE2,0X12,0X04,0X1B,0X27,0X1B,0XCA,0X13,0X69,
+0X09,0X82,0X12,0X04,0X80,0X09,0X22,0X02,0X09,0X42,0X09,0X02,0X08,0XA1,0X80,0X08,
+0XC1,0X02,0X08,0XC2,0X08,0XE2,0X09,0X22,0X81,0X09,0X02,0X05,0X09,0X42,0X11,0X62,
+0X1A,0X86,0X09,0X23,0X08,0X81,0X08,0X61,0XC7,0X00,0X61,0X01,0X08,0X81,0X00,0X82,
+0X80,0X08,0XA2,0X02,0X00,0XA2,0X08,0X82,0X08,0XA2,0X80,0X00,0XA2,0X85,0X08,0XA2,
+0X00,0X00,0XA2,0X81,0X08,0XA2,0X01,0X08,0XC2,0X08,0XA1,0X81,0X08,0XA2,0X00,0X08,
+0X82,0X80,0X00,0XA2,0X01,0X00,0XE3,0X00,0XC2,0X80,0X08,0XA2,0X0A,0X00,0XA2,0X01,
+0X24,0X01,0X86,0X00,0XC3,0X12,0X24,0X23,0X87,0X22,0XC5,0X1A,0XE6,0X13,0XEC,0X0C,
+0X90,0X14,0XB0,0X80,0X14,0XF0,0X09,0X14,0XD0,0X14,0XAF,0X14,0X2D,0X14,0X0C,0X13,
+0X8A,0X13,0X69,0X13,0X28,0X12,0X25,0X09,0X23,0X08,0X61,0X8D,0X00,0X61,0X15,0X08,
+0X81,0X1A,0X03,0X2C,0X28,0X24,0X09,0X1C,0XEF,0X1C,0X6D,0X23,0X26,0X22,0XC3,0X33,
+0X84,0X2A,0XE3,0X11,0X42,0X08,0XE2,0X09,0X03,0X09,0X23,0X09,0X84,0X11,0X83,0X11,
+0X62,0X11,0X82,0X11,0XE3,0X1A,0X23,0X22,0X84,0X08,0XE2,0X8A,0X00,0X61,0X82,0X08,
+0X81,0X00,0X08,0XA2,0X82,0X08,0X81,0X09,0X08,0X82,0X08,0XA2,0X08,0XC2,0X08,0XA1,
+0X00,0X61,0X00,0X81,0X08,0X61,0X08,0X81,0X08,0X82,0X08,0XA2,0X81,0X08,0XE2,0X80,
+0X0A,0X06,0X04,0X09,0X64,0X09,0X02,0X08,0XE2,0X08,0XA1,0X08,0XA2,0X81,0X08,0XE2,
+0X04,0X09,0X03,0X08,0XE2,0X23,0X05,0X3C,0XC8,0X22,0XE5,0X80,0X08,0XE2,0X80,0X09,
+0X02,0X01,0X08,0XE2,0X00,0X81,0X80,0X00,0X61,0X01,0X08,0XC2,0X08,0XA1,0XA5,0X00,
+0X61,0X80,0X08,0X81,0X81,0X00,0X61,0X01,0X08,0X81,0X08,0XA2,0X80,0X08,0XC2,0X05,
+0X08,0XE2,0X09,0X22,0X08,0XE2,0X09,0X22,0X08,0XC2,0X00,0X61,0X82,0X08,0X81,0X07,
+0X11,0X42,0X23,0X25,0X24,0X6A,0X23,0XC8,0X11,0X42,0X08,0X81,0X00,0X61,0X08,0X81,
+0X81,0X00,0X61,0X03,0X08,0X61,0X08,0X81,0X09,0X22,0X12,0X85,0X80,0X1B,0XCA,0X00,
+0X09,0X62,0X80,0X11,0XA3,0X03,0X11,0X82,0X09,0X62,0X09,0X22,0X08,0XE2,0X80,0X08,
+0XC2,0X80,0X08,0XE2,0X08,0X09,0X02,0X09,0X22,0X09,0X02,0X08,0XE2,0X11,0X22,0X11,
+0X42,0X1A,0X24,0X12,0X25,0X00,0X81,0XC7,0X00,0X61,0X03,0X08,0X81,0X08,0XA1,0X00,
+0X82,0X08,0X82,0X81,0X08,0XA2,0X80,0X00,0XA2,0X80,0X08,0XA2,0X01,0X08,0XA1,0X08,
+0X81,0X82,0X08,0XA2,0X81,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,0XA1,0X81,0X08,0XA2,
+0X80,0X00,0XA2,0X81,0X08,0XA2,0X0B,0X00,0XA2,0X00,0XC2,0X00,0XE3,0X01,0X04,0X01,
+0X86,0X01,0X66,0X11,0XC4,0X23,0X88,0X1B,0X27,0X1B,0X07,0X14,0X0C,0X14,0XAF,0X80,
+0X14,0XB0,0X09,0X14,0XD0,0X14,0XAF,0X14,0X6E,0X13,0X8A,0X1A,0XE7,0X11,0XE4,0X11,
+0XA3,0X09,0X43,0X08,0XA2,0X08,0X61,0X80,0X00,0X61,0X00,0X08,0X61,0X8B,0X00,0X61,
+0X15,0X08,0X61,0X11,0X62,0X2B,0X44,0X23,0XE9,0X15,0X10,0X1C,0X8D,0X1A,0XA6,0X1A,
+0X02,0X2B,0X03,0X1A,0X22,0X08,0XE2,0X09,0X02,0X09,0X23,0X09,0X43,0X09,0XE5,0X11,
+0XA3,0X11,0X82,0X19,0XE2,0X1A,0X43,0X1A,0X84,0X22,0X83,0X08,0XC1,0X8A,0X00,0X61,
+0X01,0X00,0X81,0X08,0X81,0X85,0X08,0XA1,0X03,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X09,
+0X02,0X82,0X00,0X61,0X00,0X08,0X81,0X80,0X00,0X81,0X00,0X08,0XA2,0X80,0X08,0XE2,
+0X05,0X09,0XE6,0X12,0X48,0X09,0XC5,0X09,0X23,0X08,0XA2,0X08,0X81,0X80,0X08,0XA1,
+0X06,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X11,0X62,0X34,0X47,0X34,0X27,0X09,0X22,0X82,
+0X09,0X02,0X01,0X08,0XE2,0X00,0X81,0XAA,0X00,0X61,0X01,0X00,0X81,0X08,0XA2,0X81,
+0X08,0XE2,0X03,0X08,0XC2,0X08,0XE2,0X09,0X22,0X09,0X42,0X80,0X09,0X02,0X00,0X08,
+0XE2,0X80,0X00,0X61,0X81,0X08,0X81,0X06,0X08,0XC1,0X1A,0X23,0X2B,0XC7,0X2B,0XA6,
+0X11,0X63,0X08,0X81,0X08,0X61,0X84,0X00,0X61,0X05,0X08,0XA2,0X11,0X84,0X1B,0X28,
+0X1B,0XCA,0X09,0X42,0X11,0XE3,0X80,0X1A,0X23,0X06,0X1A,0X03,0X11,0XE3,0X09,0X62,
+0X09,0X02,0X08,0XC2,0X08,0XE2,0X09,0X02,0X80,0X09,0X22,0X00,0X08,0XE1,0X80,0X09,
+0X02,0X03,0X11,0X42,0X11,0XA2,0X1B,0X07,0X09,0X43,0X83,0X00,0X61,0X00,0X00,0X62,
+0XC1,0X00,0X61,0X00,0X08,0X82,0X83,0X08,0XA2,0X01,0X08,0X81,0X00,0XA2,0X81,0X08,
+0XA2,0X01,0X08,0XA1,0X08,0XC2,0X82,0X08,0XA2,0X80,0X00,0XA2,0X05,0X08,0XA2,0X08,
+0XC2,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,0X02,0X00,0XA2,0X09,
+0X02,0X00,0XA2,0X80,0X08,0XA2,0X00,0X00,0XC2,0X80,0X01,0X03,0X10,0X01,0X24,0X01,
+0X45,0X11,0XC4,0X1B,0X88,0X1B,0X89,0X1B,0XA9,0X1B,0X48,0X1B,0XA9,0X14,0X8F,0X0C,
+0XB0,0X14,0X8F,0X1C,0X6D,0X1B,0X69,0X11,0XE4,0X11,0X62,0X08,0XE2,0X08,0X81,0X80,
+0X00,0X61,0X00,0X08,0X61,0X8F,0X00,0X61,0X0D,0X09,0X02,0X2A,0XE3,0X23,0XE8,0X14,
+0XCF,0X13,0XCA,0X11,0XE4,0X11,0XA2,0X1A,0X23,0X11,0X42,0X08,0XE2,0X09,0X23,0X09,
+0X63,0X09,0XA4,0X11,0XE4,0X80,0X19,0XE3,0X04,0X1A,0X23,0X1A,0X84,0X22,0XC4,0X11,
+0XC3,0X08,0X81,0X8B,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XC2,0X80,0X08,0XE2,0X00,
+0X08,0XC2,0X81,0X08,0XA1,0X03,0X08,0XC1,0X09,0X02,0X09,0X43,0X00,0X81,0X84,0X00,
+0X61,0X07,0X00,0X81,0X08,0XA2,0X08,0XE2,0X09,0XC5,0X12,0XA8,0X09,0XC5,0X09,0X23,
+0X08,0XE2,0X80,0X08,0X61,0X00,0X00,0X81,0X82,0X08,0XA2,0X04,0X22,0X84,0X34,0X88,
+0X11,0XA3,0X08,0XE2,0X09,0X02,0X81,0X09,0X22,0X00,0X08,0XC2,0XA8,0X00,0X61,0X01,
+0X00,0X81,0X08,0XA2,0X80,0X08,0XC2,0X80,0X08,0XE2,0X80,0X08,0XC2,0X01,0X09,0X02,
+0X09,0X42,0X81,0X09,0X22,0X00,0X08,0XC2,0X80,0X00,0X61,0X08,0X00,0X81,0X08,0X81,
+0X00,0X61,0X08,0X81,0X11,0X62,0X23,0X04,0X2B,0X44,0X11,0X42,0X00,0X62,0X84,0X00,
+0X61,0X0E,0X08,0X61,0X08,0X81,0X08,0XA2,0X11,0XA3,0X1A,0XA5,0X11,0X82,0X11,0XA2,
+0X1A,0X23,0X1A,0X63,0X22,0X83,0X1A,0X63,0X11,0XC2,0X11,0XA2,0X11,0XE3,0X11,0X83,
+0X80,0X09,0X22,0X03,0X11,0XC3,0X11,0XA3,0X09,0X02,0X09,0X22,0X80,0X09,0X42,0X02,
+0X12,0X24,0X12,0X45,0X08,0X81,0X80,0X00,0X61,0X00,0X00,0X81,0X80,0X00,0X61,0X81,
+0X00,0X82,0X02,0X00,0X81,0X00,0X61,0X00,0X81,0X83,0X00,0X61,0X00,0X08,0X82,0XB5,
+0X00,0X61,0X00,0X08,0X82,0X84,0X08,0XA2,0X06,0X00,0XA2,0X08,0XA2,0X00,0XA1,0X08,
+0XC2,0X09,0X02,0X09,0X22,0X08,0XC2,0X84,0X08,0XA2,0X03,0X00,0XC2,0X08,0XA2,0X08,
+0X81,0X08,0XA2,0X80,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,0XC2,0X80,0X08,0XA2,0X12,
+0X00,0XA2,0X08,0XC2,0X01,0X03,0X01,0X04,0X01,0X03,0X00,0XC3,0X11,0XC4,0X23,0X67,
+0X13,0XCB,0X14,0XAF,0X1B,0X27,0X22,0XA4,0X14,0X4C,0X14,0XAF,0X14,0X2D,0X12,0XE8,
+0X11,0XA3,0X08,0XA2,0X08,0X81,0X80,0X00,0X61,0X00,0X08,0X61,0X8B,0X00,0X61,0X80,
+0X08,0X82,0X81,0X00,0X61,0X14,0X08,0X81,0X08,0XC2,0X2A,0XE3,0X24,0X29,0X1C,0X6C,
+0X1A,0XC6,0X09,0X63,0X11,0X62,0X11,0X82,0X09,0X63,0X09,0X22,0X09,0X63,0X09,0XC5,
+0X0A,0X26,0X11,0XC3,0X1A,0X03,0X1A,0X24,0X1A,0X64,0X1A,0X84,0X11,0XE3,0X08,0XA1,
+0X8C,0X00,0X61,0X00,0X08,0XA1,0X80,0X08,0XE2,0X80,0X09,0X02,0X01,0X08,0XE2,0X08,
+0XC1,0X80,0X08,0XC2,0X03,0X08,0XC1,0X09,0X02,0X09,0X42,0X00,0X81,0X80,0X00,0X61,
+0X00,0X08,0X81,0X82,0X00,0X61,0X08,0X08,0X61,0X00,0X82,0X08,0XE2,0X09,0X64,0X09,
+0XE5,0X09,0X43,0X08,0XE2,0X00,0X82,0X00,0X81,0X80,0X00,0X61,0X08,0X08,0X81,0X08,
+0XA1,0X08,0X81,0X10,0XE2,0X2B,0X86,0X1A,0X03,0X08,0XC2,0X08,0XE2,0X09,0X02,0X80,
+0X09,0X22,0X01,0X09,0X02,0X08,0XC2,0X80,0X08,0X61,0XA2,0X00,0X61,0X06,0X08,0X81,
+0X08,0X82,0X08,0XA2,0X08,0XC1,0X08,0XE2,0X08,0XE1,0X08,0XC2,0X82,0X08,0XE2,0X05,
+0X09,0X22,0X09,0X23,0X09,0X43,0X09,0X83,0X09,0X02,0X08,0XA2,0X81,0X00,0X61,0X00,
+0X08,0X81,0X80,0X00,0X61,0X04,0X08,0XC2,0X19,0XE2,0X22,0X63,0X11,0X22,0X08,0X81,
+0X85,0X00,0X61,0X0E,0X08,0X61,0X08,0X81,0X08,0XA2,0X11,0X83,0X09,0X62,0X11,0XC2,
+0X1A,0X23,0X1A,0X43,0X22,0X83,0X1A,0X02,0X1A,0X63,0X1A,0X03,0X22,0XE4,0X22,0XC3,
+0X11,0XA2,0X80,0X11,0XC3,0X09,0X12,0X65,0X11,0XE4,0X09,0X22,0X09,0X42,0X11,0X21,
+0X11,0X62,0X22,0XA5,0X08,0XA1,0X00,0X81,0X08,0X81,0X80,0X00,0X61,0X05,0X08,0X82,
+0X00,0XA2,0X08,0X82,0X08,0XA2,0X08,0XA1,0X00,0X81,0X80,0X08,0X81,0X00,0X00,0X82,
+0X82,0X00,0X61,0X00,0X00,0X81,0X80,0X00,0X62,0XB2,0X00,0X61,0X80,0X08,0X82,0X82,
+0X08,0XA2,0X00,0X08,0XC2,0X81,0X08,0XA2,0X00,0X00,0XA1,0X80,0X08,0XC2,0X0C,0X08,
+0X81,0X08,0X82,0X08,0XA2,0X08,0XC2,0X08,0XA2,0X00,0XA2,0X08,0XA2,0X08,0XC2,0X08,
+0XA2,0X08,0X81,0X08,0XA2,0X00,0XA2,0X08,0XA2,0X80,0X00,0XA2,0X80,0X08,0XA2,0X00,
+0X00,0X82,0X80,0X08,0XA2,0X0D,0X00,0XE3,0X01,0X44,0X00,0XE3,0X08,0XA2,0X1A,0X85,
+0X23,0XC9,0X14,0X6E,0X14,0XD0,0X14,0X4E,0X1B,0XC9,0X1C,0X6D,0X1B,0XEB,0X12,0X46,
+0X08,0XC2,0X97,0X00,0X61,0X04,0X08,0XC2,0X2B,0X23,0X2C,0X8B,0X23,0XA8,0X11,0XA3,
+0X80,0X09,0X43,0X0B,0X09,0X63,0X09,0X22,0X09,0X43,0X11,0XA4,0X0A,0X26,0X0A,0X67,
+0X1A,0X04,0X1A,0X24,0X1A,0X64,0X22,0XE5,0X12,0X04,0X08,0XC2,0X80,0X08,0X61,0X8C,
+0X00,0X61,0X03,0X00,0X81,0X08,0XC2,0X09,0X02,0X09,0X22,0X80,0X08,0XE2,0X80,0X09,
+0X02,0X80,0X08,0XE1,0X01,0X09,0X42,0X08,0X81,0X86,0X00,0X61,0X07,0X08,0X61,0X08,
+0X81,0X08,0XE2,0X09,0X43,0X09,0XA3,0X09,0X02,0X08,0XA2,0X08,0X61,0X81,0X00,0X61,
+0X05,0X08,0X81,0X00,0X81,0X08,0X61,0X09,0X42,0X09,0X22,0X08,0XC2,0X80,0X08,0XE2,
+0X00,0X09,0X02,0X80,0X09,0X22,0X02,0X09,0X23,0X08,0XC2,0X08,0X61,0XA1,0X00,0X61,
+0X07,0X00,0X81,0X08,0XC1,0X08,0XE2,0X09,0X02,0X08,0XE2,0X08,0XC2,0X08,0XA2,0X08,
+0XC2,0X80,0X08,0XC1,0X07,0X08,0XC2,0X09,0X02,0X09,0X43,0X09,0X23,0X09,0X43,0X09,
+0X23,0X08,0XE2,0X08,0X61,0X82,0X00,0X61,0X80,0X08,0X81,0X06,0X08,0XA1,0X11,0X02,
+0X09,0X62,0X08,0XE1,0X08,0X61,0X00,0X61,0X08,0X81,0X85,0X00,0X61,0X09,0X08,0X81,
+0X08,0XC2,0X11,0XA2,0X11,0XC3,0X11,0XA2,0X1A,0X43,0X22,0XA3,0X2B,0X25,0X2B,0X24,
+0X22,0X62,0X80,0X23,0X04,0X0B,0X19,0XE3,0X11,0XA2,0X12,0X24,0X1B,0X28,0X12,0XC7,
+0X12,0X86,0X09,0X63,0X09,0X42,0X09,0X22,0X1A,0XC5,0X11,0X83,0X08,0X61,0X81,0X08,
+0X81,0X01,0X08,0XA2,0X08,0XA1,0X82,0X08,0XA2,0X80,0X08,0X81,0X82,0X08,0X82,0X00,
+0X00,0X81,0X81,0X00,0X61,0X80,0X08,0X82,0XB0,0X00,0X61,0X00,0X08,0X82,0X82,0X08,
+0XA2,0X00,0X08,0XC2,0X82,0X08,0XA2,0X01,0X08,0X82,0X00,0XA1,0X80,0X08,0XA1,0X00,
+0X08,0XA2,0X80,0X08,0XC2,0X81,0X08,0XA2,0X02,0X08,0XC2,0X08,0XA2,0X08,0X81,0X81,
+0X08,0XA2,0X80,0X00,0X82,0X01,0X08,0XA2,0X00,0XA2,0X81,0X08,0XA2,0X0D,0X08,0XC2,
+0X00,0XE3,0X08,0XA2,0X08,0XC2,0X1B,0X07,0X1B,0XA9,0X14,0X4D,0X14,0XD0,0X14,0X8F,
+0X14,0X0C,0X1B,0X88,0X11,0XE4,0X08,0XA1,0X08,0X61,0X96,0X00,0X61,0X07,0X00,0X81,
+0X09,0X02,0X2B,0X85,0X2C,0X6A,0X1A,0XA5,0X09,0X02,0X09,0X23,0X09,0X63,0X80,0X09,
+0X22,0X0B,0X11,0X83,0X12,0X05,0X12,0X67,0X0A,0XA8,0X12,0X24,0X1A,0X03,0X1A,0XA5,
+0X1A,0X44,0X09,0X22,0X08,0X61,0X00,0X61,0X08,0X61,0X8E,0X00,0X61,0X00,0X08,0XA1,
+0X80,0X08,0XE2,0X01,0X09,0X02,0X09,0X22,0X80,0X09,0X02,0X02,0X11,0X02,0X09,0X22,
+0X08,0XA2,0X87,0X00,0X61,0X02,0X08,0X61,0X00,0XA1,0X09,0X23,0X80,0X09,0X83,0X01,
+0X08,0XE2,0X00,0X82,0X82,0X00,0X61,0X01,0X00,0X81,0X08,0X61,0X80,0X08,0XA1,0X01,
+0X08,0XC1,0X09,0X02,0X80,0X08,0XE2,0X81,0X09,0X02,0X01,0X09,0X22,0X08,0XC2,0XA0,
+0X00,0X61,0X01,0X00,0X82,0X08,0XA2,0X82,0X08,0XE2,0X00,0X08,0XC2,0X81,0X08,0XA1,
+0X04,0X08,0XA2,0X08,0XC2,0X09,0X03,0X09,0X43,0X09,0X22,0X80,0X08,0XE2,0X00,0X08,
+0XA2,0X83,0X00,0X61,0X82,0X08,0X81,0X80,0X08,0XA1,0X02,0X00,0X61,0X00,0X81,0X08,
+0X81,0X86,0X00,0X61,0X11,0X08,0XA1,0X11,0X82,0X11,0XA2,0X19,0XE2,0X22,0X83,0X22,
+0XC4,0X23,0X46,0X22,0XC3,0X2B,0X45,0X22,0XE4,0X22,0X62,0X11,0X82,0X11,0XA3,0X13,
+0X29,0X14,0X0D,0X12,0XC8,0X12,0XC7,0X12,0X04,0X80,0X09,0X22,0X01,0X1A,0X64,0X12,
+0X44,0X81,0X08,0X81,0X85,0X08,0XA2,0X01,0X08,0XA1,0X08,0X81,0X80,0X00,0X81,0X01,
+0X08,0X82,0X00,0X82,0X81,0X00,0X61,0X00,0X00,0X62,0XB2,0X00,0X61,0X89,0X08,0XA2,
+0X81,0X08,0XC2,0X00,0X08,0XA2,0X80,0X08,0XA1,0X00,0X08,0XA2,0X80,0X00,0XC2,0X02,
+0X08,0XC2,0X08,0X81,0X08,0XA1,0X81,0X08,0XA2,0X01,0X00,0XA2,0X00,0X82,0X81,0X08,
+0XA2,0X00,0X00,0XA2,0X80,0X08,0XA2,0X0A,0X00,0XE3,0X08,0XA2,0X09,0X63,0X23,0X27,
+0X1A,0XA5,0X13,0XAB,0X14,0X8F,0X1B,0XAA,0X1A,0X44,0X11,0X22,0X08,0X81,0X99,0X00,
+0X61,0X12,0X11,0X42,0X33,0XC5,0X2B,0X86,0X11,0XA2,0X08,0XE2,0X09,0X02,0X09,0X22,
+0X09,0X43,0X09,0X63,0X11,0XE5,0X0A,0X46,0X0A,0X88,0X12,0XE9,0X1A,0X45,0X1A,0XA4,
+0X12,0X04,0X08,0XE2,0X08,0X81,0X08,0X61,0X91,0X00,0X61,0X08,0X08,0X61,0X08,0XA1,
+0X08,0XE2,0X09,0X02,0X09,0X42,0X11,0XE4,0X09,0X42,0X09,0X84,0X08,0XA1,0X88,0X00,
+0X61,0X05,0X08,0X81,0X08,0XA2,0X09,0X63,0X12,0X04,0X11,0XA3,0X08,0XA1,0X84,0X00,
+0X61,0X02,0X08,0X61,0X08,0X82,0X08,0XC2,0X80,0X09,0X22,0X00,0X08,0XE2,0X80,0X08,
+0XE1,0X03,0X08,0XE2,0X09,0X02,0X09,0X23,0X00,0XC2,0X9E,0X00,0X61,0X01,0X08,0X81,
+0X08,0XA2,0X81,0X08,0XC2,0X80,0X08,0XE2,0X00,0X08,0XC2,0X82,0X08,0XA1,0X00,0X09,
+0X02,0X80,0X09,0X23,0X00,0X09,0X02,0X80,0X08,0XE2,0X00,0X08,0X81,0X84,0X00,0X61,
+0X01,0X08,0X81,0X00,0X81,0X81,0X08,0X81,0X00,0X00,0X81,0X81,0X08,0X81,0X85,0X00,
+0X61,0X16,0X08,0X81,0X19,0XC2,0X11,0XC2,0X1A,0X02,0X22,0XA3,0X22,0XC4,0X23,0X25,
+0X22,0XC4,0X2B,0X24,0X2A,0XE3,0X22,0X62,0X19,0XE2,0X11,0XA3,0X13,0X8A,0X0B,0XCD,
+0X13,0XEC,0X12,0XA7,0X1A,0X85,0X11,0X82,0X09,0X22,0X12,0X24,0X1A,0X85,0X08,0XE2,
+0X80,0X08,0X81,0X84,0X08,0XA2,0X01,0X08,0XC2,0X08,0XA2,0X81,0X08,0X81,0XB8,0X00,
+0X61,0X8A,0X08,0XA2,0X00,0X08,0XC2,0X83,0X08,0XA2,0X00,0X08,0XE2,0X80,0X08,0XC2,
+0X00,0X08,0XA1,0X82,0X08,0XA2,0X0C,0X00,0XA2,0X08,0XA2,0X00,0XA2,0X08,0XA2,0X00,
+0XE3,0X08,0XE3,0X08,0XC2,0X08,0XE3,0X01,0X04,0X00,0XE3,0X1A,0X45,0X1A,0X64,0X1A,
+0X23,0X80,0X1B,0XA9,0X02,0X1A,0X44,0X08,0XE1,0X08,0X61,0X80,0X00,0X61,0X00,0X08,
+0X61,0X80,0X00,0X61,0X00,0X08,0X61,0X94,0X00,0X61,0X10,0X19,0XA2,0X33,0XC4,0X22,
+0X83,0X09,0X02,0X08,0XE2,0X09,0X22,0X09,0X43,0X09,0X83,0X09,0XE4,0X0A,0X47,0X0A,
+0X67,0X0A,0X88,0X12,0XC8,0X1A,0X85,0X12,0X24,0X08,0XE2,0X08,0X61,0X82,0X00,0X61,
+0X00,0X08,0X81,0X90,0X00,0X61,0X06,0X08,0X81,0X08,0XC1,0X09,0X22,0X11,0X42,0X09,
+0XC4,0X12,0X87,0X08,0XA2,0X89,0X00,0X61,0X05,0X08,0X61,0X08,0XC2,0X09,0X43,0X12,
+0X04,0X09,0X42,0X08,0X81,0X85,0X00,0X61,0X02,0X08,0X81,0X08,0XC2,0X08,0XE2,0X81,
+0X09,0X02,0X81,0X09,0X22,0X01,0X09,0X02,0X08,0XC2,0X9C,0X00,0X61,0X00,0X08,0X81,
+0X80,0X08,0XC2,0X00,0X08,0XE2,0X82,0X08,0XC2,0X00,0X08,0XC1,0X81,0X08,0XA1,0X02,
+0X08,0XC2,0X09,0X23,0X09,0X22,0X81,0X09,0X02,0X01,0X08,0XE2,0X08,0X61,0X84,0X00,
+0X61,0X82,0X08,0X81,0X00,0X00,0X81,0X83,0X08,0X81,0X00,0X00,0X61,0X81,0X08,0X81,
+0X81,0X00,0X61,0X80,0X1A,0X23,0X0F,0X1A,0X02,0X1A,0X23,0X22,0X63,0X22,0X83,0X1A,
+0X63,0X2A,0XC3,0X22,0XC3,0X22,0XA3,0X1A,0X43,0X12,0X66,0X13,0XAC,0X0C,0X4F,0X0C,
+0X6F,0X13,0XCC,0X12,0XA7,0X12,0X85,0X80,0X11,0XC3,0X01,0X1A,0X84,0X09,0X63,0X80,
+0X08,0X81,0X84,0X08,0XA2,0X04,0X08,0XC2,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X08,0X81,
+0XB7,0X00,0X61,0X02,0X08,0X61,0X08,0XA2,0X08,0XA1,0X81,0X08,0XA2,0X01,0X08,0XC2,
+0X08,0XA2,0X80,0X08,0XC2,0X81,0X08,0XA2,0X00,0X08,0XC2,0X83,0X08,0XA2,0X80,0X00,
+0XC2,0X80,0X08,0XA2,0X80,0X08,0XC2,0X83,0X08,0XA2,0X03,0X00,0XA2,0X01,0X23,0X01,
+0XA6,0X01,0X45,0X80,0X01,0X65,0X06,0X01,0X44,0X1A,0X24,0X19,0XC2,0X1A,0X43,0X23,
+0X04,0X1A,0X64,0X09,0X02,0X80,0X08,0X61,0X9A,0X00,0X61,0X02,0X19,0XE2,0X2B,0X23,
+0X11,0X82,0X80,0X08,0XE2,0X09,0X09,0X22,0X09,0X63,0X11,0XC4,0X12,0X25,0X0A,0X87,
+0X12,0X87,0X12,0XA8,0X12,0XC7,0X12,0X25,0X08,0XE2,0X80,0X08,0X81,0X00,0X00,0X81,
+0X92,0X00,0X61,0X80,0X08,0X61,0X80,0X00,0X61,0X04,0X08,0XA1,0X09,0X43,0X09,0X42,
+0X12,0X26,0X08,0XC2,0X8B,0X00,0X61,0X03,0X08,0XA1,0X09,0X62,0X11,0X83,0X08,0XC1,
+0X88,0X00,0X61,0X80,0X08,0XA2,0X03,0X08,0XC2,0X09,0X23,0X09,0X83,0X09,0X43,0X80,
+0X09,0X02,0X01,0X08,0XC2,0X08,0X81,0X99,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XC2,
+0X80,0X08,0XC1,0X04,0X08,0XE2,0X08,0XC1,0X08,0XC2,0X08,0XC1,0X08,0XA2,0X81,0X08,
+0XA1,0X01,0X08,0XE2,0X09,0X23,0X81,0X09,0X02,0X01,0X09,0X22,0X08,0XE2,0X86,0X00,
+0X61,0X00,0X00,0X81,0X81,0X08,0X81,0X00,0X00,0X81,0X84,0X08,0X81,0X01,0X00,0X61,
+0X08,0X81,0X81,0X00,0X61,0X07,0X1A,0X22,0X1A,0X42,0X1A,0X02,0X19,0XE2,0X1A,0X22,
+0X22,0X63,0X1A,0X42,0X22,0XE3,0X80,0X2A,0XE3,0X0C,0X1A,0X63,0X12,0X66,0X13,0XED,
+0X0C,0X0E,0X0B,0X8C,0X0C,0X4F,0X13,0XED,0X13,0X8B,0X12,0XC8,0X12,0X05,0X1A,0X44,
+0X11,0XE4,0X08,0XA1,0X80,0X08,0X81,0X02,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X81,0X08,
+0XC2,0X00,0X08,0XA1,0X81,0X08,0XA2,0X00,0X00,0X62,0XB7,0X00,0X61,0X01,0X08,0XA2,
+0X08,0XC2,0X80,0X08,0XA2,0X01,0X08,0XC2,0X08,0XA2,0X81,0X08,0XC2,0X85,0X08,0XA2,
+0X00,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,0XC2,0X80,0X08,0XA2,0X01,0X08,0XC2,0X00,
+0XC2,0X82,0X08,0XA2,0X0E,0X08,0XA1,0X00,0XA2,0X00,0XC3,0X01,0XA6,0X01,0X65,0X01,
+0X45,0X01,0XA7,0X09,0X85,0X11,0XE3,0X1B,0X27,0X23,0X46,0X22,0X83,0X11,0X42,0X00,
+0X81,0X08,0X61,0X9A,0X00,0X61,0X14,0X08,0X82,0X11,0XA2,0X19,0XE2,0X08,0XE2,0X09,
+0X02,0X08,0XE2,0X09,0X02,0X11,0X83,0X11,0XE4,0X12,0X67,0X12,0XA7,0X12,0X87,0X12,
+0XC7,0X12,0XA6,0X11,0X62,0X00,0X62,0X00,0X61,0X00,0X81,0X08,0X81,0X00,0X61,0X00,
+0X62,0X8E,0X00,0X61,0X81,0X08,0X81,0X00,0X00,0X81,0X81,0X00,0X61,0X03,0X08,0XA2,
+0X09,0X02,0X09,0X83,0X09,0X02,0X8C,0X00,0X61,0X02,0X08,0XE2,0X09,0X62,0X09,0X22,
+0X8B,0X00,0X61,0X01,0X00,0XA1,0X08,0XE2,0X80,0X09,0X02,0X03,0X09,0X43,0X09,0X03,
+0X08,0XC2,0X08,0X81,0X98,0X00,0X61,0X00,0X08,0XA2,0X80,0X08,0XE2,0X04,0X08,0XC2,
+0X08,0XA1,0X08,0XC1,0X08,0XC2,0X08,0XA1,0X80,0X08,0XA2,0X81,0X08,0XA1,0X82,0X09,
+0X02,0X80,0X09,0X22,0X00,0X08,0XC2,0X87,0X00,0X61,0X87,0X08,0X81,0X01,0X00,0X61,
+0X08,0X81,0X82,0X00,0X61,0X17,0X22,0XA3,0X22,0X82,0X1A,0X22,0X19,0XE2,0X1A,0X02,
+0X22,0X62,0X22,0X63,0X22,0X62,0X22,0X82,0X22,0XA2,0X22,0X63,0X09,0X22,0X09,0X85,
+0X13,0X4A,0X0B,0X8C,0X0C,0X4F,0X0C,0X70,0X0C,0X90,0X0C,0X6F,0X14,0X4E,0X13,0X28,
+0X11,0XE4,0X08,0XE2,0X08,0X81,0X80,0X08,0XA1,0X80,0X08,0XA2,0X02,0X08,0XA1,0X08,
+0XC1,0X08,0XE2,0X80,0X08,0XC2,0X80,0X08,0XA2,0X00,0X08,0XA1,0X93,0X00,0X61,0X80,
+0X00,0X41,0X9E,0X00,0X61,0X80,0X00,0X41,0X04,0X00,0X81,0X00,0X61,0X00,0X41,0X00,
+0X61,0X08,0XA2,0X81,0X08,0XC2,0X05,0X08,0XA2,0X00,0XC2,0X08,0XC2,0X08,0XA1,0X08,
+0XC2,0X08,0XA2,0X80,0X08,0XC2,0X80,0X08,0XA2,0X80,0X08,0XC2,0X81,0X08,0XA2,0X80,
+0X08,0XC2,0X01,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,0X0C,0X00,0XA2,0X00,0X82,0X01,
+0X03,0X01,0X86,0X02,0X08,0X09,0XC6,0X09,0XA3,0X23,0X88,0X24,0XCD,0X24,0X29,0X1A,
+0X23,0X08,0XA1,0X08,0X61,0X9B,0X00,0X61,0X01,0X08,0X81,0X09,0X02,0X80,0X08,0XC2,
+0X0D,0X08,0XE2,0X08,0XC2,0X09,0X02,0X11,0XA3,0X12,0X25,0X12,0XA8,0X12,0XE9,0X12,
+0XE8,0X12,0XC7,0X11,0XC3,0X08,0XC2,0X08,0X61,0X00,0X81,0X00,0X62,0X82,0X00,0X61,
+0X00,0X00,0X62,0X86,0X00,0X61,0X00,0X00,0X62,0X83,0X00,0X61,0X80,0X08,0X82,0X84,
+0X00,0X61,0X04,0X08,0XA1,0X09,0X02,0X08,0XE2,0X00,0X61,0X08,0X61,0X8A,0X00,0X61,
+0X04,0X08,0X81,0X09,0X02,0X09,0X22,0X08,0X81,0X08,0X61,0X89,0X00,0X61,0X00,0X00,
+0X41,0X80,0X00,0X61,0X06,0X08,0XC2,0X09,0X43,0X09,0X42,0X09,0X02,0X08,0XE2,0X08,
+0X81,0X08,0X61,0X95,0X00,0X61,0X04,0X08,0X82,0X08,0XE2,0X09,0X22,0X08,0XE2,0X08,
+0XC2,0X80,0X08,0XA2,0X81,0X08,0XA1,0X80,0X08,0XA2,0X02,0X08,0XA1,0X08,0XC1,0X09,
+0X22,0X80,0X09,0X02,0X04,0X09,0X22,0X09,0X43,0X09,0X23,0X08,0X81,0X08,0X61,0X85,
+0X00,0X61,0X00,0X00,0X81,0X85,0X08,0X81,0X00,0X00,0X61,0X80,0X08,0X81,0X82,0X00,
+0X61,0X08,0X08,0X81,0X11,0X62,0X22,0XA3,0X22,0XC3,0X22,0X62,0X1A,0X22,0X1A,0X23,
+0X22,0X83,0X22,0X62,0X80,0X2A,0XC3,0X07,0X22,0X83,0X11,0X62,0X08,0X41,0X08,0X81,
+0X0A,0X06,0X13,0X8B,0X0B,0XEE,0X0C,0X0F,0X80,0X0C,0X2F,0X04,0X0B,0X6C,0X12,0X45,
+0X09,0X43,0X08,0XA1,0X08,0XA2,0X80,0X08,0XA1,0X00,0X08,0XA2,0X80,0X08,0XA1,0X03,
+0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XC1,0X80,0X08,0XA2,0X00,0X08,0X81,0X8A,0X00,
+0X61,0X02,0X38,0X80,0X71,0X61,0X79,0X81,0X80,0X79,0X61,0X03,0X79,0X62,0X79,0X61,
+0X79,0X62,0X71,0X81,0X81,0X79,0X62,0X02,0X71,0X81,0X71,0X41,0X10,0X20,0X91,0X00,
+0X61,0X04,0X10,0X20,0X69,0X40,0X81,0X62,0X79,0X81,0X79,0X61,0X80,0X81,0X61,0X81,
+0X79,0X61,0X00,0X79,0X41,0X80,0X71,0X42,0X01,0X69,0X02,0X20,0X61,0X80,0X08,0XA2,
+0X81,0X08,0XC2,0X0B,0X00,0XC2,0X00,0X00,0X48,0X64,0X50,0XC5,0X48,0XC5,0X48,0XA6,
+0X40,0XA6,0X40,0X87,0X38,0XA6,0X38,0X87,0X30,0X87,0X30,0X88,0X81,0X28,0X69,0X0E,
+0X10,0X26,0X00,0XA2,0X08,0XA1,0X08,0XA2,0X08,0X82,0X08,0XA2,0X08,0XA1,0X00,0XE3,
+0X01,0X45,0X09,0X43,0X1A,0X64,0X24,0X49,0X24,0X09,0X2B,0X85,0X11,0XA2,0X80,0X00,
+0X61,0X05,0X08,0X61,0X00,0XEB,0X01,0X0C,0X01,0X2D,0X01,0X4C,0X01,0X6B,0X80,0X01,
+0X8D,0X08,0X01,0XAD,0X01,0XCD,0X01,0XED,0X0A,0X0D,0X0A,0X2D,0X0A,0X4D,0X0A,0X6D,
+0X02,0X6D,0X02,0X4C,0X8A,0X00,0X61,0X04,0X08,0X81,0X08,0XA1,0X02,0X48,0X03,0X8B,
+0X03,0X6B,0X80,0X03,0X6A,0X80,0X03,0X69,0X01,0X03,0X49,0X03,0X48,0X80,0X03,0X47,
+0X04,0X0B,0X27,0X0B,0X67,0X03,0X06,0X0B,0X46,0X00,0XA1,0X8E,0X00,0X61,0X13,0X00,
+0X81,0X00,0XE1,0X0B,0X60,0X1B,0XE0,0X2C,0X81,0X35,0X01,0X45,0X40,0X45,0X60,0X55,
+0XA0,0X55,0XC0,0X6D,0XC0,0X6D,0XA0,0X6D,0X60,0X75,0X40,0X75,0X01,0X6C,0XA1,0X63,
+0XE0,0X53,0X40,0X4A,0XA0,0X08,0X81,0X87,0X00,0X61,0X02,0X08,0XA2,0X08,0XE2,0X08,
+0X81,0X88,0X00,0X61,0X07,0X08,0X81,0X39,0XC1,0X8B,0XE1,0XAC,0XE0,0XD5,0XC0,0XE6,
+0X20,0XF6,0X80,0XFE,0XC0,0X80,0XFE,0XE0,0X08,0XFF,0X00,0XFE,0XE0,0XF6,0XA0,0XE6,
+0X40,0XD5,0XA0,0XC5,0X20,0X93,0XE0,0X72,0XE1,0X08,0X81,0X8B,0X00,0X61,0X00,0X08,
+0X81,0X80,0X00,0X61,0X01,0X08,0X82,0X08,0XE2,0X80,0X09,0X02,0X02,0X08,0XE2,0X08,
+0XC2,0X08,0XC1,0X80,0X08,0XA1,0X81,0X08,0XA2,0X01,0X08,0X81,0X08,0XC2,0X80,0X09,
+0X02,0X00,0X09,0X23,0X80,0X09,0X43,0X01,0X08,0XC2,0X08,0X81,0X87,0X00,0X61,0X84,
+0X08,0X81,0X82,0X00,0X61,0X00,0X08,0X81,0X81,0X00,0X61,0X0D,0X08,0X81,0X00,0X61,
+0X08,0XA1,0X19,0XC3,0X22,0X83,0X1A,0X23,0X1A,0X22,0X1A,0X42,0X22,0XA3,0X22,0X82,
+0X22,0XA3,0X22,0X83,0X11,0XC2,0X00,0X61,0X80,0X08,0X61,0X09,0X09,0X64,0X13,0X09,
+0X13,0X49,0X13,0XAB,0X0C,0X0E,0X0B,0XAC,0X12,0X05,0X09,0X22,0X08,0XA1,0X08,0XA2,
+0X83,0X08,0XA1,0X82,0X08,0XC2,0X00,0X08,0XC1,0X80,0X08,0XA1,0X8A,0X00,0X61,0X0E,
+0X99,0XA1,0XF2,0XE1,0XFA,0XE1,0XFA,0XA2,0XFA,0XA1,0XFA,0XC2,0XFA,0XA2,0XFA,0XA1,
+0XF2,0XE1,0XFA,0XA2,0XFA,0XC2,0XFA,0X82,0XF2,0XC2,0XF3,0X03,0X79,0X60,0X91,0X00,
+0X61,0X04,0X69,0X01,0XEA,0XC3,0XFA,0XA3,0XFA,0X82,0XFA,0XA4,0X80,0XFA,0XC2,0X09,
+0XF2,0XA2,0XF2,0XA3,0XEA,0XA3,0XEA,0X84,0XEA,0X64,0XE2,0X64,0XDA,0X86,0X91,0X85,
+0X08,0XA1,0X00,0XC2,0X82,0X08,0XC2,0X1D,0X30,0X62,0X89,0XAA,0X99,0XAB,0X89,0X6B,
+0X89,0X4C,0X79,0X4D,0X79,0X2D,0X69,0X2D,0X61,0X0F,0X61,0X0E,0X50,0XEF,0X50,0XF0,
+0X48,0XD1,0X40,0XD2,0X30,0X8D,0X08,0XE3,0X08,0XA2,0X00,0XA2,0X08,0XA2,0X00,0XA2,
+0X08,0XA2,0X08,0XC2,0X08,0XE3,0X11,0XC3,0X2B,0X44,0X2B,0XE6,0X2B,0X85,0X22,0XC3,
+0X11,0X22,0X08,0X61,0X80,0X00,0X61,0X0D,0X01,0XF9,0X0A,0X3A,0X0A,0X3B,0X0A,0XBA,
+0X0A,0XFA,0X0B,0X1B,0X03,0X3B,0X13,0X7B,0X03,0XFA,0X04,0X1A,0X04,0X3B,0X04,0X7A,
+0X04,0XBA,0X05,0X1A,0X80,0X05,0X3A,0X00,0X00,0X62,0X89,0X00,0X61,0X12,0X08,0X81,
+0X00,0X81,0X0D,0X92,0X0E,0XD6,0X06,0XB5,0X06,0XB4,0X06,0XB3,0X06,0XB2,0X06,0X92,
+0X06,0X91,0X06,0X90,0X06,0X8F,0X06,0X8D,0X06,0X2D,0X06,0X4C,0X06,0X2C,0X06,0X4B,
+0X04,0XE7,0X00,0X82,0X83,0X00,0X61,0X80,0X00,0X62,0X00,0X08,0X82,0X80,0X00,0X61,
+0X80,0X08,0X82,0X04,0X00,0X61,0X0B,0X01,0X1C,0X81,0X25,0X40,0X25,0X80,0X80,0X35,
+0XA0,0X80,0X3D,0XC0,0X0F,0X45,0XC0,0X55,0XC0,0X5D,0XC0,0X65,0XE1,0X66,0X00,0X76,
+0X20,0X7E,0X20,0X86,0X40,0X96,0X40,0X9E,0X60,0XAE,0X80,0XB6,0X80,0XB6,0X60,0XB6,
+0XA0,0XAD,0XC1,0X8C,0XA0,0X83,0X00,0X61,0X00,0X00,0X81,0X80,0X00,0X61,0X01,0X08,
+0X81,0X08,0X61,0X86,0X00,0X61,0X03,0X4A,0X21,0XC5,0XA0,0XF6,0XC0,0XFF,0X00,0X80,
+0XFF,0X20,0X80,0XFF,0X00,0X84,0XFE,0XE0,0X00,0XFF,0X00,0X81,0XFF,0X20,0X05,0XFF,
+0X40,0XFF,0X20,0XF6,0XE0,0XCD,0XE0,0X83,0XA0,0X08,0X61,0X88,0X00,0X61,0X03,0X08,
+0X81,0X00,0X61,0X00,0X62,0X08,0XA2,0X84,0X08,0XC2,0X03,0X08,0XC1,0X08,0XC2,0X08,
+0XA2,0X08,0XA1,0X80,0X08,0X81,0X05,0X08,0XA2,0X09,0X02,0X09,0X23,0X09,0X43,0X09,
+0X63,0X09,0X22,0X80,0X08,0X81,0X89,0X00,0X61,0X82,0X08,0X81,0X86,0X00,0X61,0X19,
+0X08,0X81,0X00,0X61,0X00,0X41,0X08,0X61,0X08,0XE2,0X1A,0X03,0X22,0XA3,0X1A,0X42,
+0X22,0X42,0X22,0X62,0X1A,0X42,0X22,0X62,0X22,0X43,0X08,0XE1,0X08,0X61,0X00,0X61,
+0X08,0X61,0X08,0XE2,0X11,0X83,0X12,0X24,0X12,0XE8,0X0B,0XAC,0X12,0X46,0X09,0X22,
+0X08,0XA1,0X08,0XA2,0X83,0X08,0XA1,0X02,0X08,0XC1,0X08,0XC2,0X08,0XC1,0X82,0X08,
+0XC2,0X01,0X08,0XA2,0X08,0X82,0X88,0X00,0X61,0X0A,0XA9,0XC2,0XF2,0XE1,0XE2,0XC2,
+0XEA,0X83,0XEA,0X82,0XEA,0XC2,0XEA,0X82,0XEA,0X81,0XEA,0XC1,0XEA,0X82,0XEA,0XA2,
+0X80,0XEA,0X82,0X01,0XF2,0XC3,0X89,0X81,0X91,0X00,0X61,0X04,0X71,0X61,0XF2,0XE2,
+0XEA,0XA0,0XEA,0XA1,0XEA,0X82,0X80,0XE2,0XA2,0X03,0XE2,0X82,0XDA,0X83,0XD2,0X84,
+0XD2,0X64,0X80,0XCA,0X45,0X04,0XDA,0X44,0XA1,0XC5,0X08,0XA2,0X09,0X23,0X08,0XA2,
+0X80,0X08,0XC2,0X11,0X08,0XA2,0X30,0X83,0X89,0XAA,0X89,0X6B,0X81,0X2B,0X81,0X0D,
+0X71,0X0D,0X70,0XEE,0X61,0X0E,0X60,0XD0,0X58,0XD0,0X50,0XD0,0X48,0XB1,0X40,0XB2,
+0X38,0XB4,0X30,0XB0,0X09,0X03,0X00,0XA2,0X81,0X08,0XA2,0X00,0X00,0XA2,0X80,0X08,
+0XA2,0X00,0X1A,0X24,0X80,0X34,0X06,0X02,0X23,0X04,0X11,0XA3,0X08,0X81,0X81,0X00,
+0X61,0X10,0X09,0XD6,0X02,0X99,0X02,0X79,0X0A,0XDA,0X02,0XFA,0X03,0X39,0X03,0X99,
+0X0B,0X98,0X0B,0XD9,0X0B,0XF9,0X0C,0X39,0X0C,0X79,0X04,0X99,0X04,0XF9,0X0D,0X59,
+0X0D,0X79,0X03,0XB0,0X89,0X00,0X61,0X13,0X00,0X81,0X03,0X4C,0X06,0XB6,0X06,0X95,
+0X06,0X54,0X06,0X53,0X06,0X52,0X06,0X51,0X06,0X50,0X06,0X2F,0X06,0X2E,0X06,0X2D,
+0X06,0X0B,0X05,0XCB,0X05,0XEA,0X05,0XE9,0X06,0X08,0X0B,0XE5,0X00,0X62,0X00,0X81,
+0X83,0X00,0X61,0X80,0X08,0X82,0X80,0X00,0X61,0X06,0X00,0X81,0X0B,0XC0,0X15,0X40,
+0X15,0XC0,0X1D,0X80,0X25,0X60,0X35,0X80,0X80,0X3D,0X80,0X12,0X45,0X80,0X4D,0XA0,
+0X5D,0XC0,0X65,0XC0,0X6D,0XC0,0X6D,0XA0,0X75,0XC0,0X85,0XE0,0X8E,0X00,0X96,0X00,
+0X96,0X20,0X9E,0X20,0XAE,0X41,0XB6,0X41,0XC6,0X80,0XBE,0X80,0XCE,0XC0,0XDF,0X21,
+0X31,0XC0,0X80,0X00,0X61,0X02,0X08,0X81,0X00,0X61,0X08,0X81,0X85,0X00,0X61,0X00,
+0X00,0X81,0X80,0X00,0X61,0X03,0X7B,0X80,0XDE,0X80,0XFF,0X60,0XFF,0X20,0X83,0XFE,
+0XE0,0X80,0XFF,0X00,0X00,0XF7,0X00,0X81,0XFE,0XC0,0X83,0XFE,0XE0,0X00,0XFE,0XC0,
+0X80,0XFF,0X00,0X80,0XFF,0X40,0X01,0XE6,0X80,0X8B,0XE1,0X87,0X00,0X61,0X06,0X08,
+0X61,0X00,0X61,0X00,0X81,0X08,0XA2,0X08,0XC2,0X08,0XC1,0X08,0XA1,0X80,0X08,0XC2,
+0X80,0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,0XA1,0X80,0X08,0X81,0X00,0X08,0XA2,0X80,
+0X09,0X23,0X03,0X09,0X63,0X09,0X83,0X08,0XC2,0X00,0X81,0X8A,0X00,0X61,0X80,0X08,
+0X81,0X00,0X00,0X81,0X83,0X00,0X61,0X00,0X08,0X81,0X81,0X00,0X61,0X00,0X08,0X81,
+0X82,0X00,0X61,0X04,0X08,0XC2,0X11,0X83,0X22,0X43,0X22,0X42,0X1A,0X22,0X80,0X22,
+0X42,0X02,0X22,0X83,0X11,0XC2,0X08,0X61,0X81,0X00,0X61,0X0A,0X08,0XA1,0X09,0X22,
+0X11,0XC3,0X12,0XE8,0X13,0X08,0X11,0X63,0X08,0XC1,0X08,0X82,0X08,0XA1,0X08,0XC1,
+0X08,0XA2,0X82,0X08,0XA1,0X00,0X08,0XC1,0X80,0X08,0XC2,0X00,0X08,0XC1,0X80,0X08,
+0XC2,0X01,0X08,0XA2,0X08,0X81,0X87,0X00,0X61,0X03,0XB9,0XE1,0XF2,0XC1,0XE2,0XA3,
+0XEA,0X83,0X81,0XEA,0XA2,0X02,0XEA,0X82,0XE2,0XA1,0XEA,0X82,0X80,0XEA,0XA2,0X02,
+0XE2,0XA1,0XF2,0XA2,0X99,0X60,0X91,0X00,0X61,0X04,0X79,0X20,0XF2,0XA2,0XEA,0XA2,
+0XEA,0XC3,0XE2,0X82,0X81,0XE2,0X83,0X00,0XDA,0X83,0X80,0XD2,0X64,0X05,0XCA,0X45,
+0XC2,0X45,0XC2,0X24,0X99,0XA6,0X08,0XA2,0X09,0X23,0X82,0X08,0XC2,0X1B,0X30,0X83,
+0X81,0X8B,0X79,0X2B,0X71,0X2C,0X71,0X2D,0X61,0X0D,0X61,0X0F,0X58,0XEF,0X50,0XCF,
+0X48,0XD0,0X40,0XD0,0X40,0XD1,0X38,0XB1,0X30,0X93,0X28,0XB1,0X08,0XC2,0X08,0XA2,
+0X08,0XA1,0X00,0XA2,0X08,0X82,0X08,0XA2,0X08,0XC2,0X08,0XA2,0X11,0XA3,0X2B,0X05,
+0X22,0XA4,0X11,0X83,0X08,0X82,0X82,0X00,0X61,0X10,0X08,0XED,0X0A,0XB9,0X02,0XD9,
+0X0A,0XF9,0X0B,0X19,0X0B,0X58,0X0B,0XB9,0X0B,0XD8,0X0C,0X18,0X0C,0X59,0X0C,0X99,
+0X0C,0XB9,0X0C,0XD9,0X0D,0X19,0X0D,0X59,0X0D,0X79,0X0D,0X98,0X8A,0X00,0X61,0X02,
+0X05,0XF3,0X06,0X96,0X06,0X54,0X80,0X06,0X52,0X0A,0X06,0X51,0X06,0X50,0X06,0X2F,
+0X06,0X0E,0X06,0X0D,0X06,0X0C,0X05,0XCA,0X0D,0XCA,0X05,0XE9,0X05,0XC7,0X0D,0X27,
+0X86,0X00,0X61,0X00,0X08,0X82,0X80,0X00,0X61,0X04,0X03,0XA0,0X14,0XE0,0X1D,0XA0,
+0X15,0X80,0X1D,0X40,0X80,0X2D,0X60,0X01,0X2D,0X80,0X3D,0X80,0X80,0X45,0XA0,0X11,
+0X4D,0XA0,0X5D,0XC0,0X65,0XC0,0X6D,0XE0,0X76,0X00,0X86,0X00,0X8E,0X00,0X96,0X00,
+0X96,0X20,0X9E,0X40,0XA6,0X60,0XAE,0X80,0XB6,0X80,0XC6,0X60,0XCE,0X80,0XD6,0X80,
+0XDF,0X00,0X31,0XA0,0X83,0X08,0X81,0X02,0X00,0X81,0X00,0X61,0X08,0X61,0X83,0X00,
+0X61,0X02,0X08,0X81,0XBD,0X80,0XFF,0X60,0X80,0XFF,0X00,0X81,0XFE,0XE0,0X80,0XFF,
+0X00,0X80,0XFE,0XE0,0X80,0XFE,0XE1,0X86,0XFF,0X00,0X80,0XFE,0XE0,0X06,0XFE,0XC0,
+0XFE,0XC1,0XF6,0XE0,0XFF,0X60,0XFF,0X40,0XDD,0XE0,0X10,0XA1,0X87,0X00,0X61,0X00,
+0X08,0X81,0X81,0X08,0XA1,0X83,0X08,0XC2,0X02,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X80,
+0X08,0X81,0X06,0X08,0XA1,0X08,0XE2,0X09,0X02,0X09,0X43,0X09,0X03,0X08,0X81,0X00,
+0X81,0X93,0X00,0X61,0X82,0X08,0X81,0X83,0X00,0X61,0X02,0X08,0X61,0X11,0X22,0X22,
+0X63,0X80,0X1A,0X22,0X03,0X1A,0X02,0X1A,0X42,0X1A,0X63,0X08,0XA1,0X83,0X00,0X61,
+0X04,0X10,0XE2,0X11,0XC3,0X1A,0XC7,0X12,0X25,0X09,0X02,0X80,0X00,0X81,0X80,0X08,
+0XC2,0X80,0X08,0XC1,0X82,0X08,0XA1,0X81,0X08,0XC2,0X03,0X08,0XE2,0X08,0XC2,0X08,
+0XA2,0X08,0X81,0X86,0X00,0X61,0X0E,0XB1,0XC2,0XF2,0XA2,0XE2,0XA3,0XF2,0X82,0XEA,
+0XA1,0XEA,0X81,0XE2,0XA2,0XEA,0XA3,0XE2,0X82,0XF2,0X83,0XEA,0X82,0XEA,0XA2,0XE2,
+0XC2,0XF2,0XC2,0X91,0X60,0X91,0X00,0X61,0X04,0X79,0X00,0XFA,0XC3,0XEA,0XA2,0XEA,
+0X83,0XEA,0X82,0X80,0XE2,0X63,0X03,0XDA,0X64,0XD2,0X64,0XD2,0X44,0XCA,0X45,0X80,
+0XC2,0X25,0X03,0XC2,0X07,0X99,0X87,0X00,0XA2,0X09,0X02,0X82,0X08,0XC2,0X1A,0X30,
+0X44,0X81,0X4B,0X71,0X2C,0X69,0X2E,0X61,0X0D,0X59,0X0D,0X60,0XEF,0X58,0XAF,0X48,
+0XD0,0X40,0XB1,0X40,0XD1,0X38,0XD2,0X38,0XD1,0X30,0X93,0X28,0X91,0X08,0XA2,0X08,
+0XC2,0X08,0XA2,0X00,0XC2,0X00,0XA2,0X00,0XC3,0X01,0X03,0X00,0XC2,0X08,0XA2,0X10,
+0XE2,0X08,0XC2,0X08,0X61,0X84,0X00,0X61,0X10,0X02,0X54,0X03,0X3A,0X0B,0X38,0X0B,
+0X78,0X0B,0X97,0X0B,0XD9,0X0C,0X18,0X04,0X58,0X0C,0X98,0X0C,0XB8,0X0C,0XD8,0X0D,
+0X18,0X0D,0X38,0X0D,0X79,0X0D,0X99,0X0E,0X1A,0X03,0XCE,0X88,0X00,0X61,0X0C,0X0B,
+0XAC,0X06,0XD5,0X06,0X34,0X06,0X53,0X06,0X51,0X06,0X50,0X06,0X4F,0X06,0X2E,0X06,
+0X0E,0X06,0X0D,0X05,0XEC,0X05,0XEB,0X05,0XEA,0X80,0X05,0XC8,0X01,0X06,0X08,0X09,
+0X42,0X80,0X00,0X61,0X00,0X08,0X82,0X83,0X00,0X61,0X06,0X08,0X82,0X00,0X81,0X0C,
+0X01,0X15,0X80,0X1D,0X41,0X1D,0X20,0X1D,0X40,0X80,0X25,0XA0,0X00,0X35,0X80,0X80,
+0X45,0X80,0X15,0X4D,0XA0,0X55,0XC0,0X5D,0XC0,0X65,0XC0,0X6D,0XE0,0X75,0XE0,0X7E,
+0X00,0X86,0X00,0X8E,0X20,0X9E,0X40,0XA6,0X40,0XAE,0X60,0XB6,0X40,0XBE,0X60,0XC6,
+0X60,0XCE,0X80,0XD6,0XA1,0XDE,0X80,0XE7,0X00,0X39,0XA0,0X00,0X81,0X08,0X81,0X80,
+0X00,0X81,0X80,0X08,0X81,0X84,0X00,0X61,0X06,0X10,0XA1,0XDE,0X60,0XFF,0X41,0XFE,
+0XE0,0XFF,0X00,0XFE,0XE0,0XFE,0XA1,0X85,0XFE,0XE0,0X80,0XFE,0XC0,0X86,0XFE,0XE0,
+0X08,0XFF,0X00,0XFE,0XE0,0XFF,0X00,0XFE,0XE0,0XFE,0XC1,0XFF,0X01,0XFF,0X20,0XE6,
+0XA2,0X18,0XE1,0X84,0X00,0X61,0X80,0X08,0X61,0X02,0X00,0X81,0X08,0X81,0X08,0XA1,
+0X81,0X08,0XC2,0X81,0X08,0XA2,0X00,0X08,0XA1,0X83,0X08,0X81,0X05,0X08,0XA2,0X08,
+0XC2,0X08,0XE2,0X08,0XA2,0X08,0X61,0X00,0X81,0X94,0X00,0X61,0X80,0X08,0X81,0X00,
+0X08,0X61,0X82,0X00,0X61,0X09,0X08,0X41,0X00,0X61,0X08,0X61,0X08,0XE2,0X22,0X63,
+0X1A,0X42,0X1A,0X03,0X19,0XC2,0X1A,0X63,0X09,0X01,0X81,0X00,0X61,0X0E,0X00,0X62,
+0X00,0X61,0X08,0X81,0X09,0X02,0X11,0XC3,0X12,0X85,0X11,0X83,0X08,0X81,0X00,0X61,
+0X08,0X61,0X08,0XA1,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XC1,0X80,0X08,0XA1,0X02,
+0X08,0XA2,0X08,0XA1,0X08,0XC1,0X81,0X08,0XE2,0X01,0X08,0XA2,0X00,0X81,0X85,0X00,
+0X61,0X0E,0XB1,0XC2,0XF2,0XC2,0XEA,0XA3,0XF2,0X81,0XEA,0XA1,0XEA,0X82,0XEA,0XA2,
+0XEA,0X83,0XEA,0XA2,0XF2,0XA3,0XEA,0X62,0XEA,0X82,0XEA,0XA1,0XF2,0XE3,0X89,0X80,
+0X91,0X00,0X61,0X04,0X79,0X00,0XF2,0XC2,0XE2,0X62,0XEA,0X62,0XEA,0XA2,0X80,0XDA,
+0X82,0X80,0XD2,0X63,0X01,0XCA,0X44,0XC2,0X44,0X80,0XBA,0X25,0X05,0XB9,0XE7,0X91,
+0X67,0X00,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X80,0X08,0XC2,0X10,0X30,0X24,0X79,
+0X4C,0X71,0X0D,0X69,0X0E,0X60,0XEE,0X58,0XEE,0X58,0XCF,0X50,0XD0,0X48,0XB1,0X40,
+0XB1,0X38,0XD1,0X30,0XB3,0X30,0XB2,0X30,0X93,0X20,0X92,0X00,0XA2,0X08,0XC2,0X81,
+0X00,0XE3,0X05,0X01,0X24,0X01,0X04,0X00,0XE3,0X00,0XA2,0X00,0X82,0X00,0X61,0X80,
+0X08,0X61,0X83,0X00,0X61,0X10,0X00,0X83,0X0B,0X17,0X03,0X9A,0X0B,0XB9,0X0B,0XD8,
+0X03,0XF9,0X04,0X39,0X04,0X99,0X0C,0XB9,0X04,0XD9,0X04,0XF9,0X0D,0X5A,0X0D,0X7A,
+0X0D,0X99,0X0D,0XDA,0X0E,0X1A,0X0D,0XD6,0X88,0X00,0X61,0X03,0X06,0X12,0X06,0X94,
+0X06,0X52,0X06,0X51,0X80,0X06,0X50,0X00,0X06,0X2F,0X80,0X06,0X0D,0X06,0X05,0XEC,
+0X05,0XEB,0X05,0XCA,0X05,0XC9,0X05,0XC7,0X05,0XE7,0X04,0XA6,0X88,0X00,0X61,0X17,
+0X14,0X21,0X0D,0XC0,0X15,0X20,0X1D,0X40,0X1D,0X60,0X25,0X60,0X2D,0X40,0X35,0X60,
+0X3D,0X80,0X45,0XA0,0X4D,0XA0,0X55,0XA0,0X5D,0XA0,0X65,0XC0,0X6D,0XC0,0X75,0XE0,
+0X7D,0XE0,0X86,0X00,0X96,0X00,0X96,0X20,0X9E,0X00,0XAE,0X20,0XB6,0X40,0XBE,0X60,
+0X80,0XCE,0X60,0X80,0XD6,0XA0,0X02,0XE6,0XA0,0XEF,0X20,0X39,0XA0,0X81,0X08,0X81,
+0X02,0X08,0X82,0X08,0XA2,0X08,0X82,0X83,0X00,0X61,0X02,0X08,0X81,0XDE,0X80,0XFF,
+0X00,0X80,0XFE,0XE0,0X00,0XFF,0X00,0X82,0XFE,0XE0,0X80,0XFF,0X00,0X81,0XFE,0XE0,
+0X02,0XFF,0X00,0XFE,0XE0,0XFF,0X00,0X83,0XFE,0XE0,0X80,0XFF,0X00,0X05,0XFE,0XE0,
+0XFE,0XC0,0XFE,0XE0,0XFF,0X00,0XFE,0XE0,0XF6,0XE0,0X80,0XFF,0X20,0X01,0XEE,0XE0,
+0X10,0XA1,0X85,0X00,0X61,0X07,0X08,0X81,0X08,0XA2,0X08,0XA1,0X08,0XC2,0X08,0XE2,
+0X08,0XC2,0X08,0XA2,0X08,0XA1,0X80,0X08,0XA2,0X00,0X08,0XA1,0X81,0X08,0X81,0X02,
+0X08,0XA1,0X08,0X81,0X08,0X61,0X81,0X00,0X61,0X00,0X08,0X61,0X96,0X00,0X61,0X00,
+0X08,0X81,0X83,0X00,0X61,0X80,0X08,0X61,0X06,0X00,0X61,0X08,0XC1,0X19,0XA2,0X19,
+0XE2,0X1A,0X02,0X1A,0X23,0X19,0XE3,0X80,0X00,0X61,0X00,0X08,0X61,0X80,0X00,0X61,
+0X05,0X08,0X61,0X00,0X81,0X09,0X22,0X12,0X45,0X12,0X25,0X10,0XE2,0X82,0X00,0X61,
+0X03,0X08,0X82,0X08,0XA2,0X08,0XC2,0X08,0XC1,0X81,0X08,0XA1,0X05,0X08,0XA2,0X08,
+0XE1,0X08,0XE2,0X09,0X02,0X08,0XC2,0X08,0XA2,0X85,0X00,0X61,0X0E,0XB1,0XE1,0XEA,
+0XC2,0XEA,0X83,0XE2,0X82,0XE2,0XC2,0XEA,0X83,0XEA,0XA2,0XEA,0X82,0XE2,0XC1,0XE2,
+0XA2,0XE2,0X81,0XEA,0XA3,0XEA,0X82,0XF2,0XC3,0X89,0X81,0X91,0X00,0X61,0X04,0X79,
+0X20,0XF2,0XC2,0XE2,0XA3,0XEA,0X83,0XDA,0X82,0X80,0XDA,0X64,0X07,0XD2,0X44,0XCA,
+0X45,0XCA,0X26,0XC2,0X06,0XBA,0X07,0XB9,0XE8,0XB2,0X07,0X89,0X66,0X80,0X08,0XC2,
+0X81,0X08,0XE2,0X0B,0X09,0X02,0X28,0X65,0X71,0X4C,0X68,0XED,0X61,0X0F,0X58,0XEE,
+0X50,0XEF,0X50,0XD0,0X48,0XD1,0X40,0XB1,0X38,0XB1,0X38,0XF1,0X81,0X28,0XB4,0X04,
+0X18,0XB2,0X08,0XC2,0X08,0XA2,0X01,0X03,0X01,0X64,0X80,0X00,0XE3,0X02,0X00,0XA2,
+0X00,0X82,0X08,0X81,0X80,0X08,0X61,0X86,0X00,0X61,0X10,0X0A,0X71,0X03,0XBA,0X0B,
+0XB9,0X0B,0XF9,0X0C,0X58,0X0C,0X79,0X0C,0XB9,0X0C,0XD9,0X0D,0X19,0X0D,0X39,0X0D,
+0X78,0X05,0XB8,0X05,0XD8,0X0D,0XF8,0X06,0X1A,0X16,0X79,0X0B,0XAD,0X86,0X00,0X61,
+0X02,0X03,0XEC,0X06,0XD5,0X06,0X53,0X80,0X06,0X51,0X0C,0X06,0X30,0X06,0X2F,0X06,
+0X2E,0X06,0X0D,0X05,0XEC,0X05,0XEB,0X05,0XEA,0X05,0XE9,0X05,0XA9,0X0D,0X87,0X05,
+0XC6,0X00,0XA1,0X00,0X81,0X86,0X00,0X61,0X02,0X0C,0X41,0X15,0XA0,0X15,0X40,0X80,
+0X1D,0X40,0X10,0X25,0X60,0X2D,0X80,0X35,0X80,0X3D,0X60,0X45,0X80,0X45,0XA0,0X55,
+0XA0,0X5D,0XC0,0X65,0XC0,0X6D,0XC0,0X75,0XE0,0X85,0XE0,0X86,0X00,0X8E,0X20,0X96,
+0X40,0X9E,0X40,0XAE,0X40,0X80,0XB6,0X60,0X07,0XBE,0X80,0XC6,0X80,0XCE,0X80,0XD6,
+0XC0,0XDE,0XA0,0XEE,0XA0,0XEE,0XE0,0X39,0XC0,0X82,0X08,0X81,0X01,0X08,0XA1,0X08,
+0X81,0X83,0X00,0X61,0X03,0XCD,0XA1,0XFF,0X20,0XFF,0X00,0XFE,0XC0,0X80,0XFF,0X00,
+0X01,0XFE,0XC1,0XFF,0X00,0X80,0XFE,0XE0,0X00,0XFE,0XC0,0X83,0XFE,0XE0,0X00,0XFE,
+0XC0,0X87,0XFE,0XE0,0X80,0XFF,0X00,0X01,0XFE,0XE0,0XFF,0X00,0X81,0XFE,0XE0,0X01,
+0XFF,0X20,0XD6,0X61,0X83,0X00,0X61,0X80,0X08,0X81,0X82,0X08,0XA1,0X01,0X08,0XC2,
+0X08,0XE2,0X81,0X08,0XA1,0X01,0X08,0XA2,0X08,0X81,0X80,0X08,0XA1,0X01,0X08,0X81,
+0X08,0X61,0X8D,0X00,0X61,0X84,0X08,0X81,0X8C,0X00,0X61,0X02,0X08,0X61,0X00,0X61,
+0X00,0X41,0X80,0X08,0X61,0X00,0X08,0XE2,0X80,0X1A,0X44,0X80,0X11,0XA2,0X04,0X08,
+0XA1,0X00,0X61,0X08,0X61,0X00,0X61,0X08,0X61,0X80,0X00,0X61,0X04,0X08,0XA1,0X11,
+0X63,0X12,0X44,0X11,0X62,0X00,0X81,0X83,0X00,0X61,0X03,0X00,0X81,0X00,0XA1,0X08,
+0XA2,0X08,0XC2,0X80,0X08,0XA1,0X00,0X08,0XC1,0X80,0X08,0XC2,0X00,0X08,0XE2,0X80,
+0X08,0XC2,0X00,0X00,0X81,0X83,0X00,0X61,0X03,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,
+0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,
+0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X06,0X79,0X21,0XEA,0XC3,0XE2,0X83,0XE2,0X63,
+0XDA,0X83,0XD2,0X64,0XD2,0X44,0X80,0XCA,0X45,0X05,0XBA,0X26,0XBA,0X06,0XB1,0XE7,
+0XA9,0XC7,0XA9,0XC9,0X81,0X67,0X80,0X08,0XC2,0X80,0X08,0XA2,0X16,0X08,0XC2,0X09,
+0X02,0X28,0X44,0X69,0X0E,0X61,0X0E,0X58,0XEE,0X58,0XCF,0X48,0XD0,0X48,0XB1,0X40,
+0XD0,0X38,0XB2,0X30,0XB2,0X28,0XB2,0X28,0XD3,0X28,0XB4,0X20,0XB5,0X18,0XB3,0X08,
+0XA2,0X08,0XA1,0X00,0XC2,0X01,0X65,0X00,0XC3,0X00,0XA2,0X80,0X00,0X82,0X00,0X00,
+0X81,0X89,0X00,0X61,0X0F,0X03,0XB6,0X04,0X79,0X0C,0X39,0X0C,0X79,0X0C,0XD8,0X0C,
+0XF9,0X0D,0X19,0X0D,0X59,0X0D,0X99,0X0D,0XB9,0X05,0XD9,0X0D,0XF8,0X0E,0X19,0X0E,
+0X38,0X0E,0X3A,0X06,0X38,0X85,0X00,0X61,0X09,0X00,0X62,0X06,0X52,0X06,0X73,0X06,
+0X52,0X06,0X70,0X06,0X50,0X06,0X30,0X06,0X0E,0X0D,0XED,0X0D,0XEB,0X80,0X05,0XEA,
+0X04,0X05,0XC9,0X05,0XA8,0X05,0XA7,0X05,0XE6,0X0B,0X83,0X82,0X08,0X81,0X00,0X00,
+0X81,0X82,0X00,0X61,0X02,0X04,0X20,0X0D,0X80,0X15,0X40,0X80,0X1D,0X60,0X1D,0X25,
+0X60,0X2D,0X60,0X35,0X80,0X3D,0X80,0X45,0XA0,0X4D,0XA0,0X55,0XA0,0X5D,0XA0,0X65,
+0XA0,0X75,0XE0,0X7E,0X00,0X7D,0XE0,0X86,0X20,0X8E,0X00,0X9E,0X20,0XA6,0X20,0XAE,
+0X40,0XB6,0X60,0XBE,0X60,0XC6,0X60,0XCE,0X80,0XD6,0X80,0XDE,0XA0,0XDE,0XA1,0XEE,
+0XC0,0XF6,0XA0,0XFF,0X00,0X39,0XC0,0X08,0X81,0X00,0X81,0X81,0X08,0X81,0X00,0X00,
+0X81,0X82,0X00,0X61,0X02,0X93,0XA0,0XFF,0X20,0XFF,0X00,0X84,0XFE,0XE0,0X81,0XFF,
+0X00,0X00,0XFE,0XE1,0X83,0XFE,0XE0,0X06,0XFE,0XC0,0XFE,0XE1,0XFE,0XE0,0XFF,0X00,
+0XFE,0XE0,0XFF,0X00,0XFE,0XE1,0X86,0XFE,0XE0,0X03,0XFF,0X00,0XFE,0XE0,0XFF,0X60,
+0XB4,0XA0,0X81,0X00,0X61,0X80,0X08,0X81,0X83,0X08,0XA1,0X80,0X08,0XC2,0X00,0X08,
+0XA2,0X80,0X08,0XA1,0X83,0X08,0X81,0X87,0X00,0X61,0X8E,0X08,0X81,0X00,0X00,0X81,
+0X80,0X08,0X81,0X81,0X08,0X82,0X00,0X08,0XA2,0X86,0X00,0X61,0X80,0X08,0X61,0X08,
+0X11,0X84,0X1B,0X27,0X1A,0X64,0X11,0XC2,0X09,0X02,0X00,0X61,0X08,0X61,0X00,0X61,
+0X08,0X61,0X81,0X00,0X61,0X03,0X08,0XC1,0X11,0XA3,0X11,0X82,0X08,0X81,0X85,0X00,
+0X61,0X00,0X00,0X81,0X80,0X08,0XA2,0X03,0X08,0XC2,0X08,0XC1,0X08,0XA1,0X08,0XC1,
+0X81,0X08,0XE2,0X01,0X00,0XA1,0X00,0X61,0X80,0X00,0X81,0X05,0X00,0X61,0X00,0X81,
+0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,
+0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X09,0X71,
+0X21,0XEA,0XA3,0XE2,0X83,0XDA,0X63,0XD2,0X63,0XD2,0X44,0XCA,0X24,0XCA,0X25,0XC2,
+0X26,0XBA,0X06,0X80,0XB1,0XE7,0X02,0XA9,0XA8,0XA9,0XA9,0X79,0X67,0X81,0X08,0XA2,
+0X0C,0X08,0XA1,0X08,0XC1,0X08,0XE2,0X28,0X44,0X61,0X0F,0X58,0XEF,0X50,0XEF,0X50,
+0XB0,0X48,0XD0,0X40,0XB1,0X38,0XD1,0X30,0XB3,0X30,0XB2,0X80,0X28,0XD3,0X08,0X28,
+0X94,0X18,0XB5,0X10,0X93,0X08,0XA2,0X08,0XA1,0X08,0X82,0X01,0X23,0X01,0X04,0X00,
+0XA2,0X80,0X00,0X82,0X8A,0X00,0X61,0X10,0X00,0XE5,0X0C,0X9A,0X0C,0X79,0X0C,0XB9,
+0X0C,0XD8,0X0D,0X19,0X0D,0X39,0X0D,0X59,0X0D,0X99,0X0D,0XB9,0X05,0XF9,0X0E,0X19,
+0X0E,0X39,0X06,0X58,0X0E,0X7A,0X0E,0XB9,0X0B,0X8D,0X84,0X00,0X61,0X05,0X04,0X0C,
+0X0E,0X73,0X06,0X52,0X06,0X51,0X06,0X50,0X0E,0X2F,0X80,0X06,0X0E,0X80,0X05,0XEB,
+0X06,0X0D,0XEA,0X05,0XA9,0X05,0XA8,0X0D,0X87,0X05,0XC6,0X05,0X06,0X08,0X81,0X86,
+0X00,0X61,0X01,0X0A,0X80,0X15,0X21,0X80,0X15,0X60,0X1E,0X1D,0X40,0X25,0X60,0X2D,
+0X60,0X35,0X80,0X3D,0X80,0X45,0XA0,0X4D,0XA0,0X55,0XA0,0X5D,0XC0,0X65,0XC0,0X76,
+0X00,0X75,0XE0,0X7D,0XE0,0X86,0X20,0X96,0X40,0X96,0X20,0XA6,0X40,0XAE,0X40,0XB6,
+0X60,0XBE,0X60,0XC6,0X60,0XCE,0X80,0XD6,0X80,0XDE,0XA0,0XDE,0XC0,0XE6,0XC0,0XEE,
+0XE0,0XFE,0XC0,0XFF,0X00,0X39,0XA0,0X08,0X82,0X86,0X00,0X61,0X02,0X08,0X61,0XEE,
+0XA2,0XFF,0X00,0X86,0XFE,0XE0,0X09,0XFE,0XC0,0XFF,0X00,0XFE,0XE0,0XFE,0XC0,0XFF,
+0X00,0XFE,0XE1,0XFE,0XE0,0XF7,0X00,0XFF,0X40,0XF6,0XE0,0X80,0XFF,0X00,0X8A,0XFE,
+0XE0,0X03,0XFF,0X00,0XFE,0XE0,0XF7,0X01,0X10,0XA1,0X80,0X00,0X61,0X80,0X08,0X81,
+0X81,0X08,0XA1,0X81,0X08,0XC2,0X80,0X08,0XA2,0X00,0X08,0XA1,0X80,0X08,0X81,0X80,
+0X08,0XA1,0X00,0X08,0X81,0X82,0X00,0X61,0X83,0X08,0X81,0X00,0X08,0XA1,0X8A,0X08,
+0X81,0X00,0X08,0X61,0X87,0X08,0X81,0X00,0X08,0XA1,0X87,0X00,0X61,0X08,0X08,0X61,
+0X00,0X62,0X12,0X05,0X1B,0X88,0X1A,0X64,0X11,0X62,0X08,0X81,0X00,0X61,0X08,0X61,
+0X82,0X00,0X61,0X03,0X08,0X81,0X09,0X02,0X09,0X42,0X08,0X81,0X87,0X00,0X61,0X03,
+0X00,0X81,0X00,0XA2,0X08,0XC1,0X08,0XC2,0X80,0X08,0XA1,0X80,0X08,0XE2,0X00,0X08,
+0XC2,0X80,0X08,0X82,0X06,0X00,0X81,0X00,0X62,0X00,0X82,0XA9,0XE1,0XF2,0XA3,0XEA,
+0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,
+0XEA,0X82,0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X11,0X71,0X21,0XEA,0XA3,0XDA,0X63,
+0XDA,0X43,0XD2,0X64,0XCA,0X45,0XCA,0X25,0XC2,0X06,0XBA,0X07,0XB1,0XE7,0XA9,0XE7,
+0XA9,0XC8,0XA1,0XA8,0XA1,0X89,0X79,0X47,0X00,0XC2,0X08,0XC2,0X08,0XE2,0X80,0X08,
+0XC2,0X08,0X08,0XE2,0X20,0X25,0X58,0XEF,0X50,0XF0,0X48,0XD0,0X48,0XB1,0X40,0XD1,
+0X38,0XB2,0X30,0XD2,0X80,0X30,0XB3,0X05,0X28,0XB3,0X20,0XB3,0X20,0XB4,0X18,0XB5,
+0X10,0XB4,0X08,0XA2,0X80,0X08,0X81,0X03,0X00,0XC2,0X01,0X24,0X00,0XA2,0X00,0X82,
+0X8C,0X00,0X61,0X09,0X0B,0XD5,0X04,0XFA,0X04,0XD8,0X0D,0X39,0X0D,0X59,0X0D,0X79,
+0X0D,0X99,0X0D,0XD9,0X0D,0XF9,0X0E,0X19,0X80,0X0E,0X39,0X80,0X06,0X59,0X01,0X06,
+0X98,0X0D,0XF4,0X84,0X00,0X61,0X07,0X06,0X52,0X06,0X72,0X06,0X51,0X06,0X50,0X06,
+0X2F,0X06,0X0E,0X06,0X0D,0X0D,0XEC,0X80,0X05,0XEA,0X80,0X05,0XA9,0X03,0X05,0XA7,
+0X05,0X66,0X05,0XE5,0X00,0XE2,0X87,0X00,0X61,0X15,0X0C,0XA0,0X15,0X80,0X1D,0X40,
+0X25,0X60,0X25,0X80,0X2D,0X60,0X35,0X80,0X3D,0X80,0X45,0X80,0X4D,0XA0,0X55,0XA0,
+0X5D,0XC0,0X65,0XC0,0X6D,0XE0,0X75,0XE0,0X7E,0X00,0X8E,0X21,0X96,0X21,0X96,0X00,
+0XA6,0X40,0XAE,0X20,0XB6,0X60,0X80,0XBE,0X80,0X02,0XC6,0X80,0XCE,0XA0,0XD6,0XA0,
+0X80,0XDE,0XC0,0X04,0XEE,0XE0,0XF6,0XE0,0XFE,0XC1,0XFF,0X20,0X39,0XC0,0X87,0X00,
+0X61,0X01,0X8B,0XE0,0XFF,0X60,0X86,0XFE,0XE0,0X03,0XFE,0XA0,0XFE,0XE0,0XFF,0X00,
+0XFF,0X20,0X80,0XFF,0X00,0X00,0XFE,0XC0,0X80,0XFE,0XE0,0X80,0XFE,0XC0,0X00,0XFE,
+0XE0,0X80,0XFE,0XC0,0X01,0XFE,0XE0,0XFF,0X00,0X87,0XFE,0XE0,0X03,0XFF,0X00,0XFE,
+0XC0,0XFF,0X60,0XAD,0X00,0X80,0X00,0X61,0X81,0X08,0X81,0X81,0X08,0XA1,0X80,0X08,
+0XC2,0X80,0X08,0XA1,0X81,0X08,0X81,0X80,0X08,0XA1,0X00,0X08,0X81,0X80,0X00,0X61,
+0X05,0X08,0X81,0X08,0X82,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X80,0X08,0XA1,
+0X85,0X08,0X81,0X80,0X00,0X81,0X89,0X08,0X81,0X02,0X08,0XA2,0X08,0XC2,0X08,0XC1,
+0X89,0X00,0X61,0X06,0X08,0X81,0X12,0X66,0X23,0X87,0X1A,0X03,0X08,0XC1,0X00,0X61,
+0X08,0X61,0X83,0X00,0X61,0X01,0X08,0XC1,0X09,0X02,0X80,0X00,0X61,0X00,0X08,0X61,
+0X87,0X00,0X61,0X00,0X00,0X81,0X80,0X08,0XA2,0X02,0X08,0XA1,0X08,0XC1,0X00,0XC2,
+0X80,0X08,0XC2,0X00,0X08,0X82,0X80,0X00,0X81,0X04,0X08,0X82,0XA9,0XE1,0XF2,0XA3,
+0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,
+0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X03,0X71,0X21,0XE2,0XA4,0XD2,
+0X64,0XD2,0X44,0X80,0XCA,0X45,0X08,0XC2,0X26,0XBA,0X07,0XB1,0XE7,0XA9,0XE7,0XA9,
+0XC8,0XA1,0XC9,0X99,0XA9,0X99,0X8A,0X71,0X28,0X80,0X08,0XC2,0X05,0X08,0XE2,0X08,
+0XC2,0X09,0X03,0X09,0X64,0X20,0X25,0X58,0XF0,0X80,0X48,0XD0,0X01,0X40,0XB1,0X38,
+0XB1,0X80,0X30,0XB3,0X07,0X28,0XB3,0X28,0XB4,0X20,0XB4,0X18,0XB4,0X18,0X95,0X10,
+0XB5,0X10,0XB4,0X08,0XA1,0X80,0X08,0X81,0X03,0X08,0X82,0X08,0XC3,0X08,0XA2,0X08,
+0X81,0X8C,0X00,0X61,0X09,0X00,0XA3,0X0D,0X1A,0X05,0X38,0X0D,0X7A,0X0D,0X79,0X0D,
+0X99,0X0D,0XD9,0X0D,0XF9,0X0E,0X19,0X0E,0X39,0X81,0X0E,0X59,0X03,0X06,0X58,0X0E,
+0X58,0X0E,0XB8,0X03,0X4C,0X82,0X00,0X61,0X0F,0X04,0X4C,0X06,0XB2,0X06,0X31,0X06,
+0X50,0X06,0X2F,0X0E,0X2E,0X06,0X0D,0X06,0X0C,0X05,0XEA,0X0D,0XEA,0X05,0XA9,0X05,
+0XA8,0X05,0XC8,0X05,0X85,0X05,0XC5,0X04,0X64,0X87,0X00,0X61,0X17,0X0A,0XA0,0X15,
+0XA0,0X15,0X60,0X1D,0X60,0X2D,0X40,0X2D,0X80,0X35,0X80,0X3D,0X80,0X45,0X80,0X4D,
+0XA0,0X55,0XA0,0X5D,0XC0,0X65,0XC0,0X6D,0XC0,0X76,0X00,0X7E,0X00,0X86,0X00,0X8E,
+0X00,0X9E,0X40,0X9E,0X20,0XAE,0X40,0XB6,0X60,0XBE,0X60,0XC6,0X80,0X80,0XCE,0X80,
+0X00,0XDE,0XA0,0X80,0XE6,0XA0,0X07,0XEE,0XA0,0XEE,0XC0,0XFE,0XE0,0XFE,0XC1,0XFF,
+0X00,0X39,0XC0,0X00,0X61,0X08,0X81,0X85,0X00,0X61,0X01,0XE6,0X41,0XFF,0X00,0X88,
+0XFE,0XE0,0X00,0XF6,0XE0,0X80,0XFE,0XE0,0X04,0XFE,0XA0,0XFE,0XC1,0XFF,0X01,0XFF,
+0X21,0XFF,0X20,0X80,0XFF,0X40,0X03,0XFE,0XE1,0XFE,0XE0,0XFE,0XC0,0XFF,0X00,0X87,
+0XFE,0XE0,0X00,0XFF,0X00,0X80,0XFE,0XE0,0X01,0XF6,0XE1,0X08,0X61,0X80,0X00,0X61,
+0X03,0X00,0X81,0X08,0X81,0X08,0XA1,0X08,0XA2,0X82,0X08,0XA1,0X85,0X08,0X81,0X00,
+0X08,0X82,0X84,0X08,0XA2,0X86,0X08,0X81,0X00,0X08,0X82,0X82,0X08,0X81,0X80,0X08,
+0X82,0X00,0X08,0XA1,0X81,0X08,0X81,0X00,0X08,0X82,0X80,0X10,0XA2,0X01,0X08,0X81,
+0X08,0XC2,0X80,0X09,0X02,0X88,0X00,0X61,0X05,0X08,0X61,0X00,0X61,0X08,0XA1,0X1B,
+0X27,0X22,0XE5,0X11,0X22,0X85,0X00,0X61,0X01,0X08,0X61,0X08,0XA1,0X80,0X00,0X61,
+0X01,0X08,0X81,0X08,0X61,0X88,0X00,0X61,0X01,0X00,0X81,0X08,0XC2,0X81,0X08,0XA1,
+0X80,0X08,0XC2,0X06,0X00,0X81,0X00,0X61,0X08,0X82,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,
+0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,
+0X82,0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X17,0X71,0X21,0XE2,0X84,0XD2,0X44,0XCA,
+0X45,0XC2,0X45,0XBA,0X26,0XBA,0X06,0XB1,0XE7,0XA9,0XE7,0XA1,0XC8,0XA1,0XA8,0X99,
+0XA9,0X91,0X89,0X91,0X8B,0X69,0X28,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X09,
+0X23,0X01,0X03,0X18,0X25,0X50,0XD0,0X48,0XB1,0X80,0X40,0XB1,0X05,0X30,0XB1,0X30,
+0XB3,0X28,0XB3,0X20,0XD4,0X20,0XB4,0X18,0XB4,0X80,0X18,0XB5,0X08,0X10,0XD6,0X08,
+0XB4,0X08,0XA2,0X08,0XA1,0X00,0X81,0X08,0XA2,0X08,0X82,0X08,0XA1,0X08,0X81,0X8D,
+0X00,0X61,0X02,0X0B,0XB2,0X05,0X9B,0X05,0X59,0X80,0X0D,0XB9,0X03,0X0D,0XF9,0X0E,
+0X19,0X0E,0X39,0X0E,0X59,0X80,0X0E,0X58,0X04,0X0E,0X38,0X06,0X57,0X0E,0X37,0X06,
+0X57,0X0D,0XF4,0X81,0X00,0X61,0X05,0X00,0X82,0X06,0X92,0X06,0X51,0X06,0X30,0X06,
+0X2F,0X06,0X0D,0X80,0X06,0X0C,0X02,0X05,0XEB,0X05,0XEA,0X05,0XA9,0X80,0X05,0X88,
+0X03,0X05,0X85,0X05,0X84,0X05,0X85,0X00,0X81,0X87,0X00,0X61,0X1E,0X14,0XA0,0X1D,
+0XA0,0X1D,0X60,0X25,0X80,0X2D,0X40,0X2D,0X80,0X3D,0X80,0X45,0XA0,0X4D,0XA0,0X55,
+0XA0,0X5D,0XC0,0X65,0XC0,0X6D,0XE0,0X75,0XE0,0X7E,0X00,0X86,0X00,0X96,0X20,0X9E,
+0X40,0XAE,0X80,0XB6,0XA0,0XB6,0X80,0XBE,0X80,0XC6,0X60,0XCE,0XA0,0XDE,0XE0,0XE7,
+0X00,0XEF,0X20,0XF7,0X00,0XF6,0XE0,0XFE,0XE0,0XFF,0X00,0X80,0XFE,0XE0,0X04,0XFF,
+0X40,0X39,0XA1,0X08,0X81,0X00,0X61,0X00,0X81,0X83,0X00,0X61,0X02,0X21,0X01,0XFF,
+0X20,0XFF,0X00,0X86,0XFE,0XE0,0X01,0XFE,0XC0,0XFF,0X20,0X80,0XFE,0XE0,0X00,0XFE,
+0XC1,0X80,0XFF,0X21,0X08,0XD6,0X60,0XCD,0X60,0XC5,0X60,0XC5,0X80,0XDE,0X20,0XEE,
+0XC0,0XFF,0X60,0XFE,0XE0,0XFF,0X00,0X88,0XFE,0XE0,0X03,0XFF,0X00,0XFE,0XC0,0XFF,
+0X40,0X83,0X80,0X81,0X00,0X61,0X81,0X08,0X81,0X81,0X08,0XA1,0X83,0X08,0X81,0X82,
+0X08,0XA2,0X00,0X08,0XC2,0X80,0X08,0XA2,0X80,0X08,0XA1,0X06,0X08,0X81,0X08,0XA1,
+0X08,0X81,0X08,0XA1,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X82,0X09,0X02,0X80,0X08,0XC2,
+0X04,0X08,0XE2,0X11,0X02,0X10,0XC2,0X10,0XA1,0X10,0XA2,0X82,0X10,0XC2,0X04,0X08,
+0XA1,0X08,0X81,0X08,0XA1,0X08,0XE2,0X09,0X22,0X88,0X00,0X61,0X07,0X08,0X61,0X00,
+0X61,0X08,0X61,0X09,0X43,0X23,0X06,0X11,0X82,0X08,0X81,0X08,0X61,0X87,0X00,0X61,
+0X01,0X08,0X82,0X08,0X81,0X82,0X00,0X61,0X00,0X08,0X61,0X83,0X00,0X61,0X03,0X08,
+0X61,0X00,0X81,0X08,0X82,0X08,0XA2,0X81,0X08,0XA1,0X06,0X08,0XA2,0X00,0X62,0X00,
+0X82,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,
+0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X0E,
+0X69,0X01,0XDA,0X84,0XCA,0X45,0XCA,0X26,0XBA,0X26,0XBA,0X06,0XB1,0XE7,0XA9,0XE7,
+0XA9,0XC8,0XA1,0XA8,0X99,0XA9,0X91,0X8A,0X89,0X6A,0X89,0X6C,0X69,0X09,0X81,0X08,
+0XE2,0X80,0X09,0X03,0X03,0X00,0XE3,0X18,0X26,0X50,0XD0,0X40,0XB1,0X80,0X38,0XB2,
+0X05,0X30,0XB2,0X28,0XB3,0X28,0XB4,0X18,0XB4,0X20,0XB4,0X18,0XB5,0X80,0X10,0XB5,
+0X04,0X08,0XF6,0X08,0XD4,0X08,0XA1,0X08,0X81,0X08,0XA1,0X80,0X08,0XA2,0X90,0X00,
+0X61,0X06,0X0D,0X5A,0X0D,0X99,0X05,0XD9,0X05,0XF9,0X0E,0X19,0X0E,0X39,0X0E,0X59,
+0X81,0X06,0X58,0X01,0X0E,0X78,0X06,0X77,0X80,0X06,0X56,0X01,0X06,0XD6,0X01,0X44,
+0X80,0X00,0X61,0X05,0X0C,0X6C,0X06,0XB2,0X06,0X50,0X0E,0X0F,0X06,0X0E,0X06,0X0D,
+0X80,0X05,0XEB,0X07,0X05,0XEA,0X0D,0XC9,0X05,0X88,0X05,0XA8,0X0D,0X66,0X05,0XA4,
+0X0D,0X85,0X03,0XA3,0X80,0X00,0X81,0X85,0X00,0X61,0X16,0X00,0XA1,0X1D,0X80,0X1D,
+0X40,0X2D,0X60,0X35,0X60,0X35,0X80,0X3D,0X80,0X45,0XA0,0X4D,0XA0,0X55,0XA0,0X5D,
+0XC0,0X65,0XC0,0X6D,0XE0,0X75,0XE0,0X7E,0X00,0X86,0X00,0X96,0X20,0XA6,0X60,0X9D,
+0XE0,0X74,0X60,0X19,0X21,0X10,0XC1,0X10,0XA1,0X80,0X08,0XA1,0X0A,0X10,0XC1,0X19,
+0X01,0X31,0X81,0X5A,0XA0,0XBD,0X80,0XD6,0X40,0XF6,0XE1,0XFF,0X01,0XFF,0X80,0XFF,
+0X40,0X39,0XA0,0X80,0X00,0X61,0X00,0X08,0X81,0X83,0X00,0X61,0X02,0XA4,0XA1,0XFF,
+0X20,0XFE,0XC0,0X86,0XFE,0XE0,0X08,0XFE,0XE1,0XFE,0XC0,0XFE,0XE0,0XFF,0X00,0XFF,
+0X20,0XB5,0X01,0X4A,0X00,0X10,0X60,0X00,0X01,0X80,0X00,0X00,0X04,0X08,0X20,0X49,
+0XE1,0X9C,0X80,0XFF,0X40,0XFE,0XC2,0X88,0XFE,0XE0,0X03,0XFF,0X00,0XFE,0XE0,0XFF,
+0X20,0XCD,0X60,0X82,0X00,0X61,0X00,0X08,0X81,0X83,0X08,0XA1,0X03,0X08,0X81,0X08,
+0X82,0X00,0X82,0X00,0XC2,0X80,0X08,0XC2,0X07,0X00,0XA2,0X08,0XA2,0X08,0XC2,0X08,
+0XA2,0X08,0XA1,0X08,0X81,0X08,0XA2,0X08,0XE2,0X80,0X09,0X02,0X00,0X09,0X22,0X80,
+0X11,0XA2,0X00,0X11,0XC3,0X81,0X12,0X03,0X80,0X1A,0X44,0X09,0X1A,0X84,0X1A,0X85,
+0X19,0XA4,0X19,0X43,0X19,0X63,0X18,0XE2,0X10,0XE2,0X10,0XC2,0X10,0X82,0X08,0X61,
+0X80,0X00,0X61,0X02,0X08,0XC2,0X11,0X22,0X09,0X02,0X8B,0X00,0X61,0X03,0X08,0X81,
+0X11,0X83,0X11,0X62,0X00,0X81,0X87,0X00,0X61,0X03,0X08,0X61,0X08,0X81,0X10,0XA2,
+0X08,0X81,0X85,0X00,0X61,0X01,0X00,0X81,0X08,0X81,0X80,0X00,0X81,0X05,0X08,0X81,
+0X08,0XA1,0X08,0XC2,0X08,0XA2,0X08,0XA1,0X00,0XA1,0X80,0X08,0XA2,0X03,0XA9,0XE1,
+0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,
+0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X04,0X69,0X02,0XD2,
+0X65,0XC2,0X25,0XC2,0X06,0XBA,0X26,0X80,0XB1,0XE7,0X07,0XA9,0XC8,0XA1,0XC9,0X99,
+0XA9,0X91,0X8A,0X89,0X8A,0X81,0X4B,0X81,0X4C,0X60,0XE9,0X81,0X08,0XC2,0X05,0X09,
+0X43,0X09,0XC5,0X09,0X24,0X10,0X26,0X48,0XB1,0X38,0XB2,0X80,0X30,0XB2,0X03,0X28,
+0XB2,0X28,0XB4,0X20,0XB4,0X18,0XD4,0X80,0X18,0XB5,0X08,0X10,0XB5,0X10,0XD6,0X09,
+0X16,0X08,0XD5,0X08,0XA2,0X08,0XA1,0X08,0X81,0X08,0XA2,0X00,0X82,0X90,0X00,0X61,
+0X04,0X0B,0X4F,0X15,0XD9,0X0D,0XF9,0X0E,0X19,0X0E,0X39,0X80,0X0E,0X59,0X00,0X0E,
+0X58,0X80,0X06,0X58,0X11,0X06,0X57,0X06,0X56,0X06,0X75,0X06,0X76,0X06,0X74,0X05,
+0X90,0X00,0X61,0X00,0X82,0X0E,0X71,0X06,0X50,0X06,0X2F,0X06,0X0E,0X06,0X0D,0X06,
+0X0C,0X05,0XEB,0X05,0XCA,0X05,0XC9,0X0D,0XA8,0X80,0X05,0XA7,0X03,0X05,0X44,0X05,
+0XC4,0X0C,0XA5,0X00,0X82,0X87,0X00,0X61,0X0D,0X0B,0X80,0X25,0XA0,0X25,0X60,0X35,
+0X80,0X3D,0X60,0X3D,0XA0,0X45,0X80,0X4D,0XA0,0X55,0XA0,0X5D,0XC0,0X65,0XC0,0X6D,
+0XE0,0X75,0XE0,0X7E,0X00,0X80,0X8E,0X00,0X02,0XA6,0X81,0X6C,0X40,0X08,0XA1,0X81,
+0X08,0X81,0X84,0X00,0X61,0X00,0X00,0X82,0X80,0X08,0X81,0X03,0X10,0XC1,0X39,0XE0,
+0XB5,0X60,0XA4,0X80,0X80,0X00,0X81,0X85,0X00,0X61,0X01,0XDE,0X00,0XFF,0X40,0X88,
+0XFE,0XE0,0X05,0XFE,0XE1,0XFE,0XC0,0XFF,0X21,0XB5,0X40,0X18,0X80,0X00,0X01,0X80,
+0X00,0X00,0X01,0X00,0X20,0X00,0X01,0X80,0X00,0X00,0X02,0X08,0X00,0X9C,0X40,0XFF,
+0X40,0X86,0XFE,0XE0,0X05,0XFE,0XC0,0XFF,0X00,0XFE,0XC0,0XFF,0X20,0XFF,0X00,0XF6,
+0XA0,0X83,0X00,0X61,0X00,0X08,0X81,0X82,0X08,0XA1,0X80,0X08,0XA2,0X81,0X08,0XC2,
+0X80,0X08,0XA2,0X01,0X08,0XC2,0X00,0XC2,0X80,0X08,0XA2,0X01,0X08,0XC2,0X09,0X02,
+0X80,0X11,0X82,0X01,0X11,0X83,0X11,0XA2,0X80,0X11,0XE3,0X03,0X1A,0X44,0X1A,0X85,
+0X1A,0X23,0X1A,0XA4,0X80,0X23,0X05,0X04,0X1A,0X84,0X1A,0X03,0X11,0X42,0X19,0X83,
+0X19,0XA3,0X80,0X10,0XE2,0X00,0X08,0XA1,0X82,0X00,0X61,0X02,0X08,0XC2,0X11,0X22,
+0X09,0X42,0X8C,0X00,0X61,0X02,0X08,0X81,0X08,0XA2,0X08,0X61,0X88,0X00,0X61,0X04,
+0X08,0X81,0X10,0XC2,0X08,0XA1,0X08,0X61,0X00,0X81,0X80,0X08,0X61,0X80,0X08,0X81,
+0X00,0X08,0XE2,0X81,0X09,0X02,0X00,0X09,0X22,0X80,0X09,0X02,0X80,0X09,0X22,0X00,
+0X09,0X02,0X80,0X08,0XC2,0X04,0X08,0XA2,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,
+0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,
+0XA2,0X89,0X81,0X91,0X00,0X61,0X0A,0X69,0X01,0XD2,0X65,0XC2,0X25,0XBA,0X06,0XB2,
+0X06,0XA9,0XC7,0XA9,0XA8,0XA1,0XA8,0X99,0XA9,0X91,0X89,0X89,0X6A,0X80,0X81,0X4B,
+0X03,0X79,0X2D,0X58,0XE9,0X00,0X81,0X08,0XA2,0X80,0X08,0XC2,0X0A,0X09,0X44,0X09,
+0X23,0X10,0X26,0X40,0XB1,0X30,0XB3,0X30,0XD3,0X28,0XB3,0X20,0XD3,0X20,0XB4,0X18,
+0XB5,0X10,0XD4,0X80,0X18,0XB5,0X06,0X10,0XD5,0X10,0XD6,0X09,0X17,0X08,0XD5,0X08,
+0XA1,0X08,0X81,0X08,0XA2,0X80,0X00,0X81,0X91,0X00,0X61,0X00,0X05,0XB8,0X81,0X0E,
+0X39,0X00,0X0E,0X59,0X80,0X0E,0X58,0X80,0X06,0X58,0X18,0X06,0X56,0X0E,0X56,0X06,
+0X75,0X06,0X34,0X0E,0X54,0X0E,0X73,0X01,0X03,0X04,0X8C,0X06,0XB1,0X0E,0X2F,0X06,
+0X0E,0X06,0X2D,0X06,0X2C,0X05,0XEB,0X0D,0XAA,0X05,0XC9,0X0D,0X88,0X05,0X87,0X05,
+0XA7,0X05,0X66,0X05,0XA5,0X05,0X84,0X03,0X01,0X00,0XA2,0X00,0X81,0X86,0X00,0X61,
+0X10,0X1C,0XC0,0X25,0XA0,0X25,0X80,0X35,0X60,0X3D,0XA0,0X45,0X80,0X4D,0X80,0X55,
+0XA0,0X5D,0XC0,0X65,0XC0,0X6D,0XC0,0X75,0XE0,0X7E,0X00,0X8E,0X00,0X96,0X00,0XA6,
+0X80,0X6C,0X22,0X83,0X08,0X81,0X80,0X00,0X61,0X01,0X08,0X61,0X08,0X81,0X83,0X00,
+0X61,0X80,0X08,0X81,0X00,0X00,0X61,0X83,0X08,0X81,0X82,0X00,0X61,0X03,0X08,0X81,
+0XFF,0X00,0XF7,0X00,0XFE,0XE1,0X86,0XFE,0XE0,0X04,0XFF,0X00,0XFE,0XE0,0XFF,0X00,
+0XF7,0X00,0X41,0XA0,0X84,0X00,0X00,0X04,0X00,0X01,0X00,0X20,0X00,0X00,0X20,0X80,
+0XE6,0X60,0X89,0XFE,0XE0,0X03,0XF7,0X00,0XFE,0XE0,0XFF,0X00,0X5A,0X80,0X82,0X00,
+0X61,0X00,0X08,0X81,0X80,0X08,0XA1,0X80,0X08,0XA2,0X81,0X08,0XC2,0X80,0X08,0XA2,
+0X00,0X08,0X82,0X80,0X08,0XA2,0X07,0X08,0XC2,0X09,0X22,0X11,0X62,0X09,0X62,0X11,
+0X82,0X11,0XE3,0X1A,0X03,0X11,0XC3,0X80,0X11,0XE3,0X03,0X1A,0X03,0X1A,0X64,0X1A,
+0XC5,0X1A,0X44,0X80,0X1A,0X43,0X08,0X1A,0X03,0X11,0XC2,0X11,0XA2,0X11,0X82,0X11,
+0XC2,0X11,0X82,0X11,0X62,0X08,0XC2,0X08,0X61,0X82,0X00,0X61,0X02,0X08,0XC2,0X09,
+0X42,0X11,0X62,0X99,0X00,0X61,0X03,0X08,0X81,0X18,0XC2,0X10,0XC2,0X10,0XE2,0X80,
+0X11,0XA4,0X04,0X19,0XE4,0X12,0X04,0X11,0XC3,0X11,0XA3,0X09,0X83,0X84,0X09,0X63,
+0X08,0X09,0X83,0X09,0X42,0X09,0X43,0X09,0X23,0X09,0X02,0XA9,0XE1,0XF2,0XA3,0XEA,
+0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,
+0XEA,0X82,0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X0E,0X60,0XE2,0XCA,0X47,0XBA,0X06,
+0XB2,0X06,0XB1,0XC8,0XA9,0XC8,0XA1,0XA8,0X99,0XA9,0X91,0X8A,0X89,0X6A,0X81,0X4B,
+0X81,0X4C,0X79,0X2C,0X71,0X2D,0X50,0XCB,0X80,0X00,0X61,0X09,0X08,0XA2,0X08,0XC2,
+0X09,0X03,0X09,0X23,0X10,0X26,0X30,0XB3,0X30,0XB2,0X28,0XB4,0X20,0XB3,0X20,0XB4,
+0X81,0X18,0XB5,0X00,0X08,0XD5,0X80,0X08,0XF6,0X02,0X10,0XF7,0X09,0X37,0X01,0X35,
+0X82,0X08,0X81,0X92,0X00,0X61,0X05,0X08,0XE3,0X06,0X9A,0X0E,0X39,0X0E,0X7A,0X06,
+0X59,0X0E,0X37,0X80,0X06,0X77,0X03,0X0E,0X56,0X06,0X56,0X06,0X55,0X06,0X54,0X80,
+0X06,0X53,0X10,0X06,0X32,0X06,0X31,0X06,0X30,0X06,0X2F,0X06,0X0E,0X06,0X0D,0X05,
+0XEC,0X05,0XCB,0X05,0XCA,0X05,0XA9,0X05,0XA8,0X05,0XA7,0X05,0X66,0X05,0X85,0X05,
+0X63,0X05,0X84,0X04,0X62,0X88,0X00,0X61,0X10,0X08,0X81,0X2D,0X40,0X2D,0X80,0X3D,
+0X60,0X3D,0XA0,0X45,0XA0,0X4D,0X81,0X5D,0XA0,0X5D,0XC0,0X65,0XC0,0X6D,0XC0,0X75,
+0XE0,0X7E,0X00,0X86,0X00,0X8E,0X00,0X9E,0X40,0X9D,0XA0,0X80,0X08,0X81,0X00,0X00,
+0X61,0X87,0X08,0X81,0X00,0X00,0X61,0X83,0X08,0X81,0X00,0X00,0X81,0X80,0X08,0X81,
+0X02,0X00,0X61,0X08,0X81,0X00,0X81,0X81,0X00,0X61,0X02,0X72,0XC0,0XF7,0X20,0XFE,
+0XE1,0X88,0XFE,0XE0,0X03,0XF7,0X00,0XFF,0X40,0XC5,0X61,0X00,0X20,0X85,0X00,0X00,
+0X04,0X00,0X01,0X00,0X00,0X08,0X00,0X9C,0X81,0XFF,0X40,0X87,0XFE,0XE0,0X04,0XFF,
+0X00,0XFE,0XC1,0XFF,0X00,0XFF,0X40,0X8B,0X40,0X82,0X00,0X61,0X00,0X08,0X81,0X80,
+0X08,0XA1,0X00,0X08,0XA2,0X81,0X08,0XC2,0X81,0X08,0XA1,0X01,0X08,0XA2,0X09,0X02,
+0X80,0X11,0X62,0X07,0X11,0XA2,0X1A,0X03,0X19,0XE3,0X11,0XA2,0X1A,0X43,0X22,0X84,
+0X11,0XE3,0X11,0XC3,0X80,0X11,0XA2,0X80,0X11,0XC3,0X02,0X11,0XA2,0X11,0X82,0X11,
+0X62,0X82,0X11,0X82,0X00,0X11,0XE2,0X80,0X19,0XE2,0X01,0X11,0X42,0X08,0XA1,0X82,
+0X00,0X61,0X02,0X08,0XC2,0X09,0X42,0X11,0X62,0X99,0X00,0X61,0X0C,0X08,0X81,0X18,
+0XC2,0X18,0XE2,0X18,0XC2,0X1A,0X24,0X1A,0X65,0X1A,0X64,0X1A,0X84,0X1A,0XA5,0X1A,
+0XC5,0X1A,0X84,0X12,0X24,0X09,0XC3,0X81,0X09,0X83,0X80,0X09,0X63,0X07,0X09,0X43,
+0X09,0X63,0X09,0X43,0X09,0X42,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,
+0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,
+0X81,0X91,0X00,0X61,0X0E,0X60,0XE2,0XC2,0X27,0XBA,0X07,0XA9,0XE7,0XA9,0XC8,0XA1,
+0XA8,0X99,0XA9,0X91,0X8A,0X89,0X6A,0X81,0X4B,0X79,0X4B,0X79,0X2C,0X71,0X2D,0X69,
+0X0E,0X50,0XCB,0X81,0X00,0X61,0X08,0X08,0XA2,0X09,0X03,0X09,0X23,0X10,0X26,0X30,
+0XB3,0X28,0XB3,0X28,0XB4,0X20,0XB4,0X18,0XB4,0X81,0X18,0XB5,0X00,0X08,0XD5,0X80,
+0X08,0XF6,0X02,0X11,0X17,0X09,0X57,0X01,0X55,0X81,0X08,0X81,0X94,0X00,0X61,0X04,
+0X0D,0X13,0X16,0X9A,0X06,0X59,0X16,0X38,0X0E,0X77,0X80,0X06,0X57,0X80,0X06,0X55,
+0X01,0X06,0X54,0X06,0X53,0X80,0X06,0X52,0X0B,0X06,0X51,0X06,0X30,0X06,0X2F,0X06,
+0X0E,0X06,0X0D,0X06,0X0C,0X05,0XEB,0X05,0XCA,0X05,0XC9,0X05,0XA8,0X05,0XA7,0X05,
+0X86,0X80,0X05,0X65,0X02,0X05,0X44,0X05,0X84,0X00,0X81,0X87,0X00,0X61,0X11,0X08,
+0X81,0X08,0XC1,0X35,0XA0,0X35,0X80,0X45,0X80,0X3D,0XA0,0X4D,0XC0,0X55,0XA0,0X5D,
+0XA0,0X65,0XE0,0X6D,0XE0,0X75,0XE0,0X7E,0X00,0X86,0X00,0X8E,0X20,0X9E,0X40,0XA6,
+0X80,0X63,0XC0,0X8D,0X08,0X81,0X80,0X08,0XA2,0X80,0X08,0XA1,0X84,0X08,0X81,0X80,
+0X00,0X61,0X02,0X8B,0X60,0XFF,0X60,0XFE,0XE1,0X88,0XFE,0XE0,0X80,0XFF,0X20,0X00,
+0XA4,0X40,0X89,0X00,0X00,0X01,0X62,0XC0,0XFF,0X40,0X89,0XFE,0XE0,0X02,0XFF,0X00,
+0XFF,0X40,0X9C,0X00,0X81,0X00,0X61,0X80,0X08,0X81,0X02,0X08,0XC1,0X08,0XC2,0X08,
+0XC1,0X81,0X08,0XA2,0X80,0X08,0XA1,0X0D,0X08,0XC1,0X11,0X22,0X11,0XC3,0X1A,0X23,
+0X19,0XC2,0X11,0XE2,0X11,0XE3,0X11,0XE2,0X1A,0X03,0X22,0XA3,0X1A,0X63,0X11,0XE2,
+0X11,0XC2,0X11,0XA2,0X81,0X11,0X82,0X00,0X11,0X62,0X81,0X11,0X82,0X03,0X11,0X62,
+0X11,0X61,0X11,0X22,0X11,0XA2,0X80,0X1A,0X02,0X02,0X1A,0X22,0X11,0X62,0X08,0X81,
+0X80,0X00,0X61,0X03,0X08,0X61,0X08,0XA1,0X09,0X42,0X11,0XA2,0X84,0X00,0X61,0X00,
+0X08,0X81,0X84,0X00,0X61,0X03,0X00,0X81,0X00,0X61,0X08,0X82,0X08,0XA2,0X80,0X08,
+0XC2,0X02,0X08,0XA2,0X00,0X81,0X08,0X81,0X80,0X00,0X61,0X80,0X08,0X41,0X04,0X08,
+0XA1,0X10,0XC2,0X18,0XC2,0X10,0XC2,0X08,0X81,0X80,0X08,0XA2,0X0D,0X08,0XE2,0X09,
+0X02,0X09,0X22,0X11,0X63,0X19,0XE3,0X1A,0X64,0X1A,0XC5,0X1A,0X85,0X11,0XE4,0X09,
+0X83,0X09,0X63,0X09,0X23,0X09,0X22,0X09,0X63,0X80,0X09,0X83,0X03,0XA9,0XE1,0XF2,
+0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X06,0XEA,0X82,0XEA,0XA3,
+0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X08,0X81,0X90,0X00,0X61,0X0B,0X60,0XE2,
+0XC2,0X07,0XB1,0XC7,0XA9,0XE7,0XA1,0XA8,0X99,0XA9,0X91,0X8A,0X89,0X8A,0X81,0X6B,
+0X79,0X4B,0X79,0X2C,0X71,0X2D,0X80,0X69,0X0E,0X00,0X48,0XAC,0X82,0X00,0X61,0X06,
+0X09,0X03,0X09,0X23,0X10,0X26,0X28,0XB4,0X28,0XB3,0X20,0XB4,0X18,0XB4,0X80,0X18,
+0XB5,0X02,0X10,0XB5,0X10,0XD6,0X08,0XF6,0X80,0X09,0X17,0X03,0X09,0X37,0X09,0X78,
+0X01,0X76,0X00,0X81,0X96,0X00,0X61,0X0A,0X00,0XA2,0X0E,0X58,0X06,0X39,0X16,0X58,
+0X0E,0X57,0X06,0X37,0X0E,0X56,0X06,0X55,0X06,0X54,0X06,0X53,0X06,0X52,0X80,0X06,
+0X51,0X0F,0X06,0X50,0X06,0X2F,0X06,0X2E,0X06,0X0D,0X06,0X0C,0X05,0XEB,0X05,0XEA,
+0X05,0XC9,0X05,0XA8,0X05,0XA7,0X05,0X86,0X05,0X65,0X05,0X85,0X0D,0X44,0X05,0X84,
+0X03,0XA1,0X85,0X00,0X61,0X82,0X08,0X81,0X04,0X1A,0XE0,0X35,0XE0,0X35,0XA0,0X45,
+0X80,0X4D,0XA0,0X80,0X55,0XC0,0X09,0X65,0XE0,0X6D,0XC0,0X75,0XE0,0X7E,0X00,0X8E,
+0X00,0X8E,0X20,0X96,0X20,0XA6,0X60,0XAE,0X80,0X08,0XA1,0X81,0X08,0X81,0X04,0X5B,
+0X00,0X6B,0X61,0X6B,0X40,0X73,0X40,0X73,0X60,0X86,0X7B,0X60,0X05,0X7B,0X40,0X7B,
+0XA0,0X7B,0X40,0X7B,0X80,0X73,0X61,0X52,0X20,0X80,0X08,0XA2,0X04,0X00,0X81,0X08,
+0X81,0X00,0X61,0X9C,0X20,0XFF,0X60,0X89,0XFE,0XE0,0X80,0XFF,0X20,0X00,0X7B,0X40,
+0X88,0X00,0X00,0X02,0X00,0X01,0X39,0X60,0XFF,0X00,0X88,0XFE,0XE0,0X05,0XFF,0X00,
+0XFE,0XE0,0XFF,0X20,0XBC,0XE1,0X00,0X61,0X00,0X82,0X80,0X08,0XA2,0X00,0X08,0XC2,
+0X80,0X08,0XE2,0X01,0X08,0XA2,0X08,0XC2,0X80,0X08,0XA1,0X0F,0X08,0XC2,0X08,0XE2,
+0X09,0X02,0X11,0XA2,0X1A,0X22,0X19,0XE2,0X11,0XC2,0X11,0XE3,0X19,0XE2,0X1A,0X23,
+0X1A,0X43,0X22,0X83,0X22,0X63,0X22,0X82,0X22,0X42,0X1A,0X02,0X81,0X11,0XA2,0X07,
+0X19,0XC2,0X19,0XE2,0X19,0XC2,0X11,0XA2,0X11,0X82,0X11,0X01,0X08,0XE2,0X11,0X82,
+0X80,0X1A,0X02,0X03,0X22,0X62,0X22,0X83,0X11,0X42,0X08,0X61,0X80,0X00,0X61,0X02,
+0X08,0X81,0X09,0X22,0X11,0XC2,0X86,0X00,0X61,0X80,0X08,0X61,0X14,0X08,0XA1,0X09,
+0X02,0X09,0X43,0X09,0X22,0X09,0X02,0X09,0X22,0X09,0X63,0X09,0X83,0X11,0X83,0X1A,
+0X04,0X11,0XC4,0X09,0X43,0X09,0X22,0X09,0X02,0X11,0X83,0X1A,0X85,0X22,0X25,0X18,
+0XC2,0X10,0XA2,0X18,0XC2,0X08,0X82,0X80,0X00,0X61,0X02,0X08,0X82,0X08,0XE2,0X09,
+0X02,0X80,0X09,0X22,0X04,0X09,0X02,0X09,0X62,0X1A,0X44,0X1A,0XC5,0X1A,0X44,0X81,
+0X09,0X63,0X00,0X09,0X22,0X80,0X09,0X43,0X03,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,
+0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,
+0XF2,0XA2,0X89,0X81,0X91,0X00,0X61,0X0E,0X58,0XE3,0XBA,0X08,0XA9,0XC8,0XA1,0XC8,
+0X99,0X89,0X91,0X8A,0X89,0X6A,0X81,0X6B,0X79,0X4C,0X79,0X2C,0X71,0X2D,0X69,0X0E,
+0X61,0X0E,0X58,0XEF,0X48,0XAC,0X82,0X00,0X61,0X06,0X08,0X82,0X08,0XA1,0X08,0X27,
+0X28,0XB4,0X20,0XB3,0X20,0XB5,0X18,0XB5,0X80,0X10,0XB5,0X07,0X10,0XD5,0X10,0XD6,
+0X09,0X16,0X09,0X17,0X09,0X37,0X09,0X58,0X01,0X98,0X09,0X96,0X98,0X00,0X61,0X01,
+0X04,0X50,0X0E,0XB9,0X80,0X06,0X57,0X04,0X06,0X76,0X06,0X55,0X0E,0X55,0X06,0X53,
+0X06,0X52,0X80,0X06,0X51,0X0B,0X06,0X50,0X06,0X2F,0X06,0X2E,0X06,0X2D,0X05,0XEC,
+0X05,0XEB,0X05,0XEA,0X05,0XC9,0X05,0XA8,0X05,0X87,0X05,0X86,0X05,0X85,0X80,0X05,
+0X64,0X01,0X05,0X83,0X05,0X02,0X85,0X00,0X61,0X83,0X08,0X81,0X0A,0X23,0X80,0X3D,
+0XE0,0X3D,0X80,0X4D,0X80,0X55,0XA0,0X5D,0XC0,0X65,0XE0,0X6D,0XE0,0X75,0XE0,0X7E,
+0X00,0X8E,0X00,0X80,0X96,0X20,0X02,0X9E,0X20,0XAE,0X60,0XAE,0X20,0X81,0X08,0X81,
+0X04,0X7B,0XC0,0XE7,0X40,0XEF,0X20,0XEF,0X40,0XF7,0X40,0X86,0XFF,0X40,0X81,0XFF,
+0X60,0X03,0XFF,0X20,0XFF,0X60,0XFF,0X80,0XDE,0X60,0X80,0X08,0XE2,0X04,0X08,0XC2,
+0X08,0XA2,0X00,0X61,0XAC,0XA0,0XFF,0X40,0X8A,0XFE,0XE0,0X01,0XFF,0X40,0X62,0X80,
+0X83,0X00,0X00,0X00,0X00,0X20,0X83,0X00,0X00,0X02,0X31,0X41,0XF6,0XC0,0XFF,0X00,
+0X89,0XFE,0XE0,0X08,0XFF,0X20,0XCD,0XA0,0X00,0X61,0X08,0XA2,0X08,0XC2,0X00,0XC2,
+0X08,0XE2,0X09,0X23,0X09,0X02,0X80,0X08,0XC2,0X13,0X08,0XC1,0X09,0X02,0X09,0X62,
+0X11,0XA3,0X19,0XE2,0X1A,0X22,0X19,0XE2,0X11,0XC2,0X1A,0X22,0X1A,0X43,0X19,0XE2,
+0X1A,0X23,0X22,0X83,0X2A,0XC2,0X2A,0XE3,0X22,0X82,0X22,0X62,0X22,0X22,0X22,0X42,
+0X22,0XA2,0X80,0X2A,0XC3,0X07,0X22,0X83,0X1A,0X02,0X11,0X82,0X08,0XE2,0X08,0XA1,
+0X08,0XC2,0X11,0X62,0X1A,0X22,0X80,0X1A,0X02,0X02,0X2A,0XE3,0X22,0X83,0X09,0X22,
+0X81,0X08,0X61,0X01,0X08,0XE2,0X11,0XA2,0X82,0X00,0X61,0X04,0X08,0X61,0X08,0X81,
+0X00,0XA1,0X08,0XE2,0X09,0X22,0X80,0X11,0X62,0X80,0X11,0X82,0X01,0X09,0X42,0X09,
+0X22,0X80,0X09,0X02,0X02,0X09,0X22,0X11,0XA3,0X12,0X04,0X80,0X11,0XE3,0X08,0X1A,
+0X84,0X22,0XE4,0X1A,0X64,0X19,0XC3,0X11,0X02,0X08,0X81,0X10,0XA2,0X18,0XE2,0X08,
+0X81,0X80,0X00,0X61,0X0B,0X08,0X81,0X09,0X22,0X11,0X83,0X09,0X62,0X11,0X62,0X09,
+0X42,0X09,0X22,0X09,0X02,0X09,0X42,0X11,0XE3,0X1A,0X44,0X12,0X04,0X81,0X09,0X83,
+0X04,0X09,0X43,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,
+0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X80,0X00,
+0X81,0X8F,0X00,0X61,0X0E,0X58,0XC3,0XB1,0XE8,0XA1,0XA9,0X99,0XA9,0X91,0X8A,0X89,
+0X6A,0X81,0X4B,0X79,0X4B,0X79,0X2C,0X71,0X0C,0X69,0X0D,0X60,0XEE,0X58,0XEE,0X50,
+0XF0,0X40,0XAD,0X83,0X00,0X61,0X06,0X08,0XC2,0X08,0X27,0X20,0XB5,0X20,0XB4,0X18,
+0XB5,0X10,0XB5,0X10,0XD5,0X80,0X08,0XD6,0X06,0X08,0XF6,0X01,0X37,0X09,0X37,0X09,
+0X57,0X09,0X98,0X01,0XD8,0X01,0XB6,0X99,0X00,0X61,0X11,0X06,0X35,0X06,0X78,0X06,
+0X76,0X06,0X74,0X06,0X33,0X06,0X54,0X06,0X53,0X06,0X52,0X06,0X51,0X06,0X50,0X06,
+0X2F,0X06,0X2E,0X06,0X0D,0X06,0X0C,0X05,0XCB,0X05,0XCA,0X05,0XC9,0X05,0XA8,0X80,
+0X05,0X87,0X80,0X05,0X65,0X03,0X05,0X64,0X05,0X42,0X05,0XA2,0X02,0XC0,0X85,0X00,
+0X61,0X80,0X08,0XA2,0X00,0X08,0XA1,0X80,0X08,0X81,0X0B,0X2C,0X00,0X45,0XE0,0X4D,
+0XA0,0X55,0XA0,0X5D,0XA0,0X6D,0XC0,0X6D,0XE0,0X75,0XE0,0X7D,0XE0,0X86,0X20,0X96,
+0X00,0X9E,0X20,0X80,0XA6,0X40,0X01,0XB6,0X80,0XA5,0XA0,0X81,0X08,0X81,0X04,0X94,
+0X80,0XEF,0X00,0XE6,0X80,0XEE,0XC0,0XF6,0XC0,0X86,0XFE,0XE0,0X80,0XFF,0X00,0X80,
+0XFE,0XE0,0X02,0XFE,0XE1,0XFF,0X20,0XF7,0X00,0X80,0X08,0XE2,0X80,0X09,0X02,0X02,
+0X08,0XE2,0XBD,0X20,0XFF,0X40,0X88,0XFE,0XE0,0X03,0XFF,0X00,0XFE,0XC0,0XFF,0X20,
+0X41,0XC0,0X86,0X00,0X00,0X05,0X00,0X01,0X00,0X20,0X00,0X00,0X29,0X20,0XEE,0X80,
+0XFF,0X00,0X85,0XFE,0XE0,0X01,0XFE,0XC0,0XFF,0X00,0X80,0XFE,0XE0,0X02,0XFF,0X00,
+0XD5,0XE0,0X00,0XA1,0X82,0X08,0XC2,0X80,0X08,0XE2,0X80,0X08,0XC2,0X02,0X09,0X02,
+0X11,0X62,0X1A,0X03,0X80,0X22,0XA3,0X0B,0X1A,0X42,0X1A,0X03,0X11,0XC2,0X1A,0X42,
+0X1A,0X63,0X1A,0X23,0X1A,0X43,0X22,0XC3,0X33,0X43,0X33,0X22,0X22,0X62,0X1A,0X02,
+0X80,0X19,0XE2,0X00,0X1A,0X02,0X80,0X19,0XE2,0X02,0X11,0X82,0X11,0X01,0X08,0XC1,
+0X80,0X08,0XA1,0X11,0X08,0XE2,0X11,0X82,0X1A,0X02,0X1A,0X22,0X19,0XE2,0X22,0X62,
+0X33,0X02,0X22,0X62,0X08,0XC1,0X08,0X61,0X00,0X61,0X08,0XA1,0X09,0X22,0X00,0X61,
+0X08,0X61,0X08,0X81,0X08,0XA1,0X09,0X02,0X80,0X11,0XA3,0X80,0X11,0X82,0X04,0X11,
+0XA2,0X1A,0X03,0X1A,0X23,0X12,0X04,0X11,0XA3,0X81,0X09,0X22,0X02,0X09,0X42,0X1A,
+0X03,0X1A,0X64,0X80,0X22,0XA4,0X08,0X1A,0X23,0X11,0X62,0X09,0X22,0X08,0XC2,0X00,
+0X61,0X08,0X61,0X08,0X82,0X18,0XE2,0X08,0XA2,0X81,0X00,0X61,0X03,0X08,0XE2,0X09,
+0X42,0X09,0X22,0X09,0X42,0X81,0X09,0X02,0X0B,0X09,0X22,0X09,0X43,0X09,0X62,0X12,
+0X04,0X1A,0X24,0X11,0XE3,0X09,0X83,0X09,0X43,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,
+0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X06,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,
+0XF2,0XA2,0X89,0X81,0X08,0X82,0X80,0X08,0X81,0X8E,0X00,0X61,0X0E,0X50,0XC3,0XA9,
+0XC9,0X99,0X8A,0X91,0X8A,0X89,0X6A,0X81,0X4B,0X79,0X4B,0X79,0X2C,0X71,0X2D,0X69,
+0X0D,0X60,0XEE,0X58,0XEF,0X50,0XCF,0X48,0XD1,0X38,0XAD,0X83,0X00,0X61,0X0F,0X08,
+0XA2,0X00,0X28,0X20,0XB5,0X18,0XB4,0X10,0XB6,0X10,0XB5,0X08,0XD6,0X08,0XF6,0X09,
+0X16,0X09,0X17,0X01,0X57,0X09,0X57,0X09,0X97,0X09,0XB8,0X02,0X18,0X09,0XF7,0X99,
+0X00,0X61,0X02,0X01,0X44,0X06,0XD8,0X06,0X75,0X80,0X06,0X53,0X80,0X06,0X52,0X09,
+0X06,0X51,0X06,0X50,0X06,0X2F,0X06,0X0E,0X06,0X0D,0X05,0XEC,0X05,0XEB,0X05,0XCA,
+0X05,0XC9,0X05,0XA8,0X80,0X05,0X87,0X05,0X05,0X66,0X05,0X65,0X05,0X64,0X0D,0X43,
+0X05,0X83,0X04,0X81,0X85,0X00,0X61,0X00,0X08,0X81,0X81,0X08,0XA2,0X12,0X08,0XA1,
+0X08,0X81,0X34,0X40,0X4D,0XE0,0X55,0XA0,0X5D,0XC0,0X65,0XA0,0X75,0XC0,0X76,0X00,
+0X7E,0X00,0X86,0X00,0X96,0X20,0X96,0X00,0X9E,0X40,0XA6,0X40,0XAE,0X60,0XBE,0XC0,
+0XA5,0X60,0X08,0XA1,0X80,0X08,0X81,0X04,0X94,0X80,0XEE,0XE0,0XEE,0XE1,0XEE,0XC0,
+0XF6,0XC0,0X89,0XFE,0XE0,0X00,0XFE,0XE1,0X80,0XFE,0XE0,0X08,0XF6,0XC0,0X09,0X02,
+0X08,0XE2,0X09,0X22,0X09,0X62,0X09,0X42,0XCD,0X80,0XFF,0X40,0XFF,0X00,0X8A,0XFE,
+0XE0,0X00,0X29,0X00,0X87,0X00,0X00,0X04,0X00,0X20,0X00,0X00,0X18,0XE0,0XEE,0X40,
+0XFF,0X00,0X85,0XFE,0XE0,0X01,0XFE,0XC0,0XFF,0X00,0X80,0XFE,0XE0,0X05,0XFF,0X00,
+0XDE,0X20,0X08,0XC1,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X80,0X08,0XC1,0X80,0X08,0XE2,
+0X13,0X09,0X02,0X11,0XA2,0X1A,0X43,0X1A,0X63,0X22,0XA3,0X1A,0X83,0X1A,0X63,0X1A,
+0X22,0X11,0XE2,0X1A,0X02,0X1A,0X63,0X1A,0X43,0X1A,0X63,0X2B,0X23,0X3B,0XC4,0X33,
+0X63,0X22,0X42,0X11,0X82,0X11,0X42,0X11,0X02,0X81,0X08,0XE2,0X00,0X08,0XA2,0X81,
+0X08,0XA1,0X14,0X08,0XC2,0X09,0X22,0X11,0XA2,0X19,0XE2,0X1A,0X22,0X19,0XE2,0X1A,
+0X22,0X2B,0X02,0X33,0X42,0X19,0XA2,0X08,0X81,0X00,0X61,0X08,0X61,0X09,0X02,0X00,
+0X61,0X08,0XA1,0X08,0XE2,0X11,0X63,0X1A,0X44,0X1A,0XA5,0X1A,0X24,0X80,0X11,0X62,
+0X00,0X11,0X82,0X80,0X1A,0X03,0X80,0X11,0XC3,0X00,0X11,0X82,0X80,0X09,0X42,0X08,
+0X11,0X82,0X22,0X83,0X22,0XC4,0X1A,0X64,0X11,0X82,0X09,0X42,0X09,0X82,0X11,0XC3,
+0X09,0X02,0X80,0X00,0X61,0X03,0X08,0X81,0X18,0XE2,0X10,0XC2,0X08,0X61,0X80,0X00,
+0X61,0X12,0X08,0XA1,0X11,0X82,0X09,0X42,0X09,0X62,0X09,0X42,0X09,0X22,0X09,0X42,
+0X09,0X63,0X09,0X43,0X09,0X42,0X09,0X22,0X11,0X83,0X1A,0X44,0X1A,0X64,0X11,0XC4,
+0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,
+0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X82,0X08,0X81,0X8D,0X00,
+0X61,0X0E,0X50,0XC3,0XA1,0XA9,0X91,0X6A,0X89,0X8A,0X81,0X4B,0X81,0X4C,0X79,0X2C,
+0X71,0X2D,0X69,0X0E,0X60,0XEE,0X58,0XEF,0X50,0XF0,0X48,0XD0,0X48,0XD1,0X38,0X8E,
+0X83,0X00,0X61,0X0F,0X08,0XA2,0X00,0X28,0X18,0XB5,0X10,0XB4,0X10,0XB6,0X10,0XD6,
+0X08,0XF6,0X09,0X16,0X09,0X36,0X09,0X57,0X01,0X78,0X09,0X98,0X09,0XB8,0X09,0XF8,
+0X02,0X59,0X0A,0X17,0X9A,0X00,0X61,0X0A,0X05,0X71,0X06,0X75,0X06,0X53,0X06,0X72,
+0X06,0X52,0X06,0X51,0X06,0X30,0X06,0X2F,0X06,0X2E,0X06,0X0D,0X05,0XEC,0X80,0X05,
+0XEA,0X03,0X05,0XA9,0X05,0XA8,0X05,0XA7,0X05,0X86,0X80,0X05,0X65,0X04,0X05,0X44,
+0X05,0X43,0X05,0X42,0X05,0X03,0X00,0XA1,0X84,0X00,0X61,0X00,0X08,0X81,0X82,0X08,
+0XA2,0X0C,0X08,0XA1,0X08,0X81,0X3C,0X80,0X55,0XE0,0X5D,0XA0,0X65,0XE0,0X6D,0XE0,
+0X7D,0XE0,0X7E,0X00,0X8E,0X00,0X96,0X00,0X9E,0X20,0XA6,0X20,0X80,0XAE,0X40,0X02,
+0XBE,0X80,0XCE,0XC0,0X9D,0X00,0X81,0X08,0X81,0X04,0X9C,0X80,0XF7,0X00,0XEE,0XE0,
+0XF6,0XC0,0XFF,0X00,0X8A,0XFE,0XE0,0X02,0XFF,0X00,0XFF,0X01,0XF6,0X80,0X81,0X09,
+0X02,0X04,0X09,0X42,0X09,0X62,0XD5,0XC0,0XFF,0X20,0XFF,0X00,0X8A,0XFE,0XE0,0X02,
+0X21,0X00,0X00,0X00,0X00,0X20,0X87,0X00,0X00,0X02,0X18,0XC0,0XE6,0X20,0XFF,0X00,
+0X89,0XFE,0XE0,0X01,0XFF,0X00,0XE6,0X40,0X81,0X08,0XC2,0X80,0X08,0XE2,0X06,0X08,
+0XC2,0X09,0X02,0X11,0X42,0X11,0XC2,0X22,0X63,0X22,0XC3,0X1A,0X63,0X80,0X1A,0X22,
+0X0D,0X1A,0X43,0X1A,0X22,0X1A,0X02,0X1A,0X23,0X1A,0X63,0X1A,0X43,0X1A,0X63,0X2A,
+0XE3,0X33,0X84,0X2A,0XC3,0X11,0X82,0X09,0X02,0X10,0XE1,0X08,0XC1,0X81,0X08,0XC2,
+0X12,0X08,0X82,0X08,0X81,0X08,0XA1,0X08,0XC1,0X08,0XE2,0X09,0X22,0X11,0XA2,0X19,
+0XC2,0X1A,0X02,0X19,0XE2,0X1A,0X02,0X2A,0XA2,0X33,0X02,0X2A,0XA2,0X11,0X42,0X08,
+0X81,0X08,0X61,0X08,0XE2,0X09,0X02,0X80,0X11,0XA3,0X04,0X1A,0X44,0X1A,0X85,0X1A,
+0X24,0X11,0XA3,0X11,0X62,0X80,0X11,0X82,0X0A,0X12,0X44,0X1A,0XA6,0X11,0XC3,0X12,
+0X03,0X12,0X24,0X11,0XC3,0X19,0XE2,0X22,0XC4,0X22,0X83,0X1A,0X03,0X11,0XA2,0X80,
+0X09,0X42,0X02,0X09,0X62,0X11,0XC3,0X08,0XE2,0X80,0X00,0X61,0X03,0X08,0X61,0X18,
+0XE2,0X19,0X02,0X08,0X82,0X80,0X00,0X61,0X12,0X08,0X81,0X11,0X42,0X09,0X42,0X11,
+0XC3,0X1A,0X44,0X09,0X62,0X09,0X42,0X09,0X63,0X09,0X43,0X09,0X42,0X09,0X43,0X09,
+0X42,0X09,0X83,0X11,0XE4,0X1A,0X65,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,
+0XEA,0X82,0X81,0XEA,0XA2,0X06,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,
+0X89,0X81,0X08,0XE2,0X81,0X08,0X81,0X8D,0X00,0X61,0X0A,0X50,0XC3,0XA1,0XA9,0X89,
+0X6B,0X81,0X6B,0X81,0X4B,0X79,0X2C,0X71,0X2D,0X69,0X0E,0X61,0X0E,0X58,0XEE,0X50,
+0XCF,0X80,0X48,0XD0,0X01,0X40,0XB2,0X38,0X8E,0X83,0X00,0X61,0X0F,0X00,0X82,0X00,
+0X48,0X18,0XB5,0X10,0XB4,0X10,0XD6,0X08,0XD6,0X08,0XF6,0X09,0X17,0X09,0X36,0X09,
+0X58,0X01,0X98,0X09,0XB8,0X09,0XD8,0X0A,0X18,0X02,0X79,0X0A,0X37,0X9A,0X00,0X61,
+0X02,0X00,0XC2,0X0E,0X95,0X06,0X53,0X80,0X06,0X51,0X11,0X06,0X30,0X06,0X2F,0X06,
+0X2E,0X06,0X0D,0X06,0X0C,0X05,0XEB,0X05,0XEA,0X05,0XC9,0X05,0XA8,0X05,0XA7,0X05,
+0X86,0X05,0X85,0X05,0X65,0X05,0X64,0X05,0X43,0X05,0X42,0X05,0X81,0X03,0XC1,0X84,
+0X00,0X61,0X00,0X08,0X81,0X83,0X08,0XA2,0X80,0X08,0XA1,0X0A,0X44,0XC0,0X5D,0XE0,
+0X65,0XC0,0X6E,0X00,0X76,0X00,0X7D,0XE0,0X7E,0X00,0X96,0X20,0X9E,0X20,0XA6,0X40,
+0XAE,0X40,0X80,0XB6,0X60,0X02,0XC6,0X80,0XD6,0XE0,0X9C,0XC0,0X81,0X08,0X81,0X04,
+0X9C,0X60,0XFF,0X20,0XF6,0XC0,0XFE,0XE1,0XFE,0XC0,0X8A,0XFE,0XE0,0X02,0XF7,0X00,
+0XFE,0XE0,0XFE,0XC0,0X81,0X09,0X22,0X80,0X09,0X42,0X01,0XD6,0X00,0XFF,0X20,0X89,
+0XFE,0XE0,0X02,0XFE,0XC0,0XFE,0XE0,0X21,0X21,0X89,0X00,0X00,0X02,0X18,0XA0,0XE6,
+0X00,0XFF,0X00,0X85,0XFE,0XE0,0X06,0XFF,0X00,0XFE,0XE0,0XFE,0XE1,0XFE,0XE0,0XFF,
+0X00,0XE6,0X60,0X08,0XC2,0X80,0X08,0XE2,0X00,0X09,0X02,0X80,0X08,0XC2,0X13,0X09,
+0X62,0X1A,0X03,0X1A,0X63,0X22,0XC3,0X22,0XA3,0X1A,0X43,0X1A,0X02,0X1A,0X22,0X1A,
+0X63,0X1A,0X43,0X1A,0X23,0X22,0X83,0X1A,0X63,0X1A,0X43,0X1A,0X22,0X1A,0X42,0X1A,
+0X43,0X19,0XC2,0X11,0X22,0X08,0XE2,0X80,0X08,0XC1,0X80,0X08,0XA2,0X00,0X08,0XA1,
+0X80,0X08,0X81,0X1B,0X08,0XA1,0X08,0XE2,0X09,0X02,0X09,0X22,0X11,0X62,0X11,0XA2,
+0X19,0XE2,0X1A,0X02,0X19,0XE2,0X22,0X62,0X2A,0XC2,0X33,0X22,0X2A,0X82,0X11,0X22,
+0X08,0X61,0X08,0X82,0X1A,0X03,0X1A,0X23,0X11,0X82,0X11,0XE3,0X12,0X04,0X11,0X82,
+0X11,0X62,0X11,0XC3,0X12,0X04,0X11,0XC3,0X1A,0X85,0X1A,0XC6,0X80,0X1A,0XA5,0X04,
+0X1A,0X64,0X22,0X63,0X22,0XE4,0X1A,0X43,0X11,0X62,0X80,0X11,0XA2,0X01,0X09,0X62,
+0X09,0X42,0X80,0X09,0X62,0X00,0X08,0X81,0X81,0X00,0X61,0X02,0X18,0XC2,0X21,0X02,
+0X08,0X81,0X81,0X00,0X61,0X04,0X08,0XA2,0X09,0X22,0X11,0XA2,0X23,0X06,0X12,0X04,
+0X80,0X09,0X42,0X00,0X09,0X22,0X82,0X09,0X63,0X05,0X09,0X43,0X11,0X63,0XA9,0XE1,
+0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X00,0XEA,0X82,0X80,
+0XEA,0XA2,0X02,0XEA,0X82,0XF2,0XC2,0X89,0X81,0X80,0X09,0X22,0X00,0X08,0XC2,0X80,
+0X08,0X82,0X8B,0X00,0X61,0X0F,0X00,0X41,0X48,0X85,0X91,0X8B,0X81,0X6B,0X79,0X4B,
+0X79,0X2D,0X71,0X0D,0X69,0X0D,0X61,0X0E,0X58,0XEF,0X50,0XCF,0X50,0XD0,0X48,0XB0,
+0X40,0XB1,0X38,0XB2,0X28,0X8F,0X83,0X00,0X61,0X02,0X00,0X82,0X00,0X27,0X08,0XD6,
+0X80,0X10,0XD6,0X0A,0X09,0X17,0X09,0X37,0X01,0X57,0X09,0X77,0X09,0X97,0X01,0XB8,
+0X01,0XF8,0X02,0X18,0X02,0X59,0X0A,0X98,0X02,0X96,0X9B,0X00,0X61,0X14,0X04,0X8C,
+0X06,0XD3,0X06,0X30,0X06,0X4F,0X06,0X2F,0X06,0X0E,0X05,0XED,0X05,0XEC,0X05,0XCB,
+0X05,0XCA,0X05,0XC9,0X05,0XA8,0X05,0X87,0X0D,0X66,0X05,0XC4,0X05,0X44,0X05,0X65,
+0X0D,0X44,0X05,0X41,0X05,0X61,0X0C,0XE1,0X85,0X00,0X61,0X00,0X08,0X81,0X85,0X08,
+0XA2,0X00,0X4C,0XE0,0X80,0X6D,0XE0,0X0C,0X76,0X00,0X7E,0X00,0X86,0X00,0X8E,0X00,
+0X9E,0X40,0XA6,0X20,0XAE,0X60,0XAE,0X40,0XBE,0X80,0XC6,0X80,0XCE,0X80,0XD7,0X00,
+0XA4,0XE0,0X81,0X08,0X81,0X02,0X9C,0X81,0XFF,0X20,0XFE,0XC0,0X80,0XFF,0X00,0X02,
+0XFE,0XC0,0XFF,0X00,0XFE,0XC0,0X80,0XFE,0XE0,0X02,0XFE,0XE1,0XFE,0XE0,0XFF,0X00,
+0X81,0XFE,0XE0,0X03,0XFF,0X00,0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X81,0X09,0X22,0X03,
+0X09,0X42,0X09,0X62,0XD5,0XE0,0XFF,0X20,0X88,0XFE,0XE0,0X00,0XFF,0X00,0X80,0XFE,
+0XE0,0X00,0X21,0X01,0X86,0X00,0X00,0X00,0X00,0X01,0X80,0X00,0X00,0X02,0X18,0X80,
+0XE6,0X00,0XFF,0X21,0X86,0XFE,0XE0,0X01,0XFF,0X00,0XFE,0XE1,0X80,0XFE,0XE0,0X09,
+0XE6,0X60,0X08,0XE2,0X09,0X02,0X08,0XE1,0X08,0XE2,0X08,0XC2,0X11,0X42,0X1A,0X02,
+0X1A,0X43,0X1A,0X63,0X80,0X22,0XA3,0X0F,0X1A,0X43,0X1A,0X02,0X1A,0X22,0X1A,0X43,
+0X1A,0X63,0X1A,0X83,0X22,0XA3,0X22,0X62,0X1A,0X43,0X1A,0X23,0X19,0XE2,0X11,0X82,
+0X09,0X42,0X09,0X02,0X08,0XE1,0X08,0XC2,0X82,0X08,0XA1,0X09,0X08,0X81,0X08,0XA1,
+0X08,0XC1,0X09,0X22,0X09,0X62,0X09,0X22,0X11,0X62,0X11,0XC2,0X1A,0X22,0X1A,0X42,
+0X80,0X1A,0X02,0X17,0X22,0X62,0X33,0X02,0X3B,0XA3,0X2A,0XA3,0X08,0XE2,0X08,0X61,
+0X1A,0X24,0X11,0XC3,0X11,0X62,0X11,0XA3,0X12,0X24,0X11,0XC3,0X11,0X62,0X1B,0X48,
+0X1B,0X89,0X12,0X44,0X1A,0X85,0X1A,0XE5,0X12,0X85,0X1A,0X64,0X22,0XC4,0X23,0X05,
+0X19,0XA2,0X11,0X62,0X80,0X11,0XA3,0X80,0X09,0X62,0X02,0X09,0X42,0X11,0X82,0X09,
+0X22,0X80,0X00,0X61,0X04,0X08,0X61,0X00,0X61,0X10,0XC1,0X21,0X02,0X08,0X81,0X80,
+0X00,0X61,0X06,0X08,0X61,0X00,0XA2,0X09,0X42,0X11,0X83,0X11,0XC3,0X11,0XE4,0X09,
+0X83,0X80,0X09,0X63,0X00,0X09,0X83,0X80,0X09,0X63,0X06,0X09,0X62,0X09,0X42,0X09,
+0X23,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X00,
+0XEA,0X82,0X80,0XEA,0XA2,0X07,0XEA,0X82,0XF2,0XC2,0X89,0X81,0X09,0X42,0X09,0X62,
+0X09,0X02,0X08,0XA2,0X08,0X82,0X8B,0X00,0X61,0X0C,0X00,0X41,0X40,0X85,0X89,0X6B,
+0X81,0X4B,0X71,0X4C,0X71,0X0D,0X69,0X0D,0X61,0X0E,0X58,0XEF,0X50,0XF0,0X50,0XD0,
+0X48,0XB0,0X40,0XB1,0X80,0X38,0XB2,0X00,0X28,0X8F,0X83,0X00,0X61,0X04,0X08,0X82,
+0X00,0X27,0X08,0XD7,0X10,0XD6,0X10,0XF6,0X80,0X09,0X37,0X08,0X01,0X77,0X09,0X97,
+0X09,0XB8,0X01,0XF9,0X0A,0X19,0X0A,0X58,0X0A,0X99,0X0A,0XD9,0X02,0XD7,0X9B,0X00,
+0X61,0X02,0X00,0X81,0X06,0X51,0X0E,0X50,0X80,0X06,0X2E,0X0F,0X06,0X0D,0X05,0XEC,
+0X05,0XEB,0X05,0XCA,0X05,0XC9,0X05,0XA8,0X05,0XA7,0X05,0XA6,0X05,0X45,0X05,0X85,
+0X05,0X44,0X05,0X82,0X05,0X23,0X05,0X41,0X05,0X81,0X01,0X01,0X85,0X00,0X61,0X04,
+0X08,0X81,0X08,0XA1,0X08,0XC2,0X08,0XA1,0X08,0XA2,0X80,0X08,0XA1,0X10,0X08,0XA2,
+0X54,0XC0,0X76,0X00,0X75,0XE0,0X7E,0X00,0X86,0X00,0X96,0X20,0X9E,0X20,0X9E,0X40,
+0XAE,0X40,0XB6,0X60,0XBE,0X60,0XC6,0X80,0XCE,0X80,0XD6,0XA0,0XDF,0X00,0XAD,0X00,
+0X80,0X08,0X81,0X02,0X08,0XA2,0XA4,0X80,0XFF,0X40,0X83,0XFE,0XE0,0X05,0XFE,0XE2,
+0XFF,0X00,0XFE,0XE0,0XFE,0XC0,0XFE,0XE0,0XFF,0X00,0X81,0XFE,0XE0,0X04,0XFF,0X00,
+0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X09,0X02,0X80,0X09,0X22,0X03,0X09,0X42,0X09,0X62,
+0XD5,0XC0,0XFF,0X20,0X88,0XFE,0XE0,0X00,0XFF,0X00,0X80,0XFE,0XE0,0X00,0X20,0XE0,
+0X83,0X00,0X00,0X80,0X00,0X20,0X82,0X00,0X00,0X02,0X18,0XA0,0XE6,0X00,0XFF,0X21,
+0X86,0XFE,0XE0,0X00,0XFF,0X00,0X80,0XFE,0XE0,0X02,0XFF,0X00,0XE6,0X20,0X08,0XE2,
+0X80,0X08,0XC2,0X02,0X08,0XE2,0X11,0X42,0X1A,0X02,0X80,0X22,0XA3,0X00,0X22,0X83,
+0X80,0X22,0XA3,0X04,0X1A,0X63,0X1A,0X02,0X1A,0X22,0X1A,0X63,0X1A,0X83,0X81,0X22,
+0X83,0X07,0X1A,0X43,0X19,0XE3,0X11,0XA2,0X11,0X82,0X09,0X22,0X08,0XC1,0X08,0XC2,
+0X08,0XA2,0X80,0X08,0XA1,0X81,0X08,0X81,0X1B,0X08,0XA1,0X09,0X02,0X11,0X82,0X11,
+0XA3,0X09,0X02,0X11,0X62,0X1A,0X22,0X22,0X82,0X2A,0X82,0X22,0X42,0X19,0XC2,0X1A,
+0X02,0X2A,0XA2,0X33,0XA3,0X3B,0XE4,0X22,0X42,0X08,0X81,0X09,0X42,0X11,0XC3,0X1A,
+0XC6,0X12,0X44,0X1A,0X44,0X12,0X24,0X1A,0X86,0X1B,0X48,0X13,0X28,0X1A,0XE6,0X1A,
+0XA5,0X80,0X1A,0XC5,0X06,0X23,0X25,0X22,0XC4,0X11,0X82,0X09,0X42,0X11,0X62,0X11,
+0XC3,0X09,0X82,0X80,0X09,0X62,0X02,0X11,0XA2,0X11,0XA3,0X08,0XC2,0X82,0X00,0X61,
+0X02,0X10,0XA1,0X29,0X23,0X10,0XA2,0X81,0X00,0X61,0X09,0X08,0X81,0X08,0XC2,0X09,
+0X62,0X09,0XA3,0X09,0X62,0X09,0X42,0X09,0X83,0X09,0XA3,0X11,0XA3,0X09,0X83,0X80,
+0X09,0X42,0X05,0X09,0X22,0X09,0X43,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,
+0XEA,0X82,0X81,0XEA,0XA2,0X00,0XEA,0X82,0X81,0XEA,0XA2,0X07,0XF2,0XC2,0X89,0X81,
+0X09,0X02,0X09,0X22,0X09,0X02,0X08,0XC2,0X08,0XA2,0X08,0X82,0X8B,0X00,0X61,0X0E,
+0X40,0X85,0X89,0X4C,0X79,0X2B,0X71,0X2C,0X69,0X0D,0X61,0X0E,0X58,0XEF,0X50,0XF0,
+0X48,0XD0,0X48,0XB1,0X40,0XB1,0X38,0XB2,0X30,0XB2,0X30,0XB3,0X28,0X8F,0X83,0X00,
+0X61,0X0F,0X08,0X82,0X00,0X28,0X08,0XF7,0X10,0XF6,0X09,0X16,0X09,0X57,0X09,0X58,
+0X09,0X98,0X09,0XB8,0X09,0XF8,0X02,0X19,0X0A,0X59,0X0A,0X79,0X0A,0XD9,0X0A,0XF9,
+0X02,0XF7,0X9C,0X00,0X61,0X12,0X03,0XA9,0X06,0X91,0X06,0X2D,0X06,0X0D,0X06,0X0C,
+0X05,0XEB,0X05,0XEA,0X05,0XA9,0X05,0XA8,0X05,0XA7,0X05,0X86,0X05,0X85,0X05,0X44,
+0X05,0X65,0X0D,0X43,0X05,0X61,0X05,0X41,0X05,0X81,0X04,0X41,0X85,0X00,0X61,0X01,
+0X08,0X81,0X08,0XA2,0X83,0X08,0XA1,0X07,0X08,0XA2,0X08,0XA1,0X54,0XC0,0X7E,0X20,
+0X7E,0X00,0X86,0X00,0X8E,0X00,0X9E,0X20,0X80,0XA6,0X40,0X07,0XB6,0X40,0XBE,0X60,
+0XC6,0X60,0XCE,0X80,0XD6,0X80,0XDE,0XA0,0XE7,0X00,0XBD,0X40,0X80,0X08,0X81,0X06,
+0X08,0XC2,0XAC,0XE0,0XFF,0X20,0XFE,0XC0,0XFE,0XA0,0XFF,0X01,0XFF,0X00,0X81,0XFE,
+0XE0,0X01,0XFF,0X00,0XFE,0XE1,0X83,0XFE,0XE0,0X03,0XFF,0X00,0XFE,0XC0,0XFF,0X00,
+0XF6,0XA0,0X82,0X09,0X22,0X02,0X09,0X42,0XCD,0XA0,0XFF,0X40,0X88,0XFE,0XE0,0X03,
+0XFF,0X00,0XFE,0XE0,0XFF,0X00,0X29,0X00,0X87,0X00,0X00,0X04,0X00,0X20,0X00,0X00,
+0X20,0XC0,0XE6,0X20,0XFF,0X00,0X85,0XFE,0XE0,0X02,0XFE,0XC0,0XFF,0X00,0XFE,0XE0,
+0X80,0XFF,0X00,0X00,0XDE,0X00,0X80,0X08,0XE2,0X06,0X09,0X22,0X11,0XA2,0X1A,0X23,
+0X2B,0X03,0X33,0X63,0X2B,0X23,0X22,0XC3,0X80,0X22,0XA3,0X00,0X22,0X83,0X80,0X1A,
+0X43,0X02,0X1A,0X83,0X22,0XA3,0X22,0X83,0X80,0X1A,0X63,0X07,0X1A,0X43,0X1A,0X02,
+0X11,0XC3,0X11,0X82,0X08,0XE2,0X08,0XA1,0X08,0XC2,0X08,0XA1,0X82,0X08,0X81,0X1A,
+0X08,0XA1,0X08,0XC2,0X09,0X42,0X11,0XE3,0X11,0XA2,0X09,0X22,0X11,0XA2,0X22,0X82,
+0X2A,0XC2,0X2A,0XE2,0X22,0X82,0X1A,0X02,0X22,0X62,0X2A,0XE3,0X33,0X83,0X3C,0X04,
+0X33,0XC4,0X11,0X62,0X11,0XC3,0X12,0X24,0X1B,0X47,0X1A,0XC6,0X12,0X24,0X1A,0X85,
+0X1A,0XE6,0X1A,0XA5,0X1A,0X85,0X80,0X1A,0XA5,0X0D,0X1B,0X06,0X23,0X86,0X1A,0X84,
+0X11,0XA2,0X11,0XC3,0X11,0XE3,0X11,0XC3,0X11,0X82,0X09,0X62,0X11,0X62,0X11,0X82,
+0X11,0XC2,0X11,0X82,0X08,0X81,0X81,0X00,0X61,0X05,0X08,0X61,0X18,0XC2,0X29,0X23,
+0X18,0XE2,0X00,0X61,0X08,0X61,0X80,0X00,0X61,0X08,0X08,0X82,0X08,0XE2,0X11,0XC3,
+0X09,0X83,0X09,0X42,0X11,0X42,0X09,0X83,0X11,0X83,0X09,0X63,0X81,0X09,0X22,0X04,
+0X09,0X42,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,
+0X01,0XEA,0X82,0XEA,0XA3,0X80,0XEA,0XA2,0X03,0XF2,0XC2,0X89,0X81,0X08,0XE2,0X09,
+0X02,0X81,0X08,0XE2,0X00,0X08,0XA2,0X8B,0X00,0X61,0X0E,0X38,0X86,0X81,0X4C,0X71,
+0X2C,0X69,0X0D,0X60,0XEE,0X58,0XEF,0X50,0XF0,0X48,0XD0,0X48,0XB1,0X40,0XB1,0X38,
+0XB2,0X30,0XB2,0X30,0XB3,0X28,0XB3,0X20,0X90,0X83,0X00,0X61,0X01,0X08,0X82,0X00,
+0X28,0X80,0X09,0X17,0X0B,0X09,0X37,0X09,0X78,0X09,0X98,0X09,0XD8,0X09,0XF8,0X0A,
+0X18,0X02,0X59,0X0A,0X79,0X0A,0XB9,0X0A,0XFA,0X0B,0X39,0X03,0X17,0X9D,0X00,0X61,
+0X11,0X05,0X6D,0X06,0X4D,0X06,0X0C,0X05,0XEB,0X05,0XEA,0X05,0XC9,0X05,0XA8,0X05,
+0X87,0X05,0X86,0X05,0X85,0X05,0X64,0X0D,0X64,0X05,0X63,0X05,0X42,0X0D,0X02,0X05,
+0X61,0X05,0X60,0X00,0XA1,0X85,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XA2,0X80,0X08,
+0XA1,0X82,0X08,0XA2,0X02,0X54,0X80,0X8E,0X40,0X86,0X00,0X80,0X96,0X20,0X00,0XA6,
+0X20,0X80,0XAE,0X40,0X0E,0XBE,0X60,0XC6,0X60,0XCE,0X80,0XD6,0X80,0XDE,0X80,0XE6,
+0XA0,0XEF,0X00,0XC5,0X80,0X08,0X81,0X08,0XA1,0X08,0XC2,0X9C,0XA0,0XFF,0X20,0XFE,
+0XC1,0XFF,0X00,0X80,0XFE,0XE0,0X00,0XFF,0X00,0X87,0XFE,0XE0,0X05,0XFF,0X00,0XFE,
+0XC0,0XFF,0X00,0XF6,0XA0,0X09,0X22,0X09,0X42,0X81,0X09,0X22,0X01,0XC5,0X40,0XFF,
+0X40,0X8A,0XFE,0XE0,0X01,0XFF,0X00,0X39,0X80,0X89,0X00,0X00,0X02,0X20,0XE0,0XEE,
+0X60,0XFF,0X00,0X86,0XFE,0XE0,0X00,0XFF,0X00,0X81,0XFE,0XE0,0X0A,0XD5,0XC0,0X09,
+0X22,0X11,0X62,0X1A,0X23,0X22,0X83,0X22,0XA3,0X2B,0X44,0X33,0X64,0X2A,0XE3,0X22,
+0XA3,0X22,0XC3,0X82,0X22,0XA3,0X08,0X22,0XC3,0X22,0XE3,0X22,0XA3,0X1A,0X42,0X1A,
+0X22,0X1A,0X43,0X1A,0X03,0X11,0X82,0X08,0XE2,0X81,0X08,0XA2,0X00,0X00,0X81,0X81,
+0X08,0X81,0X12,0X00,0XA1,0X08,0XA2,0X09,0X02,0X11,0X82,0X19,0XE3,0X11,0XC3,0X09,
+0X22,0X11,0XC2,0X22,0X82,0X33,0X02,0X33,0X83,0X2B,0X03,0X1A,0X42,0X22,0X63,0X2B,
+0X23,0X33,0X83,0X3B,0XE4,0X3C,0X66,0X2A,0XE4,0X80,0X1A,0X64,0X80,0X1A,0X85,0X00,
+0X12,0X24,0X80,0X1A,0X44,0X0C,0X12,0X64,0X1A,0X64,0X1A,0X85,0X1A,0XC5,0X23,0X25,
+0X1A,0X84,0X1A,0X03,0X11,0XC2,0X11,0XE2,0X11,0XE3,0X11,0XA3,0X11,0XA2,0X11,0XC3,
+0X80,0X11,0XE3,0X0A,0X1A,0X03,0X11,0X62,0X08,0XA1,0X08,0X61,0X08,0XA1,0X11,0X02,
+0X19,0XC4,0X32,0X25,0X39,0X63,0X29,0X03,0X08,0X81,0X82,0X00,0X61,0X06,0X08,0XA2,
+0X09,0X22,0X09,0X62,0X09,0X22,0X09,0X02,0X09,0X42,0X09,0X62,0X80,0X09,0X63,0X06,
+0X09,0X42,0X09,0X22,0X09,0X42,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,
+0X82,0X81,0XEA,0XA2,0X01,0XEA,0X82,0XEA,0XA3,0X80,0XEA,0XA2,0X01,0XF2,0XC2,0X89,
+0X81,0X80,0X09,0X22,0X82,0X08,0XE2,0X8A,0X00,0X61,0X0F,0X00,0X41,0X38,0X66,0X79,
+0X2D,0X69,0X0D,0X61,0X0E,0X58,0XEF,0X50,0XCF,0X50,0XD0,0X48,0XB1,0X40,0XB1,0X38,
+0XB1,0X38,0XB2,0X30,0XB2,0X28,0XB3,0X28,0XB4,0X18,0X90,0X83,0X00,0X61,0X0F,0X08,
+0X62,0X00,0X48,0X09,0X38,0X09,0X37,0X09,0X57,0X01,0X98,0X09,0XB8,0X01,0XF8,0X0A,
+0X19,0X0A,0X78,0X0A,0X99,0X0A,0XB9,0X0A,0XF9,0X03,0X59,0X0B,0X79,0X03,0X57,0X9D,
+0X00,0X61,0X05,0X00,0XE2,0X06,0X0D,0X05,0XEB,0X05,0XEA,0X05,0XC9,0X05,0XA8,0X80,
+0X05,0X87,0X80,0X05,0X65,0X06,0X05,0X43,0X0D,0X43,0X05,0X62,0X05,0X42,0X0D,0X22,
+0X05,0X41,0X03,0XA0,0X85,0X00,0X61,0X00,0X00,0X81,0X84,0X08,0XA1,0X81,0X08,0XA2,
+0X15,0X54,0X40,0X8E,0X60,0X8E,0X20,0X96,0X20,0X9E,0X40,0XAE,0X40,0XB6,0X60,0XBE,
+0X80,0XC6,0X60,0XCE,0X80,0XD6,0XA0,0XDE,0XA0,0XE6,0XA0,0XE6,0XC0,0XEF,0X00,0XD6,
+0X00,0X00,0X61,0X08,0XA1,0X08,0XE2,0XA4,0XE0,0XFF,0X20,0XFE,0XE0,0X80,0XFF,0X00,
+0X03,0XFE,0XC0,0XFE,0XE0,0XFE,0XC0,0XFF,0X00,0X85,0XFE,0XE0,0X03,0XFF,0X00,0XFE,
+0XC0,0XFF,0X00,0XF6,0XA0,0X80,0X09,0X42,0X80,0X11,0X22,0X02,0X09,0X22,0XB4,0XC0,
+0XFF,0X40,0X8A,0XFE,0XE0,0X03,0XFF,0X20,0X5A,0X60,0X00,0X20,0X00,0X01,0X86,0X00,
+0X00,0X03,0X00,0X01,0X29,0X20,0XF6,0XC0,0XFF,0X00,0X86,0XFE,0XE0,0X00,0XFF,0X00,
+0X81,0XFE,0XE0,0X02,0XCD,0X80,0X09,0X22,0X11,0XE3,0X80,0X2A,0XE3,0X03,0X22,0XC3,
+0X2A,0XE3,0X22,0XC3,0X22,0XA3,0X81,0X22,0XC3,0X00,0X22,0XE4,0X80,0X22,0XE3,0X80,
+0X22,0XC3,0X05,0X22,0X82,0X1A,0X42,0X11,0XE2,0X11,0XE3,0X11,0X62,0X08,0XE2,0X82,
+0X08,0XA2,0X83,0X08,0X81,0X02,0X08,0XC2,0X09,0X42,0X11,0X82,0X80,0X1A,0X03,0X0F,
+0X11,0X42,0X11,0X62,0X22,0XA2,0X33,0X83,0X3B,0XC4,0X33,0X63,0X22,0X82,0X22,0X42,
+0X2A,0XE3,0X33,0X63,0X3B,0XE4,0X3C,0X66,0X33,0XE5,0X1A,0X64,0X1A,0X84,0X1A,0X44,
+0X80,0X12,0X03,0X0C,0X1A,0X44,0X12,0X24,0X12,0X44,0X1A,0X64,0X1A,0XA5,0X1A,0XA4,
+0X1A,0X23,0X11,0XC3,0X1A,0X23,0X11,0XE3,0X1A,0X03,0X1A,0XA4,0X22,0XC4,0X80,0X22,
+0XE5,0X81,0X23,0X26,0X0A,0X1A,0XC5,0X1A,0X65,0X1A,0X85,0X23,0X27,0X23,0XA9,0X2B,
+0X88,0X2A,0X25,0X41,0X84,0X49,0XC5,0X18,0XE2,0X08,0X82,0X80,0X00,0X61,0X80,0X08,
+0X61,0X04,0X08,0XA2,0X09,0X63,0X11,0X62,0X11,0X42,0X09,0X22,0X80,0X09,0X42,0X00,
+0X09,0X63,0X80,0X09,0X42,0X04,0X09,0X83,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,
+0X80,0XEA,0X82,0X81,0XEA,0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,
+0XC3,0X89,0X81,0X80,0X09,0X22,0X01,0X09,0X63,0X09,0X22,0X80,0X08,0XE2,0X00,0X08,
+0XA1,0X8A,0X00,0X61,0X03,0X30,0X66,0X71,0X0E,0X60,0XEE,0X58,0XEF,0X80,0X50,0XD0,
+0X01,0X48,0XB0,0X40,0XB1,0X80,0X38,0XB2,0X00,0X30,0XB2,0X80,0X28,0XB3,0X01,0X20,
+0XB5,0X18,0X91,0X84,0X00,0X61,0X03,0X00,0X48,0X09,0X58,0X09,0X77,0X01,0X97,0X80,
+0X09,0XD8,0X08,0X02,0X18,0X0A,0X59,0X02,0X98,0X0A,0XD9,0X0A,0XF9,0X0B,0X18,0X03,
+0X79,0X0B,0XB9,0X03,0X97,0X9E,0X00,0X61,0X0E,0X04,0X89,0X05,0XEB,0X05,0XC9,0X05,
+0XA8,0X05,0XA7,0X05,0X87,0X05,0X66,0X05,0X65,0X05,0X64,0X05,0X42,0X05,0X21,0X05,
+0X43,0X05,0X41,0X05,0X61,0X04,0XE1,0X86,0X00,0X61,0X02,0X00,0X81,0X08,0XA1,0X08,
+0XA2,0X81,0X08,0XA1,0X0B,0X08,0XA2,0X08,0XC2,0X08,0XA1,0X08,0XA2,0X53,0XE0,0X9E,
+0X80,0X96,0X20,0X9E,0X40,0XAE,0X60,0XB6,0X60,0XBE,0X60,0XC6,0X80,0X80,0XCE,0X80,
+0X10,0XD6,0XA0,0XDE,0XA0,0XE6,0XC0,0XEE,0XC0,0XF6,0XE0,0XE6,0X80,0X08,0X81,0X08,
+0XC2,0X09,0X02,0X9C,0X81,0XFF,0X80,0XFF,0X60,0XFF,0X00,0XFF,0X20,0XFF,0X40,0XFF,
+0X00,0XFE,0XC0,0X80,0XFE,0XE1,0X00,0XFF,0X00,0X83,0XFE,0XE0,0X04,0XFF,0X00,0XFE,
+0XC0,0XFF,0X00,0XF6,0XA0,0X09,0X62,0X82,0X11,0X42,0X01,0XA4,0X40,0XFF,0X40,0X8A,
+0XFE,0XE0,0X01,0XFF,0X20,0X73,0X20,0X89,0X00,0X00,0X00,0X31,0X60,0X80,0XFF,0X00,
+0X89,0XFE,0XE0,0X03,0XFF,0X00,0XB4,0XE0,0X09,0X42,0X1A,0X23,0X80,0X2B,0X03,0X03,
+0X2A,0XE3,0X22,0XE3,0X22,0XC3,0X22,0XE3,0X80,0X22,0XC3,0X0A,0X23,0X04,0X2B,0X65,
+0X2B,0X44,0X22,0XC3,0X22,0X82,0X22,0X62,0X22,0X82,0X22,0X43,0X19,0XE2,0X09,0X42,
+0X08,0XE2,0X81,0X08,0XA2,0X80,0X08,0XA1,0X82,0X08,0X81,0X18,0X08,0XA2,0X09,0X02,
+0X11,0X82,0X1A,0X23,0X22,0XC5,0X1A,0X84,0X11,0X82,0X11,0X62,0X22,0X83,0X33,0X84,
+0X3B,0XC4,0X33,0X62,0X2A,0XE2,0X22,0X82,0X22,0XA2,0X2B,0X23,0X3B,0XA3,0X44,0X24,
+0X3C,0X45,0X12,0X03,0X11,0XC3,0X11,0XA2,0X11,0XC3,0X1A,0X44,0X1A,0XC5,0X80,0X1A,
+0XA5,0X80,0X1A,0XC5,0X20,0X11,0XC3,0X11,0XC2,0X1A,0X43,0X22,0XE5,0X23,0X25,0X23,
+0X86,0X23,0XC7,0X23,0XE8,0X23,0X86,0X23,0X46,0X23,0XA7,0X23,0XC8,0X23,0XA8,0X23,
+0XE8,0X34,0X89,0X2C,0X89,0X2B,0XC7,0X1A,0XC5,0X11,0X43,0X10,0XA2,0X31,0X63,0X41,
+0XC4,0X31,0XC5,0X22,0XC7,0X11,0X44,0X08,0X61,0X00,0X41,0X08,0X61,0X00,0X81,0X08,
+0XE2,0X09,0X83,0X11,0X82,0X11,0X62,0X80,0X09,0X22,0X00,0X09,0X63,0X80,0X09,0X42,
+0X04,0X09,0XA3,0XA9,0XE1,0XF2,0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,
+0XA2,0X05,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XEA,0X82,0XF2,0XA2,0X89,0X81,0X80,0X08,
+0XE2,0X05,0X09,0X22,0X11,0X83,0X11,0XA3,0X09,0X42,0X09,0X02,0X08,0XA1,0X89,0X00,
+0X61,0X07,0X30,0X67,0X69,0X0E,0X58,0XEF,0X50,0XF0,0X50,0XD0,0X48,0XB0,0X40,0XB1,
+0X38,0XB2,0X80,0X30,0XB2,0X00,0X28,0XB3,0X80,0X20,0XB4,0X01,0X18,0XB5,0X18,0X91,
+0X84,0X00,0X61,0X0E,0X00,0X68,0X09,0X78,0X09,0X98,0X01,0XB8,0X01,0XF8,0X0A,0X19,
+0X0A,0X58,0X0A,0X99,0X02,0XD8,0X0A,0XFA,0X0B,0X19,0X0B,0X58,0X03,0XB9,0X0B,0XF9,
+0X03,0XB7,0X9E,0X00,0X61,0X04,0X03,0X05,0X05,0XEA,0X05,0XC8,0X05,0XA7,0X05,0X86,
+0X80,0X05,0X65,0X00,0X05,0X64,0X80,0X05,0X43,0X04,0X05,0X21,0X05,0X41,0X05,0X40,
+0X05,0X80,0X0C,0XA0,0X86,0X00,0X61,0X03,0X00,0X81,0X08,0XA1,0X08,0XC2,0X08,0XC1,
+0X81,0X08,0XA1,0X10,0X08,0XC2,0X08,0XC1,0X08,0XA2,0X4B,0X60,0XA6,0X80,0XA6,0X40,
+0XAE,0X40,0XB6,0X60,0XBE,0X60,0XC6,0X60,0XCE,0X80,0XD6,0X80,0XD6,0XA0,0XDE,0XA0,
+0XE6,0XA0,0XEE,0XC0,0XF6,0XC0,0X80,0XF6,0XE0,0X0A,0X08,0XC1,0X08,0XE2,0X09,0X02,
+0X11,0X02,0XB5,0X20,0XBD,0X40,0XBD,0X41,0XBD,0X40,0XB5,0X40,0XCD,0XA0,0XFF,0X00,
+0X80,0XFE,0XC0,0X00,0XFF,0X00,0X83,0XFE,0XE0,0X04,0XFF,0X00,0XFE,0XC0,0XFF,0X00,
+0XF6,0XA0,0X11,0X22,0X82,0X11,0X42,0X02,0X93,0XC0,0XFF,0X40,0XFF,0X00,0X89,0XFE,
+0XE0,0X01,0XFF,0X20,0X94,0X20,0X80,0X00,0X00,0X00,0X00,0X20,0X81,0X00,0X00,0X00,
+0X00,0X20,0X82,0X00,0X00,0X02,0X52,0X60,0XFF,0X20,0XFF,0X00,0X84,0XFE,0XE0,0X00,
+0XFF,0X00,0X82,0XFE,0XE0,0X04,0XFF,0X00,0X9C,0X00,0X11,0X82,0X22,0XA3,0X2B,0X23,
+0X82,0X2B,0X24,0X0C,0X22,0XE3,0X22,0XA3,0X22,0XC3,0X23,0X24,0X2B,0X65,0X2B,0X44,
+0X22,0XA2,0X22,0X42,0X1A,0X42,0X1A,0X43,0X1A,0X02,0X11,0X42,0X08,0XE2,0X80,0X08,
+0XA2,0X83,0X08,0XA1,0X81,0X08,0X81,0X12,0X08,0XA2,0X09,0X62,0X1A,0X03,0X1A,0XA4,
+0X23,0X05,0X1A,0X83,0X11,0XA2,0X11,0X62,0X1A,0X42,0X33,0X43,0X33,0X83,0X33,0X62,
+0X33,0X22,0X2A,0XC2,0X22,0X62,0X2A,0XA2,0X33,0X42,0X3B,0XE3,0X44,0X44,0X80,0X11,
+0XA2,0X80,0X11,0XE3,0X09,0X12,0X44,0X1A,0XE6,0X23,0X27,0X23,0X26,0X23,0X25,0X1A,
+0X64,0X1A,0XA4,0X22,0XE4,0X2B,0X65,0X23,0X86,0X80,0X2B,0XE7,0X0B,0X23,0XA7,0X23,
+0XC8,0X23,0XC7,0X23,0XA8,0X23,0XC8,0X23,0XE8,0X2C,0X8A,0X2C,0XCB,0X2C,0X07,0X23,
+0X25,0X22,0XC4,0X11,0X62,0X80,0X08,0X61,0X07,0X21,0X02,0X31,0X23,0X4A,0X46,0X3C,
+0X4B,0X24,0X4B,0X1B,0X08,0X09,0X84,0X08,0XC1,0X80,0X08,0X81,0X03,0X09,0X23,0X11,
+0X83,0X11,0XA2,0X11,0X42,0X81,0X09,0X22,0X05,0X09,0X42,0X09,0X83,0XA9,0XE1,0XF2,
+0XA3,0XEA,0X82,0XEA,0XA2,0X80,0XEA,0X82,0X81,0XEA,0XA2,0X0E,0XEA,0X82,0XEA,0XA3,
+0XEA,0XA2,0XE2,0X82,0XF2,0XA2,0X89,0X81,0X09,0X83,0X11,0XE4,0X09,0X63,0X09,0X21,
+0X09,0XA3,0X12,0X45,0X11,0XC3,0X09,0X22,0X08,0XA1,0X80,0X00,0X61,0X00,0X08,0X61,
+0X85,0X00,0X61,0X08,0X30,0X67,0X68,0XEE,0X50,0XCF,0X50,0XD0,0X48,0XB0,0X40,0XB1,
+0X38,0XB2,0X30,0XB2,0X30,0XB3,0X80,0X28,0XB3,0X03,0X20,0XB4,0X18,0XB4,0X18,0XD6,
+0X10,0X91,0X84,0X00,0X61,0X0E,0X00,0X68,0X09,0X98,0X09,0XD8,0X01,0XD8,0X0A,0X19,
+0X0A,0X39,0X0A,0X79,0X0A,0XB9,0X0A,0XF9,0X0B,0X3A,0X0B,0X59,0X0B,0X98,0X03,0XF9,
+0X0C,0X19,0X0B,0XD7,0X9E,0X00,0X61,0X0E,0X02,0XA4,0X0D,0XE9,0X05,0XA7,0X05,0X86,
+0X05,0X85,0X05,0X65,0X05,0X64,0X05,0X63,0X05,0X62,0X05,0X43,0X05,0X42,0X05,0X40,
+0X0D,0X40,0X05,0X20,0X0C,0XA0,0X86,0X00,0X61,0X01,0X08,0X81,0X08,0XC2,0X80,0X08,
+0XE2,0X01,0X08,0XC2,0X08,0XA2,0X80,0X08,0XA1,0X09,0X08,0XC1,0X08,0XA1,0X3A,0XA0,
+0XA6,0X40,0XAE,0X40,0XB6,0X60,0XBE,0X60,0XC6,0X60,0XCE,0X61,0XD6,0X80,0X80,0XDE,
+0XA0,0X09,0XE6,0XC0,0XEE,0XC0,0XF6,0XE0,0XF6,0XC0,0XFE,0XE0,0XFF,0X21,0X31,0XC1,
+0X09,0X02,0X09,0X22,0X11,0X02,0X83,0X09,0X02,0X01,0X21,0X61,0XF6,0XE2,0X80,0XFF,
+0X00,0X80,0XFE,0XE0,0X00,0XFE,0XC0,0X81,0XFE,0XE0,0X05,0XFF,0X00,0XFE,0XC0,0XFF,
+0X00,0XF6,0XA0,0X09,0X02,0X09,0X22,0X81,0X11,0X62,0X02,0X7B,0X20,0XFF,0X20,0XFF,
+0X00,0X89,0XFE,0XE0,0X02,0XFF,0X20,0XB5,0X01,0X00,0X20,0X83,0X00,0X00,0X00,0X00,
+0X20,0X81,0X00,0X00,0X02,0X08,0X00,0X84,0X01,0XFF,0X40,0X85,0XFE,0XE0,0X02,0XFF,
+0X00,0XFE,0XC0,0XFF,0X00,0X80,0XFE,0XE0,0X06,0XFF,0X01,0X8B,0X80,0X1A,0X43,0X33,
+0X64,0X33,0XA4,0X2B,0X44,0X2B,0X03,0X80,0X2B,0X24,0X06,0X2A,0XE3,0X2B,0X04,0X2B,
+0X24,0X2B,0X44,0X2B,0X24,0X2A,0XC3,0X22,0X62,0X80,0X1A,0X22,0X02,0X1A,0X02,0X09,
+0X42,0X08,0XC2,0X80,0X08,0XA2,0X80,0X08,0XA1,0X81,0X08,0X81,0X80,0X08,0XA1,0X80,
+0X08,0X81,0X21,0X09,0X02,0X11,0XC3,0X22,0XA4,0X22,0XE3,0X22,0XC3,0X22,0X83,0X1A,
+0X43,0X11,0XA2,0X19,0XC2,0X2A,0XE2,0X3B,0X83,0X3B,0X82,0X33,0X42,0X2A,0XE2,0X22,
+0X82,0X2A,0X82,0X33,0X22,0X3B,0XC3,0X44,0X65,0X11,0XE3,0X22,0XC4,0X2B,0XC7,0X1A,
+0XA5,0X12,0X04,0X12,0X85,0X1B,0X26,0X2B,0XC7,0X23,0X45,0X2B,0X65,0X23,0XC7,0X23,
+0XA7,0X2C,0X48,0X2C,0X08,0X23,0XA7,0X80,0X23,0XC8,0X01,0X23,0XE8,0X24,0X09,0X80,
+0X24,0X29,0X17,0X2C,0X89,0X34,0X69,0X2B,0XA6,0X23,0X25,0X23,0X04,0X22,0X83,0X09,
+0X22,0X00,0X61,0X08,0X81,0X19,0X02,0X18,0XA2,0X29,0XE4,0X43,0X88,0X3B,0X67,0X34,
+0X4A,0X2C,0X8A,0X23,0X87,0X1A,0XA5,0X1A,0X65,0X1A,0X64,0X12,0X64,0X1A,0X85,0X11,
+0XA3,0X11,0X83,0X81,0X09,0X22,0X04,0X09,0X63,0XA9,0XE1,0XF2,0XA2,0XEA,0X82,0XEA,
+0XA2,0X81,0XEA,0X82,0X01,0XEA,0XA3,0XE2,0XA2,0X80,0XEA,0X82,0X0D,0XDA,0XA2,0XEA,
+0XA3,0XE2,0XA5,0X81,0X41,0X09,0X42,0X09,0X63,0X09,0X62,0X09,0X22,0X08,0XE2,0X12,
+0X45,0X12,0X65,0X09,0X83,0X08,0XC2,0X08,0X61,0X87,0X00,0X61,0X05,0X28,0X47,0X58,
+0XF0,0X50,0XB0,0X40,0XD1,0X38,0XD1,0X30,0XD2,0X80,0X30,0XB2,0X00,0X28,0XB3,0X80,
+0X20,0XB4,0X80,0X18,0XB5,0X01,0X18,0XB6,0X08,0X92,0X84,0X00,0X61,0X0E,0X08,0X69,
+0X01,0XD9,0X09,0XF8,0X0A,0X19,0X0A,0X59,0X0A,0X99,0X0A,0XB8,0X02,0XF9,0X0B,0X39,
+0X03,0X78,0X0B,0X78,0X03,0XF8,0X0C,0X18,0X04,0X5B,0X04,0X36,0X9E,0X00,0X61,0X06,
+0X02,0XC3,0X05,0XE7,0X05,0XA6,0X05,0X65,0X05,0X64,0X05,0X43,0X05,0X63,0X80,0X05,
+0X42,0X80,0X05,0X40,0X03,0X05,0X20,0X0D,0X20,0X0D,0X60,0X14,0XC0,0X85,0X00,0X61,
+0X02,0X08,0X61,0X08,0XA1,0X08,0XC2,0X81,0X08,0XE2,0X80,0X08,0XC2,0X81,0X08,0XA1,
+0X0B,0X08,0XA2,0XA6,0X20,0XB6,0X60,0XB6,0X40,0XC6,0X80,0XCE,0X60,0XD6,0X80,0XDE,
+0XA0,0XE6,0XA0,0XE6,0XC0,0XEE,0XC0,0XF6,0XC0,0X80,0XFE,0XE0,0X80,0XFF,0X00,0X00,
+0XCD,0XC0,0X84,0X09,0X22,0X80,0X09,0X02,0X02,0X19,0X61,0XFF,0X00,0XFE,0XC0,0X80,
+0XFE,0XE0,0X00,0XFF,0X00,0X82,0XFE,0XE0,0X06,0XFF,0X00,0XFE,0XC0,0XFF,0X00,0XF6,
+0XA0,0X08,0XA1,0X09,0X22,0X11,0X82,0X80,0X11,0XE3,0X03,0X19,0XC2,0XFF,0X20,0XFE,
+0XE0,0XFF,0X00,0X86,0XFE,0XE0,0X04,0XFF,0X00,0XFE,0XE0,0XFF,0X00,0XEE,0XC0,0X31,
+0X20,0X84,0X00,0X00,0X80,0X00,0X20,0X02,0X00,0X02,0X18,0X20,0XD5,0XE0,0X87,0XFE,
+0XE0,0X0A,0XFF,0X20,0XFE,0XC0,0XF7,0X00,0XF6,0XE1,0XF6,0XE0,0X62,0X80,0X22,0XC3,
+0X33,0XA4,0X33,0X64,0X2B,0X03,0X2B,0X04,0X81,0X2B,0X44,0X0A,0X2B,0X64,0X2B,0X44,
+0X2B,0X64,0X2B,0X44,0X2A,0XE2,0X22,0XA2,0X1A,0X62,0X1A,0X02,0X11,0X62,0X08,0XC2,
+0X00,0XA2,0X80,0X08,0XA2,0X80,0X08,0XA1,0X81,0X08,0X81,0X80,0X08,0XA1,0X04,0X08,
+0X81,0X08,0XA1,0X09,0X02,0X1A,0X03,0X22,0XC3,0X80,0X2B,0X03,0X08,0X2A,0XE3,0X22,
+0XE3,0X19,0XE2,0X19,0XC2,0X2A,0XC2,0X33,0XA4,0X33,0XC4,0X33,0XA3,0X33,0X22,0X80,
+0X2A,0XE2,0X0F,0X33,0X62,0X3B,0XE3,0X3C,0X86,0X11,0XE3,0X22,0XA3,0X1A,0X84,0X12,
+0X23,0X1A,0XA5,0X23,0X05,0X2B,0XA6,0X2B,0XE7,0X2C,0X08,0X2B,0XA5,0X2B,0XE8,0X24,
+0X09,0X23,0XE9,0X80,0X23,0XE8,0X80,0X24,0X09,0X22,0X24,0X29,0X2C,0X4A,0X2C,0X8A,
+0X2C,0XAA,0X2C,0X48,0X2B,0XA6,0X23,0X45,0X22,0XE4,0X23,0X25,0X1A,0X03,0X08,0X81,
+0X08,0X61,0X10,0XC2,0X2A,0XA5,0X18,0XE2,0X11,0X02,0X2B,0X88,0X44,0X6A,0X33,0XE8,
+0X2C,0X49,0X2C,0XAA,0X23,0XE7,0X23,0X46,0X22,0XE5,0X1A,0XA4,0X1A,0X43,0X12,0X03,
+0X1A,0X23,0X11,0XA2,0X09,0X42,0X09,0X22,0X09,0X62,0XA9,0XE1,0XF2,0XA2,0XEA,0X82,
+0X80,0XEA,0XA2,0X81,0XEA,0X82,0X06,0XE2,0XA2,0XEA,0X82,0XEA,0X83,0XDA,0XA2,0XE2,
+0X62,0XDA,0X64,0X91,0X81,0X80,0X09,0X02,0X81,0X08,0XE2,0X04,0X09,0X22,0X09,0X62,
+0X11,0XA2,0X11,0X42,0X08,0X81,0X87,0X00,0X61,0X04,0X28,0X48,0X50,0XD1,0X48,0XB0,
+0X40,0XB1,0X38,0XD2,0X80,0X30,0XB2,0X03,0X30,0XB3,0X28,0XB3,0X20,0XB4,0X18,0XB4,
+0X80,0X18,0XB5,0X01,0X18,0XB6,0X08,0XB2,0X84,0X00,0X61,0X0E,0X00,0X89,0X01,0XF9,
+0X0A,0X19,0X0A,0X59,0X0A,0X99,0X0A,0XD9,0X0A,0XF9,0X03,0X39,0X03,0X59,0X03,0XD9,
+0X0B,0XD9,0X04,0X19,0X0C,0X38,0X0C,0X7A,0X04,0X36,0X9D,0X00,0X61,0X06,0X00,0X82,
+0X02,0XC2,0X05,0XE6,0X05,0X85,0X05,0X65,0X05,0X44,0X05,0X43,0X80,0X05,0X42,0X00,
+0X05,0X41,0X81,0X05,0X40,0X02,0X0D,0X40,0X0D,0X60,0X14,0XC0,0X81,0X00,0X61,0X00,
+0X08,0X81,0X81,0X00,0X61,0X01,0X08,0X81,0X08,0XA1,0X81,0X08,0XE2,0X02,0X08,0XC2,
+0X08,0XE2,0X08,0XC2,0X82,0X08,0XC1,0X07,0XA5,0XC0,0XBE,0XA0,0XC6,0X82,0XC6,0X80,
+0XD6,0XC0,0XD6,0XA0,0XDE,0XA1,0XE6,0XC0,0X80,0XEE,0XC0,0X00,0XF6,0XE0,0X81,0XFE,
+0XE0,0X02,0XFF,0X00,0XFF,0X20,0X8B,0XA0,0X80,0X09,0X42,0X82,0X09,0X22,0X03,0X09,
+0X42,0X19,0X81,0XFF,0X20,0XFE,0XE0,0X80,0XFE,0XC0,0X00,0XFF,0X00,0X82,0XFE,0XE0,
+0X07,0XFF,0X00,0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X00,0X81,0X08,0XE2,0X09,0X82,0X1A,
+0X23,0X80,0X1A,0X64,0X01,0XEE,0XA0,0XFF,0X20,0X88,0XFE,0XE0,0X07,0XFE,0XC1,0XFE,
+0XE0,0XFF,0X41,0X8C,0X00,0X08,0X00,0X00,0X01,0X00,0X00,0X00,0X20,0X82,0X00,0X00,
+0X02,0X08,0X00,0X73,0X00,0XFF,0X40,0X86,0XFE,0XE0,0X02,0XFF,0X00,0XFE,0XE0,0XFE,
+0XC0,0X80,0XFF,0X00,0X06,0XF6,0XA0,0X19,0XC2,0X2A,0XE3,0X2B,0X23,0X2A,0XE3,0X22,
+0XE3,0X2B,0X24,0X80,0X2B,0X64,0X01,0X2B,0XA5,0X2B,0X84,0X80,0X2B,0X43,0X05,0X2B,
+0X23,0X2A,0XE2,0X22,0X63,0X11,0XE2,0X11,0X42,0X08,0XE2,0X80,0X08,0XA2,0X83,0X08,
+0XA1,0X80,0X08,0X81,0X80,0X08,0XA1,0X05,0X08,0X81,0X08,0XC1,0X11,0X82,0X1A,0X22,
+0X22,0XA3,0X2B,0X03,0X81,0X2B,0X23,0X19,0X22,0X83,0X11,0XE2,0X22,0X63,0X33,0X63,
+0X3B,0XE5,0X3C,0X25,0X3B,0XA3,0X33,0X42,0X33,0X22,0X33,0X62,0X3B,0XC3,0X3C,0X46,
+0X11,0XE3,0X1A,0X03,0X1A,0X84,0X1B,0X06,0X23,0X86,0X2B,0XE7,0X2B,0XC7,0X2B,0XE7,
+0X2C,0X28,0X2B,0XC7,0X24,0X08,0X23,0XE9,0X1B,0XE9,0X1C,0X2A,0X80,0X23,0XE8,0X13,
+0X24,0X09,0X24,0X6A,0X2C,0XAA,0X2C,0X69,0X2B,0XE7,0X2B,0XA6,0X2B,0X44,0X22,0XC3,
+0X22,0X63,0X22,0X83,0X08,0XE2,0X08,0X61,0X08,0XA2,0X22,0X44,0X34,0X47,0X22,0X44,
+0X10,0XE1,0X1A,0X85,0X3C,0XEB,0X45,0X0C,0X80,0X2C,0X69,0X03,0X2C,0X48,0X2C,0X07,
+0X2B,0X65,0X22,0XE4,0X80,0X1A,0X43,0X02,0X22,0XC4,0X1A,0X84,0X11,0XE3,0X80,0X09,
+0X62,0X02,0XA9,0XE0,0XF2,0XA2,0XEA,0X82,0X80,0XEA,0XA2,0X00,0XEA,0X82,0X80,0XEA,
+0XA2,0X16,0XE2,0XA2,0XEA,0X83,0XE2,0X83,0XDA,0XA3,0XDA,0X42,0XDA,0X64,0XAA,0X03,
+0X81,0X62,0X79,0X63,0X79,0X43,0X71,0X43,0X71,0X44,0X69,0X24,0X69,0X25,0X69,0X05,
+0X60,0XE5,0X60,0XC6,0X58,0XC6,0X50,0XE6,0X50,0XC7,0X48,0XA8,0X40,0XA7,0X20,0X23,
+0X81,0X00,0X61,0X03,0X20,0X48,0X48,0XD1,0X40,0XB0,0X38,0XB1,0X80,0X30,0XB2,0X04,
+0X30,0XB3,0X28,0XB3,0X20,0XB4,0X18,0XB4,0X18,0XB5,0X80,0X10,0XB5,0X01,0X18,0XD6,
+0X08,0XB2,0X84,0X00,0X61,0X1E,0X00,0XA9,0X02,0X3A,0X0A,0X59,0X02,0X99,0X0A,0XB9,
+0X02,0XF9,0X0B,0X39,0X03,0X79,0X0B,0X99,0X03,0XF8,0X0B,0XF9,0X04,0X59,0X04,0X98,
+0X04,0XB9,0X04,0XF8,0X0B,0X4F,0X03,0X70,0X03,0X90,0X03,0XB0,0X03,0XD0,0X03,0XF0,
+0X0B,0XF0,0X0C,0X10,0X0C,0X11,0X0C,0X10,0X0C,0X0F,0X04,0X2F,0X04,0X2E,0X04,0X4F,
+0X0C,0X0E,0X02,0XE9,0X8C,0X00,0X61,0X06,0X00,0X82,0X00,0XA2,0X02,0XC2,0X05,0XC6,
+0X05,0X65,0X05,0X64,0X05,0X43,0X80,0X05,0X42,0X80,0X05,0X41,0X01,0X05,0X20,0X05,
+0X40,0X80,0X0D,0X40,0X01,0X15,0X60,0X14,0XC0,0X82,0X00,0X61,0X81,0X08,0X81,0X01,
+0X00,0X61,0X08,0XA2,0X80,0X08,0XE2,0X02,0X08,0XC2,0X08,0XC1,0X08,0XC2,0X80,0X08,
+0XC1,0X00,0X08,0XE1,0X80,0X08,0XE2,0X06,0X84,0XA0,0XC6,0XA0,0XCE,0X61,0XD6,0X80,
+0XD6,0XA0,0XDE,0XA0,0XE6,0XC0,0X80,0XEE,0XC0,0X00,0XF6,0XE0,0X83,0XFE,0XE0,0X0D,
+0XFE,0XE1,0XFF,0X20,0XA4,0XA0,0X21,0X61,0X09,0X22,0X11,0X22,0X09,0X22,0X09,0X42,
+0X09,0X62,0X21,0XA1,0XF6,0XE0,0XFF,0X20,0XFE,0XE0,0XFE,0XE1,0X83,0XFE,0XE0,0X0C,
+0XFF,0X00,0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X08,0X61,0X08,0X81,0X09,0X22,0X12,0X04,
+0X1A,0XC6,0X1B,0X07,0XC5,0X60,0XFF,0X20,0XFE,0XC1,0X87,0XFE,0XE0,0X07,0XFE,0XE2,
+0XFE,0XC0,0XFE,0XE0,0XFF,0X21,0X8B,0XC0,0X20,0XA0,0X08,0X01,0X00,0X03,0X81,0X00,
+0X00,0X02,0X18,0X80,0X73,0X40,0XEF,0X00,0X87,0XFE,0XE0,0X01,0XFF,0X00,0XFE,0XC0,
+0X80,0XFE,0XE0,0X12,0XFF,0X00,0XD5,0XE0,0X22,0X83,0X2B,0X24,0X2B,0X03,0X22,0XE3,
+0X2B,0X03,0X2B,0X64,0X33,0X64,0X2B,0X65,0X2B,0XC6,0X2B,0X85,0X2B,0X44,0X2B,0X23,
+0X2B,0X03,0X1A,0X63,0X11,0X82,0X09,0X02,0X08,0XC2,0X81,0X08,0XA2,0X80,0X08,0X81,
+0X02,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X81,0X08,0XA2,0X80,0X08,0X81,0X1D,0X09,0X02,
+0X1A,0X02,0X22,0XA3,0X2A,0XE3,0X2B,0X23,0X2B,0X43,0X2B,0X44,0X33,0X84,0X2B,0X24,
+0X1A,0X02,0X19,0XE2,0X22,0X82,0X33,0X84,0X3C,0X45,0X3C,0X25,0X3B,0XE3,0X3B,0X62,
+0X33,0X42,0X3B,0XA3,0X3C,0X66,0X1A,0X44,0X1B,0X06,0X23,0XA7,0X23,0XE8,0X2C,0X28,
+0X24,0X29,0X24,0X2A,0X24,0X08,0X2B,0XE7,0X23,0XE8,0X80,0X24,0X29,0X06,0X1C,0X2A,
+0X1C,0X6C,0X24,0X0A,0X23,0XC8,0X24,0X29,0X2C,0X69,0X2C,0X08,0X80,0X2B,0XC6,0X04,
+0X2B,0X85,0X22,0XE3,0X22,0X82,0X22,0X83,0X1A,0X23,0X80,0X08,0X81,0X17,0X19,0XE3,
+0X33,0XE6,0X3C,0XA8,0X33,0XC5,0X22,0X43,0X22,0X84,0X34,0X89,0X45,0X2C,0X3D,0X0B,
+0X2C,0X48,0X34,0X27,0X34,0XA8,0X34,0X47,0X33,0XE6,0X2B,0X65,0X22,0XE5,0X23,0X46,
+0X23,0X25,0X22,0XA4,0X1A,0X23,0X12,0X03,0XA9,0XE0,0XF2,0XA2,0XEA,0X82,0X80,0XEA,
+0XA2,0X19,0XEA,0X82,0XEA,0XA3,0XEA,0XA2,0XE2,0XA2,0XE2,0X82,0XDA,0X63,0XDA,0X84,
+0XDA,0X43,0XDA,0X44,0XC2,0X65,0XD2,0X46,0XCA,0X26,0XC2,0X27,0XC2,0X08,0XB9,0XE8,
+0XB1,0XE8,0XA9,0XC9,0XA9,0XA9,0X99,0XAB,0X99,0X6B,0X89,0X4B,0X81,0X6C,0X81,0X4D,
+0X79,0X2E,0X71,0X2E,0X40,0X69,0X81,0X00,0X61,0X02,0X20,0X48,0X48,0XD1,0X38,0XB1,
+0X80,0X30,0XB2,0X80,0X28,0XB3,0X80,0X20,0XB4,0X00,0X18,0XB5,0X80,0X10,0XB5,0X02,
+0X10,0XD5,0X10,0XD6,0X00,0XD3,0X84,0X00,0X61,0X0F,0X00,0XA9,0X02,0X7A,0X0A,0X79,
+0X02,0XD9,0X0A,0XF9,0X03,0X39,0X0B,0X59,0X03,0XB9,0X0B,0XD9,0X03,0XF8,0X0C,0X19,
+0X0C,0X9A,0X04,0XD9,0X04,0XD8,0X05,0X39,0X15,0X58,0X80,0X0D,0XDA,0X03,0X0E,0X1A,
+0X0E,0X3A,0X0E,0X5A,0X0E,0X7A,0X80,0X0E,0X9A,0X00,0X06,0XB9,0X80,0X0E,0X99,0X03,
+0X06,0X98,0X06,0XD8,0X06,0XD7,0X0E,0X34,0X8B,0X00,0X61,0X80,0X08,0X82,0X04,0X00,
+0XA2,0X02,0XC2,0X05,0XA5,0X05,0X64,0X05,0X43,0X80,0X05,0X42,0X80,0X05,0X41,0X80,
+0X05,0X40,0X80,0X0D,0X40,0X02,0X15,0X40,0X1D,0X80,0X1C,0XE0,0X82,0X00,0X61,0X80,
+0X08,0X81,0X02,0X00,0X61,0X00,0X81,0X08,0XC2,0X80,0X08,0XE2,0X01,0X08,0XC2,0X08,
+0XC1,0X80,0X08,0XC2,0X82,0X08,0XE2,0X08,0X52,0XC0,0XD6,0XA0,0XDE,0X80,0XDE,0XA1,
+0XDE,0XC0,0XE6,0XA0,0XEE,0XC0,0XF6,0XC0,0XF6,0XE0,0X86,0XFE,0XE0,0X08,0XFF,0X40,
+0XFF,0X00,0XDE,0X20,0XC5,0X60,0XBC,0XE1,0XB4,0X80,0XA4,0XC0,0XBD,0X40,0XFF,0X20,
+0X80,0XFE,0XE0,0X02,0XFF,0X00,0XFE,0XE0,0XFE,0XC1,0X81,0XFE,0XE0,0X0C,0XFF,0X00,
+0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X00,0X61,0X00,0X81,0X08,0XA2,0X09,0X02,0X11,0XE4,
+0X12,0X85,0X7B,0X80,0XFF,0X20,0XFE,0XE1,0X86,0XFE,0XE0,0X00,0XFF,0X20,0X81,0XFE,
+0XE0,0X0A,0XFF,0X20,0XFF,0X40,0XDE,0X60,0XBD,0X40,0XA4,0X60,0XA4,0X41,0XA4,0X80,
+0XBD,0X00,0XE6,0X40,0XFF,0X00,0XFF,0X20,0X87,0XFE,0XE0,0X07,0XFF,0X00,0XFE,0XE0,
+0XFF,0X00,0XFE,0XC0,0XFF,0X20,0X9C,0X40,0X22,0XE3,0X2B,0X23,0X80,0X2A,0XE3,0X0B,
+0X2B,0X23,0X33,0X64,0X2B,0X64,0X2B,0XA5,0X2B,0XE7,0X2B,0XC7,0X2B,0X65,0X22,0XE4,
+0X1A,0X63,0X11,0X82,0X08,0XE2,0X08,0XA1,0X81,0X08,0XA2,0X00,0X00,0X81,0X80,0X08,
+0X81,0X80,0X08,0XA1,0X81,0X08,0XA2,0X05,0X08,0XA1,0X08,0X81,0X08,0XA2,0X11,0X82,
+0X22,0XA3,0X2B,0X03,0X80,0X2B,0X23,0X08,0X2B,0X43,0X33,0X64,0X33,0XA5,0X2B,0X65,
+0X22,0X63,0X11,0XC2,0X19,0XE2,0X22,0XA2,0X3B,0XA3,0X80,0X44,0X24,0X20,0X3B,0XA2,
+0X33,0X62,0X3B,0X82,0X3C,0X25,0X1B,0X88,0X24,0X4B,0X24,0X6A,0X24,0X6B,0X24,0X6A,
+0X24,0X6B,0X1C,0XAD,0X24,0X2A,0X24,0X29,0X24,0X28,0X24,0X09,0X24,0X2A,0X24,0X09,
+0X24,0X29,0X24,0X2A,0X24,0X4A,0X2C,0X49,0X2B,0XC6,0X2B,0X45,0X2B,0XA6,0X2B,0XE7,
+0X2B,0XA6,0X2B,0X04,0X22,0XC3,0X22,0X63,0X09,0X22,0X08,0X61,0X11,0X83,0X2B,0XC7,
+0X80,0X3C,0XA8,0X0E,0X3C,0X25,0X33,0XA5,0X33,0X85,0X34,0X47,0X34,0XC9,0X3D,0X2C,
+0X3C,0XEB,0X34,0X67,0X3C,0XC8,0X34,0X88,0X34,0X67,0X34,0XA9,0X2C,0X69,0X2B,0XC7,
+0X23,0X25,0X81,0X22,0XC4,0X02,0XA9,0XE0,0XF2,0XA2,0XEA,0X83,0X81,0XEA,0XA2,0X00,
+0XE2,0XA3,0X80,0XE2,0X82,0X15,0XE2,0X83,0XDA,0X64,0XD2,0X65,0XD2,0X44,0XD2,0X24,
+0XC2,0X45,0XC2,0X25,0XBA,0X06,0XB9,0XE7,0XB1,0XC8,0XA9,0XA8,0XA1,0XA9,0X99,0X8A,
+0X99,0X6A,0X81,0X8A,0X81,0X6B,0X79,0X4C,0X71,0X4C,0X69,0X0D,0X68,0XEF,0X61,0X4F,
+0X40,0XAB,0X81,0X00,0X61,0X04,0X18,0X28,0X40,0XD2,0X30,0XB2,0X30,0XD3,0X28,0XB3,
+0X80,0X20,0XB4,0X03,0X18,0XB4,0X18,0XB5,0X10,0XB5,0X10,0XD5,0X80,0X08,0XD6,0X01,
+0X09,0X16,0X00,0XF3,0X84,0X00,0X61,0X0F,0X00,0XC9,0X0A,0X9A,0X0A,0XB9,0X02,0XF8,
+0X0B,0X39,0X0B,0X79,0X0B,0X99,0X0B,0XD9,0X0C,0X19,0X04,0X78,0X0C,0X79,0X04,0XB9,
+0X0D,0X19,0X0D,0X18,0X0D,0X39,0X05,0X9A,0X80,0X0D,0XB9,0X07,0X0D,0XF9,0X0E,0X19,
+0X0E,0X39,0X06,0X39,0X06,0X59,0X06,0X58,0X06,0X78,0X0E,0X38,0X80,0X0E,0X57,0X02,
+0X06,0X36,0X06,0X55,0X06,0X93,0X8B,0X00,0X61,0X00,0X08,0X82,0X80,0X08,0XA2,0X02,
+0X02,0XA1,0X05,0X84,0X05,0X43,0X80,0X05,0X42,0X01,0X05,0X21,0X05,0X41,0X80,0X05,
+0X20,0X80,0X0D,0X40,0X04,0X15,0X40,0X1D,0X40,0X25,0X80,0X24,0XE0,0X00,0X61,0X83,
+0X08,0X81,0X04,0X08,0X61,0X00,0X81,0X08,0XC1,0X09,0X02,0X08,0XE2,0X80,0X08,0XC2,
+0X80,0X08,0XE2,0X81,0X09,0X02,0X05,0X08,0XE2,0X09,0X02,0XC6,0X40,0XDE,0XA0,0XDE,
+0X80,0XEE,0XC1,0X80,0XEE,0XC0,0X00,0XF6,0XE0,0X85,0XFE,0XE0,0X02,0XFF,0X00,0XFE,
+0XE0,0XFE,0XC0,0X80,0XFF,0X00,0X03,0XFF,0X40,0XFF,0X60,0XFF,0X20,0XFF,0X40,0X80,
+0XFF,0X00,0X00,0XFE,0XC0,0X80,0XFF,0X00,0X01,0XFE,0XE0,0XFE,0XC1,0X81,0XFE,0XE0,
+0X0C,0XFF,0X00,0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X00,0X81,0X08,0X81,0X00,0X61,0X08,
+0X81,0X08,0XE2,0X09,0X83,0X11,0XE3,0XF6,0XA0,0XFF,0X00,0X86,0XFE,0XE0,0X03,0XFE,
+0XC0,0XFE,0XE0,0XFF,0X20,0XFE,0XE0,0X80,0XFE,0XC0,0X01,0XFF,0X20,0XFF,0X01,0X81,
+0XFF,0X40,0X03,0XFF,0X41,0XFF,0X20,0XFF,0X00,0XFE,0XC0,0X87,0XFE,0XE0,0X00,0XFF,
+0X00,0X80,0XFE,0XE0,0X80,0XFF,0X00,0X00,0X22,0X42,0X80,0X22,0XC3,0X0D,0X2A,0XE3,
+0X2B,0X03,0X2B,0X23,0X33,0X64,0X33,0XA5,0X2B,0X85,0X23,0X66,0X23,0X26,0X1A,0X84,
+0X11,0XC3,0X09,0X42,0X08,0XE2,0X08,0XA1,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,0XA1,
+0X80,0X08,0X81,0X83,0X08,0XA1,0X00,0X08,0XA2,0X80,0X08,0X81,0X02,0X08,0XE2,0X1A,
+0X23,0X2B,0X03,0X80,0X2B,0X23,0X0C,0X33,0X23,0X2B,0X23,0X2B,0X43,0X2B,0X64,0X2B,
+0X85,0X22,0XA3,0X1A,0X22,0X11,0XC2,0X1A,0X02,0X2A,0XC2,0X3B,0XA3,0X44,0X23,0X43,
+0XE2,0X80,0X3B,0X82,0X34,0X3B,0XE3,0X24,0XAC,0X25,0X0E,0X24,0X8C,0X24,0X6B,0X24,
+0XAC,0X1C,0X6B,0X24,0XEE,0X24,0X6B,0X24,0X29,0X24,0X28,0X24,0X49,0X24,0X09,0X23,
+0XE7,0X23,0XE8,0X24,0X6A,0X2C,0X8A,0X23,0XC7,0X2B,0X65,0X2B,0X45,0X2B,0X64,0X2B,
+0X85,0X2B,0X65,0X2A,0XE3,0X22,0XC4,0X11,0X62,0X00,0X61,0X11,0X02,0X2B,0X86,0X34,
+0XA9,0X3C,0XA8,0X3C,0XC8,0X34,0X46,0X3B,0XE5,0X33,0XC4,0X34,0X47,0X34,0XA9,0X34,
+0XEA,0X55,0X6C,0X44,0XCA,0X34,0X48,0X34,0X27,0X34,0X68,0X34,0X88,0X34,0X68,0X34,
+0X88,0X2B,0XE7,0X22,0XC4,0X1A,0X23,0X1A,0X03,0XA9,0XE0,0XF2,0XA2,0XEA,0X83,0X80,
+0XEA,0XA2,0X00,0XEA,0X82,0X80,0XE2,0X83,0X16,0XDA,0X83,0XDA,0X63,0XD2,0X44,0XD2,
+0X65,0XCA,0X45,0XC2,0X25,0XC2,0X26,0XBA,0X05,0XBA,0X06,0XA9,0XE6,0XA9,0XC7,0XA1,
+0XC8,0X99,0XA9,0X91,0X89,0X89,0X6A,0X81,0X6A,0X81,0X2B,0X79,0X2C,0X71,0X2D,0X69,
+0X0E,0X60,0XCF,0X60,0XEF,0X38,0X6B,0X81,0X00,0X61,0X0A,0X18,0X28,0X38,0XD3,0X28,
+0XB3,0X28,0XD4,0X28,0XB4,0X20,0XB4,0X18,0XB4,0X18,0XB5,0X10,0XB5,0X10,0XD5,0X08,
+0XD6,0X80,0X08,0XF6,0X01,0X09,0X37,0X01,0X13,0X84,0X00,0X61,0X0F,0X00,0XE9,0X0A,
+0XDA,0X0A,0XF9,0X0B,0X38,0X0B,0X79,0X03,0XB8,0X0B,0XD9,0X0C,0X19,0X0C,0X59,0X0C,
+0X99,0X0C,0XB9,0X04,0XD9,0X05,0X38,0X15,0X59,0X0D,0X79,0X05,0XBA,0X80,0X05,0XD9,
+0X01,0X0D,0XF9,0X0E,0X39,0X80,0X06,0X59,0X80,0X06,0X78,0X01,0X06,0X57,0X06,0X36,
+0X80,0X06,0X56,0X02,0X06,0X75,0X06,0X74,0X06,0X32,0X8A,0X00,0X61,0X00,0X00,0X82,
+0X81,0X08,0XA2,0X01,0X02,0XA1,0X05,0X83,0X80,0X05,0X42,0X00,0X05,0X21,0X80,0X05,
+0X40,0X01,0X05,0X20,0X0D,0X20,0X80,0X15,0X40,0X03,0X1D,0X40,0X25,0X40,0X25,0X80,
+0X24,0XE0,0X82,0X08,0X81,0X00,0X00,0X61,0X80,0X08,0X81,0X00,0X08,0XA1,0X80,0X09,
+0X02,0X80,0X08,0XE2,0X02,0X08,0XC1,0X08,0XE2,0X09,0X02,0X83,0X09,0X22,0X05,0X84,
+0X20,0XE7,0X20,0XE6,0XA0,0XEE,0XA0,0XF6,0XC0,0XF6,0XE0,0X86,0XFE,0XE0,0X09,0XFF,
+0X00,0XFE,0XC0,0XFE,0XE1,0XFE,0XC0,0XFE,0XE0,0XFF,0X00,0XFE,0XC0,0XFE,0XE0,0XFE,
+0XC0,0XFE,0XE2,0X80,0XFE,0XC0,0X85,0XFE,0XE0,0X0C,0XFF,0X00,0XFE,0XC0,0XFF,0X00,
+0XF6,0XA0,0X00,0X61,0X00,0X81,0X00,0X61,0X08,0X81,0X08,0XA1,0X08,0XC2,0X09,0X02,
+0XB5,0X00,0XFF,0X60,0X87,0XFE,0XE0,0X03,0XFE,0XC0,0XFE,0XE1,0XFE,0XE0,0XFF,0X00,
+0X80,0XFE,0XE0,0X04,0XFF,0X00,0XFE,0XC0,0XFE,0XE1,0XFF,0X00,0XFE,0XE0,0X80,0XFE,
+0XC0,0X8A,0XFE,0XE0,0X05,0XFE,0XC0,0XFF,0X60,0XD5,0XE0,0X1A,0X43,0X22,0XE3,0X2B,
+0X44,0X80,0X33,0X84,0X07,0X33,0XA5,0X2B,0XC5,0X2B,0X85,0X22,0XC4,0X12,0X03,0X11,
+0X83,0X09,0X22,0X08,0XC2,0X82,0X08,0XA2,0X01,0X08,0XA1,0X08,0X81,0X82,0X08,0XA1,
+0X81,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0X81,0X02,0X08,0XA1,0X11,0X82,0X22,0XA3,
+0X80,0X33,0X23,0X00,0X2B,0X23,0X81,0X33,0X43,0X04,0X2B,0X84,0X2B,0XA5,0X2A,0XE2,
+0X2A,0XA2,0X22,0X82,0X80,0X1A,0X22,0X01,0X2A,0XE2,0X3B,0XA2,0X80,0X3B,0XC2,0X08,
+0X3B,0X82,0X3B,0XC3,0X24,0X6C,0X24,0XCD,0X24,0X4A,0X24,0X8B,0X24,0XAC,0X24,0X8B,
+0X24,0X6A,0X80,0X24,0X29,0X80,0X24,0X08,0X80,0X24,0X29,0X07,0X2C,0X8A,0X2C,0X89,
+0X2C,0X08,0X2B,0XC7,0X23,0XA7,0X23,0XC7,0X2B,0X65,0X2B,0X24,0X80,0X23,0X04,0X00,
+0X1A,0X83,0X80,0X08,0XC2,0X07,0X2B,0X46,0X34,0X88,0X3C,0X66,0X3C,0X87,0X34,0XC9,
+0X34,0X26,0X3C,0X05,0X34,0X05,0X80,0X34,0X47,0X06,0X34,0X89,0X45,0X0B,0X4D,0X4D,
+0X3D,0X2D,0X34,0XCA,0X34,0X47,0X3C,0X46,0X81,0X34,0X88,0X05,0X34,0X48,0X2B,0X85,
+0X22,0XA3,0XA9,0XE0,0XF2,0XA2,0XEA,0X83,0X80,0XEA,0XA2,0X19,0XEA,0X82,0XE2,0X82,
+0XDA,0X84,0XDA,0X83,0XD2,0X63,0XD2,0X45,0XCA,0X45,0XC2,0X45,0XC2,0X46,0XBA,0X06,
+0XB2,0X07,0XB1,0XE7,0XA9,0XC8,0XA1,0XC9,0X99,0XA9,0X91,0X8A,0X89,0X8A,0X81,0X6B,
+0X79,0X6C,0X79,0X2C,0X71,0X0C,0X69,0X0D,0X61,0X0E,0X60,0XEF,0X59,0X0F,0X38,0X8B,
+0X81,0X00,0X61,0X02,0X18,0X29,0X30,0XD3,0X28,0XB4,0X80,0X20,0XB4,0X80,0X18,0XB5,
+0X80,0X10,0XB5,0X01,0X08,0XD6,0X08,0XF6,0X80,0X09,0X16,0X01,0X09,0X57,0X01,0X34,
+0X84,0X00,0X61,0X10,0X01,0X08,0X0A,0XFB,0X0B,0X39,0X03,0X58,0X03,0XB9,0X03,0XD8,
+0X0C,0X19,0X0C,0X39,0X0C,0X79,0X0C,0X99,0X0C,0XD9,0X05,0X39,0X05,0X58,0X0D,0X79,
+0X05,0X99,0X05,0XF9,0X0D,0XF8,0X80,0X0E,0X18,0X00,0X0E,0X39,0X80,0X0E,0X58,0X80,
+0X0E,0X57,0X06,0X06,0X77,0X0E,0X57,0X06,0X56,0X06,0X35,0X06,0X54,0X06,0X74,0X06,
+0X52,0X89,0X00,0X61,0X00,0X00,0X81,0X82,0X08,0XA2,0X01,0X02,0XA1,0X05,0X82,0X81,
+0X05,0X41,0X80,0X05,0X40,0X00,0X0D,0X40,0X81,0X15,0X40,0X03,0X25,0X60,0X2D,0X40,
+0X2D,0XA0,0X2D,0X00,0X82,0X08,0X81,0X00,0X00,0X61,0X80,0X08,0X81,0X00,0X08,0XA1,
+0X80,0X09,0X02,0X81,0X08,0XE2,0X00,0X09,0X02,0X80,0X09,0X22,0X09,0X09,0X42,0X09,
+0X83,0X09,0X63,0X09,0X22,0X09,0X02,0XD6,0XA0,0XF6,0XE0,0XFE,0XE0,0XF6,0XA0,0XF6,
+0XE0,0X88,0XFE,0XE0,0X05,0XFF,0X00,0XFE,0XE0,0XFF,0X00,0XF6,0XE0,0XFF,0X20,0XF7,
+0X00,0X81,0XFE,0XE0,0X00,0XFE,0XC0,0X80,0XFE,0XE0,0X80,0XFF,0X00,0X81,0XFE,0XE0,
+0X04,0XFF,0X00,0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X00,0X62,0X82,0X08,0X81,0X80,0X08,
+0XA2,0X02,0X21,0X21,0XFF,0X01,0XFF,0X00,0X85,0XFE,0XE0,0X04,0XFE,0XC0,0XFF,0X00,
+0XFE,0XE0,0XFF,0X00,0XFE,0XE0,0X80,0XFF,0X00,0X08,0XFE,0XE0,0XFF,0X20,0XF6,0XE0,
+0XFF,0X00,0XFE,0XE0,0XFF,0X00,0XFE,0XE0,0XFF,0X00,0XFE,0XC0,0X88,0XFE,0XE0,0X80,
+0XFF,0X00,0X0B,0X3A,0X61,0X22,0XA3,0X2B,0X85,0X2B,0XE6,0X33,0XE6,0X33,0XC5,0X2B,
+0XA5,0X2B,0X45,0X1A,0X84,0X11,0XA2,0X09,0X02,0X08,0XE2,0X80,0X08,0XA2,0X02,0X08,
+0X81,0X08,0XA2,0X08,0XA1,0X80,0X08,0XA2,0X80,0X08,0XA1,0X81,0X08,0XA2,0X00,0X08,
+0XA1,0X80,0X08,0X81,0X80,0X00,0X61,0X04,0X00,0X81,0X08,0XC2,0X11,0XE3,0X2A,0XE3,
+0X33,0X43,0X80,0X33,0X23,0X02,0X33,0X43,0X33,0X63,0X33,0X83,0X80,0X33,0XA5,0X80,
+0X2A,0XE2,0X01,0X32,0XE2,0X2A,0XA2,0X80,0X22,0X62,0X04,0X33,0X02,0X3B,0X82,0X3B,
+0XC2,0X3B,0XA2,0X3B,0XE3,0X80,0X24,0XEE,0X02,0X24,0X6A,0X2C,0X6A,0X2C,0X69,0X80,
+0X2B,0XA5,0X00,0X2C,0X08,0X80,0X24,0X29,0X20,0X24,0X08,0X24,0X49,0X2C,0XAB,0X2C,
+0X69,0X2B,0XE7,0X2C,0X07,0X2B,0XC7,0X23,0XE8,0X24,0X29,0X2B,0X85,0X22,0XA3,0X22,
+0X83,0X22,0XA3,0X11,0X82,0X08,0X81,0X22,0XA3,0X34,0X88,0X34,0XCA,0X34,0X67,0X3C,
+0X66,0X3C,0XA8,0X33,0XC4,0X34,0X26,0X34,0XA8,0X34,0X68,0X34,0X47,0X34,0X68,0X34,
+0X88,0X44,0XEB,0X3D,0X2C,0X2C,0XAA,0X34,0X46,0X3C,0X87,0X80,0X34,0XEA,0X12,0X34,
+0XA8,0X34,0X88,0X34,0XA9,0X2C,0X07,0XA9,0XE0,0XF2,0XA2,0XEA,0XA3,0XEA,0XA2,0XE2,
+0XA2,0XE2,0X82,0XE2,0X83,0XDA,0X64,0XD2,0X63,0XD2,0X43,0XD2,0X45,0XCA,0X26,0XBA,
+0X25,0XBA,0X26,0XB2,0X06,0X80,0XA9,0XC8,0X0D,0XA1,0XA9,0X99,0X89,0X91,0X89,0X89,
+0X6A,0X81,0X6B,0X81,0X4B,0X71,0X2C,0X71,0X0D,0X71,0X0E,0X61,0X0E,0X58,0XEF,0X50,
+0XD0,0X48,0XEF,0X30,0X8C,0X81,0X00,0X61,0X01,0X18,0X29,0X30,0XD4,0X81,0X20,0XB4,
+0X80,0X18,0XB5,0X07,0X10,0XB5,0X10,0XD5,0X08,0XD6,0X08,0XF6,0X09,0X16,0X09,0X37,
+0X09,0X78,0X01,0X34,0X84,0X00,0X61,0X0D,0X01,0X29,0X0B,0X3B,0X0B,0X59,0X03,0X98,
+0X0B,0XD9,0X04,0X19,0X0C,0X39,0X0C,0X79,0X04,0XD9,0X0C,0XD9,0X05,0X39,0X05,0X78,
+0X0D,0X78,0X0D,0X99,0X80,0X0D,0XD9,0X01,0X06,0X19,0X0E,0X39,0X80,0X0E,0X59,0X00,
+0X0E,0X58,0X81,0X06,0X58,0X06,0X0E,0X36,0X06,0X56,0X06,0X54,0X06,0X94,0X06,0X53,
+0X0E,0X32,0X06,0X72,0X89,0X00,0X61,0X00,0X08,0X82,0X82,0X08,0XA2,0X01,0X02,0XA1,
+0X05,0X82,0X80,0X05,0X41,0X01,0X05,0X40,0X05,0X20,0X80,0X0D,0X40,0X06,0X15,0X40,
+0X1D,0X40,0X1D,0X60,0X25,0X60,0X2D,0X60,0X35,0XA0,0X2D,0X00,0X81,0X08,0X81,0X00,
+0X00,0X61,0X81,0X08,0X81,0X05,0X08,0XC2,0X09,0X02,0X08,0XE2,0X08,0XE1,0X08,0XE2,
+0X09,0X21,0X80,0X09,0X02,0X00,0X09,0X22,0X80,0X09,0X43,0X05,0X09,0X23,0X09,0X22,
+0X09,0X02,0X84,0X00,0XFF,0X40,0XFE,0XA1,0X8C,0XFE,0XE0,0X06,0XFE,0XC0,0XFE,0XC1,
+0XFE,0XE0,0XFE,0XC0,0XFF,0X00,0XFE,0XE0,0XFF,0X01,0X86,0XFE,0XE0,0X04,0XFF,0X00,
+0XFE,0XC0,0XFF,0X00,0XF6,0XA0,0X00,0X61,0X81,0X08,0X81,0X01,0X08,0X82,0X00,0X82,
+0X80,0X08,0X81,0X00,0XC5,0X20,0X80,0XFF,0X00,0X84,0XFE,0XE0,0X00,0XF7,0X00,0X81,
+0XFE,0XE0,0X00,0XFE,0XC0,0X81,0XFE,0XE0,0X03,0XFE,0XC0,0XFE,0XE0,0XFE,0XC0,0XFE,
+0XE1,0X81,0XFF,0X00,0X00,0XFE,0XC0,0X86,0XFE,0XE0,0X0D,0XFF,0X00,0XFE,0XE0,0XFF,
+0X20,0XE6,0X00,0X22,0XC3,0X2B,0XA6,0X2C,0X28,0X2C,0X27,0X2B,0XA5,0X22,0XE4,0X1A,
+0X83,0X12,0X03,0X09,0X62,0X08,0XE2,0X80,0X08,0XC2,0X83,0X08,0XA2,0X80,0X08,0XA1,
+0X81,0X08,0XA2,0X01,0X08,0XA1,0X08,0XA2,0X80,0X08,0X81,0X81,0X00,0X61,0X0C,0X08,
+0X81,0X09,0X02,0X1A,0X23,0X2B,0X03,0X2B,0X43,0X33,0X22,0X2B,0X02,0X33,0X22,0X33,
+0X63,0X33,0XA4,0X33,0XC5,0X33,0X84,0X33,0X02,0X80,0X33,0X22,0X09,0X33,0X42,0X33,
+0X02,0X2A,0XC2,0X2A,0XA2,0X33,0X02,0X3B,0X82,0X3B,0XA2,0X3B,0XE4,0X2D,0X0E,0X24,
+0XAC,0X80,0X2C,0X49,0X08,0X2C,0X28,0X2B,0XA6,0X33,0X84,0X2B,0XE7,0X24,0X29,0X2C,
+0X49,0X2C,0X6A,0X2C,0X8A,0X2C,0X28,0X80,0X2B,0XA6,0X0B,0X2B,0XE7,0X23,0XC7,0X23,
+0XE8,0X23,0XC7,0X23,0X25,0X22,0X83,0X22,0X63,0X1A,0X43,0X10,0XE2,0X19,0XC2,0X3B,
+0XE4,0X34,0X88,0X80,0X34,0XA9,0X10,0X34,0X67,0X3C,0X87,0X33,0XA4,0X34,0X05,0X34,
+0X88,0X34,0X47,0X34,0X06,0X33,0XE5,0X34,0X26,0X34,0X88,0X34,0XEA,0X34,0XEB,0X34,
+0X48,0X3C,0X46,0X34,0X27,0X34,0X47,0X34,0X67,0X80,0X34,0X88,0X1F,0X34,0X67,0XB1,
+0XE1,0XF2,0XA2,0XEA,0XA3,0XE2,0XA2,0XE2,0X82,0XE2,0X43,0XDA,0X84,0XDA,0X64,0XD2,
+0X44,0XCA,0X45,0XC2,0X25,0XBA,0X25,0XBA,0X06,0XB2,0X07,0XA9,0XE7,0XA9,0XC8,0XA1,
+0XA8,0X99,0X89,0X91,0X8A,0X89,0X6A,0X81,0X6B,0X79,0X4C,0X71,0X2C,0X71,0X0C,0X68,
+0XED,0X61,0X0E,0X58,0XEF,0X50,0XCF,0X48,0XD0,0X40,0XF1,0X28,0X8B,0X81,0X00,0X61,
+0X0E,0X10,0X49,0X28,0XD3,0X20,0X93,0X20,0XB4,0X20,0X94,0X18,0XB5,0X10,0XB5,0X10,
+0XD6,0X10,0XF6,0X08,0XF7,0X09,0X17,0X01,0X57,0X09,0X78,0X11,0X78,0X09,0X54,0X84,
+0X00,0X61,0X0F,0X01,0X48,0X13,0X5A,0X0B,0X9A,0X03,0XF8,0X0C,0X18,0X04,0X39,0X0C,
+0X99,0X0C,0X79,0X0C,0XF9,0X0D,0X19,0X0D,0X39,0X0D,0X79,0X0D,0XB9,0X0D,0XD9,0X0D,
+0XF8,0X0E,0X19,0X80,0X06,0X39,0X80,0X0E,0X59,0X00,0X06,0X58,0X81,0X06,0X57,0X06,
+0X06,0X55,0X06,0X75,0X06,0X74,0X06,0X55,0X06,0X53,0X06,0X71,0X06,0X50,0X88,0X00,
+0X61,0X00,0X08,0X81,0X81,0X08,0XA2,0X03,0X08,0XC2,0X08,0XA2,0X02,0X80,0X05,0X81,
+0X80,0X05,0X40,0X01,0X0D,0X40,0X0D,0X20,0X80,0X15,0X40,0X06,0X1D,0X40,0X25,0X60,
+0X25,0X61,0X2D,0X61,0X2D,0X80,0X3D,0XA0,0X3D,0X00,0X83,0X08,0X81,0X02,0X08,0X61,
+0X08,0XA1,0X08,0XE2,0X82,0X09,0X02,0X02,0X09,0X22,0X09,0X02,0X08,0XE2,0X80,0X09,
+0X02,0X01,0X08,0XC2,0X08,0XE2,0X80,0X09,0X62,0X05,0X09,0X42,0XD5,0XE0,0XFF,0X00,
+0XFE,0XE0,0XFF,0X01,0XFF,0X00,0X81,0XFE,0XE0,0X03,0XFE,0XC0,0XFE,0XE1,0XFE,0XE0,
+0XFF,0X00,0X90,0XFE,0XE0,0X01,0XFF,0X00,0XFF,0X01,0X80,0XFE,0XE0,0X00,0XF6,0XA0,
+0X80,0X00,0X61,0X00,0X00,0X81,0X83,0X08,0X81,0X01,0X08,0XA1,0XFE,0XA0,0X81,0XFF,
+0X00,0X01,0XFE,0XE0,0XFF,0X00,0X8F,0XFE,0XE0,0X02,0XFF,0X00,0XFE,0XE0,0XFE,0XC0,
+0X83,0XFE,0XE0,0X80,0XFF,0X00,0X0C,0XFE,0XE0,0XFF,0X01,0X2A,0X62,0X2B,0XA6,0X2C,
+0X48,0X2C,0X07,0X2B,0X45,0X1A,0X63,0X11,0XA2,0X11,0X42,0X09,0X22,0X09,0X02,0X08,
+0XE2,0X80,0X08,0XC2,0X88,0X08,0XA2,0X80,0X08,0XA1,0X00,0X08,0X81,0X82,0X00,0X61,
+0X0B,0X08,0X61,0X09,0X02,0X1A,0X63,0X2B,0X65,0X2B,0X84,0X2B,0X23,0X33,0X02,0X33,
+0X22,0X33,0X63,0X33,0X84,0X33,0XE5,0X33,0X84,0X80,0X33,0X22,0X00,0X33,0X42,0X80,
+0X33,0X62,0X12,0X33,0X43,0X1A,0X63,0X19,0XE2,0X2A,0XC2,0X3B,0XC3,0X3B,0XE5,0X2C,
+0X8A,0X2C,0X28,0X2B,0XE7,0X2C,0XAB,0X2C,0XCC,0X2C,0X8A,0X2B,0XE7,0X2C,0X07,0X24,
+0X49,0X2C,0X8A,0X2C,0X89,0X2C,0X27,0X2B,0XE6,0X80,0X2B,0X85,0X00,0X2B,0XA6,0X80,
+0X23,0XC7,0X01,0X23,0X86,0X22,0XC4,0X80,0X22,0XA3,0X09,0X11,0XA3,0X10,0XE1,0X2B,
+0X03,0X3C,0X24,0X34,0XA8,0X34,0X67,0X34,0X88,0X34,0X67,0X3C,0X86,0X33,0XC4,0X80,
+0X33,0XE5,0X80,0X33,0XC5,0X07,0X33,0XE5,0X33,0XC5,0X34,0X68,0X3C,0XA9,0X35,0X0B,
+0X34,0XCA,0X34,0X88,0X2C,0X47,0X80,0X34,0X68,0X21,0X2C,0X68,0X34,0X47,0X3C,0X87,
+0XB1,0XE2,0XF2,0XC2,0XE2,0XA3,0XDA,0X82,0XDA,0XA3,0XDA,0X64,0XDA,0X44,0XD2,0X63,
+0XCA,0X44,0XCA,0X25,0XC2,0X26,0XBA,0X06,0XB1,0XE7,0XB1,0XE8,0XA9,0XC8,0X99,0XC8,
+0X99,0XA9,0X91,0X8A,0X89,0X6B,0X81,0X6B,0X79,0X4C,0X71,0X2D,0X71,0X0D,0X69,0X2E,
+0X60,0XEF,0X58,0XEF,0X50,0XCF,0X48,0XD0,0X48,0XB1,0X40,0XD2,0X28,0X6C,0X81,0X00,
+0X61,0X0E,0X10,0X2A,0X20,0XD5,0X18,0XD6,0X18,0XD5,0X10,0XB5,0X10,0XD5,0X08,0XD5,
+0X08,0XF5,0X09,0X16,0X09,0X36,0X01,0X56,0X01,0X77,0X09,0X97,0X01,0XF8,0X01,0X94,
+0X84,0X00,0X61,0X07,0X01,0X69,0X0B,0X9B,0X0B,0XDA,0X0C,0X18,0X0C,0X39,0X04,0X7A,
+0X04,0XB9,0X0D,0X1A,0X80,0X0D,0X39,0X05,0X0D,0X79,0X0D,0X99,0X05,0XD9,0X05,0XF9,
+0X0E,0X19,0X0E,0X39,0X82,0X06,0X58,0X01,0X06,0X77,0X06,0X57,0X80,0X06,0X56,0X06,
+0X06,0X95,0X06,0X54,0X0E,0X33,0X06,0X33,0X06,0X52,0X06,0X70,0X0E,0X2F,0X88,0X00,
+0X61,0X00,0X08,0X82,0X82,0X08,0XA2,0X03,0X08,0X81,0X02,0X80,0X05,0X61,0X05,0X20,
+0X80,0X0D,0X20,0X01,0X0D,0X40,0X15,0X60,0X80,0X1D,0X60,0X05,0X2D,0X60,0X35,0X60,
+0X3D,0X60,0X3D,0XA0,0X4D,0XC1,0X44,0XE0,0X80,0X08,0X81,0X04,0X00,0X61,0X08,0X81,
+0X00,0X61,0X08,0X81,0X08,0XA2,0X80,0X09,0X02,0X04,0X09,0X22,0X09,0X42,0X09,0X22,
+0X08,0XE2,0X08,0XC1,0X80,0X08,0XA1,0X02,0X08,0X81,0X00,0X81,0X09,0X02,0X80,0X11,
+0X82,0X03,0X09,0X42,0X11,0X22,0XE6,0XA0,0XFF,0X40,0X80,0XFE,0XE0,0X03,0XFE,0XC0,
+0XFE,0XE0,0XFF,0X00,0XFE,0XE0,0X80,0XFF,0X00,0X82,0XFE,0XE0,0X01,0XFF,0X00,0XFE,
+0XE0,0X81,0XFF,0X00,0X86,0XFE,0XE0,0X01,0XFE,0XE1,0XFE,0XC0,0X80,0XFF,0X00,0X06,
+0XFE,0XE0,0XFF,0X00,0XF6,0XA0,0X00,0X61,0X00,0X81,0X00,0X82,0X00,0X81,0X83,0X08,
+0X81,0X03,0X31,0X81,0XFF,0X41,0XFE,0XE0,0XFE,0XC0,0X81,0XFE,0XE0,0X01,0XFF,0X00,
+0XFE,0XE1,0X85,0XFE,0XE0,0X82,0XFF,0X00,0X87,0XFE,0XE0,0X00,0XFF,0X00,0X81,0XFE,
+0XE0,0X07,0XFF,0X60,0X5A,0XE2,0X2B,0X44,0X34,0X06,0X2B,0XE6,0X2A,0XE4,0X19,0XC2,
+0X09,0X22,0X83,0X08,0XE2,0X00,0X08,0XC2,0X89,0X08,0XA2,0X80,0X08,0XA1,0X00,0X08,
+0X81,0X82,0X00,0X61,0X0B,0X00,0X62,0X09,0X22,0X22,0XA4,0X2B,0X85,0X2B,0X44,0X2B,
+0X03,0X33,0X22,0X33,0X42,0X33,0X63,0X33,0X84,0X33,0XE5,0X33,0X64,0X80,0X33,0X22,
+0X13,0X33,0X42,0X3B,0X62,0X33,0X83,0X2B,0X64,0X11,0XE3,0X08,0XE2,0X19,0XA2,0X2B,
+0X23,0X34,0X05,0X2C,0X69,0X2C,0X28,0X2C,0X08,0X24,0X6A,0X24,0X69,0X24,0X08,0X2C,
+0X08,0X2C,0X28,0X2C,0X89,0X2C,0X69,0X2C,0X07,0X80,0X2B,0XE6,0X80,0X2B,0X85,0X03,
+0X23,0XC7,0X23,0XA7,0X23,0X86,0X23,0X65,0X80,0X22,0XA3,0X07,0X1A,0X43,0X08,0XE2,
+0X19,0XA3,0X3B,0XE4,0X3C,0X25,0X3C,0XA7,0X34,0X67,0X3C,0X67,0X80,0X3C,0X66,0X30,
+0X33,0XC4,0X3C,0X26,0X34,0X47,0X34,0X68,0X34,0X06,0X34,0X47,0X33,0XC5,0X34,0X47,
+0X34,0XC9,0X3C,0XEB,0X3D,0X0B,0X34,0XEB,0X2C,0XA9,0X2C,0XAA,0X2C,0X48,0X2C,0X27,
+0X2C,0X47,0X34,0X47,0XAA,0X01,0XEA,0XC1,0XE2,0XA3,0XE2,0X63,0XDA,0X83,0XD2,0X84,
+0XD2,0X44,0XCA,0X64,0XC2,0X45,0XC2,0X26,0XBA,0X06,0XB1,0XE7,0XA9,0XE7,0XA9,0XC8,
+0XA1,0XA9,0X99,0XC9,0X91,0XA9,0X89,0X6A,0X81,0X6B,0X81,0X4B,0X79,0X2C,0X71,0X0D,
+0X70,0XED,0X60,0XEE,0X58,0XEF,0X50,0XEF,0X48,0XD0,0X48,0XB0,0X40,0XB1,0X40,0XB3,
+0X28,0X6C,0X81,0X00,0X61,0X04,0X08,0X2A,0X20,0XD5,0X18,0XD5,0X10,0XD5,0X10,0XB5,
+0X80,0X10,0XD7,0X07,0X08,0XF7,0X09,0X17,0X09,0X38,0X09,0X58,0X09,0X78,0X09,0X98,
+0X02,0X39,0X01,0XB4,0X84,0X00,0X61,0X0F,0X01,0X68,0X03,0XFA,0X04,0X19,0X0C,0X58,
+0X0C,0X78,0X0C,0XDA,0X0C,0XB7,0X0C,0XF8,0X0D,0X58,0X0D,0X79,0X0D,0XB9,0X0D,0XD9,
+0X05,0XF9,0X06,0X18,0X0E,0X38,0X0E,0X59,0X82,0X0E,0X58,0X80,0X06,0X57,0X80,0X06,
+0X56,0X06,0X0E,0X34,0X06,0X53,0X0E,0X53,0X06,0X32,0X06,0X71,0X06,0X4F,0X06,0X2F,
+0X87,0X00,0X61,0X00,0X08,0X81,0X84,0X08,0XA2,0X03,0X02,0XA0,0X0D,0X61,0X05,0X40,
+0X0D,0X20,0X80,0X15,0X40,0X80,0X1D,0X60,0X08,0X25,0X60,0X2D,0X60,0X2D,0X80,0X3D,
+0X80,0X45,0XA0,0X4D,0XA0,0X4D,0X20,0X08,0X81,0X00,0X61,0X80,0X08,0X81,0X08,0X00,
+0X61,0X08,0X81,0X09,0X02,0X09,0X62,0X11,0X62,0X09,0X62,0X09,0X42,0X09,0X01,0X08,
+0XA1,0X80,0X08,0X81,0X80,0X00,0X61,0X09,0X08,0XA1,0X09,0X22,0X11,0X82,0X11,0X62,
+0X09,0X42,0X09,0X22,0X11,0X42,0XE6,0XC0,0XFF,0X20,0XFE,0XC0,0X80,0XFF,0X00,0X00,
+0XFF,0X01,0X81,0XFF,0X00,0X00,0XFE,0XC0,0X80,0XFF,0X00,0X88,0XFE,0XE0,0X80,0XF6,
+0XE0,0X80,0XFF,0X00,0X01,0XFE,0XE1,0XFE,0XC0,0X81,0XFE,0XE0,0X04,0XFF,0X01,0XEE,
+0XC0,0X00,0X61,0X00,0X81,0X00,0X82,0X85,0X08,0X81,0X01,0X42,0X20,0XFF,0X40,0X81,
+0XFE,0XE0,0X01,0XFF,0X00,0XFE,0XC0,0X81,0XFE,0XE0,0X83,0XFF,0X00,0X00,0XFE,0XC0,
+0X84,0XFE,0XE0,0X00,0XFE,0XC1,0X82,0XFE,0XE0,0X06,0XFF,0X00,0XFE,0XC0,0XFE,0XE0,
+0XFF,0X00,0XFF,0X41,0X63,0X01,0X1A,0X43,0X80,0X33,0XA4,0X05,0X22,0XE4,0X11,0XA2,
+0X08,0XC2,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X81,0X09,0X02,0X80,0X08,0XC2,0X83,0X08,
+0XA2,0X03,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X80,0X08,0XC2,0X01,0X08,0XA2,
+0X00,0X82,0X82,0X00,0X61,0X0B,0X00,0X82,0X09,0X22,0X1A,0X84,0X2B,0X24,0X22,0XE3,
+0X2A,0XE2,0X33,0X63,0X3B,0XA3,0X33,0XA3,0X33,0XA4,0X33,0XC5,0X33,0X83,0X80,0X33,
+0X42,0X0F,0X33,0X62,0X3B,0XC4,0X34,0X27,0X23,0X66,0X09,0X63,0X08,0X61,0X08,0XC1,
+0X19,0XC2,0X2B,0X44,0X2C,0X89,0X2C,0X8A,0X2C,0X28,0X24,0X28,0X24,0X6A,0X24,0X69,
+0X2C,0X49,0X80,0X2C,0X69,0X13,0X2B,0XE7,0X2B,0XE6,0X34,0X48,0X34,0X27,0X33,0XE6,
+0X2B,0XC6,0X2B,0XE7,0X2B,0XA6,0X2B,0X65,0X22,0XC4,0X22,0X83,0X1A,0X63,0X11,0X62,
+0X08,0XC1,0X2B,0X04,0X44,0X45,0X3C,0X67,0X34,0XCA,0X35,0X0B,0X34,0XCA,0X80,0X3C,
+0X87,0X0B,0X33,0XC5,0X3C,0X05,0X34,0X26,0X34,0X47,0X33,0XE5,0X33,0XC5,0X33,0XA4,
+0X33,0XE5,0X3C,0X87,0X34,0X47,0X3C,0XA9,0X45,0X4C,0X80,0X2C,0XAA,0X22,0X2C,0X68,
+0X34,0X27,0X34,0X68,0X2C,0X89,0XB1,0XC1,0XEA,0XC2,0XDA,0X84,0XE2,0X45,0XDA,0X44,
+0XD2,0X64,0XCA,0X44,0XCA,0X26,0XC2,0X06,0XBA,0X07,0XB9,0XE7,0XB1,0XC7,0XA9,0XC8,
+0XA1,0XA8,0XA1,0X89,0X91,0X8A,0X89,0X6B,0X81,0X6B,0X79,0X4C,0X71,0X2C,0X71,0X2D,
+0X69,0X0D,0X61,0X0E,0X58,0XEF,0X50,0XD0,0X50,0XF0,0X48,0XD1,0X40,0XB1,0X38,0XB2,
+0X38,0XB3,0X20,0X6D,0X81,0X00,0X61,0X05,0X08,0X2B,0X20,0XB6,0X18,0XB5,0X10,0X95,
+0X18,0XB7,0X08,0XF6,0X80,0X09,0X16,0X06,0X09,0X57,0X01,0X77,0X01,0XB7,0X09,0XD7,
+0X09,0XF8,0X0A,0X39,0X09,0XD4,0X84,0X00,0X61,0X0A,0X01,0X49,0X0C,0X3A,0X0C,0X39,
+0X14,0X79,0X04,0X78,0X05,0X1A,0X0D,0X19,0X0D,0X39,0X0D,0X79,0X0D,0X99,0X0D,0XB9,
+0X80,0X0D,0XF9,0X00,0X0E,0X19,0X80,0X0E,0X39,0X81,0X0E,0X58,0X80,0X0E,0X57,0X09,
+0X06,0X56,0X06,0X55,0X06,0X54,0X06,0X34,0X06,0X73,0X06,0X52,0X06,0X51,0X06,0X70,
+0X06,0X2E,0X06,0X0E,0X87,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XA2,0X80,0X00,0XC2,
+0X05,0X00,0XA2,0X08,0XA2,0X02,0XA0,0X05,0X80,0X05,0X40,0X0D,0X40,0X80,0X15,0X60,
+0X08,0X1D,0X80,0X25,0X60,0X2D,0X80,0X35,0XA0,0X35,0X80,0X45,0XA0,0X4D,0XC0,0X55,
+0XC0,0X55,0X20,0X83,0X08,0X81,0X06,0X08,0XE2,0X11,0XA3,0X11,0XE3,0X11,0XC3,0X11,
+0X82,0X09,0X02,0X08,0XA1,0X80,0X08,0X81,0X81,0X00,0X61,0X02,0X08,0XA1,0X09,0X42,
+0X11,0XA2,0X80,0X11,0X82,0X07,0X09,0X62,0X09,0X22,0X11,0X22,0XCE,0X00,0XFF,0X60,
+0XFF,0X40,0XFE,0XE0,0XFE,0XC0,0X80,0XFE,0XC1,0X00,0XFE,0XE0,0X81,0XFF,0X00,0X8B,
+0XFE,0XE0,0X03,0XFE,0XC0,0XFE,0XE0,0XFF,0X20,0XFE,0XE0,0X80,0XFE,0XC0,0X07,0XFF,
+0X00,0XF6,0XE0,0X08,0XA1,0X00,0X61,0X00,0X62,0X00,0X61,0X08,0X81,0X00,0X81,0X82,
+0X08,0X81,0X06,0X08,0XA1,0X39,0XC1,0XF6,0XE1,0XFF,0X20,0XFE,0XE1,0XFE,0XA1,0XFF,
+0X00,0X82,0XFE,0XE0,0X80,0XFE,0XC0,0X80,0XFE,0XE0,0X00,0XFF,0X00,0X88,0XFE,0XE0,
+0X0A,0XFE,0XE1,0XFE,0XE0,0XFF,0X00,0XFF,0X20,0XFE,0XE0,0X52,0X61,0X11,0X62,0X22,
+0X83,0X2B,0X23,0X22,0XA3,0X11,0X62,0X80,0X08,0XA1,0X02,0X08,0XA2,0X08,0XC2,0X08,
+0XE2,0X80,0X09,0X02,0X80,0X08,0XE2,0X00,0X08,0XC2,0X82,0X08,0XA2,0X80,0X08,0XA1,
+0X01,0X08,0XA2,0X08,0XC2,0X81,0X08,0XE2,0X02,0X08,0XA2,0X00,0XA2,0X00,0X82,0X81,
+0X00,0X61,0X0B,0X00,0X81,0X08,0XE2,0X19,0XE2,0X22,0X83,0X22,0XA2,0X2B,0X02,0X33,
+0X83,0X3B,0XC4,0X3B,0XA3,0X33,0XC4,0X33,0XC5,0X33,0X63,0X80,0X33,0X62,0X04,0X33,
+0X83,0X34,0X06,0X2C,0X69,0X23,0X47,0X09,0X22,0X80,0X08,0X61,0X05,0X08,0XA1,0X19,
+0XC2,0X2C,0X49,0X24,0X4A,0X24,0X29,0X2C,0X49,0X80,0X2C,0X8A,0X02,0X2C,0X6A,0X2C,
+0X69,0X2C,0X08,0X80,0X2B,0XE7,0X13,0X2C,0X27,0X34,0X27,0X2B,0XE6,0X33,0XE6,0X2B,
+0X85,0X2B,0X45,0X23,0X24,0X22,0XC3,0X22,0XA2,0X1A,0X23,0X08,0XA2,0X19,0XC3,0X3B,
+0XE5,0X3C,0X65,0X34,0XCA,0X34,0XEA,0X34,0XEB,0X34,0XEA,0X3C,0X87,0X3C,0X66,0X80,
+0X3B,0XE4,0X00,0X3C,0X05,0X80,0X34,0X06,0X2B,0X34,0X26,0X33,0XC4,0X33,0XA3,0X3B,
+0XE4,0X3C,0X45,0X3C,0X47,0X34,0XCA,0X35,0X0B,0X2C,0XCA,0X2C,0X68,0X34,0X48,0X34,
+0XA9,0X2C,0XA9,0XB1,0XC2,0XEA,0XA2,0XD2,0X83,0XD2,0X65,0XD2,0X45,0XCA,0X45,0XC2,
+0X45,0XC2,0X05,0XBA,0X06,0XB1,0XE7,0XA9,0XE7,0XA1,0XC7,0X99,0XC8,0X91,0XA9,0X91,
+0X89,0X89,0X6A,0X81,0X4B,0X81,0X4C,0X71,0X2C,0X69,0X2D,0X61,0X2D,0X61,0X0E,0X59,
+0X0F,0X58,0XCF,0X50,0XD0,0X48,0XB0,0X40,0XB0,0X38,0XB0,0X30,0XB2,0X30,0XD3,0X18,
+0X8D,0X81,0X00,0X61,0X04,0X08,0X2A,0X18,0XD5,0X10,0XB6,0X10,0XD5,0X10,0XF6,0X80,
+0X09,0X16,0X07,0X09,0X37,0X09,0X57,0X01,0X97,0X01,0XD8,0X02,0X18,0X0A,0X38,0X0A,
+0X5A,0X0A,0X34,0X84,0X00,0X61,0X0D,0X01,0X8A,0X04,0X99,0X04,0X98,0X14,0XB9,0X0C,
+0XD9,0X0D,0X19,0X15,0X39,0X0D,0X9A,0X05,0XB9,0X05,0XD9,0X05,0XF9,0X06,0X19,0X06,
+0X39,0X06,0X59,0X80,0X0E,0X59,0X80,0X06,0X78,0X03,0X06,0X77,0X06,0X76,0X06,0X75,
+0X06,0X74,0X80,0X06,0X73,0X06,0X06,0X33,0X0E,0X72,0X06,0X51,0X06,0X2F,0X0E,0X0E,
+0X06,0X0D,0X06,0X2E,0X86,0X00,0X61,0X01,0X00,0X81,0X08,0XA1,0X80,0X08,0XA2,0X12,
+0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XA2,0X02,0XA1,0X0D,0X80,0X0D,0X60,0X15,0X40,
+0X1D,0X40,0X25,0X60,0X25,0X40,0X35,0X40,0X3D,0X60,0X45,0X60,0X45,0X81,0X55,0X81,
+0X4D,0X60,0X65,0XC0,0X5D,0X41,0X82,0X08,0X81,0X06,0X08,0XA1,0X09,0X42,0X12,0X44,
+0X12,0X24,0X11,0XC3,0X09,0X42,0X08,0XA2,0X80,0X08,0X81,0X81,0X00,0X61,0X06,0X08,
+0X61,0X00,0XA1,0X11,0X42,0X11,0XC2,0X11,0XA2,0X11,0X82,0X09,0X82,0X80,0X09,0X22,
+0X06,0X09,0X02,0X93,0XA0,0XE6,0X61,0XFF,0X80,0XFF,0X00,0XFE,0XE0,0XFF,0X00,0X85,
+0XFE,0XE0,0X80,0XFF,0X00,0X88,0XFE,0XE0,0X80,0XFF,0X00,0X04,0XFF,0X20,0XFF,0X00,
+0XFF,0X40,0XF6,0XE1,0X11,0X22,0X82,0X00,0X61,0X82,0X08,0X81,0X0B,0X00,0X81,0X08,
+0X81,0X08,0XA1,0X10,0XE1,0XC5,0XC1,0XF7,0X20,0XFF,0X60,0XFE,0XE0,0XFF,0X00,0XFE,
+0XE0,0XFE,0XC0,0XFE,0XE0,0X81,0XFF,0X00,0X00,0XFE,0XE0,0X83,0XFF,0X00,0X85,0XFE,
+0XE0,0X09,0XFF,0X00,0XFF,0X80,0XCD,0XE0,0X29,0X41,0X08,0XE2,0X1A,0X23,0X22,0X83,
+0X1A,0X23,0X11,0X62,0X08,0XA2,0X80,0X08,0X81,0X01,0X08,0XA2,0X08,0XC2,0X82,0X08,
+0XE2,0X03,0X08,0XC2,0X08,0XC1,0X08,0XA1,0X08,0XA2,0X80,0X08,0XC2,0X03,0X08,0XA2,
+0X08,0XA1,0X08,0XC1,0X08,0XC2,0X80,0X08,0XE2,0X04,0X08,0XC2,0X00,0XA2,0X00,0XA3,
+0X00,0XA2,0X00,0X62,0X81,0X00,0X61,0X05,0X08,0XA1,0X11,0X42,0X1A,0X02,0X2A,0XC2,
+0X33,0X22,0X33,0X83,0X80,0X33,0XA4,0X09,0X33,0XA5,0X33,0XC5,0X33,0X43,0X33,0X42,
+0X3B,0X82,0X3B,0XE4,0X34,0X47,0X2C,0X08,0X1A,0X65,0X08,0XC2,0X81,0X00,0X61,0X03,
+0X08,0XA1,0X24,0X49,0X23,0XE7,0X2C,0X08,0X80,0X24,0X6A,0X01,0X2C,0X69,0X2C,0X28,
+0X80,0X2C,0X08,0X81,0X2C,0X07,0X04,0X34,0XC9,0X2B,0XE7,0X2B,0X85,0X2B,0X24,0X22,
+0XC3,0X80,0X22,0XA3,0X1B,0X22,0X63,0X11,0X42,0X08,0XA2,0X23,0X05,0X3C,0X66,0X3C,
+0X87,0X34,0XCA,0X2C,0X89,0X34,0XA9,0X34,0X87,0X3C,0X87,0X3C,0X66,0X3B,0XE4,0X34,
+0X26,0X34,0X05,0X3C,0X25,0X34,0X26,0X34,0X67,0X3C,0X25,0X3B,0X83,0X33,0XC4,0X3C,
+0X25,0X3C,0X45,0X34,0X88,0X34,0XEA,0X34,0XEB,0X34,0XAA,0X2C,0X89,0X80,0X2C,0XA9,
+0X05,0X99,0XA2,0XEA,0XC3,0XDA,0X82,0XDA,0X64,0XD2,0X64,0XD2,0X25,0X80,0XC2,0X26,
+0X04,0XBA,0X07,0XB1,0XE8,0XA9,0XE8,0XA1,0XC9,0X99,0XAA,0X80,0X91,0X8B,0X80,0X89,
+0X4B,0X0D,0X81,0X2C,0X79,0X0D,0X69,0X0E,0X60,0XEE,0X60,0XCF,0X58,0XD0,0X50,0XD1,
+0X48,0XB2,0X40,0XB1,0X38,0XB2,0X38,0XD2,0X30,0XB3,0X28,0XD4,0X18,0X6D,0X81,0X00,
+0X61,0X01,0X08,0X49,0X10,0XD5,0X80,0X08,0XF8,0X00,0X09,0X17,0X80,0X09,0X38,0X07,
+0X09,0X78,0X09,0X99,0X09,0XD9,0X0A,0X19,0X0A,0X39,0X0A,0X59,0X0A,0XBC,0X02,0X54,
+0X84,0X00,0X61,0X0B,0X01,0X8A,0X0C,0XD9,0X05,0X19,0X05,0X39,0X05,0X59,0X05,0X79,
+0X0D,0X99,0X05,0XD9,0X0D,0XF9,0X0E,0X19,0X0E,0X39,0X0E,0X59,0X82,0X0E,0X79,0X80,
+0X06,0X78,0X03,0X06,0X77,0X06,0X76,0X06,0X75,0X06,0X74,0X80,0X06,0X73,0X06,0X06,
+0X91,0X06,0X70,0X06,0X90,0X06,0X8F,0X06,0X4E,0X06,0X8D,0X06,0X0D,0X86,0X00,0X61,
+0X01,0X08,0X81,0X08,0XA2,0X80,0X08,0XA1,0X00,0X08,0XA2,0X80,0X08,0XC2,0X08,0X08,
+0XA2,0X0A,0X41,0X0D,0XA0,0X15,0XA0,0X1D,0X80,0X25,0X80,0X2D,0XA0,0X2D,0X80,0X35,
+0XA0,0X80,0X3D,0XA0,0X04,0X4E,0X00,0X56,0X00,0X5D,0XC0,0X76,0X40,0X5D,0X21,0X81,
+0X08,0X81,0X07,0X08,0XA1,0X08,0XE2,0X11,0XC3,0X12,0X24,0X11,0XC3,0X09,0X42,0X08,
+0XC1,0X00,0X81,0X80,0X08,0X81,0X82,0X00,0X61,0X06,0X08,0XA1,0X11,0X62,0X11,0XE3,
+0X11,0XA2,0X11,0X82,0X09,0X62,0X09,0X42,0X80,0X09,0X22,0X80,0X11,0X22,0X03,0X8B,
+0XE0,0XE6,0X20,0XFE,0XE0,0XFF,0X00,0X80,0XFF,0X20,0X81,0XFE,0XE0,0X00,0XFE,0XC0,
+0X81,0XFE,0XE0,0X02,0XFE,0XE1,0XFE,0XE0,0XFF,0X00,0X82,0XFE,0XE0,0X80,0XFF,0X00,
+0X08,0XFF,0X20,0XFF,0X41,0XFF,0X40,0XF6,0XE0,0XE6,0X81,0XB5,0X40,0X73,0X40,0X09,
+0X03,0X00,0X82,0X83,0X00,0X61,0X84,0X08,0X81,0X03,0X08,0XA2,0X29,0X61,0XC5,0XA0,
+0XFE,0XE0,0X80,0XFF,0X40,0X02,0XFF,0X20,0XFE,0XE0,0XFE,0XC0,0X80,0XFE,0XE0,0X00,
+0XFF,0X00,0X85,0XFE,0XE0,0X02,0XFF,0X00,0XFF,0X01,0XFF,0X40,0X80,0XFF,0X20,0X0E,
+0XD6,0X00,0X31,0XA1,0X08,0X81,0X08,0XA1,0X09,0X63,0X1A,0XA4,0X22,0XA4,0X11,0XA3,
+0X08,0XC2,0X08,0X81,0X00,0X61,0X08,0XA1,0X08,0XC2,0X08,0XE2,0X09,0X02,0X80,0X08,
+0XE2,0X80,0X08,0XC2,0X80,0X08,0XA1,0X02,0X08,0XA2,0X08,0XC2,0X08,0XA1,0X80,0X08,
+0XC1,0X00,0X08,0XE1,0X80,0X08,0XE2,0X03,0X08,0XC2,0X08,0XA1,0X00,0X81,0X00,0X82,
+0X83,0X00,0X61,0X11,0X08,0X81,0X08,0XC2,0X11,0XA2,0X22,0XA2,0X33,0X22,0X33,0X83,
+0X3B,0XA3,0X33,0XA4,0X33,0XC4,0X33,0XA4,0X33,0X42,0X33,0X62,0X3B,0XC4,0X34,0X46,
+0X2C,0X68,0X23,0X67,0X11,0X83,0X00,0X81,0X80,0X08,0X61,0X80,0X00,0X61,0X07,0X24,
+0X8B,0X24,0X29,0X24,0X08,0X24,0X49,0X2C,0X49,0X2C,0X28,0X2C,0X07,0X2C,0X28,0X80,
+0X2C,0X07,0X80,0X2C,0X08,0X12,0X2C,0X28,0X2B,0XE7,0X24,0X09,0X23,0XC8,0X23,0X25,
+0X22,0XE4,0X22,0X63,0X11,0XC2,0X08,0XA1,0X11,0X42,0X33,0XA6,0X3C,0X66,0X3C,0X86,
+0X34,0XEA,0X2C,0XAA,0X2C,0XCA,0X34,0X89,0X3C,0X87,0X3C,0X66,0X80,0X3C,0X05,0X04,
+0X33,0XC4,0X3C,0X05,0X3C,0X46,0X3C,0X87,0X3C,0X46,0X80,0X3B,0XC4,0X11,0X3B,0XE4,
+0X3C,0X46,0X34,0X88,0X2C,0XA9,0X2C,0XCA,0X34,0XEA,0X34,0XA9,0X2C,0X68,0X34,0XA9,
+0X60,0XE1,0XAA,0X03,0XB1,0XE3,0XB1,0XE4,0XA9,0XE5,0XA9,0XA5,0X99,0XC6,0X99,0XA6,
+0X91,0X86,0X80,0X89,0X67,0X03,0X81,0X48,0X79,0X48,0X79,0X29,0X71,0X09,0X80,0X61,
+0X0A,0X08,0X58,0XEB,0X58,0XEC,0X50,0XCC,0X48,0XCC,0X48,0XAD,0X40,0X8D,0X38,0XAE,
+0X30,0X8F,0X28,0XAF,0X80,0X28,0X8F,0X80,0X20,0X70,0X00,0X08,0X29,0X81,0X00,0X61,
+0X0E,0X00,0X26,0X08,0X8F,0X08,0XB2,0X08,0XB4,0X08,0XB3,0X01,0X13,0X01,0X14,0X09,
+0X34,0X09,0X75,0X09,0X95,0X09,0XB5,0X09,0XF5,0X0A,0X16,0X12,0X13,0X01,0X6C,0X84,
+0X00,0X61,0X07,0X00,0X63,0X0B,0X32,0X0C,0X34,0X04,0X75,0X0C,0X95,0X0C,0XB5,0X0C,
+0XD5,0X0C,0XF5,0X80,0X05,0X35,0X80,0X05,0X55,0X82,0X05,0X75,0X81,0X05,0X73,0X80,
+0X05,0X72,0X00,0X05,0X71,0X80,0X05,0X70,0X06,0X05,0X8F,0X05,0X4D,0X05,0X4C,0X05,
+0X4D,0X05,0X2C,0X05,0X0A,0X03,0XC7,0X86,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XA1,
+0X81,0X08,0XA2,0X80,0X08,0XA1,0X04,0X08,0XA2,0X0C,0X60,0X14,0X80,0X1C,0X80,0X24,
+0X80,0X80,0X24,0XA0,0X01,0X34,0XC0,0X34,0XC1,0X80,0X44,0XE0,0X03,0X4C,0XE0,0X5D,
+0X20,0X64,0XE0,0X33,0X20,0X81,0X08,0X81,0X06,0X08,0XA1,0X09,0X02,0X11,0X83,0X09,
+0X82,0X09,0X22,0X08,0XC2,0X08,0XA1,0X81,0X08,0X81,0X82,0X00,0X61,0X06,0X08,0X81,
+0X11,0X42,0X1A,0X02,0X11,0XE2,0X11,0X82,0X11,0X62,0X09,0X42,0X84,0X11,0X42,0X05,
+0X19,0X61,0X8B,0XE0,0XBD,0X00,0XDE,0X00,0XEE,0XC0,0XFF,0X00,0X83,0XFF,0X40,0X0C,
+0XFF,0X20,0XFF,0X40,0XFF,0X20,0XFF,0X00,0XFF,0X20,0XFF,0X41,0XFF,0X01,0XEE,0XA0,
+0XE6,0X40,0XCD,0X60,0X9C,0X20,0X73,0X60,0X52,0X00,0X80,0X08,0X81,0X80,0X08,0XA1,
+0X00,0X08,0X81,0X84,0X00,0X61,0X83,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0XA2,0X04,
+0X29,0X41,0X8B,0XA0,0XAC,0XC0,0XDE,0X21,0XF6,0XE0,0X80,0XFF,0X20,0X00,0XFF,0X00,
+0X80,0XFF,0X20,0X00,0XFF,0X40,0X80,0XFF,0X20,0X80,0XFF,0X40,0X05,0XFF,0X20,0XF6,
+0XE0,0XDE,0X40,0XBD,0X20,0X83,0XE0,0X10,0XE1,0X81,0X08,0X81,0X09,0X08,0XA1,0X11,
+0X83,0X1A,0X84,0X1A,0X43,0X09,0X22,0X08,0XA1,0X08,0X81,0X08,0X82,0X08,0XA2,0X08,
+0XC2,0X80,0X09,0X02,0X80,0X08,0XE2,0X04,0X08,0XC2,0X08,0XA1,0X08,0XC2,0X08,0XC1,
+0X08,0XA1,0X80,0X08,0XC1,0X00,0X08,0XE2,0X80,0X09,0X02,0X03,0X09,0X22,0X08,0XE2,
+0X08,0XA1,0X08,0X81,0X86,0X00,0X61,0X05,0X08,0XA2,0X11,0X62,0X2A,0XC2,0X33,0X02,
+0X33,0X62,0X3B,0XA3,0X80,0X33,0XC4,0X08,0X3B,0XC4,0X33,0X62,0X33,0X83,0X33,0XE5,
+0X2C,0X68,0X24,0X28,0X1A,0X64,0X08,0XC2,0X08,0X61,0X80,0X00,0X61,0X02,0X08,0X61,
+0X00,0X61,0X24,0X4A,0X80,0X24,0X6B,0X01,0X2C,0X49,0X2B,0XE7,0X80,0X2C,0X28,0X00,
+0X24,0X29,0X80,0X24,0X6A,0X14,0X24,0XAC,0X24,0XCC,0X24,0X6A,0X24,0X29,0X1C,0X4C,
+0X1C,0X6C,0X23,0XC8,0X23,0X25,0X1A,0X84,0X08,0XE2,0X08,0X81,0X1A,0X44,0X34,0X48,
+0X3C,0X66,0X44,0X66,0X34,0XC9,0X34,0XA9,0X2C,0XCA,0X34,0XC9,0X3C,0X86,0X3C,0X25,
+0X81,0X3B,0XC4,0X22,0X3B,0XE4,0X3C,0X25,0X3C,0X87,0X3C,0X66,0X34,0X26,0X3C,0X05,
+0X3B,0XC4,0X3B,0XE4,0X3C,0X25,0X34,0X88,0X2C,0XC9,0X35,0X0B,0X34,0XA9,0X34,0X47,
+0X34,0X89,0X2C,0X89,0X34,0X06,0X3B,0XE3,0X44,0X65,0X3C,0X66,0X3C,0X86,0X3C,0X87,
+0X34,0X46,0X34,0X47,0X2C,0X27,0X2B,0XA6,0X23,0X45,0X22,0XA3,0X1A,0X22,0X22,0X62,
+0X2B,0X44,0X2B,0X85,0X22,0XE4,0X1A,0X03,0X09,0X42,0X83,0X08,0XE2,0X01,0X08,0XC2,
+0X08,0XC1,0X82,0X08,0XE2,0X00,0X08,0X61,0XBC,0X00,0X61,0X02,0X08,0X81,0X08,0XA2,
+0X08,0XA1,0X81,0X08,0XA2,0X80,0X08,0XA1,0X84,0X08,0XA2,0X00,0X08,0XA1,0X81,0X08,
+0X81,0X00,0X08,0XA1,0X85,0X08,0X81,0X06,0X08,0XA1,0X08,0XE1,0X09,0X02,0X08,0XE1,
+0X08,0XC2,0X08,0XA2,0X08,0XA1,0X82,0X08,0X81,0X82,0X00,0X61,0X03,0X11,0X22,0X11,
+0XE2,0X19,0XE2,0X11,0X82,0X80,0X11,0X62,0X00,0X11,0X42,0X81,0X11,0X62,0X80,0X11,
+0X42,0X14,0X09,0X22,0X08,0XE1,0X08,0XC1,0X08,0X81,0X08,0X61,0X08,0XA1,0X5A,0X61,
+0X6B,0X20,0X7B,0X80,0X83,0XC0,0X8B,0XE0,0X93,0XE0,0X8B,0XC0,0X83,0XA0,0X7B,0X60,
+0X6A,0XE0,0X19,0XC2,0X08,0XE2,0X08,0X81,0X00,0X81,0X08,0X81,0X81,0X08,0XA2,0X03,
+0X08,0XC2,0X08,0XA2,0X08,0X81,0X00,0X81,0X81,0X08,0X81,0X82,0X00,0X61,0X82,0X08,
+0X81,0X80,0X08,0XA1,0X80,0X08,0XA2,0X09,0X08,0X82,0X00,0X81,0X01,0X03,0X01,0X43,
+0X09,0X23,0X11,0X22,0X62,0XA0,0X7B,0X60,0X7B,0XA0,0X8B,0XA0,0X80,0X8B,0XE0,0X03,
+0X83,0XA0,0X7B,0X60,0X6A,0XC1,0X29,0X41,0X80,0X08,0XE2,0X03,0X08,0XA2,0X00,0X82,
+0X00,0X81,0X00,0X61,0X80,0X00,0X82,0X07,0X08,0XA1,0X09,0X63,0X11,0XE3,0X09,0X62,
+0X08,0XA2,0X08,0X81,0X00,0X81,0X08,0XA2,0X80,0X08,0XE2,0X80,0X09,0X02,0X80,0X08,
+0XE2,0X02,0X08,0XE1,0X08,0XC1,0X08,0XC2,0X80,0X08,0XC1,0X01,0X08,0XE1,0X09,0X02,
+0X80,0X09,0X22,0X80,0X09,0X43,0X00,0X08,0XC2,0X86,0X00,0X61,0X80,0X00,0X81,0X05,
+0X08,0XA1,0X11,0X82,0X2A,0XC2,0X33,0X02,0X33,0X63,0X33,0XC4,0X80,0X33,0XE5,0X07,
+0X33,0XA4,0X33,0X62,0X33,0XA3,0X34,0X27,0X2C,0X69,0X23,0X67,0X11,0X62,0X08,0X61,
+0X83,0X00,0X61,0X0D,0X24,0X29,0X24,0X8C,0X24,0X8B,0X24,0X09,0X23,0XE7,0X2B,0XE7,
+0X23,0XE8,0X24,0X4A,0X24,0X6B,0X24,0XCC,0X24,0XEE,0X24,0XCD,0X24,0X6B,0X24,0X4A,
+0X80,0X1C,0X6D,0X0D,0X1B,0XA8,0X1A,0XA5,0X11,0XC3,0X00,0X81,0X08,0XE2,0X23,0X88,
+0X35,0X0C,0X34,0XA8,0X44,0X45,0X44,0X65,0X3C,0X66,0X34,0XA8,0X3C,0X87,0X3C,0X45,
+0X80,0X3C,0X04,0X24,0X3B,0XA3,0X33,0X62,0X3B,0X83,0X3C,0X04,0X3C,0X46,0X34,0X88,
+0X34,0X47,0X34,0X26,0X3B,0XE4,0X3B,0XC3,0X3B,0XE3,0X3C,0X05,0X34,0XA8,0X34,0XEB,
+0X34,0XCA,0X34,0X88,0X34,0X68,0X34,0X89,0X33,0XE6,0X3C,0X25,0X3D,0X0A,0X45,0X4D,
+0X45,0X6D,0X35,0X2B,0X34,0XA9,0X34,0XCA,0X34,0XA9,0X2B,0X85,0X22,0XA3,0X1A,0X42,
+0X1A,0X02,0X1A,0X22,0X2B,0X04,0X2B,0XA6,0X2B,0X66,0X22,0XC4,0X11,0XA3,0X82,0X09,
+0X02,0X07,0X08,0XE2,0X08,0XC1,0X08,0XE2,0X09,0X02,0X08,0XE2,0X09,0X22,0X09,0X23,
+0X00,0X81,0XBC,0X00,0X61,0X84,0X08,0XA2,0X00,0X08,0XA1,0X82,0X08,0XA2,0X00,0X08,
+0XC2,0X81,0X08,0XA2,0X03,0X08,0X81,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X80,0X08,0X81,
+0X00,0X08,0XA1,0X83,0X08,0X81,0X80,0X08,0XA1,0X80,0X08,0X81,0X00,0X08,0XA2,0X84,
+0X08,0X81,0X80,0X00,0X61,0X01,0X08,0X81,0X09,0X22,0X80,0X11,0XC2,0X00,0X11,0X82,
+0X80,0X11,0X62,0X81,0X11,0X82,0X05,0X11,0X62,0X11,0X42,0X11,0X22,0X09,0X02,0X08,
+0XA1,0X08,0X81,0X81,0X00,0X61,0X03,0X09,0X02,0X11,0XC2,0X11,0X41,0X11,0X82,0X80,
+0X11,0XA2,0X05,0X11,0XC2,0X1A,0X22,0X1A,0X23,0X11,0XA3,0X09,0X02,0X08,0X82,0X81,
+0X08,0X81,0X00,0X08,0XA2,0X80,0X08,0XC2,0X02,0X08,0XE2,0X08,0XC2,0X08,0X82,0X82,
+0X08,0X81,0X00,0X00,0X81,0X82,0X00,0X61,0X01,0X08,0X81,0X08,0XA1,0X85,0X08,0XA2,
+0X09,0X08,0XE2,0X01,0X23,0X01,0X43,0X09,0X23,0X09,0X02,0X08,0XE2,0X08,0XC2,0X09,
+0X02,0X11,0X42,0X09,0X42,0X80,0X08,0XE2,0X00,0X08,0XA1,0X80,0X08,0XE2,0X02,0X08,
+0XC2,0X00,0XA2,0X00,0X81,0X80,0X00,0X61,0X80,0X00,0X82,0X03,0X08,0X82,0X09,0X02,
+0X09,0X22,0X08,0XC2,0X81,0X08,0X82,0X00,0X08,0XE2,0X80,0X09,0X02,0X80,0X09,0X22,
+0X80,0X08,0XE2,0X80,0X08,0XC2,0X03,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X09,0X02,0X80,
+0X09,0X42,0X03,0X09,0X22,0X09,0X02,0X08,0XE2,0X08,0X81,0X84,0X00,0X61,0X00,0X00,
+0X62,0X81,0X00,0X61,0X0F,0X08,0X81,0X11,0X62,0X22,0XA2,0X33,0X23,0X33,0XA4,0X33,
+0XE5,0X34,0X06,0X33,0XE5,0X33,0X84,0X33,0X63,0X33,0XC5,0X2C,0X47,0X24,0X08,0X12,
+0X45,0X08,0XA2,0X08,0X61,0X83,0X00,0X61,0X0D,0X24,0X2A,0X24,0X6A,0X24,0X49,0X24,
+0X09,0X2C,0X28,0X2C,0X08,0X24,0X09,0X1C,0X6B,0X24,0XAC,0X24,0XAB,0X24,0X6B,0X24,
+0X8B,0X24,0X8C,0X24,0X4B,0X80,0X1C,0X4C,0X0A,0X1B,0X68,0X11,0XE4,0X08,0XC1,0X08,
+0X41,0X11,0X22,0X23,0XE9,0X35,0X2E,0X35,0X0C,0X34,0X88,0X3C,0X24,0X44,0X23,0X80,
+0X3C,0X45,0X81,0X3C,0X25,0X0C,0X33,0X83,0X33,0X42,0X3B,0XC3,0X3C,0X25,0X3C,0X87,
+0X34,0XEA,0X2C,0X89,0X34,0XA9,0X34,0XC9,0X34,0X88,0X34,0X46,0X34,0X05,0X34,0X47,
+0X80,0X2C,0XA9,0X80,0X2C,0XAA,0X14,0X34,0X88,0X33,0XA4,0X3C,0X25,0X45,0X2B,0X4D,
+0X8D,0X3C,0XEA,0X34,0X47,0X34,0X89,0X35,0X0A,0X34,0XA9,0X2C,0X06,0X2B,0XC7,0X23,
+0X66,0X22,0XA3,0X22,0X62,0X22,0X82,0X22,0XA3,0X22,0XC4,0X22,0X83,0X1A,0X22,0X11,
+0X83,0X84,0X08,0XE2,0X00,0X09,0X02,0X80,0X08,0XE2,0X01,0X11,0XC4,0X09,0X02,0XBB,
+0X00,0X61,0X02,0X08,0X81,0X08,0XA2,0X08,0XC2,0X86,0X08,0XA2,0X81,0X08,0XC2,0X81,
+0X08,0XA2,0X81,0X08,0XA1,0X00,0X08,0X81,0X80,0X08,0XA1,0X87,0X08,0X81,0X01,0X08,
+0XA2,0X08,0XA1,0X85,0X08,0X81,0X03,0X08,0XA1,0X11,0X42,0X19,0XE2,0X11,0XC2,0X82,
+0X11,0X82,0X06,0X11,0XA2,0X11,0X82,0X11,0X62,0X09,0X22,0X08,0XE1,0X08,0XA1,0X08,
+0X61,0X82,0X00,0X61,0X02,0X08,0XC2,0X11,0XA3,0X11,0XE2,0X81,0X11,0XA2,0X03,0X19,
+0XE2,0X1A,0X23,0X11,0XC3,0X09,0X02,0X84,0X08,0XA2,0X04,0X08,0XC2,0X08,0XE2,0X09,
+0X02,0X08,0XE2,0X08,0XA2,0X85,0X08,0X81,0X80,0X00,0X61,0X02,0X08,0X81,0X08,0XA1,
+0X08,0XA2,0X80,0X08,0XC2,0X82,0X08,0XA2,0X00,0X08,0XC2,0X80,0X09,0X02,0X0A,0X09,
+0X22,0X01,0X23,0X01,0X02,0X08,0XA1,0X00,0X61,0X08,0X81,0X08,0XC2,0X08,0XE2,0X09,
+0X22,0X09,0X23,0X08,0XE2,0X80,0X08,0XA2,0X00,0X00,0X82,0X82,0X00,0X61,0X80,0X08,
+0X81,0X02,0X00,0XA2,0X08,0XA2,0X08,0X81,0X80,0X00,0X61,0X01,0X08,0XA2,0X09,0X02,
+0X81,0X09,0X22,0X00,0X09,0X02,0X84,0X08,0XE2,0X00,0X09,0X22,0X80,0X09,0X42,0X03,
+0X09,0X02,0X08,0XC2,0X08,0X81,0X00,0X81,0X89,0X00,0X61,0X0E,0X08,0X81,0X09,0X22,
+0X1A,0X42,0X2B,0X23,0X33,0XE5,0X34,0X26,0X34,0X06,0X33,0XC5,0X33,0XA4,0X33,0X63,
+0X2B,0XE6,0X2C,0X48,0X23,0X46,0X09,0X43,0X00,0X62,0X84,0X00,0X61,0X1B,0X24,0X4A,
+0X24,0X08,0X23,0XE7,0X2B,0XC7,0X2C,0X27,0X2B,0XE7,0X24,0X29,0X1C,0X6C,0X1C,0XCD,
+0X24,0X8C,0X24,0X6A,0X24,0X8B,0X1C,0XCD,0X1C,0X6C,0X1C,0X2B,0X1B,0XA9,0X12,0X64,
+0X09,0X42,0X08,0X81,0X08,0X62,0X11,0XE4,0X2C,0X49,0X2C,0XAA,0X2C,0XEC,0X35,0X2D,
+0X3C,0XEA,0X3C,0X66,0X3C,0X46,0X81,0X3C,0X25,0X06,0X3C,0X65,0X33,0XA4,0X33,0X63,
+0X3B,0XE4,0X3C,0X45,0X34,0X67,0X2C,0XEB,0X80,0X2C,0X48,0X04,0X2C,0XEB,0X35,0X0C,
+0X34,0XEB,0X2C,0X89,0X34,0X88,0X80,0X34,0XA9,0X16,0X2C,0X89,0X2C,0XA9,0X2C,0X48,
+0X33,0XC4,0X34,0X05,0X3C,0XE9,0X3C,0XA8,0X3C,0X25,0X34,0X48,0X34,0XEA,0X3D,0X0B,
+0X34,0XEA,0X2C,0X48,0X23,0XC7,0X1C,0X4B,0X24,0X09,0X2B,0XA6,0X2B,0X65,0X2B,0X03,
+0X22,0X82,0X1A,0X23,0X1A,0X63,0X11,0XA2,0X80,0X08,0XE2,0X02,0X08,0XC2,0X08,0XA2,
+0X08,0XC2,0X82,0X08,0XE2,0X02,0X09,0X63,0X09,0X23,0X08,0X81,0XBA,0X00,0X61,0X02,
+0X08,0X81,0X08,0XA2,0X08,0XC2,0X80,0X08,0XA2,0X80,0X08,0XC2,0X81,0X08,0XA2,0X01,
+0X08,0XC2,0X08,0XA2,0X80,0X08,0XC2,0X81,0X08,0XA2,0X00,0X08,0X82,0X81,0X08,0X81,
+0X01,0X08,0XA2,0X08,0XA1,0X85,0X08,0X81,0X80,0X08,0XA2,0X81,0X08,0XA1,0X09,0X08,
+0X81,0X00,0X61,0X08,0X81,0X00,0X61,0X08,0X81,0X00,0X61,0X08,0XA1,0X11,0X82,0X1A,
+0X02,0X11,0XA2,0X80,0X11,0X82,0X81,0X11,0XA2,0X03,0X11,0X62,0X09,0X22,0X08,0XC1,
+0X08,0X81,0X84,0X00,0X61,0X02,0X08,0XA1,0X11,0X83,0X11,0XE3,0X81,0X11,0XC2,0X03,
+0X11,0XE2,0X11,0XA3,0X09,0X02,0X08,0XA1,0X83,0X08,0XA2,0X02,0X08,0XC2,0X08,0XE2,
+0X09,0X02,0X80,0X09,0X22,0X02,0X08,0XC2,0X08,0X81,0X00,0X61,0X85,0X08,0X81,0X80,
+0X00,0X61,0X00,0X08,0XA1,0X81,0X08,0XC2,0X82,0X08,0XA2,0X0C,0X08,0XC2,0X08,0XE2,
+0X09,0X23,0X09,0X84,0X09,0X63,0X00,0XC2,0X08,0X81,0X08,0XA1,0X08,0XE2,0X09,0X02,
+0X09,0X23,0X09,0X02,0X08,0XC2,0X80,0X08,0X82,0X06,0X00,0X82,0X08,0X82,0X00,0X61,
+0X00,0X82,0X08,0X82,0X08,0X81,0X08,0X82,0X80,0X00,0X82,0X03,0X00,0X81,0X00,0X82,
+0X08,0X82,0X08,0XE2,0X80,0X09,0X42,0X80,0X09,0X22,0X80,0X09,0X02,0X00,0X08,0XE2,
+0X81,0X09,0X02,0X05,0X09,0X22,0X09,0X43,0X09,0X42,0X08,0XE2,0X08,0XA1,0X08,0X81,
+0X81,0X00,0X61,0X00,0X08,0X61,0X88,0X00,0X61,0X0C,0X08,0XC2,0X19,0XE2,0X2B,0X24,
+0X2C,0X06,0X34,0X27,0X2B,0XE6,0X2C,0X07,0X2B,0XA5,0X33,0XC5,0X2C,0X27,0X23,0XC7,
+0X12,0X24,0X08,0XA2,0X85,0X00,0X61,0X07,0X24,0X08,0X23,0XE8,0X24,0X08,0X2B,0XE7,
+0X2B,0XE6,0X2B,0XE7,0X24,0X29,0X1C,0X4B,0X80,0X24,0XCD,0X0D,0X24,0XCC,0X24,0XCD,
+0X1C,0X4B,0X1C,0X09,0X1B,0X47,0X1A,0X64,0X11,0X62,0X08,0XC2,0X00,0X61,0X08,0X61,
+0X11,0XC3,0X2B,0XC6,0X34,0X47,0X34,0X88,0X80,0X34,0XCA,0X01,0X34,0XA9,0X34,0X87,
+0X80,0X3C,0X45,0X1A,0X3C,0X24,0X3C,0X25,0X3C,0X05,0X3B,0XA3,0X3B,0XE4,0X3C,0X46,
+0X34,0XCA,0X2C,0XEC,0X2B,0XC7,0X33,0XE6,0X34,0XA9,0X2C,0XCA,0X34,0X68,0X34,0XA9,
+0X2C,0X88,0X34,0XA9,0X34,0X88,0X34,0X68,0X2C,0X89,0X2C,0XA9,0X34,0X68,0X34,0X06,
+0X34,0X05,0X34,0X26,0X34,0X67,0X2C,0XCA,0X35,0X0B,0X80,0X35,0X0A,0X03,0X34,0XEA,
+0X34,0X07,0X23,0X86,0X23,0XC8,0X80,0X24,0X6B,0X06,0X2C,0X28,0X2B,0X43,0X1A,0X02,
+0X1A,0X03,0X11,0XA3,0X09,0X02,0X08,0XE2,0X81,0X08,0XC2,0X00,0X08,0XE2,0X80,0X09,
+0X02,0X03,0X09,0X63,0X09,0X22,0X08,0XE2,0X08,0X81,0XBA,0X00,0X61,0X00,0X08,0X81,
+0X84,0X08,0XC2,0X80,0X08,0XA2,0X00,0X00,0XA2,0X85,0X08,0XA2,0X80,0X08,0XA1,0X02,
+0X08,0XA2,0X08,0XA1,0X08,0XA2,0X80,0X08,0XA1,0X82,0X08,0X81,0X00,0X08,0XA1,0X80,
+0X08,0XA2,0X00,0X08,0XC2,0X81,0X08,0XA1,0X82,0X08,0X81,0X05,0X00,0X61,0X08,0X81,
+0X08,0XA1,0X11,0X82,0X11,0XE2,0X11,0XC2,0X81,0X11,0XA2,0X03,0X11,0X82,0X11,0X42,
+0X08,0XE1,0X08,0XA1,0X86,0X00,0X61,0X09,0X00,0X81,0X09,0X42,0X12,0X03,0X1A,0X03,
+0X19,0XE2,0X11,0XE2,0X11,0XA2,0X09,0X02,0X08,0X81,0X08,0XA1,0X80,0X08,0XC2,0X00,
+0X08,0XE2,0X80,0X08,0XC2,0X80,0X08,0XE2,0X04,0X09,0X02,0X09,0X22,0X09,0X42,0X09,
+0X02,0X08,0XA1,0X80,0X00,0X61,0X88,0X08,0X81,0X82,0X08,0XC2,0X07,0X08,0XC1,0X08,
+0XA1,0X08,0XC2,0X08,0XE2,0X09,0X23,0X09,0X84,0X09,0XA4,0X01,0X03,0X80,0X08,0XA2,
+0X80,0X08,0XE2,0X02,0X00,0XE2,0X08,0XC2,0X08,0XA2,0X81,0X00,0X82,0X02,0X08,0X82,
+0X00,0X61,0X00,0X82,0X80,0X08,0X82,0X00,0X00,0X61,0X80,0X08,0X82,0X80,0X00,0X81,
+0X01,0X08,0XA2,0X09,0X22,0X80,0X09,0X62,0X02,0X09,0X42,0X09,0X22,0X09,0X02,0X80,
+0X08,0XE2,0X07,0X09,0X02,0X09,0X22,0X09,0X42,0X09,0X22,0X09,0X02,0X08,0XE2,0X08,
+0XA1,0X08,0X81,0X82,0X00,0X61,0X00,0X00,0X81,0X88,0X00,0X61,0X0B,0X08,0XA1,0X11,
+0XA2,0X2B,0X24,0X2C,0X07,0X2C,0X28,0X2C,0X48,0X2C,0X69,0X2C,0X07,0X2B,0XE6,0X2C,
+0X07,0X1B,0X06,0X09,0X23,0X86,0X00,0X61,0X08,0X2B,0XC6,0X2B,0XC7,0X2B,0XE7,0X2C,
+0X28,0X24,0X08,0X23,0XE8,0X23,0XC7,0X24,0X09,0X24,0X8B,0X80,0X24,0XCD,0X06,0X24,
+0XAC,0X1C,0X2B,0X1B,0X88,0X1A,0X44,0X11,0X62,0X08,0XE2,0X08,0X81,0X80,0X08,0X61,
+0X09,0X11,0X42,0X2B,0X65,0X3C,0X88,0X45,0X0A,0X3C,0XEA,0X34,0XA8,0X34,0X88,0X34,
+0XA9,0X3C,0X87,0X3C,0X45,0X80,0X3C,0X25,0X2B,0X3C,0X04,0X3B,0XC3,0X3C,0X05,0X34,
+0X88,0X34,0XEB,0X34,0XCB,0X23,0X26,0X22,0XC3,0X2B,0XE6,0X2C,0XAA,0X34,0X89,0X34,
+0XA9,0X34,0XC9,0X34,0XA8,0X34,0X87,0X34,0XA9,0X2C,0XAA,0X34,0X89,0X2C,0XCA,0X34,
+0X89,0X34,0X47,0X34,0X88,0X34,0XEA,0X35,0X0B,0X3D,0X2D,0X3C,0XCA,0X3C,0X87,0X3C,
+0XA8,0X3C,0X67,0X33,0XA4,0X2B,0X24,0X2B,0XA6,0X2B,0XC7,0X2B,0XA6,0X33,0X63,0X22,
+0X42,0X22,0X83,0X11,0XC2,0X09,0X02,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X09,0X02,0X08,
+0XE2,0X80,0X09,0X02,0X00,0X09,0X22,0X80,0X09,0X02,0X00,0X08,0XA1,0XBA,0X00,0X61,
+0X00,0X08,0X82,0X85,0X08,0XC2,0X01,0X08,0XA2,0X08,0XA1,0X83,0X08,0XA2,0X00,0X08,
+0XA1,0X80,0X08,0XA2,0X00,0X00,0XA2,0X81,0X08,0XA2,0X80,0X08,0XA1,0X81,0X08,0X81,
+0X80,0X08,0XA1,0X03,0X08,0XA2,0X08,0XE2,0X08,0XC2,0X00,0XA2,0X81,0X08,0XA2,0X83,
+0X08,0X81,0X09,0X08,0XC2,0X11,0X62,0X11,0XE2,0X19,0XE2,0X11,0XE2,0X11,0XC2,0X11,
+0X82,0X09,0X22,0X08,0XC1,0X08,0X81,0X88,0X00,0X61,0X01,0X09,0X02,0X11,0XE3,0X80,
+0X1A,0X23,0X06,0X11,0XA2,0X09,0X02,0X08,0X81,0X00,0X61,0X08,0X81,0X08,0XC2,0X08,
+0XE2,0X80,0X09,0X02,0X80,0X08,0XE2,0X05,0X09,0X02,0X09,0X22,0X09,0X63,0X09,0X83,
+0X09,0X42,0X08,0XC2,0X81,0X00,0X61,0X00,0X00,0X81,0X81,0X08,0X81,0X80,0X08,0XA1,
+0X82,0X08,0X81,0X03,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X80,0X08,0XC1,0X80,
+0X08,0XE2,0X02,0X09,0X23,0X09,0X43,0X09,0X22,0X81,0X08,0XC2,0X01,0X08,0XA1,0X00,
+0X82,0X82,0X08,0X82,0X02,0X00,0X82,0X08,0X82,0X00,0X61,0X80,0X00,0X82,0X80,0X08,
+0X82,0X05,0X00,0X62,0X08,0X82,0X00,0X82,0X08,0X82,0X08,0XC2,0X09,0X42,0X80,0X09,
+0X62,0X01,0X09,0X42,0X09,0X22,0X80,0X09,0X02,0X00,0X09,0X22,0X80,0X09,0X42,0X02,
+0X09,0X22,0X08,0XE2,0X08,0XA1,0X80,0X00,0X81,0X8E,0X00,0X61,0X0B,0X08,0X81,0X11,
+0X22,0X22,0XC4,0X2C,0X08,0X2C,0X8A,0X24,0XAC,0X24,0XCC,0X2C,0X49,0X2C,0X28,0X23,
+0XC8,0X12,0X24,0X08,0XC2,0X86,0X00,0X61,0X02,0X2B,0X85,0X2B,0X44,0X2B,0XA6,0X80,
+0X24,0X29,0X0B,0X24,0X49,0X24,0X08,0X24,0X29,0X24,0X8C,0X24,0XCD,0X24,0XAC,0X24,
+0X4A,0X24,0X2A,0X1B,0X47,0X11,0XA3,0X08,0XC2,0X00,0X81,0X80,0X08,0X61,0X0A,0X00,
+0X61,0X11,0X63,0X2B,0XE7,0X3D,0X2B,0X45,0X6D,0X3D,0X4D,0X35,0X2B,0X34,0XC9,0X34,
+0XA8,0X3C,0X87,0X3C,0X45,0X80,0X3C,0X04,0X09,0X3B,0XC3,0X3B,0XE3,0X3C,0X46,0X34,
+0XA9,0X2C,0XCA,0X2C,0X08,0X11,0X63,0X11,0X42,0X22,0XC4,0X34,0X27,0X80,0X34,0XA9,
+0X15,0X34,0XCA,0X34,0X88,0X3C,0X46,0X34,0X67,0X34,0XA9,0X34,0X68,0X2C,0X89,0X34,
+0X89,0X2C,0X89,0X2C,0XAA,0X2C,0XEB,0X35,0X0C,0X55,0X8F,0X4D,0X0B,0X3C,0X45,0X44,
+0X44,0X3C,0X66,0X34,0X87,0X33,0XC5,0X2B,0X04,0X22,0XA3,0X22,0X82,0X80,0X22,0XA3,
+0X05,0X2B,0X24,0X22,0XA3,0X11,0X82,0X08,0XE2,0X08,0XC2,0X09,0X22,0X80,0X09,0X02,
+0X00,0X09,0X42,0X81,0X09,0X02,0X02,0X11,0XA3,0X09,0X02,0X08,0X61,0XB9,0X00,0X61,
+0X00,0X00,0X82,0X81,0X08,0XE2,0X82,0X08,0XC2,0X87,0X08,0XA2,0X80,0X08,0XC2,0X00,
+0X08,0XA2,0X83,0X08,0XA1,0X81,0X08,0X81,0X04,0X08,0XA1,0X08,0XA2,0X08,0XC2,0X08,
+0XE2,0X08,0XC2,0X81,0X08,0XA2,0X83,0X08,0X81,0X07,0X08,0XE2,0X11,0XA2,0X1A,0X22,
+0X1A,0X42,0X1A,0X02,0X11,0XA2,0X09,0X22,0X08,0XA1,0X8A,0X00,0X61,0X05,0X08,0XE2,
+0X11,0XE3,0X1A,0X84,0X1A,0X43,0X09,0X42,0X08,0X81,0X81,0X00,0X61,0X01,0X08,0XA2,
+0X08,0XE2,0X80,0X09,0X02,0X81,0X09,0X22,0X05,0X09,0X42,0X09,0X83,0X11,0XA3,0X09,
+0X63,0X08,0XE2,0X08,0X82,0X82,0X00,0X61,0X00,0X08,0X81,0X83,0X08,0XA1,0X81,0X08,
+0X81,0X02,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X81,0X08,0XC2,0X06,0X09,0X02,0X09,0X22,
+0X09,0X23,0X09,0X02,0X08,0XE2,0X08,0XC2,0X08,0XA1,0X80,0X00,0X81,0X00,0X08,0X82,
+0X81,0X00,0X82,0X00,0X08,0X82,0X80,0X00,0X82,0X01,0X08,0X82,0X00,0X61,0X80,0X08,
+0X82,0X00,0X00,0X62,0X80,0X00,0X61,0X04,0X08,0XA2,0X09,0X02,0X09,0X83,0X09,0X62,
+0X09,0X42,0X82,0X09,0X22,0X80,0X09,0X42,0X01,0X09,0X02,0X08,0XC2,0X80,0X08,0X81,
+0X90,0X00,0X61,0X0B,0X08,0X81,0X08,0XC2,0X1A,0X44,0X23,0XE8,0X24,0XAB,0X24,0XCD,
+0X1C,0XCD,0X1C,0X8C,0X24,0X4A,0X1B,0X27,0X09,0X43,0X08,0X81,0X86,0X00,0X61,0X15,
+0X2B,0XA6,0X2B,0X44,0X2B,0XE8,0X24,0X6A,0X24,0X4A,0X24,0X6B,0X24,0X6A,0X24,0X4A,
+0X24,0XAD,0X24,0X8B,0X23,0XE8,0X2B,0X86,0X23,0X66,0X1A,0X64,0X09,0X02,0X00,0X81,
+0X00,0X61,0X08,0X61,0X00,0X61,0X08,0XC2,0X1A,0XC5,0X2C,0X89,0X80,0X34,0XCA,0X05,
+0X34,0XCB,0X2C,0XEC,0X35,0X0C,0X34,0XC9,0X3C,0X87,0X3C,0X66,0X80,0X3C,0X25,0X05,
+0X3C,0X04,0X3C,0X25,0X34,0X88,0X2C,0XCA,0X34,0XCB,0X1B,0X06,0X80,0X08,0XA1,0X09,
+0X19,0XA2,0X2A,0XE3,0X34,0X06,0X34,0X88,0X34,0X67,0X3C,0X66,0X3C,0X05,0X3C,0X25,
+0X3C,0X67,0X3C,0X46,0X80,0X34,0X26,0X16,0X34,0X68,0X2C,0XA9,0X2C,0XCA,0X34,0XCB,
+0X4D,0X6E,0X55,0X8F,0X45,0X0A,0X3C,0XA8,0X34,0XA8,0X34,0XCA,0X34,0X88,0X2B,0XE6,
+0X23,0X45,0X23,0X24,0X23,0X04,0X2B,0X86,0X2B,0X45,0X2B,0X24,0X22,0X83,0X11,0XA2,
+0X09,0X22,0X09,0X02,0X08,0XC2,0X80,0X09,0X02,0X00,0X08,0XE2,0X80,0X09,0X02,0X01,
+0X09,0X63,0X09,0X02,0XBA,0X00,0X61,0X02,0X00,0XA2,0X08,0XE2,0X00,0XE2,0X83,0X08,
+0XE2,0X81,0X08,0XC2,0X80,0X08,0XA2,0X00,0X00,0XA2,0X81,0X08,0XA2,0X01,0X08,0XC2,
+0X08,0XA2,0X80,0X08,0XA1,0X00,0X08,0XA2,0X80,0X08,0XA1,0X01,0X08,0XA2,0X08,0XA1,
+0X82,0X08,0X81,0X81,0X08,0XC2,0X81,0X08,0XA2,0X00,0X08,0XA1,0X81,0X08,0X81,0X02,
+0X08,0XA1,0X09,0X22,0X1A,0X23,0X80,0X22,0XA3,0X02,0X19,0XE2,0X09,0X22,0X08,0XA1,
+0X8B,0X00,0X61,0X04,0X08,0XE2,0X12,0X24,0X1A,0XE5,0X12,0X24,0X08,0XE2,0X82,0X00,
+0X61,0X01,0X00,0X81,0X08,0XC2,0X80,0X09,0X22,0X81,0X09,0X42,0X01,0X09,0X82,0X11,
+0XA3,0X80,0X11,0XC3,0X01,0X09,0X42,0X08,0XA1,0X83,0X00,0X61,0X80,0X08,0X81,0X02,
+0X08,0XA2,0X08,0XA1,0X08,0XC1,0X80,0X08,0XA1,0X80,0X08,0X81,0X01,0X08,0XA1,0X08,
+0XC2,0X80,0X08,0XE2,0X07,0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X22,0X09,0X02,0X08,
+0XE2,0X08,0XA2,0X00,0X81,0X80,0X00,0X61,0X02,0X00,0X62,0X00,0X82,0X00,0XA2,0X80,
+0X08,0X82,0X80,0X00,0XA2,0X01,0X08,0X82,0X00,0X61,0X80,0X08,0X82,0X00,0X00,0X61,
+0X80,0X08,0X82,0X04,0X08,0XC2,0X09,0X42,0X09,0XA3,0X09,0X82,0X09,0X42,0X80,0X09,
+0X22,0X00,0X09,0X42,0X80,0X09,0X22,0X02,0X08,0XE2,0X08,0XA2,0X08,0X81,0X93,0X00,
+0X61,0X09,0X08,0X82,0X11,0XC3,0X23,0X66,0X24,0X49,0X24,0X6B,0X1C,0XAC,0X1C,0XAD,
+0X1C,0X0A,0X12,0X65,0X08,0XC2,0X87,0X00,0X61,0X04,0X2B,0XC6,0X2B,0X45,0X24,0X08,
+0X24,0X2A,0X24,0X29,0X80,0X24,0X49,0X07,0X24,0X6A,0X1C,0XAC,0X24,0X6B,0X23,0X87,
+0X2B,0X44,0X22,0XA3,0X11,0X82,0X08,0XA1,0X81,0X00,0X61,0X37,0X08,0X61,0X11,0X63,
+0X2C,0X08,0X2C,0X88,0X34,0X46,0X3C,0X46,0X3C,0X67,0X34,0XC9,0X2C,0XEB,0X2C,0XCA,
+0X34,0X87,0X3C,0X25,0X3C,0X05,0X34,0X46,0X34,0X47,0X34,0X88,0X34,0XCA,0X34,0XEA,
+0X34,0X69,0X1A,0X24,0X08,0X61,0X00,0X61,0X08,0XA2,0X19,0XA2,0X2B,0X03,0X3C,0X04,
+0X3C,0X25,0X3C,0X45,0X3C,0X25,0X3C,0X46,0X3C,0X87,0X3C,0X46,0X3C,0X25,0X34,0X26,
+0X34,0X48,0X2C,0X89,0X2C,0X69,0X2C,0X8A,0X45,0X6F,0X55,0XAF,0X55,0X8F,0X45,0X6E,
+0X3D,0X4D,0X34,0XEA,0X2C,0XA9,0X34,0X27,0X2B,0X86,0X23,0X65,0X2B,0XA6,0X23,0XA6,
+0X2B,0XA5,0X2B,0X86,0X2B,0X45,0X22,0XC3,0X1A,0X63,0X11,0XA3,0X80,0X08,0XC2,0X80,
+0X08,0XE2,0X04,0X09,0X43,0X09,0X02,0X08,0XE2,0X08,0XC2,0X08,0X82,0XB9,0X00,0X61,
+0X03,0X08,0XA2,0X00,0XE2,0X01,0X03,0X09,0X02,0X81,0X08,0XE2,0X01,0X09,0X02,0X08,
+0XE2,0X81,0X08,0XC2,0X82,0X08,0XA2,0X80,0X08,0XC2,0X83,0X08,0XA1,0X02,0X08,0XA2,
+0X08,0XA1,0X08,0XA2,0X80,0X08,0XA1,0X80,0X08,0X81,0X02,0X00,0XA2,0X08,0XE2,0X08,
+0XC2,0X81,0X08,0XA2,0X80,0X08,0X81,0X80,0X08,0XA1,0X06,0X08,0XC2,0X11,0XC3,0X23,
+0X04,0X2B,0X45,0X22,0XA3,0X11,0X82,0X08,0XA1,0X8C,0X00,0X61,0X05,0X08,0XE2,0X1A,
+0X44,0X1A,0XC5,0X11,0XC3,0X08,0XA2,0X08,0X61,0X82,0X00,0X61,0X03,0X08,0XA1,0X09,
+0X02,0X09,0X42,0X09,0X62,0X80,0X09,0X42,0X01,0X09,0X83,0X11,0XA3,0X80,0X11,0XE3,
+0X01,0X09,0X62,0X08,0XA1,0X84,0X00,0X61,0X80,0X00,0X81,0X00,0X08,0XA2,0X81,0X08,
+0XC2,0X81,0X08,0XA1,0X01,0X08,0XA2,0X08,0XC2,0X83,0X08,0XE2,0X02,0X09,0X02,0X08,
+0XC2,0X00,0XA1,0X80,0X00,0X61,0X00,0X00,0X81,0X82,0X08,0X82,0X00,0X00,0X81,0X80,
+0X08,0XA2,0X81,0X08,0X82,0X00,0X00,0X61,0X80,0X08,0X82,0X03,0X08,0XA2,0X09,0X02,
+0X09,0X82,0X11,0XA2,0X80,0X09,0X62,0X80,0X09,0X42,0X03,0X09,0X22,0X08,0XE2,0X08,
+0XC2,0X08,0X82,0X95,0X00,0X61,0X04,0X08,0X81,0X11,0X42,0X22,0XC4,0X2B,0X86,0X24,
+0X08,0X80,0X1C,0X6C,0X02,0X1B,0XA9,0X11,0XC4,0X08,0X81,0X87,0X00,0X61,0X04,0X2B,
+0XE7,0X23,0X45,0X23,0XE8,0X24,0X28,0X2C,0X07,0X80,0X2B,0XE7,0X06,0X24,0X49,0X1C,
+0X8C,0X24,0X8C,0X24,0X08,0X2B,0X86,0X22,0XA4,0X09,0X02,0X82,0X00,0X61,0X07,0X08,
+0X61,0X11,0XE3,0X2C,0X69,0X34,0X89,0X3C,0X05,0X44,0X03,0X44,0X24,0X3C,0X46,0X80,
+0X34,0XA9,0X09,0X34,0X67,0X33,0XE5,0X3C,0X05,0X34,0X26,0X34,0X68,0X34,0X89,0X34,
+0XA8,0X3C,0X87,0X33,0XC5,0X11,0X42,0X80,0X00,0X61,0X04,0X08,0X61,0X08,0XC1,0X19,
+0XC2,0X33,0X63,0X3C,0X04,0X80,0X3C,0X87,0X00,0X3C,0X67,0X80,0X34,0X67,0X00,0X34,
+0X46,0X80,0X34,0X47,0X80,0X2C,0X89,0X0D,0X2C,0XAA,0X35,0X2D,0X35,0X2E,0X3D,0X4E,
+0X45,0X2D,0X3D,0X2C,0X2C,0XAA,0X2C,0X89,0X2B,0XE7,0X23,0X45,0X22,0XE4,0X2B,0X24,
+0X2B,0X86,0X2B,0XA6,0X80,0X2C,0X07,0X05,0X2B,0X85,0X2B,0X65,0X1A,0XC4,0X08,0XE2,
+0X08,0XC2,0X08,0XE2,0X81,0X09,0X02,0X80,0X08,0XE2,0X02,0X00,0X81,0X00,0X61,0X08,
+0X61,0XB7,0X00,0X61,0X08,0X08,0XA2,0X08,0XC2,0X01,0X03,0X01,0X22,0X08,0XE2,0X08,
+0XA2,0X08,0XE2,0X09,0X02,0X08,0XE2,0X80,0X08,0XC2,0X00,0X08,0XA2,0X80,0X08,0XA1,
+0X00,0X08,0XC1,0X81,0X08,0XE2,0X81,0X08,0XA1,0X02,0X08,0XA2,0X00,0XA2,0X00,0XA1,
+0X82,0X08,0X81,0X80,0X00,0X61,0X00,0X08,0XC2,0X80,0X08,0XE2,0X83,0X08,0XA2,0X80,
+0X08,0XA1,0X06,0X09,0X42,0X1A,0XA4,0X2B,0XA6,0X23,0X45,0X1A,0X03,0X08,0XE2,0X08,
+0X61,0X8C,0X00,0X61,0X00,0X08,0XE2,0X80,0X12,0X24,0X02,0X09,0X22,0X00,0X61,0X08,
+0X61,0X83,0X00,0X61,0X0A,0X08,0XC1,0X09,0X22,0X11,0X82,0X11,0XA3,0X09,0X62,0X11,
+0X82,0X11,0XC3,0X11,0XE3,0X11,0XC3,0X09,0X62,0X08,0XC1,0X86,0X00,0X61,0X80,0X08,
+0X81,0X80,0X08,0XA1,0X81,0X08,0XC2,0X80,0X08,0XA2,0X84,0X08,0XE2,0X01,0X08,0XC2,
+0X00,0X81,0X80,0X00,0X61,0X80,0X00,0X82,0X01,0X08,0X82,0X08,0XA2,0X80,0X08,0X82,
+0X0A,0X00,0XA2,0X08,0X82,0X00,0X82,0X00,0X62,0X08,0X82,0X08,0X81,0X00,0X81,0X00,
+0X82,0X08,0XA2,0X09,0X22,0X11,0X82,0X80,0X11,0X62,0X05,0X09,0X62,0X09,0X42,0X09,
+0X22,0X08,0XE2,0X08,0XA2,0X08,0X81,0X95,0X00,0X61,0X0A,0X08,0X61,0X08,0X81,0X08,
+0XE2,0X1A,0X23,0X2B,0X24,0X2B,0XC7,0X1C,0X6B,0X24,0X2B,0X12,0XC7,0X09,0X22,0X08,
+0X61,0X87,0X00,0X61,0X04,0X2B,0XA6,0X2B,0X24,0X2B,0X64,0X2B,0X85,0X33,0X63,0X80,
+0X33,0X83,0X06,0X2C,0X08,0X24,0X8B,0X1C,0X6C,0X24,0X09,0X1B,0X06,0X11,0XA3,0X00,
+0X81,0X83,0X00,0X61,0X12,0X11,0XE3,0X2C,0X69,0X34,0XEC,0X34,0XA9,0X3C,0X25,0X3C,
+0X03,0X3C,0X45,0X34,0XA8,0X34,0X68,0X34,0X47,0X34,0X26,0X34,0X46,0X34,0X47,0X34,
+0X46,0X3C,0X67,0X3C,0X66,0X3C,0X46,0X22,0XC4,0X08,0XA2,0X82,0X00,0X61,0X19,0X08,
+0XA2,0X11,0X62,0X22,0X43,0X22,0XC4,0X2B,0XA6,0X2C,0X89,0X34,0XEB,0X2C,0XA9,0X34,
+0X68,0X3C,0X46,0X3C,0X25,0X3C,0X26,0X34,0X68,0X2C,0X89,0X2C,0XA9,0X2C,0XCA,0X2C,
+0XCB,0X34,0XEB,0X35,0X0B,0X34,0XCA,0X34,0X88,0X2B,0XC6,0X23,0X24,0X22,0XE4,0X22,
+0XC3,0X2B,0X24,0X80,0X2B,0X44,0X05,0X2B,0X85,0X2B,0XA5,0X2B,0XC6,0X2B,0X45,0X11,
+0XA3,0X09,0X02,0X83,0X08,0XE2,0X01,0X08,0XC2,0X08,0X81,0XB9,0X00,0X61,0X01,0X00,
+0X82,0X08,0XC2,0X80,0X09,0X02,0X84,0X08,0XE2,0X80,0X08,0XC1,0X81,0X08,0XC2,0X80,
+0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,0XA1,0X00,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,
+0X81,0X83,0X00,0X61,0X01,0X00,0X81,0X00,0XC2,0X80,0X09,0X02,0X01,0X08,0XE2,0X08,
+0XC2,0X81,0X08,0XA2,0X07,0X08,0XA1,0X08,0XE2,0X11,0XE3,0X23,0X45,0X2B,0X45,0X1A,
+0X43,0X09,0X02,0X00,0X81,0X8D,0X00,0X61,0X03,0X08,0XC2,0X11,0XC2,0X11,0X82,0X08,
+0XA1,0X85,0X00,0X61,0X03,0X08,0X81,0X08,0XC2,0X11,0X62,0X11,0XA3,0X80,0X09,0X82,
+0X00,0X11,0XA2,0X80,0X11,0XC3,0X01,0X09,0X62,0X08,0XC1,0X89,0X00,0X61,0X01,0X00,
+0X62,0X00,0XA2,0X80,0X08,0XC2,0X00,0X08,0XE1,0X80,0X08,0XC2,0X80,0X08,0XE2,0X80,
+0X08,0XC2,0X02,0X08,0XA2,0X00,0XA2,0X00,0X81,0X80,0X00,0X61,0X05,0X08,0X82,0X00,
+0X81,0X08,0XA1,0X00,0XA2,0X08,0XA2,0X00,0X82,0X81,0X08,0X82,0X80,0X00,0X82,0X00,
+0X08,0X82,0X80,0X00,0X82,0X02,0X08,0XE2,0X09,0X62,0X11,0X82,0X80,0X09,0X62,0X04,
+0X09,0X42,0X09,0X02,0X08,0XC2,0X08,0XA2,0X08,0X81,0X98,0X00,0X61,0X07,0X08,0XA1,
+0X11,0XA2,0X22,0XE4,0X23,0XC7,0X24,0X2A,0X23,0XA8,0X11,0XE4,0X08,0XA2,0X88,0X00,
+0X61,0X0C,0X2B,0X24,0X22,0XC3,0X22,0XC2,0X2B,0X02,0X33,0X43,0X33,0X83,0X33,0X63,
+0X2B,0XE6,0X24,0X09,0X1B,0X68,0X12,0X65,0X11,0X63,0X08,0X82,0X84,0X00,0X61,0X0A,
+0X11,0X83,0X24,0X29,0X3D,0X2E,0X45,0X4E,0X3C,0XEB,0X3C,0X88,0X34,0X88,0X34,0X68,
+0X34,0X47,0X34,0X67,0X34,0X26,0X80,0X34,0X47,0X05,0X34,0X05,0X3C,0X26,0X3C,0X67,
+0X34,0X26,0X11,0XC3,0X08,0X61,0X83,0X00,0X61,0X0E,0X08,0X61,0X08,0X81,0X08,0XA1,
+0X11,0XA3,0X23,0X88,0X2C,0X8B,0X2C,0XCB,0X2C,0X89,0X3C,0X46,0X3C,0X25,0X3C,0X04,
+0X3C,0X25,0X3C,0X46,0X34,0X67,0X34,0X88,0X80,0X2C,0XCA,0X04,0X34,0XCA,0X34,0XEA,
+0X34,0XA9,0X2C,0X07,0X2B,0X45,0X80,0X2B,0X65,0X80,0X2B,0X24,0X08,0X2B,0X04,0X23,
+0X04,0X2B,0X24,0X2B,0X44,0X2B,0X85,0X1A,0XE5,0X11,0XA3,0X08,0XE2,0X08,0XC2,0X81,
+0X08,0XE2,0X01,0X08,0XC2,0X00,0X81,0XB9,0X00,0X61,0X06,0X00,0X81,0X08,0XC2,0X08,
+0XE2,0X09,0X02,0X09,0X23,0X01,0X23,0X09,0X02,0X81,0X08,0XE2,0X80,0X08,0XC2,0X80,
+0X08,0XE2,0X80,0X08,0XC2,0X01,0X08,0XC1,0X08,0XA1,0X82,0X08,0XC2,0X00,0X00,0XA2,
+0X85,0X00,0X61,0X00,0X08,0XA2,0X80,0X09,0X02,0X01,0X08,0XE2,0X08,0XC2,0X81,0X08,
+0XA2,0X06,0X08,0XC2,0X11,0X42,0X1A,0XA4,0X23,0X25,0X1A,0X43,0X11,0X42,0X08,0X82,
+0X8E,0X00,0X61,0X03,0X08,0XA1,0X09,0X22,0X08,0XE1,0X08,0X81,0X86,0X00,0X61,0X09,
+0X00,0X81,0X08,0XE2,0X09,0X62,0X11,0XA3,0X11,0X82,0X09,0X82,0X11,0XA3,0X11,0XE3,
+0X11,0XC3,0X09,0X02,0X8B,0X00,0X61,0X01,0X08,0X81,0X08,0XA1,0X81,0X08,0XC2,0X00,
+0X08,0XE2,0X80,0X08,0XC2,0X01,0X08,0XA1,0X08,0X81,0X80,0X00,0X81,0X81,0X00,0X61,
+0X00,0X08,0X81,0X80,0X08,0XA2,0X04,0X00,0XA2,0X00,0X82,0X08,0X82,0X00,0X62,0X08,
+0X82,0X81,0X00,0X82,0X0A,0X08,0X82,0X08,0XC2,0X09,0X42,0X09,0X82,0X11,0X82,0X09,
+0X62,0X09,0X42,0X09,0X02,0X08,0XC2,0X08,0X82,0X00,0X81,0X99,0X00,0X61,0X06,0X08,
+0X81,0X11,0X42,0X1A,0XA3,0X23,0XA6,0X23,0XC7,0X1A,0XC5,0X09,0X42,0X89,0X00,0X61,
+0X03,0X22,0XA3,0X22,0X62,0X22,0X82,0X2A,0XE3,0X80,0X33,0X84,0X05,0X2B,0X04,0X22,
+0XC5,0X1A,0X64,0X11,0X83,0X08,0XC2,0X08,0X81,0X85,0X00,0X61,0X07,0X11,0X22,0X23,
+0X87,0X3C,0XEC,0X4D,0X4E,0X4D,0X6F,0X3D,0X2D,0X2C,0XEB,0X2C,0X89,0X80,0X34,0X88,
+0X80,0X34,0X47,0X05,0X34,0X68,0X34,0X26,0X34,0X47,0X34,0X68,0X23,0X66,0X09,0X02,
+0X86,0X00,0X61,0X03,0X08,0X61,0X08,0XA1,0X11,0XC4,0X23,0X87,0X80,0X2C,0XAA,0X09,
+0X34,0X67,0X3C,0X25,0X44,0X03,0X3B,0XE3,0X3B,0XE4,0X3C,0X25,0X3C,0X67,0X34,0XCA,
+0X35,0X0C,0X34,0XEB,0X80,0X34,0XE9,0X0E,0X34,0X68,0X2B,0XC6,0X2B,0XE6,0X2C,0X07,
+0X2B,0X45,0X2B,0X24,0X2B,0X45,0X23,0X04,0X2B,0X03,0X2B,0X44,0X2B,0X86,0X23,0XA7,
+0X1B,0X05,0X11,0XA3,0X08,0XC1,0X81,0X08,0XC2,0X00,0X08,0X81,0XBB,0X00,0X61,0X05,
+0X08,0XA2,0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X23,0X01,0X02,0X86,0X08,0XE2,0X81,
+0X08,0XC2,0X81,0X08,0XE2,0X01,0X08,0XC2,0X00,0X82,0X85,0X00,0X61,0X00,0X08,0XA2,
+0X81,0X08,0XE2,0X00,0X08,0XC2,0X81,0X08,0XA2,0X05,0X08,0XC2,0X11,0X82,0X1A,0X84,
+0X1A,0X43,0X11,0X42,0X08,0XA1,0X8F,0X00,0X61,0X02,0X08,0X81,0X08,0XA1,0X08,0X81,
+0X88,0X00,0X61,0X01,0X08,0X81,0X09,0X02,0X80,0X11,0XA3,0X05,0X09,0X82,0X11,0X83,
+0X12,0X03,0X12,0X24,0X11,0X63,0X08,0X81,0X8D,0X00,0X61,0X01,0X08,0X81,0X08,0XA2,
+0X81,0X08,0XC2,0X00,0X00,0XA2,0X80,0X08,0X81,0X81,0X00,0X81,0X01,0X00,0X62,0X08,
+0X81,0X81,0X08,0XA2,0X80,0X08,0X82,0X01,0X00,0X61,0X00,0X62,0X81,0X00,0X82,0X01,
+0X08,0XA2,0X09,0X02,0X80,0X09,0X62,0X05,0X11,0X82,0X09,0X62,0X09,0X22,0X08,0XC2,
+0X00,0X81,0X00,0X62,0X9A,0X00,0X61,0X06,0X08,0X61,0X09,0X02,0X1A,0X43,0X2B,0X45,
+0X23,0X65,0X1A,0X23,0X08,0XE2,0X89,0X00,0X61,0X09,0X22,0X42,0X1A,0X42,0X1A,0X22,
+0X1A,0X63,0X22,0X84,0X19,0XE3,0X09,0X22,0X09,0X02,0X08,0XC2,0X00,0X81,0X87,0X00,
+0X61,0X0A,0X08,0XC2,0X1A,0XE6,0X34,0X8B,0X4D,0X4E,0X4D,0X6F,0X3D,0X2D,0X35,0X0C,
+0X34,0XEB,0X2C,0XCA,0X2C,0X89,0X34,0X27,0X80,0X34,0X47,0X04,0X34,0X89,0X2C,0XAA,
+0X24,0X49,0X1A,0X65,0X08,0X81,0X83,0X00,0X61,0X00,0X08,0X61,0X82,0X00,0X61,0X12,
+0X08,0XA2,0X11,0XA3,0X23,0X67,0X2C,0X6A,0X2C,0XCA,0X34,0X88,0X44,0X44,0X3C,0X03,
+0X3B,0XC3,0X3C,0X04,0X3C,0X45,0X34,0X67,0X34,0XC9,0X35,0X0A,0X34,0XEA,0X35,0X0A,
+0X34,0XA8,0X34,0X06,0X23,0X24,0X80,0X22,0XE4,0X00,0X23,0X04,0X80,0X23,0XA6,0X80,
+0X2B,0XA6,0X80,0X23,0XC8,0X05,0X1B,0XA8,0X1A,0X65,0X08,0XE2,0X08,0XC1,0X08,0XC2,
+0X08,0X82,0XBC,0X00,0X61,0X01,0X00,0X81,0X08,0XC2,0X8C,0X08,0XE2,0X04,0X09,0X02,
+0X09,0X43,0X09,0X23,0X08,0XE2,0X00,0XA2,0X86,0X00,0X61,0X00,0X08,0XC2,0X81,0X08,
+0XE2,0X01,0X08,0XC2,0X08,0XC1,0X80,0X08,0XC2,0X06,0X08,0XE2,0X09,0X62,0X11,0XC2,
+0X11,0X42,0X08,0XC2,0X00,0X61,0X08,0X61,0X9C,0X00,0X61,0X02,0X08,0XA1,0X09,0X22,
+0X09,0X82,0X80,0X09,0X83,0X03,0X11,0XE3,0X12,0X24,0X11,0XA3,0X08,0XA2,0X8F,0X00,
+0X61,0X03,0X00,0X81,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X80,0X08,0X81,0X80,0X00,0X81,
+0X80,0X00,0X82,0X00,0X08,0X82,0X81,0X08,0XA2,0X04,0X00,0X82,0X08,0X82,0X00,0X61,
+0X08,0X82,0X08,0X81,0X80,0X08,0X82,0X02,0X08,0XE2,0X09,0X42,0X11,0X62,0X80,0X09,
+0X62,0X03,0X09,0X42,0X08,0XC2,0X08,0XA2,0X08,0X81,0X99,0X00,0X61,0X04,0X08,0X61,
+0X00,0X61,0X08,0X61,0X08,0XC2,0X11,0XC2,0X80,0X22,0XC4,0X01,0X11,0XA2,0X08,0XA1,
+0X89,0X00,0X61,0X05,0X22,0X42,0X1A,0X02,0X11,0XC2,0X09,0X62,0X09,0X22,0X08,0XA1,
+0X8B,0X00,0X61,0X04,0X08,0XA2,0X1A,0X64,0X34,0X49,0X4D,0X0C,0X4D,0X4D,0X80,0X3D,
+0X0C,0X0A,0X45,0X2D,0X35,0X0C,0X2C,0X89,0X34,0X27,0X34,0X06,0X2C,0X69,0X2C,0XEC,
+0X24,0XEC,0X23,0XA8,0X09,0X63,0X08,0X61,0X83,0X00,0X61,0X00,0X08,0X61,0X83,0X00,
+0X61,0X07,0X08,0X81,0X09,0X22,0X1A,0X45,0X23,0XA7,0X2C,0X48,0X3C,0X66,0X3C,0X24,
+0X3C,0X04,0X80,0X3B,0XC3,0X06,0X3C,0X04,0X3C,0X45,0X3C,0X87,0X3D,0X0A,0X35,0X2A,
+0X3C,0XA8,0X33,0XE6,0X80,0X22,0XE4,0X0A,0X23,0X25,0X23,0X65,0X23,0XA7,0X23,0XE8,
+0X24,0X09,0X24,0X0A,0X1C,0X6C,0X1C,0X4C,0X1B,0XC9,0X1A,0XA5,0X09,0X22,0X80,0X08,
+0XA2,0X00,0X08,0X81,0X89,0X00,0X61,0X02,0X00,0X81,0X08,0X81,0X00,0X81,0X83,0X00,
+0X61,0X00,0X00,0X81,0XA8,0X00,0X61,0X01,0X00,0X81,0X08,0XC2,0X81,0X08,0XE2,0X00,
+0X09,0X02,0X83,0X08,0XE2,0X00,0X09,0X02,0X81,0X08,0XE2,0X05,0X09,0X02,0X09,0X63,
+0X09,0X84,0X01,0X23,0X00,0XA2,0X00,0X81,0X86,0X00,0X61,0X00,0X08,0XC2,0X80,0X08,
+0XE2,0X81,0X08,0XC2,0X81,0X08,0XE2,0X02,0X09,0X22,0X09,0X02,0X08,0XC2,0XA0,0X00,
+0X61,0X07,0X00,0XA2,0X09,0X43,0X11,0XA3,0X11,0XA2,0X11,0XC3,0X12,0X03,0X11,0X83,
+0X08,0XC1,0X92,0X00,0X61,0X00,0X08,0X81,0X80,0X00,0X82,0X80,0X00,0X61,0X03,0X00,
+0X81,0X00,0X82,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,0X80,0X08,0X82,0X05,0X00,0X61,
+0X00,0X82,0X00,0X61,0X08,0X82,0X08,0XA2,0X09,0X22,0X80,0X11,0X82,0X04,0X09,0X62,
+0X09,0X42,0X09,0X02,0X08,0XA2,0X08,0X82,0X9B,0X00,0X61,0X07,0X08,0X61,0X00,0X61,
+0X08,0X81,0X11,0X22,0X1A,0X03,0X1A,0X22,0X09,0X22,0X08,0X81,0X89,0X00,0X61,0X05,
+0X1A,0X43,0X11,0XC2,0X11,0X62,0X08,0XE2,0X08,0X82,0X08,0X61,0X8B,0X00,0X61,0X10,
+0X08,0XA2,0X1A,0X84,0X2C,0X08,0X3C,0X8A,0X44,0XCB,0X44,0XEC,0X45,0X2C,0X3D,0X2D,
+0X3D,0X2C,0X2C,0X8A,0X34,0X47,0X2C,0X48,0X2C,0XEB,0X25,0X0D,0X24,0X2A,0X12,0X45,
+0X08,0XA2,0X8A,0X00,0X61,0X09,0X00,0X81,0X08,0X61,0X08,0XA1,0X11,0X42,0X1A,0X03,
+0X22,0XA3,0X2B,0X24,0X3C,0X04,0X3C,0X24,0X3B,0XE4,0X80,0X3B,0XC3,0X14,0X3C,0X03,
+0X3C,0X86,0X34,0XE9,0X3C,0X87,0X33,0XC5,0X2B,0X04,0X22,0XE4,0X23,0X45,0X23,0X66,
+0X23,0XC8,0X23,0XE9,0X1C,0X4B,0X1C,0X6C,0X1C,0X8D,0X1C,0X2B,0X1B,0X48,0X1A,0X64,
+0X09,0X22,0X08,0XA2,0X08,0XA1,0X08,0X61,0X88,0X00,0X61,0X81,0X08,0X81,0X84,0X00,
+0X61,0X80,0X08,0X81,0XA7,0X00,0X61,0X01,0X00,0X81,0X08,0XC2,0X81,0X08,0XE2,0X00,
+0X09,0X02,0X82,0X08,0XE2,0X08,0X09,0X02,0X08,0XE2,0X09,0X02,0X09,0X22,0X01,0X22,
+0X09,0X43,0X09,0X63,0X01,0X43,0X00,0XA2,0X88,0X00,0X61,0X01,0X08,0XC2,0X09,0X02,
+0X85,0X08,0XE2,0X02,0X08,0XC2,0X08,0XA2,0X00,0X81,0XA0,0X00,0X61,0X02,0X00,0X81,
+0X09,0X02,0X11,0XA3,0X80,0X11,0XC3,0X02,0X12,0X03,0X11,0XA3,0X08,0XC2,0X93,0X00,
+0X61,0X02,0X00,0X81,0X00,0XA2,0X00,0X81,0X81,0X00,0X61,0X00,0X00,0XA2,0X80,0X08,
+0XA2,0X00,0X00,0X82,0X81,0X08,0X82,0X80,0X08,0X81,0X07,0X08,0X82,0X08,0XC2,0X09,
+0X42,0X11,0XA3,0X11,0XC3,0X11,0X83,0X09,0X22,0X08,0XA2,0X80,0X00,0X82,0X00,0X00,
+0X62,0X99,0X00,0X61,0X00,0X08,0X61,0X81,0X00,0X61,0X00,0X08,0XE1,0X80,0X11,0X82,
+0X01,0X08,0XC2,0X08,0X61,0X89,0X00,0X61,0X03,0X11,0XC2,0X09,0X42,0X08,0XC2,0X00,
+0X81,0X82,0X00,0X61,0X00,0X08,0X61,0X88,0X00,0X61,0X06,0X08,0XA1,0X1A,0X43,0X2B,
+0XC7,0X3C,0X49,0X44,0XAB,0X44,0XEC,0X45,0X2D,0X80,0X4D,0X4E,0X06,0X3C,0XEC,0X2C,
+0XCA,0X2C,0XAA,0X2C,0XCC,0X24,0XAB,0X1B,0X27,0X09,0X22,0X8E,0X00,0X61,0X80,0X08,
+0X81,0X05,0X08,0XA1,0X11,0X21,0X22,0X63,0X33,0X84,0X3B,0XE4,0X3B,0XE3,0X80,0X3B,
+0XC3,0X07,0X3C,0X04,0X3C,0XA8,0X34,0XE9,0X34,0X47,0X2B,0X85,0X23,0X04,0X23,0X45,
+0X23,0X86,0X80,0X23,0XA7,0X08,0X1C,0X2A,0X1C,0XAE,0X1C,0X6D,0X1C,0X2B,0X1B,0X47,
+0X12,0X24,0X09,0X02,0X08,0XA2,0X08,0X82,0X91,0X00,0X61,0X01,0X00,0X81,0X08,0X81,
+0XA8,0X00,0X61,0X01,0X00,0X82,0X08,0XC2,0X87,0X08,0XE2,0X01,0X09,0X02,0X09,0X23,
+0X81,0X09,0X43,0X02,0X00,0XE3,0X00,0XA2,0X00,0X81,0X87,0X00,0X61,0X01,0X00,0X81,
+0X00,0XE2,0X80,0X09,0X02,0X80,0X08,0XE2,0X80,0X09,0X02,0X00,0X08,0XE2,0X80,0X08,
+0XC2,0X00,0X00,0X81,0XA2,0X00,0X61,0X01,0X08,0XC2,0X09,0X63,0X80,0X11,0XE3,0X02,
+0X12,0X24,0X11,0XE3,0X08,0XE2,0X98,0X00,0X61,0X00,0X00,0X81,0X80,0X00,0XA2,0X00,
+0X08,0XA2,0X84,0X08,0X82,0X02,0X08,0XA2,0X09,0X02,0X11,0XA3,0X80,0X11,0XE3,0X05,
+0X09,0X63,0X08,0XC2,0X08,0X82,0X00,0X81,0X08,0X82,0X00,0X62,0X9D,0X00,0X61,0X03,
+0X08,0XA1,0X11,0X01,0X09,0X02,0X08,0X81,0X8A,0X00,0X61,0X02,0X09,0X42,0X08,0XE2,
+0X08,0X81,0X8E,0X00,0X61,0X0A,0X08,0X81,0X11,0X82,0X23,0X86,0X34,0X8A,0X44,0XCB,
+0X45,0X0C,0X4D,0X4E,0X55,0X6F,0X4D,0X6F,0X45,0X2D,0X3C,0XEB,0X80,0X2C,0XAA,0X04,
+0X2C,0X49,0X1A,0X85,0X08,0XC2,0X00,0X61,0X08,0X61,0X8C,0X00,0X61,0X00,0X08,0X81,
+0X80,0X00,0X61,0X0E,0X08,0X61,0X08,0XC1,0X11,0X62,0X22,0X64,0X2B,0X44,0X3B,0XC4,
+0X3B,0XA3,0X3B,0XC3,0X3C,0X45,0X34,0XC9,0X3C,0XA8,0X33,0XE5,0X2B,0X04,0X22,0XC4,
+0X23,0X45,0X80,0X2B,0X65,0X08,0X23,0XE8,0X1C,0X6C,0X1C,0X8D,0X1C,0X6C,0X1B,0X68,
+0X1A,0X44,0X09,0X22,0X08,0XA2,0X00,0X81,0X90,0X00,0X61,0X80,0X08,0X81,0XA9,0X00,
+0X61,0X01,0X00,0X82,0X00,0XC2,0X80,0X09,0X02,0X84,0X08,0XE2,0X01,0X09,0X02,0X09,
+0X43,0X80,0X09,0X63,0X02,0X01,0X23,0X00,0XE3,0X00,0XA2,0X89,0X00,0X61,0X03,0X00,
+0XA2,0X09,0X02,0X09,0X22,0X09,0X02,0X80,0X08,0XE2,0X80,0X09,0X02,0X02,0X08,0XC2,
+0X08,0XA1,0X08,0X81,0XA1,0X00,0X61,0X00,0X08,0X61,0X80,0X00,0X61,0X05,0X09,0X02,
+0X11,0XC3,0X11,0XE3,0X12,0X03,0X11,0XE3,0X09,0X02,0X98,0X00,0X61,0X02,0X00,0X82,
+0X08,0XA2,0X00,0XA2,0X83,0X08,0X82,0X03,0X00,0X62,0X08,0X82,0X08,0XE2,0X11,0X62,
+0X80,0X12,0X03,0X04,0X09,0X83,0X09,0X02,0X08,0XA2,0X08,0X82,0X08,0X81,0X9F,0X00,
+0X61,0X00,0X08,0X81,0X80,0X08,0XC1,0X00,0X00,0X81,0X8A,0X00,0X61,0X02,0X08,0XE2,
+0X08,0XA1,0X08,0X61,0X8D,0X00,0X61,0X80,0X08,0X61,0X10,0X11,0X42,0X23,0X86,0X34,
+0XCA,0X3C,0XEC,0X4D,0X2D,0X55,0X6F,0X5D,0XB0,0X4D,0X6F,0X3C,0XEC,0X34,0XAB,0X34,
+0XCB,0X2C,0XCA,0X23,0XC8,0X11,0XC3,0X08,0X81,0X00,0X61,0X08,0X61,0X90,0X00,0X61,
+0X04,0X08,0X61,0X08,0X81,0X08,0XC2,0X19,0XC2,0X2B,0X24,0X80,0X3B,0XC3,0X10,0X3B,
+0XE3,0X3C,0X25,0X3C,0X66,0X3C,0X45,0X2B,0X44,0X22,0XA3,0X22,0XC3,0X2B,0X44,0X2B,
+0X85,0X2B,0XA6,0X23,0XC8,0X24,0X2A,0X1C,0X6B,0X1B,0X88,0X1A,0X84,0X09,0X22,0X08,
+0XA2,0X91,0X00,0X61,0X01,0X08,0X81,0X00,0X81,0XA9,0X00,0X61,0X06,0X00,0X82,0X08,
+0XC2,0X09,0X03,0X09,0X22,0X08,0XE2,0X09,0X02,0X09,0X03,0X80,0X08,0XE2,0X80,0X09,
+0X22,0X80,0X09,0X43,0X02,0X01,0X03,0X00,0XC2,0X00,0X82,0X8A,0X00,0X61,0X00,0X08,
+0XC2,0X80,0X09,0X22,0X00,0X09,0X02,0X80,0X08,0XE2,0X02,0X09,0X02,0X08,0XE2,0X08,
+0X82,0XA6,0X00,0X61,0X05,0X08,0XC2,0X09,0XA3,0X12,0X24,0X11,0XE3,0X11,0XA3,0X09,
+0X02,0X98,0X00,0X61,0X00,0X00,0XA2,0X80,0X08,0XA2,0X02,0X00,0X81,0X00,0X62,0X08,
+0X81,0X81,0X08,0X82,0X08,0X08,0XA2,0X09,0X22,0X11,0XE3,0X1A,0X23,0X11,0XC3,0X09,
+0X02,0X08,0XA2,0X08,0X82,0X00,0X81,0XA1,0X00,0X61,0X80,0X00,0X81,0X8B,0X00,0X61,
+0X00,0X08,0XA2,0X8F,0X00,0X61,0X80,0X08,0X61,0X0D,0X08,0XE2,0X23,0X05,0X34,0XAA,
+0X45,0X0C,0X4D,0X4D,0X5D,0X90,0X5D,0XB1,0X45,0X2E,0X2C,0XAB,0X2C,0XAA,0X35,0X0B,
+0X2C,0X6A,0X1A,0X85,0X08,0XE2,0X80,0X08,0X61,0X92,0X00,0X61,0X05,0X00,0X81,0X08,
+0X81,0X08,0XC1,0X11,0XA2,0X2B,0X03,0X3B,0XE4,0X80,0X3B,0XC3,0X0E,0X3C,0X04,0X3C,
+0X25,0X33,0XA4,0X22,0XC3,0X22,0X63,0X22,0XE3,0X2B,0X84,0X2B,0X65,0X2B,0X24,0X2B,
+0X45,0X2B,0X66,0X23,0X25,0X1A,0XA4,0X11,0X42,0X08,0XA1,0X8E,0X00,0X61,0X80,0X08,
+0X81,0X95,0X00,0X61,0X00,0X00,0X62,0X94,0X00,0X61,0X08,0X00,0X82,0X00,0XE3,0X09,
+0X64,0X01,0X63,0X09,0X02,0X09,0X63,0X09,0X84,0X09,0X23,0X09,0X03,0X80,0X09,0X63,
+0X02,0X09,0X02,0X00,0XE2,0X00,0XA2,0X8B,0X00,0X61,0X02,0X08,0X61,0X08,0XE2,0X09,
+0X22,0X81,0X09,0X02,0X02,0X08,0XE2,0X08,0XC2,0X00,0X81,0XA7,0X00,0X61,0X05,0X00,
+0X81,0X09,0X63,0X12,0X65,0X12,0X25,0X09,0X83,0X08,0XE2,0X98,0X00,0X61,0X02,0X08,
+0XA1,0X08,0XA2,0X08,0X82,0X82,0X08,0X81,0X07,0X00,0X82,0X08,0X82,0X08,0XE2,0X11,
+0XC3,0X1A,0X43,0X11,0XE3,0X09,0X22,0X08,0XA2,0X80,0X08,0X81,0XB1,0X00,0X61,0X00,
+0X08,0X61,0X90,0X00,0X61,0X08,0X08,0X61,0X08,0XA2,0X1A,0X44,0X2C,0X6A,0X45,0X2D,
+0X55,0X4E,0X65,0XB0,0X65,0XB1,0X4D,0X4E,0X80,0X2C,0XAA,0X02,0X24,0X49,0X1A,0XA5,
+0X11,0X02,0X80,0X08,0X61,0X96,0X00,0X61,0X13,0X08,0X81,0X11,0X62,0X2A,0XE3,0X33,
+0X84,0X3B,0XC4,0X3B,0XE4,0X3B,0XE3,0X3B,0XA3,0X2B,0X23,0X22,0X82,0X22,0XA3,0X2B,
+0X23,0X2B,0X43,0X2B,0X03,0X2B,0X02,0X2B,0X23,0X23,0X04,0X1A,0X63,0X09,0X42,0X08,
+0X81,0X8C,0X00,0X61,0X81,0X08,0X81,0XAD,0X00,0X61,0X07,0X00,0X82,0X09,0X03,0X09,
+0XC5,0X09,0XE6,0X09,0XA5,0X09,0XC5,0X09,0XE5,0X01,0X84,0X80,0X09,0X63,0X02,0X01,
+0X03,0X00,0XA2,0X00,0X81,0X8C,0X00,0X61,0X01,0X08,0X81,0X08,0XC2,0X82,0X09,0X02,
+0X01,0X08,0XC2,0X08,0X81,0XA9,0X00,0X61,0X04,0X09,0X02,0X12,0X45,0X12,0X65,0X09,
+0X83,0X08,0XC2,0X99,0X00,0X61,0X82,0X00,0X81,0X08,0X00,0X61,0X08,0X82,0X00,0X81,
+0X08,0XC2,0X11,0X62,0X1A,0X23,0X1A,0X03,0X09,0X42,0X08,0XA2,0X80,0X08,0X81,0XC6,
+0X00,0X61,0X0B,0X08,0X81,0X11,0X83,0X23,0XE9,0X3D,0X2D,0X55,0X4F,0X65,0XD1,0X65,
+0XB1,0X4D,0X6F,0X34,0XEC,0X2C,0X8A,0X1B,0X26,0X09,0X02,0X81,0X00,0X61,0X80,0X08,
+0X61,0X91,0X00,0X61,0X80,0X00,0X81,0X09,0X08,0X81,0X00,0X61,0X08,0X81,0X08,0XE2,
+0X22,0X63,0X33,0XE5,0X34,0X26,0X3C,0X05,0X33,0X83,0X2B,0X23,0X80,0X22,0X83,0X08,
+0X22,0XC3,0X2A,0XE3,0X2B,0X02,0X2B,0X23,0X33,0X84,0X2B,0X64,0X1A,0X43,0X09,0X42,
+0X08,0XA1,0X8D,0X00,0X61,0X01,0X08,0X81,0X08,0X82,0X99,0X00,0X61,0X02,0X00,0X81,
+0X00,0X82,0X08,0X81,0X8F,0X00,0X61,0X0A,0X08,0XA1,0X08,0XE2,0X01,0XA5,0X0A,0X89,
+0X02,0XEB,0X0A,0XEA,0X0A,0XA9,0X0A,0X68,0X09,0XC5,0X01,0X03,0X00,0XA2,0X8E,0X00,
+0X61,0X01,0X08,0X81,0X09,0X02,0X80,0X09,0X42,0X02,0X09,0X02,0X08,0XC2,0X08,0X81,
+0XAA,0X00,0X61,0X05,0X00,0XA2,0X12,0X05,0X12,0X86,0X11,0XC4,0X08,0XC2,0X08,0X61,
+0X99,0X00,0X61,0X00,0X00,0X81,0X80,0X00,0X61,0X08,0X08,0X81,0X00,0X61,0X08,0X82,
+0X09,0X02,0X11,0XC2,0X1A,0X03,0X11,0X62,0X08,0XA2,0X08,0X81,0XC9,0X00,0X61,0X03,
+0X09,0X03,0X1B,0X47,0X34,0XCC,0X4D,0X4E,0X80,0X55,0X90,0X04,0X45,0X0D,0X2C,0XAB,
+0X24,0X29,0X12,0X04,0X08,0X82,0X9B,0X00,0X61,0X08,0X00,0X62,0X08,0XE2,0X1A,0X44,
+0X23,0XE8,0X2C,0X89,0X34,0X27,0X2B,0X64,0X2A,0XE3,0X22,0XA3,0X80,0X22,0XA2,0X06,
+0X22,0XC2,0X2B,0X03,0X33,0X84,0X2B,0X64,0X22,0XA3,0X11,0XC3,0X08,0XC2,0X8D,0X00,
+0X61,0X01,0X08,0X81,0X00,0X81,0X87,0X00,0X61,0X00,0X00,0X62,0X90,0X00,0X61,0X02,
+0X00,0X82,0X00,0X81,0X08,0X81,0X8D,0X00,0X61,0X0A,0X08,0X81,0X00,0X81,0X08,0XC2,
+0X09,0X43,0X02,0X48,0X0B,0X6C,0X0B,0X4B,0X02,0XAA,0X0A,0X27,0X01,0X44,0X00,0XA2,
+0X8F,0X00,0X61,0X06,0X08,0XA1,0X09,0X83,0X12,0X24,0X09,0X83,0X08,0XE2,0X08,0X81,
+0X08,0X61,0XAA,0X00,0X61,0X04,0X08,0XA2,0X0A,0X05,0X12,0XC7,0X11,0XE4,0X08,0XC2,
+0X9F,0X00,0X61,0X05,0X00,0X81,0X09,0X22,0X11,0XC2,0X11,0X82,0X08,0XE2,0X08,0X82,
+0XCA,0X00,0X61,0X09,0X08,0XC2,0X1A,0X85,0X24,0X4A,0X3D,0X0D,0X4D,0X6F,0X4D,0X4F,
+0X34,0XCC,0X2C,0X49,0X1B,0X06,0X09,0X22,0X9C,0X00,0X61,0X09,0X08,0X81,0X08,0X61,
+0X08,0XC2,0X12,0X04,0X23,0XC8,0X2C,0X6A,0X2C,0X07,0X2B,0X85,0X2A,0XE3,0X22,0XA3,
+0X80,0X22,0X83,0X06,0X2A,0XE3,0X2B,0X23,0X2B,0X43,0X22,0XC3,0X11,0XE3,0X09,0X02,
+0X08,0X61,0X8B,0X00,0X61,0X01,0X08,0X82,0X08,0X81,0X87,0X00,0X61,0X02,0X00,0X82,
+0X08,0X82,0X00,0X82,0X90,0X00,0X61,0X01,0X00,0X81,0X08,0X81,0X8E,0X00,0X61,0X08,
+0X00,0X81,0X08,0XA2,0X09,0X02,0X09,0XE6,0X02,0XAA,0X02,0X48,0X01,0XA6,0X01,0X24,
+0X00,0XA2,0X8F,0X00,0X61,0X06,0X00,0X81,0X09,0X02,0X12,0X04,0X12,0X45,0X09,0X63,
+0X08,0XA2,0X00,0X81,0XAB,0X00,0X61,0X04,0X08,0X81,0X09,0XC4,0X12,0X85,0X11,0XA3,
+0X08,0XA2,0X9F,0X00,0X61,0X04,0X00,0X81,0X09,0X02,0X11,0X62,0X09,0X02,0X08,0XA1,
+0XCB,0X00,0X61,0X09,0X08,0XA2,0X12,0X04,0X24,0X09,0X3D,0X0D,0X45,0X4E,0X45,0X4F,
+0X2C,0XCC,0X23,0XE8,0X12,0X24,0X08,0XA2,0X9C,0X00,0X61,0X00,0X00,0X81,0X80,0X00,
+0X61,0X09,0X08,0XC2,0X12,0X04,0X23,0XA8,0X2C,0X69,0X2C,0X07,0X2B,0X44,0X22,0XC3,
+0X22,0X62,0X22,0X63,0X22,0XC2,0X80,0X2B,0X02,0X03,0X2A,0XE2,0X1A,0X63,0X11,0X42,
+0X08,0X61,0X8A,0X00,0X61,0X02,0X08,0X81,0X08,0X82,0X08,0X81,0X87,0X00,0X61,0X01,
+0X00,0X82,0X08,0XA2,0X80,0X00,0X82,0XA2,0X00,0X61,0X06,0X08,0XA2,0X09,0X03,0X09,
+0XE6,0X0A,0X47,0X01,0X85,0X01,0X03,0X00,0XA2,0X90,0X00,0X61,0X05,0X08,0XA1,0X09,
+0X62,0X12,0X04,0X11,0XA3,0X08,0XC2,0X08,0X81,0XAC,0X00,0X61,0X04,0X08,0X61,0X09,
+0X63,0X12,0X24,0X09,0X82,0X08,0X81,0X9F,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XC2,
+0X00,0X08,0XA1,0XCC,0X00,0X61,0X09,0X08,0X81,0X11,0XA4,0X1B,0XC9,0X35,0X0D,0X45,
+0X4E,0X3D,0X0D,0X24,0X8B,0X1B,0X87,0X11,0X83,0X08,0X82,0X9C,0X00,0X61,0X00,0X00,
+0X81,0X80,0X00,0X61,0X0F,0X08,0X61,0X08,0XC2,0X12,0X04,0X23,0XC7,0X2C,0X69,0X2B,
+0XC6,0X23,0X04,0X22,0XA3,0X22,0X62,0X22,0X82,0X22,0XC3,0X2A,0XE2,0X2B,0X03,0X2A,
+0XC3,0X11,0X82,0X00,0X81,0X96,0X00,0X61,0X03,0X08,0X82,0X00,0XA3,0X00,0XC3,0X00,
+0X82,0XA2,0X00,0X61,0X05,0X08,0XA2,0X09,0X23,0X0A,0X06,0X09,0XC5,0X01,0X03,0X00,
+0XA2,0X91,0X00,0X61,0X04,0X08,0XC1,0X09,0X42,0X09,0X83,0X08,0XE2,0X08,0X81,0XAD,
+0X00,0X61,0X04,0X08,0X61,0X09,0X43,0X12,0X03,0X09,0X42,0X08,0X81,0X80,0X00,0X61,
+0X00,0X08,0X61,0X9C,0X00,0X61,0X80,0X08,0X81,0X00,0X00,0X81,0XCD,0X00,0X61,0X08,
+0X08,0X61,0X11,0X23,0X1B,0X48,0X24,0XCD,0X35,0X2E,0X2C,0XCC,0X24,0X4A,0X1B,0X27,
+0X09,0X43,0XA2,0X00,0X61,0X09,0X08,0XC2,0X1A,0X24,0X2B,0X86,0X2C,0X27,0X2B,0XC5,
+0X2B,0X24,0X22,0XC3,0X22,0X82,0X22,0X62,0X22,0XC2,0X80,0X33,0X43,0X02,0X1A,0X03,
+0X08,0XA2,0X08,0X61,0X95,0X00,0X61,0X04,0X00,0XA2,0X00,0XC3,0X01,0X04,0X00,0XA2,
+0X08,0X61,0XA1,0X00,0X61,0X04,0X00,0XA2,0X09,0X63,0X09,0XE5,0X01,0X63,0X00,0X82,
+0X82,0X00,0X61,0X00,0X08,0X61,0X8C,0X00,0X61,0X04,0X08,0X61,0X08,0XA1,0X09,0X02,
+0X08,0XE2,0X08,0XA1,0XAF,0X00,0X61,0X02,0X09,0X42,0X11,0XC3,0X09,0X02,0XF3,0X00,
+0X61,0X07,0X08,0XE2,0X1A,0XC6,0X24,0X6C,0X24,0XED,0X24,0XAC,0X24,0X29,0X1A,0XA5,
+0X08,0XE2,0X80,0X00,0X61,0X00,0X08,0X61,0XA0,0X00,0X61,0X0C,0X08,0XC1,0X1A,0X23,
+0X2B,0XA5,0X34,0X06,0X2B,0X85,0X2B,0X24,0X22,0XC3,0X22,0X62,0X22,0X82,0X2A,0XE2,
+0X33,0X63,0X2A,0XE3,0X11,0X42,0X94,0X00,0X61,0X02,0X08,0X81,0X00,0XA2,0X00,0XE4,
+0X80,0X01,0X26,0X01,0X00,0XC3,0X00,0X82,0XA0,0X00,0X61,0X04,0X08,0X81,0X08,0XC2,
+0X09,0X43,0X09,0X64,0X00,0XE2,0X93,0X00,0X61,0X00,0X08,0X81,0X80,0X08,0XA1,0XAF,
+0X00,0X61,0X03,0X08,0X61,0X09,0X22,0X11,0X82,0X08,0XC2,0XF3,0X00,0X61,0X08,0X08,
+0XA2,0X12,0X45,0X24,0X09,0X24,0XAC,0X1C,0XAC,0X23,0XA8,0X12,0X04,0X08,0XA2,0X08,
+0X61,0X9E,0X00,0X61,0X00,0X08,0X61,0X82,0X00,0X61,0X0C,0X08,0XC2,0X22,0X43,0X2B,
+0X85,0X2B,0X44,0X22,0XC4,0X22,0XA3,0X22,0XA2,0X22,0X62,0X2A,0XA2,0X33,0X42,0X2B,
+0X23,0X11,0XC2,0X00,0X81,0X93,0X00,0X61,0X06,0X08,0X81,0X00,0XA3,0X01,0X25,0X01,
+0X87,0X01,0X05,0X00,0X82,0X08,0X61,0X9D,0X00,0X61,0X80,0X00,0X81,0X80,0X00,0X61,
+0X03,0X00,0XC2,0X09,0X02,0X08,0XE2,0X08,0X81,0X93,0X00,0X61,0X02,0X08,0X81,0X00,
+0X81,0X08,0X81,0XB0,0X00,0X61,0X80,0X08,0XE2,0X00,0X08,0X81,0XF3,0X00,0X61,0X07,
+0X08,0X82,0X11,0X63,0X23,0X46,0X24,0X6B,0X1C,0X6C,0X1B,0X68,0X09,0X83,0X08,0X82,
+0XA5,0X00,0X61,0X0B,0X11,0X02,0X22,0X83,0X2B,0X64,0X22,0XA4,0X11,0XE3,0X1A,0X83,
+0X22,0XC3,0X22,0XA2,0X2A,0XC2,0X2A,0XE2,0X1A,0X22,0X08,0XC2,0X94,0X00,0X61,0X05,
+0X00,0X82,0X00,0XA2,0X00,0XE4,0X00,0XE3,0X00,0XA3,0X00,0X82,0X9D,0X00,0X61,0X00,
+0X00,0X81,0X80,0X00,0X61,0X03,0X00,0X81,0X08,0XA2,0X00,0XC2,0X08,0X81,0X90,0X00,
+0X61,0X00,0X00,0X82,0XB6,0X00,0X61,0X80,0X08,0XA1,0XF4,0X00,0X61,0X07,0X08,0X81,
+0X09,0X02,0X1A,0XA5,0X24,0X09,0X1C,0X6C,0X13,0X48,0X09,0X63,0X08,0X81,0XA5,0X00,
+0X61,0X07,0X08,0X81,0X11,0X42,0X22,0X83,0X22,0XC4,0X11,0X83,0X09,0X63,0X22,0X63,
+0X22,0XC3,0X80,0X2A,0XC2,0X02,0X22,0X62,0X11,0X42,0X08,0X81,0X80,0X00,0X61,0X80,
+0X00,0X81,0X91,0X00,0X61,0X04,0X00,0XA3,0X01,0X26,0X01,0X46,0X00,0XC3,0X00,0X81,
+0X9C,0X00,0X61,0X02,0X00,0X81,0X00,0X82,0X00,0X81,0X80,0X08,0X81,0X00,0X00,0X81,
+0XFF,0X00,0X61,0XC2,0X00,0X61,0X06,0X08,0XC2,0X11,0XE3,0X23,0XC8,0X24,0X6B,0X13,
+0X28,0X09,0X43,0X08,0X61,0XA6,0X00,0X61,0X0D,0X08,0X81,0X09,0X22,0X11,0XE3,0X11,
+0X62,0X08,0XC2,0X11,0X62,0X22,0X83,0X2B,0X03,0X2A,0XE2,0X22,0X82,0X11,0XA2,0X08,
+0XC1,0X00,0X62,0X00,0X61,0X87,0X08,0X81,0X80,0X08,0X61,0X88,0X00,0X61,0X04,0X00,
+0XA2,0X01,0X25,0X01,0X46,0X00,0XC4,0X00,0X82,0X9D,0X00,0X61,0X80,0X08,0XA2,0X00,
+0X08,0XA1,0X80,0X08,0X81,0X00,0X00,0X81,0XFF,0X00,0X61,0XC1,0X00,0X61,0X08,0X08,
+0X81,0X11,0X83,0X23,0X66,0X24,0X4A,0X1B,0X48,0X09,0X43,0X08,0X61,0X00,0X61,0X08,
+0X61,0XA5,0X00,0X61,0X0D,0X00,0X81,0X08,0XC2,0X08,0XC1,0X00,0X61,0X08,0XC2,0X11,
+0XC3,0X23,0X05,0X2B,0X65,0X2A,0XE3,0X22,0X42,0X09,0X22,0X00,0X82,0X00,0X61,0X00,
+0X82,0X80,0X08,0X81,0X00,0X08,0XA2,0X80,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0XA2,
+0X81,0X08,0X82,0X81,0X08,0X81,0X84,0X00,0X61,0X03,0X00,0X82,0X00,0XA3,0X00,0XC3,
+0X00,0X82,0X9A,0X00,0X61,0X00,0X08,0X61,0X81,0X08,0X81,0X80,0X08,0XA1,0X00,0X08,
+0X81,0X80,0X00,0X81,0X95,0X00,0X61,0X00,0X00,0X81,0XFF,0X00,0X61,0XAA,0X00,0X61,
+0X05,0X08,0X61,0X09,0X02,0X22,0XE5,0X2C,0X28,0X23,0X67,0X09,0X63,0X80,0X00,0X61,
+0X00,0X08,0X61,0XA3,0X00,0X61,0X00,0X00,0X81,0X80,0X00,0X61,0X0A,0X00,0X81,0X08,
+0X81,0X00,0X61,0X08,0X61,0X08,0XE2,0X12,0X44,0X23,0XA8,0X2B,0XE7,0X23,0X04,0X19,
+0XA2,0X08,0XA1,0X80,0X08,0X81,0X82,0X08,0XA1,0X80,0X08,0XA2,0X80,0X08,0XA1,0X84,
+0X08,0XA2,0X01,0X08,0X82,0X00,0X81,0X81,0X00,0X61,0X01,0X08,0X61,0X00,0X61,0X80,
+0X00,0X82,0X00,0X00,0X62,0X9D,0X00,0X61,0X00,0X08,0X81,0X81,0X00,0X61,0X03,0X00,
+0X81,0X00,0X61,0X00,0X81,0X08,0X81,0XFF,0X00,0X61,0XC1,0X00,0X61,0X05,0X08,0XC2,
+0X1A,0X83,0X2B,0XE6,0X23,0X66,0X11,0XA3,0X08,0X81,0XAC,0X00,0X61,0X06,0X08,0X81,
+0X09,0X02,0X12,0XA6,0X24,0X2A,0X23,0XE9,0X1A,0X63,0X09,0X01,0X81,0X08,0X81,0X80,
+0X08,0XA1,0X81,0X08,0X81,0X00,0X08,0XA1,0X88,0X08,0XA2,0X01,0X00,0X82,0X00,0X62,
+0X80,0X00,0X61,0X81,0X00,0X82,0XFF,0X00,0X61,0XE8,0X00,0X61,0X06,0X08,0X81,0X11,
+0XC3,0X2B,0X65,0X2B,0X44,0X11,0XA2,0X08,0X81,0X08,0X61,0XAB,0X00,0X61,0X07,0X00,
+0X81,0X08,0X81,0X09,0X63,0X13,0X49,0X1C,0X6B,0X1B,0X67,0X11,0XA3,0X08,0XA1,0X83,
+0X08,0X81,0X02,0X08,0XA1,0X08,0X81,0X08,0XA2,0X80,0X08,0XC2,0X83,0X08,0XA2,0X81,
+0X08,0XC2,0X00,0X08,0XA2,0X80,0X00,0XA2,0X81,0X00,0X82,0XFF,0X00,0X61,0XEA,0X00,
+0X61,0X05,0X09,0X22,0X22,0XA3,0X2B,0X03,0X19,0XC2,0X08,0XA1,0X08,0X41,0XA8,0X00,
+0X61,0X81,0X08,0X81,0X80,0X00,0X81,0X06,0X08,0XA1,0X11,0XE5,0X1B,0XEA,0X1C,0X2A,
+0X12,0X85,0X08,0XE2,0X00,0X81,0X82,0X08,0X81,0X80,0X08,0XA1,0X82,0X08,0XA2,0X87,
+0X08,0XC2,0X03,0X00,0XA2,0X08,0XC2,0X08,0XA2,0X08,0X81,0X93,0X00,0X61,0X80,0X08,
+0X81,0X8B,0X00,0X61,0X00,0X08,0X61,0X80,0X08,0X81,0X85,0X00,0X61,0X01,0X00,0X62,
+0X00,0X81,0XFC,0X00,0X61,0X01,0X00,0X81,0X00,0X61,0X83,0X00,0X81,0XB6,0X00,0X61,
+0X05,0X08,0X81,0X11,0X82,0X1A,0X43,0X11,0XA2,0X08,0XA1,0X08,0X61,0XA6,0X00,0X61,
+0X01,0X08,0X81,0X00,0X61,0X82,0X08,0X81,0X06,0X00,0X81,0X08,0X81,0X09,0X02,0X12,
+0XA6,0X24,0X0A,0X1B,0X68,0X09,0X83,0X83,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0X81,
+0X00,0X08,0XA1,0X80,0X08,0XA2,0X87,0X08,0XC2,0X00,0X00,0XC2,0X80,0X08,0XC2,0X01,
+0X08,0XA2,0X08,0X82,0X92,0X00,0X61,0X80,0X08,0X81,0X8A,0X00,0X61,0X81,0X08,0X61,
+0X80,0X08,0XA2,0X00,0X00,0XA1,0X81,0X08,0XA2,0X80,0X08,0X82,0X01,0X00,0X82,0X08,
+0X82,0X83,0X00,0X82,0X00,0X00,0X81,0X87,0X00,0X61,0X00,0X00,0X81,0XE7,0X00,0X61,
+0X80,0X00,0X81,0X83,0X00,0XA2,0X81,0X00,0X82,0X01,0X00,0XA1,0X00,0XA2,0X85,0X00,
+0X81,0X00,0X08,0X81,0XAF,0X00,0X61,0X00,0X08,0XC2,0X80,0X09,0X22,0X00,0X08,0XC1,
+0XA5,0X00,0X61,0X00,0X08,0X81,0X80,0X00,0X61,0X81,0X08,0X81,0X00,0X00,0X61,0X82,
+0X08,0X81,0X04,0X11,0X43,0X1B,0X48,0X24,0X09,0X12,0X65,0X08,0XC2,0X84,0X08,0X81,
+0X01,0X08,0XA1,0X08,0X81,0X81,0X08,0XA2,0X88,0X08,0XC2,0X80,0X08,0XE2,0X01,0X08,
+0XC2,0X08,0X81,0X9C,0X00,0X61,0X02,0X08,0X81,0X08,0XC2,0X10,0XC2,0X80,0X08,0X61,
+0X02,0X08,0X81,0X08,0XA2,0X11,0X03,0X80,0X08,0XE2,0X83,0X08,0XC2,0X01,0X08,0XE2,
+0X08,0XC2,0X81,0X08,0XA2,0X01,0X08,0X82,0X00,0X81,0X80,0X08,0X81,0X02,0X00,0X61,
+0X00,0XA2,0X00,0X82,0X82,0X00,0X61,0X00,0X00,0X81,0XE1,0X00,0X61,0X00,0X00,0X82,
+0X81,0X00,0XA2,0X8A,0X00,0XC2,0X00,0X00,0XC1,0X80,0X00,0XA1,0X07,0X00,0XA2,0X00,
+0XA1,0X08,0X81,0X00,0X81,0X00,0XA1,0X08,0X81,0X00,0XA1,0X00,0XA2,0X80,0X00,0X81,
+0XAD,0X00,0X61,0X02,0X00,0X81,0X08,0XA1,0X08,0X81,0XA6,0X00,0X61,0X80,0X08,0X81,
+0X00,0X00,0X61,0X85,0X08,0X81,0X04,0X08,0XA1,0X12,0X05,0X23,0XC8,0X1B,0X06,0X09,
+0X23,0X84,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0X81,0X00,0X08,0XA1,0X81,0X08,0XA2,
+0X80,0X08,0XC2,0X00,0X08,0XA2,0X80,0X08,0XC2,0X80,0X08,0XE2,0X80,0X08,0XC2,0X04,
+0X08,0XE2,0X08,0XC2,0X08,0XA2,0X08,0X82,0X00,0X81,0X8E,0X00,0X61,0X00,0X08,0X82,
+0X82,0X00,0X82,0X81,0X08,0X82,0X03,0X00,0X61,0X00,0X62,0X00,0X82,0X08,0XC2,0X80,
+0X11,0X23,0X01,0X08,0XC2,0X08,0X81,0X80,0X08,0X61,0X02,0X08,0X81,0X08,0XA2,0X08,
+0XA1,0X81,0X08,0X81,0X01,0X00,0X81,0X00,0X82,0X84,0X08,0XC2,0X81,0X08,0XA2,0X01,
+0X08,0X82,0X00,0X82,0X80,0X00,0XA2,0X00,0X00,0X81,0XE3,0X00,0X61,0X01,0X00,0X81,
+0X00,0XC2,0X88,0X01,0X02,0X84,0X00,0XE2,0X80,0X00,0XC2,0X00,0X08,0XA1,0X81,0X00,
+0X81,0X80,0X08,0XA1,0X05,0X00,0XA1,0X00,0XC2,0X00,0XC1,0X00,0XC2,0X08,0XA2,0X00,
+0XA1,0X80,0X00,0X81,0X88,0X00,0X61,0X02,0X00,0X81,0X00,0X61,0X00,0X81,0X80,0X00,
+0X61,0X80,0X00,0X81,0X9B,0X00,0X61,0X00,0X08,0X61,0XA6,0X00,0X61,0X01,0X08,0X81,
+0X00,0X61,0X80,0X08,0X81,0X00,0X00,0X61,0X82,0X08,0X81,0X80,0X08,0XA1,0X03,0X09,
+0X23,0X1A,0XE5,0X23,0X05,0X11,0X42,0X86,0X08,0X81,0X01,0X08,0X82,0X08,0XA1,0X84,
+0X08,0XA2,0X80,0X08,0XC2,0X01,0X00,0XE2,0X08,0XE2,0X80,0X08,0XC2,0X00,0X08,0XE2,
+0X81,0X08,0XC2,0X01,0X08,0XA2,0X08,0X81,0X8B,0X00,0X61,0X80,0X00,0X82,0X83,0X08,
+0XA2,0X81,0X08,0X82,0X80,0X08,0XA2,0X04,0X08,0XE2,0X09,0X23,0X11,0X22,0X08,0XE2,
+0X08,0X82,0X80,0X00,0X61,0X83,0X08,0X61,0X81,0X00,0X61,0X00,0X08,0X81,0X81,0X00,
+0X81,0X81,0X08,0X81,0X80,0X08,0XA2,0X00,0X08,0XC2,0X82,0X08,0XA2,0X80,0X00,0X82,
+0XE0,0X00,0X61,0X05,0X00,0X81,0X00,0XA1,0X00,0XE2,0X01,0X22,0X01,0X42,0X01,0X62,
+0X80,0X01,0X42,0X82,0X01,0X22,0X83,0X01,0X02,0X81,0X00,0XE2,0X01,0X00,0XC2,0X00,
+0XC1,0X82,0X00,0XA1,0X02,0X08,0XA2,0X00,0XC1,0X00,0XC2,0X82,0X00,0XE2,0X01,0X00,
+0XC2,0X00,0XC1,0X80,0X00,0X81,0X86,0X00,0X61,0X01,0X00,0X81,0X00,0X61,0X80,0X00,
+0X81,0X80,0X00,0X61,0X80,0X00,0X81,0XC5,0X00,0X61,0X85,0X08,0X81,0X07,0X08,0XA1,
+0X08,0X81,0X08,0XA1,0X08,0XC2,0X11,0XE3,0X1A,0X84,0X11,0X62,0X08,0XA1,0X83,0X08,
+0X81,0X80,0X08,0XA2,0X81,0X08,0XA1,0X01,0X08,0X81,0X08,0XA1,0X82,0X08,0XA2,0X80,
+0X08,0XC2,0X00,0X08,0XE2,0X80,0X08,0XC2,0X81,0X08,0XE2,0X04,0X09,0X02,0X08,0XE2,
+0X08,0XC2,0X00,0XA2,0X00,0X81,0X85,0X00,0X61,0X80,0X00,0X82,0X82,0X00,0XA2,0X80,
+0X08,0XA2,0X82,0X00,0XA2,0X03,0X00,0X82,0X08,0X82,0X08,0XA2,0X08,0XE2,0X80,0X09,
+0X02,0X00,0X08,0XA2,0X80,0X08,0X81,0X82,0X00,0X61,0X82,0X08,0X61,0X88,0X00,0X61,
+0X03,0X00,0X81,0X08,0X81,0X08,0XA1,0X08,0XA2,0X80,0X08,0XA1,0X80,0X08,0XA2,0X80,
+0X00,0X82,0X80,0X00,0X81,0X82,0X00,0X61,0X82,0X00,0X62,0XD3,0X00,0X61,0X03,0X00,
+0X81,0X00,0XA1,0X01,0X02,0X01,0X42,0X83,0X01,0X62,0X81,0X01,0X42,0X80,0X01,0X22,
+0X80,0X01,0X02,0X00,0X00,0XE1,0X84,0X00,0XE2,0X01,0X00,0XC1,0X00,0XE1,0X83,0X00,
+0XE2,0X81,0X01,0X02,0X04,0X00,0XE1,0X09,0X02,0X01,0X02,0X00,0XE2,0X00,0XA1,0X81,
+0X00,0X81,0X80,0X00,0X61,0X89,0X00,0X81,0XC5,0X00,0X61,0X87,0X08,0X81,0X80,0X08,
+0XA1,0X02,0X09,0X22,0X11,0XA2,0X09,0X22,0X80,0X08,0XA2,0X80,0X08,0X81,0X80,0X08,
+0XA1,0X81,0X08,0XA2,0X81,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0XA2,0X00,0X08,0XA1,
+0X81,0X08,0XA2,0X81,0X08,0XC2,0X81,0X08,0XE2,0X00,0X09,0X02,0X80,0X08,0XE2,0X02,
+0X08,0XC2,0X08,0XA2,0X08,0X82,0X81,0X00,0X61,0X00,0X00,0X82,0X80,0X08,0X82,0X01,
+0X00,0XA2,0X08,0XA2,0X82,0X00,0XA2,0X00,0X08,0XA2,0X84,0X00,0XA2,0X04,0X08,0XA2,
+0X08,0XE2,0X09,0X02,0X08,0XE2,0X08,0XA1,0X80,0X00,0X81,0X00,0X08,0X81,0X84,0X00,
+0X61,0X82,0X08,0X61,0X88,0X00,0X61,0X00,0X00,0X81,0X80,0X08,0X81,0X00,0X08,0XA1,
+0X80,0X08,0XA2,0X00,0X08,0XC2,0X85,0X08,0XA2,0X81,0X00,0XA2,0X80,0X00,0X82,0X01,
+0X08,0X82,0X00,0X62,0XCF,0X00,0X61,0X02,0X00,0X81,0X00,0XC1,0X01,0X22,0X81,0X01,
+0X62,0X80,0X01,0X82,0X00,0X01,0XA2,0X81,0X01,0X82,0X80,0X01,0X62,0X03,0X01,0X22,
+0X01,0X02,0X00,0XE2,0X01,0X02,0X82,0X01,0X22,0X80,0X01,0X02,0X00,0X00,0XE2,0X82,
+0X01,0X02,0X83,0X01,0X22,0X00,0X01,0X02,0X80,0X01,0X22,0X03,0X01,0X42,0X01,0X02,
+0X00,0XC1,0X08,0XA1,0X8C,0X00,0X81,0XC7,0X00,0X61,0X85,0X08,0X81,0X81,0X08,0XA1,
+0X02,0X08,0XE2,0X08,0XC2,0X08,0X81,0X80,0X08,0XA1,0X04,0X08,0XA2,0X08,0XA1,0X08,
+0XA2,0X00,0XA2,0X08,0XA2,0X82,0X08,0XA1,0X81,0X08,0XA2,0X81,0X08,0XA1,0X81,0X08,
+0XA2,0X80,0X08,0XC2,0X84,0X08,0XE2,0X80,0X08,0XC2,0X00,0X08,0X82,0X81,0X00,0X82,
+0X01,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,0X80,0X00,0XA2,0X82,0X08,0XA2,0X81,0X00,
+0XA2,0X80,0X08,0XA2,0X03,0X08,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XA1,0X81,0X08,0X81,
+0X00,0X00,0X81,0X85,0X00,0X61,0X81,0X08,0X61,0X00,0X08,0X81,0X85,0X00,0X61,0X00,
+0X00,0X81,0X80,0X00,0X82,0X80,0X08,0XA2,0X03,0X00,0XA2,0X08,0XA2,0X08,0XC2,0X08,
+0XE2,0X8A,0X08,0XC2,0X80,0X08,0XA2,0X01,0X08,0X82,0X08,0XA2,0X80,0X08,0X82,0X00,
+0X00,0X62,0X80,0X00,0X81,0XC2,0X00,0X61,0X82,0X00,0X81,0X80,0X00,0XA1,0X01,0X00,
+0XE2,0X01,0X42,0X80,0X01,0X82,0X00,0X01,0X62,0X80,0X01,0X82,0X00,0X01,0XA3,0X80,
+0X01,0XC3,0X80,0X01,0XA2,0X01,0X01,0X82,0X01,0X62,0X81,0X01,0X22,0X00,0X01,0X42,
+0X80,0X01,0X82,0X00,0X01,0X62,0X80,0X01,0X42,0X00,0X01,0X22,0X81,0X01,0X02,0X00,
+0X01,0X22,0X80,0X01,0X42,0X02,0X01,0X62,0X01,0X42,0X01,0X62,0X80,0X01,0X42,0X07,
+0X01,0X62,0X01,0X82,0X01,0XA2,0X01,0X62,0X01,0X02,0X00,0XC2,0X00,0XA2,0X00,0XA1,
+0X8A,0X00,0X81,0XB4,0X00,0X61,0X85,0X08,0X81,0X8A,0X00,0X61,0X85,0X08,0X81,0X81,
+0X08,0XA1,0X03,0X08,0X81,0X00,0X81,0X00,0X61,0X00,0X81,0X81,0X08,0X81,0X81,0X08,
+0XA1,0X84,0X08,0XA2,0X82,0X08,0XA1,0X80,0X08,0XA2,0X01,0X08,0XA1,0X08,0XA2,0X82,
+0X08,0XC2,0X83,0X08,0XE2,0X80,0X08,0XC2,0X80,0X08,0XA2,0X81,0X00,0XA2,0X01,0X08,
+0XA2,0X00,0XA2,0X80,0X08,0XA2,0X83,0X00,0XA2,0X80,0X08,0XA2,0X03,0X08,0XC2,0X09,
+0X02,0X08,0XC2,0X08,0XA1,0X84,0X08,0X81,0X85,0X00,0X61,0X80,0X08,0X61,0X82,0X08,
+0X81,0X03,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X00,0XE2,0X80,0X08,0XE2,0X80,0X08,0XC2,
+0X81,0X00,0XC2,0X03,0X00,0XE2,0X08,0XC2,0X00,0XC2,0X00,0XE2,0X80,0X00,0XC2,0X80,
+0X08,0XA2,0X00,0X08,0XC2,0X80,0X08,0XA2,0X83,0X08,0XC2,0X00,0X08,0XA2,0X80,0X08,
+0XC2,0X00,0X08,0XA2,0X82,0X08,0X82,0X01,0X00,0X61,0X00,0X62,0XBD,0X00,0X61,0X00,
+0X00,0X81,0X80,0X00,0XA1,0X80,0X00,0XC1,0X05,0X00,0XE1,0X00,0XE2,0X01,0X02,0X01,
+0X22,0X01,0X62,0X01,0X82,0X82,0X01,0XA2,0X06,0X01,0XC2,0X01,0XE2,0X01,0XC2,0X01,
+0XA2,0X01,0XC2,0X01,0XC3,0X01,0XA2,0X80,0X01,0X62,0X04,0X01,0X82,0X01,0XA2,0X01,
+0XC2,0X01,0XA2,0X01,0X82,0X80,0X01,0X62,0X80,0X01,0X42,0X80,0X01,0X22,0X01,0X01,
+0X42,0X01,0X62,0X84,0X01,0X82,0X00,0X01,0XA2,0X81,0X01,0XC2,0X06,0X01,0X82,0X01,
+0X02,0X00,0XA1,0X00,0XC2,0X00,0XC1,0X00,0XA2,0X00,0XA1,0X86,0X00,0X81,0X00,0X00,
+0XA1,0X9E,0X00,0X61,0X81,0X08,0X81,0X89,0X00,0X61,0X00,0X08,0X61,0X85,0X00,0X61,
+0X85,0X08,0X81,0X8D,0X00,0X61,0X80,0X08,0X81,0X82,0X08,0XA1,0X01,0X08,0XA2,0X08,
+0X81,0X82,0X00,0X61,0X82,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0XA2,0X00,0X08,0XC2,
+0X81,0X08,0XA2,0X86,0X08,0XA1,0X03,0X08,0XA2,0X08,0XC2,0X08,0XA1,0X08,0XC2,0X85,
+0X08,0XE2,0X02,0X08,0XC2,0X08,0X82,0X00,0X82,0X82,0X08,0XA2,0X81,0X00,0XA2,0X00,
+0X08,0XA2,0X80,0X00,0XA2,0X80,0X08,0XA2,0X00,0X08,0XC2,0X80,0X08,0XE2,0X00,0X08,
+0XA1,0X84,0X08,0X81,0X00,0X00,0X82,0X85,0X00,0X61,0X80,0X08,0X61,0X04,0X08,0X81,
+0X10,0X61,0X10,0X82,0X10,0XE2,0X11,0X63,0X81,0X09,0XC4,0X0B,0X11,0XC3,0X09,0XA3,
+0X09,0X63,0X09,0X43,0X09,0X03,0X00,0XE2,0X00,0XE3,0X01,0X03,0X00,0XE3,0X01,0X03,
+0X00,0XE3,0X08,0XE3,0X82,0X08,0XC2,0X00,0X08,0XA2,0X80,0X08,0XC2,0X00,0X08,0XA2,
+0X83,0X08,0XC2,0X03,0X08,0XE2,0X08,0XC2,0X08,0XA2,0X08,0XC2,0X83,0X08,0XA2,0X00,
+0X00,0X82,0XB9,0X00,0X61,0X03,0X00,0X81,0X00,0XA2,0X00,0XC2,0X00,0XE2,0X81,0X01,
+0X02,0X02,0X01,0X22,0X01,0X42,0X01,0X62,0X80,0X01,0X82,0X01,0X01,0XA2,0X01,0XC2,
+0X80,0X01,0XE2,0X82,0X01,0XA2,0X08,0X01,0XC2,0X02,0X02,0X02,0X22,0X01,0XE3,0X01,
+0XA2,0X01,0XC2,0X02,0X02,0X02,0X22,0X02,0X02,0X80,0X01,0XC2,0X00,0X01,0XA2,0X80,
+0X01,0X82,0X80,0X01,0X62,0X02,0X01,0X42,0X01,0X62,0X01,0XA2,0X84,0X01,0XC2,0X00,
+0X02,0X02,0X81,0X02,0X22,0X01,0X01,0XE2,0X01,0X42,0X83,0X00,0XC2,0X82,0X00,0XA1,
+0X00,0X00,0X81,0X82,0X00,0XA1,0X9A,0X00,0X61,0X8B,0X08,0X81,0X8B,0X00,0X61,0X84,
+0X08,0X81,0X00,0X00,0X61,0X81,0X08,0X81,0X8A,0X00,0X61,0X82,0X08,0X81,0X80,0X08,
+0XA1,0X01,0X08,0XA2,0X08,0X81,0X85,0X00,0X61,0X80,0X00,0X81,0X02,0X08,0X81,0X08,
+0XA2,0X08,0XC2,0X80,0X08,0XA2,0X80,0X00,0XA2,0X85,0X08,0XA1,0X81,0X08,0XC2,0X02,
+0X08,0XC1,0X08,0XC2,0X08,0XE2,0X81,0X08,0XC2,0X81,0X08,0XE2,0X00,0X08,0XC2,0X80,
+0X08,0XA2,0X02,0X08,0XC2,0X00,0XA2,0X08,0XA2,0X81,0X00,0XA2,0X82,0X08,0XA2,0X03,
+0X08,0XC2,0X09,0X02,0X08,0XE2,0X08,0XA2,0X84,0X08,0X81,0X01,0X08,0XA2,0X08,0X81,
+0X86,0X00,0X61,0X07,0X08,0X61,0X08,0X81,0X10,0XA2,0X10,0X81,0X10,0XC2,0X11,0X02,
+0X11,0X43,0X11,0X42,0X80,0X09,0X42,0X80,0X09,0X63,0X80,0X09,0X83,0X01,0X09,0X63,
+0X09,0X43,0X81,0X01,0X23,0X04,0X01,0X03,0X00,0XE3,0X00,0XE2,0X00,0XC2,0X08,0XC2,
+0X80,0X08,0XE2,0X01,0X09,0X02,0X08,0XE2,0X84,0X08,0XC2,0X01,0X08,0XE2,0X08,0XC2,
+0X80,0X00,0XA2,0X80,0X08,0XA2,0X82,0X08,0XC2,0X03,0X08,0XA2,0X08,0X82,0X00,0X82,
+0X00,0X81,0XB4,0X00,0X61,0X03,0X00,0X81,0X00,0XC2,0X01,0X02,0X01,0X22,0X81,0X01,
+0X42,0X05,0X01,0X62,0X01,0XA2,0X01,0XE3,0X02,0X03,0X01,0XE2,0X01,0XC2,0X81,0X01,
+0XE2,0X01,0X01,0XC2,0X01,0XA2,0X80,0X01,0X82,0X06,0X01,0XA2,0X01,0XC2,0X02,0X02,
+0X02,0X03,0X01,0XA2,0X01,0XC2,0X02,0X22,0X80,0X02,0XA3,0X03,0X02,0X42,0X02,0X02,
+0X01,0XE2,0X01,0XC2,0X81,0X01,0XA2,0X02,0X01,0X62,0X01,0X82,0X01,0XA1,0X80,0X02,
+0X02,0X00,0X02,0X22,0X80,0X02,0X02,0X80,0X02,0X22,0X01,0X02,0X42,0X02,0X22,0X80,
+0X02,0X42,0X04,0X02,0X22,0X01,0XA2,0X01,0X02,0X00,0XC2,0X00,0XE2,0X81,0X00,0XC2,
+0X80,0X00,0XA2,0X84,0X00,0XA1,0X95,0X00,0X61,0X95,0X08,0X81,0X87,0X00,0X61,0X83,
+0X08,0X81,0X00,0X00,0X61,0X81,0X08,0X81,0X00,0X00,0X61,0X81,0X08,0X81,0X87,0X00,
+0X61,0X03,0X08,0X61,0X08,0X81,0X08,0XA1,0X08,0X81,0X80,0X08,0XA1,0X00,0X08,0X81,
+0X89,0X00,0X61,0X03,0X08,0X81,0X08,0XA1,0X00,0X81,0X08,0XA1,0X81,0X08,0XA2,0X81,
+0X08,0XC2,0X00,0X08,0XC1,0X80,0X08,0XC2,0X02,0X08,0XE2,0X08,0XC1,0X08,0XA2,0X80,
+0X08,0XA1,0X80,0X08,0XA2,0X00,0X08,0XC2,0X80,0X08,0XE2,0X01,0X09,0X02,0X08,0XE2,
+0X80,0X08,0XC2,0X80,0X00,0XA2,0X01,0X08,0XA2,0X00,0XA2,0X81,0X08,0XA2,0X02,0X08,
+0XC2,0X00,0XA2,0X08,0XC2,0X80,0X08,0XE2,0X02,0X08,0XA1,0X08,0X81,0X00,0X81,0X84,
+0X08,0X81,0X00,0X08,0X82,0X86,0X00,0X61,0X06,0X08,0XA2,0X11,0X03,0X10,0XE2,0X08,
+0X81,0X08,0XA2,0X10,0XE2,0X10,0XC2,0X80,0X08,0X81,0X04,0X08,0XA1,0X08,0XA2,0X08,
+0XC2,0X08,0XE2,0X09,0X02,0X81,0X09,0X43,0X80,0X09,0X64,0X0B,0X01,0X44,0X01,0X23,
+0X01,0X03,0X00,0XE3,0X08,0XE2,0X08,0XC2,0X08,0XE2,0X00,0XE2,0X08,0XE2,0X08,0XC2,
+0X00,0XC2,0X08,0XC2,0X81,0X08,0XA2,0X00,0X08,0XC2,0X81,0X00,0XC2,0X83,0X08,0XC2,
+0X00,0X08,0XE2,0X81,0X08,0XC2,0X02,0X08,0XA2,0X08,0X81,0X00,0X81,0XB1,0X00,0X61,
+0X03,0X00,0X81,0X00,0XC1,0X01,0X22,0X01,0X42,0X80,0X01,0X82,0X00,0X01,0XC2,0X80,
+0X01,0XA2,0X04,0X01,0XE2,0X02,0X22,0X02,0X43,0X02,0X02,0X01,0XE2,0X84,0X01,0XC2,
+0X81,0X01,0XE2,0X0B,0X01,0XA2,0X01,0X62,0X01,0X82,0X01,0XE2,0X02,0X83,0X02,0XC3,
+0X02,0XA3,0X02,0X83,0X02,0X22,0X02,0X02,0X01,0XE2,0X01,0XC2,0X80,0X01,0XE2,0X80,
+0X01,0XC2,0X00,0X02,0X22,0X80,0X02,0X83,0X00,0X02,0X63,0X80,0X02,0X42,0X01,0X02,
+0X43,0X02,0X63,0X81,0X02,0X42,0X04,0X02,0X63,0X02,0X62,0X02,0X02,0X01,0X62,0X00,
+0XE2,0X80,0X00,0XC2,0X80,0X00,0XE2,0X80,0X00,0XC2,0X82,0X00,0XA1,0X80,0X00,0XC2,
+0X93,0X00,0X61,0X96,0X08,0X81,0X81,0X00,0X61,0X03,0X08,0X61,0X08,0X81,0X00,0X61,
+0X00,0X81,0X83,0X00,0X61,0X00,0X08,0X81,0X80,0X00,0X61,0X82,0X08,0X81,0X80,0X00,
+0X61,0X00,0X00,0X81,0X82,0X08,0X81,0X86,0X00,0X61,0X00,0X08,0X81,0X82,0X08,0XA1,
+0X8C,0X00,0X61,0X02,0X00,0X81,0X08,0X82,0X08,0XA1,0X82,0X08,0XC2,0X82,0X08,0XE2,
+0X80,0X08,0XC2,0X00,0X08,0XC1,0X80,0X08,0XA1,0X80,0X08,0XC2,0X83,0X08,0XE2,0X01,
+0X08,0XC2,0X08,0XA2,0X80,0X00,0XA2,0X01,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,0X01,
+0X00,0XA2,0X08,0XC2,0X80,0X08,0XE2,0X01,0X08,0XA2,0X08,0XA1,0X85,0X08,0X81,0X01,
+0X08,0XA2,0X08,0X82,0X81,0X00,0X61,0X0D,0X00,0X81,0X08,0X81,0X08,0X82,0X08,0XA2,
+0X08,0XE2,0X11,0X63,0X11,0X83,0X11,0X02,0X08,0XA1,0X09,0X02,0X11,0XA3,0X19,0X63,
+0X10,0XA2,0X08,0XA2,0X80,0X08,0XC2,0X00,0X08,0XA2,0X80,0X08,0XA1,0X0A,0X08,0XC2,
+0X08,0XE2,0X09,0X02,0X09,0X23,0X09,0X43,0X09,0X44,0X01,0X84,0X01,0X64,0X01,0X23,
+0X00,0XE3,0X08,0XC2,0X80,0X08,0XE2,0X00,0X00,0XC2,0X80,0X08,0XC2,0X80,0X00,0XA2,
+0X82,0X08,0XA2,0X80,0X00,0XC2,0X01,0X08,0XA2,0X00,0XC2,0X80,0X08,0XC2,0X00,0X08,
+0XE2,0X84,0X08,0XC2,0X01,0X08,0XA2,0X08,0X82,0XAF,0X00,0X61,0X08,0X00,0X81,0X00,
+0XC2,0X01,0X22,0X01,0X62,0X01,0XA2,0X01,0XE3,0X02,0X23,0X02,0X43,0X02,0X03,0X80,
+0X02,0X02,0X80,0X02,0X22,0X03,0X01,0XE2,0X01,0XC2,0X01,0XC1,0X01,0XC2,0X80,0X01,
+0XE2,0X0A,0X02,0X02,0X02,0X22,0X02,0X42,0X02,0X23,0X01,0XC2,0X01,0X62,0X01,0XA2,
+0X02,0X22,0X02,0X82,0X02,0XC3,0X02,0XE3,0X80,0X02,0XA3,0X80,0X02,0X42,0X01,0X02,
+0X22,0X02,0X02,0X80,0X02,0X22,0X02,0X01,0XC2,0X01,0XE2,0X02,0X62,0X80,0X02,0XA3,
+0X00,0X02,0X83,0X80,0X02,0X63,0X81,0X02,0X43,0X00,0X02,0X83,0X81,0X02,0XA3,0X03,
+0X02,0X83,0X02,0X02,0X01,0X22,0X00,0XC2,0X84,0X00,0XE2,0X00,0X00,0XC1,0X80,0X00,
+0XA1,0X80,0X00,0XC2,0X92,0X00,0X61,0X9F,0X08,0X81,0X82,0X00,0X61,0X8C,0X08,0X81,
+0X86,0X00,0X61,0X00,0X00,0X81,0X82,0X08,0XA1,0X00,0X08,0X81,0X8E,0X00,0X61,0X01,
+0X00,0X81,0X08,0X81,0X80,0X08,0XA1,0X84,0X08,0XC2,0X02,0X08,0XE2,0X08,0XA2,0X08,
+0XC2,0X86,0X08,0XE2,0X00,0X08,0XC2,0X80,0X00,0XA2,0X83,0X08,0XA2,0X80,0X08,0XE2,
+0X01,0X08,0XC2,0X08,0XA1,0X86,0X08,0X81,0X81,0X08,0XA2,0X83,0X08,0XC2,0X11,0X09,
+0X22,0X11,0XA3,0X11,0XE3,0X11,0XA3,0X09,0X42,0X09,0X02,0X11,0X62,0X1A,0X23,0X11,
+0XC3,0X10,0XE2,0X11,0X23,0X11,0X83,0X11,0XA3,0X09,0X63,0X09,0X02,0X08,0XE2,0X08,
+0XC2,0X08,0XC1,0X80,0X08,0XA2,0X02,0X08,0XC2,0X01,0X02,0X09,0X43,0X80,0X09,0X63,
+0X00,0X09,0X03,0X80,0X08,0XE2,0X80,0X00,0XC2,0X02,0X08,0XC2,0X08,0XA2,0X00,0XA2,
+0X81,0X08,0XA2,0X00,0X08,0XC2,0X80,0X00,0XC2,0X01,0X08,0XC2,0X08,0XA2,0X81,0X08,
+0XC2,0X00,0X08,0XE2,0X80,0X08,0XC2,0X00,0X08,0XE2,0X80,0X08,0XC2,0X00,0X08,0XE2,
+0X80,0X08,0XC2,0X00,0X00,0X82,0XAE,0X00,0X61,0X09,0X00,0XC1,0X01,0X22,0X01,0X82,
+0X01,0XC2,0X02,0X02,0X02,0X43,0X02,0X84,0X02,0X63,0X02,0X43,0X02,0X02,0X81,0X01,
+0XE2,0X81,0X01,0XC1,0X09,0X02,0X02,0X02,0X44,0X02,0X84,0X02,0X83,0X02,0X62,0X02,
+0X43,0X01,0XE3,0X01,0X62,0X01,0XA2,0X02,0X62,0X80,0X03,0X03,0X03,0X02,0XE3,0X02,
+0XC3,0X02,0XA3,0X02,0XA2,0X80,0X02,0X82,0X07,0X02,0X62,0X02,0X42,0X02,0X62,0X02,
+0X22,0X01,0XC2,0X01,0XE2,0X02,0X42,0X02,0X83,0X80,0X02,0XA3,0X80,0X02,0X83,0X81,
+0X02,0X42,0X80,0X02,0XA3,0X04,0X02,0XC3,0X02,0XA3,0X02,0XC3,0X02,0X62,0X01,0XA2,
+0X80,0X00,0XE2,0X82,0X01,0X02,0X00,0X00,0XE2,0X80,0X00,0XC2,0X00,0X00,0XA2,0X80,
+0X00,0XC2,0X91,0X00,0X61,0X90,0X08,0X81,0X00,0X08,0XA1,0X9D,0X08,0X81,0X89,0X00,
+0X61,0X00,0X08,0X81,0X80,0X08,0XA2,0X01,0X08,0XA1,0X08,0X81,0X92,0X00,0X61,0X00,
+0X00,0X82,0X81,0X00,0XA2,0X80,0X08,0XC2,0X00,0X08,0XE2,0X80,0X08,0XC2,0X87,0X08,
+0XE2,0X80,0X08,0XC2,0X82,0X08,0XA2,0X80,0X08,0XE2,0X00,0X08,0XC2,0X80,0X08,0XA2,
+0X84,0X08,0X81,0X03,0X08,0XA1,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X80,0X09,0X02,0X04,
+0X01,0X02,0X09,0X03,0X09,0X02,0X09,0X22,0X11,0XA3,0X80,0X11,0XE3,0X08,0X11,0XA3,
+0X09,0X62,0X09,0X42,0X11,0XC2,0X1A,0X43,0X11,0XC3,0X09,0X02,0X11,0X02,0X11,0X83,
+0X80,0X12,0X24,0X05,0X11,0XC3,0X09,0X62,0X09,0X23,0X09,0X22,0X09,0X02,0X08,0XE2,
+0X81,0X08,0XC2,0X07,0X08,0XE2,0X01,0X23,0X09,0X23,0X09,0X02,0X09,0X03,0X01,0X03,
+0X00,0XE2,0X00,0XC2,0X80,0X00,0XA2,0X00,0X08,0XA2,0X80,0X00,0XA2,0X00,0X00,0XC2,
+0X80,0X01,0X03,0X02,0X00,0XE2,0X00,0XC2,0X08,0XC2,0X81,0X08,0XE2,0X00,0X00,0XE2,
+0X85,0X08,0XE2,0X02,0X08,0XC2,0X08,0XA2,0X00,0X81,0XAB,0X00,0X61,0X03,0X00,0XA1,
+0X01,0X22,0X01,0XA2,0X02,0X02,0X80,0X02,0X22,0X80,0X02,0X63,0X03,0X02,0X43,0X02,
+0X22,0X01,0XE2,0X01,0XC2,0X80,0X01,0XE2,0X81,0X01,0XC1,0X11,0X02,0X22,0X02,0XC5,
+0X03,0X47,0X02,0XE6,0X02,0X43,0X01,0XC3,0X01,0X42,0X01,0X62,0X02,0X02,0X02,0XE3,
+0X03,0X23,0X03,0X03,0X02,0XE3,0X02,0XC3,0X02,0XA2,0X02,0X82,0X02,0XA2,0X02,0XC2,
+0X80,0X02,0XA2,0X05,0X02,0X62,0X02,0X42,0X01,0XA2,0X01,0X82,0X01,0XE2,0X02,0X42,
+0X80,0X02,0XA3,0X04,0X02,0XC3,0X02,0XA3,0X02,0X83,0X02,0X63,0X02,0X83,0X80,0X02,
+0XA3,0X06,0X02,0X83,0X02,0XA3,0X02,0XC2,0X02,0XA3,0X01,0XE2,0X01,0X02,0X00,0XE2,
+0X81,0X01,0X02,0X85,0X00,0XE2,0X8E,0X00,0X61,0X83,0X08,0X81,0X00,0X00,0X61,0X82,
+0X08,0X81,0X00,0X00,0X61,0X88,0X08,0X81,0X00,0X08,0XA1,0X84,0X08,0X81,0X80,0X08,
+0XA1,0X83,0X08,0X81,0X00,0X00,0X61,0X80,0X08,0X81,0X01,0X08,0XA1,0X08,0XA2,0X84,
+0X08,0XC2,0X01,0X08,0XA2,0X08,0XA1,0X83,0X08,0X81,0X8A,0X00,0X61,0X04,0X08,0XA2,
+0X08,0XC1,0X08,0XC2,0X08,0XA1,0X08,0X61,0X91,0X00,0X61,0X80,0X08,0X82,0X80,0X08,
+0XA2,0X00,0X00,0XA2,0X80,0X08,0XA2,0X80,0X00,0XA2,0X01,0X00,0XC2,0X00,0XE2,0X86,
+0X08,0XE2,0X82,0X08,0XC2,0X03,0X08,0XE2,0X09,0X02,0X08,0XC2,0X08,0X81,0X80,0X00,
+0X82,0X00,0X08,0XA1,0X81,0X08,0X81,0X01,0X08,0XA2,0X08,0XC2,0X80,0X00,0XE2,0X80,
+0X09,0X03,0X01,0X09,0X23,0X09,0X22,0X80,0X09,0X23,0X01,0X09,0X22,0X09,0X83,0X81,
+0X11,0XE3,0X0D,0X11,0XC2,0X09,0X63,0X09,0X42,0X11,0XE3,0X1A,0X23,0X11,0XA2,0X09,
+0X22,0X08,0XC2,0X08,0XA1,0X09,0X42,0X11,0XE3,0X12,0X23,0X12,0X03,0X11,0XA3,0X80,
+0X09,0X63,0X03,0X09,0X43,0X09,0X42,0X09,0X22,0X08,0XE2,0X80,0X08,0XC2,0X06,0X08,
+0XE2,0X09,0X02,0X09,0X23,0X01,0X23,0X09,0X03,0X01,0X02,0X00,0XE2,0X82,0X00,0XC2,
+0X81,0X00,0XE2,0X01,0X08,0XE2,0X00,0XE2,0X81,0X08,0XC2,0X04,0X00,0XE2,0X01,0X03,
+0X00,0XE2,0X00,0XE3,0X08,0XE2,0X81,0X08,0XC2,0X80,0X08,0XE2,0X02,0X08,0XC2,0X08,
+0XA2,0X00,0X82,0XA9,0X00,0X61,0X03,0X00,0XA1,0X01,0X02,0X01,0X82,0X02,0X22,0X80,
+0X02,0X43,0X80,0X02,0X42,0X02,0X02,0X43,0X02,0X22,0X02,0X02,0X81,0X01,0XE2,0X01,
+0X01,0XC2,0X01,0XA2,0X80,0X01,0X82,0X08,0X01,0XC2,0X02,0X24,0X0A,0X86,0X02,0X45,
+0X01,0X83,0X01,0X02,0X00,0XE2,0X01,0X82,0X02,0XA2,0X80,0X03,0X23,0X80,0X03,0X03,
+0X04,0X02,0XE2,0X02,0XC2,0X02,0XA2,0X02,0XE2,0X03,0X02,0X80,0X02,0XE2,0X0A,0X02,
+0XA3,0X02,0X22,0X01,0X42,0X01,0X22,0X01,0X82,0X02,0X01,0X02,0X62,0X02,0XA3,0X02,
+0XE4,0X02,0XC4,0X02,0XC3,0X80,0X02,0XA3,0X82,0X02,0X83,0X04,0X02,0X82,0X02,0XA2,
+0X02,0X01,0X01,0X22,0X00,0XE2,0X81,0X01,0X02,0X80,0X00,0XE2,0X81,0X01,0X02,0X80,
+0X00,0XE2,0X8D,0X00,0X61,0X84,0X08,0X81,0X00,0X00,0X61,0X84,0X08,0X81,0X80,0X08,
+0X61,0X84,0X08,0X81,0X00,0X08,0XA1,0X8F,0X08,0X81,0X05,0X08,0XA1,0X08,0XA2,0X08,
+0XC2,0X08,0XE2,0X08,0XC2,0X08,0XC1,0X83,0X08,0XE2,0X04,0X08,0XC2,0X08,0XA2,0X08,
+0XA1,0X08,0X81,0X08,0X61,0X89,0X00,0X61,0X03,0X00,0X81,0X08,0XC2,0X08,0XE2,0X08,
+0XA1,0X90,0X00,0X61,0X01,0X08,0X81,0X08,0XA2,0X82,0X00,0XA2,0X00,0X08,0XA2,0X80,
+0X00,0XA2,0X00,0X08,0XA2,0X82,0X00,0XA2,0X01,0X08,0XE2,0X08,0XC2,0X84,0X08,0XE2,
+0X81,0X08,0XC2,0X80,0X08,0XE2,0X03,0X08,0XA1,0X08,0X81,0X00,0X82,0X00,0X81,0X80,
+0X08,0X81,0X03,0X08,0XA1,0X08,0XA2,0X08,0XC2,0X09,0X02,0X80,0X09,0X43,0X19,0X01,
+0X43,0X09,0X63,0X09,0X43,0X01,0X23,0X01,0X22,0X09,0X23,0X09,0X83,0X11,0XE3,0X12,
+0X03,0X12,0X23,0X1A,0X64,0X1A,0X23,0X11,0X83,0X09,0X82,0X12,0X23,0X1A,0X03,0X11,
+0X62,0X09,0X42,0X09,0X02,0X00,0XA1,0X08,0XA1,0X09,0X22,0X11,0XA2,0X12,0X03,0X12,
+0X23,0X11,0XC3,0X81,0X09,0XA3,0X80,0X09,0X83,0X08,0X09,0X42,0X09,0X02,0X00,0XE2,
+0X00,0XC2,0X08,0XE2,0X01,0X03,0X01,0X23,0X01,0X03,0X09,0X03,0X81,0X08,0XE2,0X03,
+0X00,0XE2,0X08,0XE2,0X00,0XE2,0X00,0XE3,0X80,0X00,0XE2,0X00,0X08,0XC2,0X81,0X00,
+0XC2,0X80,0X00,0XE3,0X01,0X00,0XE2,0X08,0XE2,0X81,0X08,0XC2,0X82,0X08,0XE2,0X00,
+0X00,0XA2,0XA7,0X00,0X61,0X04,0X00,0X81,0X00,0XC2,0X01,0X22,0X01,0XC2,0X02,0X23,
+0X81,0X02,0X63,0X00,0X02,0X43,0X80,0X02,0X42,0X07,0X02,0X83,0X02,0X62,0X02,0X02,
+0X01,0XC2,0X01,0X82,0X01,0X42,0X00,0XE2,0X00,0XC1,0X80,0X00,0XE1,0X09,0X01,0X02,
+0X01,0X22,0X01,0X02,0X00,0XC2,0X00,0XA2,0X08,0XE2,0X02,0X22,0X03,0X64,0X03,0X85,
+0X03,0X64,0X80,0X03,0X43,0X00,0X03,0X02,0X80,0X02,0XE2,0X10,0X03,0X02,0X03,0X22,
+0X03,0X02,0X02,0XC3,0X02,0XA3,0X01,0XE2,0X00,0XE1,0X00,0XA1,0X01,0X22,0X01,0XA1,
+0X02,0X42,0X02,0XA3,0X02,0XC3,0X02,0XE4,0X02,0XC4,0X02,0XC3,0X02,0X63,0X82,0X02,
+0XA3,0X80,0X02,0XA2,0X02,0X02,0X22,0X01,0X42,0X00,0XE2,0X83,0X01,0X02,0X82,0X01,
+0X22,0X00,0X00,0XE2,0X8C,0X00,0X61,0X81,0X08,0XA1,0XA0,0X08,0X81,0X80,0X00,0X61,
+0X01,0X08,0X81,0X08,0XA1,0X8C,0X08,0XE2,0X80,0X08,0X81,0X83,0X00,0X61,0X00,0X08,
+0X61,0X83,0X00,0X61,0X00,0X08,0XA2,0X80,0X08,0XE2,0X00,0X08,0X81,0X8F,0X00,0X61,
+0X01,0X00,0X82,0X08,0XA2,0X80,0X00,0XA2,0X80,0X08,0XA2,0X80,0X00,0XA2,0X06,0X08,
+0XA2,0X00,0XA2,0X08,0XA2,0X08,0XC2,0X00,0XC2,0X08,0XA2,0X00,0XA2,0X80,0X08,0XA2,
+0X81,0X08,0XC2,0X01,0X08,0XE2,0X00,0XE2,0X81,0X08,0XE2,0X02,0X08,0XC2,0X08,0XA2,
+0X08,0XA1,0X80,0X00,0X82,0X80,0X08,0X82,0X01,0X08,0XA2,0X08,0XC2,0X80,0X08,0XE2,
+0X02,0X09,0X02,0X09,0X23,0X09,0X43,0X83,0X09,0X23,0X17,0X09,0X63,0X12,0X03,0X1A,
+0X44,0X1A,0X43,0X1A,0X23,0X1A,0X64,0X1A,0X43,0X11,0XC3,0X11,0XC2,0X1A,0X23,0X11,
+0XE3,0X09,0X82,0X09,0X42,0X09,0X22,0X08,0XC2,0X08,0X81,0X08,0XE2,0X09,0X42,0X11,
+0XA3,0X11,0XE3,0X12,0X03,0X11,0XE3,0X09,0XA3,0X11,0XA3,0X80,0X09,0XA3,0X80,0X11,
+0XA3,0X02,0X09,0X63,0X09,0X43,0X09,0X22,0X81,0X08,0XE2,0X09,0X09,0X02,0X01,0X02,
+0X01,0X22,0X09,0X03,0X00,0XE3,0X08,0XE2,0X00,0XE3,0X01,0X03,0X00,0XE3,0X00,0XE2,
+0X81,0X08,0XE2,0X80,0X00,0XE2,0X06,0X08,0XE2,0X00,0XE2,0X08,0XE2,0X00,0XE2,0X01,
+0X03,0X00,0XE2,0X08,0XC2,0X82,0X08,0XE2,0X00,0X08,0XA2,0XA5,0X00,0X61,0X05,0X00,
+0X81,0X00,0XE2,0X01,0X63,0X01,0XE3,0X02,0X23,0X02,0X63,0X80,0X02,0X83,0X09,0X02,
+0XA3,0X02,0XC3,0X02,0XE4,0X03,0X05,0X02,0XE4,0X02,0X83,0X01,0XC2,0X01,0X22,0X00,
+0XC2,0X00,0X81,0X80,0X00,0X61,0X83,0X00,0X81,0X04,0X00,0XA1,0X08,0X81,0X00,0XE2,
+0X02,0X23,0X03,0X64,0X80,0X03,0X85,0X05,0X03,0X64,0X03,0X43,0X03,0X02,0X02,0XE2,
+0X03,0X23,0X03,0X43,0X80,0X03,0X22,0X02,0X03,0X03,0X02,0X83,0X01,0X42,0X80,0X00,
+0X81,0X0A,0X00,0XE1,0X01,0X62,0X02,0X01,0X02,0X83,0X02,0XC3,0X02,0XE3,0X02,0XC3,
+0X02,0XA3,0X02,0X43,0X02,0X83,0X02,0XA3,0X81,0X02,0XC3,0X03,0X03,0X23,0X02,0X83,
+0X01,0X62,0X00,0XE2,0X81,0X01,0X02,0X01,0X01,0X22,0X01,0X02,0X83,0X01,0X22,0X8B,
+0X00,0X61,0X00,0X08,0X81,0X81,0X08,0XA2,0X00,0X08,0XA1,0X91,0X08,0X81,0X00,0X08,
+0XA1,0X83,0X08,0X81,0X80,0X00,0X61,0X83,0X08,0X81,0X00,0X00,0X81,0X80,0X00,0X61,
+0X80,0X08,0X81,0X00,0X08,0XC1,0X81,0X08,0XC2,0X85,0X08,0XE2,0X03,0X09,0X02,0X09,
+0X22,0X09,0X42,0X09,0X02,0X80,0X08,0XC2,0X00,0X08,0X81,0X87,0X00,0X61,0X00,0X08,
+0X81,0X80,0X09,0X02,0X00,0X08,0X82,0X8D,0X00,0X61,0X01,0X00,0X82,0X08,0X82,0X81,
+0X08,0XA2,0X85,0X00,0XA2,0X80,0X08,0XA2,0X02,0X08,0XA1,0X08,0XA2,0X00,0XA2,0X80,
+0X08,0XA2,0X00,0X00,0XA2,0X80,0X08,0XA2,0X80,0X08,0XC2,0X81,0X08,0XE2,0X00,0X08,
+0XA2,0X80,0X00,0X82,0X08,0X00,0XA2,0X08,0X82,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X09,
+0X02,0X09,0X43,0X09,0X22,0X01,0X02,0X80,0X09,0X23,0X01,0X01,0X23,0X09,0X43,0X80,
+0X09,0X23,0X03,0X09,0X83,0X11,0XE3,0X1A,0X44,0X1A,0X64,0X80,0X1A,0X63,0X0E,0X1A,
+0X64,0X12,0X23,0X11,0XC3,0X12,0X03,0X1A,0X43,0X11,0XE3,0X11,0X83,0X09,0X83,0X09,
+0X82,0X09,0X22,0X08,0X81,0X08,0XA1,0X09,0X42,0X09,0X83,0X11,0XA3,0X82,0X11,0XE3,
+0X02,0X09,0XA3,0X09,0X83,0X09,0XA3,0X82,0X11,0XC3,0X01,0X09,0X63,0X09,0X42,0X81,
+0X08,0XE2,0X82,0X09,0X02,0X03,0X00,0XE3,0X01,0X03,0X00,0XE3,0X08,0XE2,0X80,0X00,
+0XE3,0X80,0X01,0X03,0X03,0X00,0XE3,0X00,0XE2,0X08,0XE2,0X00,0XE2,0X80,0X01,0X03,
+0X80,0X08,0XC2,0X00,0X09,0X02,0X82,0X08,0XE2,0X00,0X08,0XA2,0XA3,0X00,0X61,0X10,
+0X00,0X81,0X00,0XE2,0X01,0X82,0X01,0XE3,0X02,0X23,0X02,0X63,0X02,0X83,0X02,0XA3,
+0X02,0XE4,0X03,0X25,0X03,0X45,0X03,0X86,0X03,0X66,0X02,0XC4,0X01,0XE2,0X01,0X22,
+0X00,0XA1,0X87,0X00,0X61,0X80,0X08,0X81,0X02,0X00,0XC2,0X01,0XE2,0X03,0X44,0X80,
+0X03,0X85,0X0A,0X03,0X64,0X03,0X22,0X03,0X21,0X03,0X22,0X03,0X43,0X03,0X42,0X03,
+0X22,0X03,0X03,0X02,0XA3,0X01,0XC3,0X00,0XC2,0X80,0X00,0X61,0X03,0X00,0X81,0X01,
+0X01,0X01,0XC1,0X02,0X83,0X80,0X02,0XE3,0X01,0X02,0XC3,0X02,0XA3,0X80,0X02,0X83,
+0X07,0X02,0XA3,0X02,0XC3,0X02,0XC4,0X03,0X04,0X03,0X65,0X02,0XE4,0X01,0X82,0X01,
+0X02,0X87,0X01,0X22,0X00,0X01,0X02,0X8A,0X00,0X61,0X01,0X08,0X81,0X08,0XA1,0X81,
+0X08,0XA2,0X80,0X08,0XA1,0X8F,0X08,0X81,0X81,0X08,0XA1,0X82,0X08,0X81,0X80,0X00,
+0X61,0X80,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0X81,0X00,0X00,0X81,0X83,0X00,0X61,
+0X00,0X08,0X82,0X80,0X08,0XA1,0X80,0X08,0XC2,0X82,0X09,0X02,0X80,0X08,0XE2,0X08,
+0X09,0X22,0X09,0X63,0X09,0X42,0X09,0X22,0X09,0X02,0X08,0XE2,0X08,0XC2,0X08,0XA2,
+0X08,0X81,0X84,0X00,0X61,0X03,0X00,0X81,0X09,0X02,0X09,0X43,0X00,0XA2,0X8C,0X00,
+0X61,0X01,0X00,0X82,0X08,0X82,0X82,0X08,0XA2,0X00,0X00,0XA2,0X80,0X08,0XA2,0X02,
+0X00,0XA2,0X08,0XA2,0X00,0XA2,0X81,0X08,0XA2,0X01,0X08,0X81,0X08,0XA1,0X80,0X00,
+0XA2,0X80,0X00,0XC2,0X80,0X00,0XA2,0X01,0X08,0XA2,0X08,0XC2,0X80,0X08,0XE2,0X03,
+0X08,0XC2,0X08,0XA2,0X00,0X61,0X00,0X82,0X80,0X08,0XA2,0X00,0X08,0XE2,0X80,0X09,
+0X22,0X02,0X09,0X43,0X09,0X83,0X09,0X43,0X80,0X09,0X22,0X01,0X09,0X23,0X01,0X23,
+0X80,0X09,0X43,0X02,0X09,0X63,0X11,0XC3,0X1A,0X44,0X80,0X1A,0X43,0X80,0X1A,0X84,
+0X05,0X1A,0X44,0X12,0X23,0X11,0XE3,0X1A,0X44,0X1A,0X64,0X11,0XE3,0X81,0X11,0XC3,
+0X07,0X09,0X63,0X08,0XC2,0X08,0X81,0X08,0XE2,0X09,0X62,0X09,0X63,0X11,0X82,0X11,
+0XC2,0X80,0X12,0X03,0X03,0X11,0XC3,0X09,0X83,0X09,0XA3,0X11,0XA3,0X82,0X11,0XE3,
+0X03,0X11,0XC3,0X11,0XA3,0X09,0X42,0X09,0X02,0X81,0X08,0XE2,0X00,0X09,0X02,0X81,
+0X01,0X03,0X01,0X08,0XE3,0X01,0X03,0X82,0X00,0XE3,0X00,0X00,0XE2,0X81,0X08,0XE2,
+0X05,0X00,0XE2,0X08,0XC2,0X08,0XE2,0X09,0X63,0X09,0X23,0X00,0XE2,0X80,0X08,0XE2,
+0X01,0X08,0XC2,0X00,0X82,0XA1,0X00,0X61,0X03,0X00,0X81,0X00,0XE2,0X01,0X82,0X02,
+0X03,0X80,0X02,0X43,0X03,0X02,0X42,0X02,0XA3,0X02,0XE5,0X03,0X26,0X80,0X03,0X46,
+0X04,0X03,0X05,0X02,0XC4,0X01,0XE3,0X01,0X22,0X00,0XA1,0X89,0X00,0X61,0X06,0X00,
+0X81,0X00,0XA2,0X01,0XC2,0X03,0X44,0X03,0X85,0X03,0X64,0X03,0X43,0X80,0X03,0X21,
+0X06,0X03,0X42,0X03,0X43,0X03,0X22,0X03,0X02,0X02,0X62,0X01,0XA2,0X00,0XE2,0X82,
+0X00,0X61,0X05,0X00,0XA1,0X01,0X42,0X02,0X43,0X02,0XE4,0X03,0X04,0X02,0XC3,0X80,
+0X02,0XA3,0X07,0X02,0X83,0X02,0XA3,0X02,0XE4,0X03,0X04,0X03,0X44,0X03,0X65,0X02,
+0XC4,0X01,0X82,0X80,0X01,0X22,0X01,0X01,0X42,0X01,0X22,0X81,0X01,0X42,0X80,0X01,
+0X22,0X01,0X01,0X02,0X01,0X22,0X89,0X00,0X61,0X01,0X08,0X81,0X08,0XA1,0X83,0X08,
+0XA2,0X00,0X08,0XA1,0X9A,0X08,0X81,0X00,0X08,0XA1,0X81,0X08,0X81,0X83,0X00,0X61,
+0X80,0X08,0X81,0X80,0X08,0XA2,0X03,0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X22,0X81,
+0X09,0X02,0X00,0X09,0X22,0X81,0X09,0X42,0X80,0X09,0X22,0X80,0X09,0X02,0X02,0X08,
+0XC2,0X08,0XA1,0X08,0X81,0X83,0X00,0X61,0X02,0X00,0XC2,0X01,0X23,0X00,0XC2,0X8B,
+0X00,0X61,0X01,0X00,0X82,0X00,0XA2,0X82,0X08,0XA2,0X80,0X08,0XA1,0X80,0X08,0XA2,
+0X00,0X00,0XA1,0X80,0X00,0XA2,0X81,0X08,0XA2,0X04,0X08,0XA1,0X08,0X81,0X08,0XA1,
+0X08,0XA2,0X08,0XC2,0X82,0X00,0XC2,0X00,0X00,0XE2,0X80,0X08,0XE2,0X80,0X08,0XA2,
+0X09,0X00,0X61,0X08,0XA2,0X08,0XC2,0X08,0XE2,0X09,0X23,0X09,0X43,0X09,0X23,0X09,
+0X22,0X09,0X43,0X09,0X22,0X80,0X01,0X23,0X0D,0X09,0X23,0X09,0X22,0X09,0X23,0X09,
+0X43,0X11,0XC3,0X1A,0X64,0X22,0XC4,0X1A,0X64,0X12,0X44,0X1A,0X85,0X1A,0X84,0X12,
+0X03,0X11,0XE3,0X12,0X03,0X80,0X1A,0X64,0X08,0X12,0X03,0X11,0XE3,0X11,0XC3,0X11,
+0XE3,0X11,0XC3,0X09,0X22,0X00,0X81,0X08,0X81,0X09,0X02,0X80,0X09,0X62,0X01,0X09,
+0X82,0X11,0XA2,0X80,0X11,0XC3,0X04,0X11,0XA3,0X09,0X82,0X09,0X83,0X09,0XA3,0X11,
+0XC3,0X80,0X11,0XE3,0X81,0X12,0X03,0X03,0X11,0XC3,0X11,0X83,0X09,0X22,0X09,0X02,
+0X80,0X08,0XE2,0X80,0X01,0X03,0X02,0X09,0X02,0X01,0X02,0X08,0XE3,0X80,0X00,0XE2,
+0X00,0X08,0XE2,0X80,0X00,0XE2,0X80,0X08,0XE2,0X04,0X00,0XE2,0X08,0XC2,0X08,0XE2,
+0X09,0X83,0X09,0X43,0X82,0X08,0XE2,0X00,0X00,0XA2,0XA0,0X00,0X61,0X03,0X00,0X81,
+0X00,0XE2,0X01,0X83,0X01,0XE3,0X80,0X02,0X43,0X0A,0X02,0X42,0X02,0X43,0X02,0X84,
+0X02,0XC5,0X02,0XC6,0X02,0X85,0X02,0X44,0X01,0XE3,0X01,0X62,0X00,0XE2,0X00,0X81,
+0X8B,0X00,0X61,0X04,0X00,0XA1,0X01,0XC2,0X03,0X24,0X03,0X64,0X03,0X42,0X80,0X03,
+0X21,0X07,0X03,0X22,0X03,0X42,0X03,0X43,0X03,0X02,0X02,0X82,0X01,0XA2,0X00,0XE2,
+0X00,0X81,0X83,0X00,0X61,0X0A,0X00,0XC1,0X01,0X82,0X02,0X84,0X02,0XE4,0X02,0XC3,
+0X02,0XA3,0X02,0XC3,0X02,0XA3,0X02,0XE4,0X03,0X25,0X03,0X66,0X80,0X03,0X86,0X02,
+0X02,0XA4,0X01,0X62,0X01,0X02,0X81,0X01,0X42,0X00,0X01,0X62,0X81,0X01,0X82,0X80,
+0X01,0X42,0X00,0X01,0X22,0X88,0X00,0X61,0X01,0X08,0X81,0X08,0XA1,0X84,0X08,0XA2,
+0X00,0X08,0X81,0X80,0X08,0XA1,0X8E,0X08,0X81,0X00,0X08,0XA1,0X87,0X08,0X81,0X00,
+0X08,0XA1,0X82,0X08,0X81,0X80,0X00,0X81,0X80,0X08,0X81,0X02,0X00,0X61,0X08,0X81,
+0X08,0XA1,0X80,0X08,0XC1,0X00,0X08,0XE2,0X80,0X09,0X02,0X00,0X09,0X22,0X80,0X09,
+0X02,0X00,0X09,0X22,0X80,0X09,0X42,0X82,0X09,0X22,0X80,0X09,0X42,0X02,0X09,0X22,
+0X08,0XE2,0X08,0X81,0X82,0X00,0X61,0X02,0X00,0X81,0X00,0XA2,0X00,0X82,0X8B,0X00,
+0X61,0X01,0X00,0X82,0X00,0XA2,0X82,0X08,0XA2,0X00,0X08,0X82,0X80,0X08,0X81,0X00,
+0X08,0XA1,0X80,0X08,0XA2,0X04,0X00,0XA2,0X08,0XC2,0X00,0XA2,0X08,0XA2,0X00,0XA2,
+0X82,0X08,0XA2,0X81,0X08,0XC2,0X00,0X00,0XC2,0X80,0X08,0XE2,0X01,0X08,0XC2,0X08,
+0XA2,0X80,0X00,0X82,0X02,0X08,0XE2,0X09,0X02,0X09,0X22,0X80,0X09,0X63,0X00,0X09,
+0X23,0X80,0X09,0X43,0X80,0X09,0X23,0X80,0X01,0X23,0X80,0X09,0X23,0X04,0X09,0X83,
+0X12,0X24,0X1A,0X84,0X22,0XE4,0X1A,0XA4,0X81,0X1A,0X43,0X07,0X12,0X03,0X11,0XE3,
+0X12,0X03,0X1A,0X63,0X1A,0X43,0X12,0X04,0X11,0XE3,0X11,0XC3,0X80,0X11,0XE3,0X09,
+0X09,0X62,0X08,0XA1,0X00,0X61,0X08,0XC1,0X09,0X62,0X11,0XC3,0X11,0X83,0X09,0X62,
+0X09,0X42,0X11,0X82,0X80,0X11,0XA2,0X03,0X09,0X83,0X09,0XA3,0X11,0XC3,0X11,0XE3,
+0X80,0X11,0XA3,0X08,0X11,0XE3,0X12,0X23,0X1A,0X44,0X12,0X44,0X11,0XE3,0X09,0XA3,
+0X09,0X42,0X09,0X02,0X00,0XE2,0X82,0X08,0XE2,0X04,0X09,0X03,0X08,0XE3,0X00,0XE3,
+0X08,0XE2,0X01,0X02,0X80,0X08,0XE2,0X00,0X00,0XE2,0X80,0X08,0XC2,0X80,0X09,0X02,
+0X81,0X08,0XE2,0X02,0X08,0XC2,0X08,0XA2,0X00,0X81,0X9F,0X00,0X61,0X02,0X00,0XE2,
+0X01,0X83,0X01,0XE3,0X80,0X02,0X23,0X01,0X02,0X03,0X01,0XE3,0X80,0X01,0XC3,0X06,
+0X01,0XA3,0X01,0X63,0X01,0X22,0X01,0X02,0X00,0XC1,0X00,0XA1,0X00,0X81,0X8C,0X00,
+0X61,0X03,0X00,0XA1,0X01,0XA2,0X03,0X03,0X03,0X42,0X81,0X03,0X21,0X80,0X03,0X43,
+0X03,0X03,0X03,0X02,0X63,0X01,0X62,0X00,0XC2,0X86,0X00,0X61,0X07,0X00,0XC1,0X01,
+0XA3,0X02,0X63,0X02,0XA3,0X02,0XC3,0X03,0X04,0X03,0X05,0X03,0X46,0X81,0X03,0XA8,
+0X06,0X03,0X87,0X02,0XA5,0X01,0X82,0X01,0X41,0X01,0X62,0X01,0X82,0X01,0X62,0X80,
+0X01,0X82,0X83,0X01,0XA2,0X88,0X00,0X61,0X00,0X08,0X81,0X86,0X08,0XA2,0X02,0X08,
+0XA1,0X08,0X81,0X08,0XA1,0X94,0X08,0X81,0X82,0X08,0XA1,0X82,0X08,0X81,0X06,0X08,
+0XA1,0X08,0XA2,0X08,0XA1,0X08,0X81,0X00,0X61,0X08,0X81,0X08,0XC1,0X80,0X08,0XE1,
+0X81,0X09,0X02,0X81,0X09,0X22,0X00,0X09,0X42,0X80,0X09,0X62,0X09,0X09,0X42,0X09,
+0X22,0X09,0X42,0X09,0XA3,0X12,0X04,0X11,0XC4,0X11,0X83,0X09,0X62,0X08,0XE2,0X00,
+0X81,0X90,0X00,0X61,0X01,0X00,0X82,0X08,0XA2,0X81,0X00,0XA2,0X03,0X08,0XA2,0X00,
+0XA2,0X08,0XA2,0X08,0X82,0X80,0X08,0XA1,0X01,0X00,0XA2,0X00,0X82,0X81,0X08,0XA2,
+0X02,0X00,0XC2,0X00,0XE2,0X08,0XE2,0X80,0X08,0XA2,0X01,0X00,0XA2,0X00,0XC2,0X80,
+0X08,0XC2,0X80,0X08,0XE2,0X0A,0X08,0XC2,0X08,0XA2,0X08,0XA1,0X08,0X82,0X08,0XC2,
+0X09,0X02,0X09,0X22,0X09,0X63,0X09,0X83,0X09,0X63,0X09,0X43,0X80,0X09,0X63,0X81,
+0X09,0X43,0X03,0X09,0X23,0X01,0X23,0X09,0X63,0X11,0XE3,0X81,0X1A,0X43,0X01,0X1A,
+0X84,0X1A,0X64,0X80,0X1A,0X84,0X00,0X1A,0X64,0X80,0X12,0X23,0X04,0X1A,0X63,0X1A,
+0X43,0X12,0X04,0X11,0XC3,0X11,0XA2,0X80,0X11,0XE3,0X04,0X09,0X62,0X08,0XA1,0X00,
+0X61,0X08,0X81,0X09,0X02,0X80,0X11,0XE3,0X07,0X11,0X62,0X09,0X22,0X09,0X42,0X11,
+0X62,0X11,0XA3,0X11,0XC3,0X11,0XA3,0X09,0XA3,0X80,0X11,0XA3,0X10,0X11,0XA2,0X11,
+0XE3,0X12,0X24,0X1A,0X44,0X1A,0X43,0X1A,0X23,0X12,0X24,0X11,0XE4,0X09,0X83,0X09,
+0X42,0X09,0X02,0X00,0XC2,0X08,0XC2,0X00,0XC2,0X08,0XE2,0X09,0X02,0X01,0X23,0X80,
+0X01,0X03,0X80,0X08,0XE2,0X05,0X00,0XE2,0X00,0XC2,0X08,0XE2,0X08,0XC2,0X08,0XE2,
+0X08,0XC2,0X80,0X08,0XE2,0X02,0X08,0XC2,0X08,0XA2,0X00,0X82,0X9E,0X00,0X61,0X02,
+0X00,0XA2,0X01,0X42,0X01,0XC3,0X80,0X02,0X03,0X06,0X01,0XC3,0X01,0X62,0X01,0X22,
+0X00,0XE2,0X00,0XC2,0X00,0XA2,0X00,0X81,0X91,0X00,0X61,0X02,0X00,0X81,0X01,0X82,
+0X02,0XE2,0X80,0X03,0X21,0X06,0X03,0X22,0X03,0X43,0X03,0X85,0X03,0X24,0X02,0X23,
+0X01,0X22,0X00,0XA2,0X87,0X00,0X61,0X18,0X08,0X61,0X00,0XC2,0X01,0X62,0X02,0X43,
+0X02,0XC4,0X03,0X46,0X03,0XA8,0X03,0XA9,0X0B,0XCB,0X0B,0XAA,0X03,0XA8,0X03,0XA7,
+0X02,0X85,0X01,0X82,0X01,0X62,0X01,0XA2,0X01,0XC2,0X01,0XA2,0X01,0X82,0X01,0XA2,
+0X01,0XC2,0X01,0XE2,0X02,0X02,0X02,0X42,0X02,0X63,0X88,0X00,0X61,0X00,0X08,0X81,
+0X80,0X08,0XA2,0X80,0X08,0XA1,0X80,0X08,0XA2,0X00,0X08,0XA1,0X81,0X08,0XA2,0X80,
+0X08,0XA1,0X8F,0X08,0X81,0X04,0X08,0XA1,0X08,0XA2,0X08,0XA1,0X08,0XA2,0X08,0XC1,
+0X83,0X08,0XA2,0X00,0X08,0X81,0X80,0X08,0XA1,0X02,0X08,0XC1,0X08,0XC2,0X08,0XA1,
+0X80,0X00,0X81,0X04,0X08,0XA1,0X08,0XC2,0X08,0XE2,0X09,0X02,0X09,0X22,0X80,0X09,
+0X02,0X81,0X09,0X22,0X00,0X09,0X42,0X80,0X09,0X62,0X08,0X09,0X42,0X09,0X62,0X11,
+0XE3,0X12,0X24,0X11,0XE4,0X11,0XC3,0X11,0XA3,0X09,0X42,0X08,0XC1,0X8F,0X00,0X61,
+0X80,0X08,0X82,0X80,0X08,0XA2,0X80,0X00,0XA2,0X80,0X08,0XA2,0X02,0X00,0XA2,0X08,
+0XA2,0X00,0XA2,0X80,0X00,0XC2,0X06,0X00,0XA2,0X00,0X82,0X00,0XA2,0X00,0XC2,0X00,
+0XE3,0X01,0X03,0X00,0XE3,0X80,0X00,0XA2,0X02,0X08,0XC2,0X08,0XE2,0X00,0XE2,0X80,
+0X08,0XE2,0X00,0X08,0XC2,0X81,0X08,0XA1,0X05,0X00,0XC2,0X08,0XE2,0X09,0X22,0X09,
+0X42,0X09,0X83,0X09,0XA3,0X80,0X09,0X63,0X82,0X09,0X43,0X00,0X09,0X63,0X80,0X09,
+0X43,0X06,0X11,0XC3,0X1A,0X64,0X1A,0XA4,0X1A,0X43,0X1A,0X64,0X1A,0XA4,0X1A,0X84,
+0X80,0X1A,0XE5,0X0B,0X1A,0XA4,0X1A,0X44,0X1A,0X64,0X1A,0XA4,0X1A,0X44,0X12,0X24,
+0X12,0X23,0X1A,0X44,0X1A,0X24,0X12,0X03,0X11,0X82,0X08,0XC2,0X80,0X00,0X61,0X03,
+0X00,0X81,0X11,0X62,0X12,0X03,0X11,0XC3,0X80,0X09,0X42,0X01,0X09,0X22,0X09,0X62,
+0X80,0X11,0XC3,0X01,0X11,0XC2,0X11,0XA3,0X81,0X11,0XE3,0X09,0X1A,0X24,0X1A,0X64,
+0X1A,0X43,0X1A,0X03,0X1A,0X44,0X1A,0X64,0X12,0X04,0X11,0XE3,0X11,0XA3,0X09,0X42,
+0X82,0X08,0XE2,0X00,0X01,0X03,0X80,0X09,0X23,0X80,0X01,0X03,0X01,0X09,0X03,0X00,
+0XE3,0X82,0X08,0XE2,0X80,0X09,0X02,0X02,0X08,0XE2,0X00,0XC2,0X08,0X82,0X9D,0X00,
+0X61,0X02,0X00,0X81,0X01,0X02,0X01,0XA2,0X80,0X01,0XC3,0X03,0X01,0X83,0X01,0X02,
+0X00,0XA1,0X00,0X81,0X95,0X00,0X61,0X03,0X00,0X81,0X01,0X82,0X02,0XE2,0X03,0X42,
+0X80,0X03,0X85,0X05,0X03,0X65,0X02,0XE4,0X01,0XE3,0X01,0X02,0X00,0X81,0X00,0X62,
+0X89,0X00,0X61,0X04,0X00,0XC1,0X01,0X42,0X02,0X04,0X03,0X06,0X03,0X87,0X80,0X03,
+0X88,0X06,0X03,0X67,0X03,0X26,0X03,0X06,0X02,0X24,0X01,0X22,0X01,0X02,0X01,0XA2,
+0X80,0X02,0X02,0X80,0X01,0XA2,0X04,0X01,0XC2,0X02,0X02,0X02,0X83,0X02,0XC4,0X02,
+0XE4,0X87,0X00,0X61,0X80,0X08,0X81,0X83,0X08,0XA1,0X01,0X08,0XA2,0X08,0XA1,0X82,
+0X08,0XA2,0X00,0X08,0XA1,0X8F,0X08,0X81,0X00,0X08,0XA1,0X80,0X08,0XC2,0X00,0X08,
+0XC1,0X81,0X08,0XC2,0X00,0X08,0XC1,0X82,0X08,0XA1,0X80,0X08,0XC2,0X06,0X08,0XE1,
+0X08,0XC2,0X08,0XA1,0X00,0X81,0X08,0X81,0X08,0XC2,0X09,0X02,0X86,0X09,0X22,0X04,
+0X09,0X42,0X09,0X62,0X09,0X63,0X09,0X82,0X11,0XA3,0X80,0X11,0XC3,0X04,0X11,0XE3,
+0X11,0XC3,0X11,0X82,0X09,0X02,0X08,0X81,0X8E,0X00,0X61,0X00,0X08,0X82,0X82,0X00,
+0XA2,0X00,0X08,0XA2,0X82,0X00,0XA2,0X02,0X00,0XE2,0X00,0XE3,0X00,0XE2,0X80,0X00,
+0XC2,0X00,0X08,0XC2,0X81,0X00,0XE2,0X08,0X00,0XC2,0X08,0XA2,0X08,0XC2,0X00,0XE2,
+0X08,0XE2,0X00,0XE2,0X09,0X02,0X08,0XC2,0X08,0XA2,0X80,0X08,0XA1,0X01,0X08,0XA2,
+0X08,0XE2,0X80,0X09,0X22,0X04,0X09,0X43,0X09,0X63,0X09,0X83,0X09,0X63,0X09,0X43,
+0X80,0X09,0X22,0X01,0X09,0X23,0X09,0X43,0X80,0X09,0X63,0X0B,0X09,0X83,0X12,0X24,
+0X1A,0XC5,0X22,0XC5,0X1A,0X64,0X1A,0XE5,0X23,0X05,0X1A,0XA4,0X1A,0XE5,0X1B,0X05,
+0X1A,0XC5,0X1A,0X84,0X80,0X1A,0XC4,0X80,0X12,0X44,0X06,0X1A,0X85,0X1A,0X84,0X12,
+0X03,0X11,0XE3,0X11,0XC3,0X09,0X22,0X00,0X81,0X80,0X00,0X61,0X03,0X08,0XC1,0X11,
+0X82,0X11,0XE3,0X11,0X82,0X81,0X09,0X42,0X0C,0X09,0X82,0X11,0XC3,0X11,0XE3,0X11,
+0XC3,0X11,0XE3,0X12,0X03,0X11,0XE3,0X12,0X24,0X1A,0X64,0X12,0X23,0X11,0XE3,0X1A,
+0X23,0X1A,0X84,0X80,0X1A,0X64,0X03,0X1A,0X44,0X11,0XE3,0X09,0X83,0X09,0X22,0X81,
+0X08,0XE2,0X02,0X09,0X02,0X01,0X22,0X01,0X03,0X80,0X01,0X23,0X80,0X01,0X03,0X80,
+0X00,0XE3,0X06,0X00,0XE2,0X08,0XE2,0X09,0X03,0X09,0X02,0X08,0XE2,0X00,0XA2,0X00,
+0X81,0X9C,0X00,0X61,0X06,0X00,0XE2,0X01,0X62,0X01,0XA2,0X01,0X83,0X01,0X22,0X00,
+0XC2,0X00,0X81,0X97,0X00,0X61,0X09,0X00,0XA1,0X01,0XA2,0X03,0X03,0X03,0X85,0X0B,
+0XC8,0X03,0XA7,0X02,0XC4,0X01,0XC3,0X00,0XC2,0X08,0X61,0X8C,0X00,0X61,0X06,0X00,
+0XA2,0X01,0X22,0X02,0X24,0X03,0X06,0X03,0X26,0X02,0XE5,0X02,0XE4,0X80,0X02,0XC4,
+0X05,0X02,0X03,0X00,0XC2,0X00,0XA1,0X01,0X62,0X02,0X03,0X02,0X22,0X81,0X01,0XE2,
+0X03,0X02,0X22,0X02,0XA3,0X02,0XE4,0X03,0X05,0X87,0X00,0X61,0X01,0X08,0X81,0X08,
+0XA2,0X80,0X08,0XA1,0X00,0X08,0XC1,0X82,0X08,0XA1,0X81,0X08,0XA2,0X80,0X08,0XA1,
+0X8F,0X08,0X81,0X01,0X08,0XC1,0X08,0XE2,0X81,0X08,0XE1,0X82,0X08,0XC2,0X80,0X08,
+0XA1,0X80,0X08,0XC2,0X00,0X08,0XE2,0X80,0X09,0X02,0X04,0X08,0XC1,0X08,0X81,0X00,
+0X61,0X08,0XA1,0X09,0X02,0X81,0X09,0X22,0X02,0X09,0X02,0X09,0X22,0X09,0X42,0X81,
+0X09,0X22,0X81,0X09,0X62,0X01,0X11,0X82,0X11,0XA3,0X80,0X11,0XC3,0X04,0X11,0XA2,
+0X11,0X82,0X09,0X22,0X08,0XA2,0X00,0X62,0X8D,0X00,0X61,0X00,0X00,0X82,0X80,0X08,
+0XA2,0X81,0X00,0XA2,0X80,0X08,0XA1,0X80,0X00,0XA2,0X83,0X00,0XC2,0X80,0X08,0XE2,
+0X01,0X00,0XC2,0X00,0XE2,0X80,0X08,0XC2,0X83,0X08,0XE2,0X05,0X08,0XA2,0X00,0X81,
+0X08,0X81,0X08,0XA1,0X08,0XC2,0X09,0X02,0X80,0X09,0X22,0X00,0X09,0X43,0X81,0X09,
+0X63,0X80,0X09,0X43,0X83,0X09,0X63,0X16,0X09,0XA3,0X1A,0X44,0X22,0XE5,0X23,0X05,
+0X22,0XC4,0X22,0XE4,0X1A,0XE5,0X1A,0XC5,0X1A,0XE5,0X1A,0XC5,0X1A,0XA5,0X1A,0X84,
+0X1A,0XC4,0X1A,0XA5,0X12,0X44,0X12,0X65,0X1A,0XA5,0X12,0X44,0X11,0XC3,0X11,0XE3,
+0X1A,0X23,0X09,0X62,0X00,0X82,0X80,0X00,0X61,0X04,0X08,0X61,0X08,0XE2,0X11,0X82,
+0X11,0XA2,0X11,0X82,0X80,0X09,0X62,0X01,0X09,0X42,0X09,0X82,0X81,0X11,0XC3,0X80,
+0X11,0XE3,0X01,0X12,0X03,0X12,0X24,0X80,0X11,0XE3,0X01,0X12,0X23,0X1A,0X64,0X80,
+0X1A,0X84,0X80,0X1A,0XA4,0X08,0X1A,0X44,0X11,0XC3,0X09,0X43,0X09,0X02,0X08,0XE2,
+0X01,0X02,0X09,0X02,0X08,0XE2,0X01,0X03,0X80,0X01,0X43,0X00,0X01,0X23,0X80,0X01,
+0X03,0X00,0X08,0XE3,0X80,0X01,0X03,0X03,0X09,0X02,0X00,0XE2,0X08,0XE2,0X00,0X82,
+0X9B,0X00,0X61,0X01,0X00,0XA1,0X01,0X22,0X80,0X01,0X62,0X01,0X00,0XE2,0X00,0X81,
+0X99,0X00,0X61,0X07,0X00,0XA2,0X01,0XC2,0X03,0X44,0X0B,0XC7,0X13,0XE9,0X03,0X26,
+0X01,0XC3,0X00,0XC1,0X8F,0X00,0X61,0X14,0X00,0X81,0X01,0X43,0X02,0X44,0X02,0XA4,
+0X02,0XE5,0X03,0X26,0X03,0X05,0X02,0XC4,0X01,0XE3,0X00,0XC2,0X00,0X81,0X01,0X02,
+0X01,0XE3,0X02,0X63,0X02,0X43,0X02,0X22,0X02,0X02,0X02,0X22,0X02,0X83,0X02,0XE4,
+0X03,0X05,
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Run length coding of 16 bit pixels
+//
+// The stream is a sequence of packets, each starting with a control byte:
+//   0x00-0x7F  literal, (ctl + 1) pixels follow
+//   0x80-0xFF  repeat, the following pixel is repeated (ctl - 0x80 + 2) times
+// Pixels are stored in memory byte order, so LV_COLOR_16_SWAP is preserved.
+#define RLE565_MAX_LITERAL 128
+#define RLE565_MAX_REPEAT 129
+
+// Encode up to count pixels from src into at most dst_len bytes of dst.
+// Stops early when dst is full, *consumed is set to the number of pixels encoded.
+// Returns the number of bytes written
+extern size_t rle565_encode(const uint16_t *src, size_t count, uint8_t *dst, size_t dst_len, size_t *consumed);
+
+// Decoder state, so a stream can be decoded a few lines at a time
+typedef struct {
+    const uint8_t *src;
+    const uint8_t *end;
+    uint16_t px; // Pixel being repeated
+    uint16_t left; // Pixels left in the current packet
+    bool repeat;
+} rle565_decoder_t;
+
+extern void rle565_decoder_init(rle565_decoder_t *dec, const uint8_t *src, size_t len);
+
+// Decode up to count pixels into dst, continuing where the last call stopped.
+// Returns the number of pixels written, less than count at the end of the stream
+extern size_t rle565_decode(rle565_decoder_t *dec, uint16_t *dst, size_t count);
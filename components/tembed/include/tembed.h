@@ -55,3 +55,19 @@ extern tembed_t tembed_init(
     esp_lcd_panel_io_color_trans_done_cb_t notify_color_trans_done, void *user_data
 #endif
     );
+
+// Staged initialization, so the slow parts can be run concurrently.
+// tembed_init() runs all of them in turn. Power must be first
+extern tembed_t tembed_init_power(void);
+#ifdef CONFIG_TEMBED_INIT_LEDS
+extern void tembed_init_leds(void);
+#endif
+#ifdef CONFIG_TEMBED_INIT_LCD
+extern void tembed_init_lcd(esp_lcd_panel_io_color_trans_done_cb_t notify_color_trans_done, void *user_data);
+#endif
+#ifdef CONFIG_TEMBED_INIT_DIAL
+extern void tembed_init_dial(void);
+#endif
+#ifdef CONFIG_TEMBED_INIT_WIFI
+extern void tembed_init_wifi(void);
+#endif
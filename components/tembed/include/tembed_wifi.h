@@ -2,3 +2,6 @@
 #include "esp_wifi.h"
 
 extern esp_netif_t *wifi_init(void);
+
+// Start SNTP, call once the network interface exists
+extern void initialize_sntp(void);
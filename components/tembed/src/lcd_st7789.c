@@ -1,14 +1,22 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
 #include "hal/spi_types.h"
 #include "driver/spi_master.h"
-#include "img_logo.h"
+#include "esp_heap_caps.h"
 #include "esp_err.h"
 #include "esp_log.h"
 
+#if CONFIG_TEMBED_LOGO_COMPRESSED
+#include "img_logo_rle.h"
+#include "rle565.h"
+#else
+#include "img_logo.h"
+#endif
+
 #include "st7789.h"
 
 static const char *TAG="lcd";
@@ -20,6 +28,44 @@ typedef struct {
     uint8_t len;
 } lcd_cmd_t;
 
+#if CONFIG_TEMBED_LOGO_COMPRESSED
+#define LOGO_STRIPE_LINES 10
+#define LOGO_STRIPE_PIXELS (IMG_LOGO_W * LOGO_STRIPE_LINES)
+
+// Decode the logo a stripe at a time into two DMA buffers, so one stripe is
+// decoded while the previous one is on the bus
+static void draw_logo(esp_lcd_panel_handle_t panel_handle, esp_lcd_panel_io_handle_t io_handle) {
+    uint16_t *stripes[2];
+    rle565_decoder_t dec;
+
+    for(int i=0;i<2;i++) {
+        stripes[i] = heap_caps_malloc(LOGO_STRIPE_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+        if(!stripes[i]) {
+            ESP_LOGW(TAG, "No memory for the logo");
+            if(i) free(stripes[0]);
+            return;
+        }
+    }
+
+    rle565_decoder_init(&dec, img_logo_rle, sizeof(img_logo_rle));
+    for(int y=0, i=0;y<IMG_LOGO_H;y+=LOGO_STRIPE_LINES, i^=1) {
+        int lines = IMG_LOGO_H - y < LOGO_STRIPE_LINES ? IMG_LOGO_H - y : LOGO_STRIPE_LINES;
+        if(rle565_decode(&dec, stripes[i], lines * IMG_LOGO_W) != lines * IMG_LOGO_W) {
+            ESP_LOGW(TAG, "Logo truncated at line %d", y);
+            break;
+        }
+        // Setting the window waits for the transfer before last, so this
+        // stripe's buffer is always free by the time it is decoded into
+        esp_lcd_panel_draw_bitmap(panel_handle, 0, y, IMG_LOGO_W, y + lines, stripes[i]);
+    }
+
+    // Any command waits for the queued pixel transfers to finish
+    ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io_handle, LCD_CMD_NOP, NULL, 0));
+    free(stripes[0]);
+    free(stripes[1]);
+}
+#endif
+
 esp_lcd_panel_handle_t tembed_init_lcd_st7789(esp_lcd_panel_io_color_trans_done_cb_t color_trans_done, void *user_data) {
 
     ESP_LOGI(TAG, "Backlight off");
@@ -77,9 +123,8 @@ esp_lcd_panel_handle_t tembed_init_lcd_st7789(esp_lcd_panel_io_color_trans_done_
 
     ESP_LOGI(TAG, "Init lcd");
     ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle));
-    vTaskDelay(pdMS_TO_TICKS(500));
-    ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
-    vTaskDelay(pdMS_TO_TICKS(500));
+    vTaskDelay(pdMS_TO_TICKS(120)); // ST7789 needs 120ms after reset before sleep out
+    ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle)); // Waits after sleep out itself
 
     // Command sequence from https://github.com/Xinyuan-LilyGO/T-Embed/blob/main/example/tft/tft.ino#L12
     lcd_cmd_t lcd_st7789v[] = {
@@ -119,7 +164,11 @@ esp_lcd_panel_handle_t tembed_init_lcd_st7789(esp_lcd_panel_io_color_trans_done_
     esp_lcd_panel_mirror(panel_handle, true, false);
 
     // Draw the LILYGO Logo as a test and whilst we're initializing the rest of the app
+#if CONFIG_TEMBED_LOGO_COMPRESSED
+    draw_logo(panel_handle, io_handle);
+#else
     esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, 320, 170, img_logo);
+#endif
 
     return panel_handle;
 }
@@ -0,0 +1,83 @@
+#include <string.h>
+#include "rle565.h"
+
+size_t rle565_encode(const uint16_t *src, size_t count, uint8_t *dst, size_t dst_len, size_t *consumed) {
+    size_t i = 0;
+    size_t o = 0;
+
+    while(i < count) {
+        size_t run = 1;
+        while(i + run < count && run < RLE565_MAX_REPEAT && src[i + run] == src[i]) run++;
+
+        if(run >= 2) {
+            if(o + 1 + sizeof(uint16_t) > dst_len) break;
+            dst[o++] = 0x80 | (run - 2);
+            memcpy(&dst[o], &src[i], sizeof(uint16_t));
+            o += sizeof(uint16_t);
+            i += run;
+            continue;
+        }
+
+        // Literal, up to the start of the next repeat
+        size_t lit = 1;
+        while(i + lit < count && lit < RLE565_MAX_LITERAL &&
+              !(i + lit + 1 < count && src[i + lit] == src[i + lit + 1])) lit++;
+
+        if(o + 1 + sizeof(uint16_t) > dst_len) break;
+        size_t room = (dst_len - o - 1) / sizeof(uint16_t);
+        if(lit > room) lit = room;
+        dst[o++] = lit - 1;
+        memcpy(&dst[o], &src[i], lit * sizeof(uint16_t));
+        o += lit * sizeof(uint16_t);
+        i += lit;
+    }
+
+    *consumed = i;
+    return o;
+}
+
+void rle565_decoder_init(rle565_decoder_t *dec, const uint8_t *src, size_t len) {
+    dec->src = src;
+    dec->end = src + len;
+    dec->px = 0;
+    dec->left = 0;
+    dec->repeat = false;
+}
+
+size_t rle565_decode(rle565_decoder_t *dec, uint16_t *dst, size_t count) {
+    size_t n = 0;
+
+    while(n < count) {
+        if(!dec->left) {
+            if(dec->src >= dec->end) break;
+            uint8_t ctl = *dec->src++;
+            if(ctl & 0x80) {
+                if(dec->end - dec->src < sizeof(uint16_t)) goto truncated;
+                dec->repeat = true;
+                dec->left = (ctl & 0x7f) + 2;
+                memcpy(&dec->px, dec->src, sizeof(uint16_t));
+                dec->src += sizeof(uint16_t);
+            } else {
+                dec->repeat = false;
+                dec->left = ctl + 1;
+            }
+        }
+
+        size_t take = dec->left < count - n ? dec->left : count - n;
+        if(dec->repeat) {
+            for(size_t i = 0; i < take; i++) dst[n + i] = dec->px;
+        } else {
+            if(dec->end - dec->src < take * sizeof(uint16_t)) goto truncated;
+            memcpy(&dst[n], dec->src, take * sizeof(uint16_t));
+            dec->src += take * sizeof(uint16_t);
+        }
+        n += take;
+        dec->left -= take;
+    }
+    return n;
+
+truncated:
+    dec->src = dec->end;
+    dec->left = 0;
+    return n;
+}
@@ -5,6 +5,8 @@
  */
 
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 #include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -14,6 +16,8 @@
 #include "esp_log.h"
 #include "esp_vfs_fat.h"
 #include "sdmmc_cmd.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
 
 #define MOUNT_POINT "/sdcard"
 
@@ -23,8 +27,76 @@
 #define PIN_NUM_CLK  40
 #define PIN_NUM_CS   39
 
+// Largest single SPI transaction, multi-sector reads and writes are split into these
+#define SDCARD_MAX_TRANSFER (32 * 1024)
+
+// Written at the probing clock and read back at each faster clock to check it
+#define SDCARD_SCRATCH MOUNT_POINT "/clkcheck.bin"
+#define SDCARD_SCRATCH_LEN (16 * 1024)
+
 static const char *TAG="sdcard";
 
+static bool sdcard_read_matches(const uint8_t *expect, uint8_t *buf) {
+    FILE *f = fopen(SDCARD_SCRATCH, "rb");
+    if(!f) {
+        return false;
+    }
+    size_t n = fread(buf, 1, SDCARD_SCRATCH_LEN, f);
+    fclose(f);
+    return n == SDCARD_SCRATCH_LEN && memcmp(expect, buf, SDCARD_SCRATCH_LEN) == 0;
+}
+
+// Step the card clock up to the fastest rate at which a scratch file reads
+// back intact. The file is written at the probing clock, so a marginal
+// clock can only corrupt reads, never the filesystem. Returns the clock used
+static int sdcard_set_fastest_clock(sdmmc_card_t *card) {
+    int freq = SDMMC_FREQ_PROBING;
+    uint8_t *expect = malloc(SDCARD_SCRATCH_LEN);
+    uint8_t *buf = heap_caps_malloc(SDCARD_SCRATCH_LEN, MALLOC_CAP_DMA);
+    FILE *f = NULL;
+
+    if(!expect || !buf) {
+        ESP_LOGE(TAG, "No memory to check the card clock");
+        goto done;
+    }
+    esp_fill_random(expect, SDCARD_SCRATCH_LEN);
+
+    f = fopen(SDCARD_SCRATCH, "wb");
+    if(!f || fwrite(expect, 1, SDCARD_SCRATCH_LEN, f) != SDCARD_SCRATCH_LEN) {
+        ESP_LOGE(TAG, "Can't write %s, staying at %dkHz", SDCARD_SCRATCH, freq);
+        goto done;
+    }
+    fsync(fileno(f));
+    fclose(f);
+    f = NULL;
+
+    for(int khz = CONFIG_TEMBED_SDCARD_MAX_FREQ_KHZ; khz > SDMMC_FREQ_PROBING; khz /= 2) {
+        if(card->host.set_card_clk(card->host.slot, khz) != ESP_OK) {
+            continue;
+        }
+        // Read twice, a marginal clock may only fail occasionally
+        if(sdcard_read_matches(expect, buf) && sdcard_read_matches(expect, buf)) {
+            freq = khz;
+            break;
+        }
+        ESP_LOGW(TAG, "Read back failed at %dkHz", khz);
+    }
+    if(freq == SDMMC_FREQ_PROBING) {
+        card->host.set_card_clk(card->host.slot, freq);
+    }
+    card->max_freq_khz = freq;
+
+done:
+    if(f) {
+        fclose(f);
+    }
+    unlink(SDCARD_SCRATCH);
+    free(expect);
+    free(buf);
+    ESP_LOGI(TAG, "Card clock %dkHz", freq);
+    return freq;
+}
+
 sdmmc_card_t *sdcard_init() {
     esp_err_t ret;
 
@@ -50,9 +122,8 @@ sdmmc_card_t *sdcard_init() {
     // production applications.
     ESP_LOGI(TAG, "Using SPI peripheral");
 
-    // By default, SD card frequency is initialized to SDMMC_FREQ_DEFAULT (20MHz)
-    // For setting a specific frequency, use host.max_freq_khz (range 400kHz - 20MHz for SDSPI)
-    // Example: for fixed frequency of 10MHz, use host.max_freq_khz = 10000;
+    // Mount at the probing clock, which every card and wiring supports, then
+    // step up once the filesystem is there to check the faster clocks with
     sdmmc_host_t host = SDSPI_HOST_DEFAULT();
     host.slot=SPI3_HOST;
     host.max_freq_khz = SDMMC_FREQ_PROBING;
@@ -63,7 +134,7 @@ sdmmc_card_t *sdcard_init() {
         .sclk_io_num = PIN_NUM_CLK,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = 4000,
+        .max_transfer_sz = SDCARD_MAX_TRANSFER,
         .flags = SPICOMMON_BUSFLAG_GPIO_PINS,
     };
     ret = spi_bus_initialize(host.slot, &bus_cfg, SDSPI_DEFAULT_DMA);
@@ -93,6 +164,8 @@ sdmmc_card_t *sdcard_init() {
     }
     ESP_LOGI(TAG, "Filesystem mounted");
 
+    sdcard_set_fastest_clock(card);
+
     // Card has been initialized, print its properties
     sdmmc_card_print_info(stdout, card);
     return card;
@@ -23,11 +23,7 @@ esp_err_t tembed_sleep(tembed_t tembed) {
     return ESP_OK;
 }
 
-tembed_t tembed_init(
-#ifdef CONFIG_TEMBED_INIT_LCD
-    esp_lcd_panel_io_color_trans_done_cb_t notify_color_trans_done, void *user_data
-#endif
-    ) {
+tembed_t tembed_init_power(void) {
 
     tembed.goto_sleep=tembed_sleep;
 
@@ -41,15 +37,23 @@ tembed_t tembed_init(
     gpio_set_level(CONFIG_TEMBED_POWER_PIN, 1);
 #endif
 
+    return &tembed;
+}
+
 #ifdef CONFIG_TEMBED_INIT_LEDS
+void tembed_init_leds(void) {
     apa102_init(&tembed.leds);
+}
 #endif
 
 #ifdef CONFIG_TEMBED_INIT_LCD
+void tembed_init_lcd(esp_lcd_panel_io_color_trans_done_cb_t notify_color_trans_done, void *user_data) {
     tembed.lcd = tembed_init_lcd_st7789(notify_color_trans_done, user_data);
+}
 #endif
 
 #ifdef CONFIG_TEMBED_INIT_DIAL
+void tembed_init_dial(void) {
     // Ensure the button pin isn't claimed by the RTC wakeup function
     ESP_ERROR_CHECK(rtc_gpio_deinit(CONFIG_TEMBED_DIAL_BUTTON_IO_NUM));
     button_config_t cfg = {
@@ -70,11 +74,38 @@ tembed_t tembed_init(
     kcfg->gpio_encoder_b = CONFIG_TEMBED_DIAL_KNOB_B;
 
     tembed.dial.knob = iot_knob_create(kcfg);
-
+}
 #endif
 
 #if CONFIG_TEMBED_INIT_WIFI
+void tembed_init_wifi(void) {
     tembed.netif = wifi_init();
+}
+#endif
+
+tembed_t tembed_init(
+#ifdef CONFIG_TEMBED_INIT_LCD
+    esp_lcd_panel_io_color_trans_done_cb_t notify_color_trans_done, void *user_data
+#endif
+    ) {
+
+    tembed_init_power();
+
+#ifdef CONFIG_TEMBED_INIT_LEDS
+    tembed_init_leds();
+#endif
+
+#ifdef CONFIG_TEMBED_INIT_LCD
+    tembed_init_lcd(notify_color_trans_done, user_data);
+#endif
+
+#ifdef CONFIG_TEMBED_INIT_DIAL
+    tembed_init_dial();
+#endif
+
+#if CONFIG_TEMBED_INIT_WIFI
+    tembed_init_wifi();
+    initialize_sntp();
 #endif
 
     return &tembed;
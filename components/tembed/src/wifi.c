@@ -115,7 +115,7 @@ static void sntp_sync(struct timeval *tv) {
     ESP_LOGI(TAG, "NTP sync");
 }
 
-static void initialize_sntp(void)
+void initialize_sntp(void)
 {
     ESP_LOGI(TAG, "Initializing SNTP");
     sntp_setoperatingmode(SNTP_OPMODE_POLL);
@@ -174,8 +174,6 @@ esp_netif_t *wifi_init(void) {
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     ESP_ERROR_CHECK(esp_wifi_start());
 
-    initialize_sntp();
-
     return sta_netif;
 }
 
@@ -0,0 +1,72 @@
+#!/usr/bin/python3
+# Pack a sequence of images into an RGB565 animation for the play command
+#
+# The layout is described in main/include/anim.h. Frames are the size of the
+# first image, scaled down to fit the 320x170 panel if needed
+import argparse
+import struct
+
+SCREEN_W = 320
+SCREEN_H = 170
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+FLAG_RLE = 0x01
+
+
+def load_frame(path, size):
+    from PIL import Image
+    image = Image.open(path).convert('RGB')
+    if size is None:
+        scale = min(1.0, SCREEN_W / image.width, SCREEN_H / image.height)
+        size = (max(1, int(image.width * scale)), max(1, int(image.height * scale)))
+    image = image.resize(size)
+    # The panel takes RGB565 most significant byte first
+    return size, [struct.pack('>H', ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)) for r, g, b in image.getdata()]
+
+
+def rle565_encode(px):
+    # Same packets as rle565_encode() in components/tembed/src/rle565.c
+    out = bytearray()
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < MAX_REPEAT and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 2))
+            out += px[i]
+            i += run
+            continue
+        lit = 1
+        while i + lit < len(px) and lit < MAX_LITERAL and \
+                not (i + lit + 1 < len(px) and px[i + lit] == px[i + lit + 1]):
+            lit += 1
+        out.append(lit - 1)
+        for p in px[i:i + lit]:
+            out += p
+        i += lit
+    return bytes(out)
+
+
+parser = argparse.ArgumentParser(description='Make an RGB565 animation for the T-Embed play command')
+parser.add_argument('frames', nargs='+', help='Image files, in order')
+parser.add_argument('-o', '--output', required=True, help='Animation file, for example anim.a565')
+parser.add_argument('-f', '--fps', type=int, default=15)
+parser.add_argument('-r', '--rle', action='store_true', help='Run length compress the frames')
+args = parser.parse_args()
+
+size = None
+frames = []
+for path in args.frames:
+    size, px = load_frame(path, size)
+    frames.append(rle565_encode(px) if args.rle else b''.join(px))
+
+raw = size[0] * size[1] * 2 * len(frames)
+with open(args.output, 'wb') as f:
+    f.write(struct.pack('<4sBBHHHI', b'A565', 1, FLAG_RLE if args.rle else 0, size[0], size[1], args.fps, len(frames)))
+    for frame in frames:
+        f.write(struct.pack('<I', len(frame)))
+        f.write(frame)
+
+print('%d frames of %dx%d, %d bytes of pixels stored in %d' %
+      (len(frames), size[0], size[1], raw, sum(len(frame) for frame in frames)))
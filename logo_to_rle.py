@@ -0,0 +1,81 @@
+#!/usr/bin/python3
+# Generate the run length compressed boot logo for components/tembed
+#
+# The input is either the raw C array (components/tembed/include/img_logo.h) or
+# any image Pillow can read, which is scaled to the panel size
+import argparse
+import re
+import struct
+
+WIDTH = 320
+HEIGHT = 170
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+
+
+def load_header(path):
+    with open(path) as f:
+        src = f.read()
+    body = src[src.index('{') + 1:src.rindex('}')]
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    # Parse the literals the way a C compiler would, including octal
+    return bytes(int(tok, 16) if tok.lower().startswith('0x') else int(tok, 8 if tok.startswith('0') else 10)
+                 for tok in (t.strip() for t in body.split(',')) if tok)
+
+
+def load_image(path):
+    from PIL import Image
+    image = Image.open(path).convert('RGB').resize((WIDTH, HEIGHT))
+    out = bytearray()
+    for r, g, b in image.getdata():
+        # The panel takes RGB565 most significant byte first
+        out += struct.pack('>H', ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return bytes(out)
+
+
+def rle565_encode(px):
+    # Same packets as rle565_encode() in components/tembed/src/rle565.c
+    out = bytearray()
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < MAX_REPEAT and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 2))
+            out += px[i]
+            i += run
+            continue
+        lit = 1
+        while i + lit < len(px) and lit < MAX_LITERAL and \
+                not (i + lit + 1 < len(px) and px[i + lit] == px[i + lit + 1]):
+            lit += 1
+        out.append(lit - 1)
+        for p in px[i:i + lit]:
+            out += p
+        i += lit
+    return bytes(out)
+
+
+parser = argparse.ArgumentParser(description='Compress the T-Embed boot logo')
+parser.add_argument('input', nargs='?', default='components/tembed/include/img_logo.h',
+                    help='img_logo.h style C array or an image file')
+parser.add_argument('-o', '--output', default='components/tembed/include/img_logo_rle.h')
+args = parser.parse_args()
+
+raw = load_header(args.input) if args.input.endswith('.h') else load_image(args.input)
+if len(raw) != WIDTH * HEIGHT * 2:
+    raise SystemExit('Expected %d bytes of RGB565, got %d' % (WIDTH * HEIGHT * 2, len(raw)))
+
+rle = rle565_encode([raw[i:i + 2] for i in range(0, len(raw), 2)])
+
+with open(args.output, 'w') as f:
+    f.write('// Generated by logo_to_rle.py, do not edit\n')
+    f.write('#define IMG_LOGO_W %d\n' % WIDTH)
+    f.write('#define IMG_LOGO_H %d\n' % HEIGHT)
+    f.write('const unsigned char img_logo_rle[%d] = {\n' % len(rle))
+    for i in range(0, len(rle), 16):
+        f.write(''.join('0X%02X,' % b for b in rle[i:i + 16]) + '\n')
+    f.write('};\n')
+
+print('%d bytes compressed to %d' % (len(raw), len(rle)))
@@ -0,0 +1,436 @@
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_console.h"
+#include "esp_lcd_panel_ops.h"
+#include "argtable3/argtable3.h"
+#include "tembed.h"
+#include "tembed_lvgl.h"
+#include "rle565.h"
+#include "anim.h"
+
+static const char *TAG="anim";
+
+#define ANIM_SLOTS CONFIG_APP_ANIM_SLOTS
+#define ANIM_SLOT_SIZE (CONFIG_APP_ANIM_SLOT_KB * 1024)
+// LVGL has the panel rotated, frames are drawn the same way round
+#define ANIM_SCREEN_W TEMBED_LCD_V_RES
+#define ANIM_SCREEN_H TEMBED_LCD_H_RES
+
+// Part of a frame in one of the slots, or the end of playback
+typedef struct {
+    uint32_t seq; // Frame number, counting on across loops
+    uint16_t y;
+    uint16_t lines;
+    uint8_t slot;
+    bool first; // First stripe of the frame
+    bool last; // Last stripe of the frame
+    bool end; // No more frames
+} anim_stripe_t;
+
+typedef struct anim {
+    FILE *f;
+    anim_header_t hdr;
+    anim_opts_t opts;
+    uint32_t period_us;
+    uint16_t stripe_lines;
+    uint8_t *slots[ANIM_SLOTS];
+    QueueHandle_t free_q; // Slots the reader may fill
+    QueueHandle_t ready_q; // Filled stripes in order
+    SemaphoreHandle_t reader_done;
+    TaskHandle_t pusher;
+    esp_timer_handle_t pace_timer;
+    uint8_t *rle; // Compressed frame being decoded
+    size_t rle_size;
+    volatile bool stop;
+    volatile int64_t start; // When frame 0 was due, 0 until it is shown
+
+    // Slots on the panel IO, oldest first, released by the transfer done ISR
+    uint8_t inflight[ANIM_SLOTS];
+    int inflight_head;
+    volatile int inflight_count;
+} anim_t;
+
+static anim_t *anim = NULL;
+static anim_stats_t anim_stats;
+static portMUX_TYPE anim_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// ISR ISR ISR ISR ISR
+static bool anim_lcd_done(void *ctx) {
+    anim_t *a = (anim_t *)ctx;
+    BaseType_t woken = pdFALSE;
+
+    portENTER_CRITICAL_ISR(&anim_lock);
+    if(a->inflight_count == 0) {
+        portEXIT_CRITICAL_ISR(&anim_lock);
+        return false;
+    }
+    uint8_t slot = a->inflight[a->inflight_head];
+    a->inflight_head = (a->inflight_head + 1) % ANIM_SLOTS;
+    a->inflight_count--;
+    portEXIT_CRITICAL_ISR(&anim_lock);
+
+    xQueueSendFromISR(a->free_q, &slot, &woken);
+    return woken == pdTRUE;
+}
+
+static void anim_pace_cb(void *arg) {
+    anim_t *a = (anim_t *)arg;
+    xTaskNotifyGive(a->pusher);
+}
+
+static size_t anim_read(anim_t *a, void *buf, size_t len) {
+    int64_t t = esp_timer_get_time();
+    size_t got = fread(buf, 1, len, a->f);
+    portENTER_CRITICAL(&anim_lock);
+    anim_stats.sd_bytes += got;
+    anim_stats.read_us += esp_timer_get_time() - t;
+    portEXIT_CRITICAL(&anim_lock);
+    return got;
+}
+
+// Read one frame of len bytes and queue it a stripe at a time
+static esp_err_t anim_read_frame(anim_t *a, uint32_t seq, uint32_t len) {
+    uint16_t w = a->hdr.w;
+    uint16_t h = a->hdr.h;
+    bool rle = a->hdr.flags & ANIM_FLAG_RLE;
+    rle565_decoder_t dec;
+
+    if(rle) {
+        // Compressed frames are read whole, they are small by design
+        if(len > a->rle_size) {
+            uint8_t *buf = heap_caps_realloc(a->rle, len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if(!buf) buf = heap_caps_realloc(a->rle, len, MALLOC_CAP_DEFAULT);
+            if(!buf) return ESP_ERR_NO_MEM;
+            a->rle = buf;
+            a->rle_size = len;
+        }
+        if(anim_read(a, a->rle, len) != len) return ESP_ERR_INVALID_SIZE;
+        rle565_decoder_init(&dec, a->rle, len);
+    } else if(len != (uint32_t)w * h * sizeof(uint16_t)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    for(uint16_t y=0; y<h; y+=a->stripe_lines) {
+        uint16_t lines = h - y < a->stripe_lines ? h - y : a->stripe_lines;
+        size_t px = (size_t)w * lines;
+        uint8_t slot;
+
+        xQueueReceive(a->free_q, &slot, portMAX_DELAY);
+        if(a->stop) {
+            xQueueSend(a->free_q, &slot, 0);
+            return ESP_OK;
+        }
+        uint16_t *dst = (uint16_t *)a->slots[slot];
+        if(rle) {
+            size_t n = rle565_decode(&dec, dst, px);
+            if(n < px) memset(&dst[n], 0, (px - n) * sizeof(uint16_t));
+        } else if(anim_read(a, dst, px * sizeof(uint16_t)) != px * sizeof(uint16_t)) {
+            xQueueSend(a->free_q, &slot, 0);
+            return ESP_ERR_INVALID_SIZE;
+        }
+
+        anim_stripe_t stripe = {
+            .seq = seq,
+            .y = y,
+            .lines = lines,
+            .slot = slot,
+            .first = y == 0,
+            .last = y + lines >= h,
+        };
+        xQueueSend(a->ready_q, &stripe, portMAX_DELAY);
+    }
+    return ESP_OK;
+}
+
+static void anim_reader_task(void *arg) {
+    anim_t *a = (anim_t *)arg;
+    uint32_t seq = 0;
+
+    for(uint32_t loop=0; !a->stop && (a->opts.loops == 0 || loop < a->opts.loops); loop++) {
+        fseek(a->f, sizeof(anim_header_t), SEEK_SET);
+        for(uint32_t i=0; i<a->hdr.frames && !a->stop; i++, seq++) {
+            uint32_t len;
+            if(anim_read(a, &len, sizeof(len)) != sizeof(len)) {
+                ESP_LOGW(TAG, "Truncated at frame %u", i);
+                a->stop = true;
+                break;
+            }
+
+            // Once the next frame is due this one is not worth reading
+            int64_t start = a->start;
+            if(start && esp_timer_get_time() > start + (int64_t)(seq + 1) * a->period_us) {
+                fseek(a->f, len, SEEK_CUR);
+                portENTER_CRITICAL(&anim_lock);
+                anim_stats.dropped++;
+                portEXIT_CRITICAL(&anim_lock);
+                continue;
+            }
+
+            esp_err_t err = anim_read_frame(a, seq, len);
+            if(err != ESP_OK) {
+                ESP_LOGW(TAG, "Frame %u: %s", i, esp_err_to_name(err));
+                a->stop = true;
+            }
+        }
+    }
+
+    anim_stripe_t end = { .end = true };
+    xQueueSend(a->ready_q, &end, portMAX_DELAY);
+    xSemaphoreGive(a->reader_done);
+    vTaskDelete(NULL);
+}
+
+static void anim_free(anim_t *a) {
+    if(a->pace_timer) esp_timer_delete(a->pace_timer);
+    if(a->reader_done) vSemaphoreDelete(a->reader_done);
+    if(a->free_q) vQueueDelete(a->free_q);
+    if(a->ready_q) vQueueDelete(a->ready_q);
+    for(int i=0; i<ANIM_SLOTS; i++) {
+        free(a->slots[i]);
+    }
+    free(a->rle);
+    if(a->f) fclose(a->f);
+    free(a);
+}
+
+static void anim_pusher_task(void *arg) {
+    anim_t *a = (anim_t *)arg;
+    uint16_t w = a->hdr.w;
+    uint16_t x0 = (ANIM_SCREEN_W - w) / 2;
+    uint16_t y0 = (ANIM_SCREEN_H - a->hdr.h) / 2;
+    anim_stripe_t stripe;
+
+    esp_lcd_panel_handle_t panel = tembed_lvgl_claim(anim_lcd_done, a);
+    int64_t began = esp_timer_get_time();
+
+    for(;;) {
+        if(uxQueueMessagesWaiting(a->ready_q) == 0) {
+            portENTER_CRITICAL(&anim_lock);
+            anim_stats.starved++;
+            portEXIT_CRITICAL(&anim_lock);
+        }
+        xQueueReceive(a->ready_q, &stripe, portMAX_DELAY);
+        if(stripe.end) break;
+
+        if(stripe.first) {
+            int64_t now = esp_timer_get_time();
+            if(!a->start) a->start = now - (int64_t)stripe.seq * a->period_us;
+            int64_t due = a->start + (int64_t)stripe.seq * a->period_us;
+            if(due > now) {
+                esp_timer_start_once(a->pace_timer, due - now);
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            } else {
+                portENTER_CRITICAL(&anim_lock);
+                if(now - due > anim_stats.late_max_us) anim_stats.late_max_us = now - due;
+                portEXIT_CRITICAL(&anim_lock);
+            }
+        }
+
+        // Must be in the in flight list before the transfer can complete
+        portENTER_CRITICAL(&anim_lock);
+        a->inflight[(a->inflight_head + a->inflight_count) % ANIM_SLOTS] = stripe.slot;
+        a->inflight_count++;
+        portEXIT_CRITICAL(&anim_lock);
+
+        // Blocks while the previous stripe is still going out
+        ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel, x0, y0 + stripe.y, x0 + w, y0 + stripe.y + stripe.lines,
+                                                  a->slots[stripe.slot]));
+
+        portENTER_CRITICAL(&anim_lock);
+        anim_stats.lcd_bytes += (uint32_t)w * stripe.lines * sizeof(uint16_t);
+        if(stripe.last) anim_stats.shown++;
+        anim_stats.elapsed_ms = (esp_timer_get_time() - began) / 1000;
+        portEXIT_CRITICAL(&anim_lock);
+    }
+
+    while(a->inflight_count) {
+        vTaskDelay(1);
+    }
+    tembed_lvgl_release();
+    xSemaphoreTake(a->reader_done, portMAX_DELAY);
+
+    anim_stats_t stats;
+    portENTER_CRITICAL(&anim_lock);
+    anim_stats.elapsed_ms = (esp_timer_get_time() - began) / 1000;
+    anim_stats.playing = false;
+    stats = anim_stats;
+    anim = NULL;
+    portEXIT_CRITICAL(&anim_lock);
+
+    uint32_t ms = stats.elapsed_ms ? stats.elapsed_ms : 1;
+    ESP_LOGI(TAG, "%s: %u frames shown, %u dropped in %ums, %u.%u fps. SD %lluKB/s, LCD %lluKB/s",
+             stats.name, stats.shown, stats.dropped, stats.elapsed_ms, stats.shown * 1000 / ms,
+             (stats.shown * 10000 / ms) % 10, stats.sd_bytes / ms, stats.lcd_bytes / ms);
+
+    anim_free(a);
+    vTaskDelete(NULL);
+}
+
+esp_err_t anim_play(const char *path, const anim_opts_t *opts) {
+    if(anim) return ESP_ERR_INVALID_STATE;
+
+    anim_t *a = calloc(1, sizeof(anim_t));
+    if(!a) return ESP_ERR_NO_MEM;
+    a->opts = *opts;
+
+    esp_err_t err = ESP_OK;
+    a->f = fopen(path, "rb");
+    if(!a->f) {
+        err = ESP_ERR_NOT_FOUND;
+        goto fail;
+    }
+    if(fread(&a->hdr, sizeof(a->hdr), 1, a->f) != 1 || memcmp(a->hdr.magic, ANIM_MAGIC, 4) != 0
+            || a->hdr.version != ANIM_VERSION) {
+        ESP_LOGW(TAG, "%s is not an animation", path);
+        err = ESP_ERR_NOT_SUPPORTED;
+        goto fail;
+    }
+    if(a->hdr.frames == 0 || a->hdr.w == 0 || a->hdr.h == 0 || a->hdr.w > ANIM_SCREEN_W || a->hdr.h > ANIM_SCREEN_H) {
+        ESP_LOGW(TAG, "%s: %u frames of %ux%u won't fit the screen", path, a->hdr.frames, a->hdr.w, a->hdr.h);
+        err = ESP_ERR_INVALID_SIZE;
+        goto fail;
+    }
+    uint16_t fps = opts->fps ? opts->fps : a->hdr.fps;
+    a->period_us = 1000000 / (fps ? fps : 1);
+
+    // As many lines as fit a slot, the reader keeps all but one of them full
+    a->stripe_lines = ANIM_SLOT_SIZE / (a->hdr.w * sizeof(uint16_t));
+    if(a->stripe_lines > a->hdr.h) a->stripe_lines = a->hdr.h;
+    if(a->stripe_lines == 0) a->stripe_lines = 1;
+    for(int i=0; i<ANIM_SLOTS; i++) {
+        a->slots[i] = heap_caps_malloc(a->stripe_lines * a->hdr.w * sizeof(uint16_t), MALLOC_CAP_DMA);
+        if(!a->slots[i]) {
+            err = ESP_ERR_NO_MEM;
+            goto fail;
+        }
+    }
+
+    a->free_q = xQueueCreate(ANIM_SLOTS, sizeof(uint8_t));
+    a->ready_q = xQueueCreate(ANIM_SLOTS + 1, sizeof(anim_stripe_t));
+    a->reader_done = xSemaphoreCreateBinary();
+    if(!a->free_q || !a->ready_q || !a->reader_done) {
+        err = ESP_ERR_NO_MEM;
+        goto fail;
+    }
+    for(uint8_t i=0; i<ANIM_SLOTS; i++) {
+        xQueueSend(a->free_q, &i, 0);
+    }
+    const esp_timer_create_args_t pace_args = {
+        .callback = anim_pace_cb,
+        .arg = a,
+        .name = "anim_pace",
+    };
+    err = esp_timer_create(&pace_args, &a->pace_timer);
+    if(err != ESP_OK) goto fail;
+
+    portENTER_CRITICAL(&anim_lock);
+    memset(&anim_stats, 0, sizeof(anim_stats));
+    const char *slash = strrchr(path, '/');
+    strlcpy(anim_stats.name, slash ? slash + 1 : path, sizeof(anim_stats.name));
+    anim_stats.playing = true;
+    anim_stats.w = a->hdr.w;
+    anim_stats.h = a->hdr.h;
+    anim_stats.fps = fps;
+    anim = a;
+    portEXIT_CRITICAL(&anim_lock);
+
+    ESP_LOGI(TAG, "Play %s, %u frames of %ux%u%s at %u fps, %u line stripes", path, a->hdr.frames, a->hdr.w,
+             a->hdr.h, a->hdr.flags & ANIM_FLAG_RLE ? " RLE" : "", fps, a->stripe_lines);
+
+    // The panel side runs next to the LVGL flush task, the reader wherever there is room
+    BaseType_t res = xTaskCreatePinnedToCore(anim_pusher_task, "anim_push", 3072, a, 5, &a->pusher, 1);
+    assert(res == pdPASS);
+    res = xTaskCreate(anim_reader_task, "anim_read", 3072, a, 4, NULL);
+    assert(res == pdPASS);
+    return ESP_OK;
+
+fail:
+    anim_free(a);
+    return err;
+}
+
+void anim_stop(void) {
+    portENTER_CRITICAL(&anim_lock);
+    if(anim) anim->stop = true;
+    portEXIT_CRITICAL(&anim_lock);
+}
+
+void anim_get_stats(anim_stats_t *stats) {
+    portENTER_CRITICAL(&anim_lock);
+    *stats = anim_stats;
+    portEXIT_CRITICAL(&anim_lock);
+}
+
+static struct {
+    struct arg_str *path;
+    struct arg_int *fps;
+    struct arg_int *loops;
+    struct arg_lit *stop;
+    struct arg_end *end;
+} play_args;
+
+static int play(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &play_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, play_args.end, argv[0]);
+        return 1;
+    }
+    if(play_args.stop->count) {
+        anim_stop();
+        return 0;
+    }
+    if(play_args.path->count) {
+        anim_opts_t opts = {
+            .fps = play_args.fps->count ? play_args.fps->ival[0] : 0,
+            .loops = play_args.loops->count ? play_args.loops->ival[0] : 1,
+        };
+        esp_err_t err = anim_play(play_args.path->sval[0], &opts);
+        if(err != ESP_OK) {
+            printf("Can't play %s: %s\n", play_args.path->sval[0], esp_err_to_name(err));
+            return 1;
+        }
+        return 0;
+    }
+
+    anim_stats_t s;
+    anim_get_stats(&s);
+    if(!s.name[0]) {
+        printf("Nothing played yet\n");
+        return 0;
+    }
+    uint32_t ms = s.elapsed_ms ? s.elapsed_ms : 1;
+    printf("%s %s, %ux%u at %u fps target\n", s.playing ? "Playing" : "Played", s.name, s.w, s.h, s.fps);
+    printf("Frames: %u shown, %u dropped, %u.%u fps achieved, latest %uus late\n", s.shown, s.dropped,
+           s.shown * 1000 / ms, (s.shown * 10000 / ms) % 10, s.late_max_us);
+    printf("SD: %llu bytes, %lluKB/s, reading %llu%% of the time. Panel waited for SD %u times\n",
+           s.sd_bytes, s.sd_bytes / ms, s.read_us / 10 / ms, s.starved);
+    printf("LCD: %llu bytes, %lluKB/s\n", s.lcd_bytes, s.lcd_bytes / ms);
+    return 0;
+}
+
+void register_cmd_play(void)
+{
+    play_args.path = arg_str0(NULL, NULL, "<path>", "Animation file to play");
+    play_args.fps = arg_int0("f", "fps", "<n>", "Frame rate, defaults to the one in the file");
+    play_args.loops = arg_int0("l", "loops", "<n>", "Times to play it, 0 loops until stopped");
+    play_args.stop = arg_lit0("s", "stop", "Stop playing");
+    play_args.end = arg_end(4);
+
+    const esp_console_cmd_t cmd = {
+        .command = "play",
+        .help = "Play an RGB565 animation from the SD card, or show playback stats",
+        .hint = NULL,
+        .func = &play,
+        .argtable = &play_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
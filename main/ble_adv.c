@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <string.h>
+#ifndef BLE_ADV_HOST // Built without IDF by tools/adv_test
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
+#include "esp_gap_ble_api.h"
+#endif
+#include "ble_adv.h"
+
+static inline void adv_field(ble_adv_field_t *field, uint32_t ofs, uint32_t len) {
+    field->ofs = ofs;
+    field->len = len;
+}
+
+void ble_adv_parse(ble_adv_t *adv, const uint8_t *data, uint8_t adv_len, uint8_t rsp_len) {
+    memset(adv, 0, sizeof(ble_adv_t));
+    adv->data = data;
+    adv->tx_power = BLE_ADV_NO_TX_POWER;
+
+    uint32_t end = adv_len + rsp_len;
+    if(end > BLE_ADV_DATA_MAX) end = BLE_ADV_DATA_MAX;
+    uint32_t i = 0;
+    while(i + 1 < end) {
+        uint32_t len = data[i];
+        if(len == 0) {
+            // Padding ends the advertising data, carry on with the scan response
+            if(i >= adv_len) break;
+            i = adv_len;
+            continue;
+        }
+        if(i + 1 + len > end) break; // Truncated
+
+        uint32_t ofs = i + 2;
+        uint32_t n = len - 1;
+        switch(data[i + 1]) {
+        case BLE_AD_FLAGS:
+            if(n) adv->flags = data[ofs];
+            break;
+        case BLE_AD_UUID16_SOME:
+        case BLE_AD_UUID16_ALL: adv_field(&adv->uuid16, ofs, n); break;
+        case BLE_AD_UUID32_SOME:
+        case BLE_AD_UUID32_ALL: adv_field(&adv->uuid32, ofs, n); break;
+        case BLE_AD_UUID128_SOME:
+        case BLE_AD_UUID128_ALL: adv_field(&adv->uuid128, ofs, n); break;
+        case BLE_AD_NAME_SHORT:
+            if(!adv->name_complete) adv_field(&adv->name, ofs, n);
+            break;
+        case BLE_AD_NAME_COMPLETE:
+            if(!adv->name_complete) {
+                adv_field(&adv->name, ofs, n);
+                adv->name_complete = true;
+            }
+            break;
+        case BLE_AD_TX_POWER:
+            if(n) adv->tx_power = (int8_t)data[ofs];
+            break;
+        case BLE_AD_SERVICE_DATA16: adv_field(&adv->service_data16, ofs, n); break;
+        case BLE_AD_APPEARANCE:
+            if(n >= 2) adv->appearance = data[ofs] | (data[ofs + 1] << 8);
+            break;
+        case BLE_AD_MANUFACTURER: adv_field(&adv->manufacturer, ofs, n); break;
+        default:
+            break;
+        }
+        i += len + 1;
+    }
+}
+
+// Benchmark of the parser against looking up each field with
+// esp_ble_resolve_adv_data, which walks the payload once per field. The
+// payloads were recorded from common devices, and are also checked on the
+// host by tools/adv_test
+typedef struct {
+    const char *name;
+    uint8_t adv_len;
+    uint8_t rsp_len;
+    uint8_t data[BLE_ADV_DATA_MAX];
+} bench_payload_t;
+
+static const bench_payload_t bench_payloads[] = {
+    { "iBeacon", 30, 0, { 0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xe2, 0xc5, 0x6d, 0xb5, 0xdf, 0xfb,
+                          0x48, 0xd2, 0xb0, 0x60, 0xd0, 0xf5, 0xa7, 0x10, 0x96, 0xe0, 0x00, 0x01, 0x00, 0x02, 0xc5 } },
+    { "Eddystone URL", 22, 0, { 0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x0e, 0x16, 0xaa, 0xfe, 0x10, 0xeb, 0x03,
+                                0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x07 } },
+    { "Heart rate sensor", 16, 10, { 0x02, 0x01, 0x06, 0x05, 0x03, 0x0d, 0x18, 0x0f, 0x18, 0x03, 0x19, 0x41, 0x03,
+                                     0x02, 0x0a, 0x04, 0x09, 0x09, 0x48, 0x52, 0x4d, 0x20, 0x34, 0x34, 0x31, 0x32 } },
+    { "Phone", 14, 0, { 0x02, 0x01, 0x1a, 0x0a, 0xff, 0x4c, 0x00, 0x10, 0x05, 0x01, 0x18, 0x5e, 0x2a, 0x3b } },
+    { "Headphones", 21, 15, { 0x02, 0x01, 0x06, 0x11, 0x07, 0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9, 0xe0, 0x93,
+                              0xf3, 0xa3, 0xb5, 0x01, 0x00, 0x40, 0x6e, 0x05, 0x08, 0x42, 0x75, 0x64, 0x73, 0x02,
+                              0x0a, 0xf4, 0x05, 0xff, 0x75, 0x00, 0x01, 0x02 } },
+};
+
+#define BENCH_PAYLOADS (sizeof(bench_payloads) / sizeof(bench_payloads[0]))
+
+#ifndef BLE_ADV_HOST
+
+static const uint8_t bench_types[] = {
+    ESP_BLE_AD_TYPE_NAME_CMPL, ESP_BLE_AD_TYPE_NAME_SHORT, ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE,
+    ESP_BLE_AD_TYPE_16SRV_CMPL, ESP_BLE_AD_TYPE_TX_PWR, ESP_BLE_AD_TYPE_APPEARANCE,
+};
+
+static struct {
+    struct arg_int *count;
+    struct arg_end *end;
+} advbench_args;
+
+static uint32_t per_s(int count, int64_t us) {
+    return us > 0 ? (uint32_t)((uint64_t)count * 1000000 / us) : 0;
+}
+
+static int advbench(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &advbench_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, advbench_args.end, argv[0]);
+        return 1;
+    }
+    int count = advbench_args.count->count ? advbench_args.count->ival[0] : 20000;
+    if(count <= 0) {
+        printf("Count must be positive\n");
+        return 1;
+    }
+
+    printf("%d parses of each payload\n", count);
+    printf("Payload             Fields  Parser/s  Resolve/s\n");
+    for(int p=0; p<BENCH_PAYLOADS; p++) {
+        const bench_payload_t *payload = &bench_payloads[p];
+        uint8_t buf[BLE_ADV_DATA_MAX];
+        memcpy(buf, payload->data, sizeof(buf));
+
+        ble_adv_t adv;
+        volatile uint32_t sink = 0; // Keeps the results live
+        int64_t start = esp_timer_get_time();
+        for(int i=0; i<count; i++) {
+            ble_adv_parse(&adv, buf, payload->adv_len, payload->rsp_len);
+            sink += adv.name.len + adv.manufacturer.len + adv.uuid16.len + adv.tx_power + adv.appearance;
+        }
+        int64_t parse_us = esp_timer_get_time() - start;
+        int fields = (adv.name.len > 0) + (adv.manufacturer.len > 0) + (adv.uuid16.len > 0) + (adv.uuid32.len > 0) +
+                     (adv.uuid128.len > 0) + (adv.service_data16.len > 0) + (adv.tx_power != BLE_ADV_NO_TX_POWER) +
+                     (adv.appearance != 0);
+
+        start = esp_timer_get_time();
+        for(int i=0; i<count; i++) {
+            for(int t=0; t<sizeof(bench_types); t++) {
+                uint8_t len = 0;
+                esp_ble_resolve_adv_data(buf, bench_types[t], &len);
+                sink += len;
+            }
+        }
+        int64_t resolve_us = esp_timer_get_time() - start;
+        (void)sink;
+
+        printf("%-18s %7d %9u %10u\n", payload->name, fields, per_s(count, parse_us), per_s(count, resolve_us));
+    }
+    return 0;
+}
+
+void register_cmd_advbench(void)
+{
+    advbench_args.count = arg_int0("n", "count", "<n>", "Parses of each payload, default 20000");
+    advbench_args.end = arg_end(1);
+
+    const esp_console_cmd_t cmd = {
+        .command = "advbench",
+        .help = "Measure advertising data parses per second",
+        .hint = NULL,
+        .func = &advbench,
+        .argtable = &advbench_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
+#endif
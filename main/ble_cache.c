@@ -18,6 +18,10 @@
 #include "esp_log.h"
 #include "esp_sleep.h"
 #include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_heap_caps.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
 #include "idle.h"
 #include "nvs_flash.h"
 
@@ -27,64 +31,232 @@
 
 #include "gatt_profile.h"
 #include "ble_cache.h"
+#define BLE_INDEX_ENTRY struct ble_cache_entry
+#include "ble_index.h"
+#include "ble_names.h"
+#include "ble_store.h"
 
 static const char* TAG="ble_cache";
 
-// This list is expected to be short so a linear search is acceptable
-struct ble_cache_entry ble_cache[BLE_CACHE_MAX];
+struct ble_cache_entry *ble_cache;
 int device_list_idx;
 
-void ble_cache_start_scan() {
-    // Reset all the cached devices to unseen
-    for(int idx=0;idx<device_list_idx;idx++) {
-        ble_cache[idx].visible=false;
+// Bumped at the start of each scan, entries seen since have the same value
+static uint16_t ble_cache_generation = 1;
+static ble_cache_stats_t ble_cache_stats;
+
+// A swap left the arena full, so swapping again frees nothing until a purge
+// drops some names. Named adds fail fast until then
+static bool ble_names_full;
+
+// Entries from the most to the least recently seen
+static int16_t lru_newest = -1, lru_oldest = -1;
+
+static int16_t *ble_index; // See ble_index.h
+
+// Ring of the last BLE_RSSI_HISTORY readings of each entry, in PSRAM when
+// there is some as it is only written once per report
+static int8_t *ble_rssi_history;
+#define BLE_RSSI_SHIFT CONFIG_APP_BLE_RSSI_SMOOTHING
+#define BLE_RSSI_ONE 256 // rssi_smooth is in 1/256 dBm, so small steps aren't lost
+
+static void lru_unlink(int idx) {
+    struct ble_cache_entry *e = &ble_cache[idx];
+    if(e->newer >= 0) ble_cache[e->newer].older = e->older;
+    else lru_newest = e->older;
+    if(e->older >= 0) ble_cache[e->older].newer = e->newer;
+    else lru_oldest = e->newer;
+}
+
+static void lru_push(int idx) {
+    ble_cache[idx].newer = -1;
+    ble_cache[idx].older = lru_newest;
+    if(lru_newest >= 0) ble_cache[lru_newest].newer = idx;
+    lru_newest = idx;
+    if(lru_oldest < 0) lru_oldest = idx;
+}
+
+static inline void ble_cache_seen(int idx) {
+    ble_cache[idx].generation = ble_cache_generation;
+    ble_cache[idx].last_seen = esp_timer_get_time() / 1000;
+    if(lru_newest != idx) {
+        lru_unlink(idx);
+        lru_push(idx);
+    }
+}
+
+// Add a reading to the history ring and the exponentially smoothed RSSI
+static inline void ble_cache_rssi(int idx, int8_t rssi) {
+    struct ble_cache_entry *e = &ble_cache[idx];
+    e->rssi = rssi;
+    if(e->rssi_count == 0) {
+        e->rssi_smooth = rssi * BLE_RSSI_ONE;
+    } else {
+        // Rounded the same way up and down, a shift would bias it low
+        int32_t step = rssi * BLE_RSSI_ONE - e->rssi_smooth;
+        int32_t half = (1 << BLE_RSSI_SHIFT) / 2;
+        e->rssi_smooth += (step + (step < 0 ? -half : half)) / (1 << BLE_RSSI_SHIFT);
     }
+    ble_rssi_history[idx * BLE_RSSI_HISTORY + e->rssi_next] = rssi;
+    e->rssi_next = e->rssi_next + 1 == BLE_RSSI_HISTORY ? 0 : e->rssi_next + 1;
+    if(e->rssi_count < BLE_RSSI_HISTORY) e->rssi_count++;
 }
 
-void ble_cache_add(const esp_ble_gap_cb_param_t *scan_result, const uint8_t *adv_name, uint8_t adv_name_len) {
+static inline bool ble_cache_busy(const struct ble_cache_entry *e) {
+    return e->connecting || e->connected;
+}
+
+esp_err_t ble_cache_init() {
+#if CONFIG_APP_BLE_CACHE_PSRAM
+    uint32_t caps = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+#else
+    uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+#endif
+    ble_cache = heap_caps_calloc(BLE_CACHE_MAX, sizeof(struct ble_cache_entry), caps);
+    ble_index = heap_caps_calloc(BLE_INDEX_SIZE, sizeof(int16_t), caps);
+#if CONFIG_SPIRAM
+    ble_rssi_history = heap_caps_calloc(BLE_CACHE_MAX, BLE_RSSI_HISTORY, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+    ble_rssi_history = heap_caps_calloc(BLE_CACHE_MAX, BLE_RSSI_HISTORY, caps);
+#endif
+    if(!ble_cache || !ble_index || !ble_rssi_history || ble_names_init(caps) != ESP_OK ||
+       ble_store_init(caps) != ESP_OK) {
+        free(ble_cache);
+        free(ble_index);
+        free(ble_rssi_history);
+        ble_cache = NULL;
+        ble_index = NULL;
+        ble_rssi_history = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Cache of %d devices, %u bytes, %u bytes of RSSI history", BLE_CACHE_MAX,
+             BLE_CACHE_MAX * sizeof(struct ble_cache_entry) + BLE_INDEX_SIZE * sizeof(int16_t),
+             BLE_CACHE_MAX * BLE_RSSI_HISTORY);
+    return ESP_OK;
+}
+
+// Copy the names still cached into the other arena, which drops the names
+// of devices evicted or purged since the last time
+static void ble_cache_move_names() {
+    ble_names_swap();
     for(int idx=0;idx<device_list_idx;idx++) {
-        if(memcmp(&ble_cache[idx].bda, scan_result->scan_rst.bda, 6)==0) {
-            // Already discovered this one
-            ble_cache[idx].visible=true;
-            return;
+        if(ble_cache[idx].name==NULL) continue;
+        ble_cache[idx].name=ble_names_intern(ble_cache[idx].name, ble_names_len(ble_cache[idx].name));
+        if(ble_cache[idx].name==NULL) ble_cache[idx].name_failed=true;
+    }
+}
+
+// Intern a name, making room in the arena if it is full
+static const char *ble_cache_name(const uint8_t *name, uint8_t len) {
+    const char *interned = ble_names_intern((const char *)name, len);
+    if(interned==NULL && !ble_names_full) {
+        ble_cache_move_names();
+        interned = ble_names_intern((const char *)name, len);
+        ble_names_full = interned==NULL;
+    }
+    return interned;
+}
+
+bool ble_cache_visible(int idx) {
+    return ble_cache[idx].generation == ble_cache_generation;
+}
+
+void ble_cache_start_scan() {
+    // All the cached devices become unseen
+    ble_cache_generation++;
+    if(ble_cache_generation == 0) ble_cache_generation = 1; // Zero is never seen
+}
+
+// Pick the entry for a new device, replacing the least recently seen one
+// which isn't in use when the cache is full
+static int ble_cache_alloc() {
+    if(device_list_idx < BLE_CACHE_MAX) {
+        int idx = device_list_idx++;
+        lru_push(idx);
+        return idx;
+    }
+    int idx = lru_oldest;
+    while(idx >= 0 && ble_cache_busy(&ble_cache[idx])) idx = ble_cache[idx].newer;
+    if(idx < 0) return -1;
+
+    uint32_t slot;
+    ble_index_find(ble_index, ble_cache, ble_cache[idx].bda, &slot);
+    ble_index_remove(ble_index, ble_cache, slot);
+    ble_cache_stats.evictions++;
+    return idx;
+}
+
+void ble_cache_add(const esp_ble_gap_cb_param_t *scan_result, const ble_adv_t *adv) {
+    const uint8_t *adv_name = ble_adv_ptr(adv, adv->name);
+    uint8_t adv_name_len = adv->name.len;
+    uint32_t slot;
+    int idx = ble_index_find(ble_index, ble_cache, scan_result->scan_rst.bda, &slot);
+    if(idx >= 0) {
+        // Already discovered this one
+        ble_cache_stats.hits++;
+        ble_cache_seen(idx);
+        ble_cache_rssi(idx, scan_result->scan_rst.rssi);
+        if(adv->tx_power != BLE_ADV_NO_TX_POWER) {
+            // Not every report carries it, keep the last one sent
+            ble_cache[idx].tx_power=adv->tx_power;
+        }
+        if(ble_cache[idx].name==NULL && adv_name_len>0 && !ble_cache[idx].name_failed) {
+            // The name came in a later scan response
+            ble_cache[idx].name=ble_cache_name(adv_name, adv_name_len);
         }
+        return;
+    }
+    ble_cache_stats.misses++;
+    bool full = device_list_idx == BLE_CACHE_MAX;
+    idx = ble_cache_alloc();
+    if(idx < 0) {
+        ble_cache_stats.dropped++; // Every entry is in use
+        return;
+    }
+    if(full) {
+        // Eviction may have moved entries along the probe chain
+        ble_index_find(ble_index, ble_cache, scan_result->scan_rst.bda, &slot);
+    }
+    memcpy(&ble_cache[idx].bda, scan_result->scan_rst.bda, 6);
+    ble_cache[idx].bda_type=scan_result->scan_rst.ble_addr_type;
+    ble_cache[idx].company=ble_adv_company(adv);
+    ble_cache[idx].appearance=adv->appearance;
+    ble_cache[idx].tx_power=adv->tx_power;
+    ble_cache[idx].connecting=false;
+    ble_cache[idx].connected=false;
+    ble_cache[idx].failed=false;
+    ble_cache[idx].name_failed=false;
+    ble_cache[idx].rssi_next=0;
+    ble_cache[idx].rssi_count=0;
+    ble_cache[idx].name=NULL; // Not moved if the arena fills now
+    char stored[BLE_STORE_NAME_MAX];
+    if(adv_name_len==0 && ble_store_get_name(scan_result->scan_rst.bda, stored, &adv_name_len)) {
+        // Read over GATT before, no need to connect again
+        adv_name=(const uint8_t *)stored;
     }
-    if(device_list_idx == BLE_CACHE_MAX) return; // Cache full
-    memcpy(&ble_cache[device_list_idx].bda, scan_result->scan_rst.bda, 6);
-    ble_cache[device_list_idx].visible=true;
-    ble_cache[device_list_idx].connecting=false;
-    ble_cache[device_list_idx].connected=false;
-    ble_cache[device_list_idx].failed=false;
-    ble_cache[device_list_idx].name_failed=false;
     if(adv_name_len>0) {
-        ble_cache[device_list_idx].name=strndup((const char *)adv_name, adv_name_len);
-        if(ble_cache[device_list_idx].name==NULL) {
-            ESP_LOGE(TAG,"BLE Name cache allocation failed");
-            ble_cache[device_list_idx].name_failed=true;
+        ble_cache[idx].name=ble_cache_name(adv_name, adv_name_len);
+        if(ble_cache[idx].name==NULL) {
+            ble_cache[idx].name_failed=true; // Counted in the arena stats
         }
-    } else {
-        // Device did not send name in advertised advanced data
-        ble_cache[device_list_idx].name=NULL;
     }
-    device_list_idx++;
+    // A device which did not send its name in the advertising data is left NULL
+    ble_cache_seen(idx);
+    ble_cache_rssi(idx, scan_result->scan_rst.rssi);
+    ble_index[slot] = idx + 1;
 }
 
 extern void ble_cache_update_name(esp_bd_addr_t remote_bda, uint8_t* name, uint8_t name_len) {
-    for(int idx=0;idx<device_list_idx;idx++) {
-        if(memcmp(&ble_cache[idx].bda, remote_bda, 6)==0) {
-            ble_cache[device_list_idx].connecting=false;
-            if(ble_cache[device_list_idx].name) {
-                free(ble_cache[device_list_idx].name);
-                ble_cache[device_list_idx].name=NULL;
-            }
-            if(name_len>0) {
-                ble_cache[device_list_idx].name=strndup((const char *)name, name_len);
-                if(ble_cache[device_list_idx].name==NULL) {
-                    ESP_LOGE(TAG,"BLE Name cache allocation failed");
-                    ble_cache[device_list_idx].name_failed=true;
-                }
-            }
-            return;
+    uint32_t slot;
+    int idx = ble_index_find(ble_index, ble_cache, remote_bda, &slot);
+    if(idx < 0) return;
+    ble_cache[idx].connecting=false;
+    ble_cache[idx].name=NULL;
+    if(name_len>0) {
+        ble_cache[idx].name=ble_cache_name(name, name_len);
+        if(ble_cache[idx].name==NULL) {
+            ESP_LOGE(TAG,"BLE name arena full");
+            ble_cache[idx].name_failed=true;
         }
     }
 }
@@ -93,16 +265,143 @@ int ble_cache_get_size() {
     return device_list_idx;
 }
 
-// Compact the cache by removing obsolete entries
+// Compact the cache by removing entries not seen in this scan, in one pass.
+// The LRU links are renumbered to follow the entries which moved
 void ble_cache_purge() {
+    int16_t *remap = ble_index; // Rebuilt afterwards, so free to use here
+    int kept = 0;
+    for(int idx=0;idx<device_list_idx;idx++) {
+        if(!ble_cache_visible(idx) && !ble_cache_busy(&ble_cache[idx])) {
+            lru_unlink(idx);
+            remap[idx] = -1;
+            continue;
+        }
+        remap[idx] = kept++;
+    }
+    ble_cache_stats.purged += device_list_idx - kept;
+
+    for(int idx=0;idx<device_list_idx;idx++) {
+        if(remap[idx] < 0) continue;
+        struct ble_cache_entry *e = &ble_cache[remap[idx]];
+        if(remap[idx] != idx) {
+            *e = ble_cache[idx];
+            memcpy(&ble_rssi_history[remap[idx] * BLE_RSSI_HISTORY], &ble_rssi_history[idx * BLE_RSSI_HISTORY],
+                   BLE_RSSI_HISTORY);
+        }
+        if(e->newer >= 0) e->newer = remap[e->newer];
+        if(e->older >= 0) e->older = remap[e->older];
+    }
+    if(lru_newest >= 0) lru_newest = remap[lru_newest];
+    if(lru_oldest >= 0) lru_oldest = remap[lru_oldest];
+
+    device_list_idx = kept;
+    ble_index_rebuild(ble_index, ble_cache, device_list_idx);
+    // Start the next scan with only the names still cached
+    ble_cache_move_names();
+    ble_names_full = false;
+}
+
+void ble_cache_get_stats(ble_cache_stats_t *stats) {
+    *stats = ble_cache_stats;
+    stats->size = device_list_idx;
+    stats->capacity = BLE_CACHE_MAX;
+    stats->visible = 0;
+    stats->oldest_ms = 0;
+    for(int idx=0;idx<device_list_idx;idx++) {
+        if(ble_cache_visible(idx)) stats->visible++;
+    }
+    if(lru_oldest >= 0) {
+        stats->oldest_ms = esp_timer_get_time() / 1000 - ble_cache[lru_oldest].last_seen;
+    }
+}
+
+int ble_cache_rssi_history(int idx, int8_t *rssi, int max) {
+    const struct ble_cache_entry *e = &ble_cache[idx];
+    int count = e->rssi_count < max ? e->rssi_count : max;
+    // The oldest of the readings wanted
+    int i = e->rssi_next - count;
+    if(i < 0) i += BLE_RSSI_HISTORY;
+    for(int n=0;n<count;n++) {
+        rssi[n] = ble_rssi_history[idx * BLE_RSSI_HISTORY + i];
+        i = i + 1 == BLE_RSSI_HISTORY ? 0 : i + 1;
+    }
+    return count;
+}
+
+// Larger is nearer. Path loss is the advertised TX power less the RSSI
+static inline int ble_near_key(const struct ble_cache_entry *e, bool by_path_loss) {
+    if(!by_path_loss) return e->rssi_smooth;
+    return e->rssi_smooth - e->tx_power * BLE_RSSI_ONE;
+}
+
+// Nearest whole dBm
+static inline int8_t ble_rssi_dbm(int32_t smooth) {
+    return (smooth + (smooth < 0 ? -BLE_RSSI_ONE / 2 : BLE_RSSI_ONE / 2)) / BLE_RSSI_ONE;
+}
+
+typedef struct {
+    int key;
+    int16_t idx;
+} ble_near_heap_t;
+
+// Restore the min heap below node i
+static void ble_near_sift_down(ble_near_heap_t *heap, int size, int i) {
+    for(;;) {
+        int least = i, l = 2 * i + 1, r = l + 1;
+        if(l < size && heap[l].key < heap[least].key) least = l;
+        if(r < size && heap[r].key < heap[least].key) least = r;
+        if(least == i) return;
+        ble_near_heap_t t = heap[i];
+        heap[i] = heap[least];
+        heap[least] = t;
+        i = least;
+    }
+}
+
+// One pass over the cache keeping the n nearest so far in a min heap, so the
+// cost is O(size log n) rather than a sort of the whole cache
+int ble_cache_nearest(ble_cache_near_t *near, int n, bool by_path_loss) {
+    ble_near_heap_t heap[BLE_NEAR_MAX];
+    int size = 0;
+    if(n > BLE_NEAR_MAX) n = BLE_NEAR_MAX;
+    if(n <= 0) return 0;
+
     for(int idx=0;idx<device_list_idx;idx++) {
-        if(ble_cache[idx].visible) continue;
-        if(idx<device_list_idx-1) {
-            // Copy the rest of the list down over this obsolete entry
-            memcpy(&ble_cache[idx], &ble_cache[idx+1], sizeof(struct ble_cache_entry) * (device_list_idx - idx));
+        const struct ble_cache_entry *e = &ble_cache[idx];
+        if(!ble_cache_visible(idx) || e->rssi_count == 0) continue;
+        // Without the TX power there is no path loss to rank by
+        if(by_path_loss && e->tx_power == BLE_ADV_NO_TX_POWER) continue;
+        int key = ble_near_key(e, by_path_loss);
+        if(size < n) {
+            // Sift up
+            int i = size++;
+            while(i > 0 && heap[(i - 1) / 2].key > key) {
+                heap[i] = heap[(i - 1) / 2];
+                i = (i - 1) / 2;
+            }
+            heap[i].key = key;
+            heap[i].idx = idx;
+        } else if(key > heap[0].key) {
+            heap[0].key = key;
+            heap[0].idx = idx;
+            ble_near_sift_down(heap, size, 0);
         }
-        device_list_idx--;
     }
+
+    // Take the farthest off the top of the heap, filling from the end
+    int count = size;
+    while(size > 0) {
+        const struct ble_cache_entry *e = &ble_cache[heap[0].idx];
+        ble_cache_near_t *out = &near[--size];
+        memcpy(out->bda, e->bda, sizeof(esp_bd_addr_t));
+        strlcpy(out->name, e->name ? e->name : "", sizeof(out->name));
+        out->rssi = ble_rssi_dbm(e->rssi_smooth);
+        out->tx_power = e->tx_power;
+        out->readings = ble_cache_rssi_history(heap[0].idx, out->history, BLE_RSSI_HISTORY);
+        heap[0] = heap[size];
+        ble_near_sift_down(heap, size, 0);
+    }
+    return count;
 }
 
 void ble_cache_dump() {
@@ -116,49 +415,241 @@ void ble_cache_dump() {
     }
 }
 
-void ble_cache_connect_from_unconnected() {
-    // Attempt to connect to the next BLE device which hasn't already failed to connect
+// Pick the most recently seen device without a name for a GATT name lookup,
+// and mark it as being connected to
+bool ble_cache_next_unnamed(esp_bd_addr_t bda, esp_ble_addr_type_t *bda_type) {
+    for(int idx=lru_newest;idx>=0;idx=ble_cache[idx].older) {
+        struct ble_cache_entry *e=&ble_cache[idx];
+        if(e->name || e->failed || e->name_failed || e->connecting) continue;
+        e->connecting=true;
+        memcpy(bda, e->bda, sizeof(esp_bd_addr_t));
+        *bda_type=e->bda_type;
+        return true;
+    }
+    return false;
+}
+
+void ble_cache_name_failed(const esp_bd_addr_t bda) {
+    uint32_t slot;
+    int idx = ble_index_find(ble_index, ble_cache, bda, &slot);
+    if(idx < 0) return;
+    ble_cache[idx].connecting=false;
+    // Don't try this device again
+    if(ble_cache[idx].name == NULL) ble_cache[idx].failed=true;
+}
 
-    ESP_LOGI(TAG,"Connecting");
-    for(int idx=0;idx<device_list_idx;idx++) {
-        //esp_log_buffer_hex(TAG, ble_cache[idx].bda, 6);
-        if(ble_cache[idx].failed || ble_cache[idx].name_failed) continue;
-        if(ble_cache[idx].connecting) return; // Already trying to connect
-        ESP_LOGI(TAG,"Connecting to %d", idx);
-        esp_log_buffer_hex(TAG, ble_cache[idx].bda, 6);
-        ble_cache[idx].connecting=true;
-        esp_ble_gattc_open(gl_profile_tab[PROFILE_A_APP_ID].gattc_if, ble_cache[idx].bda, ble_cache[idx].bda_type, true);
-        break;
+// Benchmark of ble_cache_add lookups, on a scratch cache so a scan in
+// progress is not disturbed. Reports come from a set of simulated devices
+// in random order. The scratch cache doesn't evict, so with more devices
+// than BLE_CACHE_MAX the extra ones are all misses, as in a busy environment
+static struct {
+    struct arg_int *devices;
+    struct arg_int *reports;
+    struct arg_end *end;
+} blebench_args;
+
+static inline uint32_t bench_next(uint32_t *x) {
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+static uint32_t bench_adds_per_s(int reports, int64_t us) {
+    return us > 0 ? (uint32_t)((uint64_t)reports * 1000000 / us) : 0;
+}
+
+static void bench_run(int devices, int reports, struct ble_cache_entry *entries, int16_t *index) {
+    esp_bd_addr_t *bdas = malloc(sizeof(esp_bd_addr_t) * devices);
+    if(!bdas) {
+        printf("No memory for %d devices\n", devices);
+        return;
+    }
+    esp_fill_random(bdas, sizeof(esp_bd_addr_t) * devices);
+    uint32_t seed = esp_random() | 1;
+
+    // Linear search, as ble_cache_add did before the index
+    int count = 0;
+    uint32_t x = seed;
+    int64_t start = esp_timer_get_time();
+    for(int r=0;r<reports;r++) {
+        const uint8_t *bda = bdas[bench_next(&x) % devices];
+        int idx;
+        for(idx=0;idx<count;idx++) {
+            if(memcmp(entries[idx].bda, bda, 6)==0) break;
+        }
+        if(idx==count && count<BLE_CACHE_MAX) {
+            memcpy(entries[count++].bda, bda, 6);
+        }
+    }
+    int64_t linear_us = esp_timer_get_time() - start;
+
+    // Hash index
+    count = 0;
+    memset(index, 0, sizeof(int16_t) * BLE_INDEX_SIZE);
+    x = seed;
+    start = esp_timer_get_time();
+    for(int r=0;r<reports;r++) {
+        const uint8_t *bda = bdas[bench_next(&x) % devices];
+        uint32_t slot;
+        if(ble_index_find(index, entries, bda, &slot) < 0 && count<BLE_CACHE_MAX) {
+            memcpy(entries[count].bda, bda, 6);
+            index[slot] = ++count;
+        }
     }
+    int64_t hashed_us = esp_timer_get_time() - start;
+
+    printf("%7d %9d %14u %14u %7u.%ux\n", devices, count, bench_adds_per_s(reports, linear_us),
+           bench_adds_per_s(reports, hashed_us), hashed_us ? (uint32_t)(linear_us / hashed_us) : 0,
+           hashed_us ? (uint32_t)(linear_us * 10 / hashed_us % 10) : 0);
+    free(bdas);
 }
 
-void ble_cache_connect() {
-    if(gl_profile_tab[PROFILE_A_APP_ID].open) {
-        // Disconnect any existing connection to our currently selected target device
-        esp_ble_gap_disconnect(gl_profile_tab[PROFILE_A_APP_ID].remote_bda);
+static int blebench(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &blebench_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, blebench_args.end, argv[0]);
+        return 1;
+    }
+    int reports = blebench_args.reports->count ? blebench_args.reports->ival[0] : 100000;
+    if(reports <= 0) {
+        printf("Reports must be positive\n");
+        return 1;
+    }
+
+    struct ble_cache_entry *entries = calloc(BLE_CACHE_MAX, sizeof(struct ble_cache_entry));
+    int16_t *index = malloc(sizeof(int16_t) * BLE_INDEX_SIZE);
+    if(!entries || !index) {
+        printf("No memory for the scratch cache\n");
+        free(entries);
+        free(index);
+        return 1;
+    }
+
+    printf("%d reports, cache of %d\n", reports, BLE_CACHE_MAX);
+    printf("Devices    Cached  Linear adds/s  Hashed adds/s  Speedup\n");
+    if(blebench_args.devices->count) {
+        int devices = blebench_args.devices->ival[0];
+        if(devices > 0) bench_run(devices, reports, entries, index);
     } else {
-        ble_cache_connect_from_unconnected();
+        bench_run(100, reports, entries, index);
+        bench_run(1000, reports, entries, index);
     }
+    free(entries);
+    free(index);
+    return 0;
 }
 
-void ble_cache_connect_failed() {
-    // Attempt to connect to the next BLE device which hasn't already failed to connect
-    ESP_LOGI(TAG,"Connecting");
-    for(int idx=0;idx<device_list_idx;idx++) {
-        if(!ble_cache[idx].connecting) continue; // Find the connection we were attempting
-        // Mark the connection as no longer connecting
-        ble_cache[idx].connecting=false;
-        // Check to see if we got the name before the connection failed
-        if(ble_cache[idx].name == NULL) {
-            // No name, so mark this entry as failed
-            ble_cache[idx].name_failed=true;
+void register_cmd_blebench(void)
+{
+    blebench_args.devices = arg_int0("n", "devices", "<n>", "Simulated devices, default 100 then 1000");
+    blebench_args.reports = arg_int0("r", "reports", "<n>", "Advertising reports, default 100000");
+    blebench_args.end = arg_end(2);
+
+    const esp_console_cmd_t cmd = {
+        .command = "blebench",
+        .help = "Measure BLE device cache adds per second",
+        .hint = NULL,
+        .func = &blebench,
+        .argtable = &blebench_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
+
+static int blecache(int argc, char **argv) {
+    if(!ble_cache) {
+        printf("BLE cache not allocated, is Bluetooth started?\n");
+        return 1;
+    }
+    ble_cache_stats_t s;
+    ble_cache_get_stats(&s);
+    uint32_t reports = s.hits + s.misses;
+
+    printf("Devices: %d of %d, %d seen this scan, oldest seen %ums ago\n", s.size, s.capacity, s.visible,
+           s.oldest_ms);
+    printf("Reports: %u hits, %u misses, %u%% hit rate\n", s.hits, s.misses,
+           reports ? (uint32_t)(s.hits * 100ULL / reports) : 0);
+    printf("Evicted %u, dropped %u, purged %u\n", s.evictions, s.dropped, s.purged);
+
+    ble_names_stats_t n;
+    ble_names_get_stats(&n);
+    printf("Names: %u in %u of %u bytes, peak %u, %u shared, %u not stored, %u arena swaps\n", n.names, n.used,
+           n.size, n.peak, n.shared, n.full, n.swaps);
+    return 0;
+}
+
+void register_cmd_blecache(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "blecache",
+        .help = "Show BLE device cache hits, misses and evictions",
+        .hint = NULL,
+        .func = &blecache,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
+
+static struct {
+    struct arg_int *count;
+    struct arg_lit *path_loss;
+    struct arg_lit *history;
+    struct arg_end *end;
+} blenear_args;
+
+static int blenear(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &blenear_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, blenear_args.end, argv[0]);
+        return 1;
+    }
+    if(!ble_cache) {
+        printf("BLE cache not allocated, is Bluetooth started?\n");
+        return 1;
+    }
+    int n = blenear_args.count->count ? blenear_args.count->ival[0] : 5;
+    if(n <= 0 || n > BLE_NEAR_MAX) {
+        printf("Count must be 1 to %d\n", BLE_NEAR_MAX);
+        return 1;
+    }
+    bool by_path_loss = blenear_args.path_loss->count;
+
+    static ble_cache_near_t near[BLE_NEAR_MAX]; // Too big for the console task's stack
+    int64_t start = esp_timer_get_time();
+    int count = ble_cache_nearest(near, n, by_path_loss);
+    uint32_t us = esp_timer_get_time() - start;
+
+    printf("%d of %d devices by %s, found in %uus\n", count, device_list_idx,
+           by_path_loss ? "path loss" : "RSSI", us);
+    for(int i=0;i<count;i++) {
+        ble_cache_near_t *d = &near[i];
+        printf("%02x:%02x:%02x:%02x:%02x:%02x %4ddBm", d->bda[0], d->bda[1], d->bda[2], d->bda[3], d->bda[4],
+               d->bda[5], d->rssi);
+        if(d->tx_power != BLE_ADV_NO_TX_POWER) printf(" tx %4ddBm", d->tx_power);
+        else printf("           ");
+        printf(" %s\n", d->name);
+        if(blenear_args.history->count) {
+            printf("   ");
+            for(int r=0;r<d->readings;r++) printf(" %d", d->history[r]);
+            printf("\n");
         }
-        if(gl_profile_tab[PROFILE_A_APP_ID].open) continue; // Open was successful
-        // Open failed, so mark this device as failed
-        ESP_LOGI(TAG,"Connection to %d failed", idx);
-        esp_log_buffer_hex(TAG, ble_cache[idx].bda, 6);
-        // Mark this entry as failed
-        ble_cache[idx].failed=true;
-        break;
     }
+    return 0;
+}
+
+void register_cmd_blenear(void)
+{
+    blenear_args.count = arg_int0("n", "count", "<n>", "Devices to show, default 5");
+    blenear_args.path_loss = arg_lit0("p", "path-loss", "Order by path loss from the advertised TX power, "
+                                      "leaving out devices which don't send it");
+    blenear_args.history = arg_lit0("H", "history", "Show the recent RSSI readings, oldest first");
+    blenear_args.end = arg_end(3);
+
+    const esp_console_cmd_t cmd = {
+        .command = "blenear",
+        .help = "Show the nearest BLE devices seen in this scan by smoothed RSSI",
+        .hint = NULL,
+        .func = &blenear,
+        .argtable = &blenear_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
 }
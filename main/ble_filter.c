@@ -0,0 +1,391 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
+#include "ble_filter.h"
+
+#define FILTER_MAX CONFIG_APP_BLE_FILTER_MAX
+#define FILTER_BYTES 16
+
+typedef struct ble_filter_rule {
+    uint8_t kind;
+    bool allow;
+    uint8_t len; // Bytes of the prefix to compare
+    int8_t rssi;
+    uint16_t value; // Address type, company ID or 16 bit UUID
+    uint8_t bytes[FILTER_BYTES]; // Address or name prefix, 128 bit UUID little endian
+    uint32_t hits;
+} ble_filter_rule_t;
+
+static const char *kind_names[BLE_FILTER_KIND_COUNT] = {
+    "bda", "type", "company", "uuid16", "uuid128", "name", "rssi"
+};
+
+// Rules which look in the advertising data
+static const bool kind_needs_adv[BLE_FILTER_KIND_COUNT] = {
+    [BLE_FILTER_COMPANY] = true, [BLE_FILTER_UUID16] = true, [BLE_FILTER_UUID128] = true, [BLE_FILTER_NAME] = true,
+};
+
+// Checked in the GAP callback and changed from the console, the lock is only
+// held while the table is walked or copied, which doesn't allocate, log or
+// parse
+static ble_filter_rule_t rules[FILTER_MAX];
+static int rule_count;
+static int adv_rule_count; // Rules which need the advertising data parsed
+static bool default_allow = true;
+static uint32_t default_hits;
+static uint32_t passed, dropped;
+static portMUX_TYPE filter_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool rule_match(const ble_filter_rule_t *r, const esp_ble_gap_cb_param_t *scan_result, const ble_adv_t *adv) {
+    switch(r->kind) {
+    case BLE_FILTER_BDA: return memcmp(scan_result->scan_rst.bda, r->bytes, r->len) == 0;
+    case BLE_FILTER_ADDR_TYPE: return scan_result->scan_rst.ble_addr_type == r->value;
+    case BLE_FILTER_COMPANY: return ble_adv_company(adv) == r->value;
+    case BLE_FILTER_UUID16: return ble_adv_has_uuid16(adv, r->value);
+    case BLE_FILTER_UUID128: return ble_adv_has_uuid128(adv, r->bytes);
+    case BLE_FILTER_NAME:
+        return adv->name.len >= r->len && memcmp(ble_adv_ptr(adv, adv->name), r->bytes, r->len) == 0;
+    case BLE_FILTER_RSSI: return scan_result->scan_rst.rssi < r->rssi;
+    default: return false;
+    }
+}
+
+bool ble_filter_pass(const esp_ble_gap_cb_param_t *scan_result, ble_adv_t *adv, bool *parsed) {
+    *parsed = false;
+    if(rule_count == 0) {
+        // Nothing to check, not worth the lock
+        return default_allow;
+    }
+
+    // Parse before taking the lock. If a rule needing it was added
+    // meanwhile, drop the lock and parse then
+    for(;;) {
+        if(adv_rule_count && !*parsed) {
+            ble_adv_parse(adv, scan_result->scan_rst.ble_adv, scan_result->scan_rst.adv_data_len,
+                          scan_result->scan_rst.scan_rsp_len);
+            *parsed = true;
+        }
+        portENTER_CRITICAL(&filter_lock);
+        if(!adv_rule_count || *parsed) break;
+        portEXIT_CRITICAL(&filter_lock);
+    }
+
+    bool allow = default_allow;
+    int i;
+    for(i=0; i<rule_count; i++) {
+        ble_filter_rule_t *r = &rules[i];
+        if(rule_match(r, scan_result, adv)) {
+            r->hits++;
+            allow = r->allow;
+            break;
+        }
+    }
+    if(i == rule_count) default_hits++;
+    if(allow) passed++;
+    else dropped++;
+    portEXIT_CRITICAL(&filter_lock);
+    return allow;
+}
+
+static int hex_nibble(char c) {
+    if(c >= '0' && c <= '9') return c - '0';
+    if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Hex digits, ignoring ':' and '-' separators. Returns the bytes read
+static int parse_hex(const char *s, uint8_t *out, int max) {
+    int n = 0;
+    while(*s) {
+        if(*s == ':' || *s == '-') {
+            s++;
+            continue;
+        }
+        int hi = hex_nibble(s[0]);
+        int lo = s[1] ? hex_nibble(s[1]) : -1;
+        if(hi < 0 || lo < 0 || n == max) return -1;
+        out[n++] = hi << 4 | lo;
+        s += 2;
+    }
+    return n;
+}
+
+static const char *type_names[] = { "public", "random", "rpa_public", "rpa_random" };
+
+esp_err_t ble_filter_add(bool allow, ble_filter_kind_t kind, const char *value) {
+    ble_filter_rule_t r = { .kind = kind, .allow = allow };
+    char *end;
+    long v;
+
+    switch(kind) {
+    case BLE_FILTER_BDA:
+        r.len = parse_hex(value, r.bytes, sizeof(esp_bd_addr_t));
+        if(r.len <= 0 || r.len > sizeof(esp_bd_addr_t)) return ESP_ERR_INVALID_ARG;
+        break;
+    case BLE_FILTER_ADDR_TYPE:
+        r.value = 0xFF;
+        for(int i=0; i<sizeof(type_names)/sizeof(type_names[0]); i++) {
+            if(strcasecmp(value, type_names[i]) == 0) r.value = i;
+        }
+        if(r.value == 0xFF) return ESP_ERR_INVALID_ARG;
+        break;
+    case BLE_FILTER_COMPANY:
+    case BLE_FILTER_UUID16:
+        v = strtol(value, &end, 0);
+        if(*end || v < 0 || v > 0xFFFF) return ESP_ERR_INVALID_ARG;
+        r.value = v;
+        break;
+    case BLE_FILTER_UUID128: {
+        // Written most significant byte first, sent least significant first
+        uint8_t be[16];
+        if(parse_hex(value, be, sizeof(be)) != sizeof(be)) return ESP_ERR_INVALID_ARG;
+        for(int i=0; i<16; i++) r.bytes[i] = be[15 - i];
+        break;
+    }
+    case BLE_FILTER_NAME:
+        r.len = strlen(value);
+        if(r.len == 0 || r.len > FILTER_BYTES) return ESP_ERR_INVALID_ARG;
+        memcpy(r.bytes, value, r.len);
+        break;
+    case BLE_FILTER_RSSI:
+        v = strtol(value, &end, 0);
+        if(*end || v < -127 || v > 20) return ESP_ERR_INVALID_ARG;
+        r.rssi = v;
+        break;
+    default:
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t err = ESP_ERR_NO_MEM;
+    portENTER_CRITICAL(&filter_lock);
+    if(rule_count < FILTER_MAX) {
+        rules[rule_count++] = r;
+        if(kind_needs_adv[kind]) adv_rule_count++;
+        err = ESP_OK;
+    }
+    portEXIT_CRITICAL(&filter_lock);
+    return err;
+}
+
+esp_err_t ble_filter_del(int n) {
+    esp_err_t err = ESP_OK;
+    portENTER_CRITICAL(&filter_lock);
+    if(n < 0) {
+        rule_count = 0;
+        adv_rule_count = 0;
+    } else if(n < rule_count) {
+        if(kind_needs_adv[rules[n].kind]) adv_rule_count--;
+        memmove(&rules[n], &rules[n + 1], sizeof(ble_filter_rule_t) * (rule_count - n - 1));
+        rule_count--;
+    } else {
+        err = ESP_ERR_NOT_FOUND;
+    }
+    portEXIT_CRITICAL(&filter_lock);
+    return err;
+}
+
+void ble_filter_set_default(bool allow) {
+    portENTER_CRITICAL(&filter_lock);
+    default_allow = allow;
+    portEXIT_CRITICAL(&filter_lock);
+}
+
+static bool parse_action(const char *s, bool *allow) {
+    if(strcasecmp(s, "allow") == 0) *allow = true;
+    else if(strcasecmp(s, "deny") == 0) *allow = false;
+    else return false;
+    return true;
+}
+
+static void print_rule(int n, const ble_filter_rule_t *r) {
+    printf("%2d %-5s %-7s ", n, r->allow ? "allow" : "deny", kind_names[r->kind]);
+    switch(r->kind) {
+    case BLE_FILTER_BDA:
+        for(int i=0; i<r->len; i++) printf(i ? ":%02x" : "%02x", r->bytes[i]);
+        break;
+    case BLE_FILTER_ADDR_TYPE: printf("%s", type_names[r->value]); break;
+    case BLE_FILTER_COMPANY:
+    case BLE_FILTER_UUID16: printf("0x%04x", r->value); break;
+    case BLE_FILTER_UUID128:
+        for(int i=15; i>=0; i--) printf(i == 11 || i == 9 || i == 7 || i == 5 ? "-%02x" : "%02x", r->bytes[i]);
+        break;
+    case BLE_FILTER_NAME: printf("%.*s", r->len, (const char *)r->bytes); break;
+    case BLE_FILTER_RSSI: printf("< %ddBm", r->rssi); break;
+    }
+    printf(" (%u hits)\n", r->hits);
+}
+
+static struct {
+    struct arg_lit *reset;
+    struct arg_end *end;
+} blefilter_args;
+
+static int blefilter(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &blefilter_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, blefilter_args.end, argv[0]);
+        return 1;
+    }
+
+    ble_filter_rule_t copy[FILTER_MAX];
+    portENTER_CRITICAL(&filter_lock);
+    int count = rule_count;
+    memcpy(copy, rules, sizeof(ble_filter_rule_t) * count);
+    uint32_t p = passed, d = dropped, dh = default_hits;
+    bool allow = default_allow;
+    if(blefilter_args.reset->count) {
+        for(int i=0; i<rule_count; i++) rules[i].hits = 0;
+        passed = dropped = default_hits = 0;
+    }
+    portEXIT_CRITICAL(&filter_lock);
+
+    printf("Reports: %u passed, %u dropped\n", p, d);
+    for(int i=0; i<count; i++) print_rule(i, &copy[i]);
+    printf("   %-5s default (%u hits)\n", allow ? "allow" : "deny", dh);
+    return 0;
+}
+
+static struct {
+    struct arg_str *action;
+    struct arg_str *kind;
+    struct arg_str *value;
+    struct arg_end *end;
+} add_args;
+
+static int blefilter_add(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &add_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, add_args.end, argv[0]);
+        return 1;
+    }
+    bool allow;
+    if(!parse_action(add_args.action->sval[0], &allow)) {
+        printf("Action must be allow or deny\n");
+        return 1;
+    }
+    int kind;
+    for(kind=0; kind<BLE_FILTER_KIND_COUNT; kind++) {
+        if(strcasecmp(add_args.kind->sval[0], kind_names[kind]) == 0) break;
+    }
+    if(kind == BLE_FILTER_KIND_COUNT) {
+        printf("Unknown rule kind %s\n", add_args.kind->sval[0]);
+        return 1;
+    }
+    esp_err_t err = ble_filter_add(allow, kind, add_args.value->sval[0]);
+    if(err == ESP_ERR_NO_MEM) {
+        printf("Table full, %d rules\n", FILTER_MAX);
+        return 1;
+    } else if(err != ESP_OK) {
+        printf("Bad value for %s\n", kind_names[kind]);
+        return 1;
+    }
+    return 0;
+}
+
+static struct {
+    struct arg_str *rule;
+    struct arg_end *end;
+} del_args;
+
+static int blefilter_del(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &del_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, del_args.end, argv[0]);
+        return 1;
+    }
+    const char *rule = del_args.rule->sval[0];
+    int n = -1;
+    if(strcasecmp(rule, "all") != 0) {
+        char *end;
+        long v = strtol(rule, &end, 10);
+        if(end == rule || *end || v < 0 || v >= FILTER_MAX) {
+            printf("Rule must be a number from blefilter, or all\n");
+            return 1;
+        }
+        n = v;
+    }
+    if(ble_filter_del(n) != ESP_OK) {
+        printf("No rule %s\n", rule);
+        return 1;
+    }
+    return 0;
+}
+
+static struct {
+    struct arg_str *action;
+    struct arg_end *end;
+} default_args;
+
+static int blefilter_default(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &default_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, default_args.end, argv[0]);
+        return 1;
+    }
+    bool allow;
+    if(!parse_action(default_args.action->sval[0], &allow)) {
+        printf("Action must be allow or deny\n");
+        return 1;
+    }
+    ble_filter_set_default(allow);
+    return 0;
+}
+
+void register_cmd_blefilter(void)
+{
+    blefilter_args.reset = arg_lit0("r", "reset", "Reset the hit counts after showing them");
+    blefilter_args.end = arg_end(1);
+
+    add_args.action = arg_str1(NULL, NULL, "<allow|deny>", "what to do with matching reports");
+    add_args.kind = arg_str1(NULL, NULL, "<kind>", "bda, type, company, uuid16, uuid128, name or rssi");
+    add_args.value = arg_str1("v", "value", "<value>", "address prefix aa:bb:cc, public/random/rpa_public/"
+                              "rpa_random, 0x004c, 0x180d, a full UUID, name prefix, or dBm to match weaker reports");
+    add_args.end = arg_end(3);
+
+    del_args.rule = arg_str1(NULL, NULL, "<n|all>", "rule number from blefilter, or all");
+    del_args.end = arg_end(1);
+
+    default_args.action = arg_str1(NULL, NULL, "<allow|deny>", "action for reports matching no rule");
+    default_args.end = arg_end(1);
+
+    const esp_console_cmd_t show_cmd = {
+        .command = "blefilter",
+        .help = "Show the BLE advertising filter rules and their hits",
+        .hint = NULL,
+        .func = &blefilter,
+        .argtable = &blefilter_args
+    };
+    const esp_console_cmd_t add_cmd = {
+        .command = "blefilter_add",
+        .help = "Add a BLE advertising filter rule, the first rule to match decides",
+        .hint = NULL,
+        .func = &blefilter_add,
+        .argtable = &add_args
+    };
+    const esp_console_cmd_t del_cmd = {
+        .command = "blefilter_del",
+        .help = "Remove a BLE advertising filter rule",
+        .hint = NULL,
+        .func = &blefilter_del,
+        .argtable = &del_args
+    };
+    const esp_console_cmd_t default_cmd = {
+        .command = "blefilter_default",
+        .help = "Set what happens to BLE reports no rule matches",
+        .hint = NULL,
+        .func = &blefilter_default,
+        .argtable = &default_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&show_cmd) );
+    ESP_ERROR_CHECK( esp_console_cmd_register(&add_cmd) );
+    ESP_ERROR_CHECK( esp_console_cmd_register(&del_cmd) );
+    ESP_ERROR_CHECK( esp_console_cmd_register(&default_cmd) );
+}
@@ -29,6 +29,8 @@
 #include "esp_bt_main.h"
 #include "esp_gatt_common_api.h"
 
+#include "ble_adv.h"
+#include "ble_filter.h"
 #include "ble_cache.h"
 #include "gatt_profile.h"
 
@@ -61,38 +63,24 @@ static inline void scan_start_complete(esp_ble_gap_cb_param_t *param) {
 
 int connect_in_progress=false;
 
-// Get the name from the advanced parameters if available
-// Return: NULL if name is not found, set adv_name_len = 0
-static inline uint8_t* get_name(const esp_ble_gap_cb_param_t *scan_result, uint8_t *adv_name_len) {
-    uint8_t *adv_name=NULL;
-    ESP_LOGD(TAG, "searched Adv Data Len %d, Scan Response Len %d", scan_result->scan_rst.adv_data_len, scan_result->scan_rst.scan_rsp_len);
-    adv_name = esp_ble_resolve_adv_data((uint8_t *)scan_result->scan_rst.ble_adv, ESP_BLE_AD_TYPE_NAME_CMPL, adv_name_len);
-    if(esp_log_level_get(TAG) > ESP_LOG_DEBUG) {
-        ESP_LOGD(TAG, "searched Device Name Len %d", *adv_name_len);
-        esp_log_buffer_char(TAG, adv_name, *adv_name_len);
-        ESP_LOGD(TAG, "\n");
-    }
-    return adv_name;
-}
-
 // Handle the event for a device seen in the scan
 // Note: Devices discovered here may be duplicates
 static inline void discover_device(const esp_ble_gap_cb_param_t *scan_result) {
-    uint8_t *adv_name = NULL;
-    uint8_t adv_name_len = 0;
+    ble_adv_t adv;
+    bool parsed;
+
+    // Drop unwanted reports before they cost anything more
+    if(!ble_filter_pass(scan_result, &adv, &parsed)) return;
 
-    // Decode the new device information
+    // Decode the new device information, advertising data and scan response in one pass
+    if(!parsed) ble_adv_parse(&adv, scan_result->scan_rst.ble_adv, scan_result->scan_rst.adv_data_len, scan_result->scan_rst.scan_rsp_len);
     if (esp_log_level_get(TAG) >= ESP_LOG_DEBUG ) {
         esp_log_buffer_hex(TAG, scan_result->scan_rst.bda, 6);
+        ESP_LOGD(TAG, "Adv Data Len %d, Scan Response Len %d", scan_result->scan_rst.adv_data_len, scan_result->scan_rst.scan_rsp_len);
+        esp_log_buffer_char(TAG, ble_adv_ptr(&adv, adv.name), adv.name.len);
     }
 
-    adv_name = get_name(scan_result, &adv_name_len);
-
-    if (adv_name != NULL) {
-        ble_cache_add(scan_result, adv_name, adv_name_len);
-    } else {
-        ble_cache_add(scan_result, (const uint8_t *)"", 0);
-    }
+    ble_cache_add(scan_result, &adv);
 
     ESP_LOGD(TAG, "Discovered %d",device_list_idx);
 }
@@ -109,7 +97,7 @@ static inline void scan_result(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_para
         ble_cache_purge();
         // The entire scan has finished
         ble_cache_dump();
-        ble_cache_connect();
+        ble_gattc_resolve();
         break;
     default:
         break;
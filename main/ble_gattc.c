@@ -31,20 +31,19 @@
 
 #include "gatt_profile.h"
 #include "ble_cache.h"
+#include "ble_store.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
 
 static const char *TAG="ble_gattc";
 
-#define PROFILE_A_APP_ID 0
-
 // GAP NAME SERVICE
 #define REMOTE_SERVICE_UUID        0x1800
 // GAP NAME CHARACTERISTIC
 #define REMOTE_NAME_CHAR_UUID      0x2A00
-#define PROFILE_NUM      1
-#define PROFILE_A_APP_ID 0
-#define INVALID_HANDLE   0
 
-static bool get_server = false;
+#define NAME_SLOTS CONFIG_APP_BLE_NAME_SLOTS
+#define NAME_TIMEOUT_US (CONFIG_APP_BLE_NAME_TIMEOUT_MS * 1000LL)
 
 /* Declare static functions */
 void esp_gattc_cb(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param);
@@ -76,10 +75,131 @@ struct gattc_profile_inst gl_profile_tab[PROFILE_NUM] = {
     [PROFILE_A_APP_ID] = {
         .gattc_cb = gattc_profile_event_handler,
         .gattc_if = ESP_GATT_IF_NONE,       /* Not get the gatt_if, so initial is ESP_GATT_IF_NONE */
-        .open = false,
     },
 };
 
+// Name lookups in progress. Each one opens a connection to a device without
+// a name, reads the GAP device name characteristic and closes it again. The
+// connections share the one profile and are told apart by conn_id, or by
+// address until the connection is up
+typedef enum {
+    SLOT_FREE,
+    SLOT_OPENING, // Waiting for the connection
+    SLOT_CONNECTED,
+} name_slot_state_t;
+
+typedef struct name_slot {
+    name_slot_state_t state;
+    esp_bd_addr_t bda;
+    uint16_t conn_id;
+    ble_store_handles_t handles; // From the store, or found by the search
+    bool service_found;
+    bool direct; // Reading by the stored handle, without a service search
+    bool resolved;
+    int64_t started;
+    esp_timer_handle_t timer; // Gives up on the lookup
+} name_slot_t;
+
+static name_slot_t name_slots[NAME_SLOTS];
+
+typedef struct {
+    uint32_t resolved;
+    uint32_t failed;
+    uint32_t timeouts;
+    uint64_t lookup_us; // Open until the name was read, resolved lookups only
+    uint32_t max_lookup_us;
+    int64_t since; // First lookup since the stats were reset
+} name_stats_t;
+
+static name_stats_t name_stats;
+static portMUX_TYPE name_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static name_slot_t *slot_by_bda(const esp_bd_addr_t bda) {
+    for(int i=0; i<NAME_SLOTS; i++) {
+        if(name_slots[i].state != SLOT_FREE && memcmp(name_slots[i].bda, bda, sizeof(esp_bd_addr_t)) == 0) {
+            return &name_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static name_slot_t *slot_by_conn(uint16_t conn_id) {
+    for(int i=0; i<NAME_SLOTS; i++) {
+        if(name_slots[i].state == SLOT_CONNECTED && name_slots[i].conn_id == conn_id) return &name_slots[i];
+    }
+    return NULL;
+}
+
+// Runs on the esp_timer task, so only asks the stack to drop the connection.
+// The slot is freed by the disconnect or open failure that follows
+static void slot_timeout(void *arg) {
+    name_slot_t *slot = (name_slot_t *)arg;
+    portENTER_CRITICAL(&name_lock);
+    name_stats.timeouts++;
+    portEXIT_CRITICAL(&name_lock);
+    if(slot->state == SLOT_CONNECTED) {
+        esp_ble_gattc_close(gl_profile_tab[PROFILE_A_APP_ID].gattc_if, slot->conn_id);
+    } else {
+        esp_ble_gap_disconnect(slot->bda);
+    }
+}
+
+// The lookup has ended, with or without a name
+static void slot_done(name_slot_t *slot) {
+    esp_timer_stop(slot->timer);
+    if(!slot->resolved) {
+        ble_cache_name_failed(slot->bda);
+        portENTER_CRITICAL(&name_lock);
+        name_stats.failed++;
+        portEXIT_CRITICAL(&name_lock);
+    }
+    slot->state = SLOT_FREE;
+    // Start the next lookup in its place
+    ble_gattc_resolve();
+}
+
+static void slot_close(name_slot_t *slot) {
+    esp_ble_gattc_close(gl_profile_tab[PROFILE_A_APP_ID].gattc_if, slot->conn_id);
+}
+
+void ble_gattc_resolve(void) {
+    esp_gatt_if_t gattc_if = gl_profile_tab[PROFILE_A_APP_ID].gattc_if;
+    if(gattc_if == ESP_GATT_IF_NONE) return;
+
+    for(int i=0; i<NAME_SLOTS; i++) {
+        name_slot_t *slot = &name_slots[i];
+        if(slot->state != SLOT_FREE) continue;
+
+        esp_ble_addr_type_t bda_type;
+        while(ble_cache_next_unnamed(slot->bda, &bda_type)) {
+            if(!slot->timer) {
+                const esp_timer_create_args_t args = { .callback = slot_timeout, .arg = slot, .name = "ble_name" };
+                ESP_ERROR_CHECK(esp_timer_create(&args, &slot->timer));
+            }
+            slot->started = esp_timer_get_time();
+            slot->service_found = false;
+            slot->resolved = false;
+            slot->direct = ble_store_get_handles(slot->bda, &slot->handles);
+            portENTER_CRITICAL(&name_lock);
+            if(!name_stats.since) name_stats.since = slot->started;
+            portEXIT_CRITICAL(&name_lock);
+
+            ESP_LOGI(TAG, "Looking up name in slot %d", i);
+            esp_log_buffer_hex(TAG, slot->bda, sizeof(esp_bd_addr_t));
+            if(esp_ble_gattc_open(gattc_if, slot->bda, bda_type, true) == ESP_OK) {
+                slot->state = SLOT_OPENING;
+                esp_timer_start_once(slot->timer, NAME_TIMEOUT_US);
+                break;
+            }
+            ble_cache_name_failed(slot->bda);
+            portENTER_CRITICAL(&name_lock);
+            name_stats.failed++;
+            portEXIT_CRITICAL(&name_lock);
+        }
+        if(slot->state == SLOT_FREE) break; // No more devices to look up
+    }
+}
+
 static inline void reg() {
     ESP_LOGI(TAG, "REG_EVT");
     esp_err_t scan_ret = esp_ble_gap_set_scan_params(&ble_scan_params);
@@ -90,10 +210,10 @@ static inline void reg() {
 
 static inline void connect(esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *p_data) {
     ESP_LOGI(TAG, "ESP_GATTC_CONNECT_EVT conn_id %d, if %d", p_data->connect.conn_id, gattc_if);
-    gl_profile_tab[PROFILE_A_APP_ID].conn_id = p_data->connect.conn_id;
-    memcpy(gl_profile_tab[PROFILE_A_APP_ID].remote_bda, p_data->connect.remote_bda, sizeof(esp_bd_addr_t));
-    ESP_LOGI(TAG, "REMOTE BDA:");
-    esp_log_buffer_hex(TAG, gl_profile_tab[PROFILE_A_APP_ID].remote_bda, sizeof(esp_bd_addr_t));
+    name_slot_t *slot = slot_by_bda(p_data->connect.remote_bda);
+    if(!slot) return; // Not one of ours
+    slot->conn_id = p_data->connect.conn_id;
+    slot->state = SLOT_CONNECTED;
     esp_err_t mtu_ret = esp_ble_gattc_send_mtu_req (gattc_if, p_data->connect.conn_id);
     if (mtu_ret){
         ESP_LOGE(TAG, "config MTU error, error code = %x", mtu_ret);
@@ -103,24 +223,41 @@ static inline void connect(esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *p_d
 // Handle a BLE Event which reports the value of a characteristic. This is _the_
 // event we care about when trying to read values from a BLE connection
 static inline void read(esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *p_data) {
-    ESP_LOGI(TAG, "Read");
+    name_slot_t *slot = slot_by_conn(p_data->read.conn_id);
+    if(!slot) return;
     if(p_data->read.status==0) {
         ESP_LOG_BUFFER_CHAR(TAG, p_data->read.value, p_data->read.value_len);
-        ble_cache_update_name(gl_profile_tab[PROFILE_A_APP_ID].remote_bda, p_data->read.value, p_data->read.value_len);
-        ble_cache_connect();
+        ble_cache_update_name(slot->bda, p_data->read.value, p_data->read.value_len);
+        ble_store_put(slot->bda, p_data->read.value, p_data->read.value_len, &slot->handles);
+        if(slot->direct) ble_store_count_direct();
+        slot->resolved = true;
+        uint32_t us = esp_timer_get_time() - slot->started;
+        portENTER_CRITICAL(&name_lock);
+        name_stats.resolved++;
+        name_stats.lookup_us += us;
+        if(us > name_stats.max_lookup_us) name_stats.max_lookup_us = us;
+        portEXIT_CRITICAL(&name_lock);
+    } else if(slot->direct) {
+        // The stored handle may be stale, search for it instead
+        ESP_LOGW(TAG, "Read by handle error %d", p_data->read.status);
+        slot->direct = false;
+        esp_ble_gattc_search_service(gattc_if, slot->conn_id, &remote_filter_service_uuid);
+        return;
     } else {
         ESP_LOGE(TAG, "Read error %d", p_data->read.status);
     }
+    slot_close(slot);
 }
 
 static inline void service_found(esp_ble_gattc_cb_param_t *p_data) {
     ESP_LOGD(TAG, "SEARCH RES: conn_id = %x is primary service %d", p_data->search_res.conn_id, p_data->search_res.is_primary);
     ESP_LOGD(TAG, "start handle %d end handle %d current handle value %d", p_data->search_res.start_handle, p_data->search_res.end_handle, p_data->search_res.srvc_id.inst_id);
-    if (p_data->search_res.srvc_id.uuid.len == ESP_UUID_LEN_16 && p_data->search_res.srvc_id.uuid.uuid.uuid16 == REMOTE_SERVICE_UUID) {
+    name_slot_t *slot = slot_by_conn(p_data->search_res.conn_id);
+    if (slot && p_data->search_res.srvc_id.uuid.len == ESP_UUID_LEN_16 && p_data->search_res.srvc_id.uuid.uuid.uuid16 == REMOTE_SERVICE_UUID) {
         ESP_LOGD(TAG, "service found");
-        get_server = true;
-        gl_profile_tab[PROFILE_A_APP_ID].service_start_handle = p_data->search_res.start_handle;
-        gl_profile_tab[PROFILE_A_APP_ID].service_end_handle = p_data->search_res.end_handle;
+        slot->service_found = true;
+        slot->handles.service_start = p_data->search_res.start_handle;
+        slot->handles.service_end = p_data->search_res.end_handle;
         ESP_LOGD(TAG, "UUID16: %x", p_data->search_res.srvc_id.uuid.uuid.uuid16);
     }
 }
@@ -128,63 +265,77 @@ static inline void service_found(esp_ble_gattc_cb_param_t *p_data) {
 static inline void open(esp_ble_gattc_cb_param_t *p_data) {
     if (p_data->open.status != ESP_GATT_OK){
         ESP_LOGE(TAG, "open failed, status %d", p_data->open.status);
+        name_slot_t *slot = slot_by_bda(p_data->open.remote_bda);
+        if(slot) slot_done(slot);
         return;
     }
-    gl_profile_tab[PROFILE_A_APP_ID].open=true;
-    get_server=false;
     ESP_LOGD(TAG, "open success");
+    // The connect event may not have been seen yet
+    name_slot_t *slot = slot_by_bda(p_data->open.remote_bda);
+    if(!slot) return;
+    slot->conn_id = p_data->open.conn_id;
+    slot->state = SLOT_CONNECTED;
+    if(slot->direct) {
+        // Read the name where it was last time, skipping the service search
+        if(esp_ble_gattc_read_char(gl_profile_tab[PROFILE_A_APP_ID].gattc_if, slot->conn_id, slot->handles.name_char,
+                                   ESP_GATT_AUTH_REQ_NONE) != ESP_OK) {
+            slot->direct = false;
+        }
+    }
 }
 
-// Get the device name from the GATT GAP service
-static inline void get_name(esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *p_data) {
+// Get the device name from the GATT GAP service. Returns false if the read
+// could not be started
+static inline bool get_name(esp_gatt_if_t gattc_if, name_slot_t *slot) {
     uint16_t count = 0;
     esp_gatt_status_t status = esp_ble_gattc_get_attr_count( gattc_if,
-                                                             p_data->search_cmpl.conn_id,
+                                                             slot->conn_id,
                                                              ESP_GATT_DB_CHARACTERISTIC,
-                                                             gl_profile_tab[PROFILE_A_APP_ID].service_start_handle,
-                                                             gl_profile_tab[PROFILE_A_APP_ID].service_end_handle,
+                                                             slot->handles.service_start,
+                                                             slot->handles.service_end,
                                                              INVALID_HANDLE,
                                                              &count);
     if (status != ESP_GATT_OK){
         ESP_LOGE(TAG, "esp_ble_gattc_get_attr_count error %d", status);
+        return false;
+    }
+    if (count == 0) {
+        ESP_LOGE(TAG, "no char found");
+        return false;
     }
 
-    if (count > 0) {
-        static esp_gattc_char_elem_t *char_elem_result   = NULL;
-
-        char_elem_result = (esp_gattc_char_elem_t *)malloc(sizeof(esp_gattc_char_elem_t) * count);
-        if (!char_elem_result) {
-            ESP_LOGE(TAG, "gattc no mem");
-        } else {
-            status = esp_ble_gattc_get_char_by_uuid( gattc_if,
-                                                     p_data->search_cmpl.conn_id,
-                                                     gl_profile_tab[PROFILE_A_APP_ID].service_start_handle,
-                                                     gl_profile_tab[PROFILE_A_APP_ID].service_end_handle,
-                                                     remote_filter_char_uuid,
-                                                     char_elem_result,
-                                                     &count);
-            if (status != ESP_GATT_OK) {
-                ESP_LOGE(TAG, "esp_ble_gattc_get_char_by_uuid error");
-            }
-            ESP_LOGI(TAG, "Got name characteristic %d", count);
-            /*  Every service have only one char in our 'ESP_GATTS_DEMO' demo, so we used first 'char_elem_result' */
-            if (count > 0 && (char_elem_result[0].properties & ESP_GATT_CHAR_PROP_BIT_READ)){
-                gl_profile_tab[PROFILE_A_APP_ID].char_handle = char_elem_result[0].char_handle;
-                ESP_ERROR_CHECK(esp_ble_gattc_read_char(gattc_if, p_data->search_cmpl.conn_id, gl_profile_tab[PROFILE_A_APP_ID].char_handle, ESP_GATT_AUTH_REQ_NONE));
-                //    esp_ble_gattc_register_for_notify (gattc_if, gl_profile_tab[PROFILE_A_APP_ID].remote_bda, char_elem_result[0].char_handle);
-            }
-        }
-        /* free char_elem_result */
-        free(char_elem_result);
+    bool reading = false;
+    esp_gattc_char_elem_t *char_elem_result = (esp_gattc_char_elem_t *)malloc(sizeof(esp_gattc_char_elem_t) * count);
+    if (!char_elem_result) {
+        ESP_LOGE(TAG, "gattc no mem");
     } else {
-        ESP_LOGE(TAG, "no char found");
+        status = esp_ble_gattc_get_char_by_uuid( gattc_if,
+                                                 slot->conn_id,
+                                                 slot->handles.service_start,
+                                                 slot->handles.service_end,
+                                                 remote_filter_char_uuid,
+                                                 char_elem_result,
+                                                 &count);
+        if (status != ESP_GATT_OK) {
+            ESP_LOGE(TAG, "esp_ble_gattc_get_char_by_uuid error");
+        } else if (count > 0 && (char_elem_result[0].properties & ESP_GATT_CHAR_PROP_BIT_READ)){
+            // There is only one device name characteristic
+            slot->handles.name_char = char_elem_result[0].char_handle;
+            reading = esp_ble_gattc_read_char(gattc_if, slot->conn_id, char_elem_result[0].char_handle, ESP_GATT_AUTH_REQ_NONE) == ESP_OK;
+        }
     }
+    /* free char_elem_result */
+    free(char_elem_result);
+    return reading;
 }
 
 // Handle the service search complete event.
 static inline void search_cmpl(esp_gatt_if_t gattc_if,esp_ble_gattc_cb_param_t *p_data) {
+    name_slot_t *slot = slot_by_conn(p_data->search_cmpl.conn_id);
+    if(!slot) return;
     if (p_data->search_cmpl.status != ESP_GATT_OK){
         ESP_LOGE(TAG, "search service failed, error status = %x", p_data->search_cmpl.status);
+        slot_close(slot);
         return;
     }
 
@@ -198,7 +349,26 @@ static inline void search_cmpl(esp_gatt_if_t gattc_if,esp_ble_gattc_cb_param_t *
     ESP_LOGD(TAG, "ESP_GATTC_SEARCH_CMPL_EVT");
 
     // If we found the service, invoke it to get the device name
-    if (get_server) get_name(gattc_if, p_data);
+    if (!slot->service_found || !get_name(gattc_if, slot)) slot_close(slot);
+}
+
+// Service discovery has finished, search it for the GAP service
+static inline void discovered(esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *p_data) {
+    name_slot_t *slot = slot_by_conn(p_data->dis_srvc_cmpl.conn_id);
+    if (p_data->dis_srvc_cmpl.status != ESP_GATT_OK){
+        ESP_LOGE(TAG, "discover service failed, status %d", p_data->dis_srvc_cmpl.status);
+        if(slot) slot_close(slot);
+        return;
+    }
+    ESP_LOGI(TAG, "discover service complete conn_id %d", p_data->dis_srvc_cmpl.conn_id);
+    if(slot && slot->direct) return; // Already reading by handle
+    esp_ble_gattc_search_service(gattc_if, p_data->dis_srvc_cmpl.conn_id, &remote_filter_service_uuid);
+}
+
+static inline void disconnect(esp_ble_gattc_cb_param_t *p_data) {
+    ESP_LOGI(TAG, "ESP_GATTC_DISCONNECT_EVT, reason = %d", p_data->disconnect.reason);
+    name_slot_t *slot = slot_by_bda(p_data->disconnect.remote_bda);
+    if(slot) slot_done(slot);
 }
 
 static void gattc_profile_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param)
@@ -211,29 +381,17 @@ static void gattc_profile_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_
     case ESP_GATTC_CONNECT_EVT: connect(gattc_if, p_data); break;
     case ESP_GATTC_READ_CHAR_EVT: read(gattc_if, p_data); break;
     case ESP_GATTC_OPEN_EVT: open(p_data); break;
-    case ESP_GATTC_DIS_SRVC_CMPL_EVT:
-        if (param->dis_srvc_cmpl.status != ESP_GATT_OK){
-            ESP_LOGE(TAG, "discover service failed, status %d", param->dis_srvc_cmpl.status);
-            break;
-        }
-        ESP_LOGI(TAG, "discover service complete conn_id %d", param->dis_srvc_cmpl.conn_id);
-        esp_ble_gattc_search_service(gattc_if, param->cfg_mtu.conn_id, &remote_filter_service_uuid);
-        break;
+    case ESP_GATTC_DIS_SRVC_CMPL_EVT: discovered(gattc_if, p_data); break;
     case ESP_GATTC_CFG_MTU_EVT:
+        // Discovery runs alongside, the search is started when it completes
         if (param->cfg_mtu.status != ESP_GATT_OK){
             ESP_LOGE(TAG,"config mtu failed, error status = %x", param->cfg_mtu.status);
         }
         ESP_LOGD(TAG, "ESP_GATTC_CFG_MTU_EVT, Status %d, MTU %d, conn_id %d", param->cfg_mtu.status, param->cfg_mtu.mtu, param->cfg_mtu.conn_id);
-        esp_ble_gattc_search_service(gattc_if, param->cfg_mtu.conn_id, &remote_filter_service_uuid);
         break;
     case ESP_GATTC_SEARCH_RES_EVT: service_found(p_data); break;
     case ESP_GATTC_SEARCH_CMPL_EVT: search_cmpl(gattc_if, p_data); break;
-    case ESP_GATTC_DISCONNECT_EVT:
-        ESP_LOGI(TAG, "ESP_GATTC_DISCONNECT_EVT, reason = %d", p_data->disconnect.reason);
-        ble_cache_connect_failed();
-        gl_profile_tab[PROFILE_A_APP_ID].open=false;
-        ble_cache_connect_from_unconnected();
-        break;
+    case ESP_GATTC_DISCONNECT_EVT: disconnect(p_data); break;
     default:
         break;
     }
@@ -268,3 +426,51 @@ void esp_gattc_cb(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_ga
         }
     } while (0); // FIXME: hmm. why is this in a while (false) loop?
 }
+
+static struct {
+    struct arg_lit *reset;
+    struct arg_end *end;
+} blenames_args;
+
+static int blenames(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &blenames_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, blenames_args.end, argv[0]);
+        return 1;
+    }
+
+    int busy = 0;
+    for(int i=0; i<NAME_SLOTS; i++) {
+        if(name_slots[i].state != SLOT_FREE) busy++;
+    }
+    name_stats_t s;
+    portENTER_CRITICAL(&name_lock);
+    s = name_stats;
+    if(blenames_args.reset->count) {
+        memset(&name_stats, 0, sizeof(name_stats));
+    }
+    portEXIT_CRITICAL(&name_lock);
+
+    int64_t elapsed = s.since ? esp_timer_get_time() - s.since : 0;
+    printf("Lookups: %d of %d slots busy, %ums timeout\n", busy, NAME_SLOTS, CONFIG_APP_BLE_NAME_TIMEOUT_MS);
+    printf("Resolved %u, failed %u, %u timed out\n", s.resolved, s.failed, s.timeouts);
+    printf("%u per minute, average %ums, max %ums\n",
+           elapsed > 0 ? (uint32_t)(s.resolved * 60000000LL / elapsed) : 0,
+           s.resolved ? (uint32_t)(s.lookup_us / s.resolved / 1000) : 0, s.max_lookup_us / 1000);
+    return 0;
+}
+
+void register_cmd_blenames(void)
+{
+    blenames_args.reset = arg_lit0("r", "reset", "Reset the counts after showing them");
+    blenames_args.end = arg_end(1);
+
+    const esp_console_cmd_t cmd = {
+        .command = "blenames",
+        .help = "Show BLE name lookups resolved per minute and time per lookup",
+        .hint = NULL,
+        .func = &blenames,
+        .argtable = &blenames_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
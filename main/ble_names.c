@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "ble_names.h"
+
+static const char *TAG="ble_names";
+
+#define NAMES_SIZE (CONFIG_APP_BLE_NAME_ARENA_KB * 1024)
+// Names are a length byte, the name and a terminator. Allow for an average
+// of 12 bytes a name, with the table kept at most three quarters full
+#define NAMES_SLOTS (NAMES_SIZE / 12 * 4 / 3)
+#define NAMES_MAX (NAMES_SLOTS * 3 / 4)
+
+typedef struct names_arena {
+    uint8_t *data;
+    uint16_t *slots; // Offset of a name plus one, zero is empty
+    uint32_t slot_count; // A power of two
+    uint32_t used;
+    uint32_t names;
+} names_arena_t;
+
+static names_arena_t arenas[2];
+static names_arena_t *cur;
+static ble_names_stats_t names_stats;
+
+static inline uint32_t names_hash(const char *name, uint8_t len) {
+    uint32_t h = 0x811C9DC5u;
+    for(int i=0; i<len; i++) {
+        h = (h ^ (uint8_t)name[i]) * 0x01000193u;
+    }
+    return h;
+}
+
+const char *ble_names_intern(const char *name, uint8_t len) {
+    names_arena_t *a = cur;
+    uint32_t mask = a->slot_count - 1;
+    uint32_t s = names_hash(name, len) & mask;
+    for(; a->slots[s]; s=(s + 1) & mask) {
+        uint8_t *p = a->data + a->slots[s] - 1;
+        if(p[0] == len && memcmp(p + 1, name, len) == 0) {
+            names_stats.shared++;
+            return (const char *)p + 1;
+        }
+    }
+
+    if(a->used + len + 2 > NAMES_SIZE || a->names >= NAMES_MAX) {
+        names_stats.full++;
+        return NULL;
+    }
+    uint8_t *p = a->data + a->used;
+    p[0] = len;
+    memcpy(p + 1, name, len);
+    p[len + 1] = '\0';
+    a->slots[s] = a->used + 1;
+    a->used += len + 2;
+    a->names++;
+    if(a->used > names_stats.peak) names_stats.peak = a->used;
+    return (const char *)p + 1;
+}
+
+void ble_names_swap(void) {
+    cur = cur == &arenas[0] ? &arenas[1] : &arenas[0];
+    memset(cur->slots, 0, cur->slot_count * sizeof(uint16_t));
+    cur->used = 0;
+    cur->names = 0;
+    names_stats.swaps++;
+}
+
+esp_err_t ble_names_init(uint32_t caps) {
+    uint32_t slot_count = 1;
+    while(slot_count < NAMES_SLOTS) slot_count <<= 1;
+
+    for(int i=0; i<2; i++) {
+        arenas[i].data = heap_caps_malloc(NAMES_SIZE, caps);
+        arenas[i].slots = heap_caps_calloc(slot_count, sizeof(uint16_t), caps);
+        arenas[i].slot_count = slot_count;
+        if(!arenas[i].data || !arenas[i].slots) {
+            ESP_LOGE(TAG, "No memory for name arenas");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    cur = &arenas[0];
+    names_stats.size = NAMES_SIZE;
+    return ESP_OK;
+}
+
+void ble_names_get_stats(ble_names_stats_t *stats) {
+    *stats = names_stats;
+    stats->used = cur ? cur->used : 0;
+    stats->names = cur ? cur->names : 0;
+}
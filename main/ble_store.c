@@ -0,0 +1,308 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "ble_store.h"
+
+static const char *TAG="ble_store";
+
+#define STORE_NAMESPACE "ble_store"
+#define STORE_KEY "names"
+#define STORE_MAX CONFIG_APP_BLE_STORE_MAX
+#define STORE_TTL_S (CONFIG_APP_BLE_STORE_TTL_H * 3600)
+#define STORE_SAVE_DELAY_MS 10000 // Quiet time after the last name before it is written
+
+typedef struct __attribute__((packed)) ble_store_rec {
+    esp_bd_addr_t bda;
+    uint8_t name_len; // 0 for an empty record
+    uint8_t version;
+    uint32_t saved; // time() the name was read
+    ble_store_handles_t handles;
+    char name[BLE_STORE_NAME_MAX];
+} ble_store_rec_t;
+
+#define STORE_VERSION 1
+
+// Searched from the GAP callback, so guarded by a spinlock rather than a
+// mutex, and only copied out while held. NVS writes happen outside it
+static ble_store_rec_t *recs;
+static portMUX_TYPE store_lock = portMUX_INITIALIZER_UNLOCKED;
+static ble_store_stats_t store_stats;
+static TaskHandle_t store_task;
+
+// Open addressing index of the records by BDA with linear probing, as in
+// ble_cache. Slots hold the record number plus one, so zero is empty. Kept
+// at least half empty so probe chains stay short
+#define STORE_INDEX_BITS (STORE_MAX <= 16 ? 5 : STORE_MAX <= 32 ? 6 : STORE_MAX <= 64 ? 7 : STORE_MAX <= 128 ? 8 : 9)
+#define STORE_INDEX_SIZE (1 << STORE_INDEX_BITS)
+#define STORE_INDEX_MASK (STORE_INDEX_SIZE - 1)
+
+static int16_t store_index[STORE_INDEX_SIZE];
+
+static inline uint32_t store_hash(const uint8_t *bda) {
+    uint64_t v = 0;
+    memcpy(&v, bda, sizeof(esp_bd_addr_t));
+    return (uint32_t)((v * 0x9E3779B97F4A7C15ULL) >> (64 - STORE_INDEX_BITS));
+}
+
+// Find the record with this BDA, or NULL. The slot it is in, or would go
+// in, is returned through slot
+static ble_store_rec_t *store_find(const esp_bd_addr_t bda, uint32_t *slot) {
+    uint32_t s = store_hash(bda);
+    while(store_index[s]) {
+        ble_store_rec_t *rec = &recs[store_index[s] - 1];
+        if(memcmp(rec->bda, bda, sizeof(esp_bd_addr_t)) == 0) {
+            *slot = s;
+            return rec;
+        }
+        s = (s + 1) & STORE_INDEX_MASK;
+    }
+    *slot = s;
+    return NULL;
+}
+
+// Empty a slot, moving later records of the probe chain back so none of
+// them is cut off from its home slot
+static void store_index_remove(uint32_t slot) {
+    uint32_t hole = slot;
+    for(uint32_t s=(slot + 1) & STORE_INDEX_MASK; store_index[s]; s=(s + 1) & STORE_INDEX_MASK) {
+        uint32_t home = store_hash(recs[store_index[s] - 1].bda);
+        // Move it if its home is not between the hole and where it is now
+        if(((s - home) & STORE_INDEX_MASK) >= ((s - hole) & STORE_INDEX_MASK)) {
+            store_index[hole] = store_index[s];
+            hole = s;
+        }
+    }
+    store_index[hole] = 0;
+}
+
+// A clock which went backwards, after a power cut, also expires names
+static bool store_expired(const ble_store_rec_t *rec, time_t now) {
+    return now < rec->saved || now - rec->saved > STORE_TTL_S;
+}
+
+bool ble_store_get_name(const esp_bd_addr_t bda, char *name, uint8_t *len) {
+    if(!recs) return false;
+    bool found = false;
+    time_t now = time(NULL);
+
+    portENTER_CRITICAL(&store_lock);
+    uint32_t slot;
+    ble_store_rec_t *rec = store_find(bda, &slot);
+    if(rec && store_expired(rec, now)) {
+        store_stats.expired++;
+    } else if(rec) {
+        memcpy(name, rec->name, rec->name_len);
+        *len = rec->name_len;
+        store_stats.hits++;
+        found = true;
+    }
+    portEXIT_CRITICAL(&store_lock);
+    return found;
+}
+
+bool ble_store_get_handles(const esp_bd_addr_t bda, ble_store_handles_t *handles) {
+    if(!recs) return false;
+    portENTER_CRITICAL(&store_lock);
+    uint32_t slot;
+    ble_store_rec_t *rec = store_find(bda, &slot);
+    if(rec) *handles = rec->handles;
+    portEXIT_CRITICAL(&store_lock);
+    return rec && handles->name_char;
+}
+
+void ble_store_put(const esp_bd_addr_t bda, const uint8_t *name, uint8_t len, const ble_store_handles_t *handles) {
+    if(!recs || len == 0) return;
+    if(len > BLE_STORE_NAME_MAX) len = BLE_STORE_NAME_MAX;
+
+    portENTER_CRITICAL(&store_lock);
+    uint32_t slot;
+    ble_store_rec_t *rec = store_find(bda, &slot);
+    if(!rec) {
+        // An empty record, or else the oldest
+        rec = &recs[0];
+        for(int i=0; i<STORE_MAX && rec->name_len; i++) {
+            if(!recs[i].name_len || recs[i].saved < rec->saved) rec = &recs[i];
+        }
+        if(!rec->name_len) {
+            store_stats.records++;
+        } else {
+            uint32_t old;
+            store_find(rec->bda, &old);
+            store_index_remove(old);
+            store_find(bda, &slot); // The removal may have moved the free slot
+        }
+        store_index[slot] = rec - recs + 1;
+    }
+    memcpy(rec->bda, bda, sizeof(esp_bd_addr_t));
+    rec->name_len = len;
+    rec->version = STORE_VERSION;
+    rec->saved = time(NULL);
+    rec->handles = *handles;
+    memcpy(rec->name, name, len);
+    store_stats.stored++;
+    store_stats.dirty++;
+    portEXIT_CRITICAL(&store_lock);
+
+    if(store_task) xTaskNotifyGive(store_task);
+}
+
+void ble_store_count_direct(void) {
+    portENTER_CRITICAL(&store_lock);
+    store_stats.direct++;
+    portEXIT_CRITICAL(&store_lock);
+}
+
+esp_err_t ble_store_save(void) {
+    if(!recs || !store_stats.dirty) return ESP_OK;
+
+    size_t len = sizeof(ble_store_rec_t) * STORE_MAX;
+    ble_store_rec_t *copy = malloc(len);
+    if(!copy) return ESP_ERR_NO_MEM;
+    portENTER_CRITICAL(&store_lock);
+    memcpy(copy, recs, len);
+    uint32_t dirty = store_stats.dirty;
+    portEXIT_CRITICAL(&store_lock);
+
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(STORE_NAMESPACE, NVS_READWRITE, &nvs);
+    if(err == ESP_OK) {
+        err = nvs_set_blob(nvs, STORE_KEY, copy, len);
+        if(err == ESP_OK) err = nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+    free(copy);
+
+    if(err == ESP_OK) {
+        portENTER_CRITICAL(&store_lock);
+        store_stats.dirty -= dirty;
+        store_stats.saves++;
+        portEXIT_CRITICAL(&store_lock);
+    } else {
+        ESP_LOGE(TAG, "Save failed %s", esp_err_to_name(err));
+    }
+    return err;
+}
+
+// Names are put from the Bluetooth callbacks, which must not wait on flash.
+// This writes them once no new name has come in for STORE_SAVE_DELAY_MS,
+// so the names read after a scan go in one write
+static void ble_store_task(void *arg) {
+    for(;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while(ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(STORE_SAVE_DELAY_MS))) {
+        }
+        ble_store_save();
+    }
+}
+
+esp_err_t ble_store_init(uint32_t caps) {
+    size_t len = sizeof(ble_store_rec_t) * STORE_MAX;
+    recs = heap_caps_calloc(1, len, caps);
+    if(!recs) return ESP_ERR_NO_MEM;
+    store_stats.capacity = STORE_MAX;
+    BaseType_t res = xTaskCreate(ble_store_task, "ble_store", 3072, NULL, 1, &store_task);
+    assert(res == pdPASS);
+
+    nvs_handle_t nvs;
+    if(nvs_open(STORE_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) return ESP_OK; // Nothing saved yet
+    size_t saved = len;
+    esp_err_t err = nvs_get_blob(nvs, STORE_KEY, recs, &saved);
+    nvs_close(nvs);
+    if(err != ESP_OK || saved != len) {
+        // A different record count, start again
+        memset(recs, 0, len);
+        return ESP_OK;
+    }
+
+    for(int i=0; i<STORE_MAX; i++) {
+        if(recs[i].name_len && (recs[i].version != STORE_VERSION || recs[i].name_len > BLE_STORE_NAME_MAX)) {
+            recs[i].name_len = 0;
+        }
+        if(recs[i].name_len) {
+            uint32_t slot;
+            if(store_find(recs[i].bda, &slot)) {
+                recs[i].name_len = 0; // Saved twice
+                continue;
+            }
+            store_index[slot] = i + 1;
+            store_stats.records++;
+        }
+    }
+    ESP_LOGI(TAG, "Loaded %u names", store_stats.records);
+    return ESP_OK;
+}
+
+void ble_store_get_stats(ble_store_stats_t *stats) {
+    portENTER_CRITICAL(&store_lock);
+    *stats = store_stats;
+    portEXIT_CRITICAL(&store_lock);
+}
+
+static struct {
+    struct arg_lit *list;
+    struct arg_lit *save;
+    struct arg_end *end;
+} blestore_args;
+
+static int blestore(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &blestore_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, blestore_args.end, argv[0]);
+        return 1;
+    }
+    if(!recs) {
+        printf("BLE name store not loaded, is Bluetooth started?\n");
+        return 1;
+    }
+    if(blestore_args.save->count && ble_store_save() != ESP_OK) {
+        printf("Save failed\n");
+    }
+
+    ble_store_stats_t s;
+    ble_store_get_stats(&s);
+    printf("Names: %u of %u, %u unsaved changes, %u saves, %uh lifetime\n", s.records, s.capacity, s.dirty,
+           s.saves, CONFIG_APP_BLE_STORE_TTL_H);
+    printf("Connections avoided %u, expired %u, read by handle %u, stored %u\n", s.hits, s.expired, s.direct,
+           s.stored);
+
+    if(blestore_args.list->count) {
+        time_t now = time(NULL);
+        for(int i=0; i<STORE_MAX; i++) {
+            ble_store_rec_t rec;
+            portENTER_CRITICAL(&store_lock);
+            rec = recs[i];
+            portEXIT_CRITICAL(&store_lock);
+            if(!rec.name_len) continue;
+            printf("%02x:%02x:%02x:%02x:%02x:%02x %-*.*s handle 0x%04x %s\n", rec.bda[0], rec.bda[1], rec.bda[2],
+                   rec.bda[3], rec.bda[4], rec.bda[5], BLE_STORE_NAME_MAX, rec.name_len, rec.name,
+                   rec.handles.name_char, store_expired(&rec, now) ? "expired" : "");
+        }
+    }
+    return 0;
+}
+
+void register_cmd_blestore(void)
+{
+    blestore_args.list = arg_lit0("l", "list", "List the stored names");
+    blestore_args.save = arg_lit0("s", "save", "Write changes to NVS now");
+    blestore_args.end = arg_end(2);
+
+    const esp_console_cmd_t cmd = {
+        .command = "blestore",
+        .help = "Show BLE names kept across reboots and connections avoided",
+        .hint = NULL,
+        .func = &blestore,
+        .argtable = &blestore_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_console.h"
+#include "boot.h"
+
+static const char *TAG="boot";
+
+#define BOOT_TASK_PRIORITY 5
+
+typedef struct {
+    int64_t start;
+    int64_t end;
+    BaseType_t core; // Core the stage actually ran on
+} boot_time_t;
+
+static const boot_stage_t *boot_stages;
+static boot_time_t boot_times[BOOT_STAGE_COUNT];
+static EventGroupHandle_t boot_group;
+static EventBits_t boot_launched;
+static portMUX_TYPE boot_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t boot_begin;
+static int64_t boot_frame;
+
+static void boot_launch_ready(void);
+
+static void boot_task(void *arg) {
+    const boot_stage_t *stage = (const boot_stage_t *)arg;
+    int id = stage - boot_stages;
+
+    boot_times[id].core = xPortGetCoreID();
+    boot_times[id].start = esp_timer_get_time();
+    stage->run();
+    boot_times[id].end = esp_timer_get_time();
+
+    ESP_LOGI(TAG, "%s done in %lldms", stage->name, (boot_times[id].end - boot_times[id].start) / 1000);
+
+    xEventGroupSetBits(boot_group, BOOT_BIT(id));
+    boot_launch_ready();
+
+    vTaskDelete(NULL);
+}
+
+// Start every stage whose dependencies are now all done. Called by each
+// stage as it finishes, so only runnable stages hold a task and stack
+static void boot_launch_ready(void) {
+    EventBits_t done = xEventGroupGetBits(boot_group);
+
+    for(int id=0;id<BOOT_STAGE_COUNT;id++) {
+        const boot_stage_t *stage = &boot_stages[id];
+        bool ready = false;
+
+        portENTER_CRITICAL(&boot_lock);
+        if(!(boot_launched & BOOT_BIT(id)) && (stage->deps & done) == stage->deps) {
+            boot_launched |= BOOT_BIT(id);
+            ready = true;
+        }
+        portEXIT_CRITICAL(&boot_lock);
+
+        if(ready) {
+            BaseType_t res = xTaskCreatePinnedToCore(boot_task, stage->name, stage->stack, (void *)stage,
+                                                     BOOT_TASK_PRIORITY, NULL, stage->core);
+            assert(res == pdPASS);
+        }
+    }
+}
+
+void boot_start(const boot_stage_t *stages) {
+    boot_begin = esp_timer_get_time();
+    boot_stages = stages;
+    boot_group = xEventGroupCreate();
+    assert(boot_group);
+
+    // Stages which are configured out count as done
+    EventBits_t skipped = 0;
+    for(int id=0;id<BOOT_STAGE_COUNT;id++) {
+        assert(!(stages[id].deps & BOOT_BIT(id)));
+        if(!stages[id].run) skipped |= BOOT_BIT(id);
+    }
+    boot_launched = skipped;
+    xEventGroupSetBits(boot_group, skipped);
+
+    boot_launch_ready();
+}
+
+void boot_wait(EventBits_t stages) {
+    xEventGroupWaitBits(boot_group, stages, pdFALSE, pdTRUE, portMAX_DELAY);
+}
+
+void boot_first_frame(void) {
+    if(boot_frame) return;
+    boot_frame = esp_timer_get_time();
+    ESP_LOGI(TAG, "First interactive frame at %lldms", boot_frame / 1000);
+}
+
+// Print the boot timeline, times in ms since the app started
+static int boot_timeline(int argc, char **argv) {
+    EventBits_t done = xEventGroupGetBits(boot_group);
+    int64_t last = 0;
+
+    printf("%-14s %4s %8s %8s %8s\n", "Stage", "Core", "Start", "End", "Time");
+    for(int id=0;id<BOOT_STAGE_COUNT;id++) {
+        const boot_time_t *t = &boot_times[id];
+        if(!boot_stages[id].run) {
+            printf("%-14s %4s\n", boot_stages[id].name, "-");
+        } else if(!(done & BOOT_BIT(id))) {
+            printf("%-14s %4s\n", boot_stages[id].name, t->start ? "run" : "wait");
+        } else {
+            printf("%-14s %4d %8lld %8lld %8lld\n", boot_stages[id].name, t->core,
+                   t->start / 1000, t->end / 1000, (t->end - t->start) / 1000);
+            if(t->end > last) last = t->end;
+        }
+    }
+    printf("Boot started at %lldms, %s done at %lldms\n", boot_begin / 1000,
+           done == BOOT_BIT(BOOT_STAGE_COUNT) - 1 ? "all stages" : "last stage", last / 1000);
+    if(boot_frame) {
+        printf("First interactive frame at %lldms\n", boot_frame / 1000);
+    }
+    return 0;
+}
+
+void register_cmd_boot(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "boot",
+        .help = "Show the boot stage timeline",
+        .hint = NULL,
+        .func = &boot_timeline,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
@@ -1,4 +1,50 @@
 #include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_err.h"
 #include "idle.h"
+#include "app_event.h"
+
+static const char *TAG="idle";
 
 volatile int64_t last_action=0;
+
+// Number of times the idle timer has woken up
+volatile uint32_t idle_wakeups=0;
+
+static esp_timer_handle_t idle_timer = NULL;
+
+// The timer is armed for the earliest time the device could go idle. When it
+// fires it checks last_action and re-arms for the remainder if there was any
+// activity since, so ACTION() stays a plain store and there is one wakeup per
+// idle period rather than a periodic poll.
+static void idle_check(void *arg)
+{
+    idle_wakeups++;
+
+    int64_t now = esp_timer_get_time();
+    int64_t deadline = last_action + IDLE_TIME_uS;
+
+    if(now >= deadline) {
+        last_action=now; // Prevent repeat firing
+        ESP_LOGD(TAG, "Firing shutdown event");
+        // Trigger the deep sleep shutdown
+        ESP_ERROR_CHECK(app_event_post(APP_EVENT_SHUTDOWN, NULL, 0, (TickType_t)100));
+        deadline = now + IDLE_TIME_uS;
+    }
+
+    ESP_ERROR_CHECK(esp_timer_start_once(idle_timer, deadline - now));
+}
+
+void idle_init(void)
+{
+    if(last_action == 0) {
+        ACTION();
+    }
+
+    const esp_timer_create_args_t idle_timer_args = {
+        .callback = &idle_check,
+        .name = "idle"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&idle_timer_args, &idle_timer));
+    ESP_ERROR_CHECK(esp_timer_start_once(idle_timer, IDLE_TIME_uS));
+}
@@ -0,0 +1,1020 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_console.h"
+#include "rom/tjpgd.h"
+#include "rom/miniz.h"
+#include "lvgl.h"
+#include "sd_cache.h"
+#include "ui_sched.h"
+#include "img_stream.h"
+
+static const char *TAG="img_stream";
+
+#define IMG_JPEG_POOL 3100 // Work area needed by the ROM TJpgDec
+#define IMG_DECODE_STACK 4096
+#define IMG_DECODE_PRIORITY 2 // Below the UI task
+#define IMG_STRIPS 3 // One being drawn, one ready and one being decoded
+#define IMG_PNG_STRIP_ROWS 8
+#define IMG_PNG_IN 1024 // Compressed PNG data read at a time
+#define IMG_PNG_MAX_W 2048 // Wider PNGs need too much for the scanlines
+#define IMG_PATH_MAX 96
+#define IMG_PROBED 4 // Image headers remembered for LVGL
+
+typedef enum {
+    IMG_JPEG,
+    IMG_PNG,
+} img_type_t;
+
+typedef enum {
+    IMG_STRIP_FREE,
+    IMG_STRIP_FILLING, // Owned by the decode task
+    IMG_STRIP_READY, // Read by LVGL until released
+} img_strip_state_t;
+
+// A band of decoded lines at the size shown
+typedef struct img_strip {
+    lv_color_t *px;
+    lv_coord_t y0; // First shown line in the strip
+    lv_coord_t rows;
+    uint32_t gen; // Decode pass it belongs to
+    img_strip_state_t state;
+    bool shown; // Invalidated, so the next draw of its lines is the one that counts
+} img_strip_t;
+
+typedef struct img_jpeg {
+    JDEC jd;
+    void *pool;
+    uint16_t mcu_cols;
+    uint16_t mcu_x; // Blocks output so far in this MCU row
+} img_jpeg_t;
+
+// PNG is inflated by the ROM tinfl straight into its 32KB window, and
+// unfiltered a scanline at a time
+typedef struct img_png {
+    tinfl_decompressor *inflator;
+    uint8_t *dict; // TINFL_LZ_DICT_SIZE output window
+    size_t dict_ofs;
+    size_t pend_ofs; // Inflated bytes not yet copied into a scanline
+    size_t pend;
+    uint8_t *in;
+    size_t in_ofs;
+    size_t in_len;
+    long idat_pos; // File offset of the first IDAT data
+    uint32_t idat_len;
+    uint32_t idat_left; // Bytes left in the current IDAT chunk
+    bool in_eof; // No more IDAT chunks
+    bool done; // Inflate finished or failed
+    uint8_t *row; // Scanline being assembled, filter byte first
+    uint8_t *prev; // Previous unfiltered scanline
+    size_t row_len;
+    size_t row_fill;
+    uint8_t bpp; // Bytes per pixel
+    uint8_t color_type;
+    uint32_t src_y; // Scanlines completed
+    lv_color_t palette[256];
+} img_png_t;
+
+typedef struct img_stream {
+    img_type_t type;
+    sd_cache_file_t *f;
+    const char *name;
+    uint16_t src_w, src_h;
+    uint16_t w, h;
+    uint8_t shift; // JPEG scaled by 1/2^shift while decoding
+    uint8_t shrink; // Then every shrink'th pixel is kept
+    uint32_t gen; // Pass being decoded, see img_abort
+    lv_coord_t strip_rows;
+    img_strip_t *fill; // Strip being decoded into
+    size_t mem;
+    union {
+        img_jpeg_t jpeg;
+        img_png_t png;
+    };
+} img_stream_t;
+
+// Size an image is shown at, read from its header by img_stream_probe
+typedef struct img_probe {
+    char path[IMG_PATH_MAX];
+    lv_coord_t fit_w, fit_h; // Box it was fitted to
+    uint16_t w, h;
+} img_probe_t;
+
+// An image LVGL has open
+typedef struct img_view {
+    uint16_t w, h;
+} img_view_t;
+
+static lv_coord_t fit_w = 320;
+static lv_coord_t fit_h = 170;
+
+// Decoding runs on its own task so the UI task, which holds the GUI lock
+// while LVGL draws, never waits on the card or the decoder. The task fills
+// a ring of IMG_STRIPS strips and has the lines of each one redrawn as it
+// is ready. LVGL draws black for lines not decoded yet, and a strip is
+// released for the next lines once LVGL has drawn it. Lines drawn again
+// after their strip was released start the decode over.
+// These are shared with the decode task under img_lock
+static TaskHandle_t img_task;
+static char img_want[IMG_PATH_MAX]; // Image being decoded, empty if none
+static volatile uint32_t img_want_gen; // Bumped by each pass, stops the decode of an older one
+static img_view_t *img_view; // Where the strips are drawn, NULL if nothing is open
+static lv_coord_t img_pass_y; // Lines above were drawn and released in this pass
+static img_strip_t img_strips[IMG_STRIPS];
+static uint16_t img_strip_w;
+static img_probe_t img_probed[IMG_PROBED];
+static int img_probe_next;
+
+static lv_obj_t *img_target; // Only used on the UI task
+static img_stream_stats_t img_stats;
+static portMUX_TYPE img_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const uint8_t png_sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+static img_type_t img_type(const char *name, bool *ok) {
+    const char *ext = strrchr(name, '.');
+    *ok = true;
+    if(ext && (strcasecmp(ext, ".jpg") == 0 || strcasecmp(ext, ".jpeg") == 0)) return IMG_JPEG;
+    if(ext && strcasecmp(ext, ".png") == 0) return IMG_PNG;
+    *ok = false;
+    return IMG_JPEG;
+}
+
+bool img_stream_supported(const char *name) {
+    bool ok;
+    img_type(name, &ok);
+    return ok;
+}
+
+void img_stream_set_fit(lv_coord_t w, lv_coord_t h) {
+    if(w > 0 && h > 0) {
+        fit_w = w;
+        fit_h = h;
+    }
+}
+
+void img_stream_set_target(lv_obj_t *img) {
+    img_target = img;
+}
+
+void img_stream_get_stats(img_stream_stats_t *stats) {
+    portENTER_CRITICAL(&img_lock);
+    *stats = img_stats;
+    portEXIT_CRITICAL(&img_lock);
+}
+
+static void *img_alloc(img_stream_t *s, size_t size, uint32_t caps) {
+    void *p = heap_caps_malloc(size, caps);
+    if(p) s->mem += size;
+    return p;
+}
+
+// Large buffers go to PSRAM when there is some, the strips stay internal
+static void *img_alloc_big(img_stream_t *s, size_t size) {
+    void *p = heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, MALLOC_CAP_DEFAULT);
+    if(p) s->mem += size;
+    return p;
+}
+
+// Smallest whole number shrink which fits w x h in the fit box
+static uint8_t img_shrink(uint32_t w, uint32_t h) {
+    uint32_t sx = (w + fit_w - 1) / fit_w;
+    uint32_t sy = (h + fit_h - 1) / fit_h;
+    uint32_t s = sx > sy ? sx : sy;
+    if(s < 1) s = 1;
+    return s > 255 ? 255 : s;
+}
+
+static void img_count_error(void) {
+    portENTER_CRITICAL(&img_lock);
+    img_stats.errors++;
+    portEXIT_CRITICAL(&img_lock);
+}
+
+// A newer pass has replaced the one being decoded
+static inline bool img_abort(const img_stream_t *s) {
+    return s->gen != img_want_gen;
+}
+
+// Strips
+
+// Called at the start of each pass. The strips of the last one belong to an
+// older gen, so LVGL no longer reads them
+static void img_strips_free(void) {
+    lv_color_t *px[IMG_STRIPS];
+    portENTER_CRITICAL(&img_lock);
+    for(int i=0; i<IMG_STRIPS; i++) {
+        px[i] = img_strips[i].px;
+        img_strips[i].px = NULL;
+        img_strips[i].state = IMG_STRIP_FREE;
+    }
+    portEXIT_CRITICAL(&img_lock);
+    for(int i=0; i<IMG_STRIPS; i++) {
+        free(px[i]);
+    }
+}
+
+static esp_err_t img_strips_alloc(img_stream_t *s) {
+    lv_color_t *px[IMG_STRIPS];
+    size_t size = s->w * s->strip_rows * sizeof(lv_color_t);
+    for(int i=0; i<IMG_STRIPS; i++) {
+        px[i] = img_alloc(s, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if(!px[i]) {
+            while(i--) free(px[i]);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    portENTER_CRITICAL(&img_lock);
+    for(int i=0; i<IMG_STRIPS; i++) {
+        img_strips[i].px = px[i];
+        img_strips[i].gen = s->gen;
+        img_strips[i].state = IMG_STRIP_FREE;
+    }
+    img_strip_w = s->w;
+    portEXIT_CRITICAL(&img_lock);
+    return ESP_OK;
+}
+
+// Wait for LVGL to release a strip. NULL if the pass was replaced meanwhile
+static img_strip_t *img_strip_take(img_stream_t *s) {
+    for(;;) {
+        img_strip_t *strip = NULL;
+        portENTER_CRITICAL(&img_lock);
+        for(int i=0; i<IMG_STRIPS && !strip; i++) {
+            if(img_strips[i].state == IMG_STRIP_FREE) strip = &img_strips[i];
+        }
+        if(strip) {
+            strip->state = IMG_STRIP_FILLING;
+            strip->rows = 0;
+            strip->shown = false;
+        }
+        portEXIT_CRITICAL(&img_lock);
+        if(strip) return strip;
+        if(img_abort(s)) return NULL;
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+// Runs on the UI task when a strip is ready, to redraw its lines
+static void img_rows_ready(void *ctx, uintptr_t arg) {
+    img_strip_t *strip = &img_strips[arg & 0xFF];
+    lv_area_t area;
+    bool show = false;
+    portENTER_CRITICAL(&img_lock);
+    if(img_view && strip->state == IMG_STRIP_READY && strip->gen == img_want_gen
+            && (img_want_gen & 0xFFFFFF) == arg >> 8) {
+        strip->shown = true;
+        area.y1 = strip->y0;
+        area.y2 = strip->y0 + strip->rows - 1;
+        show = true;
+    }
+    portEXIT_CRITICAL(&img_lock);
+    if(!show) return;
+
+    if(!img_target) {
+        lv_obj_invalidate(lv_scr_act());
+        return;
+    }
+    lv_area_t coords;
+    lv_obj_get_coords(img_target, &coords);
+    area.x1 = coords.x1;
+    area.x2 = coords.x2;
+    area.y1 += coords.y1;
+    area.y2 += coords.y1;
+    lv_obj_invalidate_area(img_target, &area);
+}
+
+static void img_strip_ready(img_stream_t *s, img_strip_t *strip) {
+    uintptr_t arg = (uintptr_t)(s->gen & 0xFFFFFF) << 8 | (strip - img_strips);
+    portENTER_CRITICAL(&img_lock);
+    strip->state = IMG_STRIP_READY;
+    portEXIT_CRITICAL(&img_lock);
+    while(ui_post(img_rows_ready, NULL, arg) != ESP_OK) {
+        if(img_abort(s)) return;
+    }
+}
+
+// JPEG
+
+static uint32_t jpeg_in(JDEC *jd, uint8_t *buf, uint32_t len) {
+    img_stream_t *s = (img_stream_t *)jd->device;
+    if(!buf) {
+        return sd_cache_seek(s->f, len, SEEK_CUR) == 0 ? len : 0;
+    }
+    return sd_cache_read(s->f, buf, len);
+}
+
+// Called by TJpgDec with each decoded block, as RGB888. Each MCU row fills
+// a strip
+static uint32_t jpeg_out(JDEC *jd, void *bitmap, JRECT *rect) {
+    img_stream_t *s = (img_stream_t *)jd->device;
+    img_jpeg_t *j = &s->jpeg;
+
+    if(img_abort(s)) return 0;
+    if(!s->fill) {
+        s->fill = img_strip_take(s);
+        if(!s->fill) return 0;
+    }
+
+    img_strip_t *strip = s->fill;
+    if(strip->rows == 0) {
+        strip->y0 = (rect->top + s->shrink - 1) / s->shrink;
+    }
+
+    const uint8_t *rgb = (const uint8_t *)bitmap;
+    uint16_t bw = rect->right - rect->left + 1;
+    for(uint16_t y = rect->top; y <= rect->bottom; y++) {
+        if(y % s->shrink) continue;
+        lv_coord_t row = y / s->shrink - strip->y0;
+        if(row >= s->strip_rows || y / s->shrink >= s->h) break;
+        lv_color_t *dst = strip->px + row * s->w;
+        const uint8_t *src = rgb + (y - rect->top) * bw * 3;
+        for(uint16_t x = rect->left + (s->shrink - rect->left % s->shrink) % s->shrink; x <= rect->right; x += s->shrink) {
+            if(x / s->shrink >= s->w) break;
+            const uint8_t *p = src + (x - rect->left) * 3;
+            dst[x / s->shrink] = lv_color_make(p[0], p[1], p[2]);
+        }
+        if(row + 1 > strip->rows) strip->rows = row + 1;
+    }
+
+    // Blocks come left to right, so the last one finishes the MCU row
+    if(++j->mcu_x >= j->mcu_cols) {
+        j->mcu_x = 0;
+        if(strip->rows) {
+            img_strip_ready(s, strip);
+            s->fill = NULL;
+        }
+    }
+    return 1;
+}
+
+// Work out the shown size from the JPEG header
+static void jpeg_size(img_stream_t *s, const JDEC *jd) {
+    s->src_w = jd->width;
+    s->src_h = jd->height;
+
+    // TJpgDec scales by up to 1/8 for free, anything more is subsampled
+    s->shift = 0;
+    while(s->shift < 3 && ((s->src_w >> s->shift) > fit_w || (s->src_h >> s->shift) > fit_h)) {
+        s->shift++;
+    }
+    uint16_t dw = s->src_w >> s->shift;
+    uint16_t dh = s->src_h >> s->shift;
+    s->shrink = img_shrink(dw, dh);
+    s->w = (dw + s->shrink - 1) / s->shrink;
+    s->h = (dh + s->shrink - 1) / s->shrink;
+}
+
+static esp_err_t jpeg_probe(img_stream_t *s, void *pool) {
+    JDEC jd;
+    if(jd_prepare(&jd, jpeg_in, pool, IMG_JPEG_POOL, s) != JDR_OK) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    jpeg_size(s, &jd);
+    return ESP_OK;
+}
+
+// Read the header, leaving TJpgDec ready to decode
+static esp_err_t jpeg_open(img_stream_t *s) {
+    img_jpeg_t *j = &s->jpeg;
+    j->pool = img_alloc(s, IMG_JPEG_POOL, MALLOC_CAP_DEFAULT);
+    if(!j->pool) return ESP_ERR_NO_MEM;
+    if(jd_prepare(&j->jd, jpeg_in, j->pool, IMG_JPEG_POOL, s) != JDR_OK) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    jpeg_size(s, &j->jd);
+
+    // A strip holds the shown lines of one MCU row
+    uint16_t mcu_w = j->jd.msx * 8;
+    uint16_t mcu_h = (j->jd.msy * 8) >> s->shift;
+    if(mcu_h < 1) mcu_h = 1;
+    j->mcu_cols = (s->src_w + mcu_w - 1) / mcu_w;
+    s->strip_rows = (mcu_h + s->shrink - 1) / s->shrink;
+    return ESP_OK;
+}
+
+static esp_err_t jpeg_decode(img_stream_t *s) {
+    JRESULT res = jd_decomp(&s->jpeg.jd, jpeg_out, s->shift);
+    if(res == JDR_INTR) return ESP_ERR_INVALID_STATE;
+    if(res != JDR_OK) {
+        ESP_LOGW(TAG, "%s: decode failed %d", s->name, res);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void jpeg_close(img_stream_t *s) {
+    free(s->jpeg.pool);
+}
+
+// PNG
+
+static uint32_t png_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Read the header and palette, leaving the file at the first IDAT data
+static esp_err_t png_probe(img_stream_t *s) {
+    img_png_t *p = &s->png;
+    uint8_t hdr[8];
+
+    if(sd_cache_read(s->f, hdr, 8) != 8 || memcmp(hdr, png_sig, 8) != 0) return ESP_ERR_NOT_SUPPORTED;
+
+    bool have_ihdr = false;
+    for(;;) {
+        if(sd_cache_read(s->f, hdr, 8) != 8) return ESP_ERR_INVALID_SIZE;
+        uint32_t len = png_be32(hdr);
+        if(memcmp(hdr + 4, "IHDR", 4) == 0) {
+            uint8_t ihdr[13];
+            if(len != 13 || sd_cache_read(s->f, ihdr, 13) != 13) return ESP_ERR_INVALID_SIZE;
+            uint32_t w = png_be32(ihdr);
+            uint32_t h = png_be32(ihdr + 4);
+            uint8_t depth = ihdr[8];
+            p->color_type = ihdr[9];
+            static const uint8_t channels[7] = { 1, 0, 3, 1, 2, 0, 4 };
+            if(depth != 8 || p->color_type > 6 || channels[p->color_type] == 0 || ihdr[12] != 0
+                    || w == 0 || h == 0 || w > IMG_PNG_MAX_W || h > UINT16_MAX) {
+                ESP_LOGW(TAG, "%s: only 8 bit, non-interlaced PNGs up to %d wide are supported", s->name,
+                         IMG_PNG_MAX_W);
+                return ESP_ERR_NOT_SUPPORTED;
+            }
+            s->src_w = w;
+            s->src_h = h;
+            p->bpp = channels[p->color_type];
+            have_ihdr = true;
+            sd_cache_seek(s->f, 4, SEEK_CUR);
+        } else if(memcmp(hdr + 4, "PLTE", 4) == 0) {
+            uint8_t rgb[3];
+            for(uint32_t i=0; i < len / 3 && i < 256; i++) {
+                if(sd_cache_read(s->f, rgb, 3) != 3) return ESP_ERR_INVALID_SIZE;
+                p->palette[i] = lv_color_make(rgb[0], rgb[1], rgb[2]);
+            }
+            sd_cache_seek(s->f, 4 + len - (len / 3 < 256 ? len / 3 : 256) * 3, SEEK_CUR);
+        } else if(memcmp(hdr + 4, "IDAT", 4) == 0) {
+            if(!have_ihdr) return ESP_ERR_INVALID_STATE;
+            p->idat_pos = sd_cache_tell(s->f);
+            p->idat_len = len;
+            break;
+        } else if(memcmp(hdr + 4, "IEND", 4) == 0) {
+            return ESP_ERR_INVALID_SIZE;
+        } else {
+            sd_cache_seek(s->f, len + 4, SEEK_CUR);
+        }
+    }
+
+    s->shift = 0;
+    s->shrink = img_shrink(s->src_w, s->src_h);
+    s->w = (s->src_w + s->shrink - 1) / s->shrink;
+    s->h = (s->src_h + s->shrink - 1) / s->shrink;
+    return ESP_OK;
+}
+
+// Fill the input buffer from the IDAT chunks, skipping the chunk boundaries
+static void png_fill(img_stream_t *s) {
+    img_png_t *p = &s->png;
+    p->in_ofs = 0;
+    p->in_len = 0;
+    while(p->in_len < IMG_PNG_IN && !p->in_eof) {
+        if(p->idat_left == 0) {
+            uint8_t hdr[12]; // CRC of this chunk, then the next header
+            if(sd_cache_read(s->f, hdr, 12) != 12 || memcmp(hdr + 8, "IDAT", 4) != 0) {
+                p->in_eof = true;
+                break;
+            }
+            p->idat_left = png_be32(hdr + 4);
+            continue;
+        }
+        size_t want = IMG_PNG_IN - p->in_len;
+        if(want > p->idat_left) want = p->idat_left;
+        size_t got = sd_cache_read(s->f, p->in + p->in_len, want);
+        if(got == 0) {
+            p->in_eof = true;
+            break;
+        }
+        p->in_len += got;
+        p->idat_left -= got;
+    }
+}
+
+static void png_rewind(img_stream_t *s) {
+    img_png_t *p = &s->png;
+    tinfl_init(p->inflator);
+    sd_cache_seek(s->f, p->idat_pos, SEEK_SET);
+    p->idat_left = p->idat_len;
+    p->in_eof = false;
+    p->in_ofs = 0;
+    p->in_len = 0;
+    p->done = false;
+    p->dict_ofs = 0;
+    p->pend = 0;
+    p->row_fill = 0;
+    p->src_y = 0;
+    memset(p->prev, 0, p->row_len);
+}
+
+static inline uint8_t png_paeth(uint8_t a, uint8_t b, uint8_t c) {
+    int pa = abs(b - c);
+    int pb = abs(a - c);
+    int pc = abs(a + b - 2 * c);
+    if(pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+// Undo the filter on the scanline in p->row, in place, and keep it in p->prev
+// for the next scanline
+static bool png_unfilter(img_png_t *p) {
+    uint8_t *px = p->row + 1;
+    const uint8_t *up = p->prev;
+    size_t n = p->row_len - 1;
+    uint8_t bpp = p->bpp;
+
+    switch(p->row[0]) {
+    case 0:
+        break;
+    case 1:
+        for(size_t i=bpp; i<n; i++) px[i] += px[i - bpp];
+        break;
+    case 2:
+        for(size_t i=0; i<n; i++) px[i] += up[i];
+        break;
+    case 3:
+        for(size_t i=0; i<n; i++) px[i] += ((i >= bpp ? px[i - bpp] : 0) + up[i]) >> 1;
+        break;
+    case 4:
+        for(size_t i=0; i<n; i++) {
+            px[i] += png_paeth(i >= bpp ? px[i - bpp] : 0, up[i], i >= bpp ? up[i - bpp] : 0);
+        }
+        break;
+    default:
+        return false;
+    }
+    memcpy(p->prev, px, n);
+    return true;
+}
+
+// Convert the unfiltered scanline in p->prev to a shown line
+static void png_convert(img_stream_t *s, lv_color_t *line) {
+    img_png_t *p = &s->png;
+    const uint8_t *px = p->prev;
+    for(lv_coord_t x=0; x<s->w; x++) {
+        const uint8_t *c = px + x * s->shrink * p->bpp;
+        uint8_t r, g, b, a = 0xFF;
+        switch(p->color_type) {
+        case 0:
+            r = g = b = c[0];
+            break;
+        case 2:
+            r = c[0]; g = c[1]; b = c[2];
+            break;
+        case 3:
+            line[x] = p->palette[c[0]];
+            continue;
+        case 4:
+            r = g = b = c[0];
+            a = c[1];
+            break;
+        default:
+            r = c[0]; g = c[1]; b = c[2];
+            a = c[3];
+            break;
+        }
+        if(a != 0xFF) {
+            // Blend onto the black background
+            r = r * a / 255;
+            g = g * a / 255;
+            b = b * a / 255;
+        }
+        line[x] = lv_color_make(r, g, b);
+    }
+}
+
+// Inflate until the next scanline is complete
+static bool png_next_row(img_stream_t *s) {
+    img_png_t *p = &s->png;
+
+    for(;;) {
+        while(p->pend) {
+            size_t n = p->row_len - p->row_fill;
+            if(n > p->pend) n = p->pend;
+            memcpy(p->row + p->row_fill, p->dict + p->pend_ofs, n);
+            p->row_fill += n;
+            p->pend_ofs += n;
+            p->pend -= n;
+            if(p->row_fill == p->row_len) {
+                p->row_fill = 0;
+                if(!png_unfilter(p)) {
+                    ESP_LOGW(TAG, "%s: bad filter %d on line %u", s->name, p->row[0], p->src_y);
+                    p->done = true;
+                    return false;
+                }
+                p->src_y++;
+                return true;
+            }
+        }
+        if(p->done) return false;
+
+        if(p->in_ofs == p->in_len && !p->in_eof) {
+            png_fill(s);
+        }
+        size_t in_bytes = p->in_len - p->in_ofs;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - p->dict_ofs;
+        uint32_t flags = TINFL_FLAG_PARSE_ZLIB_HEADER | (p->in_eof ? 0 : TINFL_FLAG_HAS_MORE_INPUT);
+        tinfl_status status = tinfl_decompress(p->inflator, p->in + p->in_ofs, &in_bytes, p->dict,
+                                               p->dict + p->dict_ofs, &out_bytes, flags);
+        p->in_ofs += in_bytes;
+        p->pend_ofs = p->dict_ofs;
+        p->pend = out_bytes;
+        p->dict_ofs = (p->dict_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        if(status == TINFL_STATUS_DONE || status < 0) {
+            if(status < 0) ESP_LOGW(TAG, "%s: inflate failed %d", s->name, status);
+            p->done = true;
+        } else if(status == TINFL_STATUS_NEEDS_MORE_INPUT && p->in_eof) {
+            p->done = true;
+        }
+    }
+}
+
+// Decode the shown lines a strip at a time
+static esp_err_t png_decode(img_stream_t *s) {
+    img_png_t *p = &s->png;
+    for(lv_coord_t y=0; y<s->h; y++) {
+        uint32_t src_y = (uint32_t)y * s->shrink;
+        while(p->src_y <= src_y) {
+            if(img_abort(s)) return ESP_ERR_INVALID_STATE;
+            if(!png_next_row(s)) return ESP_FAIL; // Truncated, the rest stays black
+        }
+        if(!s->fill) {
+            s->fill = img_strip_take(s);
+            if(!s->fill) return ESP_ERR_INVALID_STATE;
+            s->fill->y0 = y;
+        }
+        img_strip_t *strip = s->fill;
+        png_convert(s, strip->px + strip->rows * s->w);
+        if(++strip->rows == s->strip_rows || y == s->h - 1) {
+            img_strip_ready(s, strip);
+            s->fill = NULL;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t png_open(img_stream_t *s) {
+    img_png_t *p = &s->png;
+    esp_err_t err = png_probe(s);
+    if(err != ESP_OK) return err;
+
+    p->row_len = 1 + (size_t)s->src_w * p->bpp;
+    p->inflator = img_alloc_big(s, sizeof(tinfl_decompressor));
+    p->dict = img_alloc_big(s, TINFL_LZ_DICT_SIZE);
+    p->in = img_alloc(s, IMG_PNG_IN, MALLOC_CAP_DEFAULT);
+    p->row = img_alloc_big(s, p->row_len);
+    p->prev = img_alloc_big(s, p->row_len);
+    if(!p->inflator || !p->dict || !p->in || !p->row || !p->prev) return ESP_ERR_NO_MEM;
+
+    s->strip_rows = IMG_PNG_STRIP_ROWS;
+    png_rewind(s);
+    return ESP_OK;
+}
+
+static void png_close(img_stream_t *s) {
+    img_png_t *p = &s->png;
+    free(p->inflator);
+    free(p->dict);
+    free(p->in);
+    free(p->row);
+    free(p->prev);
+}
+
+// Common
+
+static void img_close(img_stream_t *s) {
+    if(s->type == IMG_JPEG) {
+        jpeg_close(s);
+    } else {
+        png_close(s);
+    }
+    if(s->f) sd_cache_close(s->f);
+    free(s);
+}
+
+static img_stream_t *img_open(const char *path, esp_err_t *err) {
+    bool ok;
+    img_type_t type = img_type(path, &ok);
+    if(!ok) {
+        *err = ESP_ERR_NOT_SUPPORTED;
+        return NULL;
+    }
+
+    img_stream_t *s = calloc(1, sizeof(img_stream_t));
+    if(!s) {
+        *err = ESP_ERR_NO_MEM;
+        return NULL;
+    }
+    s->type = type;
+    s->mem = sizeof(img_stream_t);
+    const char *slash = strrchr(path, '/');
+    s->name = slash ? slash + 1 : path;
+    s->f = sd_cache_open(path);
+    if(!s->f) {
+        *err = ESP_ERR_NOT_FOUND;
+    } else {
+        *err = type == IMG_JPEG ? jpeg_open(s) : png_open(s);
+    }
+    if(*err != ESP_OK) {
+        img_close(s);
+        return NULL;
+    }
+    return s;
+}
+
+// Must hold img_lock
+static img_probe_t *img_probe_find(const char *path) {
+    for(int i=0; i<IMG_PROBED; i++) {
+        img_probe_t *probe = &img_probed[i];
+        if(probe->fit_w == fit_w && probe->fit_h == fit_h && strcmp(probe->path, path) == 0) return probe;
+    }
+    return NULL;
+}
+
+esp_err_t img_stream_probe(const char *path) {
+    bool ok;
+    img_type_t type = img_type(path, &ok);
+    if(!ok || strlen(path) >= IMG_PATH_MAX) return ESP_ERR_NOT_SUPPORTED;
+
+    img_stream_t *s = calloc(1, sizeof(img_stream_t));
+    if(!s) return ESP_ERR_NO_MEM;
+    esp_err_t err;
+    s->type = type;
+    s->name = path;
+    s->f = sd_cache_open(path);
+    if(!s->f) {
+        err = ESP_ERR_NOT_FOUND;
+    } else if(type == IMG_JPEG) {
+        void *pool = malloc(IMG_JPEG_POOL);
+        err = pool ? jpeg_probe(s, pool) : ESP_ERR_NO_MEM;
+        free(pool);
+    } else {
+        err = png_probe(s);
+    }
+    if(s->f) sd_cache_close(s->f);
+
+    if(err == ESP_OK) {
+        portENTER_CRITICAL(&img_lock);
+        img_probe_t *probe = img_probe_find(path);
+        if(!probe) {
+            probe = &img_probed[img_probe_next];
+            img_probe_next = (img_probe_next + 1) % IMG_PROBED;
+            strlcpy(probe->path, path, sizeof(probe->path));
+            probe->fit_w = fit_w;
+            probe->fit_h = fit_h;
+        }
+        probe->w = s->w;
+        probe->h = s->h;
+        portEXIT_CRITICAL(&img_lock);
+    }
+    free(s);
+    return err;
+}
+
+// One pass over the image, handing each strip to LVGL as it is decoded
+static void img_decode(const char *path, uint32_t gen) {
+    int64_t started = esp_timer_get_time();
+    esp_err_t err;
+    img_stream_t *s = img_open(path, &err);
+    if(!s) {
+        ESP_LOGW(TAG, "%s: %s", path, esp_err_to_name(err));
+        img_count_error();
+        return;
+    }
+
+    s->gen = gen;
+    err = img_strips_alloc(s);
+    if(err == ESP_OK) {
+        err = s->type == IMG_JPEG ? jpeg_decode(s) : png_decode(s);
+    } else {
+        ESP_LOGW(TAG, "%s: no memory for %u line strips", s->name, s->strip_rows);
+    }
+    if(err == ESP_ERR_INVALID_STATE) {
+        // Replaced by a newer pass is not an error
+        img_close(s);
+        return;
+    }
+    if(err != ESP_OK) {
+        // Show what was decoded of a damaged image
+        if(s->fill && s->fill->rows) img_strip_ready(s, s->fill);
+        img_count_error();
+        img_close(s);
+        return;
+    }
+
+    uint32_t ms = (esp_timer_get_time() - started) / 1000;
+    portENTER_CRITICAL(&img_lock);
+    strlcpy(img_stats.name, s->name, sizeof(img_stats.name));
+    img_stats.src_w = s->src_w;
+    img_stats.src_h = s->src_h;
+    img_stats.w = s->w;
+    img_stats.h = s->h;
+    img_stats.shrink = s->shrink << s->shift;
+    img_stats.decode_ms = ms;
+    img_stats.peak = s->mem;
+    img_stats.decodes++;
+    portEXIT_CRITICAL(&img_lock);
+
+    ESP_LOGI(TAG, "%s %ux%u shown %ux%u (1/%u) in %ums using %uKB", s->name, s->src_w, s->src_h, s->w, s->h,
+             s->shrink << s->shift, ms, (s->mem + 1023) / 1024);
+    img_close(s);
+}
+
+static void img_decode_task(void *arg) {
+    char path[IMG_PATH_MAX];
+    uint32_t done = 0;
+    for(;;) {
+        portENTER_CRITICAL(&img_lock);
+        uint32_t gen = img_want_gen;
+        strlcpy(path, img_want, sizeof(path));
+        portEXIT_CRITICAL(&img_lock);
+        if(gen == done) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        // Nothing is kept once the image is closed
+        img_strips_free();
+        done = gen;
+        if(path[0]) img_decode(path, gen);
+    }
+}
+
+// LVGL decoder
+
+// Answered from the headers read by img_stream_probe, as this runs on the UI
+// task
+static lv_res_t img_info_cb(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE || !img_stream_supported((const char *)src)) {
+        return LV_RES_INV;
+    }
+
+    bool found = false;
+    portENTER_CRITICAL(&img_lock);
+    img_probe_t *probe = img_probe_find((const char *)src);
+    if(probe) {
+        header->w = probe->w;
+        header->h = probe->h;
+        found = true;
+    }
+    portEXIT_CRITICAL(&img_lock);
+    if(!found) {
+        ESP_LOGW(TAG, "%s: not probed", (const char *)src);
+        return LV_RES_INV;
+    }
+
+    header->always_zero = 0;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+// Start a decode pass, LVGL draws black until the strips come in
+static lv_res_t img_open_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    const char *path = (const char *)dsc->src;
+    if(dsc->src_type != LV_IMG_SRC_FILE || !img_stream_supported(path) || strlen(path) >= IMG_PATH_MAX) {
+        return LV_RES_INV;
+    }
+
+    img_view_t *view = malloc(sizeof(img_view_t));
+    if(!view) return LV_RES_INV;
+    portENTER_CRITICAL(&img_lock);
+    img_probe_t *probe = img_probe_find(path);
+    if(probe) {
+        view->w = probe->w;
+        view->h = probe->h;
+        img_view = view;
+        strlcpy(img_want, path, sizeof(img_want));
+        img_want_gen++;
+        img_pass_y = 0;
+    }
+    portEXIT_CRITICAL(&img_lock);
+    if(!probe) {
+        free(view);
+        return LV_RES_INV;
+    }
+
+    xTaskNotifyGive(img_task);
+    dsc->img_data = NULL;
+    dsc->user_data = view;
+    return LV_RES_OK;
+}
+
+// Copy the line from its strip, or black if it is not decoded yet
+static lv_res_t img_read_line_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc, lv_coord_t x,
+                                 lv_coord_t y, lv_coord_t len, uint8_t *buf) {
+    img_view_t *view = (img_view_t *)dsc->user_data;
+    lv_color_t *out = (lv_color_t *)buf;
+    lv_coord_t copied = 0;
+    bool found = false;
+    bool notify = false;
+
+    portENTER_CRITICAL(&img_lock);
+    for(int i=0; i<IMG_STRIPS && view == img_view; i++) {
+        img_strip_t *strip = &img_strips[i];
+        if(strip->state != IMG_STRIP_READY || strip->gen != img_want_gen) continue;
+        lv_coord_t end = strip->y0 + strip->rows;
+        if(y < strip->y0 || y >= end) continue;
+
+        found = true;
+        if(x < img_strip_w) {
+            copied = LV_MIN(len, img_strip_w - x);
+            memcpy(out, strip->px + (y - strip->y0) * img_strip_w + x, copied * sizeof(lv_color_t));
+        }
+        if(!strip->shown) break;
+
+        // Strips are shown top down, so drawing this one means the ones above
+        // have been drawn too
+        for(int j=0; j<IMG_STRIPS; j++) {
+            img_strip_t *done = &img_strips[j];
+            lv_coord_t done_end = done->y0 + done->rows;
+            if(done->state == IMG_STRIP_READY && done->gen == img_want_gen && done->shown
+                    && (done == strip ? y == end - 1 : done_end <= y)) {
+                done->state = IMG_STRIP_FREE;
+                if(done_end > img_pass_y) img_pass_y = done_end;
+                notify = true;
+            }
+        }
+        break;
+    }
+    if(!found && view == img_view && y < img_pass_y) {
+        // Drawn again after its strip was released, decode it again
+        img_want_gen++;
+        img_pass_y = 0;
+        img_stats.restarts++;
+        notify = true;
+    }
+    portEXIT_CRITICAL(&img_lock);
+
+    if(notify) xTaskNotifyGive(img_task);
+    if(copied < len) lv_color_fill(out + copied, lv_color_black(), len - copied);
+    return LV_RES_OK;
+}
+
+// Stop decoding, the decode task frees the strips
+static void img_close_cb(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    img_view_t *view = (img_view_t *)dsc->user_data;
+    if(!view) return;
+    bool stop;
+    portENTER_CRITICAL(&img_lock);
+    stop = view == img_view;
+    if(stop) {
+        img_view = NULL;
+        img_want[0] = 0;
+        img_want_gen++;
+    }
+    portEXIT_CRITICAL(&img_lock);
+    if(stop) xTaskNotifyGive(img_task);
+    free(view);
+    dsc->user_data = NULL;
+}
+
+void img_stream_init(void) {
+    BaseType_t res = xTaskCreate(img_decode_task, "img_decode", IMG_DECODE_STACK, NULL, IMG_DECODE_PRIORITY,
+                                 &img_task);
+    assert(res == pdPASS);
+
+    lv_img_decoder_t *dec = lv_img_decoder_create();
+    assert(dec);
+    lv_img_decoder_set_info_cb(dec, img_info_cb);
+    lv_img_decoder_set_open_cb(dec, img_open_cb);
+    lv_img_decoder_set_read_line_cb(dec, img_read_line_cb);
+    lv_img_decoder_set_close_cb(dec, img_close_cb);
+}
+
+// Show the last decode and the totals
+static int img(int argc, char **argv) {
+    img_stream_stats_t stats;
+    img_stream_get_stats(&stats);
+
+    printf("Decodes: %u complete, %u restarted, %u errors. Fit %dx%d\n", stats.decodes, stats.restarts,
+           stats.errors, fit_w, fit_h);
+    if(stats.decodes) {
+        printf("Last: %s %ux%u shown %ux%u (1/%u) in %ums, %u bytes at peak\n", stats.name, stats.src_w,
+               stats.src_h, stats.w, stats.h, stats.shrink, stats.decode_ms, stats.peak);
+    }
+    return 0;
+}
+
+void register_cmd_img(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "img",
+        .help = "Show streaming image decoder timing and memory",
+        .hint = NULL,
+        .func = &img,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+// Playback of RGB565 animations from the SD card straight to the panel,
+// bypassing LVGL. One task reads frames ahead into a ring of DMA capable
+// stripe buffers and another sends them to the panel, paced to the frame rate.
+//
+// File layout, little endian: an anim_header_t, then for each frame a u32
+// byte count followed by the frame. Raw frames are w * h pixels, RLE frames
+// are rle565 packets. Pixels are in panel byte order, most significant first.
+// Frames are centred on the screen. frames_to_a565.py makes these files.
+
+#define ANIM_MAGIC "A565"
+#define ANIM_VERSION 1
+#define ANIM_FLAG_RLE 0x01
+
+typedef struct __attribute__((packed)) anim_header {
+    char magic[4];
+    uint8_t version;
+    uint8_t flags;
+    uint16_t w;
+    uint16_t h;
+    uint16_t fps;
+    uint32_t frames;
+} anim_header_t;
+
+typedef struct anim_opts {
+    uint16_t fps; // 0 for the rate in the file
+    uint32_t loops; // 0 to loop until stopped
+} anim_opts_t;
+
+typedef struct anim_stats {
+    char name[32];
+    bool playing;
+    uint16_t w, h;
+    uint16_t fps; // Target rate
+    uint32_t shown; // Frames sent to the panel
+    uint32_t dropped; // Frames skipped because they were already late
+    uint32_t starved; // Times the panel side waited for the SD card
+    uint32_t late_max_us; // Latest a frame was shown after it was due
+    uint64_t sd_bytes; // Read from the card
+    uint64_t lcd_bytes; // Sent to the panel
+    uint64_t read_us; // Spent reading the card
+    uint32_t elapsed_ms;
+} anim_stats_t;
+
+// Start playing in the background. Fails if something is already playing
+extern esp_err_t anim_play(const char *path, const anim_opts_t *opts);
+
+// Stop playback, returns straight away and the panel is given back shortly
+extern void anim_stop(void);
+
+// Stats of the animation playing, or the last one played
+extern void anim_get_stats(anim_stats_t *stats);
+
+extern void register_cmd_play(void);
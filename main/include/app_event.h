@@ -15,3 +15,7 @@ typedef enum {
 } app_event_t;
 
 extern esp_event_loop_handle_t app_event_loop;
+
+// Post to app_event_loop and wake the UI loop to dispatch it.
+// Use this rather than esp_event_post_to for app events
+extern esp_err_t app_event_post(int32_t event_id, const void *event_data, size_t event_data_size, TickType_t ticks_to_wait);
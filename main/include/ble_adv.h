@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// Single pass parser for BLE advertising data. The advertising data and the
+// scan response, as laid out in scan_rst.ble_adv, are walked once and the
+// fields of interest recorded as offsets into that buffer. Nothing is copied
+// or allocated, so the record is only valid while the buffer is.
+
+#define BLE_ADV_DATA_MAX 62 // Advertising data and scan response
+
+// AD types
+#define BLE_AD_FLAGS           0x01
+#define BLE_AD_UUID16_SOME     0x02
+#define BLE_AD_UUID16_ALL      0x03
+#define BLE_AD_UUID32_SOME     0x04
+#define BLE_AD_UUID32_ALL      0x05
+#define BLE_AD_UUID128_SOME    0x06
+#define BLE_AD_UUID128_ALL     0x07
+#define BLE_AD_NAME_SHORT      0x08
+#define BLE_AD_NAME_COMPLETE   0x09
+#define BLE_AD_TX_POWER        0x0A
+#define BLE_AD_SERVICE_DATA16  0x16
+#define BLE_AD_APPEARANCE      0x19
+#define BLE_AD_MANUFACTURER    0xFF
+
+#define BLE_ADV_NO_COMPANY 0xFFFF // Reserved by the Bluetooth SIG, never assigned
+#define BLE_ADV_NO_TX_POWER INT8_MIN
+
+// Where a field is in the buffer, len is 0 if it was not present
+typedef struct ble_adv_field {
+    uint8_t ofs;
+    uint8_t len;
+} ble_adv_field_t;
+
+typedef struct ble_adv {
+    const uint8_t *data;
+    ble_adv_field_t name; // The complete name, or else the shortened one
+    ble_adv_field_t manufacturer; // Company ID first, little endian
+    ble_adv_field_t uuid16; // Lists of service UUIDs
+    ble_adv_field_t uuid32;
+    ble_adv_field_t uuid128;
+    ble_adv_field_t service_data16; // UUID first
+    bool name_complete;
+    uint8_t flags;
+    int8_t tx_power; // BLE_ADV_NO_TX_POWER if absent
+    uint16_t appearance; // 0 is unknown
+} ble_adv_t;
+
+extern void ble_adv_parse(ble_adv_t *adv, const uint8_t *data, uint8_t adv_len, uint8_t rsp_len);
+
+static inline const uint8_t *ble_adv_ptr(const ble_adv_t *adv, ble_adv_field_t field) {
+    return adv->data + field.ofs;
+}
+
+static inline uint16_t ble_adv_company(const ble_adv_t *adv) {
+    if(adv->manufacturer.len < 2) return BLE_ADV_NO_COMPANY;
+    const uint8_t *p = ble_adv_ptr(adv, adv->manufacturer);
+    return p[0] | (p[1] << 8);
+}
+
+static inline bool ble_adv_has_uuid16(const ble_adv_t *adv, uint16_t uuid) {
+    const uint8_t *p = ble_adv_ptr(adv, adv->uuid16);
+    for(int i=0; i + 1 < adv->uuid16.len; i+=2) {
+        if((p[i] | (p[i + 1] << 8)) == uuid) return true;
+    }
+    return false;
+}
+
+// uuid is little endian, as sent over the air
+static inline bool ble_adv_has_uuid128(const ble_adv_t *adv, const uint8_t *uuid) {
+    const uint8_t *p = ble_adv_ptr(adv, adv->uuid128);
+    for(int i=0; i + 15 < adv->uuid128.len; i+=16) {
+        if(memcmp(p + i, uuid, 16) == 0) return true;
+    }
+    return false;
+}
+
+extern void register_cmd_advbench(void);
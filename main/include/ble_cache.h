@@ -27,29 +27,82 @@
 #include "esp_bt.h"
 #include "esp_bt_main.h"
 #include "esp_gap_ble_api.h"
+#include "ble_adv.h"
 
-#define BLE_CACHE_MAX 100 // Only scan 100 BT devices
+// When full the least recently seen device which isn't being connected to
+// makes way for a new one
+#define BLE_CACHE_MAX CONFIG_APP_BLE_CACHE_SIZE
+
+// RSSI readings kept for each device, see ble_cache_rssi_history
+#define BLE_RSSI_HISTORY CONFIG_APP_BLE_RSSI_HISTORY
+
+// Most devices the nearest query returns
+#define BLE_NEAR_MAX 32
+#define BLE_NEAR_NAME_MAX 32 // Longer names are cut short
 
 struct ble_cache_entry {
     esp_bd_addr_t bda;
-    char *name;
+    const char *name; // Interned, see ble_names.h
     esp_ble_addr_type_t bda_type;
-    int visible:1; // Did we see this device in the latest scan?
+    uint16_t generation; // Scan this device was last seen in
+    int16_t newer, older; // Least recently seen list
+    uint32_t last_seen; // ms since boot
+    uint16_t company; // From the manufacturer data, BLE_ADV_NO_COMPANY if none
+    uint16_t appearance;
+    int8_t tx_power; // BLE_ADV_NO_TX_POWER if not advertised
+    int8_t rssi; // Last reading
+    int32_t rssi_smooth; // Smoothed RSSI in 1/256 dBm
+    uint8_t rssi_next; // Where the next reading goes in the history ring
+    uint8_t rssi_count; // Readings in the ring
     int connecting:1; // Are we currently attempting to connect to this device?
     int connected:1; // Is this device currently connected?
     int failed:1; // Did connection to this device fail?
     int name_failed:1; // Did name lookup fail?
 };
 
-extern struct ble_cache_entry ble_cache[BLE_CACHE_MAX];
+// A device returned by ble_cache_nearest, copied out so it stays valid when
+// the cache changes afterwards
+typedef struct ble_cache_near {
+    esp_bd_addr_t bda;
+    char name[BLE_NEAR_NAME_MAX]; // Empty if not known
+    int8_t rssi; // Smoothed dBm
+    int8_t tx_power;
+    uint8_t readings; // In history
+    int8_t history[BLE_RSSI_HISTORY]; // Oldest first
+} ble_cache_near_t;
+
+typedef struct ble_cache_stats {
+    uint32_t hits; // Reports from devices already cached
+    uint32_t misses; // Reports from new devices
+    uint32_t evictions; // Devices replaced to make room
+    uint32_t dropped; // New devices ignored as every entry was in use
+    uint32_t purged; // Devices removed at the end of a scan
+    int size;
+    int capacity;
+    int visible; // Seen in the current scan
+    uint32_t oldest_ms; // Since the least recently seen device was seen
+} ble_cache_stats_t;
+
+extern struct ble_cache_entry *ble_cache;
 extern int connecting;
 extern int device_list_idx;
+extern esp_err_t ble_cache_init();
 extern void ble_cache_start_scan();
-extern void ble_cache_add(const esp_ble_gap_cb_param_t *scan_result, const uint8_t *adv_name, uint8_t adv_name_len);
+extern bool ble_cache_visible(int idx); // Seen in the current scan
+extern void ble_cache_add(const esp_ble_gap_cb_param_t *scan_result, const ble_adv_t *adv);
 extern int ble_cache_get_size();
 extern void ble_cache_purge();
 extern void ble_cache_dump();
-extern void ble_cache_connect();
-extern void ble_cache_connect_from_unconnected();
-extern void ble_cache_connect_failed();
+extern bool ble_cache_next_unnamed(esp_bd_addr_t bda, esp_ble_addr_type_t *bda_type);
+extern void ble_cache_name_failed(const esp_bd_addr_t bda); // The lookup ended without a name
 extern void ble_cache_update_name(esp_bd_addr_t remote_bda, uint8_t* name, uint8_t name_len);
+extern void ble_cache_get_stats(ble_cache_stats_t *stats);
+// Up to n devices seen in the current scan, strongest first by smoothed RSSI,
+// or by path loss from the advertised TX power if by_path_loss, which leaves
+// out devices not advertising it. Returns the count
+extern int ble_cache_nearest(ble_cache_near_t *near, int n, bool by_path_loss);
+// Copy the RSSI readings of an entry, oldest first. Returns the count
+extern int ble_cache_rssi_history(int idx, int8_t *rssi, int max);
+extern void register_cmd_blebench(void);
+extern void register_cmd_blecache(void);
+extern void register_cmd_blenear(void);
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_gap_ble_api.h"
+#include "ble_adv.h"
+
+// Allow and deny rules applied to each advertising report in the GAP
+// callback, before the report is cached or logged. Rules are checked in
+// order and the first match decides; reports matching no rule get the
+// default action. Rules are compiled into a fixed table when added, and
+// the advertising data is only parsed if some rule needs it, before the
+// table is locked.
+
+typedef enum {
+    BLE_FILTER_BDA, // Address prefix, such as a vendor OUI
+    BLE_FILTER_ADDR_TYPE,
+    BLE_FILTER_COMPANY, // Manufacturer data company ID
+    BLE_FILTER_UUID16, // Advertised service
+    BLE_FILTER_UUID128,
+    BLE_FILTER_NAME, // Name prefix
+    BLE_FILTER_RSSI, // Reports weaker than this many dBm
+    BLE_FILTER_KIND_COUNT
+} ble_filter_kind_t;
+
+// Parse a rule and add it at the end of the table
+extern esp_err_t ble_filter_add(bool allow, ble_filter_kind_t kind, const char *value);
+
+// Remove rule n, counting from 0, or every rule if n is negative
+extern esp_err_t ble_filter_del(int n);
+
+extern void ble_filter_set_default(bool allow);
+
+// True if the report should be kept. adv is parsed here if a rule needs it,
+// and parsed is set if so
+extern bool ble_filter_pass(const esp_ble_gap_cb_param_t *scan_result, ble_adv_t *adv, bool *parsed);
+
+extern void register_cmd_blefilter(void);
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Open addressing index of the BLE device cache by BDA with linear probing.
+// Slots hold the entry number plus one, so zero is empty. Kept at least half
+// empty so probe chains stay short.
+//
+// Plain C with no IDF dependencies, so tools/cache_bench can build it on the
+// host. Define BLE_CACHE_MAX and BLE_INDEX_ENTRY, the entry type, which must
+// have a 6 byte bda member, before including it.
+
+#if !defined(BLE_CACHE_MAX) || !defined(BLE_INDEX_ENTRY)
+#error "Define BLE_CACHE_MAX and BLE_INDEX_ENTRY before including ble_index.h"
+#endif
+
+#define BLE_INDEX_BITS (BLE_CACHE_MAX <= 64 ? 7 : BLE_CACHE_MAX <= 128 ? 8 : BLE_CACHE_MAX <= 256 ? 9 : \
+                        BLE_CACHE_MAX <= 512 ? 10 : BLE_CACHE_MAX <= 1024 ? 11 : 12)
+#define BLE_INDEX_SIZE (1 << BLE_INDEX_BITS)
+#define BLE_INDEX_MASK (BLE_INDEX_SIZE - 1)
+
+static inline uint32_t ble_index_hash(const uint8_t *bda) {
+    uint64_t v = 0;
+    memcpy(&v, bda, 6);
+    return (uint32_t)((v * 0x9E3779B97F4A7C15ULL) >> (64 - BLE_INDEX_BITS));
+}
+
+// Find the entry with this BDA, or -1. The slot it is in, or would go in, is
+// returned through slot
+static inline int ble_index_find(const int16_t *index, const BLE_INDEX_ENTRY *entries, const uint8_t *bda,
+                                 uint32_t *slot) {
+    uint32_t s = ble_index_hash(bda);
+    while(index[s]) {
+        int idx = index[s] - 1;
+        if(memcmp(entries[idx].bda, bda, 6) == 0) {
+            *slot = s;
+            return idx;
+        }
+        s = (s + 1) & BLE_INDEX_MASK;
+    }
+    *slot = s;
+    return -1;
+}
+
+// Empty a slot, moving later entries of the probe chain back so none of
+// them is cut off from its home slot
+static inline void ble_index_remove(int16_t *index, const BLE_INDEX_ENTRY *entries, uint32_t slot) {
+    uint32_t hole = slot;
+    for(uint32_t s=(slot + 1) & BLE_INDEX_MASK; index[s]; s=(s + 1) & BLE_INDEX_MASK) {
+        uint32_t home = ble_index_hash(entries[index[s] - 1].bda);
+        // Move it if its home is not between the hole and where it is now
+        if(((s - home) & BLE_INDEX_MASK) >= ((s - hole) & BLE_INDEX_MASK)) {
+            index[hole] = index[s];
+            hole = s;
+        }
+    }
+    index[hole] = 0;
+}
+
+// Index every entry again, after entries have moved
+static inline void ble_index_rebuild(int16_t *index, const BLE_INDEX_ENTRY *entries, int count) {
+    uint32_t slot;
+    memset(index, 0, sizeof(int16_t) * BLE_INDEX_SIZE);
+    for(int idx=0;idx<count;idx++) {
+        ble_index_find(index, entries, entries[idx].bda, &slot);
+        index[slot] = idx + 1;
+    }
+}
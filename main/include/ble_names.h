@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+// Interned BLE device names. Names are copied once into a bump allocated
+// arena, and a name already in the arena, such as a common product name,
+// is shared rather than copied again. There are two arenas: swapping empties
+// the spare one and makes it current, and names still wanted are interned
+// again into it. Names in the previous arena stay valid until the next swap.
+// Not thread safe, used from the Bluetooth task.
+
+typedef struct ble_names_stats {
+    uint32_t used; // Bytes in the current arena
+    uint32_t size; // Bytes in each arena
+    uint32_t peak; // Most bytes used in an arena
+    uint32_t names; // Distinct names in the current arena
+    uint32_t shared; // Names found already interned
+    uint32_t full; // Names not stored as the arena was full
+    uint32_t swaps;
+} ble_names_stats_t;
+
+extern esp_err_t ble_names_init(uint32_t caps);
+
+// Returns the interned copy of name, NULL if the arena is full
+extern const char *ble_names_intern(const char *name, uint8_t len);
+
+// Length of an interned name
+static inline uint8_t ble_names_len(const char *name) {
+    return ((const uint8_t *)name)[-1];
+}
+
+// Start using the other arena, emptied
+extern void ble_names_swap(void);
+
+extern void ble_names_get_stats(ble_names_stats_t *stats);
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_bt_defs.h"
+
+// Names read over GATT, kept in NVS so they survive deep sleep and reboots.
+// Each record holds a device's name with the time it was read, and the
+// handles of its GAP service and device name characteristic. Names older
+// than APP_BLE_STORE_TTL_H are not used, but the handles still let the name
+// be read again without a service search. When full the oldest record is
+// replaced. Changes are written back by a background task a little after
+// the last one, and by ble_store_save.
+
+#define BLE_STORE_NAME_MAX 31
+
+typedef struct ble_store_handles {
+    uint16_t service_start;
+    uint16_t service_end;
+    uint16_t name_char;
+} ble_store_handles_t;
+
+typedef struct ble_store_stats {
+    uint32_t records;
+    uint32_t capacity;
+    uint32_t hits; // Names given from the store, each a connection avoided
+    uint32_t expired; // Names found but too old to use
+    uint32_t direct; // Lookups which read the name by its stored handle
+    uint32_t stored; // Names saved after a lookup
+    uint32_t saves; // Writes to NVS
+    uint32_t dirty; // Unsaved changes
+} ble_store_stats_t;
+
+// Load the records from NVS
+extern esp_err_t ble_store_init(uint32_t caps);
+
+// Copy out a name which hasn't expired. name must hold BLE_STORE_NAME_MAX bytes
+extern bool ble_store_get_name(const esp_bd_addr_t bda, char *name, uint8_t *len);
+
+// The stored handles for a device, false if there are none
+extern bool ble_store_get_handles(const esp_bd_addr_t bda, ble_store_handles_t *handles);
+
+// Record a name read over GATT and where it was read from
+extern void ble_store_put(const esp_bd_addr_t bda, const uint8_t *name, uint8_t len,
+                          const ble_store_handles_t *handles);
+
+// A lookup read the name straight from the stored handle
+extern void ble_store_count_direct(void);
+
+// Write the records to NVS if they have changed
+extern esp_err_t ble_store_save(void);
+
+extern void ble_store_get_stats(ble_store_stats_t *stats);
+extern void register_cmd_blestore(void);
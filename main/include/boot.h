@@ -0,0 +1,43 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+
+// Boot stages. Each one runs in its own task as soon as all the stages it
+// depends on are done, so independent stages overlap on both cores
+typedef enum {
+    BOOT_NVS,
+    BOOT_DIAL,
+    BOOT_LEDS,
+    BOOT_LCD,
+    BOOT_LVGL,
+    BOOT_WIFI,
+    BOOT_GUI,
+    BOOT_WIFI_CONNECT,
+    BOOT_SNTP,
+    BOOT_BT,
+    BOOT_SD,
+    BOOT_CONSOLE,
+    BOOT_STAGE_COUNT
+} boot_stage_id_t;
+
+#define BOOT_BIT(id) ((EventBits_t)1 << (id))
+
+typedef struct {
+    const char *name;
+    void (*run)(void); // NULL if the stage is configured out
+    EventBits_t deps; // BOOT_BIT() of each stage which must be done first
+    BaseType_t core;
+    uint32_t stack;
+} boot_stage_t;
+
+// Start the stages, indexed by boot_stage_id_t. Returns immediately
+extern void boot_start(const boot_stage_t *stages);
+
+// Block until all the given stages are done
+extern void boot_wait(EventBits_t stages);
+
+// Record the first frame drawn with the UI live
+extern void boot_first_frame(void);
+
+extern void register_cmd_boot(void);
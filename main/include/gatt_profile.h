@@ -12,12 +12,6 @@ struct gattc_profile_inst {
     esp_gattc_cb_t gattc_cb;
     uint16_t gattc_if;
     uint16_t app_id;
-    uint16_t conn_id;
-    uint16_t service_start_handle;
-    uint16_t service_end_handle;
-    uint16_t char_handle;
-    esp_bd_addr_t remote_bda;
-    int open:1;
 };
 
 #define PROFILE_NUM      1
@@ -25,3 +19,8 @@ struct gattc_profile_inst {
 #define INVALID_HANDLE   0
 
 extern struct gattc_profile_inst gl_profile_tab[PROFILE_NUM];
+
+// Start GATT name lookups for cached devices without a name, up to
+// APP_BLE_NAME_SLOTS at once. Each finished lookup starts the next one
+extern void ble_gattc_resolve(void);
+extern void register_cmd_blenames(void);
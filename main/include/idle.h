@@ -18,3 +18,9 @@ static inline void ACTION(void) {last_action = esp_timer_get_time();}
 #else
 #define IDLE_TIME_uS (30 * MICRO_PER_SECOND)
 #endif
+
+// Number of times the idle timer has woken up
+extern volatile uint32_t idle_wakeups;
+
+// Start the idle timer, which posts APP_EVENT_SHUTDOWN after IDLE_TIME_uS without an ACTION()
+extern void idle_init(void);
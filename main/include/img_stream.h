@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "lvgl.h"
+
+// Streaming JPEG and PNG decoder for LVGL. Images are given to lv_img as
+// a file path such as "/sdcard/photo.jpg", downscaled to fit the box set with
+// img_stream_set_fit. A background task decodes a strip at a time into a
+// ring of a few strips and has each one redrawn as it is ready, so the UI
+// task never waits on the card and no full frame is held. Lines not decoded
+// yet draw black. Everything is freed when LVGL closes the image. Files are
+// read through sd_cache, so showing an image again skips the card.
+
+typedef struct img_stream_stats {
+    char name[32]; // File name of the last image decoded
+    uint16_t src_w, src_h; // Size in the file
+    uint16_t w, h; // Size shown
+    uint8_t shrink; // Source pixels per shown pixel
+    uint32_t decode_ms; // Time for the last complete decode
+    size_t peak; // Memory held by the decoder for that image, strips included
+    uint32_t decodes; // Complete decodes of any image
+    uint32_t restarts; // Decodes started again because LVGL redrew lines already released
+    uint32_t errors;
+} img_stream_stats_t;
+
+// Register the decoder with LVGL. Call after lv_init
+extern void img_stream_init(void);
+
+// Largest size images are shown at, applies to images opened afterwards
+extern void img_stream_set_fit(lv_coord_t w, lv_coord_t h);
+
+// Read the size of an image from its header, so LVGL can be given the image
+// without the UI task touching the card. Blocks on the card, call it before
+// lv_img_set_src from another task. The last few are remembered
+extern esp_err_t img_stream_probe(const char *path);
+
+// Object the image is shown in, whose lines are redrawn as strips are
+// decoded. NULL redraws the whole screen. UI task only
+extern void img_stream_set_target(lv_obj_t *img);
+
+// True if the file name has an extension the decoder handles
+extern bool img_stream_supported(const char *name);
+
+extern void img_stream_get_stats(img_stream_stats_t *stats);
+extern void register_cmd_img(void);
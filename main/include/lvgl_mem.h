@@ -0,0 +1,22 @@
+#pragma once
+
+// Allocates the pool for the LVGL TLSF heap. This is included by lv_mem.c
+// through LV_MEM_POOL_INCLUDE, set in the top level CMakeLists.txt
+
+#include <assert.h>
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+
+#if CONFIG_APP_LVGL_MEM_PSRAM
+#define LVGL_MEM_CAPS (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#define LVGL_MEM_WHERE "PSRAM"
+#else
+#define LVGL_MEM_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define LVGL_MEM_WHERE "internal RAM"
+#endif
+
+static inline void *lvgl_mem_pool_alloc(size_t size) {
+    void *pool = heap_caps_malloc(size, LVGL_MEM_CAPS);
+    assert(pool);
+    return pool;
+}
@@ -9,6 +9,7 @@
 #include "esp_err.h"
 #include "tembed.h"
 #include "idle.h"
+#include "ui_sched.h"
 
 // https://github.com/espressif/esp-iot-solution/issues/245
 #define BAD_KNOB_USR_DATA
@@ -40,16 +41,27 @@ typedef void (*panel_free_func)(panel_t *panel);
 // Callback for when sleep starting
 typedef esp_err_t (*sleep_cb_t)(panel_t *panel);
 
+// Callback for when a cached panel is hidden or shown again
+typedef void (*panel_cb_t)(panel_t *panel);
+
+// Function which creates a panel, used to find it in the panel cache
+typedef panel_t *(*panel_init_func)();
+
 // Common structure for all embedded content of screens
 // The panel contains the main content for the screen
 // and may be swapped independently of the whole screen
 typedef struct panel {
     MAGIC_FIELD;
+    const char *name;
     void (*create_content)(panel_t *panel, lv_obj_t *parent);
     panel_free_func free;
     sleep_cb_t goto_sleep; // Called when the sleep code is requesting enter sleep
+    panel_cb_t suspend; // Optional. Disconnect handlers, the widgets are kept hidden for reuse
+    panel_cb_t resume; // Reconnect handlers and refresh the widgets when shown again
     bool handlers_installed;
     lv_obj_t *lv_root;
+    panel_init_func init; // Set by gui_panel_get
+    size_t mem; // Heap used by the widgets, measured when created
 } panel_t;
 
 
@@ -92,6 +104,11 @@ extern esp_err_t gui_sleep(gui_t *gui);
 extern void gui_free(gui_t *gui);
 extern void gui_set_panel(gui_t *gui, panel_t *panel);
 
+// Get a panel from the cache, or create it with init if not cached.
+// Use this with gui_set_panel to navigate to a screen
+extern panel_t *gui_panel_get(panel_init_func init);
+extern void register_cmd_panels(void);
+
 extern sidebar_t *sidebar_init(gui_t *gui);
 extern esp_err_t sidebar_sleep(sidebar_t *sidebar);
 extern void sidebar_free(sidebar_t *sidebar);
@@ -103,9 +120,14 @@ extern void panel_create_content(panel_t *panel, lv_obj_t *parent);
 #define GUI_LOCKS
 #ifdef GUI_LOCKS
 #define LOCK_GUI assert(xSemaphoreTakeRecursive(gui_mutex, (TickType_t)100)==pdTRUE)
-#define UNLOCK_GUI xSemaphoreGiveRecursive(gui_mutex)
+// For the UI task and anything else which may wait on it, as the UI task
+// holds the lock for a whole iteration of its loop
+#define LOCK_GUI_WAIT xSemaphoreTakeRecursive(gui_mutex, portMAX_DELAY)
+// Releasing the lock from another task wakes the UI loop to redraw
+#define UNLOCK_GUI do { xSemaphoreGiveRecursive(gui_mutex); ui_wake(); } while(0)
 #else
 #define LOCK_GUI
+#define LOCK_GUI_WAIT
 #define UNLOCK_GUI
 #endif
 static const lv_color16_t grey={.full=CONVERT_888RGB_TO_565BGR(0xC0,0xC0,0xC0)};
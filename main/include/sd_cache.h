@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include "esp_err.h"
+
+// Read cache for files on the SD card. Files are read in fixed size blocks
+// kept in PSRAM, least recently used blocks are replaced first. A miss on
+// the block after the last one read fetches several blocks in one read.
+// Blocks point into a table of the files they came from, matched on the
+// full path, size and modification time, so a file which changes is read
+// again. Safe to use from any task.
+//
+// The cache is also an LVGL drive, "S:/photo.bin" is /sdcard/photo.bin
+
+#define SD_CACHE_LETTER 'S'
+
+typedef struct sd_cache_file sd_cache_file_t;
+
+typedef struct sd_cache_stats {
+    uint32_t blocks; // Capacity
+    uint32_t block_size;
+    uint32_t used; // Blocks holding data
+    uint32_t hits; // Block lookups found in RAM
+    uint32_t misses; // Block lookups read from the card
+    uint32_t read_ahead; // Blocks read beyond the one missed
+    uint32_t evictions;
+    uint64_t card_bytes; // Read from the card
+    uint64_t served_bytes; // Handed to readers
+    uint64_t read_us; // Spent reading the card
+} sd_cache_stats_t;
+
+// Allocate the cache and register the LVGL drive. Call after lv_init
+extern esp_err_t sd_cache_init(void);
+
+// Open a file for reading, NULL if it doesn't exist
+extern sd_cache_file_t *sd_cache_open(const char *path);
+extern size_t sd_cache_read(sd_cache_file_t *f, void *buf, size_t len);
+// whence is SEEK_SET, SEEK_CUR or SEEK_END. Returns 0 or -1
+extern int sd_cache_seek(sd_cache_file_t *f, off_t offset, int whence);
+extern off_t sd_cache_tell(sd_cache_file_t *f);
+extern size_t sd_cache_size(sd_cache_file_t *f);
+extern void sd_cache_close(sd_cache_file_t *f);
+
+// Forget every block, for example after the card was changed
+extern void sd_cache_clear(void);
+
+extern void sd_cache_get_stats(sd_cache_stats_t *stats);
+extern void register_cmd_fscache(void);
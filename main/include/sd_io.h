@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "esp_err.h"
+
+// SD card I/O service. Requests are queued to a task which owns all
+// blocking SD access, and completions are delivered by callback on that
+// task. A panel that needs the result on the UI task posts it with ui_post.
+
+typedef enum {
+    SD_IO_READ, // Read len bytes at offset into buf
+    SD_IO_WRITE, // Write len bytes from buf at offset, creating the file
+    SD_IO_STAT, // Fill in st
+    SD_IO_STREAM, // Read from offset in chunks, len 0 reads to the end
+    SD_IO_OP_COUNT
+} sd_io_op_t;
+
+// Write at the end of the file
+#define SD_IO_APPEND ((off_t)-1)
+
+typedef struct sd_io_req sd_io_req_t;
+
+// Called on the SD I/O task when the request has finished
+typedef void (*sd_io_done_t)(sd_io_req_t *req);
+
+// Called on the SD I/O task with each chunk of a stream. The data stays
+// valid until sd_io_release is called, and the next chunk is read into the
+// other buffer meanwhile. Every chunk must be released, or the service stops
+typedef void (*sd_io_chunk_t)(sd_io_req_t *req, const void *data, size_t len, off_t offset);
+
+// Owned by the caller and must stay valid until it completes
+struct sd_io_req {
+    sd_io_op_t op;
+    const char *path;
+    off_t offset;
+    void *buf;
+    size_t len;
+    sd_io_done_t done; // Required
+    sd_io_chunk_t chunk; // SD_IO_STREAM only
+    void *ctx;
+
+    // Results
+    esp_err_t err;
+    size_t result; // Bytes read or written
+    struct stat st;
+
+    int64_t queued; // Private
+};
+
+// Start the service, call once the card is mounted
+extern esp_err_t sd_io_init(void);
+
+// Queue a request. Returns ESP_ERR_TIMEOUT if the queue is full, and
+// ESP_ERR_INVALID_ARG without a done callback
+extern esp_err_t sd_io_submit(sd_io_req_t *req);
+
+// Hand a stream chunk back to the service
+extern void sd_io_release(sd_io_req_t *req);
+
+extern void register_cmd_sdio(void);
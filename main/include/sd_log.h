@@ -0,0 +1,20 @@
+#pragma once
+
+#include "esp_err.h"
+
+// Copies everything logged with ESP_LOGx to rotating files on the SD card.
+// Lines are appended to a lock free RAM ring by whichever task logs them,
+// and a low priority task writes them out in large blocks. Logging never
+// waits for the card, when the ring is full lines are dropped and counted.
+// The newest file is /sdcard/LOG0.TXT, older ones LOG1.TXT and up
+
+// Start the sink. Call once the card is mounted
+extern esp_err_t sd_log_init(void);
+
+// Write out what is in the ring, close the file and stop copying the log.
+// Call before the card is unmounted. Returns ESP_ERR_TIMEOUT if the task is
+// still writing after a second, in which case the card must stay mounted;
+// calling again waits for the same stop
+extern esp_err_t sd_log_stop(void);
+
+extern void register_cmd_sdlog(void);
@@ -11,4 +11,21 @@ extern bool notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_
 
 extern esp_timer_handle_t lvgl_tick_timer;
 
+// Called on the UI task as the last stripe of each frame is flushed
+typedef void (*lvgl_frame_cb_t)(int64_t now);
+extern void tembed_lvgl_on_frame(lvgl_frame_cb_t cb);
+
 extern lv_obj_t *lv_blank;
+
+// Called from the panel IO ISR as each colour transfer of the panel's
+// current owner completes. Return true if a higher priority task was woken
+typedef bool (*lcd_done_cb_t)(void *ctx);
+
+// Take the panel from LVGL to draw on it directly. Waits for the stripes LVGL
+// has in flight, after that LVGL carries on rendering but nothing is sent.
+// Returns the panel to pass to esp_lcd_panel_draw_bitmap
+extern esp_lcd_panel_handle_t tembed_lvgl_claim(lcd_done_cb_t done, void *ctx);
+
+// Give the panel back to LVGL and redraw the whole screen. The caller's
+// transfers must have completed
+extern void tembed_lvgl_release(void);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+
+// UI commands run on the UI task with the GUI locked. ctx and arg are
+// whatever the poster passed, ctx must still be valid when the command runs
+typedef void (*ui_fn_t)(void *ctx, uintptr_t arg);
+
+// Create the UI command queue, call before anything can post
+extern void ui_init(void);
+
+// Start the UI task, which owns LVGL from then on
+extern void ui_start(void);
+
+// Queue fn to run on the UI task. Runs fn straight away when called from the
+// UI task. Returns ESP_ERR_TIMEOUT if the queue stays full
+extern esp_err_t ui_post(ui_fn_t fn, void *ctx, uintptr_t arg);
+
+// True when called from the UI task
+extern bool ui_is_ui_task(void);
+
+// True on the UI task, or before it has started. Button, knob and other
+// task callbacks must ui_post their LVGL changes rather than make them
+extern bool ui_in_context(void);
+
+// Wake the UI loop early, e.g. after changing LVGL state from another task
+extern void ui_wake(void);
+
+extern void register_cmd_uistat(void);
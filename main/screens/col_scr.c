@@ -65,25 +65,49 @@ static esp_err_t col_sleep(panel_t *data) {
     return ESP_OK;
 }
 
-// Handle a selection on the col menu
-static void col_menu_click_cb(void *arg, void *data)
-{
-    ACTION();
-    assert(data);
+// Hidden and kept for reuse
+static void col_suspend(panel_t *data) {
     col_scr_t *col = (col_scr_t *)data;
-    STRUCT_CHECK_MAGIC(col, COL_SCR_MAGIC, TAG, "click");
+    STRUCT_CHECK_MAGIC(col, COL_SCR_MAGIC, TAG, "suspend");
 
-    LOCK_GUI;
+    if(col->scr.handlers_installed) {
+        col_unreg_handlers(col);
+    }
+}
+
+// Shown again from the panel cache
+static void col_resume(panel_t *data) {
+    col_scr_t *col = (col_scr_t *)data;
+    STRUCT_CHECK_MAGIC(col, COL_SCR_MAGIC, TAG, "resume");
+
+    gui_set_menu_title((char *)"Color Test");
+    col_reg_handlers(col);
+}
+
+// Runs on the UI task. The screen may have been left since the click was posted
+static void col_menu_click(void *ctx, uintptr_t arg)
+{
+    if(active_scr != (panel_t *)ctx) return;
+    col_scr_t *col = (col_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(col, COL_SCR_MAGIC, TAG, "click");
 
     if(col->scr.handlers_installed) {
         col_unreg_handlers(col);
     }
 
-    active_scr=main_scr_init();
+    active_scr=gui_panel_get(main_scr_init);
     gui_set_panel(gui, active_scr);
+}
 
-    UNLOCK_GUI;
+// Handle a selection on the col menu
+static void col_menu_click_cb(void *arg, void *data)
+{
+    ACTION();
+    assert(data);
+    col_scr_t *col = (col_scr_t *)data;
+    STRUCT_CHECK_MAGIC(col, COL_SCR_MAGIC, TAG, "click");
 
+    ui_post(col_menu_click, col, 0);
 }
 
 static const lv_style_const_prop_t col_style_props[] = {
@@ -157,9 +181,12 @@ panel_t *col_scr_init() {
     ESP_LOGI(TAG,"Init");
     col_scr_t *col = calloc(1, sizeof(col_scr_t));
     STRUCT_INIT_MAGIC(col, COL_SCR_MAGIC);
+    col->scr.name = TAG;
     col->scr.free = col_free;
     col->scr.goto_sleep = col_sleep;
     col->scr.create_content = col_lv_init;
+    col->scr.suspend = col_suspend;
+    col->scr.resume = col_resume;
 
     ESP_LOGI(TAG,"Done");
     return (panel_t *)col;
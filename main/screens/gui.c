@@ -1,7 +1,10 @@
+#include <string.h>
 #include "sdkconfig.h"
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "esp_timer.h"
+#include "esp_console.h"
 
 #include "iot_button.h"
 #include "iot_knob.h"
@@ -9,6 +12,7 @@
 #include "tembed.h"
 #include "scr.h"
 #include "idle.h"
+#include "tembed_lvgl.h"
 
 // Identifiers for this screen
 static const char *TAG="gui";
@@ -26,6 +30,136 @@ static const lv_style_const_prop_t gui_style_props[] = {
 };
 LV_STYLE_CONST_INIT(gui_style, gui_style_props);
 
+// Panels hidden under lvnd_content for reuse, most recently shown first
+#define PANEL_CACHE_SLOTS (CONFIG_APP_PANEL_CACHE_COUNT ? CONFIG_APP_PANEL_CACHE_COUNT : 1)
+#define PANEL_CACHE_BYTES (CONFIG_APP_PANEL_CACHE_KB * 1024)
+static panel_t *panel_cache[PANEL_CACHE_SLOTS];
+static int panel_cache_count = 0;
+static size_t panel_cache_bytes = 0;
+static uint32_t panel_hits = 0;
+static uint32_t panel_misses = 0;
+static uint32_t panel_evictions = 0;
+
+// Navigation latency, from gui_panel_get to the end of the next flushed frame
+typedef struct {
+    uint32_t count;
+    uint64_t total_us;
+    uint32_t max_us;
+    uint32_t last_us;
+} nav_stat_t;
+
+static portMUX_TYPE nav_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t nav_start = 0;
+static bool nav_pending = false;
+static bool nav_cached = false;
+static nav_stat_t nav_rebuilt;
+static nav_stat_t nav_reused;
+
+// Called by the LVGL flush at the end of each frame
+static void gui_frame_cb(int64_t now) {
+    portENTER_CRITICAL(&nav_lock);
+    if(nav_pending) {
+        nav_stat_t *stat = nav_cached ? &nav_reused : &nav_rebuilt;
+        uint32_t us = (uint32_t)(now - nav_start);
+        stat->count++;
+        stat->total_us += us;
+        stat->last_us = us;
+        if(us > stat->max_us) {
+            stat->max_us = us;
+        }
+        nav_pending = false;
+    }
+    portEXIT_CRITICAL(&nav_lock);
+}
+
+// Bytes allocated from the LVGL heap
+static size_t lvgl_mem_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+// Free a panel and its widgets. Must hold the GUI lock
+static void panel_cache_evict(int idx) {
+    panel_t *panel = panel_cache[idx];
+
+    ESP_LOGI(TAG, "evict %s (%u bytes)", panel->name ? panel->name : "?", panel->mem);
+    panel_cache_count--;
+    memmove(&panel_cache[idx], &panel_cache[idx + 1], (panel_cache_count - idx) * sizeof(panel_t *));
+    panel_cache_bytes -= panel->mem;
+    panel_evictions++;
+    panel_free(panel);
+}
+
+// Hide a panel and keep it for reuse. Returns false if the panel
+// can't be cached and should be freed instead. Must hold the GUI lock
+static bool panel_cache_put(panel_t *panel) {
+    if(CONFIG_APP_PANEL_CACHE_COUNT == 0 || !panel->suspend || !panel->init
+       || !panel->lv_root || panel->mem > PANEL_CACHE_BYTES) {
+        return false;
+    }
+
+    panel->suspend(panel);
+    lv_obj_add_flag(panel->lv_root, LV_OBJ_FLAG_HIDDEN);
+
+    // Only keep one copy of each panel
+    for(int i = 0; i < panel_cache_count; i++) {
+        if(panel_cache[i]->init == panel->init) {
+            panel_cache_evict(i);
+            break;
+        }
+    }
+    // Drop the least recently shown panels until this one fits
+    while(panel_cache_count == PANEL_CACHE_SLOTS
+          || (panel_cache_count && panel_cache_bytes + panel->mem > PANEL_CACHE_BYTES)) {
+        panel_cache_evict(panel_cache_count - 1);
+    }
+
+    memmove(&panel_cache[1], &panel_cache[0], panel_cache_count * sizeof(panel_t *));
+    panel_cache[0] = panel;
+    panel_cache_count++;
+    panel_cache_bytes += panel->mem;
+
+    return true;
+}
+
+panel_t *gui_panel_get(panel_init_func init) {
+    panel_t *panel = NULL;
+    assert(ui_in_context());
+
+    LOCK_GUI;
+
+    for(int i = 0; i < panel_cache_count; i++) {
+        if(panel_cache[i]->init == init) {
+            panel = panel_cache[i];
+            panel_cache_count--;
+            memmove(&panel_cache[i], &panel_cache[i + 1], (panel_cache_count - i) * sizeof(panel_t *));
+            panel_cache_bytes -= panel->mem;
+            break;
+        }
+    }
+    if(panel) {
+        panel_hits++;
+    } else {
+        panel_misses++;
+    }
+
+    portENTER_CRITICAL(&nav_lock);
+    nav_start = esp_timer_get_time();
+    nav_cached = panel != NULL;
+    nav_pending = false;
+    portEXIT_CRITICAL(&nav_lock);
+
+    if(!panel) {
+        panel = init();
+        panel->init = init;
+    }
+
+    UNLOCK_GUI;
+
+    return panel;
+}
+
 void gui_set_menu_title(char *title)
 {
     lv_label_set_text(gui->lvnd_title, title);
@@ -51,6 +185,9 @@ void gui_free(gui_t *gui) {
         panel_free(gui->panel);
         gui->panel=NULL;
     }
+    while(panel_cache_count) {
+        panel_cache_evict(panel_cache_count - 1);
+    }
     // del of this object deletes children too. As we delete the
     // components above, that should now only be objects directly
     // owned by this one
@@ -167,17 +304,35 @@ void panel_free(panel_t *panel) {
 }
 
 void gui_set_panel(gui_t *gui, panel_t *panel) {
+    assert(ui_in_context());
     STRUCT_CHECK_MAGIC(gui, GUI_MAGIC, TAG, "set panel");
     ESP_LOGI(TAG, "set panel");
 
     LOCK_GUI;
 
-    if(gui->panel) {
-        // Disconnect _and free_ all resources associated with the current panel
-        panel_free(gui->panel);
+    if(gui->panel && gui->panel != panel) {
+        // Hide the current panel for reuse, or disconnect _and free_ all
+        // resources associated with it
+        if(!panel_cache_put(gui->panel)) {
+            panel_free(gui->panel);
+        }
     }
     gui->panel=panel;
-    gui->panel->create_content(panel, gui->lvnd_content);
+    if(panel->lv_root) {
+        // Cached panel, the widgets are still there
+        lv_obj_clear_flag(panel->lv_root, LV_OBJ_FLAG_HIDDEN);
+        panel->resume(panel);
+    } else {
+        // The growth of the LVGL heap is what the widgets use
+        size_t before = lvgl_mem_used();
+        gui->panel->create_content(panel, gui->lvnd_content);
+        size_t after = lvgl_mem_used();
+        panel->mem = after > before ? after - before : 0;
+    }
+
+    portENTER_CRITICAL(&nav_lock);
+    nav_pending = nav_start != 0;
+    portEXIT_CRITICAL(&nav_lock);
 
     UNLOCK_GUI;
 
@@ -199,8 +354,53 @@ gui_t *gui_init() {
     // Display the screen
     lv_scr_load(gui->lv_root);
 
+    tembed_lvgl_on_frame(gui_frame_cb);
+
     UNLOCK_GUI;
 
     ESP_LOGI(TAG,"Done");
     return gui;
 }
+
+static void print_nav_stat(const char *what, const nav_stat_t *stat) {
+    printf("%-8s %6u %8llu %8u %8u\n", what, stat->count,
+           stat->count ? stat->total_us / stat->count : 0, stat->max_us, stat->last_us);
+}
+
+static int panels_cmd(int argc, char **argv) {
+    nav_stat_t rebuilt, reused;
+
+    LOCK_GUI_WAIT;
+    printf("Panel cache: %d of %d panels, %u of %u bytes of LVGL heap\n", panel_cache_count,
+           CONFIG_APP_PANEL_CACHE_COUNT, panel_cache_bytes, PANEL_CACHE_BYTES);
+    if(gui && gui->panel) {
+        printf("  shown  %-16s %6u bytes\n", gui->panel->name ? gui->panel->name : "?", gui->panel->mem);
+    }
+    for(int i = 0; i < panel_cache_count; i++) {
+        printf("  %-6d %-16s %6u bytes\n", i, panel_cache[i]->name ? panel_cache[i]->name : "?", panel_cache[i]->mem);
+    }
+    printf("%u hits, %u misses, %u evictions\n", panel_hits, panel_misses, panel_evictions);
+    UNLOCK_GUI;
+
+    portENTER_CRITICAL(&nav_lock);
+    rebuilt = nav_rebuilt;
+    reused = nav_reused;
+    portEXIT_CRITICAL(&nav_lock);
+
+    printf("%-8s %6s %8s %8s %8s\n", "Nav", "Count", "Avg us", "Max us", "Last us");
+    print_nav_stat("rebuilt", &rebuilt);
+    print_nav_stat("cached", &reused);
+
+    return 0;
+}
+
+void register_cmd_panels(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "panels",
+        .help = "Show cached panels and navigation latency",
+        .hint = NULL,
+        .func = &panels_cmd,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
@@ -1,79 +1,369 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "sdkconfig.h"
 #include "esp_log.h"
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
 
 #include "iot_button.h"
 #include "iot_knob.h"
 #include "lvgl.h"
 #include "tembed.h"
+#include "scr.h"
+#include "img_stream.h"
+#include "dirent.h"
 
-static const char *TAG "image_scr"
+static const char *TAG="image_scr";
 
-// https://github.com/espressif/esp-iot-solution/issues/245
-#define BAD_KNOB_USR_DATA
+#ifdef STRUCT_MAGIC
+#define IMAGE_SCR_MAGIC STRUCT_MAKE_MAGIC(0xF2)
+#endif
+
+#define IMAGE_ROOT "/sdcard"
+#define IMAGE_NAME_LEN 64
+#define IMAGE_STEPS 4 // Knob turns queued for the find task
 
-extern unsigned char *img_logo;
-extern void main_scr(tembed_t tembed);
+extern panel_t *main_scr_init();
 
 typedef struct image_scr {
-#ifdef BAD_KNOB_USR_DATA
-    uint16_t magic;
-#endif
-    lv_obj_t *scr;
-    lv_img_dsc_t image_data;
-    tembed_t tembed;
-} *image_scr_t;
+    panel_t scr;
+    lv_obj_t *lvnd_img;
+    lv_obj_t *lvnd_msg;
+    char name[IMAGE_NAME_LEN]; // Image shown, empty if none
+    char path[sizeof(IMAGE_ROOT) + IMAGE_NAME_LEN];
+    char title[IMAGE_NAME_LEN + 16];
+
+    // Find task, reads the directory so the UI task never does
+    TaskHandle_t task;
+    SemaphoreHandle_t task_done;
+    QueueHandle_t steps; // 1 for the next image, -1 for the one before
+    volatile bool quit;
+} image_scr_t;
+
+static void image_click_cb(void *arg, void *data);
+static void image_knob_left_cb(void *arg, void *data);
+static void image_knob_right_cb(void *arg, void *data);
+
+static void image_reg_handlers(image_scr_t *image) {
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "reg_handlers");
+    // Register the event handlers for the knob for this screen
+    ESP_ERROR_CHECK(iot_button_register_cb(tembed->dial.btn, BUTTON_SINGLE_CLICK, image_click_cb, image));
+    ESP_ERROR_CHECK(iot_knob_register_cb(tembed->dial.knob, KNOB_LEFT, image_knob_left_cb, image));
+    ESP_ERROR_CHECK(iot_knob_register_cb(tembed->dial.knob, KNOB_RIGHT, image_knob_right_cb, image));
+    image->scr.handlers_installed=true;
+}
+
+static void image_unreg_handlers(image_scr_t *image) {
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "unreg_handlers");
+    ESP_ERROR_CHECK(iot_button_unregister_cb(tembed->dial.btn,BUTTON_SINGLE_CLICK));
+    ESP_ERROR_CHECK(iot_knob_unregister_cb(tembed->dial.knob, KNOB_LEFT));
+    ESP_ERROR_CHECK(iot_knob_unregister_cb(tembed->dial.knob, KNOB_RIGHT));
+    image->scr.handlers_installed=false;
+}
+
+static void image_free(panel_t *data) {
+    image_scr_t *image = (image_scr_t *)data;
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "free");
+
+    ESP_LOGI(TAG,"Free");
+
+    if(image->scr.handlers_installed) {
+        image_unreg_handlers(image);
+    }
+
+    // Stop the find task before the panel it posts to goes away
+    if(image->task) {
+        int wake = 0;
+        image->quit=true;
+        xQueueSend(image->steps, &wake, portMAX_DELAY);
+        xSemaphoreTake(image->task_done, portMAX_DELAY);
+    }
+    if(image->task_done) {
+        vSemaphoreDelete(image->task_done);
+    }
+    if(image->steps) {
+        vQueueDelete(image->steps);
+    }
+
+    // The image cache keeps the decoder open, close it so the strips are freed
+    img_stream_set_target(NULL);
+    if(image->name[0]) {
+        lv_img_cache_invalidate_src(image->path);
+    }
+    lv_obj_del(image->scr.lv_root); // Free of this object frees children too
+
+    STRUCT_INVALIDATE(image);
+    free(image);
+
+    ESP_LOGI(TAG,"Free done");
+}
+
+static esp_err_t image_sleep(panel_t *data) {
+    image_scr_t *image = (image_scr_t *)data;
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "sleep");
+
+    ESP_LOGI(TAG, "sleep");
+
+    if(image->scr.handlers_installed) {
+        image_unreg_handlers(image);
+    }
+
+    return ESP_OK;
+}
+
+// Find the image after (dir 1) or before (dir -1) current in directory
+// order, wrapping around. Returns false if there are no images
+static bool image_find(const char *current, int dir, char *found) {
+    DIR *d = opendir(IMAGE_ROOT);
+    if(!d) return false;
+
+    char first[IMAGE_NAME_LEN] = "";
+    char before[IMAGE_NAME_LEN] = "";
+    bool seen = false; // Passed the current image
+    bool wrap = false; // The current image is the first, so the last is wanted
+    bool done = false;
+    struct dirent *de;
+    while(!done && (de = readdir(d)) != NULL) {
+        if(de->d_type == DT_DIR || !img_stream_supported(de->d_name) || strlen(de->d_name) >= IMAGE_NAME_LEN) {
+            continue;
+        }
+        if(!first[0]) strcpy(first, de->d_name);
+        if(current[0] && strcmp(de->d_name, current) == 0) {
+            seen = true;
+            // The one before is wanted, and we have it unless this is the first
+            if(dir < 0) {
+                done = before[0] != 0;
+                wrap = !done;
+            }
+            continue;
+        }
+        if(dir > 0 && (seen || !current[0])) {
+            strcpy(found, de->d_name);
+            closedir(d);
+            return true;
+        }
+        // Going back from the first image wraps to the last one
+        if(dir < 0 && (!seen || wrap)) {
+            strcpy(before, de->d_name);
+        }
+    }
+    closedir(d);
+
+    if(dir > 0) {
+        strcpy(found, first); // Wrapped past the last image
+    } else {
+        strcpy(found, before);
+    }
+    return found[0] != 0;
+}
+
+// Show the named image, or a message if there are none. Call with the GUI locked
+static void image_show(image_scr_t *image, const char *name) {
+    if(image->name[0]) {
+        lv_img_cache_invalidate_src(image->path);
+    }
+    if(!name || !name[0]) {
+        image->name[0] = 0;
+        lv_obj_add_flag(image->lvnd_img, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(image->lvnd_msg, LV_OBJ_FLAG_HIDDEN);
+        gui_set_menu_title((char *)"Images");
+        return;
+    }
+
+    strlcpy(image->name, name, sizeof(image->name));
+    snprintf(image->path, sizeof(image->path), IMAGE_ROOT "/%s", name);
+    snprintf(image->title, sizeof(image->title), LV_SYMBOL_IMAGE " %s", name);
+    gui_set_menu_title(image->title);
+
+    // The header was read by the find task, the image is decoded in the background
+    lv_img_set_src(image->lvnd_img, image->path);
+    lv_obj_clear_flag(image->lvnd_img, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(image->lvnd_msg, LV_OBJ_FLAG_HIDDEN);
+    ESP_LOGI(TAG, "Show %s", image->path);
+}
+
+// Runs on the UI task. The screen may have been left since the click was posted
+static void image_click(void *ctx, uintptr_t arg)
+{
+    if(active_scr != (panel_t *)ctx) return;
+    image_scr_t *image = (image_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "click");
+
+    if(image->scr.handlers_installed) {
+        image_unreg_handlers(image);
+    }
+
+    active_scr=gui_panel_get(main_scr_init);
+    gui_set_panel(gui, active_scr);
+}
 
 // Handle a click on the image
 static void image_click_cb(void *arg, void *data)
 {
-    ACTION;
-    assert(data);
-    image_scr_t image = (image_scr_t)data;
+    ACTION();
+    image_scr_t *image = (image_scr_t *)data;
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "click");
+
+    ui_post(image_click, image, 0);
+}
+
+// Runs on the UI task with the name found by the find task, which it frees
+static void image_step(void *ctx, uintptr_t arg)
+{
+    char *name = (char *)arg;
+    if(active_scr == (panel_t *)ctx) {
+        image_scr_t *image = (image_scr_t *)ctx;
+        STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "step");
+        image_show(image, name);
+    }
+    free(name);
+}
+
+// Reads the directory and the image header for each knob turn and posts the
+// image found to the UI. The first step, sent when the screen opens, finds the first image
+static void image_find_task(void *arg) {
+    image_scr_t *image = (image_scr_t *)arg;
+    char current[IMAGE_NAME_LEN] = ""; // Last image found
+    char name[IMAGE_NAME_LEN];
+    int dir;
+
+    while(xQueueReceive(image->steps, &dir, portMAX_DELAY) == pdTRUE && !image->quit) {
+        if(!dir) continue;
+        char *found = NULL;
+        if(image_find(current, dir, name)) {
+            strcpy(current, name);
+            // Read the header here so the UI task does not touch the card
+            char path[sizeof(IMAGE_ROOT) + IMAGE_NAME_LEN];
+            snprintf(path, sizeof(path), IMAGE_ROOT "/%s", name);
+            esp_err_t err = img_stream_probe(path);
+            if(err != ESP_OK) {
+                ESP_LOGW(TAG, "%s: %s", path, esp_err_to_name(err));
+            }
+            found = strdup(name);
+        } else {
+            current[0] = 0;
+        }
+        // NULL shows the no images message
+        if(ui_post(image_step, image, (uintptr_t)found) != ESP_OK) {
+            free(found);
+        }
+    }
+
+    xSemaphoreGive(image->task_done);
+    vTaskDelete(NULL);
+}
+
+static void image_knob(image_scr_t *image, int dir)
+{
+    if(xQueueSend(image->steps, &dir, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Still finding, turn ignored");
+    }
+}
+
+static void image_knob_left_cb(void *arg, void *data)
+{
+    ACTION();
+    image_scr_t *image = (image_scr_t *)data;
+#ifdef STRUCT_MAGIC
 #ifdef BAD_KNOB_USR_DATA
-    assert(image->magic==0xF2F3);
+    if(image->scr.magic!=IMAGE_SCR_MAGIC) {
+        // Knob library is buggy
+        void **usr_data = (void**)data;
+        image = (image_scr_t *)usr_data[KNOB_LEFT];
+    }
+#endif
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "left");
 #endif
-    ESP_ERROR_CHECK(iot_button_unregister_cb((button_handle_t)arg,BUTTON_SINGLE_CLICK));
-
-    main_scr(image->tembed);
 
-    lv_obj_del(image->scr); // Also deletes all the children
-    free(image);
+    image_knob(image, -1);
 }
 
-// Select and display the main menu screen
-void image_scr(tembed_t tembed) {
-    image_scr_t image = cmalloc(1, sizeof(struct image_scr));
-    ESP_LOGI(TAG,"Init");
+static void image_knob_right_cb(void *arg, void *data)
+{
+    ACTION();
+    image_scr_t *image = (image_scr_t *)data;
+#ifdef STRUCT_MAGIC
 #ifdef BAD_KNOB_USR_DATA
-    image->magic=0xF2F3;
+    if(image->scr.magic!=IMAGE_SCR_MAGIC) {
+        // Knob library is buggy
+        void **usr_data = (void**)data;
+        image = (image_scr_t *)usr_data[KNOB_RIGHT];
+    }
+#endif
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "right");
 #endif
-    image->tembed = tembed;
-
-    image->image_data.header.h=170;
-    image->image_data.header.w=320;
-    image->image_data.header.always_zero=0;
-    image->image_data.header.cf=LV_IMG_CF_RGB565;
-    image->image_data.data=img_logo;
-    image->image_data.data_size=108800;
-
-    // Top level object for this screen
-    // Uses a column flow layout
-    image->scr = lv_obj_create(NULL);
-    lv_obj_set_width(image->scr, 320);
-    lv_obj_set_height(image->scr, 170);
-    lv_obj_set_style_bg_color(image->scr, lv_palette_main(LV_PALETTE_GREEN), LV_PART_MAIN);
-
-    lv_obj_t *img = lv_img_create(image->scr);
-    // lv_obj_set_width(img, 320);
-    // lv_obj_set_height(img, 170);
-    lv_img_set_src(img, &image->image_data);
 
-    // Register the event handlers for the knob for this screen
-    ESP_ERROR_CHECK(iot_button_register_cb(tembed->dial.btn, BUTTON_SINGLE_CLICK, image_click_cb, image));
+    image_knob(image, 1);
+}
+
+static const lv_style_const_prop_t image_style_props[] = {
+    LV_STYLE_CONST_BG_COLOR(black), // Black
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER), // Opaque background
+    LV_STYLE_CONST_TEXT_COLOR(white), // White
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_18),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    {.prop=0,.value={.num=0}}
+};
+static LV_STYLE_CONST_INIT(image_style, image_style_props);
+
+static void image_lv_init(panel_t *panel, lv_obj_t *parent)
+{
+    image_scr_t *image = (image_scr_t *)panel;
+    STRUCT_CHECK_MAGIC(image, IMAGE_SCR_MAGIC, TAG, "lv_init");
+
+    LOCK_GUI;
 
-    // Display the screen
-    lv_scr_load(image->scr);
+    image->scr.lv_root = lv_obj_create(parent);
+    lv_obj_t *root = image->scr.lv_root;
+    lv_obj_set_size(root, lv_pct(100), lv_pct(100));
+    lv_obj_add_style(root, (lv_style_t *)&image_style, LV_PART_MAIN);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE);
+
+    image->lvnd_img = lv_img_create(root);
+    lv_obj_center(image->lvnd_img);
+    img_stream_set_target(image->lvnd_img);
+
+    image->lvnd_msg = lv_label_create(root);
+    lv_label_set_text_static(image->lvnd_msg, "No JPEG or PNG images\non the SD card");
+    lv_obj_center(image->lvnd_msg);
+    lv_obj_add_flag(image->lvnd_msg, LV_OBJ_FLAG_HIDDEN);
+    gui_set_menu_title((char *)"Images");
+
+    // Images are scaled down to fit the panel
+    lv_obj_update_layout(root);
+    img_stream_set_fit(lv_obj_get_content_width(root), lv_obj_get_content_height(root));
+
+    // The first image is found in the background
+    int first = 1;
+    image->steps=xQueueCreate(IMAGE_STEPS, sizeof(int));
+    image->task_done=xSemaphoreCreateBinary();
+    xQueueSend(image->steps, &first, 0);
+    xTaskCreate(image_find_task, "image_find", 4096, image, 1, &image->task);
+
+    image_reg_handlers(image);
+
+    UNLOCK_GUI;
+}
+
+// Select and display the image viewer
+panel_t *image_scr_init() {
+    ESP_LOGI(TAG,"Init");
+    image_scr_t *image = calloc(1, sizeof(image_scr_t));
+    STRUCT_INIT_MAGIC(image, IMAGE_SCR_MAGIC);
+    image->scr.name = TAG;
+    image->scr.free = image_free;
+    image->scr.goto_sleep = image_sleep;
+    image->scr.create_content = image_lv_init;
 
     ESP_LOGI(TAG,"Done");
+    return (panel_t *)image;
 }
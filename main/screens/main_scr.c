@@ -29,11 +29,12 @@ static const char *TAG="main_scr";
 #define MAIN_MENU_IMAGE 3
 #define MAIN_MENU_SDCARD 2
 #define MAIN_MENU_COLS 1
-#define MAIN_MENU_MAX MAIN_MENU_SDCARD
+#define MAIN_MENU_MAX MAIN_MENU_IMAGE
 
 extern panel_t *settings_scr_init();
 extern panel_t *col_scr_init();
 extern panel_t *sdcard_scr_init();
+extern panel_t *image_scr_init();
 
 typedef struct main_scr {
     panel_t scr; // Common screen state
@@ -65,17 +66,13 @@ static void main_free(panel_t *data) {
     ESP_LOGI(TAG,"Free done");
 }
 
-// Handle a selection on the main menu
-static void main_menu_click_cb(void *arg, void *data)
+// Runs on the UI task. The screen may have been left since the click was posted
+static void main_menu_click(void *ctx, uintptr_t arg)
 {
-    ACTION();
-    ESP_LOGI(TAG,"Click");
-
-    main_scr_t *main = (main_scr_t *)data;
+    if(active_scr != (panel_t *)ctx) return;
+    main_scr_t *main = (main_scr_t *)ctx;
     STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "click");
 
-    LOCK_GUI;
-
     // Degregister our event handlers
     ESP_LOGI(TAG,"Deregister");
 
@@ -86,22 +83,49 @@ static void main_menu_click_cb(void *arg, void *data)
     ESP_LOGI(TAG,"Screen %d", main->current);
     switch(main->current) {
     case MAIN_MENU_SETTINGS:
-        active_scr = settings_scr_init();
+        active_scr = gui_panel_get(settings_scr_init);
         gui_set_panel(gui, active_scr);
         break;
     case MAIN_MENU_COLS:
-        active_scr = col_scr_init();
+        active_scr = gui_panel_get(col_scr_init);
         gui_set_panel(gui, active_scr);
         break;
     case MAIN_MENU_SDCARD:
-        active_scr = sdcard_scr_init();
+        active_scr = gui_panel_get(sdcard_scr_init);
+        gui_set_panel(gui, active_scr);
+        break;
+    case MAIN_MENU_IMAGE:
+        active_scr = gui_panel_get(image_scr_init);
         gui_set_panel(gui, active_scr);
         break;
     default: assert(false); // Panic
     }
+}
 
-    UNLOCK_GUI;
+// Handle a selection on the main menu
+static void main_menu_click_cb(void *arg, void *data)
+{
+    ACTION();
+    ESP_LOGI(TAG,"Click");
 
+    main_scr_t *main = (main_scr_t *)data;
+    STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "click");
+
+    ui_post(main_menu_click, main, 0);
+}
+
+// Runs on the UI task, moves the focus by step
+static void main_menu_knob(void *ctx, uintptr_t step)
+{
+    if(active_scr != (panel_t *)ctx) return;
+    main_scr_t *main = (main_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "knob");
+
+    lv_obj_clear_state(main->lvnd_widgets[main->current], LV_STATE_FOCUSED);
+    main->current += (intptr_t)step;
+    if(main->current < 0) main->current=MAIN_MENU_MAX;
+    if(main->current > MAIN_MENU_MAX) main->current=0;
+    lv_obj_add_state(main->lvnd_widgets[main->current], LV_STATE_FOCUSED);
 }
 
 static void main_menu_knob_left_cb(void *arg, void *data)
@@ -121,15 +145,7 @@ static void main_menu_knob_left_cb(void *arg, void *data)
 #endif
     ESP_LOGD(TAG,"left");
 
-    LOCK_GUI;
-
-    lv_obj_clear_state(main->lvnd_widgets[main->current], LV_STATE_FOCUSED);
-    main->current--;
-    if(main->current < 0) main->current=MAIN_MENU_MAX;
-    lv_obj_add_state(main->lvnd_widgets[main->current], LV_STATE_FOCUSED);
-
-    UNLOCK_GUI;
-    ESP_LOGD(TAG,"done");
+    ui_post(main_menu_knob, main, (uintptr_t)-1);
 }
 
 static void main_menu_knob_right_cb(void *arg, void *data)
@@ -150,34 +166,32 @@ static void main_menu_knob_right_cb(void *arg, void *data)
 
     ESP_LOGD(TAG,"right");
 
-    LOCK_GUI;
-
-    lv_obj_clear_state(main->lvnd_widgets[main->current], LV_STATE_FOCUSED);
-    main->current++;
-    if(main->current > MAIN_MENU_MAX) main->current=0;
-    lv_obj_add_state(main->lvnd_widgets[main->current], LV_STATE_FOCUSED);
-
-    UNLOCK_GUI;
-
-    ESP_LOGD(TAG,"done");
+    ui_post(main_menu_knob, main, 1);
 }
 
-static void set_ip_label(lv_obj_t *label, const esp_netif_ip_info_t *ip_info) {
+// Call with the GUI locked
+static void set_ip_label(lv_obj_t *label, uint32_t addr) {
     // TODO: Show "Connected" and SSID here
     ESP_LOGI(TAG,"IP: %d.%d.%d.%d", \
-             (ip_info->ip.addr) & 0xFF, \
-             (ip_info->ip.addr >> 8) & 0xFF, \
-             (ip_info->ip.addr >> 16) & 0xFF, \
-             (ip_info->ip.addr >> 24) & 0xFF \
+             (addr) & 0xFF, \
+             (addr >> 8) & 0xFF, \
+             (addr >> 16) & 0xFF, \
+             (addr >> 24) & 0xFF \
         );
-    LOCK_GUI;
     lv_label_set_text_fmt(label, LV_SYMBOL_WIFI " %d.%d.%d.%d", \
-                          (ip_info->ip.addr) & 0xFF, \
-                          (ip_info->ip.addr >> 8) & 0xFF, \
-                          (ip_info->ip.addr >> 16) & 0xFF, \
-                          (ip_info->ip.addr >> 24) & 0xFF \
+                          (addr) & 0xFF, \
+                          (addr >> 8) & 0xFF, \
+                          (addr >> 16) & 0xFF, \
+                          (addr >> 24) & 0xFF \
         );
-    UNLOCK_GUI;
+}
+
+// Runs on the UI task. The screen may have been replaced since the command was posted
+static void got_ip_cb(void *ctx, uintptr_t addr) {
+    if(active_scr != (panel_t *)ctx) return;
+    main_scr_t *main = (main_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "got_ip");
+    set_ip_label(main->lvnd_network, addr);
 }
 
 static void got_ip_event_handler(void *event_handler_arg, esp_event_base_t event_base, int32_t event_id, void *event_data) {
@@ -188,8 +202,7 @@ static void got_ip_event_handler(void *event_handler_arg, esp_event_base_t event
     assert(event_base==IP_EVENT);
     assert(event_id==IP_EVENT_STA_GOT_IP);
     ip_event_got_ip_t *ip_event=(ip_event_got_ip_t *)event_data;
-    esp_netif_ip_info_t *ip_info=&ip_event->ip_info;
-    set_ip_label(main->lvnd_network, ip_info);
+    ui_post(got_ip_cb, main, ip_event->ip_info.ip.addr);
 }
 
 static void main_menu_knob_event(void *arg, void *data) {
@@ -198,11 +211,8 @@ static void main_menu_knob_event(void *arg, void *data) {
     ESP_LOGI(TAG,"Got event %d", event);
 }
 
-static void tick_event_handler(void *event_handler_arg, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    main_scr_t *main = (main_scr_t *)event_handler_arg;
-    STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "tick");
-    assert(event_base==APP_EVENT);
-    assert(event_id==APP_EVENT_TICK);
+// Call with the GUI locked
+static void main_update_clock(main_scr_t *main) {
     time_t now;
     char strftime_buf[64];
     struct tm timeinfo;
@@ -213,9 +223,36 @@ static void tick_event_handler(void *event_handler_arg, esp_event_base_t event_b
      strftime(strftime_buf, sizeof(strftime_buf), "%c", &timeinfo);
     // ESP_LOGI(TAG, "The current date/time in CST is: %s", strftime_buf);
 
-    LOCK_GUI;
     lv_label_set_text(main->lvnd_clock, strftime_buf);
-    UNLOCK_GUI;
+}
+
+static void tick_event_handler(void *event_handler_arg, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    main_scr_t *main = (main_scr_t *)event_handler_arg;
+    STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "tick");
+    assert(event_base==APP_EVENT);
+    assert(event_id==APP_EVENT_TICK);
+
+    // App events are dispatched on the UI task, which already holds the GUI
+    main_update_clock(main);
+}
+
+// Show the current network state. Call with the GUI locked
+static void main_update_network(main_scr_t *main) {
+    // TODO: Handle not configured && provisioning cases here
+    if(tembed->netif) {
+        // Network sub-system is configured
+        if(!esp_netif_is_netif_up(tembed->netif)) {
+            // But there is no network
+            lv_label_set_text_static(main->lvnd_network, LV_SYMBOL_WIFI " No WiFi connection");
+        } else {
+            // Show an IP if we already have one
+            esp_netif_ip_info_t ip_info;
+            ESP_ERROR_CHECK(esp_netif_get_ip_info(tembed->netif, &ip_info));
+            set_ip_label(main->lvnd_network, ip_info.ip.addr);
+        }
+    } else {
+        lv_label_set_text_static(main->lvnd_network, LV_SYMBOL_WIFI " No network");
+    }
 }
 
 static void main_reg_handlers(main_scr_t *main) {
@@ -318,6 +355,11 @@ static void main_lv_init(panel_t *panel, lv_obj_t *parent) {
     lv_obj_add_style(main->lvnd_widgets[MAIN_MENU_SDCARD], (lv_style_t *)&menu_style, LV_PART_MAIN);
     lv_obj_add_style(main->lvnd_widgets[MAIN_MENU_SDCARD], (lv_style_t *)&focus_style, LV_PART_MAIN | LV_STATE_FOCUSED);
 
+    main->lvnd_widgets[MAIN_MENU_IMAGE] = lv_label_create(main->lvnd_menu);
+    lv_label_set_text_static(main->lvnd_widgets[MAIN_MENU_IMAGE], LV_SYMBOL_IMAGE);
+    lv_obj_add_style(main->lvnd_widgets[MAIN_MENU_IMAGE], (lv_style_t *)&menu_style, LV_PART_MAIN);
+    lv_obj_add_style(main->lvnd_widgets[MAIN_MENU_IMAGE], (lv_style_t *)&focus_style, LV_PART_MAIN | LV_STATE_FOCUSED);
+
     // Create a widget to show the time
     main->lvnd_clock = lv_label_create(content);
     lv_obj_set_width(main->lvnd_clock, lv_pct(100));
@@ -333,21 +375,7 @@ static void main_lv_init(panel_t *panel, lv_obj_t *parent) {
     lv_obj_set_style_text_align(main->lvnd_network, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN);
     lv_label_set_long_mode(main->lvnd_network, LV_LABEL_LONG_SCROLL_CIRCULAR);
 
-    // TODO: Handle not configured && provisioning cases here
-    if(tembed->netif) {
-        // Network sub-system is configured
-        if(!esp_netif_is_netif_up(tembed->netif)) {
-            // But there is no network
-            lv_label_set_text_static(main->lvnd_network, LV_SYMBOL_WIFI " No WiFi connection");
-        } else {
-            // Show an IP if we already have one
-            esp_netif_ip_info_t ip_info;
-            ESP_ERROR_CHECK(esp_netif_get_ip_info(tembed->netif, &ip_info));
-            set_ip_label(main->lvnd_network, &ip_info);
-        }
-    } else {
-        lv_label_set_text_static(main->lvnd_network, LV_SYMBOL_WIFI " No network");
-    }
+    main_update_network(main);
 
     main_reg_handlers(main);
 
@@ -367,15 +395,40 @@ esp_err_t main_sleep(panel_t *data) {
     return ESP_OK;
 }
 
+// Hidden and kept for reuse
+static void main_suspend(panel_t *data) {
+    main_scr_t *main = (main_scr_t *)data;
+    STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "suspend");
+
+    if(main->scr.handlers_installed) {
+        main_unreg_handlers(main);
+    }
+}
+
+// Shown again from the panel cache. The IP and clock events were
+// missed whilst hidden, so refresh those labels
+static void main_resume(panel_t *data) {
+    main_scr_t *main = (main_scr_t *)data;
+    STRUCT_CHECK_MAGIC(main, MAIN_SCR_MAGIC, TAG, "resume");
+
+    gui_set_menu_title((char *)"Main Menu");
+    main_update_network(main);
+    main_update_clock(main);
+    main_reg_handlers(main);
+}
+
 // Select and display the main menu screen
 panel_t *main_scr_init() {
     ESP_LOGI(TAG,"Init");
 
     main_scr_t *main = calloc(1, sizeof(main_scr_t));
     STRUCT_INIT_MAGIC(main, MAIN_SCR_MAGIC);
+    main->scr.name = TAG;
     main->scr.free = main_free;
     main->scr.goto_sleep = main_sleep;
     main->scr.create_content = main_lv_init;
+    main->scr.suspend = main_suspend;
+    main->scr.resume = main_resume;
     main->current=MAIN_MENU_SETTINGS;
 
     ESP_LOGI(TAG,"Done");
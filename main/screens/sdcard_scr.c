@@ -1,8 +1,14 @@
+#include <stdio.h>
+#include <string.h>
 #include "sdkconfig.h"
 #include "esp_log.h"
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 
 #include "iot_button.h"
+#include "iot_knob.h"
 #include "lvgl.h"
 #include "tembed.h"
 #include "scr.h"
@@ -13,24 +19,68 @@ static const char *TAG="sdcard_scr";
 #define SDCARD_SCR_MAGIC STRUCT_MAKE_MAGIC(0xF3)
 #endif
 
+#define SDCARD_ROOT "/sdcard/"
+#define SDCARD_ROWS 5 // Labels on screen, reused as the list scrolls
+#define SDCARD_WINDOW 32 // Names kept around the visible rows
+#define SDCARD_PAGE 8 // Names sent to the UI at a time
+#define SDCARD_PROGRESS 64 // Entries counted between progress updates
+#define SDCARD_NAME_LEN 64
+
 extern panel_t *main_scr_init();
 
+// One page of the directory, filled by the list task and read on the UI task
+typedef struct sdcard_page {
+    uint32_t gen; // Window request this page answers
+    uint32_t first; // Index of names[0] in the directory
+    uint16_t count; // Names in this page, may be 0 for progress updates
+    uint32_t total; // Entries enumerated so far
+    bool done; // The whole directory has been read
+    bool missing; // The directory could not be opened
+    char names[SDCARD_PAGE][SDCARD_NAME_LEN];
+} sdcard_page_t;
+
 typedef struct sdcard_scr {
     panel_t scr;
+    lv_obj_t *lvnd_rows[SDCARD_ROWS];
+
+    // Enumeration task
+    TaskHandle_t task;
+    SemaphoreHandle_t task_done;
+    volatile bool quit;
+    volatile bool page_busy; // Page posted and not yet read by the UI
+    volatile uint32_t want_gen; // Bumped when the window moves
+    volatile uint32_t want; // First index of the wanted window
+    sdcard_page_t page;
+
+    // List state, only touched with the GUI locked
+    uint32_t total;
+    bool done;
+    bool missing;
+    uint32_t top; // Index shown in the first row
+    uint32_t cursor; // Selected index
+    uint32_t window_first; // Index of names[0]
+    uint32_t window_loaded; // Names received from window_first on
+    char names[SDCARD_WINDOW][SDCARD_NAME_LEN];
 } sdcard_scr_t;
 
 static void sdcard_menu_click_cb(void *arg, void *data);
+static void sdcard_knob_left_cb(void *arg, void *data);
+static void sdcard_knob_right_cb(void *arg, void *data);
 
 static void sdcard_reg_handlers(sdcard_scr_t *col) {
     STRUCT_CHECK_MAGIC(col, SDCARD_SCR_MAGIC, TAG, "reg_handlers");
     // Register the event handlers for the knob for this screen
     ESP_ERROR_CHECK(iot_button_register_cb(tembed->dial.btn, BUTTON_SINGLE_CLICK, sdcard_menu_click_cb, col));
+    ESP_ERROR_CHECK(iot_knob_register_cb(tembed->dial.knob, KNOB_LEFT, sdcard_knob_left_cb, col));
+    ESP_ERROR_CHECK(iot_knob_register_cb(tembed->dial.knob, KNOB_RIGHT, sdcard_knob_right_cb, col));
     col->scr.handlers_installed=true;
 }
 
 static void sdcard_unreg_handlers(sdcard_scr_t *col) {
     STRUCT_CHECK_MAGIC(col, SDCARD_SCR_MAGIC, TAG, "unreg_handlers");
     ESP_ERROR_CHECK(iot_button_unregister_cb(tembed->dial.btn,BUTTON_SINGLE_CLICK));
+    ESP_ERROR_CHECK(iot_knob_unregister_cb(tembed->dial.knob, KNOB_LEFT));
+    ESP_ERROR_CHECK(iot_knob_unregister_cb(tembed->dial.knob, KNOB_RIGHT));
     col->scr.handlers_installed=false;
 }
 
@@ -43,6 +93,17 @@ static void sdcard_free(panel_t *data) {
     if(col->scr.handlers_installed) {
         sdcard_unreg_handlers(col);
     }
+
+    // Stop the enumeration task before the page it fills goes away
+    if(col->task) {
+        col->quit=true;
+        xTaskNotifyGive(col->task);
+        xSemaphoreTake(col->task_done, portMAX_DELAY);
+    }
+    if(col->task_done) {
+        vSemaphoreDelete(col->task_done);
+    }
+
     lv_obj_del(col->scr.lv_root); // Free of this object frees children too
 
     STRUCT_INVALIDATE(col);
@@ -64,6 +125,168 @@ static esp_err_t sdcard_sleep(panel_t *data) {
     return ESP_OK;
 }
 
+// Show the names around the cursor in the recycled row labels. Call with the GUI locked
+static void sdcard_show_rows(sdcard_scr_t *sdcard) {
+    for(int r=0; r<SDCARD_ROWS; r++) {
+        lv_obj_t *row=sdcard->lvnd_rows[r];
+        uint32_t idx=sdcard->top + r;
+
+        if(sdcard->missing && r==0) {
+            lv_label_set_text_static(row, "No SD card");
+        } else if(sdcard->done && sdcard->total==0 && r==0) {
+            lv_label_set_text_static(row, "Empty");
+        } else if(idx >= sdcard->total) {
+            lv_label_set_text_static(row, "");
+        } else if(idx >= sdcard->window_first && idx - sdcard->window_first < sdcard->window_loaded) {
+            lv_label_set_text(row, sdcard->names[idx - sdcard->window_first]);
+        } else {
+            lv_label_set_text_static(row, "...");
+        }
+
+        if(idx==sdcard->cursor && idx < sdcard->total) {
+            lv_obj_add_state(row, LV_STATE_FOCUSED);
+        } else {
+            lv_obj_clear_state(row, LV_STATE_FOCUSED);
+        }
+    }
+
+    if(sdcard->total) {
+        char title[32];
+        snprintf(title, sizeof(title), LV_SYMBOL_SD_CARD " %u/%u%s",
+                 sdcard->cursor + 1, sdcard->total, sdcard->done ? "" : "+");
+        gui_set_menu_title(title);
+    }
+}
+
+// Move the window of names so it covers the visible rows. Call with the GUI locked
+static void sdcard_follow(sdcard_scr_t *sdcard) {
+    if(sdcard->top >= sdcard->window_first
+       && sdcard->top + SDCARD_ROWS <= sdcard->window_first + SDCARD_WINDOW) {
+        return;
+    }
+
+    // Centre the window on the visible rows and ask the task to fill it
+    uint32_t margin=(SDCARD_WINDOW - SDCARD_ROWS) / 2;
+    sdcard->window_first=sdcard->top > margin ? sdcard->top - margin : 0;
+    sdcard->window_loaded=0;
+    sdcard->want=sdcard->window_first;
+    sdcard->want_gen++;
+    xTaskNotifyGive(sdcard->task);
+}
+
+// Runs on the UI task. The screen may have been replaced since the page was posted
+static void sdcard_page_cb(void *ctx, uintptr_t arg) {
+    if(active_scr != (panel_t *)ctx) return;
+    sdcard_scr_t *sdcard = (sdcard_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(sdcard, SDCARD_SCR_MAGIC, TAG, "page");
+    sdcard_page_t *page=&sdcard->page;
+
+    // Pages for a window which has since moved only carry the count,
+    // which restarts from 0 each time the directory is re-read
+    if(page->total > sdcard->total) {
+        sdcard->total=page->total;
+    }
+    sdcard->done|=page->done;
+    sdcard->missing=page->missing;
+    if(page->gen==sdcard->want_gen) {
+        for(int i=0; i<page->count; i++) {
+            uint32_t slot=page->first + i - sdcard->window_first;
+            if(slot < SDCARD_WINDOW) {
+                memcpy(sdcard->names[slot], page->names[i], SDCARD_NAME_LEN);
+                sdcard->window_loaded=slot + 1;
+            }
+        }
+    }
+    sdcard_show_rows(sdcard);
+
+    sdcard->page_busy=false;
+    xTaskNotifyGive(sdcard->task);
+}
+
+// Hand the page to the UI task and wait until it has been read
+static void sdcard_send_page(sdcard_scr_t *sdcard) {
+    sdcard->page_busy=true;
+    while(!sdcard->quit && ui_post(sdcard_page_cb, sdcard, 0)!=ESP_OK) {
+        ESP_LOGW(TAG, "UI busy, retrying");
+    }
+    while(!sdcard->quit && sdcard->page_busy) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    sdcard->page.count=0;
+}
+
+// Reads the directory in the background, sending the names in the
+// wanted window to the UI a page at a time along with the running count
+static void sdcard_list_task(void *arg) {
+    sdcard_scr_t *sdcard = (sdcard_scr_t *)arg;
+    sdcard_page_t *page=&sdcard->page;
+    DIR *dir=opendir(SDCARD_ROOT);
+    uint32_t done_gen=0;
+
+    while(!sdcard->quit) {
+        uint32_t gen=sdcard->want_gen;
+        uint32_t want=sdcard->want;
+        uint32_t index=0;
+        struct dirent *entry;
+
+        page->gen=gen;
+        page->count=0;
+        page->missing=dir==NULL;
+        page->done=false;
+
+        if(dir) {
+            rewinddir(dir);
+        }
+        while(dir && !sdcard->quit && gen==sdcard->want_gen && (entry=readdir(dir))) {
+            if(index >= want && index - want < SDCARD_WINDOW) {
+                if(page->count==0) {
+                    page->first=index;
+                }
+                strlcpy(page->names[page->count++], entry->d_name, SDCARD_NAME_LEN);
+            }
+            index++;
+            if(page->count==SDCARD_PAGE || (index % SDCARD_PROGRESS)==0) {
+                page->total=index;
+                sdcard_send_page(sdcard);
+            }
+        }
+
+        if(!sdcard->quit && gen==sdcard->want_gen) {
+            page->total=index;
+            page->done=true;
+            sdcard_send_page(sdcard);
+            ESP_LOGI(TAG, "%u entries, window at %u", index, want);
+            done_gen=gen;
+        }
+
+        // Sleep until the list scrolls out of the window or the screen closes
+        while(!sdcard->quit && sdcard->want_gen==done_gen) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+
+    if(dir) {
+        closedir(dir);
+    }
+    xSemaphoreGive(sdcard->task_done);
+    vTaskDelete(NULL);
+}
+
+// Runs on the UI task. The screen may have been left since the click was posted
+static void sdcard_menu_click(void *ctx, uintptr_t arg)
+{
+    if(active_scr != (panel_t *)ctx) return;
+    sdcard_scr_t *col = (sdcard_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(col, SDCARD_SCR_MAGIC, TAG, "click");
+
+    if(col->scr.handlers_installed) {
+        sdcard_unreg_handlers(col);
+    }
+
+    active_scr=gui_panel_get(main_scr_init);
+    gui_set_panel(gui, active_scr);
+}
+
 // Handle a selection on the col menu
 static void sdcard_menu_click_cb(void *arg, void *data)
 {
@@ -71,17 +294,67 @@ static void sdcard_menu_click_cb(void *arg, void *data)
     sdcard_scr_t *col = (sdcard_scr_t *)data;
     STRUCT_CHECK_MAGIC(col, SDCARD_SCR_MAGIC, TAG, "click");
 
-    LOCK_GUI;
+    ui_post(sdcard_menu_click, col, 0);
+}
 
-    if(col->scr.handlers_installed) {
-        sdcard_unreg_handlers(col);
+// Runs on the UI task, moves the cursor up or down a row
+static void sdcard_knob(void *ctx, uintptr_t step)
+{
+    if(active_scr != (panel_t *)ctx) return;
+    sdcard_scr_t *sdcard = (sdcard_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(sdcard, SDCARD_SCR_MAGIC, TAG, "knob");
+
+    if((intptr_t)step < 0 && sdcard->cursor > 0) {
+        sdcard->cursor--;
+        if(sdcard->cursor < sdcard->top) {
+            sdcard->top=sdcard->cursor;
+            sdcard_follow(sdcard);
+        }
+        sdcard_show_rows(sdcard);
+    } else if((intptr_t)step > 0 && sdcard->cursor + 1 < sdcard->total) {
+        sdcard->cursor++;
+        if(sdcard->cursor >= sdcard->top + SDCARD_ROWS) {
+            sdcard->top=sdcard->cursor - SDCARD_ROWS + 1;
+            sdcard_follow(sdcard);
+        }
+        sdcard_show_rows(sdcard);
     }
+}
 
-    active_scr=main_scr_init();
-    gui_set_panel(gui, active_scr);
+static void sdcard_knob_left_cb(void *arg, void *data)
+{
+    ACTION();
+    sdcard_scr_t *sdcard = (sdcard_scr_t *)data;
+#ifdef STRUCT_MAGIC
+#ifdef BAD_KNOB_USR_DATA
+    if(sdcard->scr.magic!=SDCARD_SCR_MAGIC) {
+        // Knob library is buggy
+        void **usr_data = (void**)data;
+        sdcard = (sdcard_scr_t *)usr_data[KNOB_LEFT];
+    }
+#endif
+    STRUCT_CHECK_MAGIC(sdcard, SDCARD_SCR_MAGIC, TAG, "left");
+#endif
 
-    UNLOCK_GUI;
+    ui_post(sdcard_knob, sdcard, (uintptr_t)-1);
+}
 
+static void sdcard_knob_right_cb(void *arg, void *data)
+{
+    ACTION();
+    sdcard_scr_t *sdcard = (sdcard_scr_t *)data;
+#ifdef STRUCT_MAGIC
+#ifdef BAD_KNOB_USR_DATA
+    if(sdcard->scr.magic!=SDCARD_SCR_MAGIC) {
+        // Knob library is buggy
+        void **usr_data = (void**)data;
+        sdcard = (sdcard_scr_t *)usr_data[KNOB_RIGHT];
+    }
+#endif
+    STRUCT_CHECK_MAGIC(sdcard, SDCARD_SCR_MAGIC, TAG, "right");
+#endif
+
+    ui_post(sdcard_knob, sdcard, 1);
 }
 
 static const lv_style_const_prop_t sdcard_style_props[] = {
@@ -94,6 +367,21 @@ static const lv_style_const_prop_t sdcard_style_props[] = {
 };
 LV_STYLE_CONST_INIT(sdcard_style, sdcard_style_props);
 
+static const lv_style_const_prop_t row_style_props[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_LEFT),
+    LV_STYLE_CONST_PAD_LEFT(4),
+    {.prop=0,.value={.num=0}}
+};
+static LV_STYLE_CONST_INIT(row_style, row_style_props);
+
+static const lv_style_const_prop_t focus_style_props[] = {
+    LV_STYLE_CONST_OUTLINE_COLOR(blue),
+    LV_STYLE_CONST_OUTLINE_WIDTH(2),
+    LV_STYLE_CONST_OUTLINE_OPA(LV_OPA_COVER),
+    {.prop=0,.value={.num=0}}
+};
+static LV_STYLE_CONST_INIT(focus_style, focus_style_props);
+
 static void sdcard_lv_init(panel_t *panel, lv_obj_t *parent)
 {
     sdcard_scr_t *sdcard = (sdcard_scr_t *)panel;
@@ -113,20 +401,20 @@ static void sdcard_lv_init(panel_t *panel, lv_obj_t *parent)
     lv_obj_add_style(cont_row, (lv_style_t *)&sdcard_style, LV_PART_MAIN);
     lv_obj_set_flex_align(cont_row, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
 
-    DIR *root=opendir("/sdcard/");
-    struct dirent *entry;
-
-    while((entry=readdir(root)))
-    {
-        ESP_LOGI(TAG, "file %s", entry->d_name);
-        /*Add items to the column*/
+    // Only enough labels to fill the screen, the directory is read in the
+    // background and the labels show whichever names are scrolled to
+    for(int r=0; r<SDCARD_ROWS; r++) {
         lv_obj_t * label = lv_label_create(cont_row);
-        lv_label_set_text(label, entry->d_name);
-        lv_obj_set_style_bg_opa(label, LV_OPA_COVER, LV_PART_MAIN);
-        lv_obj_set_style_bg_color(label, black, LV_PART_MAIN);
+        lv_obj_set_width(label, lv_pct(100));
+        lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+        lv_obj_add_style(label, (lv_style_t *)&row_style, LV_PART_MAIN);
+        lv_obj_add_style(label, (lv_style_t *)&focus_style, LV_PART_MAIN | LV_STATE_FOCUSED);
+        lv_label_set_text_static(label, r==0 ? "Reading ..." : "");
+        sdcard->lvnd_rows[r]=label;
     }
 
-    closedir(root);
+    sdcard->task_done=xSemaphoreCreateBinary();
+    xTaskCreate(sdcard_list_task, "sdcard_list", 3072, sdcard, 1, &sdcard->task);
 
     sdcard_reg_handlers(sdcard);
 
@@ -138,6 +426,7 @@ panel_t *sdcard_scr_init() {
     ESP_LOGI(TAG,"Init");
     sdcard_scr_t *sdcard = calloc(1, sizeof(sdcard_scr_t));
     STRUCT_INIT_MAGIC(sdcard, SDCARD_SCR_MAGIC);
+    sdcard->scr.name = TAG;
     sdcard->scr.free = sdcard_free;
     sdcard->scr.goto_sleep = sdcard_sleep;
     sdcard->scr.create_content = sdcard_lv_init;
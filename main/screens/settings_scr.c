@@ -54,17 +54,13 @@ static void settings_free(panel_t *data) {
     ESP_LOGI(TAG,"Free done");
 }
 
-// Handle a selection on the settings menu
-static void settings_menu_click_cb(void *arg, void *data)
+// Runs on the UI task. The screen may have been left since the click was posted
+static void settings_menu_click(void *ctx, uintptr_t arg)
 {
-    ACTION();
-    assert(data);
-    settings_scr_t *settings = (settings_scr_t *)data;
-    ESP_LOGI(TAG,"Click");
+    if(active_scr != (panel_t *)ctx) return;
+    settings_scr_t *settings = (settings_scr_t *)ctx;
     STRUCT_CHECK_MAGIC(settings, SETTINGS_SCR_MAGIC, TAG, "click");
 
-    LOCK_GUI;
-
     // Degregister our event handlers
     ESP_LOGI(TAG,"Deregister");
 
@@ -75,7 +71,7 @@ static void settings_menu_click_cb(void *arg, void *data)
     ESP_LOGI(TAG,"Screen %d", settings->current);
     switch(settings->current) {
     case SETTINGS_MENU_HOME:
-        active_scr = main_scr_init();
+        active_scr = gui_panel_get(main_scr_init);
         gui_set_panel(gui, active_scr);
         break;
 //    case SETTINGS_MENU_IMAGE:
@@ -83,18 +79,42 @@ static void settings_menu_click_cb(void *arg, void *data)
 //        break;
 #ifdef CONFIG_TEMBED_INIT_WIFI
     case SETTINGS_MENU_WIFI_SCAN:
-        active_scr = wifi_scr_init();
+        active_scr = gui_panel_get(wifi_scr_init);
         gui_set_panel(gui, active_scr);
         break;
 #endif
     case SETTINGS_MENU_SMART:
-        active_scr = smart_scr_init();
+        active_scr = gui_panel_get(smart_scr_init);
         gui_set_panel(gui, active_scr);
         break;
     default: assert(false); // Panic
     }
+}
 
-    UNLOCK_GUI;
+// Handle a selection on the settings menu
+static void settings_menu_click_cb(void *arg, void *data)
+{
+    ACTION();
+    assert(data);
+    settings_scr_t *settings = (settings_scr_t *)data;
+    ESP_LOGI(TAG,"Click");
+    STRUCT_CHECK_MAGIC(settings, SETTINGS_SCR_MAGIC, TAG, "click");
+
+    ui_post(settings_menu_click, settings, 0);
+}
+
+// Runs on the UI task, moves the focus by step
+static void settings_menu_knob(void *ctx, uintptr_t step)
+{
+    if(active_scr != (panel_t *)ctx) return;
+    settings_scr_t *settings = (settings_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(settings, SETTINGS_SCR_MAGIC, TAG, "knob");
+
+    lv_obj_clear_state(settings->lvnd_widgets[settings->current], LV_STATE_FOCUSED);
+    settings->current += (intptr_t)step;
+    if(settings->current < 0) settings->current=SETTINGS_MENU_MAX;
+    if(settings->current > SETTINGS_MENU_MAX) settings->current=0;
+    lv_obj_add_state(settings->lvnd_widgets[settings->current], LV_STATE_FOCUSED);
 }
 
 static void settings_menu_knob_left_cb(void *arg, void *data)
@@ -114,15 +134,7 @@ static void settings_menu_knob_left_cb(void *arg, void *data)
 #endif
     ESP_LOGD(TAG,"left");
 
-    LOCK_GUI;
-
-    lv_obj_clear_state(settings->lvnd_widgets[settings->current], LV_STATE_FOCUSED);
-    settings->current--;
-    if(settings->current < 0) settings->current=SETTINGS_MENU_MAX;
-    lv_obj_add_state(settings->lvnd_widgets[settings->current], LV_STATE_FOCUSED);
-
-    UNLOCK_GUI;
-    ESP_LOGD(TAG,"done");
+    ui_post(settings_menu_knob, settings, (uintptr_t)-1);
 }
 
 static void settings_menu_knob_right_cb(void *arg, void *data)
@@ -143,16 +155,7 @@ static void settings_menu_knob_right_cb(void *arg, void *data)
 
     ESP_LOGD(TAG,"right");
 
-    LOCK_GUI;
-
-    lv_obj_clear_state(settings->lvnd_widgets[settings->current], LV_STATE_FOCUSED);
-    settings->current++;
-    if(settings->current > SETTINGS_MENU_MAX) settings->current=0;
-    lv_obj_add_state(settings->lvnd_widgets[settings->current], LV_STATE_FOCUSED);
-
-    UNLOCK_GUI;
-
-    ESP_LOGD(TAG,"done");
+    ui_post(settings_menu_knob, settings, 1);
 }
 
 static void settings_menu_knob_event(void *arg, void *data) {
@@ -262,15 +265,37 @@ esp_err_t settings_sleep(panel_t *data) {
     return ESP_OK;
 }
 
+// Hidden and kept for reuse
+static void settings_suspend(panel_t *data) {
+    settings_scr_t *settings = (settings_scr_t *)data;
+    STRUCT_CHECK_MAGIC(settings, SETTINGS_SCR_MAGIC, TAG, "suspend");
+
+    if(settings->scr.handlers_installed) {
+        settings_unreg_handlers(settings);
+    }
+}
+
+// Shown again from the panel cache
+static void settings_resume(panel_t *data) {
+    settings_scr_t *settings = (settings_scr_t *)data;
+    STRUCT_CHECK_MAGIC(settings, SETTINGS_SCR_MAGIC, TAG, "resume");
+
+    gui_set_menu_title((char *)"Settings Menu");
+    settings_reg_handlers(settings);
+}
+
 // Select and display the settings menu screen
 panel_t *settings_scr_init() {
     ESP_LOGI(TAG,"Init");
 
     settings_scr_t *settings = calloc(1, sizeof(settings_scr_t));
     STRUCT_INIT_MAGIC(settings, SETTINGS_SCR_MAGIC);
+    settings->scr.name = TAG;
     settings->scr.free = settings_free;
     settings->scr.goto_sleep = settings_sleep;
     settings->scr.create_content = settings_lv_init;
+    settings->scr.suspend = settings_suspend;
+    settings->scr.resume = settings_resume;
     settings->current=SETTINGS_MENU_HOME;
 
     ESP_LOGI(TAG,"Done");
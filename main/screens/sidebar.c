@@ -204,18 +204,17 @@ sidebar_t *sidebar_init(gui_t *gui) {
 
 lv_anim_t wifi_scanning;
 
-// TODO: Make WiFi application state a proper state machine
-void sidebar_wifi_state(sidebar_t *sidebar, wifi_state_t state) {
+// Runs on the UI task
+static void sidebar_wifi_state_cb(void *ctx, uintptr_t arg) {
+    sidebar_t *sidebar = (sidebar_t *)ctx;
+    wifi_state_t state = (wifi_state_t)arg;
     STRUCT_CHECK_MAGIC(sidebar, SIDEBAR_MAGIC, TAG, "wifi_state");
 
     ESP_LOGI(TAG, "Wifi State Change");
 
-    LOCK_GUI;
-
     if(sidebar->wifi_scanning) {
         if (state == WIFI_SCANNING) {
             // Same state, no change
-            UNLOCK_GUI;
             return;
         }
         lv_anim_del(sidebar->wifi, set_text_color);
@@ -248,6 +247,10 @@ void sidebar_wifi_state(sidebar_t *sidebar, wifi_state_t state) {
         break;
     }
     };
+}
 
-    UNLOCK_GUI;
+// TODO: Make WiFi application state a proper state machine
+void sidebar_wifi_state(sidebar_t *sidebar, wifi_state_t state) {
+    STRUCT_CHECK_MAGIC(sidebar, SIDEBAR_MAGIC, TAG, "wifi_state");
+    ui_post(sidebar_wifi_state_cb, sidebar, state);
 }
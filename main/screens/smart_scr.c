@@ -134,6 +134,13 @@ esp_err_t smart_sleep(panel_t *data) {
     return ESP_OK;
 }
 
+// Runs on the UI task once connected
+static void smart_connected(void *ctx, uintptr_t arg)
+{
+    active_scr = gui_panel_get(main_scr_init);
+    gui_set_panel(gui, active_scr);
+}
+
 static void smartconfig_task(void * parm)
 {
     EventBits_t uxBits;
@@ -144,8 +151,7 @@ static void smartconfig_task(void * parm)
         uxBits = xEventGroupWaitBits(s_wifi_event_group, CONNECTED_BIT | ESPTOUCH_DONE_BIT, true, false, portMAX_DELAY);
         if(uxBits & CONNECTED_BIT) {
             ESP_LOGI(TAG, "WiFi Connected to ap");
-            active_scr = main_scr_init();
-            gui_set_panel(gui, active_scr);
+            ui_post(smart_connected, NULL, 0);
             continue;
         }
         if(uxBits & ESPTOUCH_DONE_BIT) {
@@ -173,17 +179,13 @@ static void smart_free(panel_t *data) {
     ESP_LOGI(TAG,"Free done");
 }
 
-// Handle a selection on the smart menu
-static void smart_menu_click_cb(void *arg, void *data)
+// Runs on the UI task. The screen may have been left since the click was posted
+static void smart_menu_click(void *ctx, uintptr_t arg)
 {
-    ACTION();
-    assert(data);
-    smart_scr_t *smart = (smart_scr_t *)data;
-    ESP_LOGI(TAG,"Click");
+    if(active_scr != (panel_t *)ctx) return;
+    smart_scr_t *smart = (smart_scr_t *)ctx;
     STRUCT_CHECK_MAGIC(smart, SMART_SCR_MAGIC, TAG, "click");
 
-    LOCK_GUI;
-
     // Degregister our event handlers
     ESP_LOGI(TAG,"Deregister");
 
@@ -192,11 +194,20 @@ static void smart_menu_click_cb(void *arg, void *data)
     }
 
     // FIXME: Need to not do this if SMART is still running
-    active_scr = main_scr_init();
+    active_scr = gui_panel_get(main_scr_init);
     gui_set_panel(gui, active_scr);
+}
 
-    UNLOCK_GUI;
+// Handle a selection on the smart menu
+static void smart_menu_click_cb(void *arg, void *data)
+{
+    ACTION();
+    assert(data);
+    smart_scr_t *smart = (smart_scr_t *)data;
+    ESP_LOGI(TAG,"Click");
+    STRUCT_CHECK_MAGIC(smart, SMART_SCR_MAGIC, TAG, "click");
 
+    ui_post(smart_menu_click, smart, 0);
 }
 
 static void smart_menu_knob_left_cb(void *arg, void *data)
@@ -275,6 +286,7 @@ panel_t *smart_scr_init() {
 
     smart_scr_t *smart = calloc(1, sizeof(smart_scr_t));
     STRUCT_INIT_MAGIC(smart, SMART_SCR_MAGIC);
+    smart->scr.name = TAG;
     smart->scr.free = smart_free;
     smart->scr.goto_sleep = smart_sleep;
     smart->scr.create_content = smart_lv_init;
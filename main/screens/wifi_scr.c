@@ -118,16 +118,13 @@ static void display_pw(wifi_scr_t *wifi) {
     }
 }
 
-// Handle a selection of a wifi ssid
-static void wifi_ssid_click_cb(void *arg, void *data)
+// Runs on the UI task. The screen may have been left since the click was posted
+static void wifi_ssid_click(void *ctx, uintptr_t arg)
 {
-    ACTION();
-
-    wifi_scr_t * wifi = (wifi_scr_t *)data;
+    if(active_scr != (panel_t *)ctx) return;
+    wifi_scr_t * wifi = (wifi_scr_t *)ctx;
     STRUCT_CHECK_MAGIC(wifi, WIFI_SCR_MAGIC, TAG, "click");
 
-    LOCK_GUI;
-
     switch(wifi->state) {
     case ENTER_PW: {
         switch(wifi->current_char) {
@@ -148,7 +145,7 @@ static void wifi_ssid_click_cb(void *arg, void *data)
 
             xTaskCreate(wifi_connect_task,"wifi_connect", 4096, NULL, 1, NULL);
 
-            active_scr = main_scr_init();
+            active_scr = gui_panel_get(main_scr_init);
             gui_set_panel(gui, active_scr);
             break;
         }
@@ -177,48 +174,76 @@ static void wifi_ssid_click_cb(void *arg, void *data)
     case SCAN: wifi->state = SELECT_AP; display_pw(wifi); break;
     case SELECT_AP: wifi->state = ENTER_PW; display_pw(wifi); break;
     }
-
-    UNLOCK_GUI;
-
 }
 
-static void wifi_ssid_knob_left_cb(void *arg, void *data)
+// Handle a selection of a wifi ssid
+static void wifi_ssid_click_cb(void *arg, void *data)
 {
     ACTION();
+
     wifi_scr_t * wifi = (wifi_scr_t *)data;
-#ifdef STRUCT_MAGIC
-#ifdef BAD_KNOB_USR_DATA
-    if(wifi->scr.magic!=WIFI_SCR_MAGIC) {
-        // Knob library is buggy
-        void** usr_data = (void**)data;
-        wifi = (wifi_scr_t *)usr_data[KNOB_LEFT];
-    }
-#endif
-    STRUCT_CHECK_MAGIC(wifi, WIFI_SCR_MAGIC, TAG, "left");
-#endif
+    STRUCT_CHECK_MAGIC(wifi, WIFI_SCR_MAGIC, TAG, "click");
 
-    LOCK_GUI;
+    ui_post(wifi_ssid_click, wifi, 0);
+}
+
+// Runs on the UI task, steps through the APs or the password characters
+static void wifi_ssid_knob(void *ctx, uintptr_t step)
+{
+    if(active_scr != (panel_t *)ctx) return;
+    wifi_scr_t * wifi = (wifi_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(wifi, WIFI_SCR_MAGIC, TAG, "knob");
+    bool left = (intptr_t)step < 0;
 
     switch(wifi->state) {
     case SCAN: break;
     case SELECT_AP: {
-        wifi->ap_index--;
-        if(wifi->ap_index < 0) wifi->ap_index=wifi->ap_count - 1;
+        if(left) {
+            wifi->ap_index--;
+            if(wifi->ap_index < 0) wifi->ap_index=wifi->ap_count - 1;
+        } else {
+            wifi->ap_index++;
+            if(wifi->ap_index >= wifi->ap_count) wifi->ap_index=0;
+        }
         lv_label_set_text(wifi->ap_label, (const char *)wifi->aps[wifi->ap_index].ssid);
         break;
     }
     case ENTER_PW: {
-        if(wifi->current_char == 0) {
-            wifi->current_char = strlen(valid_chars) - 1;
+        if(left) {
+            if(wifi->current_char == 0) {
+                wifi->current_char = strlen(valid_chars) - 1;
+            } else {
+                wifi->current_char--;
+            }
         } else {
-            wifi->current_char--;
+            if(wifi->current_char == (strlen(valid_chars)-1)) {
+                wifi->current_char = 0;
+            } else {
+                wifi->current_char++;
+            }
         }
         display_pw(wifi);
         break;
     }
     }
+}
 
-    UNLOCK_GUI;
+static void wifi_ssid_knob_left_cb(void *arg, void *data)
+{
+    ACTION();
+    wifi_scr_t * wifi = (wifi_scr_t *)data;
+#ifdef STRUCT_MAGIC
+#ifdef BAD_KNOB_USR_DATA
+    if(wifi->scr.magic!=WIFI_SCR_MAGIC) {
+        // Knob library is buggy
+        void** usr_data = (void**)data;
+        wifi = (wifi_scr_t *)usr_data[KNOB_LEFT];
+    }
+#endif
+    STRUCT_CHECK_MAGIC(wifi, WIFI_SCR_MAGIC, TAG, "left");
+#endif
+
+    ui_post(wifi_ssid_knob, wifi, (uintptr_t)-1);
 }
 
 static void wifi_ssid_knob_right_cb(void *arg, void *data)
@@ -237,28 +262,25 @@ static void wifi_ssid_knob_right_cb(void *arg, void *data)
     STRUCT_CHECK_MAGIC(wifi, WIFI_SCR_MAGIC, TAG, "right");
 #endif
 
-    LOCK_GUI;
+    ui_post(wifi_ssid_knob, wifi, 1);
+}
 
-    switch(wifi->state) {
-    case SCAN: break;
-    case SELECT_AP: {
-        wifi->ap_index++;
-        if(wifi->ap_index >= wifi->ap_count) wifi->ap_index=0;
-        lv_label_set_text(wifi->ap_label, (const char *)wifi->aps[wifi->ap_index].ssid);
-        break;
-    }
-    case ENTER_PW: {
-        if(wifi->current_char == (strlen(valid_chars)-1)) {
-            wifi->current_char = 0;
-        } else {
-            wifi->current_char++;
-        }
-        display_pw(wifi);
-        break;
-    }
+// Runs on the UI task once the scan has finished
+static void wifi_scan_done(void *ctx, uintptr_t arg)
+{
+    wifi_scr_t * wifi = (wifi_scr_t *)ctx;
+    STRUCT_CHECK_MAGIC(wifi, WIFI_SCR_MAGIC, TAG, "scan_done");
+
+    if(wifi->ap_count) {
+        lv_label_set_text(wifi->ap_label, (const char *)wifi->aps[0].ssid);
+    } else {
+        lv_label_set_text_static(wifi->ap_label,"NO WIFI FOUND!");
     }
 
-    UNLOCK_GUI;
+    wifi->state=SELECT_AP;
+    display_pw(wifi);
+
+    wifi_reg_handlers(wifi);
 }
 
 void wifi_scan_task( void *pvParameters )
@@ -275,21 +297,17 @@ void wifi_scan_task( void *pvParameters )
         free(wifi->aps);
     }
 
-    ESP_ERROR_CHECK(esp_event_post_to(app_event_loop, APP_EVENT, APP_EVENT_WIFI_SCAN, NULL, 0, (TickType_t)100));
+    ESP_ERROR_CHECK(app_event_post(APP_EVENT_WIFI_SCAN, NULL, 0, (TickType_t)100));
     wifi->aps=wifi_scan(&wifi->ap_count);
-    ESP_ERROR_CHECK(esp_event_post_to(app_event_loop, APP_EVENT, APP_EVENT_WIFI_SCAN_DONE, NULL, 0, (TickType_t)100));
+    ESP_ERROR_CHECK(app_event_post(APP_EVENT_WIFI_SCAN_DONE, NULL, 0, (TickType_t)100));
 
-    if(wifi->ap_count) {
-        lv_label_set_text(wifi->ap_label, (const char *)wifi->aps[0].ssid);
-    } else {
-        lv_label_set_text_static(wifi->ap_label,"NO WIFI FOUND!");
+    // The knob handlers stay unregistered until the results are shown, so the
+    // screen can't be left while the scan is running. Keep trying, as the
+    // screen is stuck until this gets through
+    while(ui_post(wifi_scan_done, wifi, 0) != ESP_OK) {
+        ESP_LOGW(TAG, "UI busy, retrying");
     }
 
-    wifi->state=SELECT_AP;
-    display_pw(wifi);
-
-    wifi_reg_handlers(wifi);
-
     /* Tasks must not attempt to return from their implementing
        function or otherwise exit.  In newer FreeRTOS port
        attempting to do so will result in an configASSERT() being
@@ -386,6 +404,7 @@ panel_t *wifi_scr_init() {
     wifi_scr_t *wifi = calloc(1, sizeof(wifi_scr_t));
     STRUCT_INIT_MAGIC(wifi, WIFI_SCR_MAGIC);
 
+    wifi->scr.name = TAG;
     wifi->scr.free = wifi_free;
     wifi->scr.goto_sleep = wifi_sleep;
     wifi->scr.create_content = wifi_lv_init;
@@ -0,0 +1,465 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
+#include "lvgl.h"
+#include "sd_cache.h"
+
+static const char *TAG="sd_cache";
+
+#define SD_CACHE_ROOT "/sdcard"
+#define SD_CACHE_BLOCK (CONFIG_APP_SD_CACHE_BLOCK_KB * 1024)
+#define SD_CACHE_NONE (-1)
+#define SD_CACHE_OPEN_MAX 16 // Files open beyond those with cached blocks
+
+// The full identity of a file with blocks in the cache or open, which blocks
+// point to. A file which changes gets a new entry, so its old blocks are
+// never matched and age out
+typedef struct sd_cache_ident {
+    uint32_t key; // Hash of the rest to speed up the search, 0 while unused
+    uint16_t refs; // Open handles
+    uint16_t blocks; // Cached blocks
+    size_t size;
+    time_t mtime;
+    char *path;
+} sd_cache_ident_t;
+
+typedef struct sd_cache_blk {
+    int16_t file; // Entry in idents, SD_CACHE_NONE while the block is unused
+    uint32_t index; // Block number within the file
+    uint32_t len; // Short for the last block of a file
+    int16_t newer, older; // LRU list
+    int16_t next; // Hash chain
+} sd_cache_blk_t;
+
+struct sd_cache_file {
+    int16_t file; // Entry in idents
+    int fd; // Opened on the first miss, a file held in RAM needs no handle
+    size_t size;
+    off_t pos;
+    uint32_t next_index; // Block a sequential reader asks for next
+};
+
+static SemaphoreHandle_t sd_cache_lock;
+static sd_cache_blk_t *blks;
+static uint8_t *blk_data; // PSRAM
+static uint8_t *staging; // DMA capable, reads land here first
+static int16_t *buckets;
+static sd_cache_ident_t *idents;
+static uint32_t nblocks, nbuckets, nidents, read_ahead;
+static int16_t newest, oldest;
+static sd_cache_stats_t sd_cache_stats;
+
+static inline uint8_t *blk_ptr(int16_t i) {
+    return blk_data + (size_t)i * SD_CACHE_BLOCK;
+}
+
+static inline uint32_t sd_cache_hash(int16_t file, uint32_t index) {
+    return (idents[file].key ^ (index * 0x9E3779B1u)) & (nbuckets - 1);
+}
+
+// FNV-1a of the path, mixed with the size and modification time
+static uint32_t sd_cache_key(const char *path, const struct stat *st) {
+    uint32_t h = 0x811C9DC5u;
+    for(const char *p=path; *p; p++) {
+        h = (h ^ (uint8_t)*p) * 0x01000193u;
+    }
+    h = (h ^ (uint32_t)st->st_size) * 0x01000193u;
+    h = (h ^ (uint32_t)st->st_mtime) * 0x01000193u;
+    return h ? h : 1;
+}
+
+static void lru_unlink(int16_t i) {
+    sd_cache_blk_t *b = &blks[i];
+    if(b->newer != SD_CACHE_NONE) blks[b->newer].older = b->older;
+    else newest = b->older;
+    if(b->older != SD_CACHE_NONE) blks[b->older].newer = b->newer;
+    else oldest = b->newer;
+}
+
+static void lru_push(int16_t i) {
+    blks[i].newer = SD_CACHE_NONE;
+    blks[i].older = newest;
+    if(newest != SD_CACHE_NONE) blks[newest].newer = i;
+    newest = i;
+    if(oldest == SD_CACHE_NONE) oldest = i;
+}
+
+static void lru_touch(int16_t i) {
+    if(newest == i) return;
+    lru_unlink(i);
+    lru_push(i);
+}
+
+// Free an entry nothing points to any more
+static void ident_release(int16_t file) {
+    sd_cache_ident_t *id = &idents[file];
+    if(id->refs || id->blocks) return;
+    free(id->path);
+    id->path = NULL;
+    id->key = 0;
+}
+
+// Find the entry for a file, or add one. Returns SD_CACHE_NONE if the table is full
+static int16_t ident_get(const char *path, const struct stat *st) {
+    uint32_t key = sd_cache_key(path, st);
+    int16_t free_slot = SD_CACHE_NONE;
+    for(uint32_t i=0; i<nidents; i++) {
+        sd_cache_ident_t *id = &idents[i];
+        if(!id->key) {
+            if(free_slot == SD_CACHE_NONE) free_slot = i;
+        } else if(id->key == key && id->size == (size_t)st->st_size && id->mtime == st->st_mtime &&
+                  strcmp(id->path, path) == 0) {
+            return i;
+        }
+    }
+    if(free_slot == SD_CACHE_NONE) return SD_CACHE_NONE;
+
+    sd_cache_ident_t *id = &idents[free_slot];
+    id->path = strdup(path);
+    if(!id->path) return SD_CACHE_NONE;
+    id->key = key;
+    id->size = st->st_size;
+    id->mtime = st->st_mtime;
+    id->refs = 0;
+    id->blocks = 0;
+    return free_slot;
+}
+
+static int16_t sd_cache_find(int16_t file, uint32_t index) {
+    for(int16_t i=buckets[sd_cache_hash(file, index)]; i!=SD_CACHE_NONE; i=blks[i].next) {
+        if(blks[i].file == file && blks[i].index == index) return i;
+    }
+    return SD_CACHE_NONE;
+}
+
+static void sd_cache_unhash(int16_t i) {
+    int16_t file = blks[i].file;
+    int16_t *link = &buckets[sd_cache_hash(file, blks[i].index)];
+    while(*link != i) link = &blks[*link].next;
+    *link = blks[i].next;
+    blks[i].file = SD_CACHE_NONE;
+    idents[file].blocks--;
+    ident_release(file);
+    sd_cache_stats.used--;
+}
+
+// Take the least recently used block for a new one
+static int16_t sd_cache_take(int16_t file, uint32_t index) {
+    int16_t i = oldest;
+    if(blks[i].file != SD_CACHE_NONE) {
+        sd_cache_unhash(i);
+        sd_cache_stats.evictions++;
+    }
+    uint32_t h = sd_cache_hash(file, index);
+    blks[i].file = file;
+    idents[file].blocks++;
+    blks[i].index = index;
+    blks[i].next = buckets[h];
+    buckets[h] = i;
+    sd_cache_stats.used++;
+    lru_touch(i);
+    return i;
+}
+
+// Read a missing block from the card. Sequential readers get the blocks
+// after it as well, up to the next one already cached
+static int16_t sd_cache_fill(sd_cache_file_t *f, uint32_t index) {
+    if(f->fd < 0) {
+        f->fd = open(idents[f->file].path, O_RDONLY);
+        if(f->fd < 0) return SD_CACHE_NONE;
+    }
+
+    uint32_t last = (f->size - 1) / SD_CACHE_BLOCK;
+    uint32_t count = 1;
+    if(index == f->next_index) {
+        while(count < read_ahead && index + count <= last && sd_cache_find(f->file, index + count) == SD_CACHE_NONE) {
+            count++;
+        }
+    }
+
+    int64_t start = esp_timer_get_time();
+    ssize_t got = -1;
+    if(lseek(f->fd, (off_t)index * SD_CACHE_BLOCK, SEEK_SET) >= 0) {
+        got = read(f->fd, staging, count * SD_CACHE_BLOCK);
+    }
+    sd_cache_stats.read_us += esp_timer_get_time() - start;
+    if(got <= 0) return SD_CACHE_NONE;
+    sd_cache_stats.card_bytes += got;
+    sd_cache_stats.misses++;
+
+    // Store the later blocks first, so the one asked for is the newest
+    int16_t first = SD_CACHE_NONE;
+    for(int n=(got - 1) / SD_CACHE_BLOCK; n>=0; n--) {
+        int16_t i = sd_cache_take(f->file, index + n);
+        blks[i].len = got - n * SD_CACHE_BLOCK < SD_CACHE_BLOCK ? got - n * SD_CACHE_BLOCK : SD_CACHE_BLOCK;
+        memcpy(blk_ptr(i), staging + n * SD_CACHE_BLOCK, blks[i].len);
+        if(n) sd_cache_stats.read_ahead++;
+        first = i;
+    }
+    return first;
+}
+
+sd_cache_file_t *sd_cache_open(const char *path) {
+    struct stat st;
+    if(!blks || stat(path, &st) != 0 || S_ISDIR(st.st_mode)) return NULL;
+
+    sd_cache_file_t *f = malloc(sizeof(sd_cache_file_t));
+    if(!f) return NULL;
+
+    xSemaphoreTake(sd_cache_lock, portMAX_DELAY);
+    f->file = ident_get(path, &st);
+    if(f->file != SD_CACHE_NONE) idents[f->file].refs++;
+    xSemaphoreGive(sd_cache_lock);
+    if(f->file == SD_CACHE_NONE) {
+        ESP_LOGW(TAG, "%s: too many files open", path);
+        free(f);
+        return NULL;
+    }
+
+    f->fd = -1;
+    f->size = st.st_size;
+    f->pos = 0;
+    f->next_index = 0;
+    return f;
+}
+
+size_t sd_cache_read(sd_cache_file_t *f, void *buf, size_t len) {
+    size_t done = 0;
+
+    xSemaphoreTake(sd_cache_lock, portMAX_DELAY);
+    while(done < len && f->pos < f->size) {
+        uint32_t index = f->pos / SD_CACHE_BLOCK;
+        uint32_t ofs = f->pos % SD_CACHE_BLOCK;
+        int16_t i = sd_cache_find(f->file, index);
+        if(i == SD_CACHE_NONE) {
+            i = sd_cache_fill(f, index);
+            if(i == SD_CACHE_NONE) break;
+        } else {
+            sd_cache_stats.hits++;
+            lru_touch(i);
+        }
+        if(ofs >= blks[i].len) break;
+
+        size_t n = blks[i].len - ofs;
+        if(n > len - done) n = len - done;
+        memcpy((uint8_t *)buf + done, blk_ptr(i) + ofs, n);
+        done += n;
+        f->pos += n;
+        f->next_index = index + 1;
+    }
+    sd_cache_stats.served_bytes += done;
+    xSemaphoreGive(sd_cache_lock);
+    return done;
+}
+
+int sd_cache_seek(sd_cache_file_t *f, off_t offset, int whence) {
+    off_t pos = whence == SEEK_END ? (off_t)f->size + offset : whence == SEEK_CUR ? f->pos + offset : offset;
+    if(pos < 0) return -1;
+    f->pos = pos;
+    return 0;
+}
+
+off_t sd_cache_tell(sd_cache_file_t *f) {
+    return f->pos;
+}
+
+size_t sd_cache_size(sd_cache_file_t *f) {
+    return f->size;
+}
+
+void sd_cache_close(sd_cache_file_t *f) {
+    if(!f) return;
+    if(f->fd >= 0) close(f->fd);
+    xSemaphoreTake(sd_cache_lock, portMAX_DELAY);
+    idents[f->file].refs--;
+    ident_release(f->file);
+    xSemaphoreGive(sd_cache_lock);
+    free(f);
+}
+
+void sd_cache_clear(void) {
+    xSemaphoreTake(sd_cache_lock, portMAX_DELAY);
+    for(uint32_t i=0; i<nbuckets; i++) buckets[i] = SD_CACHE_NONE;
+    for(uint32_t i=0; i<nblocks; i++) blks[i].file = SD_CACHE_NONE;
+    for(uint32_t i=0; i<nidents; i++) {
+        if(idents[i].key) {
+            idents[i].blocks = 0;
+            ident_release(i);
+        }
+    }
+    sd_cache_stats.used = 0;
+    xSemaphoreGive(sd_cache_lock);
+}
+
+void sd_cache_get_stats(sd_cache_stats_t *stats) {
+    xSemaphoreTake(sd_cache_lock, portMAX_DELAY);
+    *stats = sd_cache_stats;
+    xSemaphoreGive(sd_cache_lock);
+}
+
+// LVGL drive
+
+static void *fs_open_cb(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode) {
+    if(mode != LV_FS_MODE_RD) return NULL; // Read only
+    char full[128];
+    snprintf(full, sizeof(full), SD_CACHE_ROOT "%s%s", path[0] == '/' ? "" : "/", path);
+    return sd_cache_open(full);
+}
+
+static lv_fs_res_t fs_close_cb(lv_fs_drv_t *drv, void *file_p) {
+    sd_cache_close((sd_cache_file_t *)file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read_cb(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br) {
+    *br = sd_cache_read((sd_cache_file_t *)file_p, buf, btr);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek_cb(lv_fs_drv_t *drv, void *file_p, uint32_t pos, lv_fs_whence_t whence) {
+    int w = whence == LV_FS_SEEK_END ? SEEK_END : whence == LV_FS_SEEK_CUR ? SEEK_CUR : SEEK_SET;
+    return sd_cache_seek((sd_cache_file_t *)file_p, (int32_t)pos, w) == 0 ? LV_FS_RES_OK : LV_FS_RES_INV_PARAM;
+}
+
+static lv_fs_res_t fs_tell_cb(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p) {
+    *pos_p = sd_cache_tell((sd_cache_file_t *)file_p);
+    return LV_FS_RES_OK;
+}
+
+static void *fs_dir_open_cb(lv_fs_drv_t *drv, const char *path) {
+    char full[128];
+    snprintf(full, sizeof(full), SD_CACHE_ROOT "%s%s", path[0] == '/' ? "" : "/", path);
+    return opendir(full);
+}
+
+// Directories are returned with a leading '/', an empty name ends the list
+static lv_fs_res_t fs_dir_read_cb(lv_fs_drv_t *drv, void *rddir_p, char *fn) {
+    struct dirent *de = readdir((DIR *)rddir_p);
+    if(!de) {
+        fn[0] = '\0';
+    } else if(de->d_type == DT_DIR) {
+        snprintf(fn, 256, "/%s", de->d_name);
+    } else {
+        strlcpy(fn, de->d_name, 256);
+    }
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_dir_close_cb(lv_fs_drv_t *drv, void *rddir_p) {
+    closedir((DIR *)rddir_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_drv_t fs_drv;
+
+esp_err_t sd_cache_init(void) {
+    nblocks = CONFIG_APP_SD_CACHE_KB / CONFIG_APP_SD_CACHE_BLOCK_KB;
+    if(nblocks > INT16_MAX) nblocks = INT16_MAX;
+    read_ahead = CONFIG_APP_SD_CACHE_READ_AHEAD;
+    if(read_ahead > nblocks / 2) read_ahead = nblocks / 2 ? nblocks / 2 : 1;
+    for(nbuckets=1; nbuckets<nblocks; nbuckets<<=1);
+    nidents = nblocks + SD_CACHE_OPEN_MAX;
+    if(nidents > INT16_MAX) nidents = INT16_MAX;
+
+    sd_cache_lock = xSemaphoreCreateMutex();
+    blks = calloc(nblocks, sizeof(sd_cache_blk_t));
+    buckets = malloc(nbuckets * sizeof(int16_t));
+    idents = calloc(nidents, sizeof(sd_cache_ident_t));
+    blk_data = heap_caps_malloc_prefer((size_t)nblocks * SD_CACHE_BLOCK, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+                                       MALLOC_CAP_DEFAULT);
+    staging = heap_caps_malloc(read_ahead * SD_CACHE_BLOCK, MALLOC_CAP_DMA);
+    if(!sd_cache_lock || !blks || !buckets || !idents || !blk_data || !staging) {
+        ESP_LOGE(TAG, "No memory for %u blocks", nblocks);
+        free(blks);
+        free(buckets);
+        free(idents);
+        free(blk_data);
+        free(staging);
+        blks = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    newest = oldest = SD_CACHE_NONE;
+    for(uint32_t i=0; i<nblocks; i++) {
+        blks[i].file = SD_CACHE_NONE;
+        lru_push(i);
+    }
+    for(uint32_t i=0; i<nbuckets; i++) buckets[i] = SD_CACHE_NONE;
+    sd_cache_stats.blocks = nblocks;
+    sd_cache_stats.block_size = SD_CACHE_BLOCK;
+
+    lv_fs_drv_init(&fs_drv);
+    fs_drv.letter = SD_CACHE_LETTER;
+    fs_drv.open_cb = fs_open_cb;
+    fs_drv.close_cb = fs_close_cb;
+    fs_drv.read_cb = fs_read_cb;
+    fs_drv.seek_cb = fs_seek_cb;
+    fs_drv.tell_cb = fs_tell_cb;
+    fs_drv.dir_open_cb = fs_dir_open_cb;
+    fs_drv.dir_read_cb = fs_dir_read_cb;
+    fs_drv.dir_close_cb = fs_dir_close_cb;
+    lv_fs_drv_register(&fs_drv);
+
+    ESP_LOGI(TAG, "%u blocks of %uKB, reading ahead %u", nblocks, CONFIG_APP_SD_CACHE_BLOCK_KB, read_ahead);
+    return ESP_OK;
+}
+
+static struct {
+    struct arg_lit *clear;
+    struct arg_end *end;
+} fscache_args;
+
+static int fscache(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &fscache_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, fscache_args.end, argv[0]);
+        return 1;
+    }
+    if(!blks) {
+        printf("SD card cache not allocated\n");
+        return 1;
+    }
+
+    sd_cache_stats_t s;
+    sd_cache_get_stats(&s);
+    uint32_t lookups = s.hits + s.misses;
+    printf("Blocks: %u of %u used, %uKB each\n", s.used, s.blocks, s.block_size / 1024);
+    printf("Lookups: %u hits, %u misses, %u%% hit rate, %u blocks read ahead, %u evictions\n", s.hits, s.misses,
+           lookups ? (uint32_t)(s.hits * 100ULL / lookups) : 0, s.read_ahead, s.evictions);
+    printf("Bytes: %llu served, %llu read from the card in %llums\n", s.served_bytes, s.card_bytes,
+           s.read_us / 1000);
+
+    if(fscache_args.clear->count) {
+        sd_cache_clear();
+        printf("Cleared\n");
+    }
+    return 0;
+}
+
+void register_cmd_fscache(void)
+{
+    fscache_args.clear = arg_lit0("c", "clear", "Forget every cached block");
+    fscache_args.end = arg_end(1);
+
+    const esp_console_cmd_t cmd = {
+        .command = "fscache",
+        .help = "Show SD card block cache hits, misses and bytes read",
+        .hint = NULL,
+        .func = &fscache,
+        .argtable = &fscache_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
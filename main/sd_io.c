@@ -0,0 +1,338 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_console.h"
+#include "esp_rom_crc.h"
+#include "argtable3/argtable3.h"
+#include "sd_io.h"
+
+static const char *TAG="sd_io";
+
+#define SD_IO_CHUNK (CONFIG_APP_SD_IO_CHUNK_KB * 1024)
+#define SD_IO_ALIGN 4
+
+static TaskHandle_t sd_io_task = NULL;
+static QueueHandle_t sd_io_queue = NULL;
+
+// Two DMA capable buffers. Streams alternate between them, other requests
+// use the first to bounce data for buffers the SPI DMA can't reach
+static uint8_t *sd_io_buf[2];
+static SemaphoreHandle_t sd_io_free_bufs = NULL;
+
+typedef struct {
+    uint32_t count;
+    uint32_t errors;
+    uint64_t bytes;
+    uint64_t wait_us; // Queued until the task picked it up
+    uint64_t service_us; // Picked up until completion
+    uint32_t max_latency_us; // Queued until completion
+} sd_io_stat_t;
+
+static sd_io_stat_t sd_io_stats[SD_IO_OP_COUNT];
+static uint32_t sd_io_max_depth;
+static uint32_t sd_io_bounced;
+static portMUX_TYPE sd_io_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char *sd_io_op_names[SD_IO_OP_COUNT] = { "read", "write", "stat", "stream" };
+
+static inline bool sd_io_direct(const void *buf) {
+    return esp_ptr_dma_capable(buf) && ((uintptr_t)buf % SD_IO_ALIGN) == 0;
+}
+
+// Read or write through the bounce buffer, a chunk at a time
+static ssize_t sd_io_bounce(int fd, uint8_t *buf, size_t len, bool write_op) {
+    size_t done = 0;
+
+    portENTER_CRITICAL(&sd_io_lock);
+    sd_io_bounced++;
+    portEXIT_CRITICAL(&sd_io_lock);
+
+    while(done < len) {
+        size_t n = len - done < SD_IO_CHUNK ? len - done : SD_IO_CHUNK;
+        ssize_t res;
+        if(write_op) {
+            memcpy(sd_io_buf[0], buf + done, n);
+            res = write(fd, sd_io_buf[0], n);
+        } else {
+            res = read(fd, sd_io_buf[0], n);
+            if(res > 0) memcpy(buf + done, sd_io_buf[0], res);
+        }
+        if(res < 0) return done ? done : res;
+        done += res;
+        if(res < n) break;
+    }
+    return done;
+}
+
+static esp_err_t sd_io_rw(sd_io_req_t *req) {
+    bool write_op = req->op == SD_IO_WRITE;
+    int flags = write_op ? O_WRONLY | O_CREAT : O_RDONLY;
+    if(write_op && req->offset == SD_IO_APPEND) flags |= O_APPEND;
+
+    int fd = open(req->path, flags, 0666);
+    if(fd < 0) return ESP_ERR_NOT_FOUND;
+
+    if(req->offset != SD_IO_APPEND && lseek(fd, req->offset, SEEK_SET) != req->offset) {
+        close(fd);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    ssize_t res;
+    if(sd_io_direct(req->buf)) {
+        res = write_op ? write(fd, req->buf, req->len) : read(fd, req->buf, req->len);
+    } else {
+        res = sd_io_bounce(fd, req->buf, req->len, write_op);
+    }
+    if(write_op) fsync(fd);
+    close(fd);
+
+    if(res < 0) return ESP_FAIL;
+    req->result = res;
+    return ESP_OK;
+}
+
+// Read into one buffer while the consumer works on the other
+static esp_err_t sd_io_stream(sd_io_req_t *req) {
+    int fd = open(req->path, O_RDONLY);
+    if(fd < 0) return ESP_ERR_NOT_FOUND;
+
+    if(lseek(fd, req->offset, SEEK_SET) != req->offset) {
+        close(fd);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    esp_err_t err = ESP_OK;
+    off_t offset = req->offset;
+    int i = 0;
+    while(req->len == 0 || req->result < req->len) {
+        size_t n = SD_IO_CHUNK;
+        if(req->len && req->len - req->result < n) n = req->len - req->result;
+
+        xSemaphoreTake(sd_io_free_bufs, portMAX_DELAY);
+        ssize_t res = read(fd, sd_io_buf[i], n);
+        if(res <= 0) {
+            xSemaphoreGive(sd_io_free_bufs);
+            if(res < 0) err = ESP_FAIL;
+            break;
+        }
+        req->chunk(req, sd_io_buf[i], res, offset);
+        offset += res;
+        req->result += res;
+        i ^= 1;
+    }
+    close(fd);
+
+    // Wait for the consumer to finish with both buffers
+    xSemaphoreTake(sd_io_free_bufs, portMAX_DELAY);
+    xSemaphoreTake(sd_io_free_bufs, portMAX_DELAY);
+    xSemaphoreGive(sd_io_free_bufs);
+    xSemaphoreGive(sd_io_free_bufs);
+
+    return err;
+}
+
+void sd_io_release(sd_io_req_t *req) {
+    xSemaphoreGive(sd_io_free_bufs);
+}
+
+static void sd_io_task_fn(void *arg) {
+    sd_io_req_t *req;
+
+    while(1) {
+        xQueueReceive(sd_io_queue, &req, portMAX_DELAY);
+        int64_t start = esp_timer_get_time();
+
+        req->result = 0;
+        switch(req->op) {
+        case SD_IO_READ:
+        case SD_IO_WRITE:
+            req->err = sd_io_rw(req);
+            break;
+        case SD_IO_STAT:
+            req->err = stat(req->path, &req->st) == 0 ? ESP_OK : ESP_ERR_NOT_FOUND;
+            break;
+        case SD_IO_STREAM:
+            req->err = sd_io_stream(req);
+            break;
+        default:
+            req->err = ESP_ERR_INVALID_ARG;
+            break;
+        }
+
+        int64_t end = esp_timer_get_time();
+        if(req->op < SD_IO_OP_COUNT) {
+            sd_io_stat_t *s = &sd_io_stats[req->op];
+            uint32_t latency = end - req->queued;
+            portENTER_CRITICAL(&sd_io_lock);
+            s->count++;
+            s->errors += req->err != ESP_OK;
+            s->bytes += req->result;
+            s->wait_us += start - req->queued;
+            s->service_us += end - start;
+            if(latency > s->max_latency_us) s->max_latency_us = latency;
+            portEXIT_CRITICAL(&sd_io_lock);
+        }
+
+        req->done(req);
+    }
+}
+
+esp_err_t sd_io_submit(sd_io_req_t *req) {
+    if(!sd_io_queue) return ESP_ERR_INVALID_STATE;
+    if(!req->done || (req->op == SD_IO_STREAM && !req->chunk)) return ESP_ERR_INVALID_ARG;
+
+    req->queued = esp_timer_get_time();
+    if(xQueueSend(sd_io_queue, &req, 0) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    uint32_t depth = uxQueueMessagesWaiting(sd_io_queue);
+    portENTER_CRITICAL(&sd_io_lock);
+    if(depth > sd_io_max_depth) sd_io_max_depth = depth;
+    portEXIT_CRITICAL(&sd_io_lock);
+
+    return ESP_OK;
+}
+
+esp_err_t sd_io_init(void) {
+    for(int i=0;i<2;i++) {
+        sd_io_buf[i] = heap_caps_aligned_alloc(SD_IO_ALIGN, SD_IO_CHUNK, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if(!sd_io_buf[i]) {
+            ESP_LOGE(TAG, "No memory for %d byte buffers", SD_IO_CHUNK);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    sd_io_free_bufs = xSemaphoreCreateCounting(2, 2);
+    sd_io_queue = xQueueCreate(CONFIG_APP_SD_IO_QUEUE_DEPTH, sizeof(sd_io_req_t *));
+    assert(sd_io_free_bufs && sd_io_queue);
+
+    BaseType_t res = xTaskCreate(sd_io_task_fn, "sd_io", 4096, NULL, CONFIG_APP_SD_IO_TASK_PRIORITY, &sd_io_task);
+    assert(res == pdPASS);
+
+    return ESP_OK;
+}
+
+// Console test stream. The console task checksums each chunk while the
+// service reads the next one
+typedef struct {
+    QueueHandle_t chunks;
+    uint32_t crc;
+} sdio_test_t;
+
+typedef struct {
+    const void *data;
+    size_t len;
+} sdio_test_chunk_t;
+
+static void sdio_test_chunk(sd_io_req_t *req, const void *data, size_t len, off_t offset) {
+    sdio_test_t *test = (sdio_test_t *)req->ctx;
+    sdio_test_chunk_t chunk = { .data = data, .len = len };
+    xQueueSend(test->chunks, &chunk, portMAX_DELAY);
+}
+
+static void sdio_test_done(sd_io_req_t *req) {
+    sdio_test_t *test = (sdio_test_t *)req->ctx;
+    sdio_test_chunk_t end = { .data = NULL, .len = 0 };
+    xQueueSend(test->chunks, &end, portMAX_DELAY);
+}
+
+static int sdio_stream_test(const char *path) {
+    sdio_test_t test = { .chunks = xQueueCreate(2, sizeof(sdio_test_chunk_t)), .crc = 0 };
+    sd_io_req_t req = {
+        .op = SD_IO_STREAM,
+        .path = path,
+        .chunk = sdio_test_chunk,
+        .done = sdio_test_done,
+        .ctx = &test,
+    };
+    sdio_test_chunk_t chunk;
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = sd_io_submit(&req);
+    if(err != ESP_OK) {
+        printf("Submit failed: %s\n", esp_err_to_name(err));
+        vQueueDelete(test.chunks);
+        return 1;
+    }
+    while(xQueueReceive(test.chunks, &chunk, portMAX_DELAY) == pdTRUE && chunk.data) {
+        test.crc = esp_rom_crc32_le(test.crc, chunk.data, chunk.len);
+        sd_io_release(&req);
+    }
+    int64_t us = esp_timer_get_time() - start;
+    vQueueDelete(test.chunks);
+
+    if(req.err != ESP_OK) {
+        printf("%s: %s\n", path, esp_err_to_name(req.err));
+        return 1;
+    }
+    printf("%s: %u bytes in %lldms, %llu KB/s, crc32 %08x\n", path, req.result, us / 1000,
+           us > 0 ? (uint64_t)req.result * 1000000 / 1024 / us : 0, test.crc);
+    return 0;
+}
+
+static struct {
+    struct arg_str *path;
+    struct arg_end *end;
+} sdio_args;
+
+static int sdio(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &sdio_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, sdio_args.end, argv[0]);
+        return 1;
+    }
+    if(!sd_io_queue) {
+        printf("SD I/O service not running, is the card mounted?\n");
+        return 1;
+    }
+    if(sdio_args.path->count) {
+        return sdio_stream_test(sdio_args.path->sval[0]);
+    }
+
+    sd_io_stat_t stats[SD_IO_OP_COUNT];
+    uint32_t max_depth, bounced;
+
+    portENTER_CRITICAL(&sd_io_lock);
+    memcpy(stats, sd_io_stats, sizeof(stats));
+    max_depth = sd_io_max_depth;
+    bounced = sd_io_bounced;
+    portEXIT_CRITICAL(&sd_io_lock);
+
+    printf("Queue: %u of %d queued, high water %u. %u transfers bounced, %dKB chunks\n",
+           uxQueueMessagesWaiting(sd_io_queue), CONFIG_APP_SD_IO_QUEUE_DEPTH, max_depth, bounced,
+           CONFIG_APP_SD_IO_CHUNK_KB);
+    printf("%-7s %7s %6s %10s %8s %8s %8s\n", "Op", "Count", "Errors", "Bytes", "Wait us", "Busy us", "Max us");
+    for(int op=0; op<SD_IO_OP_COUNT; op++) {
+        sd_io_stat_t *s = &stats[op];
+        printf("%-7s %7u %6u %10llu %8llu %8llu %8u\n", sd_io_op_names[op], s->count, s->errors, s->bytes,
+               s->count ? s->wait_us / s->count : 0, s->count ? s->service_us / s->count : 0,
+               s->max_latency_us);
+    }
+    return 0;
+}
+
+void register_cmd_sdio(void)
+{
+    sdio_args.path = arg_str0(NULL, NULL, "<path>", "Stream this file through the service and checksum it");
+    sdio_args.end = arg_end(1);
+
+    const esp_console_cmd_t cmd = {
+        .command = "sdio",
+        .help = "Show SD I/O service queue depth and request latency, or stream a file",
+        .hint = NULL,
+        .func = &sdio,
+        .argtable = &sdio_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
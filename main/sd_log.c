@@ -0,0 +1,364 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_console.h"
+#include "argtable3/argtable3.h"
+#include "sd_log.h"
+
+static const char *TAG="sd_log";
+
+#define SD_LOG_DIR "/sdcard"
+#define SD_LOG_LINE_MAX 512 // Longer lines are cut short
+#define SD_LOG_BATCH (CONFIG_APP_SD_LOG_BATCH_KB * 1024)
+#define SD_LOG_FILE_MAX (CONFIG_APP_SD_LOG_FILE_KB * 1024)
+#define SD_LOG_FLUSH_US (CONFIG_APP_SD_LOG_FLUSH_MS * 1000LL)
+
+// Ring records are 4 byte aligned and start with a header word, which the
+// producer sets last. The consumer zeroes what it has taken, so a header
+// which isn't READY belongs to a line still being written
+#define SD_LOG_READY 0x80000000u
+#define SD_LOG_PAD 0x40000000u // Filler up to the end of the ring
+#define SD_LOG_SIZE(h) ((h) & 0xFFFF) // Ring bytes taken, header included
+#define SD_LOG_LEN(h) (((h) >> 16) & 0x3FFF) // Characters in the line
+#define SD_LOG_HDR(size, len) ((size) | ((uint32_t)(len) << 16) | SD_LOG_READY)
+
+static uint8_t *ring;
+static uint32_t ring_size; // A power of two
+static atomic_uint ring_head; // Running count of bytes reserved by producers
+static atomic_uint ring_tail; // Running count of bytes freed by the task
+static atomic_uint logged; // Bytes of text put in the ring
+static atomic_uint dropped; // Bytes of text lost because the ring was full
+
+static vprintf_like_t prev_vprintf;
+static TaskHandle_t sd_log_task;
+static SemaphoreHandle_t sd_log_stopped;
+static volatile bool sd_log_stopping;
+static volatile bool sd_log_flush;
+
+// Written by the task, read by the console command
+typedef struct {
+    uint32_t high_water; // Most of the ring in use
+    uint64_t written; // Bytes written to the card
+    uint32_t writes;
+    uint64_t write_us;
+    uint32_t max_write_us;
+    uint32_t lost; // Bytes which failed to write
+    uint32_t errors;
+    uint32_t rotations;
+    uint32_t file_size;
+} sd_log_stats_t;
+
+static sd_log_stats_t sd_log_stats;
+static portMUX_TYPE sd_log_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int sd_log_fd = -1;
+
+static inline atomic_uint *sd_log_hdr(uint32_t pos) {
+    return (atomic_uint *)(ring + (pos & (ring_size - 1)));
+}
+
+// Format a line straight into the ring. Never blocks, if there is no room the
+// line is dropped
+static void sd_log_append(const char *fmt, va_list args) {
+    va_list measure;
+    va_copy(measure, args);
+    int len = vsnprintf(NULL, 0, fmt, measure);
+    va_end(measure);
+    if(len <= 0) return;
+    if(len > SD_LOG_LINE_MAX) len = SD_LOG_LINE_MAX;
+
+    // Room for the terminator vsnprintf writes, lines don't wrap around the end
+    uint32_t size = (4 + len + 1 + 3) & ~3u;
+    uint32_t head, tail, pad, ofs;
+    do {
+        head = atomic_load(&ring_head);
+        tail = atomic_load(&ring_tail);
+        ofs = head & (ring_size - 1);
+        pad = ofs + size > ring_size ? ring_size - ofs : 0;
+        if(head + pad + size - tail > ring_size) {
+            atomic_fetch_add(&dropped, len);
+            return;
+        }
+    } while(!atomic_compare_exchange_weak(&ring_head, &head, head + pad + size));
+
+    if(pad) {
+        atomic_store_explicit(sd_log_hdr(head), SD_LOG_PAD | SD_LOG_READY | pad, memory_order_release);
+        head += pad;
+        ofs = 0;
+    }
+    vsnprintf((char *)ring + ofs + 4, len + 1, fmt, args);
+    atomic_store_explicit(sd_log_hdr(head), SD_LOG_HDR(size, len), memory_order_release);
+    atomic_fetch_add(&logged, len);
+
+    // Wake the task early when the ring passes half full
+    uint32_t used = head + size - tail;
+    if(used > ring_size / 2 && used - size - pad <= ring_size / 2 && !xPortInIsrContext()) {
+        xTaskNotifyGive(sd_log_task);
+    }
+}
+
+static int sd_log_vprintf(const char *fmt, va_list args) {
+    va_list copy;
+    va_copy(copy, args);
+    int ret = prev_vprintf(fmt, args);
+    sd_log_append(fmt, copy);
+    va_end(copy);
+    return ret;
+}
+
+static void sd_log_name(char *path, size_t len, int n) {
+    snprintf(path, len, SD_LOG_DIR "/LOG%d.TXT", n);
+}
+
+// Shift the older files up one, dropping the oldest, and start a new LOG0
+static void sd_log_rotate(void) {
+    char from[32], to[32];
+
+    sd_log_name(to, sizeof(to), CONFIG_APP_SD_LOG_FILES - 1);
+    unlink(to);
+    for(int n=CONFIG_APP_SD_LOG_FILES - 2; n>=0; n--) {
+        sd_log_name(from, sizeof(from), n);
+        sd_log_name(to, sizeof(to), n + 1);
+        rename(from, to);
+    }
+    portENTER_CRITICAL(&sd_log_lock);
+    sd_log_stats.rotations++;
+    portEXIT_CRITICAL(&sd_log_lock);
+}
+
+static bool sd_log_open(size_t len) {
+    char path[32];
+    sd_log_name(path, sizeof(path), 0);
+
+    if(sd_log_fd >= 0) {
+        if(sd_log_stats.file_size + len <= SD_LOG_FILE_MAX) return true;
+        close(sd_log_fd);
+        sd_log_fd = -1;
+        sd_log_rotate();
+    }
+
+    // Carry on with the file from the last boot
+    sd_log_fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if(sd_log_fd < 0) return false;
+    struct stat st;
+    uint32_t size = fstat(sd_log_fd, &st) == 0 ? st.st_size : 0;
+    if(size && size + len > SD_LOG_FILE_MAX) {
+        close(sd_log_fd);
+        sd_log_fd = -1;
+        sd_log_rotate();
+        sd_log_fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if(sd_log_fd < 0) return false;
+        size = 0;
+    }
+    portENTER_CRITICAL(&sd_log_lock);
+    sd_log_stats.file_size = size;
+    portEXIT_CRITICAL(&sd_log_lock);
+    return true;
+}
+
+static void sd_log_write(const uint8_t *batch, size_t len) {
+    int64_t start = esp_timer_get_time();
+    bool ok = sd_log_open(len) && write(sd_log_fd, batch, len) == len && fsync(sd_log_fd) == 0;
+    uint32_t us = esp_timer_get_time() - start;
+
+    portENTER_CRITICAL(&sd_log_lock);
+    if(ok) {
+        sd_log_stats.written += len;
+        sd_log_stats.file_size += len;
+        sd_log_stats.writes++;
+        sd_log_stats.write_us += us;
+        if(us > sd_log_stats.max_write_us) sd_log_stats.max_write_us = us;
+    } else {
+        sd_log_stats.lost += len;
+        sd_log_stats.errors++;
+    }
+    portEXIT_CRITICAL(&sd_log_lock);
+
+    if(!ok && sd_log_fd >= 0) {
+        // Try again from scratch next time, the card may have gone
+        close(sd_log_fd);
+        sd_log_fd = -1;
+    }
+}
+
+// Copy a line into the batch without the colour escapes
+static size_t sd_log_copy(uint8_t *dst, const char *src, size_t len) {
+    size_t n = 0;
+    for(size_t i=0; i<len; i++) {
+        if(src[i] == '\033') {
+            while(i < len && src[i] != 'm') i++;
+            continue;
+        }
+        dst[n++] = src[i];
+    }
+    return n;
+}
+
+static void sd_log_task_fn(void *arg) {
+    uint8_t *batch = heap_caps_malloc(SD_LOG_BATCH, MALLOC_CAP_DMA);
+    assert(batch);
+    size_t batch_len = 0;
+    uint32_t reported = 0;
+    int64_t last_write = esp_timer_get_time();
+
+    for(;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CONFIG_APP_SD_LOG_FLUSH_MS));
+        bool stopping = sd_log_stopping;
+        bool flush = sd_log_flush;
+        sd_log_flush = false;
+
+        // Note anything lost since the last time, in the file itself
+        uint32_t lost = atomic_load(&dropped);
+        if(lost != reported) {
+            char note[64];
+            int n = snprintf(note, sizeof(note), "--- sd_log: %u bytes dropped ---\n", lost - reported);
+            if(batch_len + n > SD_LOG_BATCH) {
+                sd_log_write(batch, batch_len);
+                batch_len = 0;
+            }
+            memcpy(batch + batch_len, note, n);
+            batch_len += n;
+            reported = lost;
+        }
+
+        uint32_t tail = atomic_load(&ring_tail);
+        uint32_t head = atomic_load(&ring_head);
+        portENTER_CRITICAL(&sd_log_lock);
+        if(head - tail > sd_log_stats.high_water) sd_log_stats.high_water = head - tail;
+        portEXIT_CRITICAL(&sd_log_lock);
+
+        while(tail != head) {
+            uint32_t ofs = tail & (ring_size - 1);
+            uint32_t hdr = atomic_load_explicit(sd_log_hdr(tail), memory_order_acquire);
+            if(!(hdr & SD_LOG_READY)) break; // Still being written, next time
+            uint32_t size = SD_LOG_SIZE(hdr);
+            if(!(hdr & SD_LOG_PAD)) {
+                uint32_t len = SD_LOG_LEN(hdr);
+                if(batch_len + len > SD_LOG_BATCH) {
+                    sd_log_write(batch, batch_len);
+                    batch_len = 0;
+                    last_write = esp_timer_get_time();
+                }
+                batch_len += sd_log_copy(batch + batch_len, (const char *)ring + ofs + 4, len);
+            }
+            memset(ring + ofs, 0, size);
+            tail += size;
+            atomic_store_explicit(&ring_tail, tail, memory_order_release);
+        }
+
+        // Write in big blocks, unless the lines have waited long enough
+        int64_t now = esp_timer_get_time();
+        if(batch_len && (stopping || flush || batch_len >= SD_LOG_BATCH / 2 || now - last_write >= SD_LOG_FLUSH_US)) {
+            sd_log_write(batch, batch_len);
+            batch_len = 0;
+            last_write = now;
+        }
+
+        if(stopping) break;
+    }
+
+    if(sd_log_fd >= 0) {
+        close(sd_log_fd);
+        sd_log_fd = -1;
+    }
+    free(batch);
+    xSemaphoreGive(sd_log_stopped);
+    vTaskDelete(NULL);
+}
+
+esp_err_t sd_log_init(void) {
+    if(sd_log_task) return ESP_ERR_INVALID_STATE;
+
+    // Largest power of two which fits the configured size
+    ring_size = 1u << (31 - __builtin_clz(CONFIG_APP_SD_LOG_RING_KB * 1024));
+    ring = heap_caps_calloc_prefer(1, ring_size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, MALLOC_CAP_DEFAULT);
+    sd_log_stopped = xSemaphoreCreateBinary();
+    if(!ring || !sd_log_stopped) return ESP_ERR_NO_MEM;
+
+    if(xTaskCreate(sd_log_task_fn, "sd_log", 3072, NULL, 1, &sd_log_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    prev_vprintf = esp_log_set_vprintf(sd_log_vprintf);
+
+    ESP_LOGI(TAG, "Logging to " SD_LOG_DIR "/LOG0.TXT, %uKB ring", ring_size / 1024);
+    return ESP_OK;
+}
+
+esp_err_t sd_log_stop(void) {
+    if(!sd_log_task) return ESP_OK;
+
+    if(!sd_log_stopping) {
+        esp_log_set_vprintf(prev_vprintf);
+        sd_log_stopping = true;
+        xTaskNotifyGive(sd_log_task);
+    }
+    if(xSemaphoreTake(sd_log_stopped, pdMS_TO_TICKS(1000)) != pdTRUE) {
+        ESP_LOGW(TAG, "Log not written out yet");
+        return ESP_ERR_TIMEOUT;
+    }
+    sd_log_task = NULL;
+    return ESP_OK;
+}
+
+static struct {
+    struct arg_lit *flush;
+    struct arg_end *end;
+} sdlog_args;
+
+static int sdlog(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &sdlog_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, sdlog_args.end, argv[0]);
+        return 1;
+    }
+    if(!sd_log_task) {
+        printf("SD card log not running, is the card mounted?\n");
+        return 1;
+    }
+    if(sdlog_args.flush->count) {
+        sd_log_flush = true;
+        xTaskNotifyGive(sd_log_task);
+    }
+
+    sd_log_stats_t s;
+    portENTER_CRITICAL(&sd_log_lock);
+    s = sd_log_stats;
+    portEXIT_CRITICAL(&sd_log_lock);
+    uint32_t used = atomic_load(&ring_head) - atomic_load(&ring_tail);
+
+    printf("Ring: %u of %u bytes used, high water %u\n", used, ring_size, s.high_water);
+    printf("Logged %u bytes, dropped %u bytes when the ring was full\n", atomic_load(&logged),
+           atomic_load(&dropped));
+    printf("Written %llu bytes in %u blocks, average %ums, max %ums\n", s.written, s.writes,
+           s.writes ? (uint32_t)(s.write_us / s.writes / 1000) : 0, s.max_write_us / 1000);
+    printf("LOG0.TXT %u bytes, %u rotations of %u files, %u errors losing %u bytes\n", s.file_size, s.rotations,
+           CONFIG_APP_SD_LOG_FILES, s.errors, s.lost);
+    return 0;
+}
+
+void register_cmd_sdlog(void)
+{
+    sdlog_args.flush = arg_lit0("f", "flush", "Write out the lines waiting in RAM");
+    sdlog_args.end = arg_end(1);
+
+    const esp_console_cmd_t cmd = {
+        .command = "sdlog",
+        .help = "Show the SD card log ring, writes and dropped bytes",
+        .hint = NULL,
+        .func = &sdlog,
+        .argtable = &sdlog_args
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
@@ -12,6 +13,16 @@
 #include "scr.h"
 #include "app_event.h"
 #include "esp_console.h"
+#include "esp_rom_crc.h"
+#include "argtable3/argtable3.h"
+#include "mbedtls/base64.h"
+#include "rle565.h"
+#include "lvgl_mem.h"
+
+#if CONFIG_APP_LCD_PIPELINED_FLUSH
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#endif
 
 static const char *TAG="lvgl";
 
@@ -21,46 +32,446 @@ SemaphoreHandle_t gui_mutex = NULL;
 // LVGL update interval
 #define LVGL_TICK_PERIOD_MS 2
 #define LVGL_BUFFER_LINES 34
+#define LVGL_BUFFER_SIZE (320 * LVGL_BUFFER_LINES * sizeof(lv_color_t))
+
+#if CONFIG_APP_LCD_PIPELINED_FLUSH
+#define LVGL_BUFFER_COUNT CONFIG_APP_LCD_FLUSH_RING_DEPTH
+#else
+#define LVGL_BUFFER_COUNT 2
+#endif
 
 lv_obj_t * lv_blank;
 static bool lvgl_init_done = false;
 
 esp_timer_handle_t lvgl_tick_timer = NULL;
 
-static int snapshot(int argc, char **argv) {
-    LOCK_GUI;
-    lv_img_dsc_t *snap=lv_snapshot_take(lv_scr_act(), LV_IMG_CF_TRUE_COLOR);
-    UNLOCK_GUI;
+// Binary snapshot stream
+//
+// Each frame is sent as one "snap:<base64>" line so it survives idf.py monitor
+// and the console line ending translation. Frame layout, little endian:
+//   u8 type, u16 seq, u16 len, u8 payload[len], u32 crc32 of the preceding bytes
+#define SNAP_PREFIX "snap:"
+#define SNAP_VERSION 1
+#define SNAP_PAYLOAD_MAX 240
+#define SNAP_FRAME_MAX (5 + SNAP_PAYLOAD_MAX + 4)
+
+enum {
+    SNAP_HEADER = 'H', // u16 w, u16 h, u8 cf, u8 depth, u8 swap, u8 version
+    SNAP_DATA = 'D', // rle565 packets
+    SNAP_END = 'E', // u32 pixels, u32 rle bytes
+};
+
+static struct {
+    struct arg_lit *binary;
+    struct arg_end *end;
+} snapshot_args;
+
+static void snap_send(uint8_t type, uint16_t seq, const uint8_t *payload, uint16_t len) {
+    uint8_t frame[SNAP_FRAME_MAX];
+    unsigned char line[((SNAP_FRAME_MAX + 2) / 3) * 4 + 1];
+    size_t olen;
+
+    assert(len <= SNAP_PAYLOAD_MAX);
+    frame[0] = type;
+    frame[1] = seq & 0xff;
+    frame[2] = seq >> 8;
+    frame[3] = len & 0xff;
+    frame[4] = len >> 8;
+    memcpy(&frame[5], payload, len);
+    uint32_t crc = esp_rom_crc32_le(0, frame, 5 + len);
+    memcpy(&frame[5 + len], &crc, sizeof(crc));
+
+    ESP_ERROR_CHECK(mbedtls_base64_encode(line, sizeof(line), &olen, frame, 5 + len + sizeof(crc)));
+    printf(SNAP_PREFIX "%.*s\n", olen, line);
+}
 
-    ESP_LOGI(TAG, "Snapshot %dx%d", snap->header.w, snap->header.h);
+static void snapshot_binary(const lv_img_dsc_t *snap) {
+    uint8_t payload[SNAP_PAYLOAD_MAX];
+    uint16_t seq = 0;
+    const uint16_t *px = (const uint16_t *)snap->data;
+    size_t count = snap->header.w * snap->header.h;
+    size_t done = 0;
+    uint32_t bytes = 0;
+
+    payload[0] = snap->header.w & 0xff;
+    payload[1] = snap->header.w >> 8;
+    payload[2] = snap->header.h & 0xff;
+    payload[3] = snap->header.h >> 8;
+    payload[4] = snap->header.cf;
+    payload[5] = LV_COLOR_DEPTH;
+    payload[6] = LV_COLOR_16_SWAP;
+    payload[7] = SNAP_VERSION;
+    snap_send(SNAP_HEADER, seq++, payload, 8);
+
+    // The snapshot buffer is row major, compress it a frame at a time
+    while(done < count) {
+        size_t consumed;
+        size_t len = rle565_encode(&px[done], count - done, payload, sizeof(payload), &consumed);
+        snap_send(SNAP_DATA, seq++, payload, len);
+        done += consumed;
+        bytes += len;
+    }
+
+    uint32_t end[2] = { count, bytes };
+    snap_send(SNAP_END, seq, (const uint8_t *)end, sizeof(end));
+    ESP_LOGI(TAG, "Snapshot sent, %u bytes compressed to %u in %u frames",
+             count * sizeof(lv_color_t), bytes, seq + 1);
+}
+
+static void snapshot_text(const lv_img_dsc_t *snap) {
     // Output image
     for(int x=0;x<snap->header.w;x++) {
         for(int y=0;y<snap->header.h;y++) {
-            lv_color_t col=lv_img_buf_get_px_color(snap, x, y, lv_color_black());
+            lv_color_t col=lv_img_buf_get_px_color((lv_img_dsc_t *)snap, x, y, lv_color_black());
             printf("%04x ",col.full);
         }
     }
     printf("\n");
+}
+
+static int snapshot(int argc, char **argv) {
+    int nerrors = arg_parse(argc, argv, (void **) &snapshot_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, snapshot_args.end, argv[0]);
+        return 1;
+    }
+
+    // A full screen is bigger than the LVGL heap, so take it into PSRAM
+    lv_img_dsc_t dsc;
+    lv_img_dsc_t *snap=&dsc;
+    void *buf=NULL;
+    lv_res_t res=LV_RES_INV;
+
+    LOCK_GUI_WAIT;
+    uint32_t size=lv_snapshot_buf_size_needed(lv_scr_act(), LV_IMG_CF_TRUE_COLOR);
+    buf=heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if(buf) {
+        res=lv_snapshot_take_to_buf(lv_scr_act(), LV_IMG_CF_TRUE_COLOR, snap, buf, size);
+    }
+    UNLOCK_GUI;
 
-    lv_snapshot_free(snap);
+    if(res!=LV_RES_OK) {
+        ESP_LOGE(TAG, "Snapshot failed, out of memory?");
+        free(buf);
+        return 1;
+    }
+
+    ESP_LOGI(TAG, "Snapshot %dx%d", snap->header.w, snap->header.h);
+    if(snapshot_args.binary->count) {
+        snapshot_binary(snap);
+    } else {
+        snapshot_text(snap);
+    }
+
+    free(buf);
 
     return 0;
 }
 
 static void register_cmd_snapshot(void)
 {
+    snapshot_args.binary = arg_lit0("b", "binary", "Send a compressed, checksummed stream");
+    snapshot_args.end = arg_end(1);
+
     const esp_console_cmd_t cmd = {
         .command = "snap",
         .help = "Take a snapshot of the screen",
         .hint = NULL,
         .func = &snapshot,
+        .argtable = &snapshot_args
     };
     ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
 }
 
+// Invalidation coalescing
+//
+// Every flush pays a CASET/RASET/RAMWR command round trip on the panel IO on
+// top of the pixel data. Before each refresh merge invalid areas whenever
+// sending their bounding box costs fewer bus bytes than sending them apart.
+static portMUX_TYPE inv_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint64_t areas_requested; // Invalid areas at the start of a refresh
+static uint64_t areas_merged; // Of which merged into a neighbour
+static uint64_t areas_flushed; // Transfers sent to the panel
+static uint64_t bytes_flushed; // Pixel bytes sent to the panel
+static uint64_t bytes_since; // bytes_flushed at the last lcdstat
+static int64_t stats_since; // Time of the last lcdstat
+
+static inline uint32_t area_cost(const lv_area_t *area) {
+    return CONFIG_APP_LCD_FLUSH_OVERHEAD_BYTES + lv_area_get_size(area) * sizeof(lv_color_t);
+}
+
+static void lvgl_coalesce_areas(lv_disp_t *disp) {
+    // Layout changes invalidate areas too, so let those happen first
+    if(disp->act_scr) lv_obj_update_layout(disp->act_scr);
+    lv_obj_update_layout(disp->top_layer);
+    lv_obj_update_layout(disp->sys_layer);
+
+    uint32_t requested = 0;
+    uint32_t merged = 0;
+    for(int i=0;i<disp->inv_p;i++) {
+        if(!disp->inv_area_joined[i]) requested++;
+    }
+
+    // Greedy pairwise merge, the list is at most LV_INV_BUF_SIZE long
+    bool changed;
+    do {
+        changed = false;
+        for(int i=0;i<disp->inv_p;i++) {
+            if(disp->inv_area_joined[i]) continue;
+            for(int j=i+1;j<disp->inv_p;j++) {
+                if(disp->inv_area_joined[j]) continue;
+                lv_area_t joined;
+                _lv_area_join(&joined, &disp->inv_areas[i], &disp->inv_areas[j]);
+                if(area_cost(&joined) <= area_cost(&disp->inv_areas[i]) + area_cost(&disp->inv_areas[j])) {
+                    lv_area_copy(&disp->inv_areas[i], &joined);
+                    disp->inv_area_joined[j] = 1;
+                    merged++;
+                    changed = true;
+                }
+            }
+        }
+    } while(changed);
+
+    portENTER_CRITICAL(&inv_lock);
+    areas_requested += requested;
+    areas_merged += merged;
+    portEXIT_CRITICAL(&inv_lock);
+}
+
+static lvgl_frame_cb_t frame_cb = NULL;
+
+// Set while something else is drawing on the panel, see tembed_lvgl_claim
+static volatile bool lcd_claimed;
+static lcd_done_cb_t lcd_claim_done;
+static void *lcd_claim_ctx;
+
+void tembed_lvgl_on_frame(lvgl_frame_cb_t cb) {
+    frame_cb = cb;
+}
+
+static inline void flush_account(lv_disp_drv_t *drv, const lv_area_t *area) {
+    portENTER_CRITICAL(&inv_lock);
+    areas_flushed++;
+    bytes_flushed += lv_area_get_size(area) * sizeof(lv_color_t);
+    portEXIT_CRITICAL(&inv_lock);
+
+    if(frame_cb && lv_disp_flush_is_last(drv)) {
+        frame_cb(esp_timer_get_time());
+    }
+}
+
+#if CONFIG_APP_LCD_PIPELINED_FLUSH
+// Pipelined flush
+//
+// LVGL renders each stripe into one buffer of a ring. When a stripe is complete
+// flush_cb queues it for the flush task (on the other core) which pushes it
+// to the panel, and hands LVGL a free buffer straight away so the next stripe is
+// rendered while the previous one is still going out over SPI. Buffers return
+// to the free list from the panel IO transfer done ISR.
+
+// A rendered stripe on its way to the panel
+typedef struct {
+    lv_area_t area;
+    lv_color_t *buf;
+    int64_t frame_start; // When LVGL started the refresh this stripe belongs to
+    int64_t submitted; // When the flush task handed the stripe to the panel IO
+    uint32_t render_us; // Time LVGL spent rendering this stripe
+    bool last; // Last stripe of the frame
+} flush_job_t;
+
+// Timings for one frame, all in micro-seconds
+typedef struct {
+    uint32_t stripes;
+    uint32_t render_us; // LVGL busy rendering
+    uint32_t tx_us; // SPI bus busy transmitting
+    uint32_t frame_us; // Start of refresh to last stripe on the panel
+} flush_frame_t;
+
+static QueueHandle_t flush_queue; // Rendered stripes waiting for the flush task
+static SemaphoreHandle_t flush_free; // Counts the buffers in free_bufs
+static portMUX_TYPE flush_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Protected by flush_lock
+static lv_color_t *free_bufs[LVGL_BUFFER_COUNT];
+static int free_count;
+static flush_job_t flush_inflight[LVGL_BUFFER_COUNT]; // Stripes on the panel IO, oldest first
+static int inflight_head;
+static int inflight_count;
+static int64_t flush_last_done;
+static bool flush_submitting; // The flush task is sending a stripe
+static flush_frame_t frame_acc; // Frame being transmitted
+static flush_frame_t frame_last; // Last completed frame
+static uint64_t frames;
+static uint64_t total_render_us;
+static uint64_t total_tx_us;
+static uint64_t total_frame_us;
+
+// Only touched by the LVGL task
+static int64_t refr_start; // Start of the current LVGL refresh
+static int64_t render_from; // When LVGL got the buffer it is rendering into
+static bool frame_open;
+
+// Percentage of the serial render + transmit time hidden by overlapping them
+static uint32_t overlap_pct(uint64_t render_us, uint64_t tx_us, uint64_t frame_us) {
+    uint64_t serial = render_us + tx_us;
+    if(serial == 0 || frame_us >= serial) return 0;
+    return (uint32_t)(((serial - frame_us) * 100) / serial);
+}
+
+// ISR ISR ISR ISR ISR
 bool notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
     if(!lvgl_init_done) return false;
+
+    int64_t now = esp_timer_get_time();
+    BaseType_t woken = pdFALSE;
+
+    portENTER_CRITICAL_ISR(&flush_lock);
+    if(inflight_count == 0) {
+        // Not one of ours
+        portEXIT_CRITICAL_ISR(&flush_lock);
+        return lcd_claimed && lcd_claim_done ? lcd_claim_done(lcd_claim_ctx) : false;
+    }
+    flush_job_t *job = &flush_inflight[inflight_head];
+    inflight_head = (inflight_head + 1) % LVGL_BUFFER_COUNT;
+    inflight_count--;
+    free_bufs[free_count++] = job->buf;
+
+    // The bus was busy from when the stripe was submitted or the previous one
+    // finished, whichever was later
+    int64_t start = job->submitted > flush_last_done ? job->submitted : flush_last_done;
+    flush_last_done = now;
+    frame_acc.stripes++;
+    frame_acc.render_us += job->render_us;
+    frame_acc.tx_us += now - start;
+    if(job->last) {
+        frame_acc.frame_us = now - job->frame_start;
+        frame_last = frame_acc;
+        frames++;
+        total_render_us += frame_acc.render_us;
+        total_tx_us += frame_acc.tx_us;
+        total_frame_us += frame_acc.frame_us;
+        memset(&frame_acc, 0, sizeof(frame_acc));
+    }
+    portEXIT_CRITICAL_ISR(&flush_lock);
+
+    xSemaphoreGiveFromISR(flush_free, &woken);
+    return woken == pdTRUE;
+}
+
+static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    ESP_LOGD(TAG, "flush");
+    int64_t now = esp_timer_get_time();
+    flush_account(drv, area);
+
+    if(!frame_open) {
+        frame_open = true;
+        if(refr_start == 0) refr_start = render_from = now; // Refresh outside the refresh timer
+    }
+
+    flush_job_t job = {
+        .area = *area,
+        .buf = color_map,
+        .frame_start = refr_start,
+        .render_us = now - render_from,
+        .last = lv_disp_flush_is_last(drv),
+    };
+    if(job.last) {
+        frame_open = false;
+        refr_start = 0;
+    }
+    if(lcd_claimed) {
+        // Someone else owns the panel, keep rendering into the same buffer.
+        // LVGL swaps buffers on return, so point the other one at it too,
+        // the stripe flushed last is back in free_bufs and no longer ours
+        if(drv->draw_buf->buf1 == color_map) {
+            drv->draw_buf->buf2 = color_map;
+        } else {
+            drv->draw_buf->buf1 = color_map;
+        }
+        render_from = esp_timer_get_time();
+        lv_disp_flush_ready(drv);
+        return;
+    }
+    xQueueSend(flush_queue, &job, portMAX_DELAY);
+
+    // LVGL swaps to the other buffer as soon as we return, so make sure that is
+    // one which isn't still on the bus. Only blocks if the whole ring is in flight.
+    xSemaphoreTake(flush_free, portMAX_DELAY);
+    portENTER_CRITICAL(&flush_lock);
+    lv_color_t *next = free_bufs[--free_count];
+    portEXIT_CRITICAL(&flush_lock);
+    if(drv->draw_buf->buf1 == color_map) {
+        drv->draw_buf->buf2 = next;
+    } else {
+        drv->draw_buf->buf1 = next;
+    }
+
+    render_from = esp_timer_get_time();
+    lv_disp_flush_ready(drv);
+    ESP_LOGD(TAG, "flush queued");
+}
+
+// Pushes rendered stripes to the panel
+static void lvgl_flush_task(void *pvParameters)
+{
+    esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t) pvParameters;
+    flush_job_t job;
+
+    while(1) {
+        xQueueReceive(flush_queue, &job, portMAX_DELAY);
+        job.submitted = esp_timer_get_time();
+
+        // Must be in the in flight list before the transfer can complete
+        portENTER_CRITICAL(&flush_lock);
+        if(lcd_claimed) {
+            // Claimed since it was queued, drop it
+            free_bufs[free_count++] = job.buf;
+            portEXIT_CRITICAL(&flush_lock);
+            xSemaphoreGive(flush_free);
+            continue;
+        }
+        flush_inflight[(inflight_head + inflight_count) % LVGL_BUFFER_COUNT] = job;
+        inflight_count++;
+        flush_submitting = true;
+        portEXIT_CRITICAL(&flush_lock);
+
+        // Blocks until the previous stripe is done as the panel window has to be set
+        ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(panel_handle, job.area.x1, job.area.y1, job.area.x2 + 1, job.area.y2 + 1, job.buf));
+
+        portENTER_CRITICAL(&flush_lock);
+        flush_submitting = false;
+        portEXIT_CRITICAL(&flush_lock);
+    }
+}
+
+// True once nothing LVGL rendered is queued or on the bus
+static bool flush_idle(void) {
+    if(uxQueueMessagesWaiting(flush_queue)) return false;
+    portENTER_CRITICAL(&flush_lock);
+    bool idle = inflight_count == 0 && !flush_submitting;
+    portEXIT_CRITICAL(&flush_lock);
+    return idle;
+}
+
+static void flush_claim(void) {
+    portENTER_CRITICAL(&flush_lock);
+    lcd_claimed = true;
+    portEXIT_CRITICAL(&flush_lock);
+}
+
+#else
+static portMUX_TYPE flush_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool flush_busy; // An LVGL stripe is on the bus
+
+bool notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    if(!lvgl_init_done) return false;
+    if(!flush_busy) {
+        return lcd_claimed && lcd_claim_done ? lcd_claim_done(lcd_claim_ctx) : false;
+    }
+    flush_busy = false;
     lv_disp_drv_t *disp_driver = (lv_disp_drv_t *)user_ctx;
     lv_disp_flush_ready(disp_driver);
     return false;
@@ -69,6 +480,18 @@ bool notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_i
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     ESP_LOGD(TAG, "flush");
+    flush_account(drv, area);
+
+    // Decided under the lock so a claim either waits for this stripe or skips it
+    portENTER_CRITICAL(&flush_lock);
+    bool claimed = lcd_claimed;
+    flush_busy = !claimed;
+    portEXIT_CRITICAL(&flush_lock);
+    if(claimed) {
+        lv_disp_flush_ready(drv);
+        return;
+    }
+
     esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t) drv->user_data;
     int offsetx1 = area->x1;
     int offsetx2 = area->x2;
@@ -79,6 +502,115 @@ static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
     ESP_LOGD(TAG, "flush done");
 }
 
+static bool flush_idle(void) {
+    return !flush_busy;
+}
+
+static void flush_claim(void) {
+    portENTER_CRITICAL(&flush_lock);
+    lcd_claimed = true;
+    portEXIT_CRITICAL(&flush_lock);
+}
+#endif
+
+esp_lcd_panel_handle_t tembed_lvgl_claim(lcd_done_cb_t done, void *ctx) {
+    assert(!lcd_claimed);
+    lcd_claim_done = done;
+    lcd_claim_ctx = ctx;
+    flush_claim();
+    while(!flush_idle()) {
+        vTaskDelay(1);
+    }
+    ESP_LOGI(TAG, "Panel claimed");
+    return (esp_lcd_panel_handle_t)lvgl_disp_drv.user_data;
+}
+
+void tembed_lvgl_release(void) {
+    lcd_claimed = false;
+    lcd_claim_done = NULL;
+    lcd_claim_ctx = NULL;
+
+    // Nothing LVGL drew while claimed was shown. Called from the anim_push
+    // task, which must wait out a whole UI task iteration
+    LOCK_GUI_WAIT;
+    lv_obj_invalidate(lv_scr_act());
+    UNLOCK_GUI;
+    ESP_LOGI(TAG, "Panel released");
+}
+
+static volatile uint32_t lvgl_refreshes;
+
+// Wrap the LVGL refresh timer to coalesce the invalid areas (and to find the
+// start of each frame for the flush pipeline)
+static void lvgl_refr_timer_cb(lv_timer_t *timer)
+{
+    lv_disp_t *disp = (lv_disp_t *)timer->user_data;
+#if CONFIG_APP_LCD_PIPELINED_FLUSH
+    refr_start = render_from = esp_timer_get_time();
+#endif
+    lvgl_refreshes++;
+    lvgl_coalesce_areas(disp);
+    _lv_disp_refr_timer(timer);
+#if CONFIG_APP_LCD_PIPELINED_FLUSH
+    if(!frame_open) refr_start = 0;
+#endif
+}
+
+static int lcd_stats(int argc, char **argv) {
+#if CONFIG_APP_LCD_PIPELINED_FLUSH
+    flush_frame_t last;
+    uint64_t n, render, tx, frame;
+
+    portENTER_CRITICAL(&flush_lock);
+    last = frame_last;
+    n = frames;
+    render = total_render_us;
+    tx = total_tx_us;
+    frame = total_frame_us;
+    portEXIT_CRITICAL(&flush_lock);
+
+    printf("Flush ring depth %d, %llu frames\n", LVGL_BUFFER_COUNT, n);
+    printf("Last frame: %u stripes, render %uus, transmit %uus, frame %uus, overlap %u%%\n",
+           last.stripes, last.render_us, last.tx_us, last.frame_us,
+           overlap_pct(last.render_us, last.tx_us, last.frame_us));
+    if(n) {
+        printf("Average:    render %lluus, transmit %lluus, frame %lluus, overlap %u%%\n",
+               render / n, tx / n, frame / n, overlap_pct(render, tx, frame));
+    }
+#endif
+
+    uint64_t requested, merged, flushed, bytes, window;
+    int64_t now = esp_timer_get_time();
+    int64_t elapsed;
+
+    portENTER_CRITICAL(&inv_lock);
+    requested = areas_requested;
+    merged = areas_merged;
+    flushed = areas_flushed;
+    bytes = bytes_flushed;
+    window = bytes_flushed - bytes_since;
+    elapsed = now - stats_since;
+    bytes_since = bytes_flushed;
+    stats_since = now;
+    portEXIT_CRITICAL(&inv_lock);
+
+    printf("Areas: %llu requested, %llu merged, %llu flushed\n", requested, merged, flushed);
+    printf("Sent %llu bytes, %llu bytes/s since last lcdstat\n", bytes,
+           elapsed > 0 ? (window * MICRO_PER_SECOND) / elapsed : 0);
+    return 0;
+}
+
+static void register_cmd_lcd_stats(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "lcdstat",
+        .help = "Show LCD flush timings and invalidation counters",
+        .hint = NULL,
+        .func = &lcd_stats,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
+
 /* Rotate display and touch, when rotated screen in LVGL. Called when driver parameters are updated. */
 static void lvgl_port_update_callback(lv_disp_drv_t *drv)
 {
@@ -108,33 +640,86 @@ static void lvgl_port_update_callback(lv_disp_drv_t *drv)
     }
 }
 
+#if !CONFIG_LV_TICK_CUSTOM
+static volatile uint32_t lvgl_ticks;
+
 // ISR ISR ISR ISR ISR
 static void increase_lvgl_tick(void *arg)
 {
     /* Tell LVGL how many milliseconds has elapsed */
     lv_tick_inc(LVGL_TICK_PERIOD_MS);
+    lvgl_ticks++;
+}
+#endif
 
+// Show how often the timers behind the UI wake the CPU, per second since the last query
+static int wakeups(int argc, char **argv) {
+    static int64_t since;
+    static uint32_t last_ticks, last_idle, last_refreshes;
     int64_t now = esp_timer_get_time();
+    int64_t elapsed = now - since;
+#if !CONFIG_LV_TICK_CUSTOM
+    uint32_t ticks = lvgl_ticks;
+#else
+    uint32_t ticks = 0; // LVGL reads the time itself
+#endif
+    uint32_t idle = idle_wakeups;
+    uint32_t refreshes = lvgl_refreshes;
+
+    printf("Over the last %lldms:\n", elapsed / 1000);
+    printf("LVGL tick %6.1f/s\n", (ticks - last_ticks) * (double)MICRO_PER_SECOND / elapsed);
+    printf("Idle timer %6.1f/s\n", (idle - last_idle) * (double)MICRO_PER_SECOND / elapsed);
+    printf("Refresh %6.1f/s\n", (refreshes - last_refreshes) * (double)MICRO_PER_SECOND / elapsed);
+
+    since = now;
+    last_ticks = ticks;
+    last_idle = idle;
+    last_refreshes = refreshes;
+    return 0;
+}
 
-    if(last_action == 0) {
-        // Initialize
-        last_action = now;
-        return;
-    }
+static int lvmem(int argc, char **argv) {
+    lv_mem_monitor_t mon;
 
-    if((now - last_action) > IDLE_TIME_uS) {
-        last_action=now; // Prevent repeat firing
-        ESP_LOGD(TAG, "Firing shutdown event");
-        // Trigger the deep sleep shutdown
-        ESP_ERROR_CHECK(esp_event_post_to(app_event_loop, APP_EVENT, APP_EVENT_SHUTDOWN, NULL, 0, (TickType_t)100));
-    }
+    LOCK_GUI_WAIT;
+    lv_mem_monitor(&mon);
+    UNLOCK_GUI;
+
+    printf("LVGL heap: %u bytes in %s\n", mon.total_size, LVGL_MEM_WHERE);
+    printf("Used %u bytes (%u%%) in %u blocks, peak %u bytes\n",
+           mon.total_size - mon.free_size, mon.used_pct, mon.used_cnt, mon.max_used);
+    printf("Free %u bytes in %u blocks, largest %u bytes, fragmentation %u%%\n",
+           mon.free_size, mon.free_cnt, mon.free_biggest_size, mon.frag_pct);
+
+    return 0;
+}
+
+static void register_cmd_lvmem(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "lvmem",
+        .help = "Show usage and fragmentation of the LVGL heap",
+        .hint = NULL,
+        .func = &lvmem,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
+
+static void register_cmd_wakeups(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "wakeups",
+        .help = "Show how often the UI timers wake the CPU",
+        .hint = NULL,
+        .func = &wakeups,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
 }
 
 static lv_disp_draw_buf_t disp_buf; // contains internal graphic buffer(s) called draw buffer(s)
 lv_disp_drv_t lvgl_disp_drv;      // contains callback functions
 
-lv_color_t *buf1=NULL;
-lv_color_t *buf2=NULL;
+lv_color_t *lvgl_bufs[LVGL_BUFFER_COUNT];
 
 void tembed_lvgl_alloc(void) {
     // Call this early to allocate the large LVGL buffers before DMA memory becomes fragmented
@@ -142,17 +727,17 @@ void tembed_lvgl_alloc(void) {
 
     // alloc draw buffers used by LVGL
     // it's recommended to choose the size of the draw buffer(s) to be at least 1/10 screen sized
-    buf1 = heap_caps_malloc(320 * LVGL_BUFFER_LINES * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_32BIT);
-    assert(buf1);
-    buf2 = heap_caps_malloc(320 * LVGL_BUFFER_LINES * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_32BIT);
-    assert(buf2);
-    ESP_LOGI(TAG, "Buffers allocated 2 x %d", 320 * LVGL_BUFFER_LINES * sizeof(lv_color_t));
+    for(int i=0;i<LVGL_BUFFER_COUNT;i++) {
+        lvgl_bufs[i] = heap_caps_malloc(LVGL_BUFFER_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_32BIT);
+        assert(lvgl_bufs[i]);
+    }
+    ESP_LOGI(TAG, "Buffers allocated %d x %d", LVGL_BUFFER_COUNT, LVGL_BUFFER_SIZE);
 
     heap_caps_print_heap_info(MALLOC_CAP_DMA | MALLOC_CAP_32BIT);
 }
 
 lv_disp_t *tembed_lvgl_init(tembed_t tembed) {
-    if(!buf1) {
+    if(!lvgl_bufs[0]) {
         ESP_LOGE(TAG, "Call alloc first!");
         ESP_ERROR_CHECK(ESP_ERR_INVALID_STATE);
     }
@@ -164,7 +749,18 @@ lv_disp_t *tembed_lvgl_init(tembed_t tembed) {
     lv_init();
 
     // initialize LVGL draw buffers
-    lv_disp_draw_buf_init(&disp_buf, buf1, buf2, 320 * LVGL_BUFFER_LINES);
+    lv_disp_draw_buf_init(&disp_buf, lvgl_bufs[0], lvgl_bufs[1], 320 * LVGL_BUFFER_LINES);
+
+#if CONFIG_APP_LCD_PIPELINED_FLUSH
+    // LVGL starts off rendering into the first buffer, the rest are free
+    for(int i=1;i<LVGL_BUFFER_COUNT;i++) {
+        free_bufs[free_count++] = lvgl_bufs[i];
+    }
+    flush_free = xSemaphoreCreateCounting(LVGL_BUFFER_COUNT, free_count);
+    flush_queue = xQueueCreate(LVGL_BUFFER_COUNT, sizeof(flush_job_t));
+    assert(flush_free && flush_queue);
+    xTaskCreatePinnedToCore(lvgl_flush_task, "lvgl_flush", 4096, tembed->lcd, 5, NULL, 1);
+#endif
 
     // heap_caps_print_heap_info(MALLOC_CAP_DMA);
 
@@ -181,14 +777,19 @@ lv_disp_t *tembed_lvgl_init(tembed_t tembed) {
     lv_disp_t *disp = lv_disp_drv_register(&lvgl_disp_drv);
     assert(disp);
 
+    lv_timer_set_cb(disp->refr_timer, lvgl_refr_timer_cb);
+
+#if !CONFIG_LV_TICK_CUSTOM
     ESP_LOGI(TAG, "Tick timer");
     // Tick interface for LVGL (using esp_timer to generate 2ms periodic event)
+    // With LV_TICK_CUSTOM LVGL reads esp_timer_get_time() itself instead
     const esp_timer_create_args_t lvgl_tick_timer_args = {
         .callback = &increase_lvgl_tick,
         .name = "lvgl_tick"
     };
     ESP_ERROR_CHECK(esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer));
     ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, LVGL_TICK_PERIOD_MS * 1000));
+#endif
 
     // Ensure the coordiate systems align with the physical display
     lv_disp_set_rotation(disp, LV_DISP_ROT_270);
@@ -200,6 +801,9 @@ lv_disp_t *tembed_lvgl_init(tembed_t tembed) {
     lv_scr_load(lv_blank);
 
     register_cmd_snapshot();
+    register_cmd_lcd_stats();
+    register_cmd_wakeups();
+    register_cmd_lvmem();
 
     lvgl_init_done = true;
 
@@ -21,6 +21,7 @@
 #include "iot_button.h"
 #include "iot_knob.h"
 #include "tembed.h"
+#include "tembed_wifi.h"
 #include "nvs_flash.h"
 #include "esp_wifi.h"
 #include "tembed_lvgl.h"
@@ -36,7 +37,15 @@
 #include "cmd_system.h"
 #include "cmd_wifi.h"
 #include "cmd_nvs.h"
+#include "cmd_sdcard.h"
+#include "sd_io.h"
+#include "img_stream.h"
+#include "anim.h"
+#include "sd_log.h"
+#include "sd_cache.h"
 #include "nvs_flash.h"
+#include "boot.h"
+#include "ui_sched.h"
 
 // Bluetooth support
 #include "esp_bt.h"
@@ -47,6 +56,9 @@
 #include "esp_gatt_common_api.h"
 
 #include "gatt_profile.h"
+#include "ble_cache.h"
+#include "ble_store.h"
+#include "ble_filter.h"
 
 static const char *TAG="tembed";
 
@@ -54,7 +66,7 @@ static const char *TAG="tembed";
 
 tembed_t tembed;
 gui_t *gui;
-extern panel_t *main_scr_init(gui_t *gui);
+extern panel_t *main_scr_init();
 
 // TODO: Move these to tembed.c
 extern sdmmc_card_t *sdcard_init();
@@ -72,7 +84,7 @@ esp_timer_handle_t periodic_timer;
 
 static void periodic_timer_callback(void* arg)
 {
-    ESP_ERROR_CHECK(esp_event_post_to(app_event_loop, APP_EVENT, APP_EVENT_TICK, NULL, 0, (TickType_t)100));
+    ESP_ERROR_CHECK(app_event_post(APP_EVENT_TICK, NULL, 0, (TickType_t)100));
 }
 
 // Called when the APP_EVENT_SHUTDOWN is fired
@@ -82,11 +94,21 @@ static void idle_watchdog(void *event_handler_arg, esp_event_base_t event_base,
     gui_free(gui);
 
     ESP_LOGI(TAG, "Shutdown periphs");
+    ble_store_save();
     // TODO: What other services need shutdown here?
     ESP_ERROR_CHECK(tembed->goto_sleep(tembed));
     if(card) {
         ESP_LOGI(TAG,"SDCARD");
-        ESP_ERROR_CHECK(esp_vfs_fat_sdcard_unmount("/sdcard", card));
+        // The log task may still have its file open, only unmount once it has stopped
+        esp_err_t err = sd_log_stop();
+        for(int retry=0; err == ESP_ERR_TIMEOUT && retry < 2; retry++) {
+            err = sd_log_stop();
+        }
+        if(err == ESP_OK) {
+            ESP_ERROR_CHECK(esp_vfs_fat_sdcard_unmount("/sdcard", card));
+        } else {
+            ESP_LOGW(TAG, "SD log still writing, card left mounted");
+        }
         // sdmmc_host_deinit(); // Is this needed?
     }
     ESP_LOGI(TAG, "Periphs Done");
@@ -110,19 +132,17 @@ static void idle_watchdog(void *event_handler_arg, esp_event_base_t event_base,
     esp_deep_sleep_start();
 }
 
-void sdcard_init_task( void *pvParameters )
-{
+static void init_sdcard() {
     card=sdcard_init(); // TODO: Move this to tembed.c
     if(card) {
-        ESP_ERROR_CHECK(esp_event_post_to(app_event_loop, APP_EVENT, APP_EVENT_SDCARD_INIT, NULL, 0, (TickType_t)100));
+        if(sd_io_init() != ESP_OK) {
+            ESP_LOGE(TAG, "SD I/O service not started");
+        }
+        if(sd_log_init() != ESP_OK) {
+            ESP_LOGE(TAG, "SD card log not started");
+        }
+        ESP_ERROR_CHECK(app_event_post(APP_EVENT_SDCARD_INIT, NULL, 0, (TickType_t)100));
     }
-    /* Tasks must not attempt to return from their implementing
-       function or otherwise exit.  In newer FreeRTOS port
-       attempting to do so will result in an configASSERT() being
-       called if it is defined.  If it is necessary for a task to
-       exit then have the task call vTaskDelete( NULL ) to ensure
-       its exit is clean. */
-    vTaskDelete( NULL );
 }
 
 static void init_bt() {
@@ -132,6 +152,7 @@ static void init_bt() {
     ESP_ERROR_CHECK(esp_bt_controller_enable(ESP_BT_MODE_BLE));
     ESP_ERROR_CHECK(esp_bluedroid_init());
     ESP_ERROR_CHECK(esp_bluedroid_enable());
+    ESP_ERROR_CHECK(ble_cache_init());
     ESP_ERROR_CHECK(esp_ble_gap_register_callback(esp_gap_cb));
     ESP_ERROR_CHECK(esp_ble_gattc_register_callback(esp_gattc_cb));
     ESP_ERROR_CHECK(esp_ble_gattc_app_register(PROFILE_A_APP_ID));
@@ -178,25 +199,7 @@ static void wifi_active(void *event_handler_arg, esp_event_base_t event_base, in
     sidebar_wifi_state(gui->sidebar, WIFI_ACTIVE);
 }
 
-void app_main(void)
-{
-    ACTION(); // Reset the idle watchdog
-
-    ESP_LOGI(TAG,"Hello T-Embed!");
-
-    // Do these as early as possible to try to avoid race conditions
-    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
-
-    // Set timezone to UTC-6. Note posix reverses the sign for some reason
-    setenv("TZ", "UTC+6", 1);
-    tzset();
-
-    chip_info();
-
-    // Do this early to allocate large buffers before fragmentation.
-    // TODO: Can we do this using static?
-    tembed_lvgl_alloc();
-
+static void init_nvs() {
     // Initialize NVS (used to persist WiFi settings)
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -204,32 +207,40 @@ void app_main(void)
         ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK(ret);
+}
 
-    // Create the application event loop
-    esp_event_loop_args_t event_loop_args = {
-        .queue_size = 5,
-        .task_name = NULL
-    };
-    ESP_ERROR_CHECK(esp_event_loop_create(&event_loop_args, &app_event_loop));
-    ESP_ERROR_CHECK(esp_event_handler_register_with(app_event_loop, APP_EVENT, APP_EVENT_SHUTDOWN, idle_watchdog, NULL));
-    ESP_ERROR_CHECK(esp_event_handler_register_with(app_event_loop, APP_EVENT, APP_EVENT_WIFI_SCAN, wifi_scan_start, NULL));
-    ESP_ERROR_CHECK(esp_event_handler_register_with(app_event_loop, APP_EVENT, APP_EVENT_WIFI_ACTIVE, wifi_active, NULL));
-
-    // Initialize the T-Embed
-    tembed = tembed_init(notify_lvgl_flush_ready, &lvgl_disp_drv);
-
+#ifdef CONFIG_TEMBED_INIT_LEDS
+static void init_leds() {
+    tembed_init_leds();
     // Turn on the LEDs (just a demo)
     leds(tembed);
+}
+#endif
+
+#ifdef CONFIG_TEMBED_INIT_LCD
+static void init_lcd() {
+    tembed_init_lcd(notify_lvgl_flush_ready, &lvgl_disp_drv);
+}
+#endif
 
+static void init_lvgl() {
     // Configure LVGL to use the 1.7" LCD on the T-Embed
     tembed_lvgl_init(tembed);
+    if(sd_cache_init() != ESP_OK) {
+        ESP_LOGE(TAG, "SD card cache not allocated");
+    }
+    img_stream_init();
+}
 
+static void init_gui() {
     ESP_LOGI(TAG, "Display App Shell");
     gui = gui_init(tembed);
-    active_scr = main_scr_init(gui);
+    active_scr = gui_panel_get(main_scr_init);
     gui_set_panel(gui, active_scr);
+}
 
 #if CONFIG_TEMBED_INIT_WIFI
+static void init_wifi_connect() {
     esp_err_t res=esp_wifi_connect();
     switch(res) {
         // If we get this error, the stored SSID isn't valid
@@ -244,19 +255,10 @@ void app_main(void)
         sidebar_wifi_state(gui->sidebar, WIFI_ACTIVE);
     }
     }
+}
 #endif
 
-    // Setup a timer to tick once per second
-    const esp_timer_create_args_t periodic_timer_args = {
-        .callback = &periodic_timer_callback,
-        .name = "tick"
-    };
-    ESP_ERROR_CHECK(esp_timer_create(&periodic_timer_args, &periodic_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(periodic_timer, 1000000));
-
-    // Begin initializing the SD card in the background
-    xTaskCreate(sdcard_init_task,"sdcard_init", 4096, NULL, 1, NULL);
-
+static void init_console() {
     esp_console_repl_t *repl = NULL;
     esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
     /* Prompt to be printed before each line.
@@ -272,18 +274,114 @@ void app_main(void)
     register_wifi();
 #endif
     register_nvs();
+    register_sdcard();
+    register_cmd_sdio();
+    register_cmd_img();
+    register_cmd_play();
+    register_cmd_sdlog();
+    register_cmd_fscache();
+    register_cmd_blebench();
+    register_cmd_blecache();
+    register_cmd_blenear();
+    register_cmd_blenames();
+    register_cmd_blestore();
+    register_cmd_advbench();
+    register_cmd_blefilter();
+    register_cmd_boot();
+    register_cmd_uistat();
+    register_cmd_panels();
     ESP_ERROR_CHECK(esp_console_start_repl(repl));
+}
 
-    init_bt();
-
-    // Main loop - this is exited if the idle timer runs out and the system enters deep sleep
-    while (1) {
-        // raise the task priority of LVGL and/or reduce the handler period can improve the performance
-        // vTaskDelay(pdMS_TO_TICKS(10)); - Removed as we use the event loop
-        LOCK_GUI;
-        // The task running lv_timer_handler should have lower priority than that running `lv_tick_inc`
-        lv_timer_handler();
-        UNLOCK_GUI;
-        ESP_ERROR_CHECK(esp_event_loop_run(app_event_loop, pdMS_TO_TICKS(10)));
-    }
+// Boot stages and their dependencies. The display chain runs on core 1 and
+// the radios on core 0, next to the WiFi and BT stacks.
+// Console commands are not thread safe to register, so stages which register
+// commands must be dependencies of the console stage.
+// WiFi and BT share the PHY calibration, so they are brought up in turn.
+static const boot_stage_t boot_stages[BOOT_STAGE_COUNT] = {
+    [BOOT_NVS] = { "nvs", init_nvs, 0, 0, 4096 },
+#ifdef CONFIG_TEMBED_INIT_DIAL
+    [BOOT_DIAL] = { "dial", tembed_init_dial, 0, 1, 4096 },
+#else
+    [BOOT_DIAL] = { "dial" },
+#endif
+#ifdef CONFIG_TEMBED_INIT_LEDS
+    [BOOT_LEDS] = { "leds", init_leds, 0, 1, 4096 },
+#else
+    [BOOT_LEDS] = { "leds" },
+#endif
+#ifdef CONFIG_TEMBED_INIT_LCD
+    [BOOT_LCD] = { "lcd", init_lcd, 0, 1, 4096 },
+#else
+    [BOOT_LCD] = { "lcd" },
+#endif
+    [BOOT_LVGL] = { "lvgl", init_lvgl, BOOT_BIT(BOOT_LCD), 1, 4096 },
+#if CONFIG_TEMBED_INIT_WIFI
+    [BOOT_WIFI] = { "wifi", tembed_init_wifi, BOOT_BIT(BOOT_NVS), 0, 4096 },
+    [BOOT_WIFI_CONNECT] = { "wifi_connect", init_wifi_connect, BOOT_BIT(BOOT_WIFI) | BOOT_BIT(BOOT_GUI), 0, 4096 },
+    [BOOT_SNTP] = { "sntp", initialize_sntp, BOOT_BIT(BOOT_WIFI), 0, 4096 },
+#else
+    [BOOT_WIFI] = { "wifi" },
+    [BOOT_WIFI_CONNECT] = { "wifi_connect" },
+    [BOOT_SNTP] = { "sntp" },
+#endif
+    // The screens need the knob and check for a network interface
+    [BOOT_GUI] = { "gui", init_gui, BOOT_BIT(BOOT_LVGL) | BOOT_BIT(BOOT_DIAL) | BOOT_BIT(BOOT_WIFI), 1, 6144 },
+    [BOOT_BT] = { "bt", init_bt, BOOT_BIT(BOOT_NVS) | BOOT_BIT(BOOT_WIFI), 0, 4096 },
+    [BOOT_SD] = { "sd", init_sdcard, 0, 1, 4096 },
+    [BOOT_CONSOLE] = { "console", init_console, BOOT_BIT(BOOT_LVGL), 0, 4096 },
+};
+
+void app_main(void)
+{
+    ACTION(); // Reset the idle watchdog
+
+    ESP_LOGI(TAG,"Hello T-Embed!");
+
+    // Do these as early as possible to try to avoid race conditions
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+
+    // Set timezone to UTC-6. Note posix reverses the sign for some reason
+    setenv("TZ", "UTC+6", 1);
+    tzset();
+
+    chip_info();
+
+    // Do this early to allocate large buffers before fragmentation.
+    // TODO: Can we do this using static?
+    tembed_lvgl_alloc();
+
+    // Create the application event loop
+    esp_event_loop_args_t event_loop_args = {
+        .queue_size = 5,
+        .task_name = NULL
+    };
+    ESP_ERROR_CHECK(esp_event_loop_create(&event_loop_args, &app_event_loop));
+    ESP_ERROR_CHECK(esp_event_handler_register_with(app_event_loop, APP_EVENT, APP_EVENT_SHUTDOWN, idle_watchdog, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register_with(app_event_loop, APP_EVENT, APP_EVENT_WIFI_SCAN, wifi_scan_start, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register_with(app_event_loop, APP_EVENT, APP_EVENT_WIFI_ACTIVE, wifi_active, NULL));
+
+    // Go to sleep when left alone for too long
+    idle_init();
+
+    // Let other tasks queue UI updates from the start
+    ui_init();
+
+    // Power up the T-Embed peripherals, then bring up everything else
+    tembed = tembed_init_power();
+    boot_start(boot_stages);
+
+    // The UI can run as soon as the first screen is built
+    boot_wait(BOOT_BIT(BOOT_GUI));
+
+    // Setup a timer to tick once per second
+    const esp_timer_create_args_t periodic_timer_args = {
+        .callback = &periodic_timer_callback,
+        .name = "tick"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&periodic_timer_args, &periodic_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(periodic_timer, 1000000));
+
+    // Hand LVGL over to the UI task, which runs until the idle timer puts the system into deep sleep
+    ui_start();
 }
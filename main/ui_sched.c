@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_console.h"
+#include "lvgl.h"
+#include "scr.h"
+#include "app_event.h"
+#include "boot.h"
+#include "ui_sched.h"
+
+static const char *TAG="ui_sched";
+
+#define UI_POST_WAIT pdMS_TO_TICKS(100)
+
+static TaskHandle_t ui_task = NULL;
+
+typedef struct {
+    ui_fn_t fn;
+    void *ctx;
+    uintptr_t arg;
+    int64_t posted;
+} ui_cmd_t;
+
+static QueueHandle_t ui_queue = NULL;
+
+// Events posted to app_event_loop but not yet dispatched
+static uint32_t ui_events_pending;
+
+// Loop statistics, all times in us
+typedef struct {
+    uint64_t iterations;
+    uint64_t woken; // Sleeps ended by ui_wake() rather than a timer
+    uint64_t events;
+    uint64_t commands;
+    uint64_t sleep_us;
+    uint64_t render_us;
+    uint64_t events_us; // Events and commands
+    uint64_t latency_us; // From ui_post to the command running
+    uint32_t max_render_us;
+    uint32_t max_events_us;
+    uint32_t max_latency_us;
+    uint32_t max_depth;
+    uint32_t dropped;
+} ui_stats_t;
+
+static ui_stats_t ui_stats;
+static portMUX_TYPE ui_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+bool ui_is_ui_task(void) {
+    return ui_task && xTaskGetCurrentTaskHandle() == ui_task;
+}
+
+bool ui_in_context(void) {
+    return !ui_task || xTaskGetCurrentTaskHandle() == ui_task;
+}
+
+void ui_wake(void) {
+    if(ui_task && xTaskGetCurrentTaskHandle() != ui_task) {
+        xTaskNotifyGive(ui_task);
+    }
+}
+
+esp_err_t app_event_post(int32_t event_id, const void *event_data, size_t event_data_size, TickType_t ticks_to_wait) {
+    esp_err_t err = esp_event_post_to(app_event_loop, APP_EVENT, event_id, (void *)event_data, event_data_size, ticks_to_wait);
+    if(err == ESP_OK) {
+        __atomic_fetch_add(&ui_events_pending, 1, __ATOMIC_RELEASE);
+        ui_wake();
+    }
+    return err;
+}
+
+esp_err_t ui_post(ui_fn_t fn, void *ctx, uintptr_t arg) {
+    if(ui_is_ui_task()) {
+        // Already own the GUI, and waiting on our own queue would deadlock
+        fn(ctx, arg);
+        return ESP_OK;
+    }
+
+    ui_cmd_t cmd = { .fn = fn, .ctx = ctx, .arg = arg, .posted = esp_timer_get_time() };
+    if(xQueueSend(ui_queue, &cmd, UI_POST_WAIT) != pdTRUE) {
+        portENTER_CRITICAL(&ui_stats_lock);
+        ui_stats.dropped++;
+        portEXIT_CRITICAL(&ui_stats_lock);
+        ESP_LOGE(TAG, "UI queue full, command dropped");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    uint32_t depth = uxQueueMessagesWaiting(ui_queue);
+    portENTER_CRITICAL(&ui_stats_lock);
+    if(depth > ui_stats.max_depth) ui_stats.max_depth = depth;
+    portEXIT_CRITICAL(&ui_stats_lock);
+
+    ui_wake();
+    return ESP_OK;
+}
+
+// Run the queued commands, returns the number run
+static uint32_t ui_run_commands(uint64_t *latency_us, uint32_t *max_latency_us) {
+    ui_cmd_t cmd;
+    uint32_t n = 0;
+
+    while(xQueueReceive(ui_queue, &cmd, 0) == pdTRUE) {
+        int64_t latency = esp_timer_get_time() - cmd.posted;
+        *latency_us += latency;
+        if(latency > *max_latency_us) *max_latency_us = latency;
+        cmd.fn(cmd.ctx, cmd.arg);
+        n++;
+    }
+    return n;
+}
+
+// The UI task holds the GUI lock while it is awake and only lets go to sleep,
+// so commands and app event handlers run with the GUI locked
+static void ui_task_fn(void *arg) {
+    bool woken = false;
+
+    ESP_LOGI(TAG, "UI task running on core %d", xPortGetCoreID());
+
+    while (1) {
+        int64_t start = esp_timer_get_time();
+        uint64_t latency_us = 0;
+        uint32_t max_latency_us = 0;
+
+        LOCK_GUI_WAIT;
+
+        uint32_t commands = ui_run_commands(&latency_us, &max_latency_us);
+
+        // esp_event_loop_run with no wait dispatches at most one event per call
+        uint32_t events = __atomic_exchange_n(&ui_events_pending, 0, __ATOMIC_ACQUIRE);
+        for(uint32_t i=0;i<events;i++) {
+            ESP_ERROR_CHECK(esp_event_loop_run(app_event_loop, 0));
+        }
+
+        int64_t handled = esp_timer_get_time();
+
+        if(woken || commands || events) {
+            // Something changed the widgets, show it now rather than at the
+            // next refresh period
+            lv_disp_t *disp = lv_disp_get_default();
+            if(disp && disp->refr_timer) lv_timer_ready(disp->refr_timer);
+        }
+        uint32_t next_ms = lv_timer_handler();
+
+        xSemaphoreGiveRecursive(gui_mutex);
+        boot_first_frame();
+
+        int64_t rendered = esp_timer_get_time();
+
+        woken = false;
+        if(!__atomic_load_n(&ui_events_pending, __ATOMIC_ACQUIRE) && !uxQueueMessagesWaiting(ui_queue)) {
+            TickType_t ticks = portMAX_DELAY;
+            if(next_ms != LV_NO_TIMER_READY) {
+                // Round up, waking early just spins until the timer is due
+                ticks = (next_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+            }
+            woken = ulTaskNotifyTake(pdTRUE, ticks) != 0;
+        }
+
+        int64_t end = esp_timer_get_time();
+
+        portENTER_CRITICAL(&ui_stats_lock);
+        ui_stats.iterations++;
+        ui_stats.woken += woken;
+        ui_stats.events += events;
+        ui_stats.commands += commands;
+        ui_stats.latency_us += latency_us;
+        ui_stats.events_us += handled - start;
+        ui_stats.render_us += rendered - handled;
+        ui_stats.sleep_us += end - rendered;
+        if(rendered - handled > ui_stats.max_render_us) ui_stats.max_render_us = rendered - handled;
+        if(handled - start > ui_stats.max_events_us) ui_stats.max_events_us = handled - start;
+        if(max_latency_us > ui_stats.max_latency_us) ui_stats.max_latency_us = max_latency_us;
+        portEXIT_CRITICAL(&ui_stats_lock);
+    }
+}
+
+void ui_init(void) {
+    ui_queue = xQueueCreate(CONFIG_APP_UI_QUEUE_DEPTH, sizeof(ui_cmd_t));
+    assert(ui_queue);
+}
+
+void ui_start(void) {
+    BaseType_t res = xTaskCreatePinnedToCore(ui_task_fn, "ui", CONFIG_APP_UI_TASK_STACK, NULL,
+                                             CONFIG_APP_UI_TASK_PRIORITY, &ui_task, CONFIG_APP_UI_TASK_CORE);
+    assert(res == pdPASS);
+}
+
+// Show the UI loop statistics since the last query
+static int uistat(int argc, char **argv) {
+    static ui_stats_t last;
+    static int64_t since;
+    ui_stats_t now_stats;
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&ui_stats_lock);
+    now_stats = ui_stats;
+    ui_stats.max_render_us = 0;
+    ui_stats.max_events_us = 0;
+    ui_stats.max_latency_us = 0;
+    ui_stats.max_depth = 0;
+    portEXIT_CRITICAL(&ui_stats_lock);
+
+    uint64_t n = now_stats.iterations - last.iterations;
+    uint64_t commands = now_stats.commands - last.commands;
+    printf("Over the last %lldms: %llu iterations, %llu woken early, %llu events, %llu commands\n",
+           (now - since) / 1000, n, now_stats.woken - last.woken, now_stats.events - last.events, commands);
+    if(n) {
+        printf("Per iteration: sleep %lluus, render %lluus (max %u), events and commands %lluus (max %u)\n",
+               (now_stats.sleep_us - last.sleep_us) / n,
+               (now_stats.render_us - last.render_us) / n, now_stats.max_render_us,
+               (now_stats.events_us - last.events_us) / n, now_stats.max_events_us);
+    }
+    printf("Command queue: %u of %d queued, high water %u, %u dropped\n",
+           uxQueueMessagesWaiting(ui_queue), CONFIG_APP_UI_QUEUE_DEPTH, now_stats.max_depth,
+           now_stats.dropped - last.dropped);
+    if(commands) {
+        printf("Command latency: average %lluus, max %uus\n",
+               (now_stats.latency_us - last.latency_us) / commands, now_stats.max_latency_us);
+    }
+
+    last = now_stats;
+    since = now;
+    return 0;
+}
+
+void register_cmd_uistat(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "uistat",
+        .help = "Show UI loop sleep, render and event handling times",
+        .hint = NULL,
+        .func = &uistat,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
@@ -1,23 +1,103 @@
 #!/usr/bin/python3
 import argparse
-import os
-from PIL import Image, ImageOps
+import base64
 import struct
+import zlib
+from PIL import Image, ImageOps
 
-width = 170
-height = 320
-png = Image.new('RGB', (width, height))
+SNAP_PREFIX = 'snap:'
 
-with open('snap.raw', 'rb') as input_file:
-   src = input_file.read()
-stream = struct.unpack('<' + str(len(src) // 2) + "H", src)
 
-for i, word in enumerate(stream):
+def rgb565(word):
     r = (word >> 11) & 0x1F
     g = (word >> 5) & 0x3F
     b = (word) & 0x1F
-    png.putpixel((i % width, i // width), (r << 3, g << 2, b << 3))
+    return (r << 3, g << 2, b << 3)
+
+
+def rle565_decode(data, pixels, swap):
+    i = 0
+    while i < len(data):
+        ctl = data[i]
+        i += 1
+        if ctl < 0x80:
+            n = ctl + 1
+            words = struct.unpack_from('<' + str(n) + 'H', data, i)
+            i += n * 2
+        else:
+            n = ctl - 0x80 + 2
+            words = struct.unpack_from('<H', data, i) * n
+            i += 2
+        if swap:
+            words = [((w & 0xFF) << 8) | (w >> 8) for w in words]
+        pixels.extend(words)
+
+
+def decode_binary(lines):
+    header = None
+    pixels = []
+    expected_seq = 0
+    end = None
+    for line in lines:
+        pos = line.find(SNAP_PREFIX)
+        if pos < 0:
+            continue
+        frame = base64.b64decode(line[pos + len(SNAP_PREFIX):].strip())
+        ftype, seq, length = struct.unpack_from('<BHH', frame)
+        payload = frame[5:5 + length]
+        (crc,) = struct.unpack_from('<I', frame, 5 + length)
+        if zlib.crc32(frame[:5 + length]) != crc:
+            raise SystemExit('Frame %d: bad checksum' % seq)
+        if ftype == ord('H'):
+            # A new header starts a new snapshot, keep the last one in the log
+            header = struct.unpack_from('<HHBBBB', payload)
+            pixels = []
+            expected_seq = 0
+            end = None
+        if header is None:
+            continue
+        if seq != expected_seq:
+            raise SystemExit('Frame %d: expected %d, frames lost' % (seq, expected_seq))
+        expected_seq += 1
+        if ftype == ord('D'):
+            rle565_decode(payload, pixels, header[4])
+        elif ftype == ord('E'):
+            end = struct.unpack_from('<II', payload)
+
+    if header is None or end is None:
+        raise SystemExit('No complete snapshot found')
+    width, height, cf, depth, swap, version = header
+    if depth != 16:
+        raise SystemExit('Unsupported colour depth %d' % depth)
+    if len(pixels) != end[0] or len(pixels) != width * height:
+        raise SystemExit('Expected %d pixels, got %d' % (width * height, len(pixels)))
+
+    png = Image.new('RGB', (width, height))
+    png.putdata([rgb565(word) for word in pixels])
+    return png
+
+
+def decode_raw(src, width, height):
+    png = Image.new('RGB', (width, height))
+    stream = struct.unpack('<' + str(len(src) // 2) + "H", src)
+    for i, word in enumerate(stream):
+        png.putpixel((i % width, i // width), rgb565(word))
+
+    png_r = png.rotate(270, expand=True)
+    return ImageOps.mirror(png_r)
+
+
+parser = argparse.ArgumentParser(description='Convert a T-Embed screen snapshot to PNG')
+parser.add_argument('input', nargs='?', default='snap.log',
+                    help='console log containing a "snap -b" capture (default snap.log)')
+parser.add_argument('-r', '--raw', help='legacy raw file made from the "snap" hex dump')
+parser.add_argument('-o', '--output', default='snap.png', help='output PNG (default snap.png)')
+args = parser.parse_args()
 
-png_r = png.rotate(270, expand=True)
-png_m = ImageOps.mirror(png_r)
-png_m.save('snap.png')
+if args.raw:
+    with open(args.raw, 'rb') as input_file:
+        image = decode_raw(input_file.read(), 170, 320)
+else:
+    with open(args.input, 'r', errors='replace') as input_file:
+        image = decode_binary(input_file)
+image.save(args.output)
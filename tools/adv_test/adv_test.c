@@ -0,0 +1,185 @@
+// Host checks and benchmark for ble_adv_parse. The parser is built from
+// main/ble_adv.c as is, so the recorded payloads are the ones advbench uses
+// on the device.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ble_adv.c"
+
+static int failures;
+
+#define CHECK(name, cond) do { \
+        if(!(cond)) { \
+            printf("FAIL %s: %s (line %d)\n", name, #cond, __LINE__); \
+            failures++; \
+        } \
+    } while(0)
+
+static const bench_payload_t *payload(const char *name) {
+    for(int p=0; p<BENCH_PAYLOADS; p++) {
+        if(strcmp(bench_payloads[p].name, name) == 0) return &bench_payloads[p];
+    }
+    printf("FAIL no payload %s\n", name);
+    exit(1);
+}
+
+// Every field found must lie inside the data given
+static void check_bounds(const char *name, const ble_adv_t *adv, uint32_t end) {
+    const ble_adv_field_t *fields[] = {
+        &adv->name, &adv->manufacturer, &adv->uuid16, &adv->uuid32, &adv->uuid128, &adv->service_data16,
+    };
+    if(end > BLE_ADV_DATA_MAX) end = BLE_ADV_DATA_MAX;
+    for(int f=0; f<sizeof(fields) / sizeof(fields[0]); f++) {
+        if(fields[f]->len) CHECK(name, fields[f]->ofs + fields[f]->len <= end);
+    }
+}
+
+static bool name_is(const ble_adv_t *adv, const char *name) {
+    return adv->name.len == strlen(name) && memcmp(ble_adv_ptr(adv, adv->name), name, adv->name.len) == 0;
+}
+
+static void test_recorded(void) {
+    ble_adv_t adv;
+    const bench_payload_t *p;
+
+    p = payload("iBeacon");
+    ble_adv_parse(&adv, p->data, p->adv_len, p->rsp_len);
+    CHECK(p->name, adv.flags == 0x06);
+    CHECK(p->name, ble_adv_company(&adv) == 0x004c);
+    CHECK(p->name, adv.manufacturer.len == 25);
+    CHECK(p->name, adv.name.len == 0);
+    CHECK(p->name, adv.tx_power == BLE_ADV_NO_TX_POWER);
+
+    p = payload("Eddystone URL");
+    ble_adv_parse(&adv, p->data, p->adv_len, p->rsp_len);
+    CHECK(p->name, ble_adv_has_uuid16(&adv, 0xfeaa));
+    CHECK(p->name, adv.service_data16.len == 13);
+    CHECK(p->name, ble_adv_company(&adv) == BLE_ADV_NO_COMPANY);
+
+    p = payload("Heart rate sensor");
+    ble_adv_parse(&adv, p->data, p->adv_len, p->rsp_len);
+    CHECK(p->name, ble_adv_has_uuid16(&adv, 0x180d));
+    CHECK(p->name, ble_adv_has_uuid16(&adv, 0x180f));
+    CHECK(p->name, !ble_adv_has_uuid16(&adv, 0x1810));
+    CHECK(p->name, adv.appearance == 0x0341);
+    CHECK(p->name, adv.tx_power == 4);
+    CHECK(p->name, adv.name_complete && name_is(&adv, "HRM 4412")); // In the scan response
+
+    p = payload("Phone");
+    ble_adv_parse(&adv, p->data, p->adv_len, p->rsp_len);
+    CHECK(p->name, adv.flags == 0x1a);
+    CHECK(p->name, ble_adv_company(&adv) == 0x004c);
+
+    p = payload("Headphones");
+    ble_adv_parse(&adv, p->data, p->adv_len, p->rsp_len);
+    CHECK(p->name, ble_adv_has_uuid128(&adv, p->data + 5));
+    CHECK(p->name, !adv.name_complete && name_is(&adv, "Buds"));
+    CHECK(p->name, adv.tx_power == -12);
+    CHECK(p->name, ble_adv_company(&adv) == 0x0075);
+
+    for(int i=0; i<BENCH_PAYLOADS; i++) {
+        p = &bench_payloads[i];
+        ble_adv_parse(&adv, p->data, p->adv_len, p->rsp_len);
+        check_bounds(p->name, &adv, p->adv_len + p->rsp_len);
+    }
+}
+
+static void test_malformed(void) {
+    ble_adv_t adv;
+
+    // A length running past the end of the data
+    static const uint8_t overrun[BLE_ADV_DATA_MAX] = { 0x02, 0x01, 0x06, 0x1f, 0xff, 0x4c, 0x00 };
+    ble_adv_parse(&adv, overrun, 7, 0);
+    CHECK("overrun", adv.flags == 0x06);
+    CHECK("overrun", adv.manufacturer.len == 0);
+
+    // A length byte with nothing after it
+    static const uint8_t last_byte[BLE_ADV_DATA_MAX] = { 0x02, 0x01, 0x06, 0x05 };
+    ble_adv_parse(&adv, last_byte, 4, 0);
+    CHECK("last byte", adv.flags == 0x06);
+
+    // Fields too short for their value are ignored
+    static const uint8_t short_fields[BLE_ADV_DATA_MAX] = { 0x01, 0x01, 0x01, 0x0a, 0x02, 0x19, 0x41, 0x01, 0xff };
+    ble_adv_parse(&adv, short_fields, 9, 0);
+    CHECK("short fields", adv.flags == 0);
+    CHECK("short fields", adv.tx_power == BLE_ADV_NO_TX_POWER);
+    CHECK("short fields", adv.appearance == 0);
+    CHECK("short fields", ble_adv_company(&adv) == BLE_ADV_NO_COMPANY);
+
+    // Zero padding ends the advertising data, the scan response is still read
+    static const uint8_t padded[BLE_ADV_DATA_MAX] = { 0x02, 0x01, 0x06, 0x00, 0x00, 0x00, 0x03, 0x09, 'H', 'i' };
+    ble_adv_parse(&adv, padded, 6, 4);
+    CHECK("padded", adv.flags == 0x06);
+    CHECK("padded", name_is(&adv, "Hi"));
+
+    // Lengths claiming more than the buffer holds
+    uint8_t full[BLE_ADV_DATA_MAX];
+    memset(full, 0xff, sizeof(full));
+    ble_adv_parse(&adv, full, 255, 255);
+    check_bounds("lengths", &adv, BLE_ADV_DATA_MAX);
+
+    // The complete name wins over a shortened one in either order
+    static const uint8_t names[BLE_ADV_DATA_MAX] = { 0x03, 0x09, 'A', 'B', 0x02, 0x08, 'C' };
+    ble_adv_parse(&adv, names, 7, 0);
+    CHECK("names", adv.name_complete && name_is(&adv, "AB"));
+
+    ble_adv_parse(&adv, padded, 0, 0);
+    CHECK("empty", adv.flags == 0 && adv.name.len == 0);
+
+    // Random data, only checked for staying inside the buffer
+    srand(1);
+    for(int n=0; n<200000; n++) {
+        uint8_t buf[BLE_ADV_DATA_MAX];
+        for(int i=0; i<sizeof(buf); i++) {
+            // Mostly small lengths, so that fields chain
+            buf[i] = rand() & (n & 1 ? 0x1f : 0xff);
+        }
+        uint8_t adv_len = rand() % 40;
+        uint8_t rsp_len = rand() % 40;
+        ble_adv_parse(&adv, buf, adv_len, rsp_len);
+        check_bounds("random", &adv, adv_len + rsp_len);
+        if(failures) break;
+    }
+}
+
+static int64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void bench(int count) {
+    printf("%d parses of each payload\n", count);
+    printf("Payload             Parser/s\n");
+    for(int p=0; p<BENCH_PAYLOADS; p++) {
+        const bench_payload_t *payload = &bench_payloads[p];
+        ble_adv_t adv;
+        volatile uint32_t sink = 0; // Keeps the results live
+        int64_t start = now_us();
+        for(int i=0; i<count; i++) {
+            ble_adv_parse(&adv, payload->data, payload->adv_len, payload->rsp_len);
+            sink += adv.name.len + adv.manufacturer.len + adv.uuid16.len + adv.tx_power + adv.appearance;
+        }
+        int64_t us = now_us() - start;
+        (void)sink;
+        printf("%-18s %9llu\n", payload->name, us > 0 ? (unsigned long long)count * 1000000 / us : 0);
+    }
+}
+
+int main(int argc, char **argv) {
+    if(argc > 1 && strcmp(argv[1], "-b") == 0) {
+        bench(argc > 2 ? atoi(argv[2]) : 10000000);
+        return 0;
+    }
+
+    test_recorded();
+    test_malformed();
+    if(failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,185 @@
+// Host checks and benchmark for the BLE device cache index. The index is
+// built from main/include/ble_index.h as is, and timed the way blebench
+// times it on the device: reports from a set of simulated devices in random
+// order, added to a cache which doesn't evict. With more devices than
+// BLE_CACHE_MAX the extra ones are all misses, as in a busy environment.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// About the size of struct ble_cache_entry on the device, so the linear
+// search walks as much memory
+struct bench_entry {
+    uint8_t bda[6];
+    uint8_t rest[34];
+};
+
+#define BLE_INDEX_ENTRY struct bench_entry
+#include "ble_index.h"
+
+static int failures;
+
+#define CHECK(name, cond) do { \
+        if(!(cond)) { \
+            printf("FAIL %s: %s (line %d)\n", name, #cond, __LINE__); \
+            failures++; \
+        } \
+    } while(0)
+
+static struct bench_entry entries[BLE_CACHE_MAX];
+static int16_t index_slots[BLE_INDEX_SIZE];
+static int count;
+
+static inline uint32_t bench_next(uint32_t *x) {
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+static void random_bdas(uint8_t (*bdas)[6], int n, uint32_t *x) {
+    for(int i=0; i<n; i++) {
+        for(int b=0; b<6; b++) bdas[i][b] = bench_next(x);
+    }
+}
+
+static int linear_find(const uint8_t *bda) {
+    for(int idx=0; idx<count; idx++) {
+        if(memcmp(entries[idx].bda, bda, 6) == 0) return idx;
+    }
+    return -1;
+}
+
+// Every entry is found where it is, and every slot in use is an entry
+static void check_index(const char *name, uint8_t (*pool)[6], int pool_size) {
+    int used = 0;
+    for(int s=0; s<BLE_INDEX_SIZE; s++) {
+        if(index_slots[s]) {
+            used++;
+            CHECK(name, index_slots[s] > 0 && index_slots[s] <= count);
+        }
+    }
+    CHECK(name, used == count);
+    for(int p=0; p<pool_size; p++) {
+        uint32_t slot;
+        CHECK(name, ble_index_find(index_slots, entries, pool[p], &slot) == linear_find(pool[p]));
+    }
+}
+
+// Adds and removes in random order, as ble_cache_add and ble_cache_purge do,
+// checked against a linear search
+static void test_index(void) {
+    enum { POOL = BLE_CACHE_MAX * 3 };
+    static uint8_t pool[POOL][6];
+    uint32_t x = 1;
+    random_bdas(pool, POOL, &x);
+
+    // BDAs which differ only in the last byte
+    for(int p=0; p<16; p++) {
+        memset(pool[p], 0xc0, 6);
+        pool[p][5] = p;
+    }
+
+    count = 0;
+    memset(index_slots, 0, sizeof(index_slots));
+    for(int op=0; op<200000 && !failures; op++) {
+        const uint8_t *bda = pool[bench_next(&x) % POOL];
+        uint32_t slot;
+        int idx = ble_index_find(index_slots, entries, bda, &slot);
+        if(idx < 0 && count < BLE_CACHE_MAX && bench_next(&x) % 3) {
+            memcpy(entries[count].bda, bda, 6);
+            index_slots[slot] = ++count;
+        } else if(idx >= 0 && bench_next(&x) % 2) {
+            // Remove it and move the last entry into its place
+            ble_index_remove(index_slots, entries, slot);
+            if(--count != idx) {
+                ble_index_find(index_slots, entries, entries[count].bda, &slot);
+                entries[idx] = entries[count];
+                index_slots[slot] = idx + 1;
+            }
+        }
+        if(op % 1024 == 0) check_index("add and remove", pool, POOL);
+    }
+    check_index("add and remove", pool, POOL);
+
+    ble_index_rebuild(index_slots, entries, count);
+    check_index("rebuild", pool, POOL);
+}
+
+static int64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint32_t bench_adds_per_s(int reports, int64_t us) {
+    return us > 0 ? (uint32_t)((uint64_t)reports * 1000000 / us) : 0;
+}
+
+static void bench_run(int devices, int reports) {
+    uint8_t (*bdas)[6] = malloc(6 * devices);
+    if(!bdas) {
+        printf("No memory for %d devices\n", devices);
+        exit(1);
+    }
+    uint32_t seed = 0x2545F491;
+    random_bdas(bdas, devices, &seed);
+
+    // Linear search, as ble_cache_add did before the index
+    count = 0;
+    uint32_t x = seed;
+    int64_t start = now_us();
+    for(int r=0; r<reports; r++) {
+        const uint8_t *bda = bdas[bench_next(&x) % devices];
+        if(linear_find(bda) < 0 && count < BLE_CACHE_MAX) {
+            memcpy(entries[count++].bda, bda, 6);
+        }
+    }
+    int64_t linear_us = now_us() - start;
+    int linear_count = count;
+
+    // Hash index
+    count = 0;
+    memset(index_slots, 0, sizeof(index_slots));
+    x = seed;
+    start = now_us();
+    for(int r=0; r<reports; r++) {
+        const uint8_t *bda = bdas[bench_next(&x) % devices];
+        uint32_t slot;
+        if(ble_index_find(index_slots, entries, bda, &slot) < 0 && count < BLE_CACHE_MAX) {
+            memcpy(entries[count].bda, bda, 6);
+            index_slots[slot] = ++count;
+        }
+    }
+    int64_t hashed_us = now_us() - start;
+
+    if(count != linear_count) {
+        printf("FAIL %d devices: linear cached %d, hashed %d\n", devices, linear_count, count);
+        exit(1);
+    }
+    printf("%7d %9d %14u %14u %7.1fx\n", devices, count, bench_adds_per_s(reports, linear_us),
+           bench_adds_per_s(reports, hashed_us), hashed_us ? (double)linear_us / hashed_us : 0.0);
+    free(bdas);
+}
+
+int main(int argc, char **argv) {
+    if(argc > 1 && strcmp(argv[1], "-b") == 0) {
+        int reports = argc > 2 ? atoi(argv[2]) : 10000000;
+        printf("%d reports, cache of %d, index of %d\n", reports, BLE_CACHE_MAX, BLE_INDEX_SIZE);
+        printf("Devices    Cached  Linear adds/s  Hashed adds/s  Speedup\n");
+        bench_run(100, reports);
+        bench_run(1000, reports);
+        return 0;
+    }
+
+    test_index();
+    if(failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("All checks passed, cache of %d\n", BLE_CACHE_MAX);
+    return 0;
+}